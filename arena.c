@@ -0,0 +1,103 @@
+// Copyright (c) 2018 Electric Power Research Institute, Inc.
+// author: Mark Slicker <mark.slicker@gmail.com>
+
+/** @defgroup arena Arena
+
+    Provides a region (bump pointer) allocator. Allocations from an Arena are
+    not freed individually, they are all released at once with
+    @ref arena_reset. This suits data with a common lifetime, such as the
+    objects parsed from a single message.
+    @{
+*/
+
+typedef struct _Arena Arena;
+
+/** @brief Create an Arena.
+    @param size is the size of the initial block of memory
+    @returns a pointer to an Arena
+*/
+Arena *arena_new (int size);
+
+/** @brief Allocate zero initialized memory from an Arena.
+    @param a is a pointer to an Arena
+    @param size is the size of the memory to allocate
+    @returns a pointer to the allocated memory
+*/
+void *arena_alloc (Arena *a, int size);
+
+/** @brief Duplicate a string within an Arena.
+    @param a is a pointer to an Arena
+    @param s is a string
+    @returns a pointer to the copy of the string
+*/
+char *arena_strdup (Arena *a, const char *s);
+
+/** @brief Release all the allocations from an Arena.
+
+    If the allocations needed more than one block of memory, the blocks are
+    replaced with a single block large enough to contain them.
+    @param a is a pointer to an Arena
+*/
+void arena_reset (Arena *a);
+
+/** @brief Free an Arena and all its allocations.
+    @param a is a pointer to an Arena
+*/
+void arena_free (Arena *a);
+
+/** @} */
+
+#ifndef HEADER_ONLY
+
+typedef struct _ArenaBlock {
+  struct _ArenaBlock *next;
+  int size, used;
+  char data[] __attribute__ ((aligned (8)));
+} ArenaBlock;
+
+typedef struct _Arena {
+  ArenaBlock *block; // current block, linked to the previous blocks
+  int total; // the size of all the blocks
+} Arena;
+
+ArenaBlock *arena_block (ArenaBlock *next, int size) {
+  ArenaBlock *b = malloc (sizeof (ArenaBlock) + size);
+  b->next = next; b->size = size; b->used = 0; return b;
+}
+
+Arena *arena_new (int size) {
+  Arena *a = malloc (sizeof (Arena));
+  a->block = arena_block (NULL, size); a->total = size; return a;
+}
+
+void *arena_alloc (Arena *a, int size) {
+  ArenaBlock *b = a->block; void *x;
+  size = (size + 7) & ~7;
+  if (b->size - b->used < size) {
+    int n = max (b->size << 1, size);
+    a->block = b = arena_block (b, n); a->total += n;
+  } x = b->data + b->used; b->used += size;
+  return memset (x, 0, size);
+}
+
+char *arena_strdup (Arena *a, const char *s) {
+  int n = strlen (s) + 1;
+  return memcpy (arena_alloc (a, n), s, n);
+}
+
+void arena_free_blocks (ArenaBlock *b) { ArenaBlock *n;
+  while (b) { n = b->next; free (b); b = n; }
+}
+
+void arena_reset (Arena *a) {
+  if (a->block->next) {
+    arena_free_blocks (a->block);
+    a->block = arena_block (NULL, a->total);
+  } else a->block->used = 0;
+}
+
+void arena_free (Arena *a) {
+  arena_free_blocks (a->block); free (a);
+}
+
+#endif
@@ -0,0 +1,147 @@
+// Copyright (c) 2018 Electric Power Research Institute, Inc.
+// author: Mark Slicker <mark.slicker@gmail.com>
+
+/* Microbenchmarks for the HashTable (string, int64, and int128 keys, with
+   the sparse and flat layouts), the List sorting functions, and the event queue. Each benchmark is run for
+   1k to 1M elements (or the maximum given on the command line), the
+   throughput and the number of allocations per operation are reported. The
+   modules under test are included here so that their allocations can be
+   counted. */
+
+#include <stdio.h>
+#include <inttypes.h>
+#include "se_core.h"
+
+uint64_t bench_allocs = 0;
+
+void *bench_malloc (size_t n) { bench_allocs++; return malloc (n); }
+void *bench_calloc (size_t n, size_t m) { bench_allocs++; return calloc (n, m); }
+void *bench_realloc (void *p, size_t n) { bench_allocs++; return realloc (p, n); }
+
+#define malloc(n) bench_malloc (n)
+#define calloc(n, m) bench_calloc (n, m)
+#define realloc(p, n) bench_realloc (p, n)
+#include "list_util.c"
+#include "time.c"
+#include "hash.c"
+#include "event.c"
+#undef malloc
+#undef calloc
+#undef realloc
+
+typedef struct {
+  int64_t start; uint64_t allocs;
+} Bench;
+
+void bench_start (Bench *b) {
+  b->allocs = bench_allocs; b->start = stat_now ();
+}
+
+void bench_end (Bench *b, const char *name, int n) {
+  int64_t ns = stat_now () - b->start; if (ns <= 0) ns = 1;
+  printf ("%-20s %8d %12.0f ops/s %8.1f ns/op %6.2f allocs/op\n", name, n,
+	  n * 1e9 / ns, (double)ns / n, (double)(bench_allocs - b->allocs) / n);
+}
+
+typedef struct {
+  char name[16]; int64_t id; char mrid[16];
+} Item;
+
+void *item_name (void *data) { Item *x = data; return x->name; }
+void *item_id (void *data) { Item *x = data; return &x->id; }
+void *item_mrid (void *data) { Item *x = data; return x->mrid; }
+
+Item *new_items (int n) { int i; Item *items = malloc (n * sizeof (Item));
+  for (i = 0; i < n; i++) { Item *x = items+i; uint64_t r = rand ();
+    sprintf (x->name, "item%d", i); x->id = (r << 32) ^ i;
+    memcpy (x->mrid, &x->id, 8); memcpy (x->mrid+8, x->name, 8);
+  } return items;
+}
+
+void bench_hash (const char *kind, HashTable *ht, Item *items, int n,
+		 void *(*key) (void *)) {
+  char name[32]; Bench b; int i; Item miss = {"missing", -1, "missing"};
+  sprintf (name, "%s put", kind); bench_start (&b);
+  for (i = 0; i < n; i++) hash_put (ht, items+i);
+  bench_end (&b, name, n);
+  sprintf (name, "%s get", kind); bench_start (&b);
+  for (i = 0; i < n; i++)
+    if (hash_get (ht, key (items+i)) != items+i) printf ("%s: lost\n", kind);
+  bench_end (&b, name, n);
+  sprintf (name, "%s get miss", kind); bench_start (&b);
+  for (i = 0; i < n; i++) hash_get (ht, key (&miss));
+  bench_end (&b, name, n);
+  sprintf (name, "%s resize", kind); bench_start (&b);
+  hash_resize (ht, ht->size << 1);
+  bench_end (&b, name, n);
+  sprintf (name, "%s delete", kind); bench_start (&b);
+  for (i = 0; i < n; i++) hash_delete (ht, key (items+i));
+  bench_end (&b, name, n);
+  hash_free (ht);
+}
+
+typedef struct _Number {
+  struct _Number *next; int value;
+} Number;
+
+int compare_number (void *a, void *b) {
+  return ((Number *)a)->value - ((Number *)b)->value;
+}
+
+Number *new_numbers (int n) { int i; Number *x = malloc (n * sizeof (Number));
+  for (i = 0; i < n; i++) { x[i].value = rand (); x[i].next = x+i+1; }
+  x[n-1].next = NULL; return x;
+}
+
+void bench_sort (int n) { Bench b; Number *x = new_numbers (n), *l; int i;
+  if (n <= 10000) { Number *list = NULL; // insertion is O(n^2)
+    bench_start (&b);
+    for (i = 0; i < n; i++) list = insert_sorted (list, x+i, compare_number);
+    bench_end (&b, "insert_sorted", n); free (x); x = new_numbers (n);
+  }
+  bench_start (&b); l = quick_sort (x, compare_number);
+  bench_end (&b, "quick_sort", n);
+  for (; l && l->next; l = l->next)
+    if (l->value > l->next->value) { printf ("quick_sort: unsorted\n"); break; }
+  free (x);
+}
+
+void bench_events (int n) { Bench b; int i, count = 0; void *any;
+  Item *items = new_items (n); int64_t now = se_time ();
+  bench_start (&b);
+  for (i = 0; i < n; i++) insert_event (items+i, EVENT_NEW, rand () % now);
+  bench_end (&b, "insert_event", n);
+  bench_start (&b);
+  while (next_event (&any)) count++;
+  bench_end (&b, "next_event", n);
+  if (count != n) printf ("next_event: %d of %d events\n", count, n);
+  for (i = 0; i < n; i++) insert_event (items+i, EVENT_NEW, now + 3600);
+  bench_start (&b);
+  for (i = 0; i < n; i++) remove_event (items+i);
+  bench_end (&b, "remove_event", n);
+  free (items);
+}
+
+int main (int argc, char **argv) {
+  int n, max = 1000000;
+  if (argc > 1 && (!number (&max, argv[1]) || max < 1000)) {
+    printf ("usage: bench [max elements >= 1000]\n"); exit (0);
+  }
+  platform_init (); event_init (); srand (1);
+  for (n = 1000; n <= max; n *= 10) { Item *items = new_items (n);
+    printf ("-- %d elements\n", n);
+    bench_hash ("string", new_string_hash (16, item_name), items, n,
+		item_name);
+    bench_hash ("int64", new_int64_hash (16, item_id), items, n, item_id);
+    bench_hash ("int128", new_int128_hash (16, item_mrid), items, n,
+		item_mrid);
+    bench_hash ("flat string", hash_flat (new_string_hash (16, item_name)),
+		items, n, item_name);
+    bench_hash ("flat int64", hash_flat (new_int64_hash (16, item_id)),
+		items, n, item_id);
+    bench_hash ("flat int128", hash_flat (new_int128_hash (16, item_mrid)),
+		items, n, item_mrid);
+    bench_sort (n); bench_events (n); free (items);
+  }
+  return 0;
+}
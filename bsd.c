@@ -34,7 +34,7 @@ typedef struct _Address {
 
 #include "address.c"
 
-int global_if_index;
+THREAD_LOCAL int global_if_index;
 
 void net_select (int index) {
   global_if_index = index;
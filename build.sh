@@ -2,7 +2,7 @@
 #
 # to build targets, run the script as follows:
 #
-# ./build.sh [static] [debug] [cross] [targets ...]
+# ./build.sh [static] [debug] [cross] [perf [pgo]] [targets ...]
 #
 #--------------------------------------------------------
 #
@@ -14,6 +14,7 @@ linux_host=
 linux_prefix="/usr"
 linux_cross_host= # arm-linux-gnueabihf
 linux_cross_prefix=
+march=native # target architecture of perf builds (e.g. x86-64-v3)
 
 #---------------------------------------------------------
 
@@ -24,6 +25,10 @@ compile_args=()
 debug_flags=( -g )
 optimize_flags=( -Os -ffunction-sections -Wl,--gc-sections
 		 -fno-asynchronous-unwind-tables )
+perf_flags=( -O3 -flto=auto -march=$march )
+pgo_generate_flags=( -fprofile-generate -fprofile-update=atomic )
+pgo_use_flags=( -fprofile-use -fprofile-partial-training -fprofile-correction
+		-Wno-missing-profile )
 static_flags=( -static -Wl,-Bstatic )
 # cross_flags=( -no-pie -fno-pie )
 build_dir=build
@@ -70,9 +75,19 @@ if [ -e targets.sh ]; then
     source targets.sh
 fi
 
+pgo=0
+if contains args "pgo"; then
+    pgo=1 # implies perf
+    compile_args+=( pgo )
+    contains args "perf" || args+=( perf )
+fi
+
 if contains args "debug"; then
     compile_args+=( debug )
     flags+=( ${debug_flags[@]} )
+elif contains args "perf"; then
+    compile_args+=( perf )
+    flags+=( ${perf_flags[@]} )
 else
     flags+=( ${optimize_flags[@]} )
 fi
@@ -93,6 +108,14 @@ else
     prefix=${system}_prefix
 fi
 
+# each build profile has its own directory so the results can be compared
+if contains args "perf"; then
+    build_dir=${build_dir}-perf
+    if (( $pgo == 1 )); then
+	build_dir=${build_dir}-pgo
+    fi
+fi
+
 recompile=0
 build_dep=0
 
@@ -229,5 +252,21 @@ if [[ $system == "win32" ]]; then
 fi
 prefix=`$cc -print-sysroot`${!prefix}
 sys_objects=()
+if (( $pgo == 1 )); then
+    # stage 1: build instrumented targets and run the training workload
+    # (in a subshell, building changes the target object lists)
+    rm -f $build_dir/*.gcda
+    (
+	profile_flags=( ${sys_flags[@]} ${pgo_generate_flags[@]} )
+	recompile=1
+	build args sys_objects profile_flags libs
+	if function_exists pgo_train; then
+	    pgo_train
+	fi
+    )
+    # stage 2: rebuild the targets using the profile
+    sys_flags+=( ${pgo_use_flags[@]} )
+    recompile=1
+fi
 build args sys_objects sys_flags libs
 
@@ -433,7 +433,8 @@ void print_schema_entry (SchemaEntry *se, char *parent,
   if (se->type & ST_SIMPLE) {
     print (".type=ST_SIMPLE|"); print_xs_type (se->type);
   } else print (".index=%d", get_index (head, type));
-  if (se->n) print (", .n=%d},\n", se->n); else print ("},\n");
+  if (se->n) print (", .n=%d, .width=%d},\n", se->n, bit_count (se->n));
+  else print ("},\n");
 }
 
 int compare_attr (void *ea, void *eb) {
@@ -558,6 +559,51 @@ void gen_schema_entries (List *sorted, int index, SchemaType *schema) {
   }
 }
 
+// perfect hash of the local names (hash and displace), see NameHash
+void print_name_hash (List *names) {
+  int n = list_length (names), buckets = 1, size = 1, i, j, k, b, d;
+  uint32_t *h = malloc (n * sizeof (uint32_t));
+  int *count, *seeds, *slots, *bucket = malloc (n * sizeof (int));
+  List *l; i = 0;
+  while (buckets*4 < n) buckets <<= 1;
+  while (size < n*2) size <<= 1;
+  count = calloc (buckets, sizeof (int)); seeds = calloc (buckets, sizeof (int));
+  slots = malloc (size * sizeof (int));
+  for (j = 0; j < size; j++) slots[j] = -1;
+  foreach (l, names) { h[i] = name_hash (l->data);
+    count[h[i] & (buckets-1)]++; i++;
+  }
+  // place the largest buckets first
+  while (1) {
+    for (b = -1, j = 0; j < buckets; j++)
+      if (count[j] > 0 && (b < 0 || count[j] > count[b])) b = j;
+    if (b < 0) break;
+    for (d = 0; d < 65536; d++) {
+      for (k = 0, i = 0; i < n; i++) {
+	int s = name_slot (h[i], d) & (size-1);
+	if ((h[i] & (buckets-1)) != b) continue;
+	for (j = 0; j < k; j++) if (bucket[j] == s) break;
+	if (slots[s] >= 0 || j < k) break; bucket[k++] = s;
+      } if (i == n) break;
+    }
+    if (d == 65536) {
+      fprintf (stderr, "print_name_hash: no seed found\n"); exit (1);
+    } seeds[b] = d; count[b] = 0;
+    for (i = 0; i < n; i++)
+      if ((h[i] & (buckets-1)) == b)
+	slots[name_slot (h[i], d) & (size-1)] = i;
+  }
+  print ("const uint16_t se_seeds[] = {");
+  for (i = 0; i < buckets; i++) print ("%d, ", seeds[i]);
+  print ("};\n\n");
+  print ("const int16_t se_slots[] = {");
+  for (i = 0; i < size; i++) print ("%d, ", slots[i]);
+  print ("};\n\n");
+  print ("const NameHash se_hash = {%d, %d, se_seeds, se_slots};\n\n",
+	 buckets, size);
+  free (h); free (bucket); free (count); free (seeds); free (slots);
+}
+
 void print_schema (List *sorted, SchemaDoc *doc) {
   int length = list_length (doc->elements);
   TableEntry *te; List *l, *s; ElementDecl *e;
@@ -617,8 +663,9 @@ void print_schema (List *sorted, SchemaDoc *doc) {
     } else print ("0, ");
   }
   print ("};\n\n");
+  print_name_hash (local_names);
   print ("Schema se_schema = "
-	 "{\"%s\", \"S1\", %d, %d, se_names, se_types, se_entries, se_elements, se_ids};\n",
+	 "{\"%s\", \"S1\", %d, %d, se_names, se_types, se_entries, se_elements, se_ids, &se_hash, &se_codec};\n",
 	 doc->targetNamespace, length, list_length (local_names));
 }
 
@@ -696,3 +743,293 @@ void print_list_info (Named *list, SchemaType *schema) {
   }
   print ("};\n");
 }
+
+/* Specialized XML parse and output functions (see SchemaCodec) for a set of
+   root elements and the complex types they contain. The functions follow the
+   same rules as the table driven parser and output for each SchemaEntry,
+   only with the offsets, bits, and counts resolved when generated. */
+
+// collect the complex types of a type, 0 if a type can't be specialized
+int codec_collect (List **types, SchemaType *t, SchemaType *head) {
+  TableEntry *te;
+  if (!t || !t->name || t->kind != ComplexType) return 0;
+  if (find_by_data (*types, t)) return 1;
+  *types = list_insert (*types, t);
+  foreach (te, t->entries) { SchemaEntry *se = te->se;
+    if (se->type & ST_SIMPLE) {
+      if (se->unbounded) return 0;
+    } else if (se->st || !codec_collect (types, find_by_name (head, te->type),
+					 head)) return 0;
+  } return 1;
+}
+
+// the location of an entry's value (booleans are bits of the flags)
+void codec_field (char *field, SchemaType *t, TableEntry *te) {
+  if (is_boolean (te->se->type)) strcpy (field, "b");
+  else sprintf (field, "b + offsetof (SE_%s_t, %s)", t->name, te->name);
+}
+
+void codec_size (char *size, TableEntry *te) {
+  SchemaEntry *se = te->se;
+  if (!(se->type & ST_SIMPLE)) sprintf (size, "sizeof (SE_%s_t)", te->type);
+  else if (is_pointer (se->type)) strcpy (size, "sizeof (char *)");
+  else sprintf (size, "%d", object_size (se->type, NULL));
+}
+
+void print_put_value (int type, char *v, char *flag) {
+  int n; type ^= ST_SIMPLE; n = type >> 4;
+  switch (type & 0xf) {
+  case XS_STRING: if (n) { print ("output_escaped (o, %s)", v); break; }
+  case XS_ANY_URI: print ("output_escaped (o, *(char **)(%s))", v); break;
+  case XS_BOOLEAN: print ("xml_put_bool (o, *(uint32_t *)b >> (%s) & 1)", flag);
+    break;
+  case XS_HEX_BINARY: print ("output_hex (o, (uint8_t *)(%s), %d)", v, n); break;
+  case XS_LONG: print ("xml_put_int (o, *(int64_t *)(%s))", v); break;
+  case XS_INT: print ("xml_put_int (o, *(int32_t *)(%s))", v); break;
+  case XS_SHORT: print ("xml_put_int (o, *(int16_t *)(%s))", v); break;
+  case XS_BYTE: print ("xml_put_int (o, *(int8_t *)(%s))", v); break;
+  case XS_ULONG: print ("xml_put_uint (o, *(uint64_t *)(%s))", v); break;
+  case XS_UINT: print ("xml_put_uint (o, *(uint32_t *)(%s))", v); break;
+  case XS_USHORT: print ("xml_put_uint (o, *(uint16_t *)(%s))", v); break;
+  case XS_UBYTE: print ("xml_put_uint (o, *(uint8_t *)(%s))", v); break;
+  }
+}
+
+void print_scan_value (int type, char *text, char *v, char *flag) {
+  int n; type ^= ST_SIMPLE; n = type >> 4;
+  switch (type & 0xf) {
+  case XS_STRING: if (n) { print ("xml_string (%s, %s, %d)", text, v, n); break; }
+  case XS_ANY_URI: print ("xml_uri (p, %s, (char **)(%s))", text, v); break;
+  case XS_BOOLEAN: print ("xml_bool (%s, b, %s)", text, flag); break;
+  case XS_HEX_BINARY:
+    print ("parse_hex ((uint8_t *)(%s), %d, %s)", v, n, text); break;
+  case XS_LONG: print ("xml_long (%s, (int64_t *)(%s))", text, v); break;
+  case XS_INT: print ("xml_int (%s, (int32_t *)(%s))", text, v); break;
+  case XS_SHORT: print ("xml_short (%s, (int16_t *)(%s))", text, v); break;
+  case XS_BYTE: print ("xml_byte (%s, (int8_t *)(%s))", text, v); break;
+  case XS_ULONG: print ("xml_ulong (%s, (uint64_t *)(%s))", text, v); break;
+  case XS_UINT: print ("xml_uint (%s, (uint32_t *)(%s))", text, v); break;
+  case XS_USHORT: print ("xml_ushort (%s, (uint16_t *)(%s))", text, v); break;
+  case XS_UBYTE: print ("xml_ubyte (%s, (uint8_t *)(%s))", text, v); break;
+  }
+}
+
+// the number of elements present, see output_count
+void print_put_count (SchemaEntry *se, char *field) {
+  if (is_pointer (se->type)) {
+    print ("  for (n = 0; n < %d && ((char **)(%s))[n]; n++);\n",
+	   se->max, field);
+    if (se->min) print ("  if (n < %d) return 0;\n", se->min);
+  } else if (se->min < se->max) { int diff = se->max - se->min, bits = 1;
+    while (diff >>= 1) bits++;
+    print ("  n = %d + (*(uint32_t *)b >> %d & 0x%x);\n",
+	   se->min, se->bit, ~(-1 << bits));
+    print ("  if (n > %d) n = %d;\n", se->max, se->max);
+    if (se->min) print ("  if (!n) return 0;\n");
+  } else print ("  n = %d;\n", se->min);
+}
+
+// output an element, the item is the location of its value
+void print_put_element (TableEntry *te, char *item, char *flag,
+			char *indent) {
+  SchemaEntry *se = te->se; int len = strlen (te->name);
+  if (se->type & ST_SIMPLE) {
+    print ("%sok_v (xml_put_tag (o, \"<%s>\", %d)\n%s  && ",
+	   indent, te->name, len+2, indent);
+    print_put_value (se->type, item, flag);
+    print ("\n%s  && xml_put (o, \"</%s>\", %d), 0);\n",
+	   indent, te->name, len+3);
+  } else {
+    print ("%sok_v (xml_put_start (o, \"<%s\", %d)\n",
+	   indent, te->name, len+1);
+    print ("%s  && xml_output_%s (o, %s)\n", indent, te->type, item);
+    print ("%s  && xml_put_end (o, \"</%s>\", %d), 0);\n",
+	   indent, te->name, len+3);
+  }
+}
+
+// declare the locals of a generated function, each is " type names;"
+void print_locals (const char *locals) {
+  if (*locals) print ("  %s\n", locals + 1);
+}
+
+void print_put_type (SchemaType *t) {
+  TableEntry *te; char field[128], size[64], item[256], flag[32],
+    locals[64] = "";
+  int i = 0, n = 0, l = 0;
+  foreach (te, t->entries) { SchemaEntry *se = te->se;
+    if (se->attribute) continue;
+    if (se->unbounded) { l = 1; n |= se->min > 0; }
+    else if (se->max != 1) i = n = 1;
+  }
+  if (i || n) strcat (locals, i? " int i, n;" : " int n;");
+  if (l) strcat (locals, " List *l;");
+  print ("int xml_output_%s (Output *o, char *b) {\n", t->name);
+  print_locals (locals);
+  foreach (te, t->entries) { SchemaEntry *se = te->se;
+    codec_field (field, t, te); codec_size (size, te);
+    if (se->attribute) {
+      sprintf (flag, "%d", se->bit);
+      if (is_pointer (se->type)) print ("  if (*(char **)(%s)) {\n", field);
+      else if (se->min < se->max)
+	print ("  if (*(uint32_t *)b >> %d & 1) {\n", se->bit);
+      else print ("  {\n");
+      print ("    ok_v (xml_put (o, \" %s=\\\"\", %d)\n\t  && ",
+	     te->name, (int)strlen (te->name)+3);
+      print_put_value (se->type, field, flag);
+      print ("\n\t  && xml_put (o, \"\\\"\", 1), 0);\n  }");
+      if (is_pointer (se->type) && se->min) print (" else return 0;");
+      print ("\n");
+    } else if (se->unbounded) {
+      if (se->min)
+	print ("  for (n = 0, l = *(List **)(%s); l; l = l->next, n++)\n",
+	       field);
+      else print ("  for (l = *(List **)(%s); l; l = l->next)\n", field);
+      print_put_element (te, "l->data", NULL, "    ");
+      if (se->min) print ("  if (n < %d) return 0;\n", se->min);
+    } else if (se->max == 1) {
+      sprintf (flag, "%d", se->bit);
+      if (is_pointer (se->type)) {
+	print ("  if (*(char **)(%s)) {\n", field);
+	print_put_element (te, field, flag, "    ");
+	print ("  }%s\n", se->min? " else return 0;" : "");
+      } else if (se->min) print_put_element (te, field, flag, "  ");
+      else {
+	print ("  if (*(uint32_t *)b >> %d & 1) {\n", se->bit);
+	print_put_element (te, field, flag, "    "); print ("  }\n");
+      }
+    } else {
+      print_put_count (se, field);
+      sprintf (item, "%s + i*%s", field, size);
+      sprintf (flag, "%d+i", se->bit);
+      print ("  for (i = 0; i < n; i++)\n");
+      print_put_element (te, item, flag, "    ");
+    }
+  }
+  print ("  return 1;\n}\n\n");
+}
+
+// parse an element after its start tag, the item is its location
+void print_scan_element (TableEntry *te, char *item, char *flag,
+			 char *indent) {
+  SchemaEntry *se = te->se; int len = strlen (te->name);
+  if (se->type & ST_SIMPLE) {
+    print ("%sok_v (xml_scan_text (s, text)\n%s  && ", indent, indent);
+    print_scan_value (se->type, "text", item, flag);
+    print ("\n%s  && xml_scan_end (s, \"</%s>\", %d), 0);\n",
+	   indent, te->name, len+3);
+  } else print ("%sok_v (xml_parse_%s (p, s, %s, \"</%s>\", %d), 0);\n",
+		indent, te->type, item, te->name, len+3);
+}
+
+void print_scan_type (SchemaType *t) {
+  TableEntry *te; char field[128], size[64], item[256], flag[32],
+    locals[128] = " ScanTag tag;";
+  int required = 0, text = 0, v = 0, n = 0, l = 0;
+  foreach (te, t->entries) { SchemaEntry *se = te->se;
+    if (se->attribute) v = 1;
+    else {
+      text |= (se->type & ST_SIMPLE) != 0;
+      if (se->unbounded) l = n = 1; else if (se->max != 1) n = 1;
+    }
+  }
+  if (text || v) strcat (locals, text? v? " char text[SCAN_TEXT], *v;"
+			 : " char text[SCAN_TEXT];" : " char *v;");
+  if (n) strcat (locals, " int n;");
+  if (l) strcat (locals, " List *l, **tail;");
+  print ("int xml_parse_%s (Parser *p, char **s, char *b,\n", t->name);
+  print ("\t\tconst char *end, int length) {\n");
+  print_locals (locals);
+  print ("  ok_v (xml_scan_tag (s, &tag), 0);\n");
+  foreach (te, t->entries) { SchemaEntry *se = te->se;
+    if (se->attribute) {
+      int bit = se->bit;
+      codec_field (field, t, te);
+      print ("  if ((v = xml_scan_attr (&tag, \"%s\", %d))) {\n",
+	     te->name, (int)strlen (te->name));
+      if (!se->min && !is_pointer (se->type))
+	print ("    *(uint32_t *)b |= 1 << %d;\n", bit++);
+      sprintf (flag, "%d", bit);
+      print ("    ok_v ("); print_scan_value (se->type, "v", field, flag);
+      print (", 0);\n  }\n");
+    } else if (se->min) required = 1;
+  }
+  print ("  if (tag.empty) return %d;\n", !required);
+  foreach (te, t->entries) {
+    SchemaEntry *se = te->se; int len = strlen (te->name), diff, bit;
+    if (se->attribute) continue;
+    codec_field (field, t, te); codec_size (size, te);
+    diff = se->max - se->min;
+    bit = se->bit + (diff && !is_pointer (se->type)? bit_count (diff) : 0);
+    if (se->unbounded) {
+      print ("  tail = (List **)(%s);\n", field);
+      print ("  for (n = 0; xml_scan_start (s, \"<%s\", %d); n++) {\n",
+	     te->name, len+1);
+      print ("    l = *tail = parse_alloc (p, sizeof (List));\n");
+      print ("    l->data = parse_alloc (p, %s); tail = &l->next;\n", size);
+      print_scan_element (te, "l->data", NULL, "    ");
+      print ("  }\n");
+      if (se->min > 1) print ("  if (n && n < %d) return 0;\n", se->min);
+    } else if (se->max == 1) {
+      sprintf (flag, "%d", bit);
+      print ("  if (xml_scan_start (s, \"<%s\", %d)) {\n", te->name, len+1);
+      if (diff) print ("    *(uint32_t *)b |= 1 << %d;\n", se->bit);
+      print_scan_element (te, field, flag, "    ");
+      print ("  }\n");
+    } else {
+      sprintf (item, "%s + n*%s", field, size);
+      sprintf (flag, "%d+n", bit);
+      print ("  for (n = 0; n < %d && xml_scan_start (s, \"<%s\", %d); n++)\n",
+	     se->max, te->name, len+1);
+      print_scan_element (te, item, flag, "    ");
+      if (se->min > 1) print ("  if (n && n < %d) return 0;\n", se->min);
+      if (diff) print ("  if (n) *(uint32_t *)b |= (n - %d) << %d;\n",
+		       se->min, se->bit);
+    }
+  }
+  print ("  return xml_scan_end (s, end, length);\n}\n\n");
+}
+
+void print_codec (SchemaDoc *doc, const char * const *roots, int count) {
+  List *types = NULL, *found, *l; ElementDecl *e, *root[count]; int i, n = 0;
+  for (i = 0; i < count; i++) {
+    SchemaType *t;
+    foreach (e, doc->elements) if (streq (e->name, roots[i])) break;
+    found = types;
+    if (e && (t = find_by_name (doc->types, e->type))
+	&& codec_collect (&found, t, doc->types)) {
+      types = found; root[n++] = e;
+    } else fprintf (stderr, "print_codec: %s not specialized\n", roots[i]);
+  }
+  types = list_reverse (types);
+  print ("// auto-generated by schema_gen\n\n");
+  foreach (l, types) { SchemaType *t = l->data;
+    print ("int xml_output_%s (Output *o, char *b);\n", t->name);
+    print ("int xml_parse_%s (Parser *p, char **s, char *b,\n", t->name);
+    print ("\t\tconst char *end, int length);\n");
+  } print ("\n");
+  foreach (l, types) {
+    print_put_type (l->data); print_scan_type (l->data);
+  }
+  print ("int se_xml_root (char **s) {\n");
+  for (i = 0; i < n; i++)
+    print ("  if (xml_scan_start (s, \"<%s\", %d)) return SE_%s;\n",
+	   root[i]->name, (int)strlen (root[i]->name)+1, root[i]->name);
+  print ("  return -1;\n}\n\n");
+  print ("int se_parse_xml (Parser *p, char **s, void *obj, int type) {\n");
+  print ("  switch (type) {\n");
+  for (i = 0; i < n; i++) { e = root[i];
+    print ("  case SE_%s:\n    return xml_parse_%s (p, s, obj, \"</%s>\", %d);\n",
+	   e->name, e->type, e->name, (int)strlen (e->name)+3);
+  } print ("  } return 0;\n}\n\n");
+  print ("int se_output_xml (Output *o, void *obj, int type) {\n");
+  print ("  switch (type) {\n");
+  for (i = 0; i < n; i++) { int len = strlen (root[i]->name); e = root[i];
+    print ("  case SE_%s:\n    return xml_put_start (o, \"<%s\", %d)\n",
+	   e->name, e->name, len+1);
+    print ("      && xml_output_%s (o, obj)\n", e->type);
+    print ("      && xml_put_end (o, \"</%s>\", %d);\n", e->name, len+3);
+  } print ("  } return 0;\n}\n\n");
+  print ("const SchemaCodec se_codec = "
+	 "{se_xml_root, se_parse_xml, se_output_xml};\n");
+}
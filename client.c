@@ -7,8 +7,6 @@
     @{
 */
 
-#define SERVICE_FOUND (EVENT_NEW+1)
-
 /** @brief Perform polling on the behalf of a client.
 
     Returns SERVICE_FOUND with a pointer to a Service as the event object when
@@ -32,23 +30,17 @@ void client_init (char *name, const char *cert);
 #ifndef HEADER_ONLY
 
 int client_poll (void **any, int timeout) {
-  int event; static Service *s = NULL;
- top:
-  if (s = service_next (s)) {
-    *any = s; return SERVICE_FOUND;
-  }
-  switch (event = event_poll (any, timeout)) {
-  case TCP_CONNECT: return TCP_PORT;
-  case UDP_PORT:
-    if (s = service_receive (*any)) goto top;
-  } return event;
+  return se_poll (any, timeout);
 }
 
 int store_cred (void *ctx, uint8_t *cert, int length) {
   uint8_t *lfdi = se_lfdi (ctx);
   uint64_t *sfdi = se_sfdi (ctx);
-  *sfdi = lfdi_hash (lfdi, cert, length);
-  printf ("store_cred "); print_bytes (lfdi, 20); printf ("\n");
+  *sfdi = lfdi_hash (lfdi, cert, length); index_lfdi (ctx);
+  if (log_enabled (LOG_DEBUG)) { char hex[41]; int i;
+    for (i = 0; i < 20; i++) sprintf (hex + i*2, "%02x", lfdi[i]);
+    log_printf ("store_cred %s\n", hex);
+  }
   return 1;
 }
 
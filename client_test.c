@@ -2,9 +2,11 @@
 // author: Mark Slicker <mark.slicker@gmail.com>
 
 #include <stdlib.h>
+#include <sys/resource.h>
 
 #include "der_client.c"
 #include "query.c"
+#include "reactor.c"
 
 #define VERSION "0.2.11"
 
@@ -39,12 +41,32 @@ void usage () {
 #define DELETE_DEVICE (1<<15)
 #define CLIENT_FOUND (1<<16)
 #define INVERTER_CLIENT (1<<17)
+#define AGGREGATOR (1<<18)
+
+#define STATS_DUMP (EVENT_NEW+18)
+#define SNAPSHOT_SAVE (EVENT_NEW+23)
+#define TRACE_SAVE (EVENT_NEW+24)
+
+#define SAVE_DELAY 10 // seconds from a schedule update to saving a file
 
 int dut_strategy;
 
-int server = 0, test = 0, secure = 0, interval = 5*60, primary = 0, pin = 0;
-Stub *edevs; char *path = NULL; uint64_t delete_sfdi; int ipv4 = 0;
-SE_EndDevice_t *client_edev = NULL;
+int server = 0, secure = 0, interval = 5*60, primary = 0, pin = 0;
+char *path = NULL; uint64_t delete_sfdi; int ipv4 = 0, reactors = 0;
+char *target = NULL; // URI of the resource to retrieve (see uri_target)
+char *snapshot = NULL; // snapshot file for a warm start
+int snapshot_dirty = 0; // a SNAPSHOT_SAVE is pending
+char *services = NULL; // DNS-SD cache file
+char *stats_file = NULL; int stats_period; // statistics dump
+char *trace_file = NULL; // retrieval trace (Chrome trace event format)
+int trace_dirty = 0; // a TRACE_SAVE is pending
+int meter_granularity = 60; // aggregation interval for meter readings
+int poll_batch = 64; // events polled at a time (see se_poll_batch)
+// per reactor state
+THREAD_LOCAL int test = 0;
+THREAD_LOCAL Stub *edevs;
+THREAD_LOCAL SE_EndDevice_t *client_edev = NULL;
+THREAD_LOCAL List *aggregate = NULL; // devices managed in aggregator mode
 
 int subtype_query (char *arg, char *name) {
   char subtype[12] = {0}; int qu = 0, n;
@@ -63,21 +85,27 @@ int subtype_query (char *arg, char *name) {
   } return 0;
 }
 
-int uri_retrieval (char *arg) {
-  Uri128 buf = {0}; Uri *uri = &buf.uri;
-  void *conn; Query q = {0};
+// a URI target, retrieved by uri_retrieval once the options are processed
+int uri_target (char *arg) {
+  Uri128 buf = {0}; Uri *uri = &buf.uri; Query q = {0};
   if (!uri_parse (&buf, arg, 127) || !uri->host) {
     if (uri->scheme) {
       printf ("error parsing URI %s\n", arg); exit (0);
     } return 0;
   }
-  ipv4 = (address_type (uri->host) == ADDR_IPv4);
-  conn = se_connect_uri (uri);
   if (uri->query && !parse_query (&q, uri->query)) {
     printf ("error parsing URI query \"%s\"\n", uri->query); exit (0);
   }
-  get_resource (conn, -1, uri->path, q.limit);
-  return 1;
+  ipv4 = (address_type (uri->host) == ADDR_IPv4);
+  target = arg; return 1;
+}
+
+// retrieve the URI target, each reactor retrieves it with its own connection
+void uri_retrieval () {
+  Uri128 buf = {0}; Uri *uri = &buf.uri; Query q = {0};
+  uri_parse (&buf, target, 127);
+  if (uri->query) parse_query (&q, uri->query);
+  get_resource (se_connect_uri (uri), -1, uri->path, q.limit);
 }
 
 int cert_name (char *arg) {
@@ -88,9 +116,39 @@ int cert_name (char *arg) {
   } return 1;
 }
 
+// device list entry: <sfdi | device_cert> [settings_dir]
+void aggregate_device (int n, char *line) {
+  char *name = strtok (line, " \t"), *settings = strtok (NULL, " \t");
+  uint64_t sfdi; DerDevice *d;
+  if (number64 (&sfdi, name)) d = get_device (sfdi);
+  else if (file_type (name) == FILE_REGULAR) { uint8_t lfdi[20];
+    sfdi = lfdi_gen (lfdi, name);
+    d = get_device (sfdi); memcpy (d->lfdi, lfdi, 20);
+  } else {
+    printf ("aggregate: line %d, device \"%s\" is not an SFDI or "
+	    "certificate file\n", n+1, name); exit (0);
+  }
+  if (settings) device_settings (sfdi, settings);
+  aggregate = list_insert (aggregate, d);
+}
+
+/* Recording or replay starts before any connection, timer or port is
+   created, as the platform objects of the log are identified by the order
+   of their creation. */
+void replay_command (int argc, char **argv) { int i;
+  for (i = 2; i < argc - 1; i++) {
+    if (streq (argv[i], "record") && !replay_record (argv[i+1])) {
+      printf ("record command could not create %s\n", argv[i+1]); exit (0);
+    } else if (streq (argv[i], "replay") && !replay_open (argv[i+1])) {
+      printf ("replay command could not open %s\n", argv[i+1]); exit (0);
+    }
+  }
+}
+
 void options (int argc, char **argv) {
   int i = 2, index; char *name = argv[1];
   if (argc < 3) usage ();
+  replay_command (argc, argv);
   if ((index = interface_index (name)) < 0) {
     printf ("options: interface %s not found\n", name); exit (0);
   }
@@ -98,7 +156,7 @@ void options (int argc, char **argv) {
   // process certificates and base query
   while (i < argc) { DerDevice *d;
     if (subtype_query (argv[i], name)
-	|| uri_retrieval (argv[i])) {
+	|| uri_target (argv[i])) {
       i++; break;
     } else if (!secure) {
       client_init (name, argv[i]); secure = 1;
@@ -109,6 +167,14 @@ void options (int argc, char **argv) {
 	      argv[i]); exit (0);
     } i++;
   }
+  if (reactors && snapshot) {
+    printf ("options: the snapshot command is not supported with reactors\n");
+    exit (0);
+  }
+  if (reactors && !(test & AGGREGATOR)) {
+    printf ("options: reactors command requires the aggregate command\n");
+    exit (0);
+  }
   if (!secure) {
     printf ("options: warning, no device certificate specified, "
 	    "TLS library will be uninitialized\n");
@@ -121,8 +187,12 @@ void options (int argc, char **argv) {
     const char * const commands[] =
       {"sfdi", "edev", "fsa", "register", "pin", "primary", "all", "time",
        "self", "subscribe", "metering", "meter", "alarm", "poll", "load",
-       "device", "delete", "inverter", "DUT"};
-    switch (string_index (argv[i], commands, 19)) {
+       "device", "delete", "inverter", "DUT", "aggregate", "reactors",
+       "pipeline", "snapshot", "responses", "services", "stats", "budget",
+       "autosubscribe", "log", "settings", "granularity", "workers",
+       "memory", "record", "replay", "share", "affinity", "compress",
+       "trace", "batch", "idle"};
+    switch (string_index (argv[i], commands, 41)) {
     case 0: // sfdi
       if (++i == argc || !number64 (&device_sfdi, argv[i])) {
 	printf ("sfdi command expects number argument\n"); exit (0);
@@ -150,6 +220,7 @@ void options (int argc, char **argv) {
       test |= GET_SELF; break;
     case 9: // subscribe
       subscribe_init (name, ipv4, secure);
+      log_level = max (log_level, LOG_INFO);
       test |= GET_EDEV | GET_FSA | SUBSCRIBE_TEST; break;
     case 10: // metering
       test |= GET_ALL | REGISTER_TEST | INCLUDE_READINGS | PUT_SETTINGS;
@@ -193,18 +264,112 @@ void options (int argc, char **argv) {
         dut_strategy = 0;
       }
       break;
+    case 19: // aggregate
+      if (++i == argc || file_type (argv[i]) != FILE_REGULAR) {
+	printf ("aggregate command expects a device list file\n"); exit (0);
+      } process_file (argv[i], aggregate_device);
+      printf ("aggregate: %d devices loaded\n", list_length (aggregate));
+      test |= GET_ALL | SCHEDULE_TEST | AGGREGATOR; break;
+    case 20: // reactors
+      if (++i == argc || !number (&reactors, argv[i]) || reactors < 1) {
+	printf ("reactors command expects a number of threads\n"); exit (0);
+      } break;
+    case 21: // pipeline
+      if (++i == argc || !number (&http_default_depth, argv[i])) {
+	printf ("pipeline command expects a number of requests\n"); exit (0);
+      } break;
+    case 22: // snapshot
+      if (++i == argc) {
+	printf ("snapshot command expects a file name\n"); exit (0);
+      } snapshot = argv[i]; break;
+    case 23: // responses
+      if (++i == argc || !number (&response_window, argv[i])) {
+	printf ("responses command expects a window in seconds\n"); exit (0);
+      } break;
+    case 24: // services
+      if (++i == argc) {
+	printf ("services command expects a file name\n"); exit (0);
+      } services = argv[i];
+      printf ("services: %d restored\n", dnssd_load (services)); break;
+    case 25: // stats
+      if (i+2 >= argc || !number (&stats_period, argv[i+2])
+	  || stats_period <= 0) {
+	printf ("stats command expects a file name and a period in seconds\n");
+	exit (0);
+      } stats_file = argv[i+1]; se_stats = 1; i += 2; break;
+    case 26: // budget
+      if (++i == argc || !number (&poll_budget, argv[i]) || poll_budget < 0) {
+	printf ("budget command expects a number of polls per second\n");
+	exit (0);
+      } break;
+    case 27: // autosubscribe
+      if (!notification_uri[0]) subscribe_init (name, ipv4, secure);
+      subscribe_all = 1; break;
+    case 28: // log
+      if (++i == argc || !number (&log_level, argv[i])
+	  || !in_range (log_level, LOG_ERROR, LOG_DEBUG)) {
+	printf ("log command expects a level from 0 to 3\n"); exit (0);
+      } break;
+    case 29: // settings
+      if (++i == argc) {
+	printf ("settings command expects a file name\n"); exit (0);
+      } printf ("settings: %d cached files\n", settings_cache_load (argv[i]));
+      break;
+    case 30: // granularity
+      if (++i == argc || !number (&meter_granularity, argv[i])
+	  || meter_granularity <= 0) {
+	printf ("granularity command expects an interval in seconds\n");
+	exit (0);
+      } break;
+    case 31: // workers
+      if (++i == argc || !number (&index, argv[i]) || index < 1) {
+	printf ("workers command expects a number of threads\n"); exit (0);
+      } parse_pool_start (index); break;
+    case 32: // memory
+      if (++i == argc || !number (&index, argv[i]) || index < 1) {
+	printf ("memory command expects a budget in megabytes\n"); exit (0);
+      } memory_budget = (int64_t)index << 20; break;
+    case 33: case 34: // record, replay (see replay_command)
+      if (++i == argc) {
+	printf ("%s command expects a file name\n", argv[i-1]); exit (0);
+      } break;
+    case 35: // share
+      share_objects = 1; break;
+    case 36: // affinity
+      reactor_affinity = 1; break;
+    case 37: // compress
+      if (++i == argc || !number (&index, argv[i]) || index < 0) {
+	printf ("compress command expects a body size in bytes\n"); exit (0);
+      }
+#ifdef HTTP_ZLIB
+      http_accept_encoding = 1; se_compress_size = index; break;
+#else
+      printf ("compress command requires a build with HTTP_ZLIB\n"); exit (0);
+#endif
+    case 38: // trace
+      if (++i == argc) {
+	printf ("trace command expects a file name\n"); exit (0);
+      } trace_file = argv[i]; retrieve_trace = 1; break;
+    case 39: // batch
+      if (++i == argc || !number (&poll_batch, argv[i]) || poll_batch < 1) {
+	printf ("batch command expects a number of events\n"); exit (0);
+      } se_poll_batch (poll_batch); break;
+    case 40: // idle
+      if (++i == argc || !number (&se_max_idle, argv[i]) || se_max_idle < 0) {
+	printf ("idle command expects a number of connections\n"); exit (0);
+      } break;
     default:
       printf ("unknown command \"%s\"\n", argv[i]); exit (0);
     }
     i++;
-  }
+  } settings_cache_save ();
 }
 
 void test_fail (char *test, char *description) {
   printf ("%s failed: %s\n", test, description); exit (0);
 }
 
-Stub *dcap_mup = NULL;
+THREAD_LOCAL Stub *dcap_mup = NULL;
 
 void generic_alarm (Stub *r) {
   SE_LogEvent_t le = {0};
@@ -229,7 +394,7 @@ void alarm_test (Stub *r) {
 }
 
 void alarm_dep (Stub *r) {
-  generic_alarm (r->deps->data);
+  generic_alarm (first_dep (r));
 }
 
 void put_der_settings (void *conn, Settings *ds, SE_DER_t *der) {
@@ -339,6 +504,7 @@ void get_edev_subs (Stub *edevs) { List *l;
     Stub *s = l->data;
     SE_EndDevice_t *e = resource_data (s);
     if (test & INVERTER_CLIENT && e->sFDI != device_sfdi) continue;
+    if (test & AGGREGATOR && !find_device (&e->sFDI)) continue;
     s->completion = edev_complete;
     get_list_dep (s, e, DERList);
     if (test & GET_FSA) get_list_dep (s, e, FunctionSetAssignmentsList);
@@ -355,13 +521,16 @@ void check_registration (Stub *r) {
 }
 
 void end_device (Stub *r) {
-  SE_EndDevice_t *e = resource_data (r);
+  SE_EndDevice_t *e = resource_data (r); DerDevice *d;
+  if (test & AGGREGATOR && (d = find_device (&e->sFDI))) d->edev = r;
   if (test & DELETE_DEVICE && e->sFDI == delete_sfdi) {
     delete_stub (r); test &= ~DELETE_DEVICE;
   }
   if (e->sFDI == device_sfdi) {
     client_edev = e;
     test |= CLIENT_FOUND;
+    if (subscribe_all && se_exists (e, SubscriptionListLink))
+      subscription_list (r->conn, e->SubscriptionListLink.href);
     if (device_sfdi == delete_sfdi) return;
     if (test & REGISTER_TEST) {
       if (se_exists (e, RegistrationLink)) {
@@ -378,7 +547,28 @@ void end_device (Stub *r) {
   }
 }
 
+// POST an EndDevice for each aggregated device not in the EndDeviceList,
+// a device is registered once (again only after its EndDevice is removed)
+int register_aggregate (Stub *r) { List *l; int count = 0;
+  foreach (l, aggregate) { DerDevice *d = l->data;
+    if (!d->edev && !d->registered) { SE_EndDevice_t edev = {0};
+      edev.sFDI = d->sfdi; d->registered = 1;
+      se_post (r->conn, &edev, SE_EndDevice, r->base.name); count++;
+    }
+  }
+  if (count) { // retrieve the list again to pick up the new instances
+    printf ("aggregate: registering %d devices\n", count);
+    update_resource (r);
+  } return count;
+}
+
 void edev_list (Stub *r) { edevs = r;
+  if (test & AGGREGATOR) {
+    SE_EndDeviceList_t *edevl = resource_data (r);
+    r->poll_rate = se_exists (edevl, pollRate)? edevl->pollRate : 900;
+    poll_resource (r); register_aggregate (r);
+    get_edev_subs (r); return;
+  }
   if (test & DELETE_DEVICE) {
     test_fail ("delete device", "client EndDevice instance not found");
   }
@@ -445,35 +635,34 @@ void update_mup (Stub *s) {
 	se_post (d->mup->conn, r->data, SE_MirrorMeterReading,
 		 resource_name (d->mup));
     }
-    insert_event (d, DEVICE_METERING, 0);
-  }
-}
-
-void post_readings (DerDevice *d) { List *r;
-  int64_t now = se_time (), next = now + d->metering_rate;
-  printf ("post_readings\n");
-  foreach (r, d->readings) {
-    SE_MirrorMeterReading_t *mmr = r->data;
-    SE_Reading_t *rd = &mmr->Reading;
-    se_clear (mmr, ReadingType); se_set (mmr, Reading);
-    if (mmr->nextUpdateTime) {
-      se_set (mmr, lastUpdateTime);
-      mmr->lastUpdateTime = mmr->nextUpdateTime;
-    } else se_set (mmr, nextUpdateTime);
-    mmr->nextUpdateTime = next;
-    rd->_flags = SE_value_exists | SE_timePeriod_exists;
-    rd->timePeriod.start = now;
-    switch (mmr->ReadingType.uom) {
-    case 5: rd->value = 20; break; // Amps
-    case 29: rd->value = 230; break; // Volts
-    case 33: rd->value = 60; break; // Hz
-    case 38: case 61: case 63:
-      rd->value = 5000;
+    if (!d->meter) {
+      d->meter = meter_new (d->readings, meter_granularity,
+			    d->metering_rate * 2);
+      d->meter->posted = se_time ();
+      insert_event (d, DEVICE_METERING, 0);
     }
-    se_post (d->mup->conn, mmr, SE_MirrorMeterReading,
-	     resource_name (d->mup));
   }
-  insert_event (d, DEVICE_METERING, next);
+}
+
+// sample the readings every second, post them at the metering rate
+void post_readings (DerDevice *d) { Meter *m = d->meter;
+  int64_t now = se_time (); int i, n;
+  for (i = 0; i < m->count; i++) { int64_t value = 0;
+    switch (m->channel[i].mmr->ReadingType.uom) {
+    case 5: value = 20; break; // Amps
+    case 29: value = 230; break; // Volts
+    case 33: value = 60; break; // Hz
+    case 38: case 61: case 63:
+      value = 5000;
+    } meter_sample (m, i, now, value);
+  }
+  if (now >= m->posted + d->metering_rate) {
+    n = meter_post (m, d->mup->conn, resource_data (d->mup),
+		    resource_name (d->mup), now);
+    if (n < 0) printf ("post_readings: deferred, server busy\n");
+    else printf ("post_readings: %d readings\n", n);
+  }
+  insert_event (d, DEVICE_METERING, now + 1);
 }
 
 void log_event (Stub *log) { List *l;
@@ -497,6 +686,20 @@ void self_device (Stub *r) {
   poll_resource (r);
 }
 
+// response throughput since the last report, memory per aggregated device,
+// TLS handshakes that resumed a session vs. full handshakes
+void print_load () { static uint64_t last = 0; struct rusage r;
+  uint64_t count = stat_count (STAT_HTTP_RESPONSE);
+  getrusage (RUSAGE_SELF, &r);
+  printf ("load: %.1f responses/s, %ld KB peak RSS, %.2f KB per device, "
+	  "%" PRId64 " KB heap\n",
+	  (double)(count - last) / stats_period, r.ru_maxrss,
+	  (double)r.ru_maxrss / max (list_length (aggregate), 1),
+	  memory_used () >> 10);
+  printf ("tls: %u resumed, %u full handshakes\n", tls_resumed, tls_full);
+  last = count;
+}
+
 void test_dep (Stub *r) {
   switch (resource_type (r)) {
   case SE_Time: time_sync (r); break;
@@ -513,15 +716,88 @@ void test_dep (Stub *r) {
   }
 }
 
+typedef struct {
+  int test; List *aggregate;
+} ReactorConfig;
+
+// reactor thread, handles the aggregated devices within its shard
+void reactor_loop (Reactor *r) {
+  ReactorConfig *config = reactor_context (r);
+  Service *s; void *any; List *l; DerDevice *d;
+  test = config->test;
+  foreach (l, config->aggregate) { d = l->data;
+    if (reactor_shard (r, d->sfdi)) {
+      insert_device (d); aggregate = list_insert (aggregate, d);
+    }
+  }
+  reactor_printf (r, "reactor %d: %d devices\n",
+		  r - _reactors, list_length (aggregate));
+  subscribe_thread (); se_poll_batch (poll_batch);
+  if (target) uri_retrieval ();
+  while (1) { int event; EventBlock *eb; DefaultControl *dc;
+    switch (event = der_poll (&any, -1)) {
+    case REACTOR_WAKE:
+      while (s = reactor_next_service (r)) get_dcap (s, secure);
+      break;
+    case TCP_ACCEPT:
+      accept_notifier (any);
+    case TCP_PORT:
+      if (conn_session (any)) {
+	if (http_client (any)) process_http (any, test_dep);
+	else process_notifications (any, test_dep);
+      } break;
+    case TCP_TIMEOUT: case TCP_CLOSED:
+      cleanup_http (any); break;
+    case DEVICE_SCHEDULE: d = any;
+      reactor_printf (r, "Event Schedule for device %" PRIu64 " -- %" PRId64
+		      "\n", d->sfdi, se_time ()); break;
+    case EVENT_START: case EVENT_END: eb = any; d = eb->context;
+      reactor_printf (r, "Event %s \"%s\" EndDevice: %" PRIu64 " -- %" PRId64
+		      "\n", event == EVENT_START? "Start" : "End",
+		      ((SE_Event_t *)resource_data (eb->event))->description,
+		      d->sfdi, se_time ()); break;
+    case DEFAULT_START: case DEFAULT_END: dc = any; d = dc->context;
+      reactor_printf (r, "Default Control \"%s\" EndDevice: %" PRIu64
+		      " -- %" PRId64 "\n", dc->dderc->description, d->sfdi,
+		      se_time ()); break;
+    }
+  }
+}
+
+void reactor_main () {
+  ReactorConfig config = {test, aggregate};
+  Service *s; void *any; char *text;
+  reactor_start (reactors, reactor_loop, &config);
+  while (1) {
+    switch (der_poll (&any, -1)) {
+    case SERVICE_FOUND: s = any;
+      print_service (s); reactor_service (s);
+      if (services) dnssd_save (services); break;
+    case REACTOR_WAKE:
+      while (text = reactor_output ()) {
+	printf ("%s", text); free (text);
+      } fflush (stdout); break;
+    }
+  }
+}
+
 int main (int argc, char **argv) {
   Service *s; void *any;
   version ();
   platform_init ();
-  options (argc, argv);
+  options (argc, argv); log_start (stdout);
+  if (reactors) reactor_main ();
+  if (target) uri_retrieval ();
+  if (snapshot && test) {
+    printf ("snapshot: %d resources\n", snapshot_load (snapshot, test_dep));
+    snapshot_roots ();
+  }
+  if (stats_file) insert_event (NULL, STATS_DUMP, se_time () + stats_period);
   while (1) {
     switch (der_poll (&any, -1)) {
     case SERVICE_FOUND: s = any;
       print_service (s);
+      if (services) dnssd_save (services);
       if (test) get_dcap (s, secure);
       else if (path)
 	get_resource (service_connect (s, secure), -1, path, 0);
@@ -542,8 +818,25 @@ int main (int argc, char **argv) {
     case TCP_CLOSED:
       cleanup_http (any);
       printf ("Connection closed\n"); return 0;
+    case REPLAY_END:
+      replay_print (); if (se_stats) stats_print (stdout); return 0;
     case DEVICE_SCHEDULE:
-      print_event_schedule (any); break;
+      print_event_schedule (any);
+      if (trace_file) { DerDevice *d = any;
+	trace_schedule (d->schedule.device, stdout);
+	if (!trace_dirty) {
+	  insert_event (NULL, TRACE_SAVE, se_time () + SAVE_DELAY);
+	  trace_dirty = 1;
+	}
+      }
+      if (snapshot && !snapshot_dirty) {
+	insert_event (NULL, SNAPSHOT_SAVE, se_time () + SAVE_DELAY);
+	snapshot_dirty = 1;
+      } break;
+    case SNAPSHOT_SAVE:
+      snapshot_save (snapshot); snapshot_dirty = 0; break;
+    case TRACE_SAVE:
+      trace_save (trace_file); trace_dirty = 0; break;
     case EVENT_START:
       print_event_start (any); break;
     case EVENT_END:
@@ -554,6 +847,12 @@ int main (int argc, char **argv) {
       print_default_control (any); break;
     case DEVICE_METERING:
       post_readings (any); break;
+    case STATS_DUMP:
+      stats_print (stdout); pool_print (stdout);
+      if (share_objects) share_print (stdout);
+      print_load ();
+      stats_dump (stats_file);
+      insert_event (NULL, STATS_DUMP, se_time () + stats_period); break;
     }
   }
 }
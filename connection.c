@@ -44,6 +44,17 @@ int conn_read (void *conn, char *buffer, int size);
  */
 int conn_write (void *conn, const char *data, int length);
 
+/** @brief Write a number of data segments to a Connection.
+
+    For a TCP connection the segments are written with one gathered write,
+    for a TLS connection the segments are coalesced into a single record.
+    @param conn is a pointer to a Connection
+    @param seg is an array of data segments
+    @param n is the number of segments
+    @returns the length of the data written or -1 on failure
+*/
+int conn_writev (void *conn, const DataSegment *seg, int n);
+
 /** @brief Close a Connection.
 
     Send a TLS alert for a TLS connection, and send RST for a TCP connection.
@@ -73,7 +84,8 @@ void *conn_accept (void *conn, Acceptor *a, int secure);
 
     Send a TCP connection request to the server at the Address. If a secure
     connection is requested assign the Connection the role of a TLS client
-    and setup the connection for reading and writing TLS data.
+    and setup the connection for reading and writing TLS data, a cached
+    session with the server is resumed if possible.
     @param conn is a pointer to a Connection
     @param server is the Address of a TCP/TLS server
     @param secure is 1 for a TLS connection, 0 for a TCP connection
@@ -81,6 +93,18 @@ void *conn_accept (void *conn, Acceptor *a, int secure);
 */
 void *conn_connect (void *conn, Address *server, int secure);
 
+/** @brief Connect to a server that has several addresses.
+
+    The same as @ref conn_connect, but the addresses are raced (see
+    @ref net_connect_any) and a TLS session is resumed with the first.
+    @param conn is a pointer to a Connection
+    @param servers is an array of server Addresses
+    @param n is the number of Addresses
+    @param secure is 1 for a TLS connection, 0 for a TCP connection
+    @returns the value conn
+*/
+void *conn_connect_any (void *conn, Address *servers, int n, int secure);
+
 /** @brief Get the TLS session ID.
     
     The session ID is a 32 byte value that identifies a client/server session.
@@ -102,6 +126,7 @@ typedef struct _Connection {
   int (*session) (void *);
   int (*read) (void *, char *, int);
   int (*write) (void *, const char *, int);
+  int (*writev) (void *, const DataSegment *, int);
   void (*close) (void *);
 } Connection;
 
@@ -114,6 +139,9 @@ int conn_read (void *conn, char *buffer, int size) {
 int conn_write (void *conn, const char *data, int length) {
   return conn_field (conn, write (conn, data, length));
 }
+int conn_writev (void *conn, const DataSegment *seg, int n) {
+  return conn_field (conn, writev (conn, seg, n));
+}
 int conn_secure (void *conn) { return conn_field (conn, tls) != NULL; }
 void conn_close (void *conn) { conn_field (conn, close (conn)); }
 
@@ -124,7 +152,7 @@ int tcp_session (void *conn) {
 void tcp_setup (Connection *c) {
   c->tls = NULL; c->session = tcp_session;
   c->read = net_read; c->write = net_write;
-  c->close = net_close;
+  c->writev = net_writev; c->close = net_close;
 }
 
 const uint8_t *tls_session_id (void *conn) {
@@ -179,10 +207,23 @@ int tls_write (void *conn, const char *data, int length) {
   return ret;
 }
 
+#define TLS_RECORD 16384
+
+// coalesce the segments into a single TLS record
+int tls_writev (void *conn, const DataSegment *seg, int n) {
+  char buffer[TLS_RECORD]; int i, k = 0, m;
+  if (n == 1 || seg[0].length >= TLS_RECORD)
+    return tls_write (conn, seg[0].data, seg[0].length);
+  for (i = 0; i < n && k < TLS_RECORD; i++) {
+    m = min (seg[i].length, TLS_RECORD - k);
+    memcpy (buffer+k, seg[i].data, m); k += m;
+  } return tls_write (conn, buffer, k);
+}
+
 void tls_setup (Connection *c) {
   c->tls = ssl_new (c); c->session = tls_session;
   c->read = tls_read; c->write = tls_write;
-  c->close = tls_close;
+  c->writev = tls_writev; c->close = tls_close;
   c->tls_state = TLS_NEGOTIATE;
 }
 
@@ -192,10 +233,15 @@ void *conn_accept (void *conn, Acceptor *a, int secure) {
   else tcp_setup (conn); return conn;
 }
 
+void *conn_connect_any (void *conn, Address *servers, int n, int secure) {
+  Connection *c = conn; net_connect_any (conn, servers, n);
+  if (secure) {
+    tls_setup (conn); ssl_connect (c->tls); ssl_resume (c->tls, servers);
+  } else tcp_setup (c); return conn;
+}
+
 void *conn_connect (void *conn, Address *server, int secure) {
-  Connection *c = conn; net_connect (conn, server);
-  if (secure) { tls_setup (conn); ssl_connect (c->tls); }
-  else tcp_setup (c); return conn;
+  return conn_connect_any (conn, server, 1, secure);
 }
 
 #endif
@@ -0,0 +1,142 @@
+// Copyright (c) 2018 Electric Power Research Institute, Inc.
+// author: Mark Slicker <mark.slicker@gmail.com>
+
+/** @defgroup context Context
+
+    A Context is an instance of the IEEE 2030.5 stack, that is the event loop
+    (ports, timers and connections), the TLS context and sessions, service
+    discovery, and the device identity. The state of an instance is thread
+    local, so a Context belongs to the thread that created it and each thread
+    of a process can run an independent instance, with its own device
+    certificate and network interface. The functions that take a Context must
+    be called by the thread that owns it. A Context lasts for the life of its
+    thread.
+    @{
+*/
+
+#define SERVICE_FOUND (EVENT_NEW+1)
+
+typedef struct _SeContext SeContext;
+
+/** @brief Create a Context for the calling thread.
+    @param name is the name of the network interface used for service
+    discovery, or NULL for no service discovery
+    @param cert is the device certificate (see @ref tls_init), or NULL if TLS
+    is not used
+    @param verify is the verify function (see @ref tls_init)
+    @param data is user defined data
+    @returns a new Context, or NULL if the thread already has one
+*/
+SeContext *se_context_new (char *name, const char *cert, VerifyFunc verify,
+			   void *data);
+
+/** @brief Return the Context of the calling thread.
+    @returns a pointer to a Context, or NULL if the thread has none
+*/
+SeContext *se_context ();
+
+/** @brief Return the user defined data of a Context.
+    @param c is a pointer to a Context
+    @returns the data passed to @ref se_context_new
+*/
+void *se_context_data (SeContext *c);
+
+/** @brief Poll for an event on a Context.
+
+    Returns SERVICE_FOUND with a pointer to a Service as the event object when
+    service discovery finds a new service, otherwise the same as
+    @ref event_poll. Connections with a message body parsed by the parse pool
+    are returned as TCP_PORT events.
+    @param c is a pointer to a Context
+    @param any receives the event object pointer
+    @param timeout is the polling timeout in milliseconds, or -1 for no timeout
+    @returns the @ref EventType and the associated object in the any parameter
+*/
+int se_context_poll (SeContext *c, void **any, int timeout);
+
+/** @brief Poll for an event on the Context of the calling thread.
+
+    See @ref se_context_poll, the thread need not have created a Context
+    with @ref se_context_new (a single instance initialized directly).
+*/
+int se_poll (void **any, int timeout);
+
+/** @brief Set the number of events polled at a time by the calling thread.
+
+    Events are received in batches with @ref event_poll_n and returned one
+    at a time by @ref se_poll, the batch size also sets the number of events
+    retrieved from the system per call (see @ref event_batch). The default
+    is 64.
+    @param size is the maximum number of events per batch
+*/
+void se_poll_batch (int size);
+
+/** @} */
+
+#ifndef HEADER_ONLY
+
+#include <pthread.h>
+
+typedef struct _SeContext {
+  pthread_t thread;
+  void *data;
+} SeContext;
+
+THREAD_LOCAL SeContext *se_current = NULL;
+
+SeContext *se_context_new (char *name, const char *cert, VerifyFunc verify,
+			   void *data) {
+  SeContext *c;
+  if (se_current) return NULL;
+  c = type_alloc (SeContext);
+  c->thread = pthread_self (); c->data = data;
+  platform_init ();
+  if (cert) { tls_init (cert, verify); security_init (cert); }
+  if (name) discover_init (name);
+  return se_current = c;
+}
+
+SeContext *se_context () { return se_current; }
+
+void *se_context_data (SeContext *c) { return c->data; }
+
+THREAD_LOCAL EventItem *se_items = NULL;
+THREAD_LOCAL int se_batch = 64, se_item = 0, se_items_n = 0;
+
+void se_poll_batch (int size) {
+  if (size < 1 || se_item < se_items_n) return; // the batch is not consumed
+  se_batch = size; free (se_items); se_items = NULL; event_batch (size);
+}
+
+// the next event of the current batch, polling for another batch if empty
+int se_next_event (void **any, int timeout) {
+  if (se_item == se_items_n) {
+    if (!se_items) se_items = malloc (sizeof (EventItem) * se_batch);
+    se_item = 0;
+    if (!(se_items_n = event_poll_n (se_items, se_batch, timeout)))
+      return POLL_TIMEOUT;
+  } *any = se_items[se_item].any; return se_items[se_item++].type;
+}
+
+int se_poll (void **any, int timeout) {
+  int event; Service *s;
+ top:
+  if (s = service_next ()) {
+    *any = s; return SERVICE_FOUND;
+  }
+  switch (event = se_next_event (any, timeout)) {
+  case TCP_CONNECT: return TCP_PORT;
+  case UDP_PORT:
+    if (s = service_receive (*any)) goto top; break;
+  case PARSE_DONE: se_parsed (); goto top;
+  } return event;
+}
+
+int se_context_poll (SeContext *c, void **any, int timeout) {
+  if (c != se_current || !pthread_equal (c->thread, pthread_self ())) {
+    log_error ("se_context_poll: context used by another thread\n");
+    return EVENT_NONE;
+  } return se_poll (any, timeout);
+}
+
+#endif
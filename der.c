@@ -11,6 +11,7 @@
 #define DEVICE_METERING (EVENT_NEW+12)
 #define DEFAULT_START (EVENT_NEW+13)
 #define DEFAULT_END (EVENT_NEW+14)
+#define DER_UPDATE (EVENT_NEW+20)
 
 #include "settings.c"
 
@@ -27,13 +28,20 @@ typedef struct {
   uint8_t lfdi[20]; ///< is the LFDI of the EndDevice
   int metering_rate; ///< is the post rate for meter readings
   Stub *mup; ///< is a pointer to the MirrorUsagePoint for this EndDevice
+  Stub *edev; ///< is a pointer to the EndDevice instance (if retrieved)
   List *readings; ///< is a list of MirrorMeterReadings
+  struct _Meter *meter; ///< collects the samples of the readings
   List *derpl; ///< is a list of DER programs
   DefaultControl *defaults; ///< is a list of active default DER controls
+  DefaultControl *ended; ///< is a list of default DER controls just ended
   uint32_t active; ///< bitmask of active controls
   // SE_DERControlBase_t base; 
   Schedule schedule; ///< is the DER schedule for this device
   Settings settings; ///< is the DER device settings
+  List *changed; ///< is a list of DERControlLists changed since scheduling
+  uint8_t *primacy; ///< is the primacy of each DER program when scheduled
+  unsigned dirty : 1; ///< marks the device as waiting for a DER_UPDATE
+  unsigned registered : 1; ///< an EndDevice was POSTed for the device
 } DerDevice;
 
 /** @brief Get a DerDevice with the matching SFDI.
@@ -49,30 +57,72 @@ DerDevice *get_device (uint64_t sfdi);
 */
 void device_settings (uint64_t sfdi, char *path);
 
+/** @brief Load the device settings cache.
+
+    The cache holds the settings files loaded by @ref device_settings, EXI
+    encoded and keyed by the file name and the device SFDI along with the
+    modification time and size of the file. Once the cache is loaded a
+    settings file that is unchanged is decoded from the memory mapped cache
+    rather than parsed, use @ref settings_cache_save to update the cache
+    after the settings are loaded.
+    @param path is the name of the cache file
+    @returns the number of settings files in the cache
+*/
+int settings_cache_load (const char *path);
+
+/** @brief Save the device settings cache if any settings file was parsed.
+
+    The cache is written to a temporary file that then replaces the cache
+    file.
+    @returns the number of settings files saved, 0 if the cache is up to
+    date, -1 if the file could not be written
+*/
+int settings_cache_save ();
+
 /** @brief Load a device certificate and store in the DerDevice hash.
     @param path is the file name of the device certificate
 */
 void device_cert (const char *path);
 
 /** @brief Load a set of device certificates.
+
+    The certificates are read and hashed by up to @ref CERT_THREADS threads,
+    the devices are then inserted by the calling thread in a single batch.
     @param path is the name of the directory containing the device certificates.
 */
 void device_certs (char *path);
 
 /** @brief Create a DER schedule for an EndDevice.
+
+    The schedule is updated by a DER_UPDATE event, the updates of the devices
+    requested within a pass of the event loop are coalesced into a single
+    event (see @ref der_update).
     @param edev is a pointer to an EndDevice Stub
 */
 void schedule_der (Stub *edev);
 
+/** @brief Update the schedules of the devices marked by @ref schedule_der
+    (DER_UPDATE event).
+
+    A schedule is rebuilt only if the DERPrograms of the device or their
+    primacies have changed, or a deleted event may have superseded other
+    events (see Schedule.stale). Otherwise only the DERControls new to the
+    DERControlLists that changed for the device are scheduled.
+*/
+void der_update ();
+
 /** @} */
 
+#include <pthread.h>
+#include <unistd.h>
+
 void *device_key (void *data) {
   DerDevice *d = data;
   return &d->sfdi;
 }
 
 // find_device, insert_device, remove_device, device_init
-global_hash (device, int64, 64)
+global_flat_hash (device, int64, 64)
 
 DerDevice *get_device (uint64_t sfdi) {
   DerDevice *d = find_device (&sfdi);
@@ -87,7 +137,8 @@ DerDevice *get_device (uint64_t sfdi) {
 
 void device_settings (uint64_t sfdi, char *path) {
   DerDevice *d = get_device (sfdi);
-  process_dir (path, &d->settings, load_settings);
+  SettingsContext c = {sfdi, &d->settings};
+  process_dir (path, &c, load_settings);
 }
 
 void _device_cert (const char *path, void *ctx) {
@@ -101,8 +152,47 @@ void device_cert (const char *path) {
   _device_cert (path, NULL);
 }
 
+#ifndef CERT_THREADS
+#define CERT_THREADS 16
+#endif
+
+typedef struct {
+  char **path; uint8_t (*lfdi)[20]; uint64_t *sfdi;
+  int count, next;
+} CertBatch;
+
+void *cert_worker (void *arg) {
+  CertBatch *b = arg; int i;
+  while ((i = __atomic_fetch_add (&b->next, 1, __ATOMIC_RELAXED)) < b->count)
+    b->sfdi[i] = lfdi_gen (b->lfdi[i], b->path[i]);
+  return NULL;
+}
+
+void cert_path (const char *path, void *ctx) {
+  List **l = ctx; *l = list_insert (*l, strdup (path));
+}
+
 void device_certs (char *path) {
-  process_dir (path, NULL, _device_cert);
+  CertBatch b = {0}; List *l = NULL, *t;
+  pthread_t threads[CERT_THREADS]; int i, n;
+  process_dir (path, &l, cert_path);
+  if (!(b.count = list_length (l))) return;
+  b.path = malloc (b.count * sizeof (char *));
+  b.lfdi = malloc (b.count * 20);
+  b.sfdi = malloc (b.count * sizeof (uint64_t));
+  for (i = b.count, t = l; t; t = t->next) b.path[--i] = t->data;
+  n = min (min (sysconf (_SC_NPROCESSORS_ONLN), CERT_THREADS), b.count);
+  for (i = 1; i < n; i++)
+    if (pthread_create (&threads[i], NULL, cert_worker, &b)) break;
+  n = i; cert_worker (&b);
+  for (i = 1; i < n; i++) pthread_join (threads[i], NULL);
+  hash_reserve (device_hash, device_hash->items + b.count);
+  for (i = 0; i < b.count; i++) {
+    DerDevice *d = get_device (b.sfdi[i]);
+    memcpy (d->lfdi, b.lfdi[i], 20);
+    print_device_cert (b.path[i], b.lfdi[i], b.sfdi[i]); free (b.path[i]);
+  } free (b.path); free (b.lfdi); free (b.sfdi);
+  free_list (l);
 }
 
 #define copy_field(a, b, field) \
@@ -172,6 +262,9 @@ void update_defaults (Schedule *s) {
   EventBlock *eb; uint32_t mask = 0;
   List *l = d->derpl;
   DefaultControl *m = NULL, *n;
+  // the controls ended by the last update (their DEFAULT_END is delivered)
+  foreach (n, d->ended) remove_event (n);
+  free_list (d->ended);
   foreach (eb, s->active) mask |= eb->der;
   d->active = mask; mask = ~mask;
   while (l && mask) {
@@ -188,7 +281,7 @@ void update_defaults (Schedule *s) {
   }
   n = list_subtract (d->defaults, m);
   foreach (l, n) insert_event (l, DEFAULT_END, 0);
-  free_list (n); d->defaults = list_reverse (m);
+  d->ended = n; d->defaults = list_reverse (m);
 }
 
 void remove_programs (Schedule *s, List *derpl) {
@@ -204,40 +297,187 @@ void remove_programs (Schedule *s, List *derpl) {
   } free_list (derpl);
 }
 
-void schedule_der (Stub *edev) {
-  SE_EndDevice_t *e = resource_data (edev);
-  DerDevice *device = get_device (e->sFDI);
-  Schedule *schedule = &device->schedule;
-  Stub *fsa = NULL, *s, *t;
-  List *l, *m, *derpl = NULL;
-  printf ("schedule_der\n");
-  if (!(fsa = get_subordinate (edev, SE_FunctionSetAssignmentsList))) return;
-  // add the lFDI if not provided by the server
-  if (!se_exists (e, lFDI)) { se_set (e, lFDI);
-    memcpy (e->lFDI, device->lfdi, 20);
-  }
-  // collect all DERPrograms for the device (sorted by primacy)
-  foreach (l, fsa->reqs)
-    if (s = get_subordinate (l->data, SE_DERProgramList))
+/* Devices with the same FunctionSetAssignments share the evaluation of the
+   DERPrograms, a template holds the programs of a set of FSAs sorted by
+   primacy. The supersession of the DERControls is shared as well, it
+   depends only on the event intervals, primacies, creation times and DER
+   controls. The plan made when the first device is fully scheduled is
+   applied to the blocks of the other devices, which keep their own
+   randomized times and response state (see schedule_plan). */
+typedef struct _ProgramTemplate {
+  struct _ProgramTemplate *next;
+  List *fsa; // FunctionSetAssignments Stubs
+  List *derpl; // DERProgram Stubs sorted by primacy
+  List *lists; // DERProgramList and DERControlList Stubs
+  SchedulePlan *plan; // the insertion of the DERControls
+} ProgramTemplate;
+
+THREAD_LOCAL ProgramTemplate *program_templates = NULL;
+
+int same_stubs (List *a, List *b) {
+  while (a && b && a->data == b->data) a = a->next, b = b->next;
+  return !a && !b;
+}
+
+List *program_list (List *fsa, List **lists) {
+  List *l, *m, *derpl = NULL; Stub *s;
+  foreach (l, fsa)
+    if (s = get_subordinate (l->data, SE_DERProgramList)) {
+      *lists = list_insert (*lists, s);
       foreach (m, s->reqs)
 	derpl = insert_stub (derpl, m->data, s->base.info);
-  // handle program removal
-  remove_programs (schedule, list_subtract (device->derpl, derpl)); 
-  /* event block schedule might change as a result of program removal and
-     primacy change so clear the block lists */
-  schedule->scheduled = schedule->active = schedule->superseded = NULL;
-  schedule->device = edev;
+    }
+  foreach (l, derpl)
+    if (s = get_subordinate (l->data, SE_DERControlList))
+      *lists = list_insert (*lists, s);
+  return derpl;
+}
+
+// the template of a list of FSAs
+ProgramTemplate *program_template (List *fsa) {
+  ProgramTemplate *t;
+  foreach (t, program_templates)
+    if (same_stubs (t->fsa, fsa)) return t;
+  t = type_alloc (ProgramTemplate);
+  t->fsa = list_dup (fsa); t->derpl = program_list (fsa, &t->lists);
+  link_insert (program_templates, t);
+  return t;
+}
+
+int template_uses (ProgramTemplate *t, Stub *s) {
+  return find_by_data (t->fsa, s) || find_by_data (t->derpl, s)
+    || find_by_data (t->lists, s);
+}
+
+/* Discard the templates derived from a changed (or removed) resource. Only
+   the resources of the FSA subtrees (FunctionSetAssignments,
+   DERProgramLists, DERPrograms, DERControlLists and DERControls) affect a
+   template, a resource is matched with the templates directly or through
+   its dependents (e.g. a new DERControl through its DERControlList). */
+void der_changed (Stub *s) {
+  ProgramTemplate *t, *prev = NULL, *next; Stub *d; int i, used;
+  switch (resource_type (s)) {
+  case SE_FunctionSetAssignments: case SE_DERProgramList: case SE_DERProgram:
+  case SE_DERControlList: case SE_DERControl: break;
+  default: return;
+  }
+  for (t = program_templates; t; t = next) { next = t->next;
+    used = template_uses (t, s);
+    foreach_dep (d, i, &s->deps) used |= template_uses (t, d);
+    if (!used) { prev = t; continue; }
+    if (prev) prev->next = next; else program_templates = next;
+    free_list (t->fsa); free_list (t->derpl); free_list (t->lists);
+    if (t->plan) plan_free (t->plan);
+    free (t);
+  }
+}
+
+// insert the deferred blocks of a full schedule, using the template's plan
+void insert_planned (Schedule *s, ProgramTemplate *t) {
+  List *l, *blocks = list_reverse (s->deferred);
+  s->deferred = NULL; s->defer = 0;
+  if (!t->plan) t->plan = schedule_plan (blocks);
+  if (!schedule_apply (s, t->plan, blocks))
+    foreach (l, blocks) insert_block (s, l->data);
+  free_list (blocks);
+}
+
+/* Changes to the DER resources are tracked per device. The completion of a
+   changed DERControlList follows the dependencies up to the EndDevices that
+   use it, these devices are then rescheduled (as they are completed) in a
+   single DER_UPDATE event per pass of the event loop. */
+THREAD_LOCAL List *der_dirty = NULL; // DerDevices awaiting a DER_UPDATE
+
+void controls_changed_dep (Stub *s, Stub *t, int depth) { Stub *d; int i;
+  if (resource_type (s) == SE_EndDevice) {
+    SE_EndDevice_t *e = resource_data (s); DerDevice *device;
+    if (e && (device = find_device (&e->sFDI)))
+      device->changed = insert_unique (device->changed, t);
+  } else if (depth < 8)
+    foreach_dep (d, i, &s->deps) controls_changed_dep (d, t, depth+1);
+}
+
+// completion routine of a DERControlList
+void controls_changed (Stub *t) {
+  controls_changed_dep (t, t, 0);
+}
+
+// the DERPrograms and their primacies are unchanged since the last schedule
+int same_programs (DerDevice *d, List *derpl) { List *l; int i = 0;
+  if (!d->derpl || !same_stubs (d->derpl, derpl)) return 0;
+  foreach (l, derpl) { SE_DERProgram_t *derp = resource_data (l->data);
+    if (derp->primacy != d->primacy[i++]) return 0;
+  } return 1;
+}
+
+// schedule the DERControls of a program, only those new to the schedule
+void schedule_controls (DerDevice *device, Stub *s, Stub *t, int added) {
+  Schedule *schedule = &device->schedule; List *m;
+  SE_DERProgram_t *derp = resource_data (s);
+  foreach (m, t->reqs) { EventBlock *eb;
+    if (added && get_block (schedule, m->data)) continue;
+    eb = schedule_event (schedule, m->data, derp->primacy);
+    eb->program = s; eb->context = device;
+  } t->completion = controls_changed;
+}
+
+void schedule_device (DerDevice *device) {
+  Schedule *schedule = &device->schedule; Stub *edev = schedule->device;
+  Stub *fsa, *s, *t; List *l, *derpl; int i = 0, full;
+  ProgramTemplate *pt;
+  if (!(fsa = get_subordinate (edev, SE_FunctionSetAssignmentsList))) return;
+  // collect all DERPrograms for the device (sorted by primacy)
+  pt = program_template (fsa->reqs); derpl = list_dup (pt->derpl);
+  if (full = schedule->stale || !same_programs (device, derpl)) {
+    // handle program removal (list_subtract consumes device->derpl)
+    remove_programs (schedule, list_subtract (device->derpl, derpl));
+    device->derpl = NULL;
+    /* event block schedule might change as a result of program removal and
+       primacy change so clear the block lists */
+    schedule_clear (schedule);
+    free (device->primacy); device->primacy = malloc (list_length (derpl));
+    schedule->defer = 1;
+  }
   // insert DER Control events into the schedule
   foreach (l, derpl) { s = l->data;
     SE_DERProgram_t *derp = resource_data (s);
-    if (t = get_subordinate (s, SE_DERControlList))
-      foreach (m, t->reqs) { EventBlock *eb;
-	eb = schedule_event (schedule, m->data, derp->primacy);
-	eb->program = s; eb->context = device;
-      }
+    if ((t = get_subordinate (s, SE_DERControlList))
+	&& (full || find_by_data (device->changed, t)))
+      schedule_controls (device, s, t, !full);
+    device->primacy[i++] = derp->primacy;
   }
-  device->derpl = derpl;
+  if (full) insert_planned (schedule, pt);
+  free_list (device->derpl); device->derpl = derpl;
+  free_list (device->changed); device->changed = NULL;
   insert_event (schedule, SCHEDULE_UPDATE, 0);
   // update_schedule (schedule);
   insert_event (device, DEVICE_SCHEDULE, 0);
 }
+
+// the EndDevice of a device was removed (e.g. a 404), it may be registered
+void device_removed (Stub *edev) {
+  SE_EndDevice_t *e = resource_data (edev); DerDevice *d;
+  if (e && (d = find_device (&e->sFDI)) && d->edev == edev) {
+    d->edev = NULL; d->registered = 0;
+  }
+}
+
+void der_update () { List *l;
+  foreach (l, der_dirty) { DerDevice *device = l->data;
+    device->dirty = 0; schedule_device (device);
+  } free_list (der_dirty); der_dirty = NULL;
+}
+
+void schedule_der (Stub *edev) {
+  SE_EndDevice_t *e = resource_data (edev);
+  DerDevice *device = get_device (e->sFDI);
+  log_debug ("schedule_der\n");
+  // add the lFDI if not provided by the server
+  if (!se_exists (e, lFDI)) { se_set (e, lFDI);
+    memcpy (e->lFDI, device->lfdi, 20);
+  }
+  device->schedule.device = edev;
+  if (device->dirty) return;
+  if (!der_dirty) insert_event (&der_dirty, DER_UPDATE, 0);
+  der_dirty = list_insert (der_dirty, device); device->dirty = 1;
+}
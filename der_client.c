@@ -7,10 +7,13 @@
 #include "client.c"
 #include "list_util.c"
 #include "time.c"
-#include "event.c"
 #include "hash.c"
+#include "event.c"
 #include "resource.c"
+#include "share.c"
 #include "retrieve.c"
+#include "trace.c"
+#include "snapshot.c"
 #include "subscribe.c"
 #include "schedule.c"
 #include "der.c"
@@ -66,22 +69,32 @@ void print_event_schedule (DerDevice *d) {
 }
 
 int der_poll (void **any, int timeout) {
-  Schedule *s; int event;
+  Schedule *s; int event; int64_t t;
   while (event = next_event (any)) {
     switch (event) {
     case SCHEDULE_UPDATE: s = *any;
-      update_schedule (s); update_defaults (s); break;
-    case RESOURCE_POLL: poll_resource (*any);
+      t = stat_begin (); update_schedule (s);
+      stat_end (STAT_UPDATE_SCHEDULE, t); update_defaults (s); break;
+    case DER_UPDATE: der_update (); break;
+    case RESOURCE_POLL: if (!poll_due (*any)) break;
+      poll_resource (*any);
     case RESOURCE_UPDATE: update_resource (*any); break;
     case RESOURCE_REMOVE:
       if (se_event (resource_type (*any)))
 	delete_blocks (*any);
     case RETRIEVE_FAIL:
+      if (resource_type (*any) == SE_EndDevice) device_removed (*any);
       remove_stub (*any); break;
+    case RESOURCE_RESTORE: snapshot_restore (*any); break;
+    case RESPONSE_FLUSH: response_flush (*any); break;
+    case SUBSCRIBE_FLUSH: subscribe_flush (*any); break;
+    case MEMORY_CHECK: resume_updates (); break;
     default: return event;
     }
   }
-  return client_poll (any, timeout);
+  if ((event = client_poll (any, timeout)) == EVENT_TIMER)
+    event_timer_expired ();
+  return event;
 }
 
 void der_init () {
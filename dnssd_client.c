@@ -5,6 +5,15 @@
 
     Provides an implementation of DNS-Based Service Discovery
     (<a href="https://tools.ietf.org/html/rfc6763">RFC 6763</a>).
+
+    The PTR, SRV, TXT, and address records of the discovered services are
+    cached until they expire (the record TTL), expired records are requested
+    again with a followup query. The cache can be saved and reloaded so a
+    restarted client can connect to the services it knows without waiting
+    for discovery, and its queries include the known answers (RFC 6762
+    section 7.1) so responders only answer with the services not yet known.
+    A host with both an IPv6 and an IPv4 address keeps both, a connection
+    to the service races the two (see @ref se_connect_dual).
     @{
 */
 
@@ -18,28 +27,63 @@ typedef struct _Service Service;
 char *dnssd_query (char *packet);
 
 /** @brief Add a question to a DNS-SD query.
-    @param dest is the destination of the question within a DNS-SD packet
+
+    For a PTR question the cached services that answer the question are
+    added to the answer section as known answers (when more than half
+    their TTL remains), the answers are kept after the questions as more
+    questions are added.
+    @param dest is the end of the DNS-SD packet returned by the previous call
+    to dnssd_question or @ref dnssd_query
     @param name is a pointer to a name in the DNS counted label format
     @param type is the type of resource record that pertains to the question
     @param unicast is the value of the QU bit
-    @returns the destination of the next question within the query
+    @returns the end of the packet
 */
 char *dnssd_question (char *dest, char *name, int type, int unicast);
 
 /** @brief Receive DNS-SD packets from a UdpPort.
     
-    Receive and process packets from a UdpPort and return the discovered
-    services.
+    Receive and process the packets available from a UdpPort, then send a
+    single followup query for any missing or expired records.
     @param port is a pointer to a UdpPort
-    @param Service is a pointer the first discovered Service
+    @returns the first newly discovered Service, NULL if there is none
  */
 Service *dnssd_receive (UdpPort *port);
 
-/** @brief Return the next Service given a pointer to a discovered Service. 
+/** @brief Return the next newly discovered Service.
+
+    A Service is queued the first time its records are complete, and again
+    if it is discovered after its PTR record has expired.
+    @returns the next discovered Service, NULL if there is none
+*/
+Service *service_next ();
+
+/** @brief Save the cached services to a file.
+
+    The file is written to a temporary file that then replaces the file.
+    @param path is the name of the file
+    @returns the number of services saved, -1 if the file could not be
+    written
+*/
+int dnssd_save (const char *path);
+
+/** @brief Load the cached services from a file.
+
+    The records that have not expired are restored, the services with
+    complete records are queued as newly discovered services.
+    @param path is the name of the file
+    @returns the number of services restored
+*/
+int dnssd_load (const char *path);
+
+/** @brief Copy a discovered Service.
+
+    The copy is independent of the discovery state so it can be handed to
+    another thread.
     @param s is a pointer to a Service
-    @returns the next discovered Service
+    @returns a new copy of the Service
 */
-Service *service_next (Service *s);
+Service *service_copy (Service *s);
 
 /** @brief Print description of a Service to stdout.
     @param s is a pointer to a Service
@@ -54,21 +98,28 @@ void print_dns_name (char *name);
 
 #include <stdio.h>
 #include <string.h>
+#include <time.h>
+
+#define DNSSD_MAX 1472 // maximum size of a query (Ethernet MTU)
 
 typedef struct _Host {
   struct _Host *next;
   char *name;
-  Address addr;
+  Address addr, ipv4; // ipv4 is the other address of a dual stack host
+  unsigned found : 1;
+  unsigned dual : 1; // has both an IPv6 and an IPv4 address
+  int64_t expire; // expiry of the address record
 } Host;
 
 typedef struct _Service {
   struct _Service *next;
   char *name, *query;
-  int port, ttl;
+  int port, ttl, ptr_ttl;
   unsigned txt_found : 1;
   unsigned srv_found : 1;
   unsigned complete : 1;
-  unsigned seen : 1;
+  unsigned queued : 1;
+  int64_t ptr_expire, srv_expire, txt_expire; // record expiry times
   Host *host; char *txt;
 } Service;
 
@@ -77,9 +128,10 @@ typedef struct _Question {
   char *name;
 } Question;
 
-Host *dns_host = NULL;
-Service *dns_service = NULL;
-Question *dns_question = NULL;
+THREAD_LOCAL Host *dns_host = NULL;
+THREAD_LOCAL Service *dns_service = NULL;
+THREAD_LOCAL Question *dns_question = NULL;
+THREAD_LOCAL Queue new_services = {0}; // completed services not yet returned
 
 #define find_host(name) find_by_name (dns_host, name)
 #define get_host(name) get_by_name (&dns_host, name, sizeof (Host))
@@ -95,6 +147,7 @@ Question *dns_question = NULL;
 #define rr_rdlength(data) UNPACK16 (data+8)
 #define rr_rdata(data) data+10
 #define rr_next(data, length) (data+10+length)
+#define rr_expire(data) (time (NULL) + rr_ttl (data))
 
 // parse and validate DNS resource record
 // return pointer to rr fields, name, and length of rdata
@@ -124,7 +177,7 @@ char *skip_questions (char *data, int count) {
   } return data;
 }
 
-char *ar_section;
+THREAD_LOCAL char *ar_section;
 
 // returns pointer to record if found, NULL otherwise
 char *dns_find (char *name, int *length, int type) {
@@ -168,9 +221,9 @@ char *txt_value (char *buffer, char *data, char *key) {
 
 // process TXT resource record
 char *dns_txt (Service *s, char *data, int length) {
-  data += 10;
+  int64_t expire = rr_expire (data); data += 10;
   if (txt_valid (data, length)) {
-    s->txt = malloc (length+1);
+    free (s->txt); s->txt = malloc (length+1); s->txt_expire = expire;
     memcpy (s->txt, data, length);
     s->txt[length] = '\0'; 
     s->txt_found = 1; return data;
@@ -211,6 +264,7 @@ void print_service (Service *s) {
   printf ("  name: "); print_dns_name (s->name);
   printf ("\n  target: "); print_dns_name (h->name);
   printf ("\n  host: "); print_host (&h->addr);
+  if (h->dual) { printf (", "); print_host (&h->ipv4); }
   printf ("\n  port: %d\n", s->port);
   printf ("  time to live: %d\n", s->ttl);
   if (s->txt) {
@@ -220,38 +274,44 @@ void print_service (Service *s) {
 
 // process A resource record (IPv4)
 void *host_a (Host *h, char *data, int length) {
-  ok (length == 4); data += 10;
-  ipv4_address (&h->addr, UNPACK32 (data), 0);
-  return data;
+  ok (length == 4); h->expire = rr_expire (data); data += 10;
+  if (h->found && h->addr.family == ADDR_IPv6) {
+    ipv4_address (&h->ipv4, UNPACK32 (data), 0); h->dual = 1;
+  } else ipv4_address (&h->addr, UNPACK32 (data), 0);
+  h->found = 1; return data;
 }
 
 // process AAAA resource record (IPv6)
 void *host_aaaa (Host *h, char *data, int length) {
-  ok (length == 16); data += 10;
-  ipv6_address (&h->addr, data, 0);
+  ok (length == 16); h->expire = rr_expire (data); data += 10;
+  if (h->found && h->addr.family == ADDR_IPv4) { // the IPv6 address first
+    address_copy (&h->ipv4, &h->addr); h->dual = 1;
+  } ipv6_address (&h->addr, data, 0); h->found = 1;
   return data;
 }
 
 // process SRV resource record (RFC 2782)
 void *dns_srv (Service *s, char *data) {
   char target[256]; int length;
-  s->ttl = rr_ttl (data);
+  s->ttl = rr_ttl (data); s->srv_expire = rr_expire (data);
   s->port = UNPACK16 (data+10+4);
   ok (dns_name (target, data+10+6));
   if (!s->host) s->host = get_host (target);
+  if (data = dns_find (target, &length, A_RECORD))
+    host_a (s->host, data, length);
   if (data = dns_find (target, &length, AAAA_RECORD))
     host_aaaa (s->host, data, length);
-  else if (data = dns_find (target, &length, A_RECORD))
-    host_a (s->host, data, length);
   s->srv_found = 1; return data;
 }
 
 // process PTR resource record
 void dns_ptr (char *name, char *data) {
   Question *q; Service *s; char instance[256]; int length;
+  int ttl = rr_ttl (data); int64_t expire = rr_expire (data);
   if ((q = find_question (name))
       && (data = dns_name (instance, data+10))) {
     s = get_service (instance); s->query = q->name;
+    s->ptr_ttl = ttl; s->ptr_expire = expire;
     if (data = dns_find (instance, &length, SRV_RECORD))
       dns_srv (s, data);
     if (data = dns_find (instance, &length, TXT_RECORD))
@@ -276,10 +336,34 @@ void process_answers (char *data, int count) {
 	if (h) host_aaaa (h, data, length); break;
       }
       data = rr_next (data, length);
-    } return;
+    } else return;
   }
 }
 
+// find the bytes s (of length n) in data
+char *find_bytes (char *data, int length, const char *s, int n) {
+  char *end = data + length - n + 1;
+  while (data < end && (data = memchr (data, *s, end - data))) {
+    if (memcmp (data, s, n) == 0) return data;
+    data++;
+  } return NULL;
+}
+
+// early filter of the multicast traffic, a packet can answer one of our
+// queries only if it is a response with answers and either contains the
+// "_smartenergy._tcp" labels or the first label of a host we have found (the
+// first instance of a name in a packet is not compressed), other packets
+// are dropped without being parsed
+int dnssd_relevant (char *data, int length) {
+  static const char label[] = "\x0c_smartenergy\x04_tcp"; Host *h;
+  if (length < 12 || (UNPACK16 (data+2) & 0xf80f) != 0x8000
+      || !UNPACK16 (data+6)) return 0;
+  if (find_bytes (data+12, length-12, label, sizeof (label)-1)) return 1;
+  foreach (h, dns_host)
+    if (find_bytes (data+12, length-12, h->name, *h->name+1)) return 1;
+  return 0;
+}
+
 // process a DNS-SD packet
 void dnssd_packet (char *data, int length) { DnsHeader header;
   dns_start = data; dns_end = data + length; // set the boundry
@@ -292,18 +376,44 @@ void dnssd_packet (char *data, int length) { DnsHeader header;
   }
 }
 
+// add the cached services that answer a PTR question as known answers
+// (RFC 6762 section 7.1), the answers are compressed against the names of
+// the questions only so they can be moved as questions are added
+char *known_answers (char *dest, char *question, char *name,
+		     char *start, char **names, int *count) {
+  Service *s; int64_t now = time (NULL);
+  foreach (s, dns_service) { char *copy[32], *rdata; int ttl;
+    if (!s->query || !streq (s->query, name)
+	|| (ttl = s->ptr_expire - now) <= s->ptr_ttl/2) continue;
+    if (dest - start + 12 + strlen (s->name) + 1 > DNSSD_MAX) break;
+    memcpy (copy, names, sizeof (copy));
+    PACK16 (dest, 0xc000 | (question - start));
+    PACK16 (dest+2, PTR_RECORD); PACK16 (dest+4, INTERNET_CLASS);
+    PACK32 (dest+6, ttl);
+    rdata = encode_name (dest+12, s->name, start, copy, 32);
+    PACK16 (dest+10, rdata - (dest+12));
+    dest = rdata; (*count)++;
+  } return dest;
+}
+
 // add a question to a DNS query packet
 char *dnssd_question (char *dest, char *name, int type, int unicast) {
-  static char *start, *names[14]; static int count;
-  if (name) { count++; get_question (name);
-    dest = encode_name (dest, name, start, names);
-    PACK16 (dest, type);
-    PACK16 (dest+2, (unicast << 15) | INTERNET_CLASS);
+  static char *start, *end, *names[32]; static int count, answers;
+  if (name) { char known[DNSSD_MAX], *q = end; int n = dest - end;
+    memcpy (known, end, n); // move the answers after the new question
+    count++; get_question (name);
+    end = encode_name (end, name, start, names, 32);
+    PACK16 (end, type);
+    PACK16 (end+2, (unicast << 15) | INTERNET_CLASS);
+    end += 4; dest = (char *)memcpy (end, known, n) + n;
+    if (type == PTR_RECORD)
+      dest = known_answers (dest, q, name, start, names, &answers);
     PACK16 (start+4, count); // update number of questions
-    return dest+4;
+    PACK16 (start+6, answers); // and answers
+    return dest;
   }
-  memset (names, 0, sizeof (char *) * 14);
-  start = dest; count = 0; return NULL;
+  memset (names, 0, sizeof (names));
+  start = dest; end = dest+12; count = answers = 0; return NULL;
 }
 
 // initialize a DNS query
@@ -313,38 +423,142 @@ char *dnssd_query (char *packet) {
   return packet+12;
 }
 
-// followup query to request any missing records
+// clear the found flags of the expired records, queue a newly completed
+// service, returns 1 if the service is complete
+int service_update (Service *s, int64_t now) {
+  if (s->srv_expire <= now) s->srv_found = 0;
+  if (s->txt_expire <= now) s->txt_found = 0;
+  if (s->host && s->host->expire <= now) s->host->found = 0;
+  s->complete = s->srv_found && s->txt_found && s->host && s->host->found;
+  if (s->complete && !s->queued) {
+    queue_add (&new_services, list_insert (NULL, s)); s->queued = 1;
+  } return s->complete;
+}
+
+#define FOLLOWUP_MAX 16 // maximum number of followup packets
+
+// followup query to request any missing or expired records, the questions
+// are split over as many packets as needed and sent together
 void dnssd_followup (UdpPort *p) {
-  char packet[1500]; int followup = 0;
-  Service *s = dns_service;
-  char *data = dnssd_query (packet);
-  while (s) { int complete = 1;
-    if (!s->txt_found || !s->srv_found) {
-      data = dnssd_question (data, s->name, ANY_RECORD, 0); complete = 0;
+  char packets[FOLLOWUP_MAX][1500], *packet[FOLLOWUP_MAX], *data = NULL;
+  int length[FOLLOWUP_MAX], n = 0; Service *s; int64_t now = time (NULL);
+  foreach (s, dns_service) {
+    if (s->ptr_expire <= now) { // no longer advertised
+      s->complete = s->queued = 0; continue;
     }
-    if (!s->host->addr.length) {
-      data = dnssd_question (data, s->host->name, ANY_RECORD, 0); complete = 0;
+    if (service_update (s, now)) continue;
+    // room for both questions (names are at most 256 bytes)
+    if (!data || data - packet[n-1] + 2*(256+4) > DNSSD_MAX) {
+      if (n == FOLLOWUP_MAX) break;
+      packet[n] = packets[n]; data = dnssd_query (packet[n++]);
     }
-    followup |= !complete; s->complete = complete; s = s->next;
+    if (!s->txt_found || !s->srv_found)
+      data = dnssd_question (data, s->name, ANY_RECORD, 0);
+    if (s->host && !s->host->found)
+      data = dnssd_question (data, s->host->name, ANY_RECORD, 0);
+    length[n-1] = data - packet[n-1];
   }
-  if (followup) net_send (p, packet, data - packet, &multicast); 
+  if (n) net_send_batch (p, packet, length, n, &multicast);
 }
 
-// receive and process DNS-SD packets, return list of services
+// receive and process DNS-SD packets, return the first new service
 Service *dnssd_receive (UdpPort *port) {
-  char *data; int length;
+  char *data; int length; List *l;
   while (data = net_receive (port, &length))
-    dnssd_packet (data, length);
-  dnssd_followup (port); return dns_service;
+    if (dnssd_relevant (data, length)) dnssd_packet (data, length);
+  dnssd_followup (port);
+  return (l = queue_peek (&new_services))? l->data : NULL;
 }
 
-// return next completed service not yet seen
-Service *service_next (Service *s) {
-  while (s) { // process discovered services
-    if (s->complete && !s->seen) {
-      s->seen = 1; return s;
-    } s = s->next;
-  } return NULL;
+Service *service_copy (Service *s) {
+  Service *c = type_alloc (Service); Host *h = type_alloc (Host);
+  memcpy (c, s, sizeof (Service)); memcpy (h, s->host, sizeof (Host));
+  c->next = NULL; c->name = strdup (s->name); c->host = h;
+  h->next = NULL; h->name = strdup (s->host->name);
+  if (s->txt) c->txt = strdup (s->txt);
+  return c;
+}
+
+Service *service_next () {
+  List *l = queue_remove (&new_services); Service *s;
+  if (!l) return NULL;
+  s = l->data; free (l); return s;
+}
+
+#define DNSSD_MAGIC 0x32534e44 // "DNS2"
+
+/* The cache file is the magic number followed by a record for each service,
+   a record is the fixed part followed by the strings (the names of the
+   service, the query, the target host, and the TXT record). */
+typedef struct {
+  int32_t port, ttl, ptr_ttl;
+  uint16_t name, query, target, txt; // string lengths including the '\0'
+  int64_t ptr_expire, srv_expire, txt_expire, host_expire;
+  Address addr, ipv4; // ipv4 is zero unless the host is dual stack
+} ServiceRecord;
+
+int dnssd_save (const char *path) {
+  char temp[256]; Service *s; FILE *f; uint32_t magic = DNSSD_MAGIC;
+  int count = 0;
+  if (snprintf (temp, 256, "%s.tmp", path) >= 256
+      || !(f = fopen (temp, "wb"))) return -1;
+  fwrite (&magic, sizeof (magic), 1, f);
+  foreach (s, dns_service) { ServiceRecord r = {0}; Host *h = s->host;
+    if (!s->query || !h) continue;
+    r.port = s->port; r.ttl = s->ttl; r.ptr_ttl = s->ptr_ttl;
+    r.name = strlen (s->name) + 1; r.query = strlen (s->query) + 1;
+    r.target = strlen (h->name) + 1; r.txt = s->txt? strlen (s->txt) + 1 : 0;
+    r.ptr_expire = s->ptr_expire; r.srv_expire = s->srv_expire;
+    r.txt_expire = s->txt_expire; r.host_expire = h->expire;
+    r.addr = h->addr; if (h->dual) r.ipv4 = h->ipv4;
+    fwrite (&r, sizeof (r), 1, f);
+    fwrite (s->name, 1, r.name, f); fwrite (s->query, 1, r.query, f);
+    fwrite (h->name, 1, r.target, f);
+    if (s->txt) fwrite (s->txt, 1, r.txt, f);
+    count++;
+  }
+  if (fclose (f) || rename (temp, path)) { remove (temp); return -1; }
+  return count;
+}
+
+// read a string of length n (including the '\0'), returns 1 if valid
+int read_string (char *buffer, int size, int n, FILE *f) {
+  return n > 0 && n <= size && fread (buffer, 1, n, f) == n
+    && buffer[n-1] == '\0';
+}
+
+int dnssd_load (const char *path) {
+  FILE *f = fopen (path, "rb"); ServiceRecord r; uint32_t magic;
+  char name[256], query[256], target[256], txt[DNSSD_MAX];
+  int count = 0; int64_t now = time (NULL);
+  if (!f) return 0;
+  if (fread (&magic, sizeof (magic), 1, f) == 1 && magic == DNSSD_MAGIC)
+    while (fread (&r, sizeof (r), 1, f) == 1) {
+      Service *s; Host *h; Question *q;
+      if (!read_string (name, 256, r.name, f)
+	  || !read_string (query, 256, r.query, f)
+	  || !read_string (target, 256, r.target, f)
+	  || (r.txt && !read_string (txt, DNSSD_MAX, r.txt, f))) break;
+      if (r.ptr_expire <= now) continue;
+      s = get_service (name);
+      if (s->ptr_expire >= r.ptr_expire) continue; // already known
+      q = get_question (query); s->query = q->name;
+      s->port = r.port; s->ttl = r.ttl; s->ptr_ttl = r.ptr_ttl;
+      s->ptr_expire = r.ptr_expire; s->srv_expire = r.srv_expire;
+      s->srv_found = r.srv_expire > now;
+      if (r.txt) {
+	free (s->txt); s->txt = strdup (txt);
+	s->txt_expire = r.txt_expire; s->txt_found = r.txt_expire > now;
+      }
+      if (!s->host) s->host = get_host (target); h = s->host;
+      if (h->expire < r.host_expire) {
+	h->addr = r.addr; h->expire = r.host_expire;
+	h->ipv4 = r.ipv4; h->dual = r.ipv4.family != 0;
+	h->found = r.host_expire > now;
+      }
+      service_update (s, now); count++;
+    }
+  fclose (f); return count;
 }
 
 #endif
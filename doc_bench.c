@@ -0,0 +1,138 @@
+// Copyright (c) 2018 Electric Power Research Institute, Inc.
+// author: Mark Slicker <mark.slicker@gmail.com>
+
+/* Parse and output throughput over a corpus of IEEE 2030.5 documents.
+
+   usage: doc_bench [iterations] [directory ...]
+
+   Each file in the directories (default "settings") is an XML or EXI
+   document, every document is converted to both media types then parsed
+   and output the given number of times (default 1000) with the parsers and
+   output drivers used for received and sent messages (see se_parse_init and
+   se_output_init). The objects are allocated from an Arena reset after each
+   parse as done by an SeConnection. Reported are MB/s, documents/s, and the
+   peak resident set size. The core is included (rather than linked) so
+   that the parser and output state can be allocated here. */
+
+#include <stdio.h>
+#include <inttypes.h>
+#include <sys/resource.h>
+#include "se_core.c"
+
+typedef struct _Doc {
+  struct _Doc *next;
+  char *name; int type;
+  char *xml, *exi; int xml_length, exi_length;
+} Doc;
+
+Doc *corpus = NULL;
+int max_length = 0;
+
+char *xml_encode (void *obj, int type, int *length) {
+  Output o; int size = 1024, n;
+  char *buffer = malloc (size);
+  output_init (&o, &se_schema, buffer, size);
+  n = output_doc (&o, obj, type);
+  while (!output_complete (&o)) {
+    buffer = realloc (buffer, size <<= 1);
+    output_buffer (&o, buffer+n, size-n);
+    n += output_doc (&o, obj, type);
+  } buffer = realloc (buffer, n+1); buffer[n] = '\0';
+  *length = n; return buffer;
+}
+
+// EXI documents start with the "$EXI" cookie or the distinguishing bits 10
+int exi_document (unsigned char *data, int length) {
+  return (length >= 4 && memcmp (data, "$EXI", 4) == 0)
+    || (length && (data[0] & 0xc0) == 0x80);
+}
+
+void load_doc (const char *name, void *ctx) {
+  int length, type; char *data = file_read (name, &length); void *obj;
+  Parser p = {0};
+  if (!data) return;
+  if (exi_document ((unsigned char *)data, length))
+    obj = se_exi_decode (data, length, &type);
+  else {
+    parse_init (&p, &se_schema, utf8_start (data));
+    obj = parse_doc (&p, &type);
+    if (p.xml) free (p.xml);
+  }
+  if (obj) { Doc *d = type_alloc (Doc);
+    d->name = strdup (name); d->type = type;
+    d->xml = xml_encode (obj, type, &d->xml_length);
+    d->exi = se_exi_encode (obj, type, &d->exi_length);
+    max_length = max (max_length, max (d->xml_length, d->exi_length));
+    free_se_object (obj, type); d->next = corpus; corpus = d;
+  } else printf ("doc_bench: %s is not a valid document\n", name);
+  free (data);
+}
+
+long peak_rss () { struct rusage r;
+  getrusage (RUSAGE_SELF, &r); return r.ru_maxrss; // kilobytes
+}
+
+void report (const char *name, int64_t ns, int64_t bytes, int64_t docs) {
+  double s = ns / 1e9;
+  printf ("%-12s %10.2f MB/s %12.0f docs/s %8ld KB peak RSS\n", name,
+	  bytes / s / 1e6, docs / s, peak_rss ());
+}
+
+void bench_parse (int iterations, int xml) {
+  Parser *p = parser_new (); Arena *a = arena_new (4096);
+  char *buffer = malloc (max_length+1); Doc *d; int i, type;
+  int64_t bytes = 0, docs = 0, ns = 0;
+  for (i = 0; i < iterations; i++)
+    foreach (d, corpus) {
+      int length = xml? d->xml_length : d->exi_length; int64_t t;
+      // the XML parser tokenizes in place, copy as a received message
+      memcpy (buffer, xml? d->xml : d->exi, length); buffer[length] = '\0';
+      t = stat_now ();
+      if (xml) parse_init (p, &se_schema, buffer);
+      else exi_parse_init (p, &se_schema, buffer, length);
+      parser_arena (p, a);
+      if (!parse_doc (p, &type) || type != d->type) {
+	printf ("doc_bench: failed to parse %s\n", d->name); exit (1);
+      } ns += stat_now () - t;
+      arena_reset (a); bytes += length; docs++;
+    }
+  report (xml? "parse xml" : "parse exi", ns, bytes, docs);
+  free (buffer); arena_free (a); parser_free (p);
+}
+
+void bench_output (int iterations, int xml) {
+  char buffer[4096]; Doc *d; int i, type;
+  int64_t bytes = 0, docs = 0, ns = 0;
+  foreach (d, corpus) { Output o; int64_t t;
+    void *obj = se_exi_decode (d->exi, d->exi_length, &type);
+    t = stat_now ();
+    for (i = 0; i < iterations; i++) {
+      se_output_init (&o, buffer, 4096, xml);
+      do { bytes += output_doc (&o, obj, type);
+	if (!output_complete (&o)) output_buffer (&o, buffer, 4096);
+      } while (!output_complete (&o));
+      docs++;
+    } ns += stat_now () - t; free_se_object (obj, type);
+  }
+  report (xml? "output xml" : "output exi", ns, bytes, docs);
+}
+
+int main (int argc, char **argv) {
+  int i, iterations = 1000, dirs = 0; Doc *d;
+  int64_t xml = 0, exi = 0;
+  for (i = 1; i < argc; i++)
+    if (!number (&iterations, argv[i])) {
+      process_dir (argv[i], NULL, load_doc); dirs++;
+    }
+  if (!dirs) process_dir ("settings", NULL, load_doc);
+  if (!corpus || iterations <= 0) {
+    printf ("usage: doc_bench [iterations] [directory ...]\n"); exit (0);
+  }
+  i = 0;
+  foreach (d, corpus) { xml += d->xml_length; exi += d->exi_length; i++; }
+  printf ("%d documents, %" PRId64 " bytes XML, %" PRId64 " bytes EXI, "
+	  "%d iterations\n", i, xml, exi, iterations);
+  bench_parse (iterations, 1); bench_parse (iterations, 0);
+  bench_output (iterations, 1); bench_output (iterations, 0);
+  return 0;
+}
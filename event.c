@@ -16,14 +16,30 @@
     @param data is a pointer to the event data
     @param type is the type of the event
     @param time is the time at which the event becomes active
+    @returns a handle that can be used with @ref cancel_event
 */
-void insert_event (void *data, int type, int64_t time);
+void *insert_event (void *data, int type, int64_t time);
+
+/** @brief Insert an event into the queue with a deadline in milliseconds.
+    @param data is a pointer to the event data
+    @param type is the type of the event
+    @param ms is the time (see @ref se_time_ms) at which the event becomes
+    active, 0 for an immediate event
+    @returns a handle that can be used with @ref cancel_event
+*/
+void *insert_event_ms (void *data, int type, int64_t ms);
 
 /** @brief Remove all events from the queue that match the event data.
     @brief data is a pointer to the event data
 */
 void remove_event (void *data);
 
+/** @brief Remove a single event from the queue.
+    @param handle is the event handle returned by @ref insert_event, the
+    event must still be in the queue
+*/
+void cancel_event (void *handle);
+
 /** @brief Returns (and removes) the next active event from the queue if any.
     @param any is a pointer to value that receives the event data
     @returns the type of event or EVENT_NONE if there are no active events in
@@ -34,74 +50,151 @@ int next_event (void **any);
 /** @brief Create an event queue timer to wake up @ref event_poll. */
 void event_init ();
 
+/** @brief Arm the event queue timer again after it expired (EVENT_TIMER).
+
+    The timer runs on the monotonic clock while the queue is ordered by
+    system time, so it can expire before the earliest event is due (such as
+    after the system clock is stepped back). The next call to
+    @ref next_event arms it again for the earliest deadline.
+*/
+void event_timer_expired ();
+
 /** @} */
 
+/* Events are kept in a binary min-heap ordered by time then by insertion
+   sequence (immediate events have time 0), each event stores its heap index
+   so that it can be removed in O(log n). Events with the same data are
+   chained from a hash entry keyed by the data pointer, this makes
+   remove_event independent of the number of queued events. Event times
+   are kept in milliseconds.
+
+   The queue timer is armed only when the earliest deadline changes, the
+   deadline is kept in system time so that a change to the time offset
+   (see @ref set_time) also re-arms the timer. */
+
 typedef struct _Event {
-  struct _Event *next;
-  void *data; int type;
-  int64_t time;
+  struct _Event *next; // next event with the same data
+  void *data; int type, index;
+  int64_t time; uint64_t seq, key;
 } Event;
 
-Event *cur_event = NULL;
-Queue im_event = {0};
+// event_alloc, event_free
+global_pool (event, Event)
+
+THREAD_LOCAL Event **ev_heap = NULL;
+THREAD_LOCAL int ev_count = 0, ev_size = 0;
 
-int event_compare (void *a, void *b) {
-  Event *x = a, *y = b; return x->time - y->time;
+void *pending_key (void *data) {
+  Event *e = data; return &e->key;
 }
 
-void print_events () {
-  Event *e = cur_event;
-  printf ("print_events %d: ", list_length (e));
-  while (e) { printf ("%p %d %d, ", e->data, e->type, e->time); e = e->next; }
-  printf ("\n");
+// find_pending, insert_pending, delete_pending, pending_init
+global_hash (pending, int64, 64)
+
+#define event_before(a, b) ((a)->time < (b)->time \
+			    || ((a)->time == (b)->time && (a)->seq < (b)->seq))
+
+void print_events () { int i;
+  printf ("print_events %d: ", ev_count);
+  for (i = 0; i < ev_count; i++) { Event *e = ev_heap[i];
+    printf ("%p %d %" PRId64 ", ", e->data, e->type, e->time);
+  } printf ("\n");
 }
 
-void insert_event (void *data, int type, int64_t time) {
-  Event *e = type_alloc (Event);
+#define heap_set(i, e) (ev_heap[i] = e)->index = i
+
+void sift_up (int i) { Event *e = ev_heap[i];
+  while (i) { int p = (i - 1) >> 1;
+    if (!event_before (e, ev_heap[p])) break;
+    heap_set (i, ev_heap[p]); i = p;
+  } heap_set (i, e);
+}
+
+void sift_down (int i) { Event *e = ev_heap[i]; int c;
+  while ((c = 2*i + 1) < ev_count) {
+    if (c+1 < ev_count && event_before (ev_heap[c+1], ev_heap[c])) c++;
+    if (!event_before (ev_heap[c], e)) break;
+    heap_set (i, ev_heap[c]); i = c;
+  } heap_set (i, e);
+}
+
+void heap_remove (Event *e) {
+  Event *last = ev_heap[--ev_count];
+  if (last != e) {
+    heap_set (e->index, last);
+    sift_up (last->index); sift_down (last->index);
+  }
+}
+
+// remove an event from the chain of events with the same data
+void unlink_event (Event *e) {
+  Event *x = find_pending (&e->key), *prev = NULL;
+  while (x != e) { prev = x; x = x->next; }
+  if (prev) prev->next = e->next;
+  else if (e->next) insert_pending (e->next); // replace the chain head
+  else delete_pending (&e->key);
+}
+
+void *insert_event_ms (void *data, int type, int64_t time) {
+  static THREAD_LOCAL uint64_t seq = 0; Event *e = event_alloc (), *head;
   e->data = data; e->type = type; e->time = time;
-  if (time == 0) queue_add (&im_event, e);
-  else cur_event = insert_sorted (cur_event, e, event_compare);
+  e->seq = seq++; e->key = (uintptr_t)data;
+  if (head = find_pending (&e->key)) {
+    e->next = head->next; head->next = e;
+  } else insert_pending (e);
+  if (ev_count == ev_size) {
+    ev_size = ev_size? ev_size << 1 : 64;
+    ev_heap = realloc (ev_heap, sizeof (Event *) * ev_size);
+  } ev_heap[ev_count] = e; sift_up (ev_count++);
+  return e;
 }
 
-void *remove_by_data (void *list, void *data) {
-  List **first = list, *l = *first, *prev = NULL, *next;
-  while (l) { next = l->next;
-    if (l->data == data) {
-      if (prev) prev->next = next;
-      else *first = next;
-      free (l);
-    } else prev = l;
-    l = next;
-  } return prev;
+void *insert_event (void *data, int type, int64_t time) {
+  return insert_event_ms (data, type, time * 1000);
 }
 
 void remove_event (void *data) {
-  im_event.last = remove_by_data (&im_event.first, data);
-  remove_by_data (&cur_event, data);
+  uint64_t key = (uintptr_t)data;
+  Event *e = delete_pending (&key), *next;
+  while (e) {
+    next = e->next; heap_remove (e); event_free (e); e = next;
+  }
 }
 
-Timer *ev_timer;
+void cancel_event (void *handle) {
+  Event *e = handle;
+  unlink_event (e); heap_remove (e); event_free (e);
+}
+
+#define EVENT_TIMER_MAX 3600000 // the longest timeout in milliseconds
+
+THREAD_LOCAL Timer *ev_timer;
+// the armed deadline and the expiry of the timer (system time)
+THREAD_LOCAL int64_t ev_deadline = 0, ev_expiry = 0;
 
 int next_event (void **any) {
-  Event *e; int event;
-  if (queue_peek (&im_event)) {
-    e = queue_remove (&im_event);
-    event = e->type; *any = e->data;
-    free (e); return event;
+  Event *e; int event; int64_t now, offset, deadline, ms;
+  if (ev_count) { e = ev_heap[0];
+    if (e->time == 0 || e->time <= (now = se_time_ms ())) {
+      heap_remove (e); unlink_event (e);
+      event = e->type; *any = e->data;
+      event_free (e); return event;
+    }
+    offset = se_time_offset * 1000LL; deadline = e->time - offset;
+    // a distant deadline is armed again when the timer expires
+    if (deadline != ev_deadline || now - offset >= ev_expiry) {
+      ms = min (e->time - now, EVENT_TIMER_MAX);
+      set_timer_ms (ev_timer, ms);
+      ev_deadline = deadline; ev_expiry = now - offset + ms;
+    }
+  } else if (ev_deadline) {
+    set_timer_ms (ev_timer, 0); ev_deadline = 0;
   }
-  if (e = cur_event) {
-    int64_t now = se_time ();
-    //printf ("next_event %d %d\n", e->time, now);
-    if (e->time <= now) {
-      event = e->type;
-      cur_event = e->next;
-      *any = e->data; free (e);
-      return event;
-    } set_timer (ev_timer, e->time - now);
-  } else set_timer (ev_timer, 0);
   return EVENT_NONE;
 }
 
+void event_timer_expired () { ev_deadline = 0; }
+
 void event_init () {
-  ev_timer = add_timer (EVENT_TIMER);
+  pending_init (); ev_timer = add_timer (EVENT_TIMER);
 }
@@ -18,6 +18,44 @@ void exi_output_init (Output *o, const Schema *schema, char *buffer, int size);
 
 #ifndef HEADER_ONLY
 
+/* The byte at o->ptr holds the first o->bit bits of the partial byte
+   (the rest are 0), the bytes that follow are not yet written, so the
+   buffer need not be cleared. The bit-stream is written a 64-bit word at a
+   time while 8 bytes of the buffer remain, the word holds the partial byte
+   and the new bits (big endian). */
+static inline void store_bits (Output *o, uint64_t x) {
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+  x = __builtin_bswap64 (x);
+#endif
+  memcpy (o->ptr, &x, 8);
+}
+
+#define partial_byte(o) ((o)->bit? (uint8_t)*(o)->ptr : 0)
+
+// output n bits (n <= 32) a byte at a time
+void put_bits (Output *o, uint32_t bits, int n) {
+  char *ptr = o->ptr;
+  int m = (o->bit + n) & 7;
+  int i = (o->bit + n) >> 3, j;
+  *ptr = partial_byte (o); o->bit = m; o->ptr += i;
+  for (j = 1; j < i + (m != 0); j++) ptr[j] = 0;
+  if (m) { ptr[i] |= bits << (8-m); bits >>= m; }
+  while (i) { ptr[--i] |= bits; bits >>= 8; }
+}
+
+// output n bits (n <= 56)
+void output_word (Output *o, uint64_t bits, int n) {
+  int m = o->bit + n;
+  if (!n) return;
+  if (o->end - o->ptr >= 8) {
+    store_bits (o, (uint64_t)partial_byte (o) << 56 | bits << (64 - m));
+    o->ptr += m >> 3; o->bit = m & 7;
+  } else {
+    if (n > 32) { put_bits (o, bits >> 32, n - 32); n = 32; }
+    put_bits (o, bits, n);
+  }
+}
+
 void output_byte (Output *o, uint8_t b) {
   if (o->bit) {
     *o->ptr++ |= b >> o->bit;
@@ -25,7 +63,14 @@ void output_byte (Output *o, uint8_t b) {
   } else *o->ptr++ = b;
 }
 
+// the bytes of an unsigned integer below 2^49 are output as one word
 void output_uint (Output *o, uint64_t x) {
+  if (x >> 49 == 0) { uint64_t w = 0; int n = 0;
+    do { w = w << 8 | (x & 0x7f) | (x > 0x7f? 0x80 : 0);
+      x >>= 7; n += 8;
+    } while (x);
+    output_word (o, w, n); return;
+  }
   do { uint8_t b = x & 0x7f; x >>= 7;
     if (x) b |= 0x80;
     output_byte (o, b);
@@ -40,18 +85,14 @@ int output_binary (Output *o, uint8_t *b, int n) {
 }
 
 void output_bit (Output *o, char bit) {
+  if (!o->bit) *o->ptr = 0;
   if (o->bit == 7) {
     *o->ptr++ |= bit; o->bit = 0;
   } else *o->ptr |= bit << (7 - o->bit++);
 }
 
 void output_bits (Output *o, uint32_t bits, int n) {
-  char *ptr = o->ptr;
-  int m = (o->bit + n) & 7;
-  int i = (o->bit + n) >> 3;
-  o->bit = m; o->ptr += i;
-  if (m) { ptr[i] |= bits << (8-m); bits >>= m; }
-  while (i) { ptr[--i] |= bits; bits >>= 8; }
+  output_word (o, bits, n);
 }
 
 void output_integer (Output *o, int64_t x) {
@@ -59,10 +100,20 @@ void output_integer (Output *o, int64_t x) {
   output_bit (o, sign); output_uint (o, x);
 }
 
+// output a string literal, runs of ASCII are output a byte per character
 int exi_output_literal (Output *o, char *s) {
-  char *next; int c;
-  output_uint (o, utf8_length (s)+2);
-  while (*s && (next = utf8_char (&c, s))) {
+  int n = strlen (s), c; char *end = s + n, *next;
+  output_uint (o, utf8_count (s, n)+2);
+  while (s < end) {
+    next = utf8_ascii (s, end);
+    if (o->bit) {
+      while (next - s >= 7) { uint64_t w = 0; int i; // 7 bytes a word
+	for (i = 0; i < 7; i++) w = w << 8 | (uint8_t)*s++;
+	output_word (o, w, 56);
+      } while (s < next) output_byte (o, *s++);
+    }
+    else { memcpy (o->ptr, s, next - s); o->ptr += next - s; s = next; }
+    if (s == end || !(next = utf8_char (&c, s))) break;
     output_uint (o, c); s = next;
   } return 1;
 }
@@ -73,11 +124,11 @@ int exi_output_string (Output *o, const SchemaEntry *se, char *s) {
   if (t) {
     i = find_string (t, s);
     if (i >= 0) { part = 0; goto compact_id; }
-  } else t = o->local = new_string_table (o->local, name, 8);
-  o->local = add_string (o->local, t, s);
+  } else t = new_local_table (o->local, name);
+  add_string (t, s);
   i = find_string (o->global, s);
   if (i >= 0) { part = 1; t = o->global; goto compact_id; }
-  o->global = add_string (o->global, o->global, s);
+  add_string (o->global, s);
   exi_output_literal (o, s);
   return 1;
  compact_id:
@@ -87,10 +138,20 @@ int exi_output_string (Output *o, const SchemaEntry *se, char *s) {
   return 1;
 }
 
+// upper bound on the bytes needed to output a value
+int exi_value_size (Output *o, void *value) {
+  int type = o->se->type ^ ST_SIMPLE, n = type >> 4;
+  switch (type & 0xf) {
+  case XS_STRING: if (n) return strlen (value) * 3 + 12;
+  case XS_ANY_URI: return strlen (*(char **)value) * 3 + 12;
+  case XS_HEX_BINARY: return n + 12;
+  } return 12;
+}
+
 int exi_output_value (Output *o, void *value) {
   int type = o->se->type ^ ST_SIMPLE;
   int n = type >> 4;
-  if (o->end - o->ptr < 10) return 0;
+  if (o->end - o->ptr < exi_value_size (o, value)) return 0;
   switch (type & 0xf) {
   case XS_STRING: if (n) return exi_output_string (o, o->se, value);
   case XS_ANY_URI: return exi_output_string (o, o->se, *(char **)value);
@@ -110,6 +171,8 @@ int exi_output_value (Output *o, void *value) {
 int exi_output_simple (Output *o, void *value) {
   int type = o->se->type^ST_SIMPLE;
   int n = type >> 4; char *s;
+  // nothing is output unless the complete value fits
+  if (o->end - o->ptr < exi_value_size (o, value)) return 0;
   switch (type & 0xf) {
   case XS_STRING: if (n) { s = value; break; }
   case XS_ANY_URI: s = *(char **)value; break;
@@ -125,9 +188,8 @@ int exi_output_simple (Output *o, void *value) {
 
 int exi_output_event (Output *o, const SchemaEntry *se, int type) {
   if (o->end - o->ptr >= 3) { int bits;
-    if (type == EE_EVENT && !o->n) bits = 1;
-    else bits = bit_count (o->n);
-    printf ("exi_output_event %d %d\n", o->code, bits);
+    bits = o->n? o->width : type == EE_EVENT;
+    // printf ("exi_output_event %d %d\n", o->code, bits);
     output_bits (o, o->code, bits);
     o->n = o->code = 0;
     return 1;
@@ -135,12 +197,12 @@ int exi_output_event (Output *o, const SchemaEntry *se, int type) {
 }
 
 int exi_output_xsi_type (Output *o) {
-  int n = bit_count (o->n),
+  int n = o->width,
     bits = bit_count (o->schema->count),
     bytes = (n + 3 + 3 + 8 + bits) >> 3;
   if (o->end - o->ptr > bytes) {
     int id = o->schema->ids[o->st->type - o->schema->length];
-    printf ("exi_output_xsi_type:  %d %d\n", o->n, n);
+    // printf ("exi_output_xsi_type:  %d %d\n", o->n, n);
     output_bits (o, o->n, n); // second level code
     output_bits (o, 0, 3); // xsi:type
     output_bits (o, 5, 3); // URI - targetNamespace
@@ -151,7 +213,6 @@ int exi_output_xsi_type (Output *o) {
 }
 
 void exi_output_header (Output *o) {
-  memset (o->buffer, 0, o->end - o->buffer);
   output_byte (o, 0xa0); // distinguising bits, options present, version
   output_bits (o, 0xc, 6); // header/common/schemaId
   exi_output_literal (o, (char *)o->schema->schemaId);
@@ -159,7 +220,8 @@ void exi_output_header (Output *o) {
 }
 
 void exi_output_done (Output *o) {
-  free_tables (o->global); free_tables (o->local);
+  free_string_table (o->global); free_local_tables (o->local);
+  o->global = NULL; o->local = NULL;
 }
 
 const OutputDriver exi_output = {
@@ -173,9 +235,10 @@ const OutputDriver exi_output = {
 void exi_output_init (Output *o, const Schema *schema, char *buffer, int size) {
   output_init (o, schema, buffer, size);
   o->driver = &exi_output;
-  o->limit = INT_MAX;
+  o->limit = INT_MAX; o->packed = 1;
   exi_output_header (o);
-  o->global = new_string_table (NULL, NULL, 32);
+  o->global = new_string_table (NULL, 32);
+  o->local = new_local_tables ();
 }
 
 #endif
@@ -23,22 +23,50 @@ void exi_parse_init (Parser *p, const Schema *schema, char *data, int length);
 */
 #define need(p, n) if ((p->end - p->ptr) < (n)) return 0
 
-int parse_byte (uint8_t *b, Parser *p) {
-  if (p->bit) { need (p, 2);
-    *b = *p->ptr++ << p->bit;
-    *b |= *p->ptr >> (8-p->bit);
-  } else { need (p, 1);
-    *b = *p->ptr++;
-  } return 1;
+/* The bit-stream is read a 64-bit word at a time, the word holds the next 8
+   bytes (big endian) of the stream, bytes beyond the end read as 0. */
+static inline uint64_t load_bits (Parser *p) {
+  int n = p->end - p->ptr; uint64_t x = 0;
+  if (n >= 8) { memcpy (&x, p->ptr, 8);
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    x = __builtin_bswap64 (x);
+#endif
+  } else { int i;
+    for (i = 0; i < 8; i++) x = (x << 8) | (i < n? p->ptr[i] : 0);
+  } return x;
+}
+
+// parse n bits (n <= 32) from the bit stream
+int parse_bits (uint32_t *result, Parser *p, int n) {
+  int bit = p->bit + n;
+  need (p, (bit + 7) >> 3);
+  *result = n? (load_bits (p) << p->bit) >> (64 - n) : 0;
+  p->ptr += bit >> 3; p->bit = bit & 7; return 1;
+}
+
+int parse_byte (uint8_t *b, Parser *p) { uint32_t x;
+  ok_v (parse_bits (&x, p, 8), 0); *b = x; return 1;
+}
+
+int parse_bit (int *bit, Parser *p) {
+  return parse_bits ((uint32_t *)bit, p, 1);
 }
 
 // parse unsigned integers up to 70 (7x10) bits
 int parse_uint (Parser *p) { uint8_t b;
-  if (!p->ux_n) p->ux = 0;
+  if (!p->ux_n) { p->ux = 0;
+    if (p->end - p->ptr > 8) { // the next 7 bytes are within the word
+      uint64_t x = load_bits (p) << p->bit; int i;
+      for (i = 0; i < 7; i++, x <<= 8) {
+	b = x >> 56; p->ux |= (uint64_t)(b & 0x7f) << (i * 7);
+	if (!(b & 0x80)) { p->ptr += i+1; return 1; }
+      } p->ptr += 7; p->ux_n = 49;
+    }
+  }
   do {
     if (p->ux_n == 70) return p->state = PARSE_INVALID, 0;
     ok_v (parse_byte (&b, p), 0);
-    p->ux |= (b & 0x7f) << p->ux_n; p->ux_n += 7;
+    p->ux |= (uint64_t)(b & 0x7f) << p->ux_n; p->ux_n += 7;
   } while (b & 0x80);
   p->ux_n = 0; return 1;
 }
@@ -60,21 +88,6 @@ int parse_binary (Parser *p, uint8_t *b, uint64_t n) {
   }
 }
 
-int parse_bit (int *bit, Parser *p) { need (p, 1);
-  *bit = (*p->ptr >> (7-p->bit++)) & 1; 
-  if (p->bit & 8) { p->ptr++; p->bit = 0; }
-  return 1;
-}
-
-// parse n bits from the bit stream
-int parse_bits (uint32_t *result, Parser *p, int n) {
-  int bit = p->bit + n, bytes = bit >> 3; // number of bytes to fetch
-  uint32_t bits = *p->ptr; bit &= 7; // final bit offset
-  need (p, bit? bytes+1 : bytes); p->bit = bit;
-  while (bytes--) bits = (bits << 8) | *(++p->ptr);
-  *result = (bits >> (8-bit)) & ~(-1 << n); return 1;
-}
-
 // parse a signed integer (bounded range has greater than 4096 values)
 int parse_integer (Parser *p) { int sign;
   switch (p->exi_state) {
@@ -88,10 +101,29 @@ int parse_integer (Parser *p) { int sign;
   } return 1;
 }
 
-void parse_literal (Parser *p, char *s, int n) {
-  while (n--) parse_uint (p), s = utf8_encode (s, p->ux); *s = '\0';
+/* decode a string literal of n characters to s in a single pass, s has
+   room for size bytes including the terminator, returns the length of the
+   string, 0 if the data is incomplete (the stream position is restored)
+   or -1 if the string is invalid or too long */
+int parse_literal (Parser *p, char *s, int size, int n) {
+  uint8_t *ptr = p->ptr; int bit = p->bit; uint64_t ux = p->ux;
+  char *start = s, *end = s+size-1;
+  while (n--) {
+    if (!parse_uint (p)) {
+      if (p->state == PARSE_INVALID) return -1;
+      p->ptr = ptr; p->bit = bit; p->ux = ux; p->ux_n = 0; return 0;
+    }
+    if (p->ux < 0x80 && s < end) *s++ = p->ux;
+    else if (p->ux > 0x10ffff || end - s < (p->ux < 0x80? 1 : p->ux < 0x800? 2
+					    : p->ux < 0x10000? 3 : 4))
+      return -1;
+    else s = utf8_encode (s, p->ux);
+  } *s = '\0'; return s - start;
 }
 
+THREAD_LOCAL char *exi_scratch = NULL;
+THREAD_LOCAL int exi_scratch_size = 0;
+
 // parse compact id and look up string in the string table
 int parse_compact_id (Parser *p, StringTable *t, void *value, int n) {
   if (t && t->index) { int id;
@@ -99,27 +131,21 @@ int parse_compact_id (Parser *p, StringTable *t, void *value, int n) {
     if (id < t->index) {
       char *s = t->strings[id];
       if (n) { if (strlen (s)+1 <= n) { strcpy (value, s); return 1; }
-      } else { *(char **)value = strdup (s); return 1; } 
+      } else { *(char **)value = parse_strdup (p, s); return 1; } 
     } 
   } p->state = PARSE_INVALID; return 0;
 }
 
-// length of a utf-8 string (encoded as an exi string)
-int exi_utf8_length (Parser *p, int n) {
-  uint8_t *ptr = p->ptr; int length = 0;
-  while (n) { int m = 0;  uint8_t b;
-    /* UTF-8 code points need at most 21 bits (3 bytes in EXI encoding) and
-       are encoded using 1 to 4 bytes in UTF-8. */
-    do {
-      if (!parse_byte (&b, p)) { p->ptr = ptr; return 0; }
-      if (++m > 3) { p->state = PARSE_INVALID; return 0; }
-    } while (b & 0x80);
-    // adjust encoded length based upon bits needed
-    switch (m) {
-    case 2: if (b & 0x70) m++; break; // more than 11 bits needed?
-    case 3: if (b & 0x7c) m++; break; // more than 16 bits needed?
-    } length += m; n--;
-  } p->ptr = ptr; return length;
+/* decode a literal to allocated storage, UTF-8 needs at most 4 bytes per
+   character so the literal is decoded to a scratch buffer then copied */
+int parse_literal_alloc (Parser *p, char **value, int n) {
+  int size = n*4+1, m;
+  if (size > exi_scratch_size) {
+    exi_scratch = realloc (exi_scratch, exi_scratch_size = size);
+  }
+  if ((m = parse_literal (p, exi_scratch, size, n)) > 0 || !n)
+    *value = memcpy (parse_alloc (p, m+1), exi_scratch, m+1);
+  return m;
 }
 
 // parse an EXI string, either a compact identifier or string literal
@@ -139,16 +165,17 @@ int exi_parse_string (Parser *p, void *value, int n) {
       ok_v (parse_compact_id (p, p->global, value, n), 0); break;
     default: // literal value encoding
       length = p->ux - 2;
-      ok_v (m = exi_utf8_length (p, length), 0);
       if (n) { // string is stored in a fixed container
-	if (m >= n) { p->state = PARSE_INVALID; return 0; }
-	s = value;
-      } else { *(char **)value = s = malloc (m+1); }
-      parse_literal (p, s, length);
-      t = find_table (p->local, name);
-      if (!t) t = p->local = new_string_table (p->local, name, 8);
-      p->local = add_string (p->local, t, s);
-      p->global = add_string (p->global, p->global, s);
+	m = parse_literal (p, s = value, n, length);
+      } else {
+	m = parse_literal_alloc (p, (char **)value, length);
+	s = *(char **)value;
+      }
+      if (m < 0) { p->state = PARSE_INVALID; return 0; }
+      if (!m && length) return 0;
+      if (!(t = find_table (p->local, name)))
+	t = new_local_table (p->local, name);
+      add_string (t, s); add_string (p->global, s);
     } p->exi_state = 0; return 1;
   }
 }
@@ -201,19 +228,22 @@ int exi_parse_header (Parser *p) { int c;
     uint32_t x; int n;
     parse_bits (&x, p, 6);
     parse_uint (p); n = p->ux;
-    if (n && n < 64) { n -= 2;
-      parse_literal (p, schemaId, n);
+    if (n >= 2 && n < 64) { n -= 2;
       // verify options document
-      if (x == 0xc && streq (schemaId, p->schema->schemaId))
+      if (parse_literal (p, schemaId, 64, n) >= 0 && x == 0xc
+	  && streq (schemaId, p->schema->schemaId))
 	return parse_bit (&n, p), n; // EE
     }
   } p->state = PARSE_INVALID; return 0;
 }
 
 // parse the header and the first event code (the global element)
-int exi_parse_start (Parser *p) {
-  if (!exi_parse_header (p)) return 0;
-  ok_v (parse_bits (&p->type, p, bit_count (p->schema->length)), 0);
+int exi_parse_start (Parser *p) { uint8_t *ptr = p->ptr;
+  if (!exi_parse_header (p)
+      || !parse_bits (&p->type, p, bit_count (p->schema->length))) {
+    if (p->state != PARSE_INVALID) p->ptr = ptr, p->bit = 0;
+    return 0;
+  }
   if (p->type < p->schema->length) {
     p->se = &p->schema->entries[p->type];
     p->need_token = 1; return 1;
@@ -305,7 +335,8 @@ int exi_parse_sequence (Parser *p, StackItem *t) {
 }
 
 void exi_parse_done (Parser *p) {
-  free_tables (p->global); free_tables (p->local);
+  free_string_table (p->global); free_local_tables (p->local);
+  p->global = NULL; p->local = NULL;
 }
 
 void exi_rebuffer (Parser *p, char *data, int length) {
@@ -323,7 +354,8 @@ void exi_parse_init (Parser *p, const Schema *schema,
   memset (p, 0, sizeof (Parser));
   exi_rebuffer (p, data, length);
   p->schema = schema; p->driver = &exi_parser;
-  p->global = new_string_table (NULL, NULL, 32);
+  p->global = new_string_table (NULL, 32);
+  p->local = new_local_tables ();
 }
 
 #endif
@@ -8,6 +8,10 @@
     indicate occupancy. Only the elements of the array that are occupied are
     stored, this results in a compact representation of a hash table at the
     cost of some extra processing to perform the insertion.
+
+    A HashTable can instead use a flat layout (see @ref hash_flat), an open
+    addressed table probed a group of 16 slots at a time, that trades memory
+    for faster lookups and insertions.
     @{
 */
 
@@ -29,6 +33,13 @@ void hash_free (HashTable *ht);
 */
 void hash_put (HashTable *ht, void *data);
 
+/** @brief Grow the HashTable so that it holds a number of items without
+    further resizing, used before a batch of insertions.
+    @param ht is a pointer to a HashTable
+    @param items is the number of items
+*/
+void hash_reserve (HashTable *ht, int items);
+
 /** @brief Delete the hash entry that matches the key.
     @param ht is a pointer to a HashTable
     @param key is a pointer to a hash key
@@ -57,11 +68,47 @@ HashTable *new_string_hash (int size, void *(*get_key) (void *data));
 */
 HashTable *new_int64_hash (int size, void *(*get_key) (void *data));
 
+/** @brief A string key with a precomputed hash. */
+typedef struct {
+  const char *s; int hash;
+} HashedKey;
+
+/** @brief Return a HashedKey for the string s. */
+HashedKey hashed_key (const char *s);
+
+/** @brief Allocate a new HashTable with entries hashed by HashedKeys.
+
+    The hash of a stored key is not recomputed when the table is resized, and
+    the strings are only compared when their hashes are equal.
+    @param size is the initial size of the HashTable
+    @param get_key is a user supplied function to get the HashedKey from a
+    hash entry
+    @returns a new HashTable
+*/
+HashTable *new_hashed_hash (int size, void *(*get_key) (void *data));
+
+/** @brief Use the flat layout for an empty HashTable.
+
+    Each slot has a control byte that holds 7 bits of the hash of the entry,
+    or marks the slot as empty or deleted. The control bytes of a group of
+    16 slots are matched at once (using SSE2 when available), so most lookups
+    compare a single key. The table grows at 7/8 occupancy (including deleted
+    slots) and shrinks at 1/8.
+    @param ht is a pointer to a HashTable
+    @returns the HashTable
+*/
+HashTable *hash_flat (HashTable *ht);
+
 /** @brief Create a global hash table with functions to initialize the
     HashTable, find, insert, and delete entries from the HashTable.
 */
-#define global_hash(name, kind, size) \
-  HashTable *name##_hash = NULL;		   \
+#define global_hash(name, kind, size) global_table (name, kind, size, 0)
+
+/** @brief Create a global hash table that uses the flat layout. */
+#define global_flat_hash(name, kind, size) global_table (name, kind, size, 1)
+
+#define global_table(name, kind, size, flat) \
+  THREAD_LOCAL HashTable *name##_hash = NULL;	   \
   void *find_##name (void *key) {		   \
     return hash_get (name##_hash, key);	   \
   }						   \
@@ -73,6 +120,7 @@ HashTable *new_int64_hash (int size, void *(*get_key) (void *data));
   }						   \
   void name##_init () {					\
     name##_hash = new_##kind##_hash (size, name##_key);	\
+    if (flat) hash_flat (name##_hash);			\
   }
 
 typedef struct {
@@ -146,18 +194,92 @@ void sg_insert (SparseGroup *g, int i, void *data) {
 #define sg_empty(g, i) ((g->bits & (1ull << i)) == 0)
 #define sg_element(g, i) (g->slot + bit_rank (g->bits, i))
 
-// HashTable is an array of SparseGroups
+// HashTable is an array of SparseGroups, or control bytes and slots if flat
 typedef struct _HashTable {
   void *(*get_key) (void *);
   int (*hash) (void *);
   int (*compare) (void *, void *);
   int i, items, min, max, size;
   SparseGroup *table, *g, *last;
+  uint8_t *ctrl; void **slots; // flat layout
+  int flat, deleted; uint8_t h2;
 } HashTable;
 
+#define FLAT_GROUP 16
+#define FLAT_EMPTY 0x80
+#define FLAT_DELETED 0xfe
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+
+// bitmask of the control bytes of a group that match c
+static inline unsigned flat_match (uint8_t *ctrl, uint8_t c) {
+  __m128i g = _mm_loadu_si128 ((__m128i *)ctrl);
+  return _mm_movemask_epi8 (_mm_cmpeq_epi8 (g, _mm_set1_epi8 (c)));
+}
+
+// bitmask of the empty or deleted slots of a group (the high bit is set)
+static inline unsigned flat_free (uint8_t *ctrl) {
+  return _mm_movemask_epi8 (_mm_loadu_si128 ((__m128i *)ctrl));
+}
+#else
+static inline unsigned flat_match (uint8_t *ctrl, uint8_t c) {
+  unsigned m = 0; int i;
+  for (i = 0; i < FLAT_GROUP; i++) m |= (ctrl[i] == c) << i;
+  return m;
+}
+
+static inline unsigned flat_free (uint8_t *ctrl) {
+  unsigned m = 0; int i;
+  for (i = 0; i < FLAT_GROUP; i++) m |= (ctrl[i] >> 7) << i;
+  return m;
+}
+#endif
+
+/* Groups are probed in triangular order (g, g+1, g+3, ...), which visits
+   every group of a power of two sized table. The search ends at a group with
+   an empty slot, and marks the first free slot for an insertion. */
+void **flat_find (HashTable *ht, void *key) {
+  unsigned h = ht->hash (key), m;
+  int mask = ht->size / FLAT_GROUP - 1, g = (h >> 7) & mask, probes = 0;
+  ht->h2 = h & 0x7f; ht->i = -1;
+  while (1) {
+    uint8_t *ctrl = ht->ctrl + g * FLAT_GROUP;
+    void **slot = ht->slots + g * FLAT_GROUP;
+    for (m = flat_match (ctrl, ht->h2); m; m &= m-1) {
+      int i = __builtin_ctz (m);
+      if (ht->compare (key, ht->get_key (slot[i])) == 0) return slot+i;
+    }
+    if (ht->i < 0 && (m = flat_free (ctrl)))
+      ht->i = g * FLAT_GROUP + __builtin_ctz (m);
+    if (flat_match (ctrl, FLAT_EMPTY)) return NULL;
+    g = (g + ++probes) & mask;
+  }
+}
+
+// insert at the marked slot
+void flat_insert (HashTable *ht, void *data) {
+  if (ht->ctrl[ht->i] == FLAT_DELETED) ht->deleted--;
+  ht->ctrl[ht->i] = ht->h2; ht->slots[ht->i] = data;
+}
+
+/* A deleted slot is marked empty if its group has an empty slot (a search
+   would end at the group anyway), otherwise it must remain a tombstone. */
+void flat_erase (HashTable *ht, int i) {
+  if (flat_match (ht->ctrl + (i & ~(FLAT_GROUP-1)), FLAT_EMPTY))
+    ht->ctrl[i] = FLAT_EMPTY;
+  else { ht->ctrl[i] = FLAT_DELETED; ht->deleted++; }
+  ht->items--;
+}
+
 void *hash_next (HashPointer *p) {
   HashTable *ht = p->ht;
   SparseGroup *sg = p->g;
+  if (ht->flat) {
+    while (++p->i < ht->size)
+      if (!(ht->ctrl[p->i] & 0x80)) return ht->slots[p->i];
+    return NULL;
+  }
   int count = sg->bits >> 58;
   if (++p->i == count) {
   next_group:
@@ -177,11 +299,17 @@ void *hash_iterate (HashPointer *p, HashTable *ht) {
 
 void hash_erase (HashPointer *p) {
   HashTable *ht = p->ht; SparseGroup *sg = p->g;
-  sg->slot[p->i] = NULL; ht->items--;
+  if (ht->flat) { flat_erase (ht, p->i); return; }
+  sg->slot[p->i] = NULL; ht->items--; ht->deleted++;
 }
 
 #define hash_mark(ht, h, j) { ht->g = h; ht->i = j; } 
-#define hash_insert(ht, data) sg_insert (ht->g, ht->i, data);
+
+// insert at the marked location, reuse the element if previously deleted
+void hash_insert (HashTable *ht, void *data) {
+  if (sg_empty (ht->g, ht->i)) sg_insert (ht->g, ht->i, data);
+  else { *sg_element (ht->g, ht->i) = data; ht->deleted--; }
+}
 
 // return pointer to hash entry with given key or NULL if non-existent
 void **hash_find (HashTable *ht, void *key) {
@@ -206,10 +334,20 @@ void **hash_find (HashTable *ht, void *key) {
   }
 }
 
+// the shrink threshold is well below half the grow threshold (hysteresis)
 void hash_init (HashTable *ht, int size) {
-  int groups = (size + 57) / 58;
-  ht->size = size; ht->items = 0;
-  ht->min = (size * 40) / 100;
+  int groups;
+  ht->items = ht->deleted = 0;
+  if (ht->flat) { size = max (size, FLAT_GROUP);
+    ht->size = size;
+    ht->min = size > FLAT_GROUP? size / 8 : -1;
+    ht->max = size - size / 8;
+    ht->ctrl = malloc (size); memset (ht->ctrl, FLAT_EMPTY, size);
+    ht->slots = malloc (size * sizeof (void *));
+    return;
+  } groups = (size + 57) / 58;
+  ht->size = size;
+  ht->min = size > 16? (size * 20) / 100 : -1;
   ht->max = (size * 80) / 100;
   ht->table = calloc (1, sizeof (SparseGroup) * groups);
   ht->last = ht->table + (groups - 1);
@@ -224,6 +362,7 @@ HashTable *hash_new (int size) {
 
 void free_table (HashTable *ht) {
   SparseGroup *g = ht->table;
+  if (ht->flat) { free (ht->ctrl); free (ht->slots); return; }
   do {
     if (g->slot) free (g->slot); g++;
   } while (g <= ht->last);
@@ -242,29 +381,66 @@ void hash_resize (HashTable *ht, int size) {
   free_table (&gt);
 }
 
-void hash_put (HashTable *ht, void *data) {
+HashTable *hash_flat (HashTable *ht) {
+  if (!ht->flat) {
+    free_table (ht); ht->table = ht->last = NULL;
+    ht->flat = 1; hash_init (ht, ht->size);
+  } return ht;
+}
+
+void flat_put (HashTable *ht, void *data) {
   void *key = ht->get_key (data), **e;
+  if (e = flat_find (ht, key)) *e = data;
+  else {
+    if (ht->items + ht->deleted == ht->max) {
+      // grow, or just clear the deleted slots if mostly deleted
+      hash_resize (ht, ht->items >= ht->max / 2? ht->size << 1 : ht->size);
+      flat_find (ht, key);
+    } flat_insert (ht, data);
+    ht->items++;
+  }
+}
+
+void hash_put (HashTable *ht, void *data) {
+  void *key, **e;
+  if (ht->flat) { flat_put (ht, data); return; }
+  key = ht->get_key (data);
   if (e = hash_find (ht, key)) *e = data;
   else {
-    if (ht->items == ht->max)
-      hash_resize (ht, ht->size << 1);
-    hash_insert (ht, data);
+    /* Deleted elements keep their slots, a search for a missing key only
+       ends at an empty slot. Mark the location again after resize. */
+    if (ht->items + ht->deleted == ht->max) {
+      hash_resize (ht, ht->items >= ht->max / 2? ht->size << 1 : ht->size);
+      hash_find (ht, key);
+    } hash_insert (ht, data);
     ht->items++;
   }
 }
 
+void hash_reserve (HashTable *ht, int items) {
+  int size = ht->size;
+  if (ht->flat) while (size - size / 8 <= items) size <<= 1;
+  else while ((size * 80) / 100 <= items) size <<= 1;
+  if (size != ht->size) hash_resize (ht, size);
+}
+
 void *hash_delete (HashTable *ht, void *key) {
   void **e, *tmp = NULL;
+  if (ht->flat) {
+    if (e = flat_find (ht, key)) {
+      tmp = *e; flat_erase (ht, e - ht->slots);
+      if (ht->items == ht->min) hash_resize (ht, ht->size >> 1);
+    } return tmp;
+  }
   if (e = hash_find (ht, key)) {
-    tmp = *e; *e = NULL;
-    if (ht->items == ht->min)
+    tmp = *e; *e = NULL; ht->deleted++;
+    if (--ht->items == ht->min)
       hash_resize (ht, ht->size >> 1);
-    ht->items--;
   } return tmp;
 }
 
 void *hash_get (HashTable *ht, void *key) {
-  void **e = hash_find (ht, key);
+  void **e = ht->flat? flat_find (ht, key) : hash_find (ht, key);
   return e? *e : NULL;
 }
 
@@ -285,6 +461,24 @@ HashTable *new_string_hash (int size, void *(*get_key) (void *data)) {
   return ht;
 }
 
+HashedKey hashed_key (const char *s) {
+  HashedKey k = {s, string_hash ((void *)s)}; return k;
+}
+
+int hashed_hash (void *data) { return ((HashedKey *)data)->hash; }
+
+int hashed_compare (void *a, void *b) { HashedKey *x = a, *y = b;
+  return x->hash != y->hash || (x->s != y->s && strcmp (x->s, y->s));
+}
+
+HashTable *new_hashed_hash (int size, void *(*get_key) (void *data)) {
+  HashTable *ht = hash_new (size);
+  ht->compare = hashed_compare;
+  ht->hash = hashed_hash;
+  ht->get_key = get_key;
+  return ht;
+}
+
 int int64_compare (void *a, void *b) {
   int64_t *x = a, *y = b;
   return !(*x == *y);
@@ -27,7 +27,10 @@ enum HttpMethod {HTTP_GET, HTTP_PUT, HTTP_POST, HTTP_DELETE, HTTP_HEAD,
 typedef struct _HttpRequest {
   struct _HttpRequest *next;
   void *context;
-  uint8_t method; char uri[];
+  int64_t time; // when queued (see @ref stat_now)
+  int64_t wait; // time held back by the pipeline depth
+  Queue held; // the message while held back by the pipeline depth
+  uint8_t method, pooled, priority; char uri[];
 } HttpRequest;
 
 /** @brief Write a POST request to a buffer and queue the request.
@@ -56,6 +59,16 @@ void http_init (void *conn, int client, const char *accept, const char *media);
 */
 void http_flush (void *conn);
 
+/** @brief Hold back the writes to an HTTP connection.
+
+    While corked the messages written to a connection are queued, they are
+    sent together with gathered writes when the connection is uncorked (or
+    flushed).
+    @param conn is a pointer to an HttpConnection
+    @param cork is 1 to cork the connection, 0 to uncork and flush
+*/
+void http_cork (void *conn, int cork);
+
 /** @brief Write data to an HTTP connection immediately if possible or queue
     for later.
 
@@ -66,12 +79,113 @@ void http_flush (void *conn);
 */
 void http_write (void *conn, void *data, int length);
 
+/** @brief Write a message made of a number of allocated segments.
+
+    The segments are referenced by the send queue rather than copied and are
+    written with gathered writes, the data of each segment must be allocated
+    with malloc and is freed once written.
+    @param conn is a pointer to an HttpConnection
+    @param seg is an array of data segments
+    @param n is the number of segments
+*/
+void http_writev (void *conn, DataSegment *seg, int n);
+
+/** @brief A producer of data for a streamed message body.
+
+    The producer is called each time the connection is ready for more of the
+    body. It is called a final time with a NULL buffer once the body is
+    complete or the message is discarded so it can release the context.
+    @param ctx is the context passed to @ref http_stream
+    @param buffer is the container for the data
+    @param size is the size of the buffer
+    @returns the length of the data, 0 when the body is complete
+*/
+typedef int (*HttpProducer) (void *ctx, char *buffer, int size);
+
+/** @brief Write a message with a streamed body.
+
+    The body is sent with the chunked transfer coding; each chunk is produced
+    only once the data before it has been written, so a body of any length is
+    sent using memory for a single chunk.
+    @param conn is a pointer to an HttpConnection
+    @param header is the request/status line and headers, see
+    @ref http_send_chunked and @ref http_chunked
+    @param length is the length of the header
+    @param produce is the body producer
+    @param ctx is a context for the producer
+*/
+void http_stream (void *conn, char *header, int length,
+		  HttpProducer produce, void *ctx);
+
+/** @brief Write a message with the contents of a file as the body.
+
+    The body is written from the file with @ref net_sendfile, so it is not
+    copied through the send queue. Not for TLS connections, the data must be
+    encrypted so the file is read and written as with @ref http_writev.
+    @param conn is a pointer to an HttpConnection
+    @param header is the status line and headers, see @ref http_content
+    @param length is the length of the header
+    @param fd is a file descriptor returned by @ref file_open, the file is
+    closed once written
+    @param size is the length of the file
+*/
+void http_send_file (void *conn, char *header, int length, int fd, int size);
+
+/** @brief Does a client HTTP connection have requests awaiting a response?
+    @param conn is a pointer to an HttpConnection
+    @returns 1 if there are requests awaiting a response, 0 otherwise
+*/
+int http_busy (void *conn);
+
+/** @brief Set the pipeline depth of a client HTTP connection.
+
+    Requests are written to the connection without waiting for the responses
+    to previous requests (HTTP/1.1 pipelining), responses are matched to the
+    requests in the order they were sent. The depth limits the number of
+    requests in flight, requests beyond the depth are held until a response
+    is received. The default depth is @ref http_default_depth.
+    @param conn is a pointer to an HttpConnection
+    @param depth is the maximum number of requests in flight, 0 for no limit
+*/
+void http_pipeline (void *conn, int depth);
+
+/** @brief The pipeline depth of new HTTP connections (0 for no limit) */
+extern int http_default_depth;
+
+/** @brief Set the priority of the next request to a client HTTP connection.
+
+    Requests held back by the pipeline depth (see @ref http_pipeline) are
+    sent in order of priority, lowest first, and in the order they were
+    written within a priority. The priority applies to the next request
+    only, requests are priority 0 unless set.
+    @param conn is a pointer to an HttpConnection
+    @param priority is the priority of the next request
+*/
+void http_priority (void *conn, int priority);
+
 /** @brief Perform a GET request immediately if possible or queue for later.
     @param conn is a pointer to an HttpConnection
     @param uri is the request URI
 */
 void http_get (void *conn, const char *uri);
 
+/** @brief Perform a conditional GET request.
+
+    The request includes If-None-Match and If-Modified-Since headers for the
+    validators given, the server responds with status 304 (Not Modified) if
+    the resource is unchanged. Validators longer than @ref HTTP_VALIDATOR_MAX
+    are not sent.
+    @param conn is a pointer to an HttpConnection
+    @param uri is the request URI
+    @param etag is the ETag from a previous response or NULL
+    @param modified is the Last-Modified date from a previous response or NULL
+*/
+void http_get_conditional (void *conn, const char *uri,
+			   const char *etag, const char *modified);
+
+/** @brief The maximum length of a validator sent with a conditional GET */
+#define HTTP_VALIDATOR_MAX 128
+
 /** @brief Perform a DELETE request immediately if possible or queue for later.
     @param conn is a pointer to an HttpConnection
     @param uri is the request URI
@@ -92,6 +206,18 @@ void http_delete (void *conn, const char *uri);
 */
 int http_send (void *conn, char *buffer, const char *uri, int method);
 
+/** @brief Write a PUT or POST request message with a chunked body to a
+    buffer and queue the request.
+
+    Use the function @ref http_stream to complete the request.
+    @param conn is a pointer to an HttpConnection
+    @param buffer is a buffer large enough for the request
+    @param uri is the request URI
+    @param method is either HTTP_PUT or HTTP_POST
+    @returns the length of the message
+*/
+int http_send_chunked (void *conn, char *buffer, const char *uri, int method);
+
 /** @brief Write an HTTP status line to buffer.
     @param buffer is the storage for the status line
     @param status is the status code
@@ -108,6 +234,13 @@ int http_status_line (char *buffer, int status, const char *reason);
 */
 int http_content (char *buffer, const char *media, int length);
 
+/** @brief Write HTTP content headers for a chunked body to a buffer.
+    @param buffer is the storage for the headers
+    @param media is the Content-Type
+    @returns the length of the headers
+*/
+int http_chunked (char *buffer, const char *media);
+
 /** @brief Update the Content-Length header.
 
     The Content-Length header should have a enough blank spaces for the length.
@@ -123,6 +256,16 @@ void set_content_length (char *buffer, int length);
 */
 HttpRequest *http_queued (void *conn);
 
+/** @brief Free an HttpRequest returned by @ref http_queued.
+    @param r is a pointer to an HttpRequest
+*/
+void free_request (HttpRequest *r);
+
+/** @brief Reset the state of an HTTP connection that was reconnected.
+    @param conn is a pointer to an HttpConnection
+*/
+void http_reset (void *conn);
+
 /** @brief Close the HTTP connection and free queued requests/data.
     @param conn is a pointer to an HttpConnection
 */
@@ -175,11 +318,43 @@ void http_error (void *conn, int status);
 */
 int http_receive (void *conn);
 
+#ifdef HTTP_ZLIB
+
+/** @brief Request compressed responses from servers.
+
+    When set, requests include an Accept-Encoding header for the gzip and
+    deflate content codings. A body received with either coding (response or
+    request) is decompressed as it arrives, @ref http_data returns the
+    decoded data. Off by default, available when built with HTTP_ZLIB.
+*/
+extern int http_accept_encoding;
+
+/** @brief Compress the body of a message with gzip.
+
+    The body segments are replaced by a single compressed segment, a
+    Content-Encoding header is added and the Content-Length is set. The
+    body is left as it is if it doesn't compress. See @ref http_writev for
+    the segments.
+    @param seg is an array of data segments, the first is the status/request
+    line and headers written with a Content-Length to be set, allocated with
+    room for another header
+    @param n is the number of segments
+    @returns the number of segments
+*/
+int http_compress (DataSegment *seg, int n);
+
+#endif
+
 /** @brief Does the HTTP message have a body?
     @returns 1 if the message has a body, 0 otherwise
 */
 int http_body (void *conn);
 
+/** @brief Return the Content-Length of the HTTP message.
+    @returns the length of the message body, -1 if it has no Content-Length
+*/
+int http_content_length (void *conn);
+
 /** @brief Return data from the message body.
 
     Call again until all the data has been returned. @ref http_complete
@@ -192,11 +367,14 @@ char *http_data (void *conn, int *length);
 
 /** @brief Clear data up to the pointer and read more data from the connection.
 
-    An HttpConnection uses a fixed length buffer to retrieve data, this
-    function clears data and moves the remainder of the data to the beginning
-    of the buffer so more data can be read.
+    An HttpConnection receives data into a buffer taken from a pool, this
+    function clears data up to the pointer so more data can be read. The
+    remainder is moved to the beginning of the buffer only when the space
+    left at the end of the buffer runs low. If the remainder fills the buffer
+    (a token larger than the buffer) a larger buffer is borrowed until the
+    connection is idle.
     @param conn is a pointer to an HttpConnection
-    @param data is a pointer to 
+    @param data is a pointer to the data not yet consumed
 */
 void http_rebuffer (void *conn, char *data);
 
@@ -206,6 +384,15 @@ void http_rebuffer (void *conn, char *data);
 */
 int http_complete (void *conn);
 
+/** @brief Discard the rest of the message body.
+
+    Used when the content of the body is complete before the message, such
+    as a document followed by the end of a chunked body not yet received.
+    The rest of the body is read and discarded by @ref http_receive.
+    @param conn is a pointer to an HttpConnection
+*/
+void http_skip (void *conn);
+
 /** @brief Get status for HTTP response.
 
     Valid when @ref http_receive returns HTTP_RESPONSE.
@@ -220,6 +407,27 @@ int http_status (void *conn);
 */
 int http_method (void *conn);
 
+/** @brief Return the latency of the HTTP response.
+
+    The latency is the time from when the request was queued until the
+    status line of the response was received, it includes the time spent
+    behind other requests in the pipeline.
+    @param conn is a pointer to an HttpConnection
+    @returns the latency in nanoseconds
+*/
+int64_t http_latency (void *conn);
+
+/** @brief Return when the request of the HTTP response was queued and sent.
+
+    A request held back by the pipeline depth is sent when the response to an
+    earlier request is received, otherwise it is sent as it is queued.
+    @param conn is a pointer to an HttpConnection
+    @param queued is set to the time the request was queued (see
+    @ref stat_now)
+    @param sent is set to the time the request was sent
+*/
+void http_times (void *conn, int64_t *queued, int64_t *sent);
+
 /** @brief Get the path for an HTTP request.
     @param conn is a pointer to an HttpConnection
     @returns the path
@@ -250,6 +458,28 @@ int http_client (void *conn);
 */
 char *http_location (void *conn);
 
+/** @brief Get the ETag header value
+
+    For a request (server) this is the value of the If-None-Match header.
+    @param conn is a pointer to an HttpConnection
+    @returns the value of the ETag header or NULL if none exists
+*/
+char *http_etag (void *conn);
+
+/** @brief Does a conditional request match an entity tag?
+    @param conn is a pointer to an HttpConnection with a request
+    @param etag is the current entity tag of the target resource
+    @returns 1 if the If-None-Match header matches the entity tag (the
+    response should be 304 Not Modified), 0 otherwise
+*/
+int http_match (void *conn, const char *etag);
+
+/** @brief Get the Last-Modified header value
+    @param conn is a pointer to an HttpConnection
+    @returns the value of the Last-Modified header or NULL if none exists
+*/
+char *http_modified (void *conn);
+
 /** @brief Parse an HTTP URI using connection parameters.
     @param buf is a pointer to a buffered Uri
     @param conn is a pointer to an HttpConnection
@@ -288,6 +518,7 @@ void *http_context (void *conn);
 
 #ifndef HEADER_ONLY
 
+#include <strings.h>
 #include <time.h>
 
 enum HttpState {HTTP_START, HTTP_HEADER, HTTP_DATA, HTTP_COMPLETE, HTTP_CLOSED};
@@ -295,39 +526,192 @@ enum HttpState {HTTP_START, HTTP_HEADER, HTTP_DATA, HTTP_COMPLETE, HTTP_CLOSED};
 const char * const http_methods[] =
   {"GET", "PUT", "POST", "DELETE", "HEAD", ""};
 
+// an item of the send queue is a segment of a message
 typedef struct _SendQueueItem {
   struct _SendQueueItem *next;
-  int length;
+  int length, offset; // offset is the amount of data already written
+  char *data; // points to buffer or to an allocated segment
+  int (*produce) (void *, char *, int); // producer of a streamed body
+  void *ctx; // producer context
+  int fd; // file written with net_sendfile, -1 if none
+  unsigned head : 1; // first segment of a message
+  unsigned tail : 1; // last segment of a message
   char buffer[];
 } SendQueueItem;
 
-// An HTTP connection uses a fixed length buffer
-// make sure buffer is large enough for the request/status + headers
+/* An HTTP connection receives data into a buffer, buffers of BUFFER_SIZE are
+   kept in a pool (per thread) and are only held by a connection while a
+   message is being received. Larger buffers (up to BUFFER_MAX) are allocated
+   for messages with a header line or body token that doesn't fit, and are
+   freed once the connection is idle. */
 #define BUFFER_SIZE 2048
+#define BUFFER_MAX 65536
+#define POOL_MAX 64
+
+typedef struct _HttpBuffer {
+  struct _HttpBuffer *next;
+  int size; // size of data
+  char target[256]; // request target
+  char data[];
+} HttpBuffer;
+
+THREAD_LOCAL HttpBuffer *_http_pool = NULL;
+THREAD_LOCAL int _http_pooled = 0;
+
+HttpBuffer *buffer_get (int size) { HttpBuffer *b;
+  if (size == BUFFER_SIZE && (b = _http_pool)) {
+    _http_pool = b->next; _http_pooled--; return b;
+  } b = malloc (sizeof (HttpBuffer) + size);
+  b->size = size; return b;
+}
+
+void buffer_put (HttpBuffer *b) {
+  if (b->size == BUFFER_SIZE && _http_pooled < POOL_MAX) {
+    b->next = _http_pool; _http_pool = b; _http_pooled++;
+  } else free (b);
+}
+
+#ifdef HTTP_ZLIB
+
+#include <zlib.h>
+
+/* A body with the gzip or deflate content coding is inflated into a buffer
+   of its own as it is received, the decoded data is consumed from the
+   buffer as the data of an uncoded body is consumed from the receive
+   buffer. */
+typedef struct {
+  z_stream z;
+  HttpBuffer *out; // decoded data
+  char *data; // decoded data not yet consumed
+  int length; // amount of decoded data
+  unsigned done : 1; // the body is decoded
+  unsigned ended : 1; // the last of the decoded data was returned
+} HttpDecoder;
+
+int http_accept_encoding = 0;
+
+HttpDecoder *decoder_new () {
+  HttpDecoder *d = calloc (1, sizeof (HttpDecoder));
+  // a window of 15 bits + 32 detects either the gzip or the zlib header
+  if (inflateInit2 (&d->z, 15 + 32) != Z_OK) { free (d); return NULL; }
+  d->out = buffer_get (BUFFER_SIZE); d->data = d->out->data; *d->data = '\0';
+  return d;
+}
+
+void decoder_end (HttpDecoder *d) {
+  inflateEnd (&d->z); buffer_put (d->out); free (d);
+}
+
+// replace the decoded buffer with one twice the size
+int decoder_grow (HttpDecoder *d) {
+  HttpBuffer *b; int size = d->out->size << 1;
+  if (size > BUFFER_MAX) return 0;
+  b = buffer_get (size); memcpy (b->data, d->out->data, d->length+1);
+  buffer_put (d->out); d->out = b; d->data = b->data; return 1;
+}
+
+#endif
+
 typedef struct _HttpConnection {
   Connection tcp;
   char *query, *content_type, *media_range, *location;
-  Address host; // host from the Host: header field
+  char *etag, *modified; // ETag and Last-Modified header fields
+  Address host; // from the Host: header field, the server of a client
   char *headers, *version;
   const char *media; // media type for POST/PUT
   const char *accept; // media types accepted
+  char *request_headers; // Host and Accept header fields, built once
+  int request_length; // length of the request headers
   char *data; // pointer to the next header line or http content
   int end;    // buffer + end = the end of the http message
   int length; // the amount of data in buffer
   int content_length; // from the Content-Length header
+  int chunk; // bytes left of the current chunk (see chunk_decode)
+  char saved; // the byte at end, a NUL while the chunk coding is pending
   uint8_t state, method, request_method;
   unsigned body : 1; // response or request has a body
+  unsigned chunked : 1; // the body has the chunked transfer coding
+  unsigned skip : 1; // the rest of the body is discarded
   unsigned close : 1; // close signaled in last request/response
   unsigned client : 1; // true for client connection
   unsigned debug : 1;
+  unsigned corked : 1; // writes are queued until uncorked
   int status, error, header;
+  int64_t latency; // of the last response (ns)
+  int64_t queued, wait; // of the request of the last response
+  int depth, sent; // pipeline depth, number of requests in flight
+#ifdef HTTP_ZLIB
+  unsigned coded : 1; // the body has a content coding
+  HttpDecoder *decoder; // of a coded body
+#endif
   void *context; // request context
   Queue send, request;
-  char target[256]; Uri uri; // request target
-  char buffer[BUFFER_SIZE];
+  Queue hold; // requests held back by the pipeline depth, by priority
+  HttpRequest *pending, *last; // the request being written, the last request
+  int priority; // of the next request
+  HttpBuffer *slab; // receive buffer, NULL when the connection is idle
+  char *buffer, *target; Uri uri; // request target
+  int size; // size of buffer
 } HttpConnection;
 
-#define buffer_full(h) (((h)->length+1) == BUFFER_SIZE)
+#define buffer_full(h) (((h)->length+1) == (h)->size)
+
+// take a receive buffer from the pool
+void http_buffer (HttpConnection *h) {
+  if (h->slab) return;
+  h->slab = buffer_get (BUFFER_SIZE); h->size = h->slab->size;
+  h->data = h->buffer = h->slab->data; h->target = h->slab->target;
+  h->length = h->end = 0; *h->buffer = *h->target = '\0';
+}
+
+// return the receive buffer to the pool
+void http_drop (HttpConnection *h) {
+#ifdef HTTP_ZLIB
+  if (h->decoder) { decoder_end (h->decoder); h->decoder = NULL; }
+#endif
+  if (h->slab) { buffer_put (h->slab); h->slab = NULL;
+    h->data = h->buffer = h->target = NULL; h->length = h->end = 0;
+  }
+}
+
+// return the receive buffer to the pool if there is no data pending
+void http_idle (HttpConnection *h) {
+  if (h->slab && h->data == h->buffer + h->length) http_drop (h);
+}
+
+#define rebase(p, a, b, n) \
+  if ((p) >= (a) && (p) < (a)+(n)) (p) = (b) + ((p)-(a))
+
+// replace the receive buffer with one twice the size
+int http_grow (HttpConnection *h) {
+  HttpBuffer *a = h->slab, *b; char *t = a->target, *d = a->data;
+  int size = a->size << 1;
+  if (size > BUFFER_MAX) return 0;
+  b = buffer_get (size);
+  memcpy (b->target, t, 256); memcpy (b->data, d, h->length+1);
+  rebase (h->uri.scheme, t, b->target, 256);
+  rebase (h->uri.name, t, b->target, 256);
+  rebase (h->uri.end, t, b->target, 256);
+  rebase (h->uri.path, t, b->target, 256);
+  rebase (h->uri.query, t, b->target, 256);
+  rebase (h->data, d, b->data, h->length+1);
+  rebase (h->content_type, d, b->data, h->length+1);
+  rebase (h->media_range, d, b->data, h->length+1);
+  rebase (h->location, d, b->data, h->length+1);
+  rebase (h->etag, d, b->data, h->length+1);
+  rebase (h->modified, d, b->data, h->length+1);
+  h->slab = b; h->buffer = b->data; h->target = b->target; h->size = size;
+  buffer_put (a); return 1;
+}
+
+// move unconsumed data to the beginning of the buffer
+void http_compact (HttpConnection *h) { int n;
+  if (n = h->data - h->buffer) {
+    if (h->end) h->end -= n;
+    h->length -= n; h->data = h->buffer;
+    memmove (h->buffer, h->buffer+n, h->length+1);
+  }
+}
 
 #include "http_parse.c"
 
@@ -338,29 +722,57 @@ int http_content_length (void *conn) {
   return http_field (conn, content_length); }
 int http_status (void *conn) { return http_field (conn, status); }
 int http_method (void *conn) { return http_field (conn, request_method); }
+int64_t http_latency (void *conn) { return http_field (conn, latency); }
+void http_times (void *conn, int64_t *queued, int64_t *sent) {
+  HttpConnection *c = conn; *queued = c->queued; *sent = c->queued + c->wait;
+}
 char *http_path (void *conn) { return http_field (conn, uri.path); }
 char *http_query (void *conn) { return http_field (conn, uri.query); }
 char *http_range (void *conn) { return http_field (conn, media_range); }
 int http_client (void *conn) { return http_field (conn, client); }
 char *http_location (void *conn) { return http_field (conn, location); }
+char *http_etag (void *conn) { return http_field (conn, etag); }
+char *http_modified (void *conn) { return http_field (conn, modified); }
+
+int http_match (void *conn, const char *etag) {
+  char *list = http_etag (conn), *end; int n = strlen (etag);
+  if (!list) return 0;
+  while (*(list = ows (list))) {
+    if (*list == '*') return 1;
+    if (!strncmp (list, "W/", 2)) list += 2; // weak comparison
+    if (!strncmp (list, etag, n) && (!list[n] || list[n] == ','
+				     || list[n] == ' ')) return 1;
+    if (!(end = strchr (list, ','))) break;
+    list = end+1;
+  } return 0;
+}
 void http_debug (void *conn, int enable) { http_field (conn, debug) = enable; }
+void http_pipeline (void *conn, int depth) { http_field (conn, depth) = depth; }
+void http_priority (void *conn, int priority) {
+  http_field (conn, priority) = priority;
+}
 void *http_context (void *conn) { return http_field (conn, context); }
+int http_busy (void *conn) {
+  return !queue_empty (&http_field (conn, request));
+}
 
 void print_http_status (void *conn) { HttpConnection *c = conn;
   const char *method = http_methods[c->request_method];
   printf ("%s %s: %d\n", method, c->uri.path, c->status);  
 }
 
+int http_default_depth = 0;
+
 void http_init (void *conn, int client,
 		const char *accept,
 		const char *media) {
   HttpConnection *c = conn;
   c->client = client;
-  c->data = c->buffer;
   c->accept = accept;
   c->media = media;
   c->version = "HTTP/1.1";
   c->headers = "";
+  c->depth = http_default_depth;
 }
 
 void print_headers (void *conn, char *buffer) { char *end;
@@ -370,62 +782,251 @@ void print_headers (void *conn, char *buffer) { char *end;
   }
 }
 
+SendQueueItem *send_new (int size) {
+  SendQueueItem *i = malloc (sizeof (SendQueueItem) + size);
+  i->next = NULL; i->offset = 0; i->data = i->buffer;
+  i->produce = NULL; i->fd = -1; i->head = i->tail = 0; return i;
+}
+
+void send_free (Queue *q) { SendQueueItem *i;
+  while (i = queue_remove (q)) {
+    if (i->produce) i->produce (i->ctx, NULL, 0);
+    if (i->fd >= 0) file_close (i->fd);
+    if (i->data != i->buffer) free (i->data); free (i);
+  }
+}
+
+#define SEND_SEGMENTS 16
+#define CHUNK_SIZE 4096
+
+// produce the next chunk of a streamed body ahead of the stream item
+void send_produce (HttpConnection *h, SendQueueItem *s) {
+  SendQueueItem *i; char size[16], *b = malloc (CHUNK_SIZE+12); int n;
+  if ((n = s->produce (s->ctx, b+10, CHUNK_SIZE)) > 0) {
+    sprintf (size, "%08x\r\n", n); memcpy (b, size, 10);
+    memcpy (b+10+n, "\r\n", 2);
+    i = send_new (0); i->data = b; i->length = n+12;
+  } else { // last chunk
+    free (b); s->produce (s->ctx, NULL, 0); free (queue_remove (&h->send));
+    i = send_new (5); memcpy (i->buffer, "0\r\n\r\n", 5);
+    i->length = 5; i->tail = 1;
+  } queue_push (&h->send, i);
+}
+
+// write from a file, returns 1 once the file is written
+int send_file (HttpConnection *h, SendQueueItem *i) {
+  int n = net_sendfile (h, i->fd, i->offset, i->length - i->offset);
+  if (n <= 0 || (i->offset += n) < i->length) return 0;
+  file_close (i->fd); free (queue_remove (&h->send)); return 1;
+}
+
+#define send_data(i) (!(i)->produce && (i)->fd < 0)
+
+// write the queued segments with gathered writes
 void http_flush (void *conn) {
   HttpConnection *h = conn; SendQueueItem *i;
-  while ((i = queue_peek (&h->send))
-	 && conn_write (conn, i->buffer, i->length) > 0) {
-    if (h->debug) print_headers (conn, i->buffer);
-    free (queue_remove (&h->send));
+  DataSegment seg[SEND_SEGMENTS]; int n, total, written, left;
+  while (i = queue_peek (&h->send)) {
+    if (i->produce) { send_produce (h, i); continue; }
+    if (i->fd >= 0) { if (send_file (h, i)) continue; break; }
+    for (n = total = 0; i && send_data (i) && n < SEND_SEGMENTS;
+	 n++, i = i->next) {
+      seg[n].data = i->data + i->offset;
+      total += seg[n].length = i->length - i->offset;
+    }
+    if ((written = conn_writev (conn, seg, n)) <= 0) break;
+    for (left = written; (i = queue_peek (&h->send)) && send_data (i);
+	 left -= n) {
+      if (left < (n = i->length - i->offset)) {
+	i->offset += left; break;
+      } if (h->debug && i->head) print_headers (conn, i->data);
+      queue_remove (&h->send);
+      if (i->data != i->buffer) free (i->data); free (i);
+    } if (written < total) break; // the socket is full
   }
   if (queue_empty (&h->send) && h->close) conn_close (h);
 }
 
+// copy data to a queue item
+SendQueueItem *send_item (void *data, int length) {
+  SendQueueItem *i = send_new (length+1);
+  i->length = length; i->head = i->tail = 1;
+  memcpy (i->buffer, data, length); i->buffer[length] = '\0';
+  return i;
+}
+
+// reference an allocated segment from a queue item
+SendQueueItem *send_segment (char *data, int length) {
+  SendQueueItem *i = send_new (0);
+  i->length = length; i->data = data; return i;
+}
+
+int pipeline_full (HttpConnection *h) {
+  return h->depth && h->sent >= h->depth;
+}
+
+// insert a request among the held requests after those of equal priority
+void hold_request (HttpConnection *h, HttpRequest *r) {
+  HttpRequest *t = queue_tail (&h->hold), **p;
+  if (!t || t->priority <= r->priority) { queue_add (&h->hold, r); return; }
+  p = (HttpRequest **)&h->hold.first;
+  while ((*p)->priority <= r->priority) p = &(*p)->next;
+  r->next = *p; *p = r;
+}
+
+/* The queue for the message of a client request, the message is held with
+   the request when the pipeline is full. */
+Queue *request_queue (HttpConnection *h) { HttpRequest *r = h->pending;
+  if (!h->client || !r) return &h->send;
+  h->pending = NULL;
+  if (pipeline_full (h)) { hold_request (h, r); return &r->held; }
+  queue_add (&h->request, r); h->sent++; return &h->send;
+}
+
+// a client writes one complete request with each call
 void http_write (void *conn, void *data, int length) {
-  HttpConnection *h = conn;
-  if (h->send.first || conn_write (conn, data, length) < 0) {
-    SendQueueItem *i = malloc (sizeof (SendQueueItem) + length);
-    i->length = length; i->next = NULL;
-    memcpy (i->buffer, data, length);
-    queue_add (&h->send, i); return;
-  } if (h->debug) print_headers (conn, data);
+  HttpConnection *h = conn; Queue *q = request_queue (h);
+  SendQueueItem *i; int n = 0;
+  if (q != &h->send) { queue_add (q, send_item (data, length)); return; }
+  if (!h->send.first && !h->corked
+      && (n = conn_write (conn, data, length)) == length) {
+    if (h->debug) print_headers (conn, data); return;
+  } if (n < 0) n = 0;
+  queue_add (&h->send, i = send_item (data+n, length-n)); i->head = !n;
+}
+
+void http_writev (void *conn, DataSegment *seg, int n) {
+  HttpConnection *h = conn; Queue *q = request_queue (h);
+  SendQueueItem *s = NULL; int i;
+  for (i = 0; i < n; i++) {
+    if (!seg[i].length) { free ((char *)seg[i].data); continue; }
+    s = send_segment ((char *)seg[i].data, seg[i].length);
+    s->head = i == 0; queue_add (q, s);
+  } if (s) s->tail = 1;
+  if (q == &h->send && !h->corked) http_flush (h);
+}
+
+void http_cork (void *conn, int cork) { HttpConnection *h = conn;
+  h->corked = cork; if (!cork) http_flush (h);
+}
+
+void http_stream (void *conn, char *header, int length,
+		  HttpProducer produce, void *ctx) {
+  HttpConnection *h = conn; Queue *q = request_queue (h); SendQueueItem *i;
+  queue_add (q, i = send_item (header, length)); i->tail = 0;
+  queue_add (q, i = send_new (0)); i->length = 0; i->tail = 1;
+  i->produce = produce; i->ctx = ctx;
+  if (q == &h->send) http_flush (h);
+}
+
+void http_send_file (void *conn, char *header, int length, int fd, int size) {
+  HttpConnection *h = conn; SendQueueItem *i;
+  queue_add (&h->send, i = send_item (header, length)); i->tail = !size;
+  if (size) {
+    queue_add (&h->send, i = send_new (0)); i->length = size; i->tail = 1;
+    i->fd = fd;
+  } else file_close (fd);
+  if (!h->corked) http_flush (h);
+}
+
+// a response was received, send held requests in order of priority
+void http_release (HttpConnection *h) { HttpRequest *r;
+  if (h->sent) h->sent--;
+  if (queue_empty (&h->hold)) return;
+  while (!pipeline_full (h) && (r = queue_remove (&h->hold))) {
+    r->next = NULL; queue_add (&h->request, r); h->sent++;
+    r->wait = stat_now () - r->time;
+    if (h->send.last) h->send.last->next = r->held.first;
+    else h->send.first = r->held.first;
+    h->send.last = r->held.last; queue_clear (&r->held);
+  } http_flush (h);
+}
+
+// requests with a URI of up to REQUEST_URI bytes are allocated from a pool
+#define REQUEST_URI 104
+
+THREAD_LOCAL Pool request_pool = {NULL, "request",
+				  sizeof (HttpRequest) + REQUEST_URI};
+
+void free_request (HttpRequest *r) {
+  if (r->pooled) pool_free (&request_pool, r); else free (r);
 }
 
 void queue_request (HttpConnection *c, int method, const char *uri) {
-  HttpRequest *r = malloc (sizeof (HttpRequest) + strlen (uri) + 1);
-  r->next = r->context = NULL; r->method = method; strcpy (r->uri, uri);
-  queue_add (&c->request, r);
+  int n = strlen (uri) + 1; HttpRequest *r;
+  if (n <= REQUEST_URI) { r = pool_alloc (&request_pool); r->pooled = 1; }
+  else { r = malloc (sizeof (HttpRequest) + n); r->pooled = 0; }
+  r->next = r->context = NULL; r->method = method; memcpy (r->uri, uri, n);
+  r->time = stat_now (); r->wait = 0; queue_clear (&r->held);
+  r->priority = c->priority; c->priority = 0;
+  if (c->client) c->pending = c->last = r; else queue_add (&c->request, r);
 }
 
 void set_request_context (void *conn, void *context) {
   HttpConnection *c = conn; HttpRequest *r;
-  if (r = queue_tail (&c->request)) r->context = context;
+  if (r = c->last) r->context = context;
 }
 
 HttpRequest *dequeue_request (HttpConnection *c) {
-  return queue_remove (&c->request);
+  HttpRequest *r = queue_remove (&c->request);
+  if (r == c->last) c->last = NULL;
+  return r;
 }
 
-int http_date (char *buffer) {
-  time_t now = time (NULL); struct tm tm = *gmtime (&now);
-  return strftime (buffer, 1024, "Date: %a, %d %b %Y %H:%M:%S GMT\r\n", &tm);
+THREAD_LOCAL time_t date_time = 0;
+THREAD_LOCAL char date_field[48];
+THREAD_LOCAL int date_length;
+
+// the Date header field is formatted at most once a second
+int http_date (char *buffer) { time_t now = time (NULL);
+  if (now != date_time) { struct tm tm = *gmtime (&now);
+    date_length = strftime (date_field, 48,
+			    "Date: %a, %d %b %Y %H:%M:%S GMT\r\n", &tm);
+    date_time = now;
+  } memcpy (buffer, date_field, date_length);
+  return date_length;
+}
+
+// the Host and Accept header fields are built once per connection
+int request_headers (HttpConnection *c, char *buffer) {
+  if (!c->request_headers) { char headers[256];
+    int n = sprintf (headers, "Host: ");
+    n += write_address_port (headers+n, &c->host);
+    n += snprintf (headers+n, 256-n, "\r\nAccept: %s\r\n", c->accept);
+    c->request_headers = strdup (headers);
+    c->request_length = min (n, 255);
+  } memcpy (buffer, c->request_headers, c->request_length);
+  return c->request_length;
 }
 
 int http_request (void *conn, char *buffer, const char *uri, int method) {
-  HttpConnection *c = conn; Address addr;
+  HttpConnection *c = conn;
   const char *name = http_methods[method];
   int n = sprintf (buffer, "%s %s %s\r\n", name, uri, c->version);
-  n += http_date (buffer+n); n += sprintf (buffer+n, "Host: ");
-  n += write_address_port (buffer+n, net_remote (&addr, c));
-  n += sprintf (buffer+n, "\r\nAccept: %s\r\n", c->accept);
+  n += http_date (buffer+n); n += request_headers (c, buffer+n);
+#ifdef HTTP_ZLIB
+  if (http_accept_encoding)
+    n += sprintf (buffer+n, "Accept-Encoding: gzip, deflate\r\n");
+#endif
   queue_request (conn, method, uri); return n;
 }
 
-void http_get (void *conn, const char *uri) { char buffer[256];
+void http_get_conditional (void *conn, const char *uri,
+			   const char *etag, const char *modified) {
+  char buffer[256 + 2 * (HTTP_VALIDATOR_MAX + 24)];
   int n = http_request (conn, buffer, uri, HTTP_GET);
+  if (etag && strlen (etag) <= HTTP_VALIDATOR_MAX)
+    n += sprintf (buffer+n, "If-None-Match: %s\r\n", etag);
+  if (modified && strlen (modified) <= HTTP_VALIDATOR_MAX)
+    n += sprintf (buffer+n, "If-Modified-Since: %s\r\n", modified);
   n += sprintf (buffer+n, "\r\n");
   http_write (conn, buffer, n);
 }
 
+void http_get (void *conn, const char *uri) {
+  http_get_conditional (conn, uri, NULL, NULL);
+}
+
 void http_delete (void *conn, const char *uri) { char buffer[256];
   int n = http_request (conn, buffer, uri, HTTP_DELETE);
   n += sprintf (buffer+n, "\r\n");
@@ -434,7 +1035,7 @@ void http_delete (void *conn, const char *uri) { char buffer[256];
 
 int http_content (char *buffer, const char *media, int length) {
   int n = sprintf (buffer, "Content-Type: %s\r\n", media);
-  n += sprintf (buffer+n, "Content-Length: %-6d\r\n\r\n", length);
+  n += sprintf (buffer+n, "Content-Length: %-10d\r\n\r\n", length);
   return n;
 }
 
@@ -444,22 +1045,71 @@ int http_send (void *conn, char *buffer, const char *uri, int method) {
   return n + http_content (buffer+n, c->media, 0);
 }
 
+int http_chunked (char *buffer, const char *media) {
+  return sprintf (buffer, "Content-Type: %s\r\n"
+		  "Transfer-Encoding: chunked\r\n\r\n", media);
+}
+
+int http_send_chunked (void *conn, char *buffer, const char *uri, int method) {
+  HttpConnection *c = conn;
+  int n = http_request (conn, buffer, uri, method);
+  return n + http_chunked (buffer+n, c->media);
+}
+
+// the field is padded so that a length can be set more than once
 void set_content_length (char *buffer, int length) {
-  char *field = strstr (buffer, "Content-Length:") + 16;
-  field += sprintf (field, "%d", length); *field = ' ';
+  char *field = strstr (buffer, "Content-Length:") + 16, digits[16];
+  memcpy (field, digits, sprintf (digits, "%-10d", length));
 }
 
+#ifdef HTTP_ZLIB
+
+int http_compress (DataSegment *seg, int n) {
+  z_stream z = {0}; char *header = (char *)seg[0].data, *out;
+  int i, length = 0, size;
+  for (i = 1; i < n; i++) length += seg[i].length;
+  if (deflateInit2 (&z, Z_DEFAULT_COMPRESSION, Z_DEFLATED, 15 + 16, 8,
+		    Z_DEFAULT_STRATEGY) != Z_OK) return n;
+  out = malloc (size = deflateBound (&z, length));
+  z.next_out = (Bytef *)out; z.avail_out = size;
+  for (i = 1; i < n; i++) {
+    z.next_in = (Bytef *)seg[i].data; z.avail_in = seg[i].length;
+    deflate (&z, i == n-1? Z_FINISH : Z_NO_FLUSH);
+  } size = z.total_out; deflateEnd (&z);
+  if (size >= length) { free (out); return n; }
+  for (i = 1; i < n; i++) free ((char *)seg[i].data);
+  // the Content-Encoding header goes before the empty line
+  strcpy (header + seg[0].length - 2, "Content-Encoding: gzip\r\n\r\n");
+  seg[0].length += 24; set_content_length (header, size);
+  seg[1].data = out; seg[1].length = size; return 2;
+}
+
+#endif
+
 HttpRequest *http_queued (void *conn) {
   HttpConnection *h = conn;
-  HttpRequest *r = queue_peek (&h->request);
-  queue_free (&h->send); queue_clear (&h->request);
+  HttpRequest *r = queue_peek (&h->request), *t;
+  // the held requests follow those sent
+  if (t = queue_tail (&h->request)) t->next = queue_peek (&h->hold);
+  else r = queue_peek (&h->hold);
+  foreach (t, queue_peek (&h->hold)) send_free (&t->held);
+  send_free (&h->send); queue_clear (&h->hold);
+  queue_clear (&h->request); h->sent = 0; h->pending = h->last = NULL;
   conn_close (h); h->state = HTTP_CLOSED;
+  http_drop (h);
   return r;
 }
 
+void http_reset (void *conn) {
+  HttpConnection *h = conn;
+  h->state = HTTP_START; h->close = 0; http_drop (h);
+  free (h->request_headers); h->request_headers = NULL;
+}
+
 void http_close (void *conn) {
-  printf ("http_close\n");
-  free_list (http_queued (conn));
+  log_debug ("http_close\n");
+  HttpRequest *r = http_queued (conn), *next;
+  while (r) { next = r->next; free_request (r); r = next; }
 }
 
 int http_status_line (char *buffer, int status, const char *reason) {
@@ -509,30 +1159,88 @@ void http_respond (void *conn, int status) { char buffer[512];
 
 // fatal error, send status and close connection
 void http_error (void *conn, int status) {
-  printf ("http_error %p %d\n", conn, status); fflush (stdout);
+  log_error ("http_error %p %d\n", conn, status);
   http_respond (conn, status); http_close (conn);
 }
 
 int http_read (void *conn) {
-  HttpConnection *h = conn;
-  int n = conn_read (conn, h->buffer+h->length,
-		     BUFFER_SIZE-h->length-1);
+  HttpConnection *h = conn; int n;
+  http_buffer (h);
+  // a request/status line or header that doesn't fit the buffer
+  if (buffer_full (h) && h->state != HTTP_DATA) {
+    if (h->state == HTTP_START) http_compact (h);
+    if (buffer_full (h) && !http_grow (h)) return 0;
+  }
+  n = conn_read (conn, h->buffer+h->length, h->size-h->length-1);
   if (n <= 0) return n;
   h->length += n;
   h->buffer[h->length] = '\0';
   return n;
 }
 
+#define CHUNK_CRLF -1 // the CRLF after the chunk data is next
+#define CHUNK_TRAILER -2 // the trailer after the last chunk is next
+#define CHUNK_END -3 // the body is complete
+
 int http_complete (void *conn) { HttpConnection *c = conn;
-  return c->state == HTTP_CLOSED || c->end <= c->length;
+#ifdef HTTP_ZLIB
+  if (c->decoder) return c->decoder->done;
+#endif
+  return c->state == HTTP_CLOSED
+    || (c->chunked? c->chunk == CHUNK_END : c->end <= c->length);
+}
+
+/* Decode a chunked body in place. The chunk size lines, the CRLF after
+   each chunk and the trailer are removed from the buffer as they are
+   received, so the decoded body is contiguous up to c->end. Returns 0 if
+   the chunked coding is malformed. */
+char *line_scan (char *data);
+
+int chunk_decode (HttpConnection *c) {
+  char *p, *line, *q, *e, *end; long size;
+  if (c->saved) { c->buffer[c->end] = c->saved; c->saved = 0; }
+  while (c->chunk != CHUNK_END) {
+    if (c->chunk > 0) {
+      size = min (c->chunk, c->length - c->end);
+      c->end += size; if (c->chunk -= size) return 1;
+      c->chunk = CHUNK_CRLF;
+    }
+    p = c->buffer + c->end; end = c->buffer + c->length;
+    line = c->chunk == CHUNK_CRLF? p+2 : p;
+    if (line > end) return 1;
+    if (line > p && (p[0] != '\r' || p[1] != '\n')) return 0;
+    if (*(q = line_scan (line)) == '\0' || q+1 == end)
+      return end - line < 256; // wait for the rest of the line
+    if (q[1] != '\n') return 0;
+    if (c->chunk == CHUNK_TRAILER) { // trailer fields are ignored
+      if (q == line) c->chunk = CHUNK_END;
+    } else {
+      size = strtol (line, &e, 16);
+      if (e == line || size < 0 || size > 0x7fffffff
+	  || (e != q && *e != ';' && !hws (*e))) return 0;
+      c->chunk = size? size : CHUNK_TRAILER;
+    } q += 2; memmove (p, q, end - q + 1); c->length -= q - p;
+  } return 1;
 }
 
 // return data associated with HTTP message
-char *http_data (void *conn, int *length) {
-  HttpConnection *c = conn;
+char *body_data (HttpConnection *c, int *length) {
   if (c->state != HTTP_DATA) return NULL;
  top:
-  if (c->close) {
+  if (c->chunked) {
+    if (!chunk_decode (c)) { // end the message and the connection
+      c->chunk = CHUNK_END; c->close = 1; conn_close (c);
+    }
+    if (c->chunk == CHUNK_END) {
+      *length = c->end; c->state++; // HTTP_COMPLETE
+    } else if (!buffer_full (c) && http_read (c) > 0)
+      goto top;
+    else { // the decoded body is NUL terminated like the received data
+      if (c->end < c->length) {
+	c->saved = c->buffer[c->end]; c->buffer[c->end] = '\0';
+      } *length = c->end;
+    }
+  } else if (c->close) {
     if (net_status (c) == Closed) c->state++; // HTTP_COMPLETE
     http_read (c); *length = c->length;
   } else if (c->end <= c->length) {
@@ -544,27 +1252,107 @@ char *http_data (void *conn, int *length) {
   return c->data;
 }					       
 
-void http_rebuffer (void *conn, char *data) {
-  HttpConnection *c = conn; int n;
-  if (n = data - c->buffer) {
-    if (c->end) c->end -= n;
-    c->length -= n; c->data = c->buffer;
-    memmove (c->buffer, data, c->length+1);
-  }
+void body_rebuffer (HttpConnection *c, char *data) {
+  c->data = data;
+  if (c->size - c->length - 1 < c->size >> 2) http_compact (c);
+  // no progress can be made with the data in the buffer
+  if (buffer_full (c)) http_grow (c);
+}
+
+#ifdef HTTP_ZLIB
+
+/* Inflate the body received so far after the decoded data not yet consumed,
+   returns NULL when there is no more decoded data until more of the body is
+   received. The input is consumed from the receive buffer once inflated. */
+char *http_inflate (HttpConnection *c, int *length) {
+  HttpDecoder *d = c->decoder; char *in; int n, status, size;
+  if (d->ended) return NULL;
+  if (n = d->data - d->out->data) {
+    d->length -= n; memmove (d->out->data, d->data, d->length+1);
+    d->data = d->out->data;
+  } n = d->length;
+  // no progress can be made with the decoded data
+  if (d->length == d->out->size - 1 && !decoder_grow (d)) d->done = 1;
+  while (!d->done && d->length < (size = d->out->size - 1)) {
+    if (!d->z.avail_in) {
+      if (d->z.next_in) body_rebuffer (c, (char *)d->z.next_in);
+      if (!(in = body_data (c, &size))) { d->done = 1; break; }
+      if (!size) break; // wait for more of the body
+      d->z.next_in = (Bytef *)in; d->z.avail_in = size;
+      size = d->out->size - 1;
+    }
+    d->z.next_out = (Bytef *)d->out->data + d->length;
+    d->z.avail_out = size - d->length;
+    status = inflate (&d->z, Z_NO_FLUSH);
+    d->length = size - d->z.avail_out;
+    if (status != Z_OK && status != Z_BUF_ERROR) d->done = 1;
+  } d->out->data[d->length] = '\0';
+  if (d->length == n && !d->done) return NULL;
+  d->ended = d->done; *length = d->length;
+  return d->data;
+}
+
+#endif
+
+char *http_data (void *conn, int *length) { HttpConnection *c = conn;
+#ifdef HTTP_ZLIB
+  if (c->decoder) return http_inflate (c, length);
+#endif
+  return body_data (c, length);
+}
+
+void http_skip (void *conn) { HttpConnection *c = conn;
+  if (c->state == HTTP_DATA) c->skip = 1;
+}
+
+void http_rebuffer (void *conn, char *data) { HttpConnection *c = conn;
+#ifdef HTTP_ZLIB
+  if (c->decoder) { c->decoder->data = data; return; }
+#endif
+  body_rebuffer (c, data);
 }
 
+/* Find the next '\r' or the NUL terminator, 16 bytes at a time using the
+   Block operations of the XML tokenizer when they are available. */
+
+#ifdef MASK_BITS
+
+#if defined (__SSE2__)
+#define block_or _mm_or_si128
+#else
+#define block_or vorrq_u8
+#endif
+
+static inline uint64_t line_stop (Block x) {
+  return block_mask (block_or (block_eq (x, '\r'), block_eq (x, '\0')));
+}
+
+char *line_scan (char *data) block_scan (data, line_stop)
+
+#else
+
+char *line_scan (char *data) {
+  while (*data && *data != '\r') data++;
+  return data;
+}
+
+#endif
+
 // return next complete line in message or NULL
+// (the buffer may move when read, so an index is used)
 static char *next_line (HttpConnection *h) {
-  int c; char *data = h->data;
+  char *cr; int i = 0;
  top:
-  while ((c = *data)) {
-    if (c == '\r' && *(data+1) == '\n') {
-      *data = '\0';
-      return data+2;
-    }
-    data++;
-  } if (http_read (h) > 0) goto top;
-  if (data != h->data || h->state != HTTP_START)
+  while (*(cr = line_scan (h->data+i)) == '\r') {
+    i = cr - h->data;
+    if (cr[1] == '\n') {
+      *cr = '\0'; return cr+2;
+    } if (!cr[1]) goto more; // CRLF split between reads
+    i++;
+  } i = cr - h->data;
+ more:
+  if (http_read (h) > 0) goto top;
+  if (i || h->state != HTTP_START)
     set_timeout (h);
   return NULL;
 }
@@ -576,24 +1364,48 @@ static char *next_line (HttpConnection *h) {
 #define HTTP_CONTENT_LENGTH 8
 #define HTTP_CONNECTION 16
 #define HTTP_LOCATION 32
+#define HTTP_ETAG 64
+#define HTTP_LAST_MODIFIED 128
+
+const char * const http_headers[] =
+  {"host", "accept", "content-type", "content-length", "connection",
+   "location", "etag", "last-modified"};
+
+/* The header field names are matched with a minimal perfect hash of the
+   length and two characters, followed by one case insensitive compare.
+   Returns 8 for an unknown field name. */
+int header_index (const char *name) {
+  const int8_t slots[8] = {4, 6, 1, 7, 2, 5, 3, 0};
+  int n = strlen (name), i;
+  if (n < 4) return 8;
+  i = slots[(n*6 + (name[0] | 32) + (name[n-3] | 32)) & 7];
+  return strcasecmp (name, http_headers[i])? 8 : i;
+}
 
 // receive an HTTP message
 int http_receive (void *conn) {
   HttpConnection *c = conn; HttpRequest *r; Uri uri; int i;
-  const char * const headers[] = {"host", "accept", "content-type",
-				  "content-length", "connection",
-				  "location"}; 
   char *header, *method, *target, *text, *data, *next;
   while (1) {
     switch (c->state) {
     case HTTP_START: // request/status line
-      ok_v (next = next_line (c), HTTP_NONE); data = c->data;
+      http_buffer (c);
+      // make room for the headers (a pipelined message may start anywhere)
+      if (c->size - c->length - 1 < c->size >> 2) http_compact (c);
+      if (!(next = next_line (c))) { http_idle (c); return HTTP_NONE; }
+      data = c->data;
       if (*data == '\0') break; // allow empty lines to start
       if (c->debug) printf ("<-- conn = %p ---\n"
 			    "%s\r\n", c, data);
       c->close = c->end = c->header = c->error = 0;
-      c->content_type = c->media_range = NULL; c->body = 1;
-      c->content_length = -1;
+      c->content_type = c->media_range = c->location = NULL;
+      c->etag = c->modified = NULL; c->body = 1;
+      c->content_length = -1; c->chunked = c->chunk = c->saved = 0;
+      c->skip = 0;
+#ifdef HTTP_ZLIB
+      c->coded = 0;
+      if (c->decoder) { decoder_end (c->decoder); c->decoder = NULL; }
+#endif
       if (c->client) {
 	if ((data = token_sp (&text, data))
 	    && streq (text, c->version) // status line
@@ -602,9 +1414,13 @@ int http_receive (void *conn) {
 	    && c->status <= 999
 	    && (r = dequeue_request (c))
 	    && request_target (c, r->uri)) {
+	  c->latency = replay_value (stat_now () - r->time);
+	  if (se_stats) stat_record (STAT_HTTP_RESPONSE, c->latency);
+	  c->queued = r->time; c->wait = r->wait;
 	  c->context = r->context;
 	  c->method = HTTP_RESPONSE;
-	  c->request_method = r->method; free (r);
+	  c->request_method = r->method; free_request (r);
+	  http_release (c);
 	} else goto close;
       } else if ((data = token_sp (&method, data))
 		 && (data = token_sp (&target, data))
@@ -622,15 +1438,25 @@ int http_receive (void *conn) {
 	  if (c->method == HTTP_RESPONSE) goto close;
 	  http_error (c, c->error); return HTTP_ERROR;
 	}
+	if (c->chunked) { // the chunked coding overrides the Content-Length
+	  c->header &= ~HTTP_CONTENT_LENGTH; c->end = 0;
+	  c->content_length = -1;
+	}
 	if ((c->method == HTTP_RESPONSE
 	     && ((c->header & HTTP_CONTENT_LENGTH && !c->end)
 		 || ((c->status >= 100 && c->status <= 199)
 		     || c->status == 204 || c->status == 304)))
-	     || (c->method != HTTP_RESPONSE && !c->end)) {
+	     || (c->method != HTTP_RESPONSE && !c->end && !c->chunked)) {
 	  // response or request with no body
 	  c->body = 0; c->state = HTTP_COMPLETE;
 	} else { c->state++; // HTTP_DATA
-	  if (!c->end) c->close = 1; // close-delimited message
+	  if (!c->end && !c->chunked) c->close = 1; // close-delimited
+#ifdef HTTP_ZLIB
+	  if (c->coded && !(c->decoder = decoder_new ())) {
+	    if (c->method == HTTP_RESPONSE) goto close;
+	    http_error (c, 500); return HTTP_ERROR;
+	  }
+#endif
 	}
 	c->end += next - c->buffer; // message end	
 	c->data = next;
@@ -638,7 +1464,7 @@ int http_receive (void *conn) {
       case ' ': case '\t': c->error = 400; break; // obsolete line folding
       default:
 	if (data = token_colon (&header, data)) {
-	  i = string_index (to_lower (header), headers, 6);
+	  i = header_index (header);
 	  c->header |= 1 << i;
 	  switch (i) {
 	  case 0: // Host
@@ -658,18 +1484,45 @@ int http_receive (void *conn) {
 	      c->close = streq (to_lower (text), "close");
 	    break;
 	  case 5: // Location
-	    c->location = data;
+	    c->location = data; break;
+	  case 6: // ETag
+	    c->etag = data; break;
+	  case 7: // Last-Modified
+	    c->modified = data; break;
+	  default:
+	    if (!c->client && !strcasecmp (header, "if-none-match"))
+	      c->etag = data;
+	    else if (!strcasecmp (header, "transfer-encoding")) {
+	      // only the chunked coding is supported
+	      if ((data = token (&text, data)) && data - text == 7
+		  && !strncasecmp (text, "chunked", 7) && *ows (data) == '\0')
+		c->chunked = 1;
+	      else c->error = 501;
+	    }
+#ifdef HTTP_ZLIB
+	    else if (!strcasecmp (header, "content-encoding")
+		     && (data = token (&text, data))) {
+	      to_lower (text);
+	      if (streq (text, "gzip") || streq (text, "x-gzip")
+		  || streq (text, "deflate")) c->coded = 1;
+	      else if (!streq (text, "identity")) c->error = 415;
+	    }
+#endif
 	  }
 	} else c->error = 400;
       } break;
-    case HTTP_DATA: return c->method;
+    case HTTP_DATA:
+      if (!c->skip) return c->method;
+      while ((data = body_data (c, &i)) && i) body_rebuffer (c, data+i);
+      if (c->state == HTTP_DATA) return HTTP_NONE;
+      continue;
     case HTTP_COMPLETE:
       if (!c->close) {
-	http_rebuffer (c, c->buffer + c->end);
+	c->data = c->buffer + c->end;
 	c->state = HTTP_START; continue;
       } c->state++;
     case HTTP_CLOSED:
-      return HTTP_NONE;
+      http_drop (c); return HTTP_NONE;
     }
     c->data = next;
   }
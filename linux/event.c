@@ -3,15 +3,45 @@
 
 #include <errno.h>
 
-int event_poll (void **any, int timeout) {
-  PollEvent *pe; TcpPort *p; uint64_t value;
-  static struct epoll_event events[MAX_EVENTS];
-  static int i = 0, n = 0; int event;
-  static PollEvent *prev = NULL;
-  if (prev) {
-    if (!event_done (prev)) queue_add (&_active, prev);
-    prev = NULL;
+/* ports returned by the last call to event_poll or event_poll_n, these are
+   placed back on the active queue if there is more input to read */
+THREAD_LOCAL PollEvent **_returned = NULL;
+THREAD_LOCAL int _n_returned = 0, _returned_size = 0;
+
+#define prev_add(pe) (_returned[_n_returned++] = pe)
+#define prev_clear() (_n_returned--)
+
+void requeue_prev (int count) { int j;
+  for (j = 0; j < _n_returned; j++)
+    if (!event_done (_returned[j])) queue_add (&_active, _returned[j]);
+  _n_returned = 0;
+  if (count > _returned_size) { _returned_size = count;
+    _returned = realloc (_returned, sizeof (PollEvent *) * count);
+  }
+}
+
+#ifdef IO_URING
+
+#include "uring_event.c"
+
+#else
+
+THREAD_LOCAL struct epoll_event *_events = NULL;
+THREAD_LOCAL int _batch = MAX_EVENTS, _ev_i = 0, _ev_n = 0;
+
+#define events_pending() (_ev_i < _ev_n)
+
+void event_batch (int size) {
+  if (size > 0 && _ev_i == _ev_n) {
+    _events = realloc (_events, sizeof (struct epoll_event) * size);
+    _batch = size;
   }
+}
+
+int _event_poll (void **any, int timeout) {
+  PollEvent *pe, *prev; TcpPort *p; uint64_t value;
+  struct epoll_event *events = _events; int i = _ev_i, n = _ev_n, event;
+  int64_t t;
  poll:
   if (i == n) {
     if (pe = queue_remove (&_active)) {
@@ -21,32 +51,40 @@ int event_poll (void **any, int timeout) {
       case TCP_ACCEPT: case TCP_CONNECT:
 	pe->type = TCP_PORT;
       case TCP_PORT: case UDP_PORT:
-	prev = pe;
+	prev_add (pe);
       } *any = pe; return event;
     }
-  retry:
-    n = epoll_wait (poll_fd, events, MAX_EVENTS, timeout); i = 0;
+  retry: if (_race_closed) race_free ();
+    t = stat_begin ();
+    n = epoll_wait (poll_fd, events, _batch, timeout); i = 0;
+    stat_end (STAT_EVENT_POLL, t);
     if (n < 0) goto retry; // perror ("event_poll");
-    if (n == 0) return POLL_TIMEOUT;
+    if (n == 0) { _ev_i = _ev_n = 0; return POLL_TIMEOUT; }
   }
   event = events[i].events; *any = pe = events[i].data.ptr; i++;
+  _ev_i = i; _ev_n = n;
   // printf ("event_poll %x %p %d\n", event, pe, pe->type);
   switch (pe->type) {
   case TCP_CONNECT: p = *any;
+    if (p->owner) { // an attempt of net_connect_any
+      race_event (p, event & EPOLLOUT,
+		  event & (EPOLLERR | EPOLLRDHUP | EPOLLHUP));
+      goto poll;
+    }
     if (event & EPOLLOUT && bsd_connected (pe->socket)) {
       clear_timeout (pe);
       pe->status = Connected; pe->type = TCP_PORT;
-      prev = pe; return TCP_CONNECT;
+      prev_add (pe); return TCP_CONNECT;
     }
     if (event & EPOLLRDHUP || event & EPOLLHUP)
       net_close (*any);
     goto poll;
-  case TCP_PORT: prev = pe;
+  case TCP_PORT: prev_add (pe);
     clear_timeout (pe);
     if (event & EPOLLIN)
       return TCP_PORT;
     if (event & EPOLLRDHUP || event & EPOLLHUP) {
-      pe->status = Closed; prev = NULL;
+      pe->status = Closed; prev_clear ();
       return TCP_CLOSED;
     } break;
   accept:
@@ -54,14 +92,44 @@ int event_poll (void **any, int timeout) {
     if (prev = accept_queued (pe)) {
       queue_add (&_active, pe);
       prev->type = TCP_PORT;
-      *any = prev;
+      *any = prev_add (prev);
       return TCP_ACCEPT;
     } goto poll;
   case TIMER_EVENT:
     read (pe->fd, &value, 8);
-    if (pe->id == TCP_TIMEOUT)
-      *any = tcp_expired ();
+    if (pe->id == TCP_TIMEOUT && !(*any = tcp_expired ()))
+      goto poll; // the earliest timeout was cleared
     return pe->id;
   }
   return pe->type;
 }
+
+#endif
+
+int event_poll (void **any, int timeout) { int event;
+  if (replay_playing ()) return replay_event (any);
+  requeue_prev (1);
+  if (!_replay) return _event_poll (any, timeout);
+  fflush (_replay_file); // the log is complete up to a wait
+  event = _event_poll (any, timeout);
+  putc ('E', _replay_file); record_event (event, *any);
+  return event;
+}
+
+int event_poll_n (EventItem *items, int count, int timeout) {
+  int k = 0, event;
+  if (replay_playing ()) return replay_batch (items, count);
+  requeue_prev (count);
+  if (_replay) fflush (_replay_file);
+  while (k < count) {
+    // only wait on the first event, and only one system call per batch
+    if (k && !events_pending () && !queue_peek (&_active)) break;
+    event = _event_poll (&items[k].any, k? 0 : timeout);
+    if (event == POLL_TIMEOUT) break;
+    items[k++].type = event;
+  }
+  if (_replay) { int i;
+    putc ('B', _replay_file); replay_put (k);
+    for (i = 0; i < k; i++) record_event (items[i].type, items[i].any);
+  } return k;
+}
@@ -8,6 +8,8 @@
 #include <stdio.h>
 #include <string.h>
 #include <dirent.h>
+#include <sys/mman.h>
+#include <unistd.h>
 
 int file_type (const char *name) {
   struct stat sb;
@@ -19,6 +21,35 @@ int file_type (const char *name) {
   } return FILE_NONE;
 }
 
+void *file_map (const char *name, int *length) {
+  struct stat sb; void *data; int fd = open (name, O_RDONLY);
+  if (fd < 0) return NULL;
+  if (fstat (fd, &sb) < 0 || sb.st_size == 0) { close (fd); return NULL; }
+  data = mmap (NULL, sb.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+  close (fd); if (data == MAP_FAILED) return NULL;
+  *length = sb.st_size; return data;
+}
+
+void file_unmap (void *data, int length) { munmap (data, length); }
+
+int file_stat (const char *name, int64_t *mtime, int64_t *size) {
+  struct stat sb; if (stat (name, &sb) < 0) return 0;
+  *mtime = sb.st_mtim.tv_sec * 1000000000ll + sb.st_mtim.tv_nsec;
+  *size = sb.st_size; return 1;
+}
+
+int file_open (const char *name, int64_t *mtime, int64_t *size) {
+  struct stat sb; int fd = open (name, O_RDONLY);
+  if (fd < 0) return -1;
+  if (fstat (fd, &sb) < 0 || (sb.st_mode & S_IFMT) != S_IFREG) {
+    close (fd); return -1;
+  }
+  *mtime = sb.st_mtim.tv_sec * 1000000000ll + sb.st_mtim.tv_nsec;
+  *size = sb.st_size; return fd;
+}
+
+void file_close (int fd) { close (fd); }
+
 void process_dir (const char *name, void *ctx,
 		  void (*func) (const char *, void *ctx)) {
   DIR *dp = opendir (name); char path[128];
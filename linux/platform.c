@@ -4,11 +4,13 @@
 #include <sys/types.h>
 #include <sys/socket.h>
 #include <sys/ioctl.h>
+#include <sys/uio.h>
 #include <sys/epoll.h>
 #include <unistd.h>
 #include <fcntl.h>
 #include <signal.h>
 #include <time.h>
+#include <malloc.h>
 
 #define print_error(func) perror (func)
 
@@ -25,18 +27,26 @@ typedef struct _PollEvent {
   unsigned status : 2; // connection status
   unsigned wait : 1;
   union { int socket; int fd; };
+  int rid; // record/replay ID (see replay.c)
+#ifdef IO_URING
+  int slot; // see uring.c
+#endif
 } PollEvent;
 
-#define MAX_EVENTS 10
+#define MAX_EVENTS 64
 #define TCP_ACCEPTOR SYSTEM_EVENT
 
-int poll_fd;
-Timer *_tcp_timer;
+THREAD_LOCAL int poll_fd;
+THREAD_LOCAL Timer *_tcp_timer;
 
-void platform_init () {
-  poll_fd = epoll_create (MAX_EVENTS);
-  _tcp_timer = add_timer (TCP_TIMEOUT);
-  signal (SIGPIPE, SIG_IGN);
+int64_t heap_usage () {
+#if __GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33)
+  struct mallinfo2 m = mallinfo2 ();
+#else
+  struct mallinfo m = mallinfo ();
+#endif
+  // small blocks in the arenas and large blocks mapped separately
+  return (int64_t)m.uordblks + m.hblkhd;
 }
 
 void non_block_enable (int fd) {
@@ -47,6 +57,12 @@ int event_done (void *any) {
   PollEvent *pe = any; return pe->end;
 }
 
+#ifdef IO_URING
+
+#include "uring.c"
+
+#else
+
 void event_add (int fd, void *data) {
   struct epoll_event ev;
   non_block_enable (fd);
@@ -56,8 +72,23 @@ void event_add (int fd, void *data) {
   epoll_ctl (poll_fd, EPOLL_CTL_ADD, fd, &ev);
 }
 
-Queue _active = {0};
+#define tcp_add event_add
+
+#endif
+
+void platform_init () {
+#ifdef IO_URING
+  uring_init ();
+#else
+  poll_fd = epoll_create (MAX_EVENTS); event_batch (MAX_EVENTS);
+#endif
+  _tcp_timer = add_timer (TCP_TIMEOUT);
+  signal (SIGPIPE, SIG_IGN);
+}
+
+THREAD_LOCAL Queue _active = {0};
 
+#include "replay.c"
 #include "time.c"
 #include "timer.c"
 #include "tcp.c"
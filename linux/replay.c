@@ -0,0 +1,189 @@
+// Copyright (c) 2018 Electric Power Research Institute, Inc.
+// author: Mark Slicker <mark.slicker@gmail.com>
+
+/* Record/replay of the event loop input (see the replay group in
+   platform.c). A log begins with REPLAY_MAGIC followed by records that each
+   begin with a tag, numbers are varints (zigzag encoded when signed):
+   E <event> <id>              an event_poll result
+   B <count> (<event> <id>)*   an event_poll_n result
+   R <id> <n> [data]           a net_read, n < 0 when there is no data
+   U <id> <n> <address> [data] a net_receive
+   T <time>                    se_time, when it changes
+   V <value>                   a replay_value
+   The id of an object is the order in which it was registered with
+   replay_add (from 1), 0 for an object registered before recording. */
+
+#include <errno.h>
+
+#define REPLAY_MAGIC "EPRI-REPLAY 1\n"
+
+THREAD_LOCAL int _replay = REPLAY_OFF, _replay_tag = -1;
+THREAD_LOCAL FILE *_replay_file = NULL;
+THREAD_LOCAL PollEvent **_replay_objs = NULL;
+THREAD_LOCAL int _replay_ids = 0, _replay_size = 0;
+THREAD_LOCAL int64_t _replay_time = 0, _replay_start = 0, _replay_stop = 0;
+THREAD_LOCAL uint64_t _replay_events = 0, _replay_reads = 0,
+  _replay_bytes = 0;
+
+#define replay_playing() (_replay == REPLAY_PLAY)
+#define replay_id(pe) ((pe)? ((PollEvent *)(pe))->rid : 0)
+
+int replay_mode () { return _replay; }
+
+void replay_put (uint64_t x) { FILE *f = _replay_file;
+  while (x >= 0x80) { putc ((x & 0x7f) | 0x80, f); x >>= 7; }
+  putc (x, f);
+}
+
+void replay_put_int (int64_t x) {
+  replay_put ((uint64_t)x << 1 ^ (uint64_t)(x >> 63));
+}
+
+uint64_t replay_get () { uint64_t x = 0; int c, shift = 0;
+  while ((c = getc (_replay_file)) != EOF) {
+    x |= (uint64_t)(c & 0x7f) << shift; shift += 7;
+    if (!(c & 0x80)) break;
+  } return x;
+}
+
+int64_t replay_get_int () { uint64_t x = replay_get ();
+  return (int64_t)(x >> 1) ^ -(int64_t)(x & 1);
+}
+
+// the tag of the next record, the record is consumed with replay_take
+int replay_tag () {
+  if (_replay_tag < 0) _replay_tag = getc (_replay_file);
+  return _replay_tag;
+}
+
+#define replay_take() (_replay_tag = -1)
+
+// end the replay, a record other than the one expected is a divergence
+void replay_stop (const char *what) {
+  if (_replay_stop) return;
+  if (replay_tag () != EOF)
+    log_warn ("replay: %s diverged from the log at byte %ld\n", what,
+	      ftell (_replay_file) - 1);
+  _replay_stop = stat_now ();
+}
+
+int replay_expect (int tag, const char *what) {
+  if (_replay_stop) return 0;
+  if (replay_tag () == tag) { replay_take (); return 1; }
+  replay_stop (what); return 0;
+}
+
+// assign the next ID to an object as it is registered with the platform
+void replay_add (PollEvent *pe) {
+  if (!_replay) { pe->rid = 0; return; }
+  pe->rid = ++_replay_ids;
+  if (replay_playing ()) {
+    if (_replay_ids >= _replay_size) {
+      _replay_size = _replay_size? _replay_size << 1 : 64;
+      _replay_objs = realloc (_replay_objs,
+			      sizeof (PollEvent *) * _replay_size);
+    } _replay_objs[_replay_ids] = pe;
+  }
+}
+
+int replay_record (const char *name) {
+  if (!(_replay_file = fopen (name, "wb"))) return 0;
+  fputs (REPLAY_MAGIC, _replay_file);
+  _replay = REPLAY_RECORD; return 1;
+}
+
+int replay_open (const char *name) {
+  char magic[sizeof (REPLAY_MAGIC)] = {0};
+  if (!(_replay_file = fopen (name, "rb"))) return 0;
+  if (fread (magic, 1, sizeof (REPLAY_MAGIC) - 1, _replay_file)
+      != sizeof (REPLAY_MAGIC) - 1 || strcmp (magic, REPLAY_MAGIC)) {
+    fclose (_replay_file); _replay_file = NULL; return 0;
+  }
+  _replay = REPLAY_PLAY; _replay_start = stat_now (); return 1;
+}
+
+void record_event (int event, void *any) {
+  replay_put (event); replay_put (event == POLL_TIMEOUT? 0 : replay_id (any));
+}
+
+// read an event, and make the state changes event_poll would have made
+int replay_item (void **any) {
+  int event = replay_get (), id = replay_get (); PollEvent *pe;
+  if (id > _replay_ids) { replay_stop ("event_poll"); return REPLAY_END; }
+  if (event == POLL_TIMEOUT) return event;
+  *any = pe = id? _replay_objs[id] : NULL;
+  if (pe) switch (event) {
+    case TCP_CONNECT: case TCP_ACCEPT:
+      pe->type = TCP_PORT; pe->status = Connected;
+    case TCP_PORT: case UDP_PORT: pe->end = 0; break;
+    case TCP_CLOSED: pe->status = Closed; pe->end = 1;
+    }
+  _replay_events++; return event;
+}
+
+int replay_event (void **any) {
+  if (!replay_expect ('E', "event_poll")) return REPLAY_END;
+  return replay_item (any);
+}
+
+int replay_batch (EventItem *items, int count) { int k, n;
+  if (!replay_expect ('B', "event_poll_n")) n = 0;
+  else if ((n = replay_get ()) > count) {
+    replay_stop ("event_poll_n"); n = 0;
+  }
+  for (k = 0; k < n; k++) items[k].type = replay_item (&items[k].any);
+  if (!_replay_stop) return n;
+  items[0].type = REPLAY_END; return 1;
+}
+
+// record the input read from an object, along with its source address
+void record_input (int tag, PollEvent *pe, const char *data, int n,
+		   const void *addr, int addr_length) {
+  putc (tag, _replay_file); replay_put (pe->rid); replay_put_int (n);
+  if (n < 0) return;
+  fwrite (addr, 1, addr_length, _replay_file);
+  fwrite (data, 1, n, _replay_file);
+}
+
+int replay_input (int tag, PollEvent *pe, char *buffer, int size,
+		  void *addr, int addr_length) { int n;
+  if (!replay_expect (tag, tag == 'R'? "net_read" : "net_receive")) n = -1;
+  else if (replay_get () != pe->rid || (n = replay_get_int ()) > size) {
+    replay_stop ("net_read"); n = -1;
+  } else if (n >= 0 && (fread (addr, 1, addr_length, _replay_file)
+			 != addr_length
+			 || fread (buffer, 1, n, _replay_file) != n)) {
+    replay_stop ("net_read"); n = -1;
+  }
+  if (n < 0) { errno = EAGAIN; return -1; }
+  _replay_reads++; _replay_bytes += n; return n;
+}
+
+int64_t replay_time (int64_t t) {
+  switch (_replay) {
+  case REPLAY_RECORD:
+    if (t != _replay_time) {
+      putc ('T', _replay_file); replay_put_int (_replay_time = t);
+    } return t;
+  case REPLAY_PLAY:
+    if (!_replay_stop && replay_tag () == 'T') {
+      replay_take (); _replay_time = replay_get_int ();
+    } return _replay_time;
+  } return t;
+}
+
+int64_t replay_value (int64_t v) {
+  switch (_replay) {
+  case REPLAY_RECORD: putc ('V', _replay_file); replay_put_int (v); break;
+  case REPLAY_PLAY:
+    if (replay_expect ('V', "replay_value")) v = replay_get_int ();
+  } return v;
+}
+
+void replay_print () {
+  int64_t ns = (_replay_stop? _replay_stop : stat_now ()) - _replay_start;
+  if (ns <= 0) ns = 1;
+  printf ("replay: %" PRIu64 " events, %" PRIu64 " reads (%" PRIu64
+	  " bytes) in %.3f s, %.0f events/s\n", _replay_events, _replay_reads,
+	  _replay_bytes, ns / 1e9, _replay_events * 1e9 / ns);
+}
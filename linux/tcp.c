@@ -3,49 +3,93 @@
 
 #include <errno.h>
 #include <time.h>
+#include <sys/sendfile.h>
 
 typedef struct _TcpPort {
   PollEvent pe;
-  struct _TcpPort *prev;
+  int index; // position in the timeout heap
   ClockTime timeout;
+  struct _TcpPort *race; // the connection attempts, or the next attempt
+  struct _TcpPort *owner; // the TcpPort of a connection attempt
+#ifdef IO_URING
+  int head, tail, offset; // received buffers (see uring_read)
+  unsigned eof : 1; // end of input received
+  unsigned starved : 1; // receive stopped for lack of buffers
+#endif
 } TcpPort;
 
 TcpPort *new_tcp_port () {
   return type_alloc (TcpPort);
 }
 
+#ifdef IO_URING
+int uring_read (TcpPort *p, char *buffer, int size);
+void uring_closed (PollEvent *pe);
+#endif
+
 typedef struct _Acceptor {
   PollEvent pe;
   Queue ports;
+#ifdef IO_URING
+  int *fds, count, size; // accepted sockets without a port
+#endif
 } Acceptor;
 
 Acceptor *net_listen (Address *address) {
   Acceptor *a = type_alloc (Acceptor);
   a->pe.type = TCP_ACCEPTOR;
-  a->pe.socket = bsd_listen (address);
+  a->pe.socket = bsd_listen (address); replay_add (&a->pe);
+#ifdef IO_URING
+  uring_slot (&a->pe); uring_accept (&a->pe);
+#else
   event_add (a->pe.socket, a);
+#endif
   return a;
 }
 
 #define event_pending(c) (errno == EAGAIN || errno == EWOULDBLOCK \
 			  || errno == EINPROGRESS)
 
+#ifdef IO_URING
+
+int accepted (TcpPort *p, Acceptor *a) {
+  if (!a->count) { a->pe.end = 1; return 0; }
+  p->pe.socket = a->fds[0];
+  memmove (a->fds, a->fds+1, sizeof (int) * --a->count);
+  p->pe.status = Connected;
+  tcp_add (p->pe.socket, p); uring_recv (&p->pe);
+  return 1;
+}
+
+#else
+
+// the socket is made non-blocking by accept4 rather than a separate fcntl
 int accepted (TcpPort *p, Acceptor *a) { Address host;
   host.length = sizeof (Address);
+#ifdef _GNU_SOURCE
+  p->pe.socket = accept4 (a->pe.socket, (struct sockaddr *)&host,
+			  &host.length, SOCK_NONBLOCK | SOCK_CLOEXEC);
+#else
   p->pe.socket = accept (a->pe.socket, (struct sockaddr *)&host,
 		      &host.length);
+#endif
   if (p->pe.socket == -1) {
     a->pe.end = 1; return 0;
   }
   p->pe.status = Connected;
-  non_block_enable (p->pe.socket); 
-  event_add (p->pe.socket, p);
+#ifndef _GNU_SOURCE
+  non_block_enable (p->pe.socket);
+#endif
+  tcp_add (p->pe.socket, p);
   return 1;
 }
 
+#endif
+
 void net_accept (void *port, Acceptor *a) {
   TcpPort *p = port;
-  p->pe.next = NULL;
+  p->pe.next = NULL; replay_add (&p->pe);
+  if (replay_playing ()) return; // accepted with the TCP_ACCEPT event
   if (accepted (p, a)) {
     p->pe.type = TCP_ACCEPT; 
     queue_add (&_active, p);
@@ -64,84 +108,154 @@ int net_status (void *port) {
   TcpPort *p = port; return p->pe.status;
 }
 
-Queue _tcp_wait = {0};
+/* Pending timeouts are kept in a binary min-heap, _tcp_armed is the deadline
+   the timer is currently armed for. The timer is only re-armed when a new
+   timeout is earlier than the armed deadline, if the earliest timeout is
+   cleared the timer is left to expire and then re-armed for the next one. */
+THREAD_LOCAL TcpPort **_tcp_heap = NULL;
+THREAD_LOCAL int _tcp_count = 0, _tcp_size = 0;
+THREAD_LOCAL ClockTime _tcp_armed = {{0}}; // zero when the timer is disarmed
 int _tcp_timeout = 10;
 
 void net_timeout (int seconds) {
   _tcp_timeout = seconds;
 }
 
-int compare_timeout (void *a, void *b) {
-  TcpPort *p1 = a, *p2 = b;
-  int diff = p1->timeout.spec.tv_sec - p2->timeout.spec.tv_sec;
-  return diff? diff : p1->timeout.spec.tv_nsec - p2->timeout.spec.tv_nsec;
+int clock_before (ClockTime *a, ClockTime *b) {
+  return a->spec.tv_sec < b->spec.tv_sec
+    || (a->spec.tv_sec == b->spec.tv_sec && a->spec.tv_nsec < b->spec.tv_nsec);
+}
+
+#define timer_armed() (_tcp_armed.spec.tv_sec || _tcp_armed.spec.tv_nsec)
+#define tcp_set(i, p) (_tcp_heap[i] = p)->index = i
+
+void arm_timeout (ClockTime *ct) {
+  if (ct) { _tcp_armed = *ct; set_timer_ct (_tcp_timer, ct); }
+  else if (timer_armed ()) {
+    memset (&_tcp_armed, 0, sizeof (ClockTime)); set_timer (_tcp_timer, 0);
+  }
+}
+
+void timeout_up (int i) { TcpPort *p = _tcp_heap[i];
+  while (i) { int j = (i - 1) >> 1;
+    if (!clock_before (&p->timeout, &_tcp_heap[j]->timeout)) break;
+    tcp_set (i, _tcp_heap[j]); i = j;
+  } tcp_set (i, p);
+}
+
+void timeout_down (int i) { TcpPort *p = _tcp_heap[i]; int c;
+  while ((c = 2*i + 1) < _tcp_count) {
+    if (c+1 < _tcp_count && clock_before (&_tcp_heap[c+1]->timeout,
+					  &_tcp_heap[c]->timeout)) c++;
+    if (!clock_before (&_tcp_heap[c]->timeout, &p->timeout)) break;
+    tcp_set (i, _tcp_heap[c]); i = c;
+  } tcp_set (i, p);
+}
+
+void timeout_remove (TcpPort *p) {
+  TcpPort *last = _tcp_heap[--_tcp_count];
+  p->pe.wait = 0;
+  if (last != p) {
+    tcp_set (p->index, last);
+    timeout_up (last->index); timeout_down (last->index);
+  }
+}
+
+// set the timeout of a port to ms milliseconds from now
+void set_deadline (TcpPort *p, int ms) {
+  clock_gettime (CLOCK_MONOTONIC, &p->timeout.spec);
+  p->timeout.spec.tv_sec += ms / 1000;
+  if ((p->timeout.spec.tv_nsec += ms % 1000 * 1000000L) >= 1000000000L) {
+    p->timeout.spec.tv_sec++; p->timeout.spec.tv_nsec -= 1000000000L;
+  }
+  if (p->pe.wait) timeout_remove (p);
+  if (_tcp_count == _tcp_size) {
+    _tcp_size = _tcp_size? _tcp_size << 1 : 16;
+    _tcp_heap = realloc (_tcp_heap, sizeof (TcpPort *) * _tcp_size);
+  }
+  p->pe.wait = 1; _tcp_heap[_tcp_count] = p; timeout_up (_tcp_count++);
+  if (!timer_armed () || clock_before (&p->timeout, &_tcp_armed))
+    arm_timeout (&p->timeout);
 }
 
 void set_timeout (void *port) {
-  TcpPort *p = port;
   // printf ("set_timeout %p\n", port);
-  clock_gettime (CLOCK_MONOTONIC, &p->timeout.spec);
-  p->timeout.spec.tv_sec += _tcp_timeout;
-  p->prev = NULL;
-  p->pe.wait = 1;
-  _queue_insert (&_tcp_wait, p, &p->prev, compare_timeout);
-  p = queue_peek (&_tcp_wait);
-  set_timer_ct (_tcp_timer, &p->timeout);
+  set_deadline (port, _tcp_timeout * 1000);
 }
 
-// remove connection from either the wait list or old list
+// remove connection from the timeout heap
 void clear_timeout (void *port) {
   TcpPort *p = port;
   // printf ("clear_timeout %p\n", port);
   if (p->pe.wait) {
-    p->pe.wait = 0;
-    if (p->prev) {
-      p->prev->pe.next = p->pe.next;
-      p->prev = NULL;
-    } else {
-      queue_remove (&_tcp_wait);
-      if (p = queue_peek (&_tcp_wait))
-	set_timer_ct (_tcp_timer, &p->timeout);
-      else set_timer (_tcp_timer, 0);
-    }
+    timeout_remove (p);
+    if (!_tcp_count) arm_timeout (NULL);
   }
 }
 
-void *tcp_expired () { TcpPort *p, *q; 
-  if (p = queue_remove (&_tcp_wait)) {
-    if (q = queue_peek (&_tcp_wait))
-      set_timer_ct (_tcp_timer, &q->timeout);
-    else set_timer (_tcp_timer, 0);
+void race_start (TcpPort *a);
+void race_timeout (TcpPort *p);
+void race_close (TcpPort *a);
+void race_end (TcpPort *p);
+
+/* Return the expired connection if any, otherwise re-arm the timer. A
+   connection attempt that is due is started (see net_connect_any). */
+void *tcp_expired () { TcpPort *p; ClockTime now;
+  memset (&_tcp_armed, 0, sizeof (ClockTime));
+  clock_gettime (CLOCK_MONOTONIC, &now.spec);
+  while (_tcp_count) { p = _tcp_heap[0];
+    if (clock_before (&now, &p->timeout)) {
+      arm_timeout (&p->timeout); return NULL;
+    } timeout_remove (p);
+    if (p->owner) { race_start (p); continue; }
+    if (p->race) race_timeout (p);
+    if (_tcp_count) arm_timeout (&_tcp_heap[0]->timeout);
     return p;
   } return NULL;
 }
 
 void net_close (void *port) {
-  PollEvent *pe = port;
-  printf ("net_close\n");
+  PollEvent *pe = port; TcpPort *p = port;
+  if (pe->type == TCP_CONNECT && p->owner) { race_close (p); return; }
+  log_debug ("net_close\n");
   switch (pe->type) {
   case TCP_CONNECT:
+    if (p->race) race_end (p);
   case TCP_PORT:
     pe->status = Closed;
     pe->type = TCP_CLOSED;
     pe->end = 1;
+    if (replay_playing ()) break; // TCP_CLOSED is replayed from the log
+#ifdef IO_URING
+    uring_closed (pe);
+#endif
     close (pe->socket);
     clear_timeout (pe);
     queue_add (&_active, pe);
     break;
   case TCP_ACCEPTOR:
+#ifdef IO_URING
+    uring_closed (pe);
+#endif
     close (pe->socket);
   }
 }
 
 void net_connect (void *port, Address *server) {
   TcpPort *p = port;
+  replay_add (&p->pe);
+  if (replay_playing ()) { // connected with the TCP_CONNECT event
+    p->pe.type = TCP_CONNECT; p->pe.status = InProgress; return;
+  }
   p->pe.socket = bsd_socket (server->family);
-  event_add (p->pe.socket, p);
+  tcp_add (p->pe.socket, p);
   p->pe.type = TCP_CONNECT;
   if (connect (p->pe.socket, (struct sockaddr *)server,
 	       server->length) == 0) {
     p->pe.status = Connected;
+#ifdef IO_URING
+    uring_recv (&p->pe);
+#endif
     queue_add (&_active, p);
   } else if (event_pending (p)) {
     set_timeout (p);
@@ -149,19 +263,207 @@ void net_connect (void *port, Address *server) {
   }
 }
 
+/* Connection attempts to the addresses of a server (RFC 8305, "happy
+   eyeballs"). An attempt starts RACE_DELAY ms after the previous one, or as
+   soon as the previous one fails. The first attempt to connect hands its
+   socket to the TcpPort and the other attempts are closed. An attempt is
+   pending until started (no socket), and closed once it fails or loses. */
+#define RACE_DELAY 250
+#define RACE_MAX 8 // addresses raced
+#define FAILED_TIME 600 // seconds an address that failed is tried last
+#define FAILED_MAX 16
+
+typedef struct {
+  TcpPort port; Address server; int rank; // the order of the attempts
+} Attempt;
+
+typedef struct {
+  Address addr; time_t time;
+} FailedAddress;
+
+THREAD_LOCAL FailedAddress _failed[FAILED_MAX];
+THREAD_LOCAL int _n_failed = 0;
+THREAD_LOCAL PollEvent *_race_closed = NULL; // closed attempts to free
+
+#define race_server(a) (&((Attempt *)(a))->server)
+#define race_pending(a) ((a)->pe.status != Closed && (a)->pe.socket < 0)
+
+FailedAddress *find_failed (Address *addr) { int i;
+  for (i = 0; i < _n_failed; i++)
+    if (address_eq (&_failed[i].addr, addr)) return &_failed[i];
+  return NULL;
+}
+
+int address_failed (Address *addr) { FailedAddress *f = find_failed (addr);
+  return f && f->time + FAILED_TIME > time (NULL);
+}
+
+// remember an address that failed, in place of the oldest when full
+void race_failed (Address *addr) { FailedAddress *f; int i;
+  if (!(f = find_failed (addr))) {
+    if (_n_failed < FAILED_MAX) f = &_failed[_n_failed++];
+    else for (f = _failed, i = 1; i < FAILED_MAX; i++)
+	   if (_failed[i].time < f->time) f = &_failed[i];
+    address_copy (&f->addr, addr);
+  } f->time = time (NULL);
+}
+
+void race_forget (Address *addr) { FailedAddress *f = find_failed (addr);
+  if (f) *f = _failed[--_n_failed];
+}
+
+void race_close (TcpPort *a) {
+  if (a->pe.status == Closed) return;
+  a->pe.status = Closed; clear_timeout (a);
+  if (a->pe.socket >= 0) {
+#ifdef IO_URING
+    uring_closed (&a->pe);
+#endif
+    close (a->pe.socket); a->pe.socket = -1;
+  }
+}
+
+/* End the race of a TcpPort. The attempts are freed before the next wait for
+   events (see race_free), as events for them may be pending. */
+void race_end (TcpPort *p) { TcpPort *a, *next;
+  for (a = p->race; a; a = next) { next = a->race;
+    race_close (a); a->pe.next = _race_closed; _race_closed = &a->pe;
+  } p->race = NULL;
+}
+
+void race_free () { PollEvent *pe;
+  while (pe = _race_closed) { _race_closed = pe->next; free (pe); }
+}
+
+// an attempt failed, start the next attempt now or close the TcpPort
+void race_fail (TcpPort *a) { TcpPort *p = a->owner, *t;
+  race_failed (race_server (a)); race_close (a);
+  for (t = p->race; t && t->pe.status == Closed; t = t->race);
+  if (!t) { race_end (p); net_close (p); return; }
+  for (t = p->race; t; t = t->race)
+    if (race_pending (t)) { race_start (t); break; }
+}
+
+void race_start (TcpPort *a) { Address *server = race_server (a); TcpPort *t;
+  clear_timeout (a);
+  if ((a->pe.socket = bsd_socket (server->family)) < 0) {
+    race_fail (a); return;
+  } tcp_add (a->pe.socket, a);
+  if (connect (a->pe.socket, (struct sockaddr *)server, server->length)
+      && !event_pending (a)) { race_fail (a); return; }
+  for (t = a->race; t; t = t->race)
+    if (race_pending (t)) { set_deadline (t, RACE_DELAY); break; }
+}
+
+// the first attempt to connect gives its socket to the TcpPort
+void race_won (TcpPort *a) { TcpPort *p = a->owner; int fd = a->pe.socket;
+#ifdef IO_URING
+  uring_closed (&a->pe);
+#else
+  epoll_ctl (poll_fd, EPOLL_CTL_DEL, fd, NULL);
+#endif
+  a->pe.socket = -1; race_forget (race_server (a)); race_end (p);
+  clear_timeout (p);
+  p->pe.socket = fd; p->pe.status = Connected; tcp_add (fd, p);
+#ifdef IO_URING
+  uring_recv (&p->pe);
+#endif
+  queue_add (&_active, p);
+}
+
+void race_event (TcpPort *a, int writable, int closed) {
+  if (a->pe.status == Closed) return;
+  if (writable && bsd_connected (a->pe.socket)) race_won (a);
+  else if (closed) race_fail (a);
+}
+
+// the TcpPort timed out, the attempts that were started failed
+void race_timeout (TcpPort *p) { TcpPort *a;
+  for (a = p->race; a; a = a->race)
+    if (a->pe.status != Closed && a->pe.socket >= 0)
+      race_failed (race_server (a));
+  race_end (p);
+}
+
+void net_connect_any (void *port, Address *servers, int n) {
+  TcpPort *p = port, **last; Attempt *t; int i, j, k, all = 1;
+  if (n < 2 || replay_playing ()) { net_connect (port, servers); return; }
+  n = min (n, RACE_MAX); replay_add (&p->pe);
+  p->pe.type = TCP_CONNECT; p->pe.status = InProgress; p->pe.socket = -1;
+#ifdef IO_URING
+  p->pe.slot = -1;
+#endif
+  for (i = 0; i < n; i++) all &= address_failed (&servers[i]);
+  p->race = NULL;
+  for (i = 0; i < n; i++) {
+    t = type_alloc (Attempt); memset (t, 0, sizeof (Attempt));
+    t->port.owner = p; t->port.pe.type = TCP_CONNECT;
+    t->port.pe.status = InProgress; t->port.pe.socket = -1;
+    address_copy (&t->server, &servers[i]);
+    // IPv6 first then alternating families, the addresses that failed last
+    for (j = k = 0; j < i; j++) k += servers[j].family == servers[i].family;
+    t->rank = k * 2 + (servers[i].family != ADDR_IPv6)
+      + (!all && address_failed (&servers[i])) * 2 * RACE_MAX;
+    for (last = &p->race; *last && ((Attempt *)*last)->rank <= t->rank;
+	 last = &(*last)->race);
+    t->port.race = *last; *last = &t->port;
+  } set_timeout (p); race_start (p->race);
+}
+
 int net_read (void *port, char *buffer, int size) {
   TcpPort *p = port; int n = -1;
   if (p->pe.status == Connected) {
-    n = read (p->pe.socket, buffer, size);
+    if (replay_playing ())
+      n = replay_input ('R', &p->pe, buffer, size, NULL, 0);
+    else {
+#ifdef IO_URING
+      n = uring_read (p, buffer, size);
+#else
+      n = read (p->pe.socket, buffer, size);
+#endif
+      if (_replay) record_input ('R', &p->pe, buffer, n, NULL, 0);
+    }
     if (n == 0) net_close (p);
   } p->pe.end = n <= 0;
   return n;
 }
 
+void net_hold (void *port) {
+  TcpPort *p = port; p->pe.end = 1;
+}
+
+void net_resume (void *port) {
+  TcpPort *p = port;
+  if (p->pe.type == TCP_PORT && p->pe.end) {
+    p->pe.end = 0; queue_add (&_active, p);
+  }
+}
+
 int net_write (void *port, const char *data, int length) {
   TcpPort *p = port;
-  return p->pe.status == Connected?
-    write (p->pe.socket, data, length) : -1;
+  if (p->pe.status != Connected) return -1;
+  if (replay_playing ()) return length;
+  return write (p->pe.socket, data, length);
+}
+
+int net_writev (void *port, const DataSegment *seg, int n) {
+  TcpPort *p = port; struct iovec iov[16]; int i, length;
+  if (p->pe.status != Connected) return -1;
+  if (n > 16) n = 16;
+  if (replay_playing ()) {
+    for (i = 0, length = 0; i < n; i++) length += seg[i].length;
+    return length;
+  }
+  for (i = 0; i < n; i++) {
+    iov[i].iov_base = (void *)seg[i].data; iov[i].iov_len = seg[i].length;
+  } return writev (p->pe.socket, iov, n);
+}
+
+int net_sendfile (void *port, int fd, int64_t offset, int length) {
+  TcpPort *p = port; off_t off = offset;
+  if (p->pe.status != Connected) return -1;
+  if (replay_playing ()) return length;
+  return sendfile (p->pe.socket, fd, &off, length);
 }
 
 Address *net_remote (Address *addr, void *port) {
@@ -2,6 +2,7 @@
 // author: Mark Slicker <mark.slicker@gmail.com>
 
 #include <sys/timerfd.h>
+#include <sys/eventfd.h>
 
 typedef struct _Timer {
   PollEvent pe;
@@ -42,6 +43,10 @@ void set_timer_ct (Timer *timer, ClockTime *ct) {
     t.tv_sec--;
     t.tv_nsec = diff + 1000000000;
   }
+  // a zero value disarms the timer, expire as soon as possible instead
+  if (t.tv_sec < 0 || (t.tv_sec == 0 && t.tv_nsec == 0)) {
+    t.tv_sec = 0; t.tv_nsec = 1;
+  }
   memcpy (&it.it_value, &t, sizeof (struct timespec));
   timerfd_settime (timer->pe.fd, 0, &it, NULL);
 }
@@ -51,9 +56,23 @@ Timer *add_timer (int id) {
   timer->pe.type = TIMER_EVENT; timer->pe.id = id;
   timer->pe.fd = timerfd_create (CLOCK_MONOTONIC, 0);
   timer->pe.end = 1; event_add (timer->pe.fd, timer);
+  replay_add (&timer->pe);
   return timer;
 }
 
+Timer *add_notify (int id) {
+  Timer *timer = malloc (sizeof (Timer));
+  timer->pe.type = TIMER_EVENT; timer->pe.id = id;
+  timer->pe.fd = eventfd (0, 0);
+  timer->pe.end = 1; event_add (timer->pe.fd, timer);
+  replay_add (&timer->pe);
+  return timer;
+}
+
+void notify (Timer *timer) {
+  uint64_t one = 1; write (timer->pe.fd, &one, 8);
+}
+
 Timer *new_timer (int id, int timeout) {
   Timer *timer = add_timer (id);
   set_timer (timer, timeout); return timer;
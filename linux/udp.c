@@ -1,14 +1,72 @@
 // Copyright (c) 2015 Electric Power Research Institute, Inc.
 // author: Mark Slicker <mark.slicker@gmail.com>
 
+#define UDP_BATCH 16 // datagrams received / sent per system call
+
 typedef struct _UdpPort {
   PollEvent pe;
   Address source;
-  int size;
+  int size, count, next; // datagrams received, next datagram to return
+#ifdef _GNU_SOURCE
+  struct mmsghdr msg[UDP_BATCH];
+  struct iovec iov[UDP_BATCH];
+  Address from[UDP_BATCH];
+#endif
   char buffer[];
 } UdpPort;
 
-char *net_receive (UdpPort *p, int *length) {
+#ifdef _GNU_SOURCE
+
+// receive up to UDP_BATCH datagrams with a single recvmmsg
+int udp_fill (UdpPort *p) { int i, n;
+  for (i = 0; i < UDP_BATCH; i++) {
+    struct msghdr *h = &p->msg[i].msg_hdr;
+    p->iov[i].iov_base = p->buffer + i * p->size;
+    p->iov[i].iov_len = p->size;
+    memset (h, 0, sizeof (struct msghdr));
+    h->msg_name = &p->from[i]; h->msg_namelen = sizeof (Address);
+    h->msg_iov = &p->iov[i]; h->msg_iovlen = 1;
+  }
+  n = recvmmsg (p->pe.socket, p->msg, UDP_BATCH, 0, NULL);
+  p->next = 0; return p->count = n < 0? 0 : n;
+}
+
+char *udp_receive (UdpPort *p, int *length) { int i;
+  if (p->next == p->count && !udp_fill (p)) {
+    p->pe.end = 1; *length = -1; return NULL;
+  }
+  i = p->next++; *length = p->msg[i].msg_len;
+  p->source = p->from[i]; p->source.length = p->msg[i].msg_hdr.msg_namelen;
+  p->pe.end = 0;
+  return p->buffer + i * p->size;
+}
+
+int net_send_batch (UdpPort *p, char **data, int *length, int count,
+		    Address *addr) {
+  struct mmsghdr msg[UDP_BATCH]; struct iovec iov[UDP_BATCH];
+  int i, n, sent = 0;
+  if (replay_playing ()) return count;
+  while (count > 0) {
+    n = min (count, UDP_BATCH);
+    for (i = 0; i < n; i++) { struct msghdr *h = &msg[i].msg_hdr;
+      iov[i].iov_base = data[i]; iov[i].iov_len = length[i];
+      memset (h, 0, sizeof (struct msghdr));
+      h->msg_name = addr; h->msg_namelen = addr->length;
+      h->msg_iov = &iov[i]; h->msg_iovlen = 1;
+    }
+    if ((i = sendmmsg (p->pe.socket, msg, n, 0)) <= 0) break;
+    sent += i; data += i; length += i; count -= i;
+  } return sent;
+}
+
+UdpPort *new_udp_port (int size) {
+  UdpPort *p = calloc (1, sizeof (UdpPort) + size * UDP_BATCH);
+  p->pe.type = UDP_PORT; p->size = size; return p;
+}
+
+#else
+
+char *udp_receive (UdpPort *p, int *length) {
   p->source.length = sizeof (Address);
   *length = recvfrom (p->pe.socket, p->buffer, p->size, 0,
 		      (struct sockaddr *)&p->source, &p->source.length);
@@ -17,28 +75,52 @@ char *net_receive (UdpPort *p, int *length) {
   return *length < 0? NULL : p->buffer;
 }
 
+int net_send_batch (UdpPort *p, char **data, int *length, int count,
+		    Address *addr) { int i;
+  if (replay_playing ()) return count;
+  for (i = 0; i < count; i++)
+    if (sendto (p->pe.socket, data[i], length[i], 0,
+		(struct sockaddr *)addr, addr->length) < 0) break;
+  return i;
+}
+
+UdpPort *new_udp_port (int size) {
+  UdpPort *p = calloc (1, sizeof (UdpPort) + size);
+  p->pe.type = UDP_PORT; p->size = size; return p;
+}
+
+#endif
+
+char *net_receive (UdpPort *p, int *length) { char *data = p->buffer;
+  if (replay_playing ()) {
+    *length = replay_input ('U', &p->pe, p->buffer, p->size,
+			    &p->source, sizeof (Address));
+    p->pe.end = *length < 0; return *length < 0? NULL : data;
+  } data = udp_receive (p, length);
+  if (_replay) record_input ('U', &p->pe, data, *length,
+			     &p->source, sizeof (Address));
+  return data;
+}
+
 int net_send (UdpPort *p, char *buffer, int length, Address *addr) {
   // printf ("udp_write %d\n", length); fflush (stdout);
+  if (replay_playing ()) return length;
   return sendto (p->pe.socket, buffer, length, 0,
 		 (struct sockaddr *)(addr), addr->length);
 }
 
 int net_reply (UdpPort *p, char *buffer, int length) {
+  if (replay_playing ()) return length;
   return sendto (p->pe.socket, buffer, length, 0,
  		 (struct sockaddr *)(&p->source), p->source.length);
 }
 
-UdpPort *new_udp_port (int size) {
-  UdpPort *p = calloc (1, sizeof (UdpPort) + size);
-  p->pe.type = UDP_PORT; p->size = size; return p;
-}
-
 void net_open (UdpPort *p, Address *address) {
   if ((p->pe.socket = socket (address->family, SOCK_DGRAM, IPPROTO_UDP)) < 0)
     print_error ("udp_open, socket");
   non_block_enable (p->pe.socket);
   reuse_address (p->pe.socket);
-  event_add (p->pe.socket, p);
+  event_add (p->pe.socket, p); replay_add (&p->pe);
   if (bind (p->pe.socket, (struct sockaddr *)address, address->length) < 0)
     print_error ("upd_open, bind");
 }
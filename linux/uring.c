@@ -0,0 +1,214 @@
+// Copyright (c) 2018 Electric Power Research Institute, Inc.
+// author: Mark Slicker <mark.slicker@gmail.com>
+
+/* io_uring event backend, selected at build time with IO_URING (see
+   targets.sh). Each thread has its own ring, submissions are queued and
+   only submitted when the thread waits for completions so that one system
+   call both submits a batch and waits. TCP data is received with multishot
+   recv into a ring of provided buffers registered with the kernel, net_read
+   copies from the received buffers rather than making a system call, and
+   connections are accepted with multishot accept. Timers, notifiers, UDP
+   ports and the write readiness of TCP ports use multishot poll. */
+
+#include <linux/io_uring.h>
+#include <sys/syscall.h>
+#include <sys/mman.h>
+#include <poll.h>
+
+#define URING_ENTRIES 256
+#define URING_BUFS 256 // provided receive buffers, a power of two
+#define URING_BUF_SIZE 2048
+
+/* The user data of a submission is the slot of the PollEvent, the
+   generation of the slot and the operation. A slot is released when its
+   PollEvent is closed, completions of the previous generation are then
+   discarded without touching the PollEvent. */
+enum UringOp {URING_NONE, URING_POLL, URING_RECV, URING_ACCEPT};
+
+#define uring_data(slot, op) \
+  ((uint64_t)_slot_gen[slot] << 32 | (uint64_t)(slot) << 2 | (op))
+
+typedef struct {
+  int fd;
+  unsigned *sq_head, *sq_tail, sq_mask, tail; // tail is the local tail
+  unsigned *cq_head, *cq_tail, cq_mask, entries;
+  struct io_uring_sqe *sqes;
+  struct io_uring_cqe *cqes;
+  struct io_uring_buf_ring *br; // provided buffers
+  char *bufs; uint16_t br_tail;
+  int buf_next[URING_BUFS], buf_length[URING_BUFS]; // per port chains
+} Uring;
+
+THREAD_LOCAL Uring _ring;
+THREAD_LOCAL PollEvent **_slots = NULL;
+THREAD_LOCAL uint32_t *_slot_gen = NULL;
+THREAD_LOCAL int _n_slots = 0, _slot_free = -1;
+THREAD_LOCAL List *_starved = NULL; // ports waiting for receive buffers
+// completions taken from the ring ahead of event_poll (see uring_reap)
+THREAD_LOCAL struct io_uring_cqe *_backlog = NULL;
+THREAD_LOCAL int _backlog_i = 0, _backlog_n = 0, _backlog_size = 0;
+
+int uring_slot (PollEvent *pe) { int i;
+  if ((i = _slot_free) >= 0) _slot_free = (intptr_t)_slots[i];
+  else { i = _n_slots++;
+    _slots = realloc (_slots, sizeof (PollEvent *) * _n_slots);
+    _slot_gen = realloc (_slot_gen, sizeof (uint32_t) * _n_slots);
+    _slot_gen[i] = 0;
+  } _slots[i] = pe; return pe->slot = i;
+}
+
+void uring_release (PollEvent *pe) { int i = pe->slot;
+  _slot_gen[i]++; _slots[i] = (PollEvent *)(intptr_t)_slot_free;
+  _slot_free = i; pe->slot = -1;
+}
+
+void *uring_map (int fd, size_t size, off_t offset) {
+  void *p = mmap (NULL, size, PROT_READ | PROT_WRITE,
+		  MAP_SHARED | MAP_POPULATE, fd, offset);
+  if (p == MAP_FAILED) { print_error ("io_uring mmap"); exit (1); }
+  return p;
+}
+
+void uring_buf_put (int bid) { Uring *r = &_ring;
+  struct io_uring_buf *b = &r->br->bufs[r->br_tail & (URING_BUFS-1)];
+  b->addr = (uintptr_t)(r->bufs + bid * URING_BUF_SIZE);
+  b->len = URING_BUF_SIZE; b->bid = bid;
+  __atomic_store_n (&r->br->tail, ++r->br_tail, __ATOMIC_RELEASE);
+}
+
+void uring_init () {
+  Uring *r = &_ring; struct io_uring_params p = {0};
+  struct io_uring_buf_reg reg = {0}; char *sq, *cq; int i;
+  p.flags = IORING_SETUP_SUBMIT_ALL | IORING_SETUP_SINGLE_ISSUER;
+  if ((r->fd = syscall (__NR_io_uring_setup, URING_ENTRIES, &p)) < 0) {
+    memset (&p, 0, sizeof (p)); // older kernels
+    r->fd = syscall (__NR_io_uring_setup, URING_ENTRIES, &p);
+  }
+  if (r->fd < 0) { print_error ("io_uring_setup"); exit (1); }
+  sq = uring_map (r->fd, p.sq_off.array + p.sq_entries * sizeof (unsigned),
+		  IORING_OFF_SQ_RING);
+  cq = uring_map (r->fd, p.cq_off.cqes
+		  + p.cq_entries * sizeof (struct io_uring_cqe),
+		  IORING_OFF_CQ_RING);
+  r->sqes = uring_map (r->fd, p.sq_entries * sizeof (struct io_uring_sqe),
+		       IORING_OFF_SQES);
+  r->sq_head = (unsigned *)(sq + p.sq_off.head);
+  r->sq_tail = (unsigned *)(sq + p.sq_off.tail);
+  r->sq_mask = *(unsigned *)(sq + p.sq_off.ring_mask);
+  r->entries = p.sq_entries; r->tail = *r->sq_tail;
+  for (i = 0; i < p.sq_entries; i++)
+    ((unsigned *)(sq + p.sq_off.array))[i] = i;
+  r->cq_head = (unsigned *)(cq + p.cq_off.head);
+  r->cq_tail = (unsigned *)(cq + p.cq_off.tail);
+  r->cq_mask = *(unsigned *)(cq + p.cq_off.ring_mask);
+  r->cqes = (struct io_uring_cqe *)(cq + p.cq_off.cqes);
+  // register the receive buffers
+  posix_memalign ((void **)&r->br, 4096,
+		  URING_BUFS * sizeof (struct io_uring_buf));
+  memset (r->br, 0, URING_BUFS * sizeof (struct io_uring_buf));
+  reg.ring_addr = (uintptr_t)r->br; reg.ring_entries = URING_BUFS;
+  if (syscall (__NR_io_uring_register, r->fd, IORING_REGISTER_PBUF_RING,
+	       &reg, 1) < 0) {
+    print_error ("io_uring_register"); exit (1);
+  }
+  r->bufs = malloc (URING_BUFS * URING_BUF_SIZE);
+  for (i = 0; i < URING_BUFS; i++) uring_buf_put (i);
+}
+
+/* Submit the queued submissions, and optionally wait for a completion.
+   The timeout is in milliseconds, -1 to wait indefinitely. */
+int uring_submit (int wait, int timeout) {
+  Uring *r = &_ring; struct io_uring_getevents_arg arg = {0};
+  struct __kernel_timespec ts; unsigned flags = 0, n;
+  __atomic_store_n (r->sq_tail, r->tail, __ATOMIC_RELEASE);
+  n = r->tail - __atomic_load_n (r->sq_head, __ATOMIC_ACQUIRE);
+  if (wait) {
+    flags = IORING_ENTER_GETEVENTS | IORING_ENTER_EXT_ARG;
+    if (timeout >= 0) {
+      ts.tv_sec = timeout / 1000; ts.tv_nsec = (timeout % 1000) * 1000000;
+      arg.ts = (uintptr_t)&ts;
+    }
+  } else if (!n) return 0;
+  return syscall (__NR_io_uring_enter, r->fd, n, wait, flags,
+		  wait? &arg : NULL, wait? sizeof (arg) : 0);
+}
+
+struct io_uring_sqe *uring_sqe (PollEvent *pe, int op, int fd) {
+  Uring *r = &_ring; struct io_uring_sqe *sqe;
+  if (r->tail - __atomic_load_n (r->sq_head, __ATOMIC_ACQUIRE) == r->entries)
+    uring_submit (0, 0);
+  sqe = &r->sqes[r->tail++ & r->sq_mask];
+  memset (sqe, 0, sizeof (struct io_uring_sqe));
+  sqe->opcode = op; sqe->fd = fd;
+  if (pe) sqe->user_data = uring_data (pe->slot, op == IORING_OP_POLL_ADD?
+				       URING_POLL : op == IORING_OP_RECV?
+				       URING_RECV : URING_ACCEPT);
+  return sqe;
+}
+
+// the next completion in the ring or NULL
+struct io_uring_cqe *uring_ring_cqe () { Uring *r = &_ring;
+  unsigned head = *r->cq_head;
+  if (head == __atomic_load_n (r->cq_tail, __ATOMIC_ACQUIRE)) return NULL;
+  return &r->cqes[head & r->cq_mask];
+}
+
+void uring_ring_seen () {
+  __atomic_store_n (_ring.cq_head, *_ring.cq_head + 1, __ATOMIC_RELEASE);
+}
+
+// the next completion, from the backlog first
+struct io_uring_cqe *uring_cqe () {
+  return _backlog_i < _backlog_n? &_backlog[_backlog_i] : uring_ring_cqe ();
+}
+
+void uring_cqe_seen () {
+  if (_backlog_i < _backlog_n) {
+    if (++_backlog_i == _backlog_n) _backlog_i = _backlog_n = 0;
+  } else uring_ring_seen ();
+}
+
+void uring_backlog (struct io_uring_cqe *cqe) {
+  if (_backlog_n == _backlog_size) {
+    _backlog_size = _backlog_size? _backlog_size << 1 : 64;
+    _backlog = realloc (_backlog, sizeof (struct io_uring_cqe) * _backlog_size);
+  } _backlog[_backlog_n++] = *cqe;
+}
+
+void uring_poll (PollEvent *pe, int fd, unsigned mask) {
+  struct io_uring_sqe *sqe = uring_sqe (pe, IORING_OP_POLL_ADD, fd);
+  sqe->poll32_events = mask; sqe->len = IORING_POLL_ADD_MULTI;
+}
+
+void uring_recv (PollEvent *pe) {
+  struct io_uring_sqe *sqe = uring_sqe (pe, IORING_OP_RECV, pe->socket);
+  sqe->ioprio = IORING_RECV_MULTISHOT; sqe->flags = IOSQE_BUFFER_SELECT;
+  sqe->buf_group = 0;
+}
+
+void uring_accept (PollEvent *pe) {
+  struct io_uring_sqe *sqe = uring_sqe (pe, IORING_OP_ACCEPT, pe->socket);
+  sqe->ioprio = IORING_ACCEPT_MULTISHOT;
+  sqe->accept_flags = SOCK_NONBLOCK | SOCK_CLOEXEC;
+}
+
+// cancel the operations of a PollEvent and release its slot
+void uring_cancel (PollEvent *pe) { int op;
+  if (pe->slot < 0) return;
+  for (op = URING_POLL; op <= URING_ACCEPT; op++) {
+    struct io_uring_sqe *sqe = uring_sqe (NULL, IORING_OP_ASYNC_CANCEL, -1);
+    sqe->addr = uring_data (pe->slot, op);
+    sqe->cancel_flags = IORING_ASYNC_CANCEL_ALL;
+  } uring_release (pe);
+}
+
+void event_add (int fd, void *data) { PollEvent *pe = data;
+  non_block_enable (fd); uring_slot (pe);
+  uring_poll (pe, fd, POLLIN | POLLOUT | POLLRDHUP);
+}
+
+// register a TCP socket, data is received with uring_recv once connected
+void tcp_add (int fd, void *data) { PollEvent *pe = data;
+  non_block_enable (fd); uring_slot (pe);
+  uring_poll (pe, fd, POLLOUT);
+}
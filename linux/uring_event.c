@@ -0,0 +1,174 @@
+// Copyright (c) 2018 Electric Power Research Institute, Inc.
+// author: Mark Slicker <mark.slicker@gmail.com>
+
+// event_poll for the io_uring backend (see uring.c)
+
+#define events_pending() (uring_cqe () != NULL)
+
+// completions are read from the ring as needed, there is no system batch
+void event_batch (int size) {}
+
+/* The received buffers of a port are chained in buffer order, the chain
+   links are the buffer ID + 1 so that 0 ends the chain. */
+void uring_append (TcpPort *p, int bid, int length) { Uring *r = &_ring;
+  r->buf_next[bid] = 0; r->buf_length[bid] = length;
+  if (p->head) r->buf_next[p->tail-1] = bid+1; else p->head = bid+1;
+  p->tail = bid+1;
+}
+
+// return the received buffers of a port to the ring
+void uring_drop (TcpPort *p) { int bid;
+  while (p->head) { bid = p->head-1;
+    p->head = _ring.buf_next[bid]; uring_buf_put (bid);
+  } p->offset = 0;
+}
+
+// resume the receives that ran out of buffers
+void uring_restart () { List *l;
+  foreach (l, _starved) { TcpPort *p = l->data;
+    p->starved = 0; uring_recv (&p->pe);
+  } free_list (_starved); _starved = NULL;
+}
+
+int uring_received (TcpPort *p, int res, unsigned flags);
+
+/* Take the data received by a port from the completion queue, so a port
+   that is read until input ends sees the data as it arrives. The other
+   completions are kept in order in the backlog for event_poll. */
+void uring_reap (TcpPort *p) { struct io_uring_cqe *cqe; uint64_t data;
+  while (cqe = uring_ring_cqe ()) { data = cqe->user_data;
+    if ((data & 3) == URING_RECV && data >> 32 == _slot_gen[p->pe.slot]
+	&& (uint32_t)data >> 2 == p->pe.slot)
+      uring_received (p, cqe->res, cqe->flags);
+    else uring_backlog (cqe);
+    uring_ring_seen ();
+  }
+}
+
+int uring_read (TcpPort *p, char *buffer, int size) {
+  Uring *r = &_ring; int n = 0, bid, k;
+  if (!p->head && !p->eof) uring_reap (p);
+  while (n < size && p->head) { bid = p->head-1;
+    k = min (size - n, r->buf_length[bid] - p->offset);
+    memcpy (buffer + n, r->bufs + bid * URING_BUF_SIZE + p->offset, k);
+    n += k; p->offset += k;
+    if (p->offset == r->buf_length[bid]) {
+      p->head = r->buf_next[bid]; p->offset = 0; uring_buf_put (bid);
+    }
+  }
+  if (_starved) uring_restart ();
+  if (n) return n;
+  if (p->eof) return 0;
+  errno = EAGAIN; return -1;
+}
+
+void uring_closed (PollEvent *pe) { TcpPort *p = (TcpPort *)pe;
+  uring_cancel (pe);
+  if (pe->type == TCP_ACCEPTOR) { Acceptor *a = (Acceptor *)pe;
+    while (a->count) close (a->fds[--a->count]);
+  } else {
+    uring_drop (p); p->eof = 0;
+    if (p->starved) { _starved = list_delete (_starved, p); p->starved = 0; }
+  }
+}
+
+// a completion of a multishot recv, returns 1 if the port has new input
+int uring_received (TcpPort *p, int res, unsigned flags) {
+  int empty = !p->head;
+  if (flags & IORING_CQE_F_BUFFER)
+    uring_append (p, flags >> IORING_CQE_BUFFER_SHIFT, res);
+  else if (res == -ENOBUFS) {
+    p->starved = 1; _starved = list_insert (_starved, p); return 0;
+  } else p->eof = 1; // end of input or error
+  if (res > 0 && !(flags & IORING_CQE_F_MORE)) uring_recv (&p->pe);
+  return empty;
+}
+
+int _event_poll (void **any, int timeout) {
+  PollEvent *pe, *prev; struct io_uring_cqe *cqe;
+  uint64_t data, value; unsigned flags; int event, res, op, slot, n;
+  int64_t t;
+ poll:
+  if (!(cqe = uring_cqe ())) {
+    if (pe = queue_remove (&_active)) {
+      event = pe->type;
+      switch (pe->type) {
+      case TCP_ACCEPTOR: goto accept;
+      case TCP_ACCEPT: case TCP_CONNECT:
+	pe->type = TCP_PORT;
+      case TCP_PORT: case UDP_PORT:
+	prev_add (pe);
+      } *any = pe; return event;
+    }
+  retry: if (_race_closed) race_free ();
+    t = stat_begin ();
+    n = uring_submit (1, timeout);
+    stat_end (STAT_EVENT_POLL, t);
+    if (!(cqe = uring_cqe ())) {
+      if (timeout < 0 || (n < 0 && errno == EINTR)) goto retry;
+      return POLL_TIMEOUT;
+    }
+  }
+  data = cqe->user_data; res = cqe->res; flags = cqe->flags;
+  uring_cqe_seen ();
+  op = data & 3; slot = (uint32_t)data >> 2;
+  if (!op) goto poll; // cancellation
+  if (data >> 32 != _slot_gen[slot]) { // closed
+    if (flags & IORING_CQE_F_BUFFER)
+      uring_buf_put (flags >> IORING_CQE_BUFFER_SHIFT);
+    if (op == URING_ACCEPT && res >= 0) close (res);
+    goto poll;
+  }
+  *any = pe = _slots[slot];
+  switch (op) {
+  case URING_RECV:
+    if (!uring_received ((TcpPort *)pe, res, flags)
+	|| pe->type != TCP_PORT) goto poll;
+    clear_timeout (pe); prev_add (pe); return TCP_PORT;
+  case URING_ACCEPT: {
+    Acceptor *a = (Acceptor *)pe;
+    if (res < 0) goto poll;
+    if (a->count == a->size) {
+      a->size = a->size? a->size << 1 : 16;
+      a->fds = realloc (a->fds, sizeof (int) * a->size);
+    } a->fds[a->count++] = res;
+    if (!(flags & IORING_CQE_F_MORE)) uring_accept (pe);
+  } goto accept;
+  }
+  // URING_POLL, the poll is re-armed if the kernel ended it
+  if (!(flags & IORING_CQE_F_MORE) && res >= 0)
+    uring_poll (pe, pe->socket, pe->type == TIMER_EVENT
+		|| pe->type == UDP_PORT? POLLIN | POLLOUT | POLLRDHUP : POLLOUT);
+  event = res;
+  switch (pe->type) {
+  case TCP_CONNECT:
+    if (((TcpPort *)pe)->owner) { // an attempt of net_connect_any
+      race_event ((TcpPort *)pe, event & POLLOUT,
+		  event & (POLLERR | POLLHUP | POLLRDHUP));
+      goto poll;
+    }
+    if (event & POLLOUT && bsd_connected (pe->socket)) {
+      clear_timeout (pe); uring_recv (pe);
+      pe->status = Connected; pe->type = TCP_PORT;
+      prev_add (pe); return TCP_CONNECT;
+    }
+    if (event & (POLLERR | POLLHUP | POLLRDHUP)) net_close (pe);
+    goto poll;
+  case TCP_PORT: // writable, input is received with uring_recv
+    prev_add (pe); return TCP_PORT;
+  accept:
+  case TCP_ACCEPTOR:
+    if (prev = accept_queued (pe)) {
+      queue_add (&_active, pe);
+      prev->type = TCP_PORT;
+      *any = prev_add (prev);
+      return TCP_ACCEPT;
+    } goto poll;
+  case TIMER_EVENT:
+    read (pe->fd, &value, 8);
+    if (pe->id == TCP_TIMEOUT && !(*any = tcp_expired ()))
+      goto poll; // the earliest timeout was cleared
+    return pe->id;
+  }
+  return pe->type;
+}
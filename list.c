@@ -164,11 +164,12 @@ List *list_union (List *la, List *lb) { List *b;
   return la;
 }
 
-void *list_remove (void *list, void *link) { 
-  List *l, *prev = (List *)&list;
+void *list_remove (void *list, void *link) {
+  List *l, *prev = NULL;
   foreach (l, list) {
     if (l == link) {
-      prev->next = l->next; break;
+      if (prev) prev->next = l->next; else list = l->next;
+      break;
     } prev = l;
   } return list;
 }
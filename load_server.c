@@ -0,0 +1,422 @@
+// Copyright (c) 2018 Electric Power Research Institute, Inc.
+// author: Mark Slicker <mark.slicker@gmail.com>
+
+/* A simulated IEEE 2030.5 server for load testing clients.
+
+   usage: load_server [port n] [edevs n] [fsa n] [groups n] [derp n]
+                      [derc n] [duration s] [poll s] [notify n]
+                      [latency ms] [report s]
+
+   The server hosts a synthetic resource tree, the resources are generated
+   from their path as they are requested so that large trees cost no memory:
+
+   /dcap                       DeviceCapability
+   /tm                         Time
+   /edev                       EndDeviceList (edevs, POST registers a device)
+   /edev/i                     EndDevice
+   /edev/i/rg                  Registration (pIN 111115)
+   /edev/i/fsa                 FunctionSetAssignmentsList (fsa)
+   /edev/i/fsa/j               FunctionSetAssignments
+   /edev/i/sub                 SubscriptionList (POST only)
+   /derp/g                     DERProgramList (derp)
+   /derp/g/k                   DERProgram
+   /derp/g/k/dderc             DefaultDERControl
+   /derp/g/k/derc              DERControlList (derc)
+   /derp/g/k/derc/c            DERControl
+
+   The FunctionSetAssignments of the EndDevices are spread over a number of
+   groups (default 1) each with its own DERProgramList. The DERControls of a
+   program are consecutive events of the given duration (default 300
+   seconds). Subscriptions are notified at a rate of n notifications per
+   second (round robin), a notification for a DERControlList replaces one of
+   the DERControls with a new event. Responses can be delayed by a fixed
+   latency in milliseconds. Every report period (default 10 seconds) the
+   request rate, notification rate, and memory per device are printed along
+   with the statistics (see @ref stats), the "http_serve" stage is the time
+   from a request being received to the response being written.
+
+   Connections are unencrypted, start the aggregator client with the
+   server URI and one of the aggregated devices as the client device, e.g.
+   client_test lo http://127.0.0.1:8080/dcap sfdi 1001 all subscribe
+   aggregate devices.txt stats load.sts 10 */
+
+#include <stdio.h>
+#include <stdarg.h>
+#include <inttypes.h>
+#include <sys/resource.h>
+#include "se_core.c"
+#include "query.c"
+
+#define LOAD_REPLY (EVENT_NEW+30)
+#define LOAD_NOTIFY (EVENT_NEW+31)
+#define LOAD_REPORT (EVENT_NEW+32)
+
+int port = 8080, n_fsa = 1, groups = 1, n_derp = 1, n_derc = 4;
+int duration = 300, poll_rate = 900, notify_rate = 0, latency = 0;
+int report_period = 10;
+int64_t t0; // start time of the first DERControl
+
+// EndDevices (by sFDI) and the versions of the DERControlLists
+uint64_t *devices = NULL; int n_edev = 0, edev_size = 0;
+int *versions;
+
+typedef struct _Sub {
+  struct _Sub *next;
+  char *resource, *uri;
+} Sub;
+
+Sub *subs = NULL, *next_sub = NULL; int n_subs = 0;
+
+// a response awaiting the injected latency
+typedef struct _Reply {
+  struct _Reply *next;
+  void *conn; int status;
+  int64_t time, due;
+  char path[64], query[32];
+} Reply;
+
+Queue replies = {0};
+Timer *reply_timer;
+Arena *scratch; // generated resources, reset after each response
+uint64_t requests = 0, notifications = 0;
+
+int add_device (uint64_t sfdi) { int i;
+  for (i = 0; i < n_edev; i++) if (devices[i] == sfdi) return i;
+  if (n_edev == edev_size)
+    devices = realloc (devices, (edev_size = max (16, edev_size << 1))
+		       * sizeof (uint64_t));
+  devices[n_edev] = sfdi; return n_edev++;
+}
+
+char *href (const char *format, ...) { char buffer[64]; va_list args;
+  va_start (args, format); vsnprintf (buffer, 64, format, args);
+  va_end (args); return arena_strdup (scratch, buffer);
+}
+
+void *new_object (int type) {
+  return arena_alloc (scratch, se_object_size (type));
+}
+
+void set_mrid (uint8_t *mrid, int a, int b, int c, int d) {
+  memcpy (mrid, &a, 4); memcpy (mrid+4, &b, 4);
+  memcpy (mrid+8, &c, 4); memcpy (mrid+12, &d, 4);
+}
+
+// the number of times control c has been replaced by a notification
+int control_gen (int v, int c) { return (v + n_derc - 1 - c) / n_derc; }
+
+void *edev (int i) { SE_EndDevice_t *e = new_object (SE_EndDevice);
+  e->href = href ("/edev/%d", i); e->sFDI = devices[i];
+  e->changedTime = t0;
+  se_set (e, FunctionSetAssignmentsListLink);
+  e->FunctionSetAssignmentsListLink.href = href ("/edev/%d/fsa", i);
+  se_set (&e->FunctionSetAssignmentsListLink, all);
+  e->FunctionSetAssignmentsListLink.all = n_fsa;
+  se_set (e, RegistrationLink);
+  e->RegistrationLink.href = href ("/edev/%d/rg", i);
+  se_set (e, SubscriptionListLink);
+  e->SubscriptionListLink.href = href ("/edev/%d/sub", i);
+  return e;
+}
+
+void *fsa (int i, int j) {
+  SE_FunctionSetAssignments_t *f = new_object (SE_FunctionSetAssignments);
+  int g = (i * n_fsa + j) % groups;
+  f->href = href ("/edev/%d/fsa/%d", i, j);
+  set_mrid (f->mRID, 1, i, j, 0);
+  sprintf (f->description, "fsa %d.%d", i, j);
+  se_set (f, DERProgramListLink);
+  f->DERProgramListLink.href = href ("/derp/%d", g);
+  se_set (&f->DERProgramListLink, all);
+  f->DERProgramListLink.all = n_derp;
+  return f;
+}
+
+void *derp (int g, int k) { SE_DERProgram_t *p = new_object (SE_DERProgram);
+  p->href = href ("/derp/%d/%d", g, k);
+  set_mrid (p->mRID, 2, g, k, 0);
+  sprintf (p->description, "program %d.%d", g, k);
+  se_set (p, DefaultDERControlLink);
+  p->DefaultDERControlLink.href = href ("/derp/%d/%d/dderc", g, k);
+  se_set (p, DERControlListLink);
+  p->DERControlListLink.href = href ("/derp/%d/%d/derc", g, k);
+  se_set (&p->DERControlListLink, all);
+  p->DERControlListLink.all = n_derc;
+  p->primacy = k; return p;
+}
+
+void *dderc (int g, int k) {
+  SE_DefaultDERControl_t *d = new_object (SE_DefaultDERControl);
+  d->href = href ("/derp/%d/%d/dderc", g, k);
+  set_mrid (d->mRID, 3, g, k, 0);
+  strcpy (d->description, "default");
+  se_set (&d->DERControlBase, opModMaxLimW);
+  d->DERControlBase.opModMaxLimW = 10000; return d;
+}
+
+void *derc (int g, int k, int c) {
+  SE_DERControl_t *d = new_object (SE_DERControl);
+  int v = versions[g * n_derp + k], gen = control_gen (v, c);
+  d->href = href ("/derp/%d/%d/derc/%d", g, k, c);
+  set_mrid (d->mRID, 4, g, k, gen * n_derc + c);
+  sprintf (d->description, "control %d.%d.%d", g, k, c);
+  d->version = gen; d->creationTime = t0 + gen;
+  d->interval.start = t0 + (gen * n_derc + c) * (int64_t)duration;
+  d->interval.duration = duration;
+  // the client expects the status to be Active once the event has started
+  if (time (NULL) >= d->interval.start) {
+    d->EventStatus.currentStatus = 1;
+    d->EventStatus.dateTime = d->interval.start;
+  } else d->EventStatus.dateTime = d->creationTime;
+  se_set (&d->DERControlBase, opModMaxLimW);
+  d->DERControlBase.opModMaxLimW = 2000 + c * 1000 % 8000; return d;
+}
+
+// a page of a List resource, the items are generated by the function
+void *page (int type, char *path, Query *q, int all, int x, int y,
+	    void *(*item) (int, int, int)) {
+  SE_SubscribableList_t *l = new_object (type); List **tail;
+  int i, end = min (all, q->start + q->limit);
+  l->href = arena_strdup (scratch, path); l->all = all;
+  se_set (l, subscribable); l->subscribable = 1;
+  tail = se_list_field ((void *)l, find_list_info (type));
+  for (i = q->start; i < end; i++) {
+    List *e = arena_alloc (scratch, sizeof (List));
+    e->data = item (x, y, i); *tail = e; tail = &e->next; l->results++;
+  } return l;
+}
+
+void *edev_item (int x, int y, int i) { return edev (i); }
+void *fsa_item (int x, int y, int j) { return fsa (x, j); }
+void *derp_item (int x, int y, int k) { return derp (x, k); }
+void *derc_item (int x, int y, int c) { return derc (x, y, c); }
+
+#define match(format, ...) \
+  (n = -1, sscanf (path, format "%n", __VA_ARGS__, &n), n >= 0 && !path[n])
+
+// generate the resource at a path
+void *resource (int *type, char *path, char *query) {
+  Query q = {0, 0, 1}; int i, j, k, n;
+  if (!parse_query (&q, query)) return NULL;
+  if (streq (path, "/dcap")) {
+    SE_DeviceCapability_t *d = new_object (*type = SE_DeviceCapability);
+    d->href = "/dcap"; se_set (d, pollRate); d->pollRate = poll_rate;
+    se_set (d, TimeLink); d->TimeLink.href = "/tm";
+    se_set (d, EndDeviceListLink); d->EndDeviceListLink.href = "/edev";
+    se_set (&d->EndDeviceListLink, all);
+    d->EndDeviceListLink.all = n_edev; return d;
+  }
+  if (streq (path, "/tm")) { SE_Time_t *t = new_object (*type = SE_Time);
+    t->href = "/tm"; t->currentTime = time (NULL); t->quality = 7;
+    se_set (t, pollRate); t->pollRate = poll_rate; return t;
+  }
+  if (streq (path, "/edev")) {
+    SE_EndDeviceList_t *e = page (*type = SE_EndDeviceList, path, &q, n_edev,
+				  0, 0, edev_item);
+    se_set (e, pollRate); e->pollRate = poll_rate; return e;
+  }
+  if (match ("/edev/%d", &i) && i >= 0 && i < n_edev)
+    return *type = SE_EndDevice, edev (i);
+  if (match ("/edev/%d/rg", &i) && i >= 0 && i < n_edev) {
+    SE_Registration_t *r = new_object (*type = SE_Registration);
+    r->href = href ("/edev/%d/rg", i);
+    r->dateTimeRegistered = t0; r->pIN = 111115; return r;
+  }
+  if (match ("/edev/%d/fsa", &i) && i >= 0 && i < n_edev) {
+    SE_FunctionSetAssignmentsList_t *f =
+      page (*type = SE_FunctionSetAssignmentsList, path, &q, n_fsa, i, 0,
+	    fsa_item);
+    se_set (f, pollRate); f->pollRate = poll_rate; return f;
+  }
+  if (match ("/edev/%d/fsa/%d", &i, &j) && i >= 0 && i < n_edev
+      && j >= 0 && j < n_fsa)
+    return *type = SE_FunctionSetAssignments, fsa (i, j);
+  if (match ("/derp/%d", &i) && i >= 0 && i < groups) {
+    SE_DERProgramList_t *p = page (*type = SE_DERProgramList, path, &q,
+				   n_derp, i, 0, derp_item);
+    se_set (p, pollRate); p->pollRate = poll_rate; return p;
+  }
+  if (!(sscanf (path, "/derp/%d/%d", &i, &j) == 2 && i >= 0 && i < groups
+	&& j >= 0 && j < n_derp)) return NULL;
+  if (match ("/derp/%d/%d", &i, &j))
+    return *type = SE_DERProgram, derp (i, j);
+  if (match ("/derp/%d/%d/dderc", &i, &j))
+    return *type = SE_DefaultDERControl, dderc (i, j);
+  if (match ("/derp/%d/%d/derc", &i, &j))
+    return page (*type = SE_DERControlList, path, &q, n_derc, i, j,
+		 derc_item);
+  if (match ("/derp/%d/%d/derc/%d", &i, &j, &k) && k >= 0 && k < n_derc)
+    return *type = SE_DERControl, derc (i, j, k);
+  return NULL;
+}
+
+void serve (Reply *r) { void *obj; int type;
+  if (net_status (r->conn) == Closed) return;
+  switch (r->status) {
+  case 200:
+    if (obj = resource (&type, r->path, *r->query? r->query : NULL))
+      se_reply (r->conn, obj, type);
+    else http_respond (r->conn, 404);
+    arena_reset (scratch); break;
+  case 201: http_created (r->conn, r->path); break;
+  default: http_respond (r->conn, r->status);
+  } stat_record (STAT_HTTP_SERVE, stat_now () - r->time); requests++;
+}
+
+void reply (void *conn, int status, char *path, char *query, int64_t t) {
+  Reply *r = type_alloc (Reply);
+  r->conn = conn; r->status = status; r->time = t;
+  strncpy (r->path, path, 63); if (query) strncpy (r->query, query, 31);
+  if (!latency) { serve (r); free (r); return; }
+  r->due = t + latency * 1000000LL;
+  if (!queue_peek (&replies)) set_timer_ms (reply_timer, 1);
+  queue_add (&replies, r);
+}
+
+// send the replies whose latency has elapsed
+void reply_due () { Reply *r; int64_t now = stat_now ();
+  while ((r = queue_peek (&replies)) && r->due <= now) {
+    queue_remove (&replies); serve (r); free (r);
+  } if (!r) set_timer_ms (reply_timer, 0);
+}
+
+void subscription (void *conn, SE_Subscription_t *s, int i, int64_t t) {
+  Sub *sub = type_alloc (Sub); char location[64];
+  sub->resource = strdup (s->subscribedResource);
+  sub->uri = strdup (s->notificationURI);
+  sub->next = subs; subs = sub;
+  sprintf (location, "/edev/%d/sub/%d", i, n_subs++);
+  reply (conn, 201, location, NULL, t);
+}
+
+void registration (void *conn, SE_EndDevice_t *e, int64_t t) {
+  char location[64];
+  sprintf (location, "/edev/%d", add_device (e->sFDI));
+  reply (conn, 201, location, NULL, t);
+}
+
+void process_request (void *conn) {
+  int method = se_receive (conn), type, i, n; int64_t t = stat_now ();
+  char *path; void *obj;
+  switch (method) {
+  case HTTP_GET:
+    reply (conn, 200, http_path (conn), http_query (conn), t); break;
+  case HTTP_POST: path = http_path (conn);
+    if (!(obj = se_body (conn, &type))) {
+      reply (conn, 400, path, NULL, t); break;
+    }
+    if (streq (path, "/edev") && type == SE_EndDevice)
+      registration (conn, obj, t);
+    else if (match ("/edev/%d/sub", &i) && type == SE_Subscription
+	     && i >= 0 && i < n_edev)
+      subscription (conn, obj, i, t);
+    else reply (conn, 405, path, NULL, t);
+    free_se_body (conn); break;
+  case HTTP_PUT: case HTTP_DELETE:
+    reply (conn, 204, http_path (conn), NULL, t);
+    free_se_body (conn); break;
+  case HTTP_HEAD: case HTTP_UNKNOWN:
+    reply (conn, 405, http_path (conn), NULL, t);
+  }
+}
+
+// notify the next subscription, a DERControlList is changed first
+void notify_next () {
+  SE_Notification_t n = {0}; Uri128 buf; Uri *uri = &buf.uri;
+  int g, k, m, type; void *obj; char *path;
+  if (!(next_sub = next_sub? next_sub : subs)) return;
+  if (*(path = next_sub->resource) != '/') { // absolute URI
+    if (!uri_parse (&buf, path, 127)) goto next;
+    path = uri->path;
+  }
+  if (sscanf (path, "/derp/%d/%d/derc%n", &g, &k, &m) == 2 && !path[m]
+      && g >= 0 && g < groups && k >= 0 && k < n_derp)
+    versions[g * n_derp + k]++;
+  if (obj = resource (&type, path, "l=10")) {
+    n.subscribedResource = next_sub->resource;
+    se_set (&n, Resource);
+    n.Resource.type = element_type (type, &se_schema); n.Resource.data = obj;
+    n.subscriptionURI = next_sub->uri;
+    se_send (NULL, &n, SE_Notification, next_sub->uri, HTTP_POST);
+    arena_reset (scratch); notifications++;
+  }
+ next: next_sub = next_sub->next;
+}
+
+// request bodies are parsed into an arena, the parts kept are copied
+void accept_client (Acceptor *a) { se_arena (se_accept (a, 0), 4096); }
+
+long peak_rss () { struct rusage r;
+  getrusage (RUSAGE_SELF, &r); return r.ru_maxrss; // kilobytes
+}
+
+void report () { long rss = peak_rss ();
+  printf ("load_server: %.1f requests/s, %.1f notifications/s, %d devices, "
+	  "%d subscriptions, %ld KB peak RSS, %.2f KB per device\n",
+	  (double)requests / report_period,
+	  (double)notifications / report_period, n_edev, n_subs, rss,
+	  (double)rss / max (n_edev, 1));
+  stats_print (stdout); fflush (stdout);
+  requests = notifications = 0;
+}
+
+void usage () {
+  printf ("usage: load_server [port n] [edevs n] [fsa n] [groups n] "
+	  "[derp n]\n                   [derc n] [duration s] [poll s] "
+	  "[notify n] [latency ms]\n                   [report s]\n");
+  exit (0);
+}
+
+void options (int argc, char **argv) {
+  const char * const names[] = {
+    "port", "edevs", "fsa", "groups", "derp", "derc", "duration", "poll",
+    "notify", "latency", "report"
+  };
+  int *values[] = {
+    &port, &n_edev, &n_fsa, &groups, &n_derp, &n_derc, &duration,
+    &poll_rate, &notify_rate, &latency, &report_period
+  };
+  int i, index;
+  for (i = 1; i < argc; i++) {
+    if ((index = string_index (argv[i], names, 11)) < 0 || ++i == argc
+	|| !number (values[index], argv[i]) || *values[index] < 0) usage ();
+  }
+  if (groups < 1 || n_derc < 1 || duration < 1 || report_period < 1)
+    usage ();
+}
+
+int main (int argc, char **argv) {
+  char zero[16] = {0}; Address addr; Acceptor *a; void *any;
+  int i, edevs, tick = 0, per_tick = 0;
+  options (argc, argv); edevs = n_edev; n_edev = 0;
+  platform_init ();
+  for (i = 0; i < edevs; i++) add_device (i+1);
+  versions = calloc (groups * n_derp, sizeof (int));
+  t0 = time (NULL) + 60; scratch = arena_new (65536); se_stats = 1;
+  a = net_listen (ipv6_address (&addr, zero, port));
+  accept_client (a);
+  reply_timer = add_timer (LOAD_REPLY);
+  if (notify_rate) {
+    tick = max (1, 1000 / notify_rate);
+    per_tick = max (1, notify_rate * tick / 1000);
+    set_timer_ms (add_timer (LOAD_NOTIFY), tick);
+  }
+  set_timer (add_timer (LOAD_REPORT), report_period);
+  printf ("load_server: port %d, %d devices, %d fsa, %d groups, %d programs, "
+	  "%d controls\n", port, n_edev, n_fsa, groups, n_derp, n_derc);
+  while (1) {
+    switch (event_poll (&any, -1)) {
+    case TCP_ACCEPT: accept_client (a);
+    case TCP_CONNECT: case TCP_PORT:
+      if (conn_session (any)) {
+	if (http_client (any)) { // notification response
+	  se_receive (any); free_se_body (any);
+	} else process_request (any);
+      } break;
+    case LOAD_REPLY: reply_due (); break;
+    case LOAD_NOTIFY:
+      for (i = 0; i < per_tick; i++) notify_next (); break;
+    case LOAD_REPORT: report (); break;
+    }
+  }
+}
@@ -0,0 +1,159 @@
+// Copyright (c) 2018 Electric Power Research Institute, Inc.
+// author: Mark Slicker <mark.slicker@gmail.com>
+
+#include <stdio.h>
+
+/** @defgroup log Log
+
+    Provides leveled diagnostic output. Messages above the compile time level
+    @ref LOG_LEVEL are removed by the compiler, messages above the run time
+    level @ref log_level are skipped before they are formatted.
+
+    Each thread writes its messages to its own ring buffer. Once
+    @ref log_start has been called a writer thread copies the buffers to the
+    log file, so a slow terminal or pipe does not block the event loop. A
+    message that does not fit into a full buffer is dropped and counted.
+    Before @ref log_start messages are written directly to the log file.
+    @{
+*/
+
+enum LogLevel {LOG_ERROR, LOG_WARN, LOG_INFO, LOG_DEBUG};
+
+/** @brief The compile time log level, define as LOG_INFO (for example) to
+    remove the debug messages from the build. */
+#ifndef LOG_LEVEL
+#define LOG_LEVEL LOG_DEBUG
+#endif
+
+/** @brief The run time log level, the default is LOG_WARN. */
+extern int log_level;
+
+/** @brief Determine whether messages of a level are logged.
+    @param level is a LogLevel value
+*/
+#define log_enabled(level) ((level) <= LOG_LEVEL && (level) <= log_level)
+
+#define log_error(...) \
+  do { if (log_enabled (LOG_ERROR)) log_printf (__VA_ARGS__); } while (0)
+#define log_warn(...) \
+  do { if (log_enabled (LOG_WARN)) log_printf (__VA_ARGS__); } while (0)
+#define log_info(...) \
+  do { if (log_enabled (LOG_INFO)) log_printf (__VA_ARGS__); } while (0)
+#define log_debug(...) \
+  do { if (log_enabled (LOG_DEBUG)) log_printf (__VA_ARGS__); } while (0)
+
+/** @brief Write a formatted message to the log.
+
+    The message is written regardless of the log level, the level macros
+    (log_error, log_warn, log_info, log_debug) check the level first.
+    @param format is a printf style format string
+*/
+void log_printf (const char *format, ...);
+
+/** @brief Write a string to the log.
+    @param s is the string
+    @param length is the length of the string
+*/
+void log_write (const char *s, int length);
+
+/** @brief Start the writer thread.
+    @param f is the log file (e.g. stdout)
+*/
+void log_start (FILE *f);
+
+/** @brief Write the buffered messages of every thread to the log file. */
+void log_flush ();
+
+/** @} */
+
+#ifndef HEADER_ONLY
+
+#include <pthread.h>
+#include <stdarg.h>
+#include <time.h>
+
+#define LOG_SIZE 65536 // must be a power of two
+
+// byte ring, written by its thread and read by the writer
+typedef struct _LogBuffer {
+  struct _LogBuffer *next;
+  unsigned head, tail; // head is written by the writer, tail by the thread
+  unsigned dropped;
+  char data[LOG_SIZE];
+} LogBuffer;
+
+int log_level = LOG_WARN;
+FILE *log_file = NULL;
+LogBuffer *log_buffers = NULL;
+THREAD_LOCAL LogBuffer *log_buffer = NULL;
+pthread_mutex_t log_mutex = PTHREAD_MUTEX_INITIALIZER;
+int log_async = 0;
+
+LogBuffer *log_thread_buffer () { LogBuffer *b;
+  if (b = log_buffer) return b;
+  b = calloc (1, sizeof (LogBuffer));
+  b->next = __atomic_load_n (&log_buffers, __ATOMIC_ACQUIRE);
+  while (!__atomic_compare_exchange_n (&log_buffers, &b->next, b, 0,
+				       __ATOMIC_RELEASE, __ATOMIC_ACQUIRE));
+  return log_buffer = b;
+}
+
+void log_write (const char *s, int length) {
+  LogBuffer *b; unsigned h, t, i, n;
+  if (!__atomic_load_n (&log_async, __ATOMIC_ACQUIRE)) {
+    fwrite (s, 1, length, log_file? log_file : stdout); return;
+  }
+  b = log_thread_buffer (); t = b->tail;
+  h = __atomic_load_n (&b->head, __ATOMIC_ACQUIRE);
+  if (length > LOG_SIZE - (t - h)) {
+    __atomic_fetch_add (&b->dropped, 1, __ATOMIC_RELAXED); return;
+  }
+  i = t & (LOG_SIZE-1); n = min (length, LOG_SIZE - i);
+  memcpy (b->data+i, s, n); memcpy (b->data, s+n, length-n);
+  __atomic_store_n (&b->tail, t+length, __ATOMIC_RELEASE);
+}
+
+void log_printf (const char *format, ...) {
+  char buffer[512]; va_list args; int n;
+  va_start (args, format);
+  n = vsnprintf (buffer, 512, format, args);
+  va_end (args);
+  if (n >= 0) log_write (buffer, min (n, 511));
+}
+
+// copy the messages of one buffer to the log file
+int log_drain (LogBuffer *b) {
+  unsigned h = b->head, t = __atomic_load_n (&b->tail, __ATOMIC_ACQUIRE);
+  unsigned i = h & (LOG_SIZE-1), n = min (t - h, LOG_SIZE - i);
+  unsigned dropped = __atomic_exchange_n (&b->dropped, 0, __ATOMIC_RELAXED);
+  if (h == t && !dropped) return 0;
+  fwrite (b->data+i, 1, n, log_file); fwrite (b->data, 1, t - h - n, log_file);
+  if (dropped) fprintf (log_file, "log: %u messages dropped\n", dropped);
+  __atomic_store_n (&b->head, t, __ATOMIC_RELEASE);
+  return 1;
+}
+
+void log_flush () { LogBuffer *b; int n = 0;
+  if (!log_async) { if (log_file) fflush (log_file); return; }
+  pthread_mutex_lock (&log_mutex);
+  for (b = __atomic_load_n (&log_buffers, __ATOMIC_ACQUIRE); b; b = b->next)
+    n |= log_drain (b);
+  if (n) fflush (log_file);
+  pthread_mutex_unlock (&log_mutex);
+}
+
+void *log_writer (void *arg) {
+  struct timespec idle = {0, 10000000}; // 10 ms
+  while (1) { log_flush (); nanosleep (&idle, NULL); }
+  return NULL;
+}
+
+void log_start (FILE *f) { pthread_t thread;
+  if (log_async) return;
+  log_file = f; fflush (stdout);
+  __atomic_store_n (&log_async, 1, __ATOMIC_RELEASE);
+  pthread_create (&thread, NULL, log_writer, NULL);
+  pthread_detach (thread); atexit (log_flush);
+}
+
+#endif
@@ -10,8 +10,8 @@
 #define MDNS_PORT 5353
 
 #define DNS_PACKET_SIZE 512
-char *dns_start, *dns_end;
-Address multicast;
+THREAD_LOCAL char *dns_start, *dns_end;
+THREAD_LOCAL Address multicast;
 
 #define truncated(data) ((data) > dns_end)
 
@@ -62,17 +62,19 @@ char *dns_name (char *name, char *data) {
       if (prev_length == name_length) return NULL; // pointer loop with no data
       prev_length = name_length;
       break;
-    default: printf ("dns_name: unknown type in name\n");
+    default: log_warn ("dns_name: unknown type in name\n");
       return NULL;
     }
   }
   return NULL;
 }
 
-// encode dns name using PTR compression
-char *encode_name (char *buffer, char *name, char *start, char **names) {
+/* encode dns name using PTR compression, names is a NULL terminated table
+   of size entries that collects the encoded names while there is room */
+char *encode_name (char *buffer, char *name, char *start, char **names,
+		   int size) {
   while (*name) { int i, n = name[0]+1;
-    for (i = 0; names[i] != NULL; i++) {
+    for (i = 0; i < size && names[i] != NULL; i++) {
       char *sub = names[i];
       if (strncmp (name, sub, n) == 0) {
 	int ptr = 0xc000 | (sub - start);
@@ -80,7 +82,7 @@ char *encode_name (char *buffer, char *name, char *start, char **names) {
 	return buffer + 2;
       }
     }
-    names[i] = buffer;
+    if (i < size-1) names[i] = buffer;
     memcpy (buffer, name, n);
     name += n; buffer += n;
   }
@@ -0,0 +1,72 @@
+// Copyright (c) 2018 Electric Power Research Institute, Inc.
+// author: Mark Slicker <mark.slicker@gmail.com>
+
+/** @defgroup memory Memory Budget
+
+    Provides a process wide memory budget for constrained devices. The
+    memory in use is the heap usage reported by the allocator (see
+    @ref heap_usage), so it covers every allocation (Stubs, resources, parsed
+    objects, send queues, events) without accounting at each call site.
+    The usage is sampled at most once every MEMORY_SAMPLE nanoseconds per
+    thread. Near the budget the retrieval of resources sheds load, %List
+    pages are requested one at a time with fewer items and new requests are
+    paused while the usage is over the budget (see @ref retrieve).
+    @{
+*/
+
+#ifndef MEMORY_SAMPLE
+#define MEMORY_SAMPLE 10000000
+#endif
+
+/** @brief The memory pressure levels returned by @ref memory_pressure */
+enum MemoryPressure {
+  MEMORY_NORMAL, ///< usage is below the high water mark
+  MEMORY_HIGH, ///< usage is above the high water mark (3/4 of the budget)
+  MEMORY_OVER ///< usage is over the budget
+};
+
+/** @brief The memory budget in bytes, the default of 0 is no limit. */
+extern int64_t memory_budget;
+
+/** @brief Return the memory in use.
+    @returns the number of bytes in use, as of the last sample
+*/
+int64_t memory_used ();
+
+/** @brief Return the memory pressure.
+
+    A change in the pressure level is logged (at LOG_WARN).
+    @returns a MemoryPressure value, MEMORY_NORMAL if there is no budget
+*/
+int memory_pressure ();
+
+/** @} */
+
+#ifndef HEADER_ONLY
+
+int64_t memory_budget = 0;
+THREAD_LOCAL int64_t _memory_used = 0, _memory_sampled = 0;
+THREAD_LOCAL int _memory_level = MEMORY_NORMAL;
+
+int64_t memory_used () {
+  int64_t now = stat_now ();
+  if (now - _memory_sampled >= MEMORY_SAMPLE || !_memory_sampled) {
+    _memory_used = heap_usage (); _memory_sampled = now;
+  } return _memory_used;
+}
+
+int memory_pressure () {
+  const char * const levels[] = {"normal", "high", "over budget"};
+  int64_t used; int level = MEMORY_NORMAL;
+  if (!memory_budget) return level;
+  used = memory_used ();
+  if (used >= memory_budget) level = MEMORY_OVER;
+  else if (used >= memory_budget - (memory_budget >> 2)) level = MEMORY_HIGH;
+  if (level != _memory_level) {
+    log_warn ("memory: %s, %" PRId64 " KB used of %" PRId64 " KB\n",
+	      levels[level], used >> 10, memory_budget >> 10);
+    _memory_level = level;
+  } return level;
+}
+
+#endif
@@ -42,6 +42,60 @@ void create_mirror (SE_MirrorUsagePoint_t *mup, char *desc,
 */
 List *create_reading (List *rds, char *desc, int uom, int kind);
 
+/** The samples of a MirrorMeterReading waiting to be posted, kept in a ring
+    buffer. When the ring is full the oldest sample is dropped. */
+typedef struct {
+  SE_MirrorMeterReading_t *mmr; ///< is the MirrorMeterReading
+  int64_t *time, *value; ///< are the sample times and values
+  unsigned head, tail; ///< are the positions of the oldest and next sample
+  unsigned dropped; ///< is the number of samples dropped
+} MeterChannel;
+
+/** A Meter collects the samples of a set of MirrorMeterReadings and posts
+    them in batches, aggregated into MirrorReadingSets. */
+typedef struct _Meter {
+  MeterChannel *channel; ///< is an array of channels, one per reading
+  int count; ///< is the number of channels
+  unsigned size; ///< is the capacity of each ring (power of two)
+  int granularity; ///< is the aggregation interval in seconds
+  int64_t posted; ///< is the time of the last batch
+  SE_MirrorUsagePoint_t batch; ///< is the last batch, kept while it streams
+} Meter;
+
+/** @brief Create a Meter for a list of MirrorMeterReadings.
+    @param readings is a List of MirrorMeterReadings
+    @param granularity is the aggregation interval in seconds
+    @param size is the number of samples held for each reading
+    @returns a new Meter
+*/
+Meter *meter_new (List *readings, int granularity, int size);
+
+/** @brief Add a sample to a Meter.
+    @param m is a pointer to a Meter
+    @param index is the index of the reading (the order of the readings list)
+    @param time is the time of the sample
+    @param value is the sample value
+*/
+void meter_sample (Meter *m, int index, int64_t time, int64_t value);
+
+/** @brief Post the samples of a Meter as a single MirrorUsagePoint.
+
+    The samples of each reading are averaged over intervals of the Meter's
+    granularity, each interval is a Reading of the MirrorReadingSet posted for
+    the reading. If the connection has requests awaiting a response the batch
+    is deferred, the samples are kept and posted with the next batch. The
+    batch is streamed (see @ref se_stream), so it is kept by the Meter until
+    the next batch.
+    @param m is a pointer to a Meter
+    @param conn is a pointer to an SeConnection
+    @param mup is a pointer to the MirrorUsagePoint
+    @param href is the location of the MirrorUsagePoint
+    @param now is the current time
+    @returns the number of Readings posted, or -1 if the batch was deferred
+*/
+int meter_post (Meter *m, void *conn, SE_MirrorUsagePoint_t *mup,
+		const char *href, int64_t now);
+
 /** @} */
 
 void create_mirror (SE_MirrorUsagePoint_t *mup, char *desc,
@@ -73,3 +127,74 @@ List *create_reading (List *rds, char *desc, int uom, int kind) {
   rt->flowDirection = 1; rt->commodity = 1; rt->kind = kind;
   return list_insert (rds, mmr);
 }
+
+Meter *meter_new (List *readings, int granularity, int size) {
+  Meter *m = type_alloc (Meter); int i = 0;
+  unsigned n = 16; List *l;
+  while (n < size) n <<= 1;
+  m->count = list_length (readings); m->size = n;
+  m->granularity = max (granularity, 1);
+  m->channel = calloc (m->count, sizeof (MeterChannel));
+  foreach (l, readings) { MeterChannel *c = &m->channel[i++];
+    c->mmr = l->data;
+    c->time = malloc (n * sizeof (int64_t));
+    c->value = malloc (n * sizeof (int64_t));
+  } return m;
+}
+
+void meter_sample (Meter *m, int index, int64_t time, int64_t value) {
+  MeterChannel *c = &m->channel[index]; unsigned i;
+  if (c->tail - c->head == m->size) { c->head++; c->dropped++; }
+  i = c->tail++ & (m->size-1);
+  c->time[i] = time; c->value[i] = value;
+}
+
+// average the samples of a channel over each interval
+List *meter_readings (Meter *m, MeterChannel *c) {
+  List *rds = NULL; SE_Reading_t *rd = NULL; int64_t sum = 0; int n = 0;
+  while (c->head != c->tail) { unsigned i = c->head++ & (m->size-1);
+    int64_t start = c->time[i] - c->time[i] % m->granularity;
+    if (!rd || rd->timePeriod.start != start) {
+      if (rd) rd->value = sum / n;
+      rd = type_alloc (SE_Reading_t); rds = list_insert (rds, rd);
+      rd->_flags = SE_value_exists | SE_timePeriod_exists;
+      rd->timePeriod.start = start;
+      rd->timePeriod.duration = m->granularity;
+      sum = n = 0;
+    } sum += c->value[i]; n++;
+  } if (rd) rd->value = sum / n;
+  return list_reverse (rds);
+}
+
+int meter_post (Meter *m, void *conn, SE_MirrorUsagePoint_t *mup,
+		const char *href, int64_t now) {
+  SE_MirrorUsagePoint_t *batch = &m->batch; List *mmrs = NULL, *l;
+  int i, count = 0;
+  if (http_busy (conn)) return -1;
+  // the response to the last batch was received, so it has been sent
+  foreach (l, batch->MirrorMeterReading)
+    free_se_object (l->data, SE_MirrorMeterReading);
+  free_list (batch->MirrorMeterReading); batch->MirrorMeterReading = NULL;
+  for (i = 0; i < m->count; i++) { MeterChannel *c = &m->channel[i];
+    SE_MirrorMeterReading_t *mmr;
+    SE_MirrorReadingSet_t *mrs;
+    if (c->head == c->tail) continue;
+    mmr = type_alloc (SE_MirrorMeterReading_t);
+    mrs = type_alloc (SE_MirrorReadingSet_t);
+    memcpy (mmr->mRID, c->mmr->mRID, sizeof (mmr->mRID));
+    mrid_gen (mrs->mRID);
+    mrs->timePeriod.start = m->posted? m->posted
+      : c->time[c->head & (m->size-1)];
+    mrs->timePeriod.duration = now - mrs->timePeriod.start;
+    mrs->Reading = meter_readings (m, c);
+    count += list_length (mrs->Reading);
+    se_set (mmr, lastUpdateTime); mmr->lastUpdateTime = now;
+    mmr->MirrorReadingSet = list_insert (NULL, mrs);
+    mmrs = list_insert (mmrs, mmr);
+  }
+  m->posted = now;
+  if (!mmrs) return 0;
+  *batch = *mup; batch->MirrorMeterReading = list_reverse (mmrs);
+  se_stream (conn, batch, SE_MirrorUsagePoint, href, HTTP_POST);
+  return count;
+}
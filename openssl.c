@@ -25,6 +25,24 @@ typedef int (*VerifyFunc) (void *context, uint8_t *cert, int length);
 */
 void tls_init (const char *path, VerifyFunc verify);
 
+/** @brief Return the TLS context of the calling thread.
+
+    The TLS context (device certificate, CA certificates, and verify
+    function) is thread local, so independent instances of the stack with
+    different device certificates can run in different threads.
+    @returns an opaque pointer to the TLS context, or NULL if the thread has
+    not initialized TLS
+*/
+void *tls_context ();
+
+/** @brief Use the TLS context of another thread.
+
+    A thread that acts for the same device as another thread (a reactor for
+    example) shares the context rather than loading the certificates again.
+    @param tls is a TLS context returned by @ref tls_context
+*/
+void tls_share (void *tls);
+
 /** @brief Load a CA certificate.
 
     This certificate can be sent along with client certificate as part of
@@ -41,10 +59,28 @@ void load_cert (const char *path);
 */
 void load_cert_dir (const char *path);
 
+/** @brief Resume a cached TLS session with a server.
+
+    Client sessions (session IDs and tickets) are cached by server Address,
+    a new connection to the server offers the cached session so that it can
+    be resumed with an abbreviated handshake. A session that fails to resume
+    is removed from the cache.
+    @param ssl is a pointer to the TLS state of a client connection
+    @param server is the Address of the server
+*/
+void ssl_resume (void *ssl, Address *server);
+
+/** @brief The number of TLS handshakes that resumed a session. */
+extern THREAD_LOCAL unsigned tls_resumed;
+
+/** @brief The number of full TLS handshakes. */
+extern THREAD_LOCAL unsigned tls_full;
+
 /** @} */
 
 #ifndef HEADER_ONLY
 
+#include <pthread.h>
 #include <openssl/opensslconf.h>
 #include <openssl/ssl.h>
 #include <openssl/err.h>
@@ -55,11 +91,11 @@ void print_ssl_error (char *func) {
   char buffer[120]; int err;
   while (err = ERR_get_error()) {
     ERR_error_string (err, buffer);
-    printf ("%s: %d, %s\n", func, err, buffer); fflush (stdout);
+    log_error ("%s: %d, %s\n", func, err, buffer);
   } 
 }
 
-SSL_CTX *ssl_ctx = NULL;
+THREAD_LOCAL SSL_CTX *ssl_ctx = NULL;
 
 int bio_read (BIO *bio, char *buffer, int size) {
   TcpPort *p = BIO_get_data (bio);
@@ -98,8 +134,6 @@ void init_bio () {
 
 typedef int (*VerifyFunc) (void *ctx, uint8_t *cert, int length);
 
-VerifyFunc _verify_peer = NULL;
-
 /* verify the presence of critical and non-critical extensions required by
    sections 8.11.6, 8.11.8, and 8.11.10 */
 int check_cert (int status, X509 *cert) {
@@ -129,22 +163,65 @@ int verify_peer (int status, X509_STORE_CTX *ctx) {
   SSL *ssl = X509_STORE_CTX_get_ex_data
     (ctx, SSL_get_ex_data_X509_STORE_CTX_idx ());
   void *user = SSL_get_app_data (ssl);
+  // the verify function is kept with the context (see tls_init)
+  VerifyFunc verify = SSL_CTX_get_app_data (SSL_get_SSL_CTX (ssl));
   X509 *x509 = X509_STORE_CTX_get0_cert (ctx), // peer cert
     *curr = X509_STORE_CTX_get_current_cert (ctx);
   status = check_cert (status, x509);
   if (x509 != curr) return status; // only check the peer cert
-  if (x509 && _verify_peer) {
+  if (x509 && verify) {
     int length = i2d_X509 (x509, NULL);
     uint8_t *cert, *p = malloc (sha256_size (length)); cert = p;
     i2d_X509 (x509, &p);
-    if (!_verify_peer (user, cert, length)) status = 0;
+    if (!verify (user, cert, length)) status = 0;
     free (cert);
   } return status;
 }
 
 const uint8_t *ssl_session_id (void *ssl) {
   SSL_SESSION *ss = SSL_get_session (ssl);
-  return SSL_SESSION_get0_id_context (ss, NULL);
+  return ss? SSL_SESSION_get_id (ss, NULL) : NULL;
+}
+
+/* Client sessions are cached per server Address, each SSL holds the cache
+   entry of its server so that new sessions (including TLS 1.3 tickets sent
+   after the handshake) replace the cached session. */
+typedef struct _TlsSession {
+  struct _TlsSession *next;
+  Address server;
+  SSL_SESSION *session;
+} TlsSession;
+
+THREAD_LOCAL TlsSession *tls_sessions = NULL;
+THREAD_LOCAL unsigned tls_resumed = 0, tls_full = 0;
+int ssl_cache_index = -1;
+
+TlsSession *tls_cache_entry (Address *server) { TlsSession *t;
+  foreach (t, tls_sessions)
+    if (address_eq (&t->server, server)) return t;
+  t = type_alloc (TlsSession); t->session = NULL;
+  address_copy (&t->server, server);
+  link_insert (tls_sessions, t); return t;
+}
+
+int ssl_new_session (SSL *ssl, SSL_SESSION *session) {
+  TlsSession *t = SSL_get_ex_data (ssl, ssl_cache_index);
+  if (!t) return 0;
+  if (t->session) SSL_SESSION_free (t->session);
+  t->session = session; return 1;
+}
+
+void ssl_resume (void *ssl, Address *server) {
+  TlsSession *t = tls_cache_entry (server);
+  SSL_set_ex_data (ssl, ssl_cache_index, t);
+  if (t->session) SSL_set_session (ssl, t->session);
+}
+
+void ssl_forget (void *ssl) {
+  TlsSession *t = SSL_get_ex_data (ssl, ssl_cache_index);
+  if (t && t->session) {
+    SSL_SESSION_free (t->session); t->session = NULL;
+  }
 }
 
 int ssl_load_cert (const char *path) {
@@ -166,15 +243,23 @@ void load_cert_dir (const char *path) {
   process_dir (path, NULL, _load_cert);
 }
 
-int _tls_initialized = 0;
+THREAD_LOCAL int _tls_initialized = 0;
+pthread_once_t tls_once = PTHREAD_ONCE_INIT;
+
+// process wide state, shared by the contexts of every thread
+void tls_global_init () {
+  init_bio ();
+  ssl_cache_index = SSL_get_ex_new_index (0, NULL, NULL, NULL, NULL);
+}
 
 void tls_init (const char *path, VerifyFunc verify) {
   int ret, type, curves[] = {NID_X9_62_prime256v1};
   char *private = strdup (path), *ext;
+  pthread_once (&tls_once, tls_global_init);
   if ((ssl_ctx = SSL_CTX_new (TLS_method ())) == NULL) {
     print_ssl_error ("tls_init"); exit (0);
   }
-  init_bio (); _verify_peer = verify;
+  SSL_CTX_set_app_data (ssl_ctx, (void *)verify);
   SSL_CTX_set_verify (ssl_ctx, SSL_VERIFY_PEER |
 		      SSL_VERIFY_FAIL_IF_NO_PEER_CERT, verify_peer);
   if (!SSL_CTX_set_cipher_list (ssl_ctx, CIPHER_LIST)) {
@@ -182,6 +267,13 @@ void tls_init (const char *path, VerifyFunc verify) {
     exit (0);
   }
   SSL_CTX_set_options (ssl_ctx, SSL_OP_CIPHER_SERVER_PREFERENCE);
+  // cache sessions for resumption, the server needs a session ID context
+  SSL_CTX_set_session_cache_mode (ssl_ctx, SSL_SESS_CACHE_BOTH);
+  SSL_CTX_sess_set_new_cb (ssl_ctx, ssl_new_session);
+  SSL_CTX_set_session_id_context (ssl_ctx, (uint8_t *)"sep2", 4);
+  // queued data is written from coalesced buffers that may move
+  SSL_CTX_set_mode (ssl_ctx, SSL_MODE_ENABLE_PARTIAL_WRITE
+		    | SSL_MODE_ACCEPT_MOVING_WRITE_BUFFER);
   SSL_CTX_set1_curves (ssl_ctx, curves, 1);
   if (ext = strstr (private, ".x509")) {
     strcpy (ext, ".pem"); type = SSL_FILETYPE_ASN1;
@@ -198,6 +290,18 @@ void tls_init (const char *path, VerifyFunc verify) {
   } free (private); _tls_initialized = 1;
 }
 
+void *tls_context () {
+  return _tls_initialized? ssl_ctx : NULL;
+}
+
+void tls_share (void *tls) {
+  pthread_once (&tls_once, tls_global_init);
+  if (!tls || tls == ssl_ctx) return;
+  SSL_CTX_up_ref (tls);
+  if (ssl_ctx) SSL_CTX_free (ssl_ctx);
+  ssl_ctx = tls; _tls_initialized = 1;
+}
+
 void *ssl_new (void *conn) {
   if (_tls_initialized) {
     BIO *bio = BIO_new (ssl_bio);
@@ -213,25 +317,35 @@ void *ssl_new (void *conn) {
 #define ssl_free(ssl) SSL_free (ssl)
 #define ssl_close(ssl) SSL_shutdown (ssl)
 
-int ssl_ret, ssl_err;
+THREAD_LOCAL int ssl_ret, ssl_err;
 
 #define ssl_pending() \
   (ssl_err == SSL_ERROR_WANT_READ || ssl_err == SSL_ERROR_WANT_WRITE)
 
-int ssl_handshake (void *ssl) { ERR_clear_error ();
-  if ((ssl_ret = SSL_do_handshake (ssl)) == 1) return 1;
+int ssl_handshake (void *ssl) { int64_t t = stat_begin ();
+  ERR_clear_error (); ssl_ret = SSL_do_handshake (ssl);
+  stat_end (STAT_TLS_HANDSHAKE, t);
+  if (ssl_ret == 1) {
+    if (SSL_session_reused (ssl)) tls_resumed++; else tls_full++;
+    return 1;
+  }
   ssl_err = SSL_get_error (ssl, ssl_ret);
+  if (!ssl_pending ()) ssl_forget (ssl);
   return 0;
 }
 
-int ssl_read (void *ssl, char *buffer, int size) { int ret;
+int ssl_read (void *ssl, char *buffer, int size) {
+  int ret; int64_t t = stat_begin ();
   ERR_clear_error (); ret = SSL_read (ssl, buffer, size);
+  stat_end (STAT_TLS_READ, t);
   if (ret <= 0) ssl_err = SSL_get_error (ssl, ret); 
   return ret;
 }
 
-int ssl_write (void *ssl, const char *data, int length) { int ret;
+int ssl_write (void *ssl, const char *data, int length) {
+  int ret; int64_t t = stat_begin ();
   ERR_clear_error (); ret = SSL_write (ssl, data, length);
+  stat_end (STAT_TLS_WRITE, t);
   if (ret <= 0) ssl_err = SSL_get_error (ssl, ret);
   return ret;
 }
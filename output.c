@@ -59,11 +59,23 @@ int output_complete (Output *o);
 */
 int output_doc (Output *o, void *obj, int type);
 
+/** @brief Continue the output of a document in a new buffer.
+
+    After @ref output_doc returns a partial document the output can be
+    continued in a different buffer, leaving the previous buffer (and the
+    output returned) to the caller. This allows a document of any length to
+    be streamed in chunks (see @ref http_stream).
+    @param o is a pointer to an Output object
+    @param buffer is the container for the output
+    @param size is the size of the buffer
+*/
+void output_buffer (Output *o, char *buffer, int size);
+
 /** @} */
 
 #ifdef HEADER_ONLY
 
-extern Output output_global;
+extern THREAD_LOCAL Output output_global;
 
 #else
 
@@ -89,16 +101,20 @@ typedef struct _Output {
      exception of the root element, the current event code starts at 0 and is
      advanced by skiping optional attributes and elements. */
   int n; // the number of possible event codes
+  int width; // the number of bits of an event code, bit_count (n)
   int code; // the current EXI event code
   int bit, flag;
-  StringTable *global, *local;
+  StringTable *global, **local;
   const struct _OutputDriver *driver;
   SubstitutionType *st;
   unsigned int open : 1;
   unsigned int first : 1;
+  unsigned int packed : 1; // bit packed output (EXI)
+  unsigned int resume : 1; // output resumes after the buffer was full
+  uint8_t carry; // the partial byte when the buffer was full
 } Output;
 
-Output output_global;
+THREAD_LOCAL Output output_global;
 
 enum OutputEvent {EE_EVENT, AT_EVENT, SE_SIMPLE, SE_COMPLEX};
 
@@ -108,6 +124,8 @@ typedef struct _OutputDriver {
   int (*output_attr_value) (Output *, void *);
   int (*output_value) (Output *, void *);
   void (*output_done) (Output *);
+  // specialized output of a complete document, 0 to use the driver
+  int (*output_codec) (Output *, void *, int);
 } OutputDriver;
 
 int output_string (Output *o, char *format, ...) {
@@ -140,6 +158,12 @@ int output_count (void *base, const SchemaEntry *se) {
   } return se->min;
 }
 
+/* Set the number of event codes of an element context given the count of
+   the element, the width of the codes is precomputed by the generator. */
+#define event_codes(o, se, count)					\
+  if ((count) < (se)->min) (o)->n = (o)->width = 1;			\
+  else (o)->n = (se)->n, (o)->width = (se)->width
+
 int output_item_count (Output *o, int level) {
   return o->stack.items[level].count;
 }
@@ -152,16 +176,31 @@ int output_complete (Output *o) {
   return o->state == OUTPUT_COMPLETE;
 }
 
+void output_buffer (Output *o, char *buffer, int size) {
+  o->ptr = o->buffer = buffer; o->end = buffer+size;
+}
+
+// continue bit packed output with the partial byte
+void output_resume (Output *o) {
+  o->resume = 0;
+  if (o->packed && o->bit) *o->ptr = o->carry;
+}
+
 int output_doc (Output *o, void *base, int type) {
   ElementStack *stack = &o->stack; StackItem *t;
   const SchemaEntry *se; int length;
   const OutputDriver *d = o->driver; List *q;
+  if (o->resume) output_resume (o);
   while (1) {
     switch (o->state) {
     case OUTPUT_START:
       if (type >= o->schema->length) return 0;
+      if (d->output_codec && (length = d->output_codec (o, base, type))) {
+	o->state = OUTPUT_COMPLETE; return length;
+      }
       o->se = &o->schema->entries[type];
       o->code = type; o->n = o->schema->length;
+      o->width = bit_count (o->n);
       o->base = base; o->state++; o->first = 1;
     case OUTPUT_ELEMENT:
       se = o->se; base = o->base; o->flag = se->bit;
@@ -186,12 +225,12 @@ int output_doc (Output *o, void *base, int type) {
     element_next: o->se = pop_element (stack, &o->base);
     output_next: o->se++; se = o->se;
       if (o->n) o->code++;
-      else o->n = se->min? 1 : se->n;
+      else event_codes (o, se, 0);
       o->state = se->n? OUTPUT_ELEMENT : OUTPUT_END; break;
     case OUTPUT_XSI_TYPE:
       if (d->output_xsi_type (o)) {
 	se = o->se = &o->schema->entries[o->st->type+1];
-	o->n = se->min? 1 : se->n;
+	event_codes (o, se, 0);
 	o->state = OUTPUT_ELEMENT;
       } else goto full; break;
     case OUTPUT_ATTRIBUTE:
@@ -214,7 +253,7 @@ int output_doc (Output *o, void *base, int type) {
 	t->count++; // handle element sequences
 	if (t->count == se->max || t->count == o->limit)
 	  goto element_next;
-	o->n = t->count < se->min? 1 : se->n;
+	event_codes (o, se, t->count);
 	if (se->unbounded) {
 	  queue_remove (&t->queue);
 	  if (q = queue_peek (&t->queue))
@@ -234,7 +273,7 @@ int output_doc (Output *o, void *base, int type) {
       if (d->output_event (o, se, SE_COMPLEX)) {
 	// jump to the element definition
         o->se = &o->schema->entries[se->index+1];
-	o->n = o->se->min? 1 : o->se->n;
+	event_codes (o, o->se, 0);
 	if (se->st) {
 	  o->st = o->base;
 	  o->base = o->st->data;
@@ -258,6 +297,7 @@ int output_doc (Output *o, void *base, int type) {
   }
  full:
   length = o->ptr - o->buffer;
+  o->carry = o->bit? *o->ptr : 0; o->resume = 1;
   o->ptr = o->buffer;
   return length;
 }
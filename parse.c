@@ -25,6 +25,8 @@
     @{
 */
 
+#include "arena.c"
+
 typedef struct _Parser Parser;
 
 /** @brief Parse an XML or EXI document.
@@ -50,7 +52,7 @@ void *parse_doc (Parser *p, int *type);
 */
 int parse_error (Parser *p);
 
-/** @brief Print the current parse stack.
+/** @brief Write the current parse stack to the log.
     @param p is a pointer to a Parser
 */
 void print_parse_stack (Parser *p);
@@ -63,6 +65,16 @@ Parser *parser_new ();
 */
 void parser_free (Parser *p);
 
+/** @brief Allocate the objects parsed from an Arena.
+
+    Call after @ref parse_init or @ref exi_parse_init. The objects returned
+    by @ref parse_doc are then owned by the Arena, they must not be freed with
+    @ref free_object but are released with @ref arena_reset.
+    @param p is a pointer to a Parser
+    @param a is a pointer to an Arena, or NULL to allocate with malloc
+*/
+void parser_arena (Parser *p, Arena *a);
+
 /** @brief Return a pointer to a Parser's unparsed data
     @param p is a pointer to a Parser
 */
@@ -120,12 +132,14 @@ typedef struct _Parser {
   const Schema *schema;
   const SchemaEntry *se;
   const struct _ParserDriver *driver;
+  Arena *arena; // allocate objects from an arena (if not NULL)
   void *base; uint8_t *ptr, *end;
-  StringTable *global, *local;
+  StringTable *global, **local;
   SubstitutionType *st;
   // parse_uint result
   union { uint64_t ux; int64_t sx; };
   int token, n, ux_n;
+  int tag; // local name index of the current XML tag
   char state, exi_state, flag, bit;
   unsigned int sign : 1;
   unsigned int ch : 2;
@@ -146,6 +160,8 @@ typedef struct _ParserDriver {
   int (*parse_value) (Parser *, void *);
   void (*parse_done) (Parser *);
   void (*rebuffer) (Parser *, char *, int length);
+  // specialized parse of a complete document, NULL to use the driver
+  void *(*parse_codec) (Parser *, int *);
 } ParserDriver;
 
 StackItem *push_element (ElementStack *stack, const SchemaEntry *se,
@@ -168,10 +184,9 @@ int parse_error (Parser *p) { return p->state != PARSE_START; }
 
 void print_stack (ElementStack *stack, const Schema *schema) {
   StackItem *t = stack->items; int i;
-  printf ("parse_stack:\n");
+  log_printf ("parse_stack:\n");
   for (i = 0; i < stack->n; i++, t++)
-    printf ("  %d %s\n", i, se_name (t->se, schema));
-  fflush (stdout);
+    log_printf ("  %d %s\n", i, se_name (t->se, schema));
 }
 
 void print_parse_stack (Parser *p) {
@@ -187,8 +202,17 @@ void parser_rebuffer (Parser *p, void *data, int length) {
 #define set_count(flags, count, bit) \
   *(uint32_t *)(flags) |= (count) << (bit)
 
-void *add_element (StackItem *t) {
-  List *l = list_insert (NULL, calloc (1, t->size)); 
+void *parse_alloc (Parser *p, int size) {
+  return p->arena? arena_alloc (p->arena, size) : calloc (1, size);
+}
+
+char *parse_strdup (Parser *p, const char *s) {
+  return p->arena? arena_strdup (p->arena, s) : strdup (s);
+}
+
+void *add_element (Parser *p, StackItem *t) {
+  List *l = parse_alloc (p, sizeof (List));
+  l->data = parse_alloc (p, t->size);
   queue_add (&t->queue, l); return l;
 }
 
@@ -201,10 +225,12 @@ void *parse_doc (Parser *p, int *type) {
   while (1) {
     switch (p->state) {
     case PARSE_START:
+      if (d->parse_codec && (p->obj = d->parse_codec (p, type)))
+	return p->obj;
       ok (d->parse_start (p));
       stack->n = 0; p->state++;
       size = object_size (p->type, p->schema);
-      p->obj = p->base = calloc (1, size); break;
+      p->obj = p->base = parse_alloc (p, size); break;
     case PARSE_ELEMENT:
       se = p->se; p->flag = se->bit;
       if (se->attribute) {
@@ -214,7 +240,7 @@ void *parse_doc (Parser *p, int *type) {
       } else if (t = push_element (stack, se, p->base, p->schema)) {
 	p->base += se->offset;
 	if (se->unbounded) {
-	  List *l = *(List **)p->base = add_element (t);
+	  List *l = *(List **)p->base = add_element (p, t);
 	  p->base = l->data;
 	} else {
 	  t->diff = se->max - se->min;
@@ -245,7 +271,8 @@ void *parse_doc (Parser *p, int *type) {
 	p->st->type = xsi_type;
 	p->se = &p->schema->entries[xsi_type+1];
       } else xsi_type = p->se - p->schema->entries - 1; 
-      p->base = p->st->data = calloc (1, object_size (xsi_type, p->schema));
+      size = object_size (xsi_type, p->schema);
+      p->base = p->st->data = parse_alloc (p, size);
       p->state = PARSE_NEXT;
       break;
     parse_value:
@@ -268,7 +295,7 @@ void *parse_doc (Parser *p, int *type) {
       t = stack_top (stack); se = t->se;
       if (d->parse_sequence (p, t)) {
 	if (se->unbounded)
-	  p->base = list_data (add_element (t));
+	  p->base = list_data (add_element (p, t));
 	else if (t->count < se->max)
 	  p->base += t->size;
 	else goto parse_error;
@@ -291,4 +318,6 @@ Parser *parser_new () { return calloc (1, sizeof (Parser)); }
 
 void parser_free (Parser *p) { if (p->xml) free (p->xml); free (p); }
 
+void parser_arena (Parser *p, Arena *a) { p->arena = a; }
+
 #endif
@@ -0,0 +1,140 @@
+// Copyright (c) 2018 Electric Power Research Institute, Inc.
+// author: Mark Slicker <mark.slicker@gmail.com>
+
+/** @defgroup parse_pool Parse Pool
+
+    Provides an optional pool of worker threads that parse complete documents
+    off the event loop. A thread submits a ParseJob and continues with other
+    work, the parsed job is returned to the submitting thread through its own
+    completion queue and the thread is woken up with a notifier that returns
+    PARSE_DONE from @ref event_poll. Jobs and their results are handed between
+    threads with lock-free queues (see @ref MpscQueue).
+    @{
+*/
+
+#define PARSE_DONE (EVENT_NEW+21)
+
+typedef struct _ParseOwner ParseOwner;
+
+/** @brief A document to be parsed by a worker */
+typedef struct _ParseJob {
+  struct _ParseJob *next; ///< is a pointer to the next job
+  void *context; ///< is user defined context
+  const Schema *schema; ///< is the schema of the document
+  int exi; ///< is 1 for an EXI document, 0 for XML
+  Arena *arena; ///< is the Arena to parse into, NULL to use malloc
+  char *data; ///< is a copy of the document, freed once parsed
+  int length; ///< is the length of the document
+  void *obj; ///< is the parsed object, NULL if the parse failed
+  int type; ///< is the type of the parsed object
+  ParseOwner *owner; ///< is the submitting thread
+} ParseJob;
+
+/** @brief Start the parse worker threads.
+    @param n is the number of worker threads
+*/
+void parse_pool_start (int n);
+
+/** @brief Is the parse pool running?
+    @returns the number of worker threads, 0 if none were started
+*/
+int parse_pool_size ();
+
+/** @brief Submit a document to be parsed by a worker.
+
+    The calling thread receives a PARSE_DONE event once the job is parsed and
+    should then call @ref parse_pool_done until it returns NULL.
+    @param job is a pointer to a ParseJob with the schema, document and
+    context set, the data must be allocated and is owned by the job
+    @returns 1 if the job was submitted, 0 if there are no workers
+*/
+int parse_submit (ParseJob *job);
+
+/** @brief Return the next job parsed for the calling thread.
+    @returns a pointer to a ParseJob or NULL if there are none
+*/
+ParseJob *parse_pool_done ();
+
+/** @} */
+
+#ifndef HEADER_ONLY
+
+#include <pthread.h>
+
+typedef struct {
+  pthread_t thread;
+  MpscQueue in; // jobs from the event loop threads
+  Timer *wake; // notifier of the worker
+} ParseWorker;
+
+typedef struct _ParseOwner {
+  MpscQueue done; // parsed jobs
+  Queue batch; // parsed jobs drained by the owner
+  Timer *wake; // notifier of the owner
+} ParseOwner;
+
+ParseWorker *_parse_workers = NULL;
+int _n_parse_workers = 0;
+THREAD_LOCAL ParseOwner *_parse_owner = NULL;
+THREAD_LOCAL unsigned _parse_next = 0;
+
+void parse_job (Parser *p, ParseJob *job) {
+  if (job->exi) exi_parse_init (p, job->schema, job->data, job->length);
+  else parse_init (p, job->schema, job->data);
+  parser_arena (p, job->arena);
+  if (!(job->obj = parse_doc (p, &job->type))) {
+    log_warn ("parse error in message body\n");
+    if (log_enabled (LOG_WARN)) print_parse_stack (p);
+  } free (job->data); job->data = NULL;
+}
+
+void parse_jobs (ParseWorker *w, Parser *p) { ParseJob *job;
+  while (job = mpsc_remove (&w->in)) { ParseOwner *o = job->owner;
+    parse_job (p, job); mpsc_add (&o->done, job); notify (o->wake);
+  }
+}
+
+void *parse_worker (void *arg) {
+  ParseWorker *w = arg; Parser *p = parser_new (); void *any;
+  platform_init ();
+  __atomic_store_n (&w->wake, add_notify (PARSE_DONE), __ATOMIC_SEQ_CST);
+  // jobs submitted before the notifier was published
+  parse_jobs (w, p);
+  while (1) if (event_poll (&any, -1) == PARSE_DONE) parse_jobs (w, p);
+  return NULL;
+}
+
+void parse_pool_start (int n) { int i;
+  if (_n_parse_workers || n < 1) return;
+  _parse_workers = calloc (n, sizeof (ParseWorker));
+  for (i = 0; i < n; i++) mpsc_init (&_parse_workers[i].in);
+  _n_parse_workers = n;
+  for (i = 0; i < n; i++) {
+    ParseWorker *w = _parse_workers+i;
+    pthread_create (&w->thread, NULL, parse_worker, w);
+  }
+}
+
+int parse_pool_size () { return _n_parse_workers; }
+
+int parse_submit (ParseJob *job) {
+  ParseWorker *w; ParseOwner *o; Timer *t;
+  if (!_n_parse_workers) return 0;
+  if (!(o = _parse_owner)) {
+    o = _parse_owner = type_alloc (ParseOwner);
+    mpsc_init (&o->done); o->wake = add_notify (PARSE_DONE);
+  }
+  job->owner = o; job->obj = NULL;
+  w = _parse_workers + _parse_next++ % _n_parse_workers;
+  mpsc_add (&w->in, job);
+  if (t = __atomic_load_n (&w->wake, __ATOMIC_SEQ_CST)) notify (t);
+  return 1;
+}
+
+ParseJob *parse_pool_done () { ParseOwner *o = _parse_owner;
+  if (!o) return NULL;
+  if (queue_empty (&o->batch)) mpsc_drain (&o->done, &o->batch);
+  return queue_remove (&o->batch);
+}
+
+#endif
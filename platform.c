@@ -3,6 +3,12 @@
 
 #include <stdint.h>
 
+/* state kept per thread so that multiple reactors (each with an event loop)
+   can run in the same process */
+#ifndef THREAD_LOCAL
+#define THREAD_LOCAL __thread
+#endif
+
 /** @defgroup platform Platform
     @{
 */
@@ -22,6 +28,14 @@ void platform_init ();
 void set_timezone (int tz_offset, int dst_offset,
 		   time_t dst_start, time_t dst_end);
 
+/** @brief Return the heap memory in use by the process.
+
+    The memory is that allocated and not yet freed, as counted by the
+    allocator, it includes the memory of all the threads.
+    @returns the number of bytes in use
+*/
+int64_t heap_usage ();
+
 /** @defgroup event Event
     @{
  */
@@ -37,6 +51,7 @@ enum EventType {
   TCP_TIMEOUT, ///< A TcpPort that timed out
   TIMER_EVENT, ///< A timer that expired.
   POLL_TIMEOUT, ///< The event_poll function timed out waiting for an event.
+  REPLAY_END, ///< The end of a replayed event log (see @ref replay).
   EVENT_NEW=32 ///< A place holder for higher level events.
 };
 
@@ -51,6 +66,98 @@ enum EventType {
 */
 int event_poll (void **any, int timeout);
 
+/** An EventItem is an event returned by @ref event_poll_n. */
+typedef struct {
+  int type; ///< is the EventType
+  void *any; ///< is the event object pointer
+} EventItem;
+
+/** @brief Poll a batch of events from the Platform layer.
+
+    Like @ref event_poll but returns all the events that are ready (up to
+    count) in one call. Each TcpPort or UdpPort returned should be read
+    before the next call to event_poll or event_poll_n.
+    @param items is an array that receives the events
+    @param count is the size of the items array
+    @param timeout is the polling timeout in milliseconds, or -1 to indicate
+    an infitie timeout.
+    @returns the number of events stored in items, 0 if the poll timed out
+*/
+int event_poll_n (EventItem *items, int count, int timeout);
+
+/** @brief Set the number of events retrieved from the system per poll.
+
+    The size can only be changed when there are no events left over from the
+    previous poll, the default is 64. The io_uring backend reads completions
+    from the ring directly, so the size has no effect there.
+    @param size is the maximum number of events per system call
+*/
+void event_batch (int size);
+
+/** @} */
+
+/** @defgroup replay Record/Replay
+
+    Records the input of an event loop at the platform boundary, so that the
+    traffic of a session can be replayed without a network or a server. The
+    log holds the results of @ref event_poll and @ref event_poll_n, the data
+    returned by @ref net_read and @ref net_receive, and the values of
+    @ref se_time (the clock only when it changes), in a compact binary form.
+    Timer expiry is recorded as the event_poll result.
+
+    In replay the log is fed back as fast as possible: event_poll never
+    blocks, connections are not made and writes are discarded, and se_time
+    returns the recorded (virtual) time. The platform objects (TcpPorts,
+    UdpPorts, Timers) are identified by the order in which they are
+    registered, so recording or replay should start before the first object
+    is created and the application should be deterministic for the same
+    input. TLS sessions can't be replayed as the handshake is randomized.
+    The record/replay state is per thread.
+    @{
+*/
+
+/** @brief The record/replay modes returned by @ref replay_mode */
+enum ReplayMode {
+  REPLAY_OFF, ///< normal operation
+  REPLAY_RECORD, ///< recording the input to a log
+  REPLAY_PLAY ///< replaying the input from a log
+};
+
+/** @brief Record the input of the calling thread.
+    @param name is the name of the log file to create
+    @returns 1 on success, 0 if the file could not be created
+*/
+int replay_record (const char *name);
+
+/** @brief Replay the input recorded in a log.
+
+    The end of the log is returned by @ref event_poll as REPLAY_END, as is a
+    divergence of the application from the recorded input.
+    @param name is the name of the log file
+    @returns 1 on success, 0 if the file could not be opened or is not a log
+*/
+int replay_open (const char *name);
+
+/** @brief Return the record/replay mode of the calling thread. */
+int replay_mode ();
+
+/** @brief Record or replay the clock.
+    @param t is the current time
+    @returns t, or the recorded time in replay
+*/
+int64_t replay_time (int64_t t);
+
+/** @brief Record or replay a measured value that the application depends
+    upon (such as a latency).
+    @param v is the measured value
+    @returns v, or the recorded value in replay
+*/
+int64_t replay_value (int64_t v);
+
+/** @brief Print a summary of the replay (events, reads, elapsed time and
+    throughput). */
+void replay_print ();
+
 /** @} */
 
 /** @defgroup file File
@@ -69,6 +176,45 @@ enum FileType {FILE_NONE, FILE_REGULAR, FILE_DIR};
 */
 char *file_read (const char *name, int *length);
 
+/** @brief Map the contents of a file into memory.
+
+    The mapping is private, changes to the memory are not written to the file.
+    @param name is the name of the file to map
+    @param length is a pointer to the returned length of the file
+    @returns a pointer to the contents of the file, NULL if the file could not
+    be mapped
+*/
+void *file_map (const char *name, int *length);
+
+/** @brief Unmap the contents of a file mapped with @ref file_map.
+    @param data is a pointer to the contents of the file
+    @param length is the length of the file
+*/
+void file_unmap (void *data, int length);
+
+/** @brief Get the modification time and the size of a file.
+    @param name is the name of the file
+    @param mtime is a pointer to the returned modification time in
+    nanoseconds since the epoch
+    @param size is a pointer to the returned size of the file
+    @returns 1 on success, 0 if the file could not be accessed
+*/
+int file_stat (const char *name, int64_t *mtime, int64_t *size);
+
+/** @brief Open a file for reading.
+    @param name is the name of the file
+    @param mtime is a pointer to the returned modification time in
+    nanoseconds since the epoch
+    @param size is a pointer to the returned size of the file
+    @returns a file descriptor, or -1 if the file could not be opened
+*/
+int file_open (const char *name, int64_t *mtime, int64_t *size);
+
+/** @brief Close a file opened with @ref file_open.
+    @param fd is the file descriptor
+*/
+void file_close (int fd);
+
 /** @brief Determine the file type given its name.
     @param name is the name of the file
     @returns the @ref FileType.
@@ -106,6 +252,12 @@ typedef struct _ClockTime ClockTime;
  */
 void set_timer (Timer *timer, int timeout);
 
+/** @brief Set the timeout for a Timer in milliseconds.
+    @param timer is a pointer to the Timer
+    @param ms is the timeout in milliseconds, 0 disarms the timer
+ */
+void set_timer_ms (Timer *timer, int ms);
+
 void set_timer_ct (Timer *timer, ClockTime *ct);
 
 /** @brief Create a new timer.
@@ -128,6 +280,20 @@ Timer *add_timer (int type);
 */
 Timer *new_timer (int type, int timeout);
 
+/** @brief Create a notifier, a timer that expires when signaled.
+
+    A notifier can be signaled from any thread to wake up the @ref event_poll
+    of the thread that created it.
+    @param type is the event type to be returned by event_poll
+    @returns a new notifier
+*/
+Timer *add_notify (int type);
+
+/** @brief Signal a notifier.
+    @param timer is a pointer to a notifier created with @ref add_notify
+*/
+void notify (Timer *timer);
+
 /** @} */
 
 /** @defgroup network Network
@@ -208,6 +374,20 @@ Address *net_local (Address *addr, void *port);
 */
 int net_status (void *port);
 
+/** @brief Hold a TcpPort whose input can't be processed yet.
+
+    A TcpPort is returned by @ref event_poll again while it has input left
+    to read, a held port is not (unless more input arrives) until it is
+    resumed with @ref net_resume.
+    @param port is a pointer to a TcpPort
+*/
+void net_hold (void *port);
+
+/** @brief Return a held TcpPort from the next call to @ref event_poll.
+    @param port is a pointer to a TcpPort
+*/
+void net_resume (void *port);
+
 /** @brief An Acceptor represents a queue of clients waiting to
     establish a TCP connection on a specific address/port. */
 typedef struct _Acceptor Acceptor;
@@ -235,6 +415,19 @@ void net_accept (void *port, Acceptor *a);
 */
 void net_connect (void *port, Address *server);
 
+/** @brief Establish a TCP connection with a host that has several addresses.
+
+    The addresses are tried in turn (IPv6 first, alternating address
+    families), each attempt starting 250 ms after the previous one or as
+    soon as it fails, and the first to connect is kept. Addresses that
+    failed recently are tried last. The port receives a single TCP_CONNECT,
+    TCP_CLOSED (all the attempts failed), or TCP_TIMEOUT event.
+    @param port is a pointer to a TcpPort
+    @param servers is an array of host Addresses
+    @param n is the number of Addresses
+*/
+void net_connect_any (void *port, Address *servers, int n);
+
 /** @brief Read data from a TcpPort.
     @param port is a pointer to a TcpPort
     @param buffer is a container for the data to be read
@@ -251,6 +444,32 @@ int net_read (void *port, char *buffer, int length);
 */
 int net_write (void *port, const char *buffer, int length);
 
+/** @brief A segment of data for a gathered write */
+typedef struct {
+  const char *data; ///< is a pointer to the data
+  int length; ///< is the length of the data
+} DataSegment;
+
+/** @brief Write a number of data segments to a TcpPort with one operation.
+    @param port is a pointer to a TcpPort
+    @param seg is an array of data segments
+    @param n is the number of segments (up to 16 are written)
+    @returns the length of the data written or -1 on failure
+*/
+int net_writev (void *port, const DataSegment *seg, int n);
+
+/** @brief Write data from a file to a TcpPort.
+
+    The data is copied to the socket by the system, without being read into
+    a buffer first.
+    @param port is a pointer to a TcpPort
+    @param fd is a file descriptor returned by @ref file_open
+    @param offset is the offset in the file of the data
+    @param length is the length of the data
+    @returns the length of the data written or -1 on failure
+*/
+int net_sendfile (void *port, int fd, int64_t offset, int length);
+
 /** @brief Close a TCP connection.
     @param port is a pointer to a TcpPort
 */
@@ -284,8 +503,24 @@ char *net_receive (UdpPort *p, int *length);
 */
 int net_send (UdpPort *p, char *data, int length, Address *address);
 
+/** @brief Send a batch of UDP datagrams to a host Address from a UdpPort.
+
+    On Linux (with _GNU_SOURCE) the datagrams are sent with sendmmsg, as
+    net_receive receives with recvmmsg, otherwise they are sent one at a time.
+    @param p is a pointer to a UdpPort
+    @param data is an array of pointers to the datagrams
+    @param length is an array of the lengths of the datagrams
+    @param count is the number of datagrams
+    @param address is a pointer to the Address of the host to receive the
+    datagrams
+    @returns the number of datagrams sent
+*/
+int net_send_batch (UdpPort *p, char **data, int *length, int count,
+		    Address *address);
+
 /** @brief Allocate a new UdpPort.
-    @param size is the size of the buffer to receive datagrams
+    @param size is the size of the buffer to receive datagrams, with batched
+    receives there is a buffer of this size for each datagram of a batch
     @returns a pointer to a UdpPort with buffer of the requested size
 */
 UdpPort *new_udp_port (int size);
@@ -0,0 +1,99 @@
+// Copyright (c) 2018 Electric Power Research Institute, Inc.
+// author: Mark Slicker <mark.slicker@gmail.com>
+
+/** @defgroup pool Pool
+
+    Provides pools of fixed size objects for short lived allocations that
+    churn constantly (queued events, schedule blocks, HTTP requests). Objects
+    are carved from slabs of POOL_SLAB bytes and a freed object is kept on
+    the free list of its pool for reuse, slabs are never released. Pools are
+    thread local so the allocations of each reactor thread take no locks, an
+    object freed by another thread joins the free list of that thread. Build
+    with NO_POOL to allocate each object with calloc (e.g. for memory
+    checkers).
+    @{
+*/
+
+#ifndef POOL_SLAB
+#define POOL_SLAB 16384
+#endif
+
+/** @brief A Pool of objects of the same size */
+typedef struct _Pool {
+  struct _Pool *next; ///< is the next pool of the thread
+  const char *name; ///< is the name of the pool
+  int size; ///< is the object size
+  void *free; ///< is the list of free objects
+  char *slab, *end; ///< is the unused part of the current slab
+  int slabs; ///< is the number of slabs
+  int used; ///< is the number of objects in use
+  uint64_t allocs; ///< is the total number of allocations
+} Pool;
+
+/** @brief Define a thread local pool of objects of a type.
+
+    Defines the functions name_alloc, which returns a zero initialized
+    object, and name_free.
+*/
+#define global_pool(name, type) \
+  THREAD_LOCAL Pool name##_pool = {NULL, #name, sizeof (type)};		\
+  type *name##_alloc () { return pool_alloc (&name##_pool); }		\
+  void name##_free (type *x) { pool_free (&name##_pool, x); }
+
+/** @brief Allocate a zero initialized object from a pool.
+    @param p is a pointer to a Pool
+    @returns a pointer to the object
+*/
+void *pool_alloc (Pool *p);
+
+/** @brief Return an object to a pool.
+    @param p is a pointer to a Pool
+    @param x is a pointer to an object allocated from the pool
+*/
+void pool_free (Pool *p, void *x);
+
+/** @brief Print the statistics of the pools of the calling thread.
+    @param f is the output file
+*/
+void pool_print (FILE *f);
+
+/** @} */
+
+#ifndef HEADER_ONLY
+
+THREAD_LOCAL Pool *_pools = NULL; // the pools of the thread (allocated from)
+
+void *pool_alloc (Pool *p) { void *x;
+  if (!p->allocs++) { // the first allocation from the pool
+    p->size = max ((p->size + 7) & ~7, sizeof (void *));
+    link_insert (_pools, p);
+  } p->used++;
+#ifdef NO_POOL
+  return calloc (1, p->size);
+#endif
+  if (x = p->free) p->free = *(void **)x;
+  else {
+    if (p->end - p->slab < p->size) {
+      p->slab = malloc (POOL_SLAB); p->end = p->slab + POOL_SLAB;
+      p->slabs++;
+    } x = p->slab; p->slab += p->size;
+  } return memset (x, 0, p->size);
+}
+
+void pool_free (Pool *p, void *x) {
+  p->used--;
+#ifdef NO_POOL
+  free (x); return;
+#endif
+  *(void **)x = p->free; p->free = x;
+}
+
+void pool_print (FILE *f) { Pool *p;
+  fprintf (f, "%-16s %10s %10s %10s %10s\n", "pool", "size", "used", "slabs",
+	   "allocs");
+  foreach (p, _pools) // used counts objects freed by other threads as well
+    fprintf (f, "%-16s %10d %10d %10d %10" PRIu64 "\n", p->name, p->size,
+	     p->used, p->slabs, p->allocs);
+}
+
+#endif
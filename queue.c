@@ -40,6 +40,12 @@ typedef struct {
  */
 void queue_add (Queue *queue, void *item);
 
+/** @brief Insert linked item at the head of the queue.
+    @param queue is a pointer to a Queue
+    @param item is a pointer to a linked item
+ */
+void queue_push (Queue *queue, void *item);
+
 /** @brief Remove linked item from the head of the queue.
     @param queue is a pointer to a Queue
     @return pointer to a linked item
@@ -51,6 +57,58 @@ void *queue_remove (Queue *queue);
  */
 void queue_free (Queue *queue);
 
+/** @brief Lock-free multiple producer / single consumer queue
+
+    An intrusive queue of linked items that can be shared between threads,
+    any number of threads can add items while a single thread removes them.
+    Adding an item (or a pre-linked batch of items) is wait-free and costs a
+    single atomic exchange, with one producer the exchange is uncontended so
+    the same queue serves for single producer / single consumer handoff.
+*/
+typedef struct {
+  List *head; ///< is the last item added, exchanged by the producers
+  List *tail; ///< is the next item to remove, owned by the consumer
+  List stub; ///< is a placeholder item that keeps the queue non-empty
+} MpscQueue;
+
+/** @brief Initialize an MpscQueue.
+    @param queue is a pointer to an MpscQueue
+ */
+void mpsc_init (MpscQueue *queue);
+
+/** @brief Insert linked item at the tail of the queue (any thread).
+    @param queue is a pointer to an MpscQueue
+    @param item is a pointer to a linked item
+ */
+void mpsc_add (MpscQueue *queue, void *item);
+
+/** @brief Insert a chain of linked items at the tail of the queue
+    (any thread).
+
+    The items from first to last must already be linked, the chain is
+    published with a single atomic operation.
+    @param queue is a pointer to an MpscQueue
+    @param first is a pointer to the first linked item of the chain
+    @param last is a pointer to the last linked item of the chain
+ */
+void mpsc_add_list (MpscQueue *queue, void *first, void *last);
+
+/** @brief Remove linked item from the head of the queue (consumer thread).
+
+    May return NULL while a producer is in the middle of adding an item,
+    producers should notify the consumer after adding.
+    @param queue is a pointer to an MpscQueue
+    @return pointer to a linked item or NULL if there are none available
+ */
+void *mpsc_remove (MpscQueue *queue);
+
+/** @brief Move all available items to a Queue (consumer thread).
+    @param queue is a pointer to an MpscQueue
+    @param out is a pointer to a Queue local to the consumer
+    @return the number of items moved
+ */
+int mpsc_drain (MpscQueue *queue, Queue *out);
+
 /** @} */
 
 #ifndef HEADER_ONLY
@@ -60,6 +118,11 @@ void queue_add (Queue *q, void *item) {
   else q->first = q->last = item;
 }
 
+void queue_push (Queue *q, void *item) { List *l = item;
+  if (l->next = q->first) q->first = l;
+  else q->first = q->last = l;
+}
+
 void _queue_insert (Queue *q, void *item, void *prev,
 		    int (*compare) (void *a, void *b)) {
   q->first = _insert_sorted (q->first, item, prev, compare);
@@ -86,5 +149,42 @@ void queue_free (Queue *q) {
   free_list (q->first); queue_clear (q);
 }
 
+void mpsc_init (MpscQueue *q) {
+  q->stub.next = NULL; q->head = q->tail = &q->stub;
+}
+
+void mpsc_add_list (MpscQueue *q, void *first, void *last) {
+  List *l = last, *prev; l->next = NULL;
+  prev = __atomic_exchange_n (&q->head, l, __ATOMIC_ACQ_REL);
+  // the chain is unreachable by the consumer until linked here
+  __atomic_store_n (&prev->next, first, __ATOMIC_RELEASE);
+}
+
+void mpsc_add (MpscQueue *q, void *item) {
+  mpsc_add_list (q, item, item);
+}
+
+void *mpsc_remove (MpscQueue *q) {
+  List *tail = q->tail, *next = __atomic_load_n (&tail->next, __ATOMIC_ACQUIRE);
+  if (tail == &q->stub) {
+    if (!next) return NULL;
+    q->tail = tail = next;
+    next = __atomic_load_n (&tail->next, __ATOMIC_ACQUIRE);
+  }
+  if (next) { q->tail = next; return tail; }
+  // a producer has exchanged the head but not yet linked its item
+  if (tail != __atomic_load_n (&q->head, __ATOMIC_ACQUIRE)) return NULL;
+  // tail is the last item, put the stub behind it so it can be removed
+  mpsc_add (q, &q->stub);
+  if (next = __atomic_load_n (&tail->next, __ATOMIC_ACQUIRE)) {
+    q->tail = next; return tail;
+  } return NULL;
+}
+
+int mpsc_drain (MpscQueue *q, Queue *out) { List *l; int n = 0;
+  while (l = mpsc_remove (q)) { l->next = NULL; queue_add (out, l); n++; }
+  return n;
+}
+
 #endif
     
@@ -0,0 +1,168 @@
+// Copyright (c) 2018 Electric Power Research Institute, Inc.
+// author: Mark Slicker <mark.slicker@gmail.com>
+
+/** @defgroup reactor Reactor
+
+    Provides an optional multi-threaded mode of operation. Each reactor is a
+    thread with its own event loop (epoll set, timers, connections, resources
+    and event queue), devices are sharded among the reactors by SFDI. The main
+    thread performs service discovery and hands the discovered services to the
+    reactors, reactors hand their output back to the main thread. Both
+    directions use lock-free intrusive queues (@ref MpscQueue), each reactor
+    has its own input queue and the reactors share a single output queue,
+    the receiving thread is woken up with a notifier.
+    @{
+*/
+
+#define REACTOR_WAKE (EVENT_NEW+15)
+
+typedef struct _Reactor Reactor;
+
+/** @brief Start a number of reactor threads.
+
+    Each thread initializes the platform layer and the DER client state,
+    shares the TLS context and device identity of the calling thread, then
+    calls the loop function, the main thread should afterward handle
+    REACTOR_WAKE events returned by @ref der_poll using @ref reactor_output.
+    @param n is the number of reactors
+    @param loop is the reactor event loop function
+    @param context is a user defined context
+*/
+void reactor_start (int n, void (*loop) (Reactor *r), void *context);
+
+/** @brief Pin each reactor thread to a CPU, reactor i runs on CPU i modulo
+    the number of CPUs (off by default, requires _GNU_SOURCE). */
+extern int reactor_affinity;
+
+/** @brief Return the user defined context of a reactor.
+    @param r is a pointer to a Reactor
+    @returns the context passed to @ref reactor_start
+*/
+void *reactor_context (Reactor *r);
+
+/** @brief Determine whether a device belongs to a reactor.
+    @param r is a pointer to a Reactor
+    @param sfdi is the SFDI of the device
+    @returns 1 if the device is handled by the reactor, 0 otherwise
+*/
+int reactor_shard (Reactor *r, uint64_t sfdi);
+
+/** @brief Hand a discovered Service to every reactor (main thread).
+    @param s is a pointer to a Service
+*/
+void reactor_service (Service *s);
+
+/** @brief Return the next Service handed to the reactor (reactor thread).
+    @param r is a pointer to a Reactor
+    @returns a pointer to a Service or NULL if there are none
+*/
+Service *reactor_next_service (Reactor *r);
+
+/** @brief Send formatted output to the main thread (reactor thread).
+    @param r is a pointer to a Reactor
+    @param format is a printf style format string
+*/
+void reactor_printf (Reactor *r, const char *format, ...);
+
+/** @brief Return the next output from the reactors (main thread).
+    @returns an allocated string that should be freed by the caller, or NULL
+    if there is no output
+*/
+char *reactor_output ();
+
+/** @} */
+
+#ifndef HEADER_ONLY
+
+#include <pthread.h>
+#include <stdarg.h>
+
+typedef struct _ReactorOutput {
+  struct _ReactorOutput *next;
+  char *text;
+} ReactorOutput;
+
+typedef struct _Reactor {
+  int index; pthread_t thread;
+  MpscQueue in; Queue services; // services from the main thread
+  Timer *wake; // notifier of the reactor
+  void (*loop) (struct _Reactor *);
+  void *context;
+  void *tls; // TLS context of the main thread
+  uint8_t lfdi[20]; uint64_t sfdi; // device identity of the main thread
+} Reactor;
+
+Reactor *_reactors = NULL;
+int _n_reactors = 0, reactor_affinity = 0;
+MpscQueue _output; // output from the reactors
+Queue _output_batch; // output drained by the main thread
+Timer *_main_wake; // notifier of the main thread
+
+int reactor_shard (Reactor *r, uint64_t sfdi) {
+  return sfdi % _n_reactors == r->index;
+}
+
+void *reactor_context (Reactor *r) {
+  return r->context;
+}
+
+// add an item to a queue and wake up the consumer
+void queue_send (MpscQueue *q, void *x, Timer **wake) { Timer *t;
+  mpsc_add (q, x);
+  // the reactor drains its queue after publishing its notifier
+  if (t = __atomic_load_n (wake, __ATOMIC_SEQ_CST)) notify (t);
+}
+
+void *reactor_thread (void *arg) { Reactor *r = arg;
+#ifdef _GNU_SOURCE
+  if (reactor_affinity) { cpu_set_t set;
+    CPU_ZERO (&set); CPU_SET (r->index % sysconf (_SC_NPROCESSORS_ONLN), &set);
+    pthread_setaffinity_np (pthread_self (), sizeof (cpu_set_t), &set);
+  }
+#endif
+  platform_init (); der_init (); tls_share (r->tls);
+  memcpy (device_lfdi, r->lfdi, 20); device_sfdi = r->sfdi;
+  __atomic_store_n (&r->wake, add_notify (REACTOR_WAKE), __ATOMIC_SEQ_CST);
+  r->loop (r); return NULL;
+}
+
+void reactor_start (int n, void (*loop) (Reactor *r), void *context) {
+  int i; _n_reactors = n;
+  _main_wake = add_notify (REACTOR_WAKE); mpsc_init (&_output);
+  _reactors = calloc (n, sizeof (Reactor));
+  for (i = 0; i < n; i++) { Reactor *r = _reactors+i;
+    mpsc_init (&r->in);
+    r->index = i; r->loop = loop; r->context = context;
+    r->tls = tls_context (); r->sfdi = device_sfdi;
+    memcpy (r->lfdi, device_lfdi, 20);
+    pthread_create (&r->thread, NULL, reactor_thread, r);
+  }
+}
+
+void reactor_service (Service *s) { int i;
+  for (i = 0; i < _n_reactors; i++) { Reactor *r = _reactors+i;
+    queue_send (&r->in, service_copy (s), &r->wake);
+  }
+}
+
+Service *reactor_next_service (Reactor *r) {
+  if (queue_empty (&r->services)) mpsc_drain (&r->in, &r->services);
+  return queue_remove (&r->services);
+}
+
+void reactor_printf (Reactor *r, const char *format, ...) {
+  va_list args; char *buffer; int n; ReactorOutput *o;
+  va_start (args, format); n = vsnprintf (NULL, 0, format, args); va_end (args);
+  buffer = malloc (n+1);
+  va_start (args, format); vsnprintf (buffer, n+1, format, args); va_end (args);
+  o = type_alloc (ReactorOutput); o->text = buffer;
+  queue_send (&_output, o, &_main_wake);
+}
+
+char *reactor_output () { ReactorOutput *o; char *text;
+  if (queue_empty (&_output_batch)) mpsc_drain (&_output, &_output_batch);
+  if (!(o = queue_remove (&_output_batch))) return NULL;
+  text = o->text; free (o); return text;
+}
+
+#endif
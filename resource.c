@@ -11,11 +11,12 @@
 /** @brief Resource structure */
 typedef struct _Resource {
   struct _Resource *next; //< pointer to the next resource with the same name
-  char *name; //< name of Resource (the path component of the href)
+  char *name; //< interned name of Resource (the path component of the href)
   void *data; //< pointer to a 2030.5 object 
   int type; //< the schema type for the object
   ListInfo *info; //< pointer to the ListInfo for 2030.5 List objects
   int64_t time; //< the time the resource was created or last updated
+  SeCache *cache; //< the representations served, NULL if never served
 } Resource;
 
 // pointer to the list field of a list type resource
@@ -25,6 +26,8 @@ typedef struct _Resource {
 #define resource_name(r) ((Resource *)r)->name
 #define resource_data(r) ((Resource *)r)->data
 #define resource_type(r) ((Resource *)r)->type
+// hash of the (interned) resource name
+#define resource_name_hash(r) (name_of (resource_name (r))->key.hash)
 
 /** @brief Find a resource with the matching name.
     @param name is a pointer to a string of the name to match
@@ -57,7 +60,7 @@ void *new_resource (int size, char *name, void *data, int type);
 
 /** @brief Free a resource.
 
-    Frees the name and IEEE 2030.5 object (if any)
+    Releases the name and frees the IEEE 2030.5 object (if any)
     @param res is a pointer to a Resource.
 */
 void free_resource (void *res);
@@ -65,25 +68,91 @@ void free_resource (void *res);
 /** @brief Initialize the Resource database. */
 void resource_init ();
 
+/** @brief Respond to a GET or HEAD request for a resource.
+
+    The representations of the resource are cached (see @ref se_serve) until
+    @ref resource_changed is called.
+    @param conn is a pointer to an SeConnection with a request
+    @param res is a pointer to a Resource
+*/
+void serve_resource (void *conn, void *res);
+
+/** @brief Discard the cached representations of a resource.
+
+    Called when the object of a resource changes.
+    @param res is a pointer to a Resource
+*/
+void resource_changed (void *res);
+
 /** @} */
 
 #include <string.h>
+#include <stddef.h>
+
+/* Resource names are interned, the resources with the same name (from
+   different servers) share one copy and its hash is computed once. */
+typedef struct {
+  HashedKey key; int refs; char name[];
+} Name;
+
+#define name_of(s) ((Name *)((s) - offsetof (Name, name)))
 
 void *resource_key (void *data) {
-  Resource *r = data; return r->name;
+  Resource *r = data; return &name_of (r->name)->key;
+}
+
+THREAD_LOCAL HashTable *resource_hash = NULL;
+
+void *find_resource (void *name) {
+  HashedKey k = hashed_key (name);
+  return hash_get (resource_hash, &k);
 }
 
-// find_resource, insert_resource, delete_resource, resource_init
-global_hash(resource, string, 512)
+void insert_resource (void *res) {
+  hash_put (resource_hash, res);
+}
+
+void *delete_resource (void *name) {
+  HashedKey k = hashed_key (name);
+  return hash_delete (resource_hash, &k);
+}
+
+void resource_init () {
+  resource_hash = hash_flat (new_hashed_hash (512, resource_key));
+}
+
+char *intern_name (char *name) {
+  HashedKey k = hashed_key (name); Resource *r; Name *n;
+  if (r = hash_get (resource_hash, &k)) { n = name_of (r->name); n->refs++; }
+  else { int length = strlen (name);
+    n = malloc (sizeof (Name) + length + 1);
+    memcpy (n->name, name, length + 1); n->refs = 1;
+    n->key = k; n->key.s = n->name;
+  } return n->name;
+}
+
+void release_name (char *name) { Name *n = name_of (name);
+  if (--n->refs == 0) free (n);
+}
 
 void *new_resource (int size, char *name, void *data, int type) {
   Resource *r = calloc (1, size);
-  r->name = strdup (name); r->data = data; r->type = type; 
+  r->name = intern_name (name); r->data = data; r->type = type; 
   r->info = find_list_info (type);
   return r;
 }
 
 void free_resource (void *res) { Resource *r = res;
   if (r->data) free_se_object (r->data, r->type);
-  free (r->name); free (r);
+  se_cache_free (r->cache);
+  release_name (r->name); free (r);
+}
+
+void serve_resource (void *conn, void *res) { Resource *r = res;
+  if (!r->cache) r->cache = se_cache_new ();
+  se_serve (conn, r->cache, r->data, r->type);
+}
+
+void resource_changed (void *res) { Resource *r = res;
+  if (r->cache) se_cache_clear (r->cache);
 }
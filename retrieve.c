@@ -22,31 +22,96 @@
 #define RESOURCE_UPDATE (EVENT_NEW+7)
 #define RESOURCE_REMOVE (EVENT_NEW+8)
 #define RETRIEVE_FAIL (EVENT_NEW+9)
+#define MEMORY_CHECK (EVENT_NEW+22)
 
-/** A Resource Stub. */
+#ifndef SUBSCRIBED_POLL
+#define SUBSCRIBED_POLL 4
+#endif
+
+#ifndef MEMORY_PAGE
+#define MEMORY_PAGE 32
+#endif
+
+#ifndef PAGE_ITEM
+#define PAGE_ITEM 256 // assumed bytes per item before any page is received
+#endif
+
+#ifndef DEPS_INLINE
+#define DEPS_INLINE 2
+#endif
+
+/** @brief A set of Stubs, the first DEPS_INLINE are stored inline.
+
+    Each entry is a Stub pointer tagged in the low bits with the membership
+    of the owning Stub in the requirements of the entry (see DEP_REQ and
+    DEP_OLD), so membership is tested without searching the requirements.
+*/
+typedef struct {
+  uint32_t count; ///< is the number of Stubs in the set
+  uint32_t size; ///< is the size of the heap array, 0 if inline
+  union {
+    uintptr_t item[DEPS_INLINE];
+    uintptr_t *items;
+  };
+} DepSet;
+
+#define DEP_REQ 1 ///< is in the requirements (reqs) of the dependency
+#define DEP_OLD 2 ///< is in the old requirements (list) of the dependency
+
+/** @brief The Stub of a DepSet entry */
+#define dep_stub(e) ((struct _Stub *)((e) & ~(uintptr_t)3))
+
+/** @brief The entries of a DepSet, most recently added last */
+#define dep_items(set) ((set)->size? (set)->items : (set)->item)
+
+/** @brief Iterate over the Stubs of a DepSet, most recently added first. */
+#define foreach_dep(t, i, set)						\
+  for (i = (set)->count; i-- > 0 && (t = dep_stub (dep_items (set)[i]), 1);)
+
+/** A Resource Stub. The fields used in retrieval and dependency tracking
+    follow the Resource, the rest are less frequently used. */
 typedef struct _Stub {
   Resource base; ///< is a container for the resource
   void *conn; ///< is a pointer to an SeConnection
+  struct _Stub *moved; ///< is a pointer to the new resource
+  DepSet deps; ///< is the set of dependencies
+  List *reqs; ///< is a list of requirements
   int status; ///< is the HTTP status, 0 for a new Stub, -1 for an update
-  time_t poll_next; ///< is the next time to poll the resource
-  int16_t poll_rate; ///< is the poll rate for the resource
-  unsigned complete : 1; ///< marks the Stub as complete
-  unsigned subscribed : 1;
   uint32_t flag; ///< is the marker for this resource in its dependents
   uint32_t flags; ///< is a bitwise requirements checklist
-  uint32_t offset; ///< is the offset used for list paging
   uint32_t all; ///< is the total number of list items
-  struct _Stub *moved; ///< is a pointer to the new resource
+  int count; ///< is the number of indexed requirements
+  uint32_t offset; ///< is the end of the requested range for list paging
+  uint16_t pages; ///< is the number of list page requests in flight
+  int16_t poll_rate; ///< is the poll rate for the resource
+  unsigned complete : 1; ///< marks the Stub as complete
+  unsigned subscribed : 1; ///< marks an active subscription
+  unsigned subscribing : 1; ///< marks a subscription requested
+  unsigned sync : 1; ///< marks an update that keeps the stored resource
+  unsigned changed : 1; ///< marks a change to a %List during an update
+  unsigned deferred : 1; ///< marks a poll deferred by the request budget
+  unsigned paused : 1; ///< marks an update paused by the memory budget
+  unsigned shared : 1; ///< marks a shared object (see share_object)
+  List **index; ///< is an ordered index of the requirements of a %List
   List *list; ///< is a list of old requirements for updates
-  List *deps; ///< is a list of dependencies
-  List *reqs; ///< is a list of requirements
+  time_t poll_next; ///< is the next time to poll the resource
+  char *etag; ///< is the ETag of the stored resource or NULL
+  char *modified; ///< is the Last-Modified date of the stored resource or NULL
   union {
     void *context; ///< is a user defined completion context
     List *schedules; //< is a list of schedules for event resources 
   };
   void (*completion) (struct _Stub *); ///< is a user defined completion routine
+  int size; ///< is the size of the index
+  uint32_t notify_id; ///< is the ID in the notification URI, 0 if none
+  uint64_t digest; ///< is the digest of the List item text, 0 if unknown
+  uint8_t *key; ///< is the normalized list key of a List item or NULL
 } Stub;
 
+/** @brief Return the most recently added dependency of a Stub. */
+#define first_dep(s) ((s)->deps.count? \
+		      dep_stub (dep_items (&(s)->deps)[(s)->deps.count-1]) : NULL)
+
 /** @brief Get an IEEE 2030.5 resource.
     @param conn is a pointer to an SeConnection
     @param type is an IEEE 2030.5 schema type
@@ -139,30 +204,183 @@ typedef void (*DepFunc) (Stub *s);
  */
 int process_http (void *conn, DepFunc dep);
 
+/** @brief Schedule the next poll of a resource.
+
+    Polls are spread over the poll interval, each Stub polls at a fixed
+    phase of its interval derived from the hash of its name, so that Stubs
+    with the same poll rate do not poll in bursts. The first poll is between
+    one half and one and a half intervals from now. Subscribed resources
+    (see @ref is_subscribed) are notified of changes and are polled every
+    SUBSCRIBED_POLL intervals.
+    @param s is a pointer to a Stub
+*/
+void poll_resource (Stub *s);
+
+/** @brief Take a slot from the request budget for a poll.
+
+    Polls to a server are limited to @ref poll_budget requests per second,
+    with bursts of up to @ref poll_burst requests. A poll without an
+    immediate slot is deferred to its slot (RESOURCE_POLL is inserted again).
+    Only polls take slots, other requests (retrievals, notifications,
+    responses) are neither limited nor counted against the budget.
+    @param s is a pointer to a Stub with a RESOURCE_POLL event
+    @returns 1 if the poll can proceed, 0 if it was deferred
+*/
+int poll_due (Stub *s);
+
+/** @brief The poll request budget, in requests per second per server.
+
+    The default of 0 places no limit on the poll rate.
+*/
+extern int poll_budget;
+
+/** @brief The number of polls to a server that can be sent at once. */
+extern int poll_burst;
+
+/** @brief Return the number of items to request in a page of a %List.
+
+    Page sizes are adapted to each server. The bytes per item and the
+    latency of the %List pages received from a server are tracked and the
+    page size is chosen so that a page body is about @ref page_body bytes,
+    proportionally smaller when the latency of a page exceeds
+    @ref page_latency. Once the size of a %List is known the remaining pages
+    are requested together (pipelined), so smaller pages do not add round
+    trips.
+    @param conn is a pointer to an SeConnection
+    @returns the number of items, from 1 to 255
+*/
+int page_size (void *conn);
+
+/** @brief The target size of a %List page body in bytes. */
+extern int page_body;
+
+/** @brief The target latency of a %List page in milliseconds. */
+extern int page_latency;
+
+/** @brief Resume the updates paused by the memory budget.
+
+    While the memory in use is over the budget (see @ref memory_pressure)
+    updates are paused rather than requested, a MEMORY_CHECK event is
+    inserted every second while updates are paused, upon which this
+    function should be called. Updates are resumed in the order they were
+    paused, all of them once the pressure is normal and MEMORY_PAGE at a
+    time while it is high. Under memory pressure %List resources are
+    retrieved one page of at most MEMORY_PAGE items at a time.
+*/
+void resume_updates ();
+
+/** @brief Subscription-first retrieval.
+
+    When set, every subscribable resource is subscribed to once it is
+    complete (see @ref auto_subscribe), and the resources that are subscribed
+    (or have a subscription requested) are polled only every SUBSCRIBED_POLL
+    intervals, as a safety net for lost notifications. A resource is polled
+    at its normal rate again if its subscription fails, is canceled by the
+    server, or the request is lost with the connection.
+*/
+extern int subscribe_all;
+
+/** @brief Is the resource (to be) updated by notifications under the
+    subscription-first policy?
+    @param s is a pointer to a Stub
+    @returns 1 if the resource is polled at the subscribed rate, 0 otherwise
+*/
+int notified (Stub *s);
+
 /** @} */
 
-int is_subscribed (Stub *s) { List *l; Stub *t;
+// return the entry for Stub s in the set, NULL if not present
+uintptr_t *dep_find (DepSet *set, Stub *s) {
+  uintptr_t *items = dep_items (set); int i;
+  for (i = 0; i < set->count; i++) if (dep_stub (items[i]) == s) return items+i;
+  return NULL;
+}
+
+// add a Stub to the set if not present
+void dep_insert (DepSet *set, Stub *s) {
+  uintptr_t *items = dep_items (set);
+  if (dep_find (set, s)) return;
+  if (set->count == DEPS_INLINE && !set->size) {
+    items = malloc ((DEPS_INLINE << 1) * sizeof (uintptr_t));
+    memcpy (items, set->item, DEPS_INLINE * sizeof (uintptr_t));
+    set->items = items; set->size = DEPS_INLINE << 1;
+  } else if (set->size && set->count == set->size)
+    set->items = items = realloc (items, (set->size <<= 1) * sizeof (uintptr_t));
+  items[set->count++] = (uintptr_t)s;
+}
+
+// remove a Stub from the set, keeping the order of the others
+void dep_remove (DepSet *set, Stub *s) {
+  uintptr_t *items = dep_items (set), *e = dep_find (set, s);
+  if (e) { int i = e - items; set->count--;
+    memmove (e, e+1, (set->count - i) * sizeof (uintptr_t));
+  }
+}
+
+// the edge from a requirement r to its dependent d
+#define dep_edge(r, d) dep_find (&(r)->deps, d)
+
+int dep_marked (Stub *r, Stub *d, int mark) { uintptr_t *e = dep_edge (r, d);
+  return e && (*e & mark);
+}
+
+void dep_mark (Stub *r, Stub *d, int mark, int set) {
+  uintptr_t *e = dep_edge (r, d);
+  if (e) *e = set? *e | mark : *e & ~(uintptr_t)mark;
+}
+
+void dep_free (DepSet *set) {
+  if (set->size) free (set->items);
+  set->count = set->size = 0;
+}
+
+int is_subscribed (Stub *s) { Stub *t; int i;
   if (s->subscribed) return 1;
-  foreach (l, s->deps) { t = l->data;
+  foreach_dep (t, i, &s->deps) {
     if (se_list (resource_type (t))) {
       if (t->subscribed) return 1;
     } else break;
   } return 0;
 }
 
+/* The priority of a request (see http_priority), the resources that lead
+   to the DER controls and the controls themselves are requested before Time,
+   and Time before everything else (logs, metering, responses). A resource
+   of unknown type (a path retrieved directly) is requested first. */
+int request_priority (int type) {
+  switch (type) {
+  case SE_DeviceCapability: case SE_EndDeviceList: case SE_EndDevice:
+  case SE_FunctionSetAssignmentsList: case SE_FunctionSetAssignments:
+  case SE_DERProgramList: case SE_DERProgram: case SE_DefaultDERControl:
+  case SE_DERControlList: case SE_DERCurveList: case SE_DERCurve:
+  case SE_EndDeviceControlList: return 0;
+  case SE_Time: return 1;
+  } return type < 0 || se_event (type)? 0 : 2;
+}
+
+extern int retrieve_trace;
+void trace_request (Stub *s);
+
+/* Request a resource or a page of a List resource. The first request of an
+   update that keeps the stored resource is conditional on its validators. */
 void get_seq (Stub *s, int offset, int count) {
-  char *name = resource_name (s);
+  char *name = resource_name (s), *etag = NULL, *modified = NULL;
+  if (s->sync && !offset) { etag = s->etag; modified = s->modified; }
+  if (retrieve_trace) trace_request (s);
+  se_reopen (s->conn);
+  http_priority (s->conn, request_priority (resource_type (s)));
   if (count) { char uri[64];
-    if (count > 255) count = 255;
+    count = min (count, memory_pressure ()? MEMORY_PAGE : page_size (s->conn));
     if (offset) sprintf (uri, "%s?s=%d&l=%d", name, offset, count);
     else sprintf (uri, "%s?l=%d", name, count);
-    http_get (s->conn, uri);
-  } else http_get (s->conn, name);
-  set_request_context (s->conn, s);
+    http_get_conditional (s->conn, uri, etag, modified);
+    s->offset = max (s->offset, offset + count);
+  } else http_get_conditional (s->conn, name, etag, modified);
+  set_request_context (s->conn, s); s->pages++;
 }
 
 void add_dep (Stub *r, Stub *d) {
-  d->deps = insert_unique (d->deps, r);
+  dep_insert (&d->deps, r);
   d->poll_rate = min (d->poll_rate, r->poll_rate);
   r->complete = 0;
 }
@@ -174,8 +392,8 @@ Stub *new_dep (Stub *r, Stub *d, int flag) {
 }
 
 void remove_req (Stub *s, Stub *r) {
-  r->deps = list_delete (r->deps, s);
-  if (!r->deps) insert_event (r, RESOURCE_REMOVE, 0);
+  dep_remove (&r->deps, s);
+  if (!r->deps.count) insert_event (r, RESOURCE_REMOVE, 0);
 }
 
 void remove_reqs (Stub *s, List *reqs) { List *l;
@@ -183,12 +401,72 @@ void remove_reqs (Stub *s, List *reqs) { List *l;
   free_list (reqs);
 }
 
-void remove_deps (Stub *s, List *deps) { List *l;
-  foreach (l, deps) { Stub *t = l->data;
-    if (t->status < 0)
-      t->list = list_delete (t->list, s);
+/* The normalized key of a List item (see list_key) is computed once and
+   kept until the item is updated, so that ordering is a memcmp. The first
+   byte is the length of the key. */
+uint8_t *stub_key (Stub *s, ListInfo *info) {
+  uint8_t key[LIST_KEY+1];
+  if (!s->key) { key[0] = list_key (key+1, resource_data (s), info);
+    memcpy (s->key = malloc (key[0]+1), key, key[0]+1);
+  } return s->key;
+}
+
+int compare_stubs (Stub *a, Stub *b, ListInfo *info) {
+  uint8_t *x = stub_key (a, info), *y = stub_key (b, info);
+  return memcmp (x+1, y+1, x[0]);
+}
+
+/* The requirements of a List resource are kept in order of the list keys,
+   the index holds the List items of s->reqs so that the insertion point can
+   be found with a binary search. Membership is marked on the edge. */
+int req_index (Stub *d, Stub *s) {
+  int lo = 0, hi = d->count, mid, i;
+  if (!dep_marked (s, d, DEP_REQ)) return -1;
+  while (lo < hi) { Stub *r = d->index[mid = (lo + hi) / 2]->data;
+    if (compare_stubs (r, s, d->base.info) < 0) lo = mid + 1;
+    else hi = mid;
+  }
+  for (i = lo; i < d->count; i++) { Stub *r = d->index[i]->data;
+    if (r == s) return i;
+    if (compare_stubs (r, s, d->base.info)) break;
+  }
+  // the keys of s changed after it was indexed
+  for (i = 0; i < d->count; i++)
+    if (d->index[i]->data == s) return i;
+  return -1;
+}
+
+void req_insert (Stub *d, Stub *s) {
+  int lo = 0, hi = d->count, mid; List *n;
+  if (dep_marked (s, d, DEP_REQ)) return;
+  while (lo < hi) { Stub *r = d->index[mid = (lo + hi) / 2]->data;
+    if (compare_stubs (s, r, d->base.info) < 0) hi = mid;
+    else lo = mid + 1;
+  }
+  if (d->count == d->size) {
+    d->size = d->size? d->size << 1 : 8;
+    d->index = realloc (d->index, d->size * sizeof (List *));
+  }
+  n = list_insert (lo < d->count? d->index[lo] : NULL, s);
+  if (lo) d->index[lo-1]->next = n; else d->reqs = n;
+  memmove (d->index+lo+1, d->index+lo, (d->count - lo) * sizeof (List *));
+  d->index[lo] = n; d->count++; dep_mark (s, d, DEP_REQ, 1);
+}
+
+void req_delete (Stub *d, Stub *s) {
+  int i = req_index (d, s); List *n;
+  if (i < 0) return; n = d->index[i];
+  if (i) d->index[i-1]->next = n->next; else d->reqs = n->next;
+  free (n); d->count--; dep_mark (s, d, DEP_REQ, 0);
+  memmove (d->index+i, d->index+i+1, (d->count - i) * sizeof (List *));
+}
+
+void remove_deps (Stub *s) { Stub *t; int i;
+  foreach_dep (t, i, &s->deps) {
+    if (t->list) t->list = list_delete (t->list, s);
+    if (t->base.info) req_delete (t, s);
     else t->reqs = list_delete (t->reqs, s);
-  } free_list (deps);
+  } dep_free (&s->deps);
 }
 
 void *find_stub (Stub **head, char *name, void *conn) {
@@ -209,25 +487,64 @@ void *get_stub (char *name, int type, void *conn) {
 
 void delete_reqs (Stub *s) {
   remove_reqs (s, s->reqs); remove_reqs (s, s->list);
-  s->reqs = s->list = NULL;
+  s->reqs = s->list = NULL; s->count = 0;
+}
+
+void subscribe_cancel (Stub *s);
+
+THREAD_LOCAL Queue paused_updates = {0};
+
+// the update is paused if it already was or memory is over the budget
+int pause_update (Stub *s) {
+  if (s->paused) return 1;
+  if (memory_pressure () < MEMORY_OVER) return 0;
+  if (queue_empty (&paused_updates))
+    insert_event (NULL, MEMORY_CHECK, se_time () + 1);
+  queue_add (&paused_updates, list_insert (NULL, s));
+  s->paused = 1; return 1;
+}
+
+void unpause (Stub *s) { List *l;
+  foreach (l, paused_updates.first) if (l->data == s) l->data = NULL;
 }
 
+void update_resource (Stub *s);
+
+void resume_updates () { int level, n = 0; List *l; Stub *s;
+  while (!queue_empty (&paused_updates)
+	 && (level = memory_pressure ()) < MEMORY_OVER
+	 && (level == MEMORY_NORMAL || n < MEMORY_PAGE)) {
+    l = queue_remove (&paused_updates); s = l->data; free (l);
+    if (s) { s->paused = 0; update_resource (s); n++; }
+  }
+  if (!queue_empty (&paused_updates))
+    insert_event (NULL, MEMORY_CHECK, se_time () + 1);
+}
+
+void der_changed (Stub *s);
+void trace_remove (Stub *s);
+
 void remove_stub (Stub *s) {
   Stub *head = find_resource (s->base.name),
     *t = list_remove (head, s); 
   if (t) { if (t != head) insert_resource (t); }
-  else delete_resource (head);
+  else delete_resource (s->base.name);
   if (s->moved) remove_req (s, s->moved);
   else delete_reqs (s);
-  remove_deps (s, s->deps); remove_event (s); free_resource (s);
+  der_changed (s); remove_deps (s); remove_event (s);
+  if (retrieve_trace) trace_remove (s);
+  if (s->subscribing || s->notify_id) subscribe_cancel (s);
+  if (s->paused) unpause (s);
+  if (s->shared) { release_object (s->base.data); s->base.data = NULL; }
+  free (s->index); free (s->key); free (s->etag); free (s->modified);
+  free_resource (s);
 }
 
 void *insert_stub (List *list, Stub *s, ListInfo *info) {
   List *prev = NULL, *l = list, *n;
-  void *data = resource_data (s);
   if (find_by_data (list, s)) return list;
-  while (l) { Resource *r = l->data;
-    if (compare_keys (data, r->data, info) < 0) break;
+  while (l) {
+    if (compare_stubs (s, l->data, info) < 0) break;
     prev = l, l = l->next;
   }
   n = list_insert (l, s);
@@ -235,54 +552,99 @@ void *insert_stub (List *list, Stub *s, ListInfo *info) {
   return list;
 }
 
+// add a requirement to a resource that is not a List
+void req_add (Stub *d, Stub *s) {
+  if (!dep_marked (s, d, DEP_REQ)) {
+    d->reqs = list_insert (d->reqs, s); dep_mark (s, d, DEP_REQ, 1);
+  }
+}
+
+// make the requirements of a resource its old requirements
+void reqs_old (Stub *s) { List *l;
+  foreach (l, s->reqs) {
+    dep_mark (l->data, s, DEP_REQ, 0); dep_mark (l->data, s, DEP_OLD, 1);
+  } s->list = list_cat (s->list, s->reqs); s->reqs = NULL; s->count = 0;
+}
+
+/* Clear the old requirements of a resource and return those that are still
+   marked old (and not requirements if mask is DEP_REQ). */
+List *old_reqs (Stub *s, int mask) { List *l, *old = NULL;
+  foreach (l, s->list) { Stub *r = l->data; uintptr_t *e = dep_edge (r, s);
+    if (e && (*e & (DEP_OLD | mask)) == DEP_OLD) old = list_insert (old, r);
+    if (e) *e &= ~(uintptr_t)DEP_OLD;
+  } free_list (s->list); s->list = NULL;
+  return old;
+}
+
 void delete_stub (Stub *s) {
   http_delete (s->conn, resource_name (s));
   set_request_context (s->conn, s);
 }
 
-void dep_complete (Stub *s) { List *l;
-  if (s->completion && !s->complete)
-    s->completion (s);
-  s->complete = 1;
-  foreach (l, s->deps) {
-    Stub *d = l->data; int complete = 0;
+void auto_subscribe (Stub *s);
+void trace_complete (Stub *s);
+
+// complete a Stub and the dependents that it completes
+void dep_fanout (Stub *s) { Stub *d; int i;
+  if (!s->complete) {
+    if (retrieve_trace) trace_complete (s);
+    if (s->completion) s->completion (s);
+    auto_subscribe (s);
+  } s->complete = 1;
+  foreach_dep (d, i, &s->deps) { int complete = 0;
     if (d->base.info) {
-      d->reqs = insert_stub (d->reqs, s, d->base.info);
-      complete = list_length (d->reqs) == d->all;
+      req_insert (d, s);
+      complete = d->count == d->all && !d->sync;
     } else {
-      d->reqs = insert_unique (d->reqs, s);
+      req_add (d, s);
       d->flags &= ~s->flag;
       complete = !d->flags;
     }
     if (complete) {
-      if (d->list) {
-	remove_reqs (d, list_subtract (d->list, d->reqs));
-	d->list = NULL;
-      }
-      dep_complete (d);
+      if (d->list) remove_reqs (d, old_reqs (d, DEP_REQ));
+      dep_fanout (d);
     }
   }
 }
 
-void dep_reset (Stub *s) { List *l;
+void dep_complete (Stub *s) { int64_t t = stat_begin ();
+  dep_fanout (s); stat_end (STAT_DEP_COMPLETE, t);
+}
+
+void dep_reset (Stub *s) { Stub *d; int i;
   s->complete = 0;
-  foreach (l, s->deps) {
-    Stub *d = l->data;
-    if (d->base.info)
-      d->reqs = list_delete (d->reqs, s);
+  foreach_dep (d, i, &s->deps) {
+    if (d->base.info) req_delete (d, s);
     else d->flags |= s->flag;
     dep_reset (d);
   }
 }
 
-void update_resource (Stub *s) {
-  if (s->status >= 0) {
-    if (s->all) s->offset = 0;
-    s->list = s->reqs; s->reqs = NULL;
-    if (s->status && !se_event (resource_type (s)))
-      dep_reset (s);
-    else s->complete = 0;
+// reset a resource and its dependents for a full update
+void reset_resource (Stub *s) {
+  reqs_old (s);
+  if (s->status && !se_event (resource_type (s)))
+    dep_reset (s);
+  else s->complete = 0;
+}
+
+/* A complete List is updated incrementally, a complete resource is kept
+   until the server responds with a changed resource (a 304 response, or an
+   object that compares equal to the stored resource). */
+void update_resource (Stub *s) { List *l;
+  if (s->status >= 0 && !pause_update (s)) {
+    s->offset = s->pages = 0;
+    if (s->status && s->complete && s->base.info) {
+      // s->list holds the items not yet seen in the update (marked old)
+      free_list (old_reqs (s, 0)); s->list = list_dup (s->reqs);
+      foreach (l, s->list) dep_mark (l->data, s, DEP_OLD, 1);
+      s->sync = 1; s->changed = 0;
+    } else if (s->status && s->complete) s->sync = 1;
+    else reset_resource (s);
     s->status = -1; get_seq (s, 0, s->all);
+    // the size of the List is known from its link, request the other pages
+    if (s->base.info && !s->sync && !memory_pressure ())
+      while (s->offset < s->all) get_seq (s, s->offset, s->all - s->offset);
   }
 }
 
@@ -295,15 +657,16 @@ void *get_subordinate (Stub *s, int type) { List *l;
 }
 
 Stub *alloc_resource (void *conn, int type, const char *href) {
-  Uri128 buf; Uri *uri = &buf.uri;
-  if (!http_parse_uri (&buf, conn, href, 127)) return NULL;
-  if (uri->host) conn = se_connect_uri (uri);
-  return get_stub (uri->path, type, conn);
+  char *path = se_resolve (&conn, href);
+  return path? get_stub (path, type, conn) : NULL;
 }
 
+int snapshot_find (Stub *s);
+
 Stub *get_resource (void *conn, int type, const char *href, int count) {
   Stub *s = alloc_resource (conn, type, href);
-  if (s && (time (NULL) - s->base.time) > s->poll_rate) {
+  if (s && !s->status && snapshot_find (s)) s->all = count;
+  else if (s && (time (NULL) - s->base.time) > s->poll_rate) {
     s->all = count; update_resource (s);
   } return s;
 }
@@ -314,9 +677,94 @@ Stub *put_resource (void *conn, void *data, int type, const char *href) {
   return s;
 }
 
+int poll_budget = 0, poll_burst = 10;
+int page_body = 16384, page_latency = 250;
+int subscribe_all = 0;
+
+int notified (Stub *s) {
+  return subscribe_all && (s->subscribing || is_subscribed (s));
+}
+
+// a subscription failed or was lost, poll the resource instead
+void subscription_lost (Stub *s) {
+  s->subscribing = s->subscribed = 0; s->poll_next = 0; poll_resource (s);
+}
+
+// request budget of a server (generic cell rate algorithm)
+typedef struct {
+  void *conn; int64_t tat; // theoretical arrival time (us)
+} Budget;
+
+void *budget_key (void *data) { return &((Budget *)data)->conn; }
+
+global_hash (budget, int64, 16)
+
+// reserve a request slot, return the time of the slot in seconds
+time_t budget_slot (void *conn, time_t now) {
+  int64_t t = now * 1000000LL, interval = 1000000 / poll_budget, slot;
+  Budget *b;
+  if (!budget_hash) budget_init ();
+  if (!(b = find_budget (&conn))) {
+    b = type_alloc (Budget); b->conn = conn; insert_budget (b);
+  }
+  slot = max (t, b->tat - interval * poll_burst);
+  b->tat = max (b->tat, t) + interval;
+  return (slot + 999999) / 1000000;
+}
+
+int poll_due (Stub *s) { time_t now = se_time (), slot;
+  if (!poll_budget || s->deferred) { s->deferred = 0; return 1; }
+  if ((slot = budget_slot (s->conn, now)) <= now) return 1;
+  s->deferred = 1; insert_event (s, RESOURCE_POLL, slot); return 0;
+}
+
+// List paging of a server
+typedef struct {
+  void *conn; int item; // bytes per item
+  int64_t latency; // of a page (ns), biased toward the lower samples
+} Paging;
+
+void *paging_key (void *data) { return &((Paging *)data)->conn; }
+
+global_hash (paging, int64, 16)
+
+Paging *server_paging (void *conn) { Paging *p;
+  if (!paging_hash) paging_init ();
+  if (!(p = find_paging (&conn))) {
+    p = type_alloc (Paging); p->conn = conn; insert_paging (p);
+  } return p;
+}
+
+// observe the body size and latency of a List page
+void page_observe (void *conn, int results) {
+  int length = http_content_length (conn), item;
+  int64_t t = http_latency (conn); Paging *p;
+  if (results <= 0 || length <= 0) return;
+  p = server_paging (conn); item = length / results;
+  p->item = p->item? p->item + (item - p->item) / 4 : item;
+  // pipelined pages wait behind others, so larger samples count less
+  if (!p->latency || t < p->latency) p->latency = t;
+  else p->latency += (t - p->latency) >> 4;
+}
+
+int page_size (void *conn) {
+  Paging *p = server_paging (conn);
+  int64_t body = page_body, limit = page_latency * 1000000LL;
+  if (p->latency > limit) body = max (body * limit / p->latency, 2048);
+  return max (min (body / (p->item? p->item : PAGE_ITEM), 255), 1);
+}
+
+// the next poll at the phase of the Stub within its interval
+time_t poll_time (Stub *s, time_t now) {
+  int64_t rate = s->poll_rate > 0? s->poll_rate : 1, phase, next;
+  if (is_subscribed (s) || notified (s)) rate *= SUBSCRIBED_POLL;
+  phase = (uint32_t)resource_name_hash (s) % rate;
+  next = now + rate - (now - phase) % rate;
+  return next - now < (rate >> 1)? next + rate : next;
+}
+
 void poll_resource (Stub *s) {
-  time_t now = se_time ();
-  time_t next = now + s->poll_rate;
+  time_t now = se_time (), next = poll_time (s, now);
   if (se_event (resource_type (s))) {
     SE_Event_t *ev = resource_data (s);
     time_t end = ev->interval.start + ev->interval.duration;
@@ -324,6 +772,7 @@ void poll_resource (Stub *s) {
   }
   if (s->poll_next <= now) {
     s->poll_next = next; insert_event (s, RESOURCE_POLL, next);
+    if (s->conn) se_keep_alive (s->conn, next - now);
   }
 }
 
@@ -337,26 +786,78 @@ Stub *get_path (Service *s, int secure) {
   char *path = service_path (s);
   if (!path) return get_dcap (s, secure);
   conn = service_connect (s, secure);
-  type = service_type (s); count = se_list (type)? 255 : 0;
+  type = service_type (s); count = se_list (type)? page_size (conn) : 0;
   return get_resource (conn, type, path, count);
 }
 
+/* Only the EventStatus of an event changes. A Scheduled event that is due to
+   start is always changed, so that event_update can retry the event. */
+int event_changed (SE_Event_t *ex, SE_Event_t *ev) {
+  return compare_se_object (&ex->EventStatus, &ev->EventStatus,
+			    SE_EventStatus)
+    || (ex->EventStatus.currentStatus == 0 // Scheduled
+	&& ex->interval.start <= se_time ());
+}
+
+// is the object of a response the same as the stored (complete) resource?
+int same_resource (Stub *s, void *obj) {
+  int type = resource_type (s);
+  if (!s->base.data || !s->complete) return 0;
+  if (se_event (type)) return !event_changed (s->base.data, obj);
+  return !compare_se_object (s->base.data, obj, type);
+}
+
+// store the object of a non-List resource, shared if share_objects is set
+void store_object (Stub *s, void *obj) {
+  if (s->shared = share_objects)
+    obj = share_object (obj, resource_type (s));
+  s->base.data = obj;
+}
+
+/* The completion of an event is only repeated (calling event_update) when
+   the event changes, the cached representations of a resource are kept
+   when the resource is unchanged. A shared object is never modified, a
+   changed resource is stored again instead. */
 void update_existing (Stub *s, void *obj, DepFunc dep) {
-  Resource *r = &s->base; List *l;
-  if (!r->data) r->data = obj;
+  Resource *r = &s->base; uint64_t changed = 1;
+  s->digest = 0; free (s->key); s->key = NULL;
+  if (!r->data) store_object (s, obj);
   else if (se_event (r->type)) {
     SE_Event_t *ex = r->data, *ev = obj;
-    memcpy (&ex->EventStatus, &ev->EventStatus,
-	    sizeof (SE_EventStatus_t));
-    free_se_object (obj, r->type);
-    s->complete = 0;
-  } else replace_se_object (r->data, obj, r->type);
+    if (changed = event_changed (ex, ev)) {
+      if (s->shared) { // copy on write
+	ex = copy_se_object (ex, r->type); release_object (r->data);
+      }
+      memcpy (&ex->EventStatus, &ev->EventStatus,
+	      sizeof (SE_EventStatus_t));
+      if (s->shared) store_object (s, ex);
+      s->complete = 0;
+    } free_se_object (obj, r->type);
+  } else if (!s->shared) changed = replace_se_object (r->data, obj, r->type);
+  else if (changed = compare_se_object (r->data, obj, r->type)) {
+    release_object (r->data); store_object (s, obj);
+  } else free_se_object (obj, r->type);
+  if (changed) { resource_changed (r); der_changed (s); }
   dep (s);
   if (!s->flags) dep_complete (s);
 }
 
-// update paging and return number of items needed
-int list_seq (Stub *s, void *obj) { int results;
+// parse the start (s) and limit (l) of a list query
+void list_range (int *start, int *limit, char *query) {
+  char *p;
+  if ((p = strstr (query, "s=")) && (p == query || p[-1] == '&'))
+    number (start, p+2);
+  if ((p = strstr (query, "l=")) && (p == query || p[-1] == '&'))
+    number (limit, p+2);
+}
+
+/* Update paging and return the number of page requests in flight. Once the
+   size of the list is known the remaining pages are requested together so
+   they are pipelined on the connection rather than retrieved one round trip
+   at a time. A page returned with fewer results than requested has its
+   remainder requested again. The query is NULL for a notification. */
+int list_seq (Stub *s, void *obj, char *query) {
+  int results, start = 0, limit = 0, count;
   if (se_type_is_a (s->base.type, SE_SubscribableList)) {
     SE_SubscribableList_t *sl = obj;
     s->all = sl->all; results = sl->results;
@@ -364,37 +865,121 @@ int list_seq (Stub *s, void *obj) { int results;
     s->all = sl->all; results = sl->results;
   }
   // printf ("list_seq %d %d %d\n", s->offset, results, s->all);
-  s->offset += results;
-  return s->all - s->offset;
+  if (query) { list_range (&start, &limit, query);
+    if (s->pages) s->pages--;
+    page_observe (s->conn, results);
+  }
+  s->offset = max (s->offset, start + results);
+  if (limit > results && start + results < s->all)
+    get_seq (s, start + results, limit - results);
+  // under memory pressure one page is in flight at a time
+  if (memory_pressure ()) {
+    if (!s->pages && s->offset < s->all)
+      get_seq (s, s->offset, s->all - s->offset);
+  } else while (s->offset < s->all) {
+    count = min (s->all - s->offset, 255);
+    get_seq (s, s->offset, count);
+  } return s->pages;
 }
 
-char *object_path (Uri128 *buf, void *conn, void *data) {
-  SE_Resource_t *sr = data;
-  if (sr->href && http_parse_uri (buf, conn, sr->href, 127))
-    return buf->uri.path;
+// the mRID and version of an identified object, NULL if not identified
+uint8_t *object_mrid (void *obj, int type, int *version) {
+#define identified(name)					\
+  if (se_type_is_a (type, SE_##name)) { SE_##name##_t *x = obj;	\
+    *version = x->version; return x->mRID; }
+  identified (RespondableSubscribableIdentifiedObject);
+  identified (SubscribableIdentifiedObject);
+  identified (RespondableIdentifiedObject);
+  identified (IdentifiedObject);
+#undef identified
   return NULL;
 }
 
+/* Is a list item unchanged? An item with the same href, mRID, and version
+   (and EventStatus for events) as the stored item is unchanged. */
+int same_item (Stub *d, void *obj) {
+  int type = resource_type (d), v, w; uint8_t *a, *b;
+  if (!d->base.data || !d->complete
+      || !(a = object_mrid (d->base.data, type, &v))
+      || !(b = object_mrid (obj, type, &w))
+      || memcmp (a, b, sizeof (SE_mRIDType_t)) || v != w) return 0;
+  if (se_event (type)) { SE_Event_t *x = d->base.data, *y = obj;
+    return !memcmp (&x->EventStatus, &y->EventStatus,
+		    sizeof (SE_EventStatus_t));
+  } return 1;
+}
+
+/* complete an incremental List update, the items not seen are removed, the
+   dependents are only updated if the List changed */
+void list_synced (Stub *s) { List *l, *old = old_reqs (s, 0);
+  s->sync = 0;
+  if (old) { s->changed = 1;
+    foreach (l, old) req_delete (s, l->data);
+    remove_reqs (s, old);
+  }
+  if (s->changed) { dep_reset (s);
+    if (s->count == s->all) dep_complete (s);
+  }
+}
+
+char *object_path (void *conn, void *data) {
+  SE_Resource_t *sr = data; return se_path (conn, sr->href);
+}
+
+// add or update a List item, return the item Stub
+Stub *list_item (Stub *s, void *item, DepFunc dep, char *path) {
+  Stub *d = get_stub (path, s->base.info->type, s->conn);
+  if (s->sync) dep_mark (d, s, DEP_OLD, 0);
+  if (req_index (s, d) >= 0) {
+    if (s->sync && same_item (d, item)) {
+      free_se_object (item, s->base.info->type); return d;
+    } req_delete (s, d); // reinserted in order once complete
+  } if (s->sync) s->changed = 1;
+  add_dep (s, d); update_existing (d, item, dep);
+  return d;
+}
+
+/* Process the indexed items of a List page (see se_lazy_list). An item with
+   the same text as the stored item is unchanged and is not parsed. */
+void list_lazy (Stub *s, LazyList *lazy, DepFunc dep) {
+  int type = s->base.info->type, i, v; char *path;
+  for (i = 0; i < lazy->count; i++) {
+    LazyItem *li = &lazy->items[i]; Stub *head, *d; void *item;
+    if (!(path = se_path (s->conn, li->href)))
+      continue; // subordinate resource with no href or invalid href
+    if (s->sync && (d = find_stub (&head, path, s->conn))
+	&& d->digest == li->digest && req_index (s, d) >= 0
+	&& d->complete && d->base.data
+	&& object_mrid (d->base.data, type, &v)) {
+      dep_mark (d, s, DEP_OLD, 0); continue;
+    }
+    if ((item = se_lazy_parse (li, type)))
+      list_item (s, item, dep, path)->digest = li->digest;
+  }
+}
+
 // process list object with dependency function
-int list_object (Stub *s, void *obj, DepFunc dep) {
-  Resource *r = &s->base; int count = list_seq (s, obj);
+int list_object (Stub *s, void *obj, DepFunc dep, char *query,
+		 LazyList *lazy) {
+  Resource *r = &s->base; int count = list_seq (s, obj, query);
   List **list = se_list_field (obj, r->info), *input, *l;
   input = *list; *list = NULL;
   if (!r->data) r->data = obj;
   else replace_se_object (r->data, obj, r->type);
-  dep (s);
-  foreach (l, input) { Uri128 buf; char *path;
-    if (path = object_path (&buf, s->conn, l->data)) {
-      Stub *d = get_stub (path, r->info->type, s->conn);
-      add_dep (s, d); update_existing (d, l->data, dep);
-    } else {
+  resource_changed (r); der_changed (s); dep (s);
+  foreach (l, input) { char *path;
+    if (path = object_path (s->conn, l->data))
+      list_item (s, l->data, dep, path);
+    else {
       // subordinate resource with no href or invalid href
       free_se_object (l->data, r->info->type);
     }
   } free_list (input);
-  if (count > 0) get_seq (s, s->offset, count);
-  else if (!s->all) dep_complete (s);
-  return count;
+  if (lazy) list_lazy (s, lazy, dep);
+  if (!count) {
+    if (s->sync) list_synced (s);
+    else if (!s->all) dep_complete (s);
+  } return count;
 }
 
 Stub *find_target (void *conn) { Stub *head;
@@ -402,8 +987,8 @@ Stub *find_target (void *conn) { Stub *head;
 }
 
 Stub *match_request (void *conn, void *data, int type) {
-  Stub *s = http_context (conn); Uri128 buf;
-  char *path = object_path (&buf, conn, data);
+  Stub *s = http_context (conn);
+  char *path = object_path (conn, data);
   if (path && streq (resource_name (s), path)) {
     int rtype = resource_type (s);
     if (rtype < 0) resource_type (s) = type;
@@ -412,22 +997,60 @@ Stub *match_request (void *conn, void *data, int type) {
   } return NULL;
 }
 
+/* Keep the validators of a response, the validators of a List page are only
+   kept when the page represents the whole List. */
+void resource_validators (Stub *s, void *conn, int whole) {
+  char *etag = whole? http_etag (conn) : NULL,
+    *modified = whole? http_modified (conn) : NULL;
+  free (s->etag); free (s->modified);
+  s->etag = etag? strdup (etag) : NULL;
+  s->modified = modified? strdup (modified) : NULL;
+}
+
+// the stored resource is unchanged, end the update without parsing
+void process_not_modified (void *conn) { Stub *s;
+  if (http_method (conn) == HTTP_GET && (s = find_target (conn))) {
+    s->base.time = time (NULL);
+    if (s->pages) s->pages--;
+    if (s->sync && !s->pages) {
+      free_list (old_reqs (s, 0)); s->sync = 0;
+    } s->status = 304;
+  } free_se_body (conn);
+}
+
+void trace_response (Stub *s, void *conn);
+void trace_end ();
+
 void process_response (void *conn, int status, DepFunc dep) {
-  Stub *s; void *obj; int type, count = 0;
+  Stub *s; void *obj; int type, count = 0; char *query;
   switch (http_method (conn)) {
   case HTTP_GET:
     if (obj = se_body (conn, &type)) {
-      print_se_object (obj, type); printf ("\n");
+      if (log_enabled (LOG_DEBUG)) log_se_object (obj, type);
       if (s = match_request (conn, obj, type)) {
+	if (retrieve_trace) trace_response (s, conn);
 	s->base.time = time (NULL);
-	if (s->base.info)
-	  count = list_object (s, obj, dep);
-	else update_existing (s, obj, dep);
+	if (s->base.info) { query = http_query (conn);
+	  count = list_object (s, obj, dep, query? query : "",
+			      se_lazy_list (conn));
+	  if (!strstr (query? query : "", "s=")) { int start = 0, limit = 0;
+	    if (query) list_range (&start, &limit, query);
+	    resource_validators (s, conn, s->all <= (limit? limit : 255));
+	  }
+	} else { resource_validators (s, conn, 1);
+	  if (s->sync && same_resource (s, obj)) {
+	    s->sync = 0; free_se_object (obj, type); // as if not modified
+	  } else {
+	    if (s->sync) { s->sync = 0; reset_resource (s); }
+	    update_existing (s, obj, dep);
+	  }
+	}
 	if (!count) s->status = status;
+	if (retrieve_trace) trace_end ();
       } else free_se_object (obj, type);
     } break;
   case HTTP_POST:
-    if (s = http_context (conn)) s->subscribed = 1;
+    if (s = http_context (conn)) { s->subscribed = 1; s->subscribing = 0; }
     if (s = find_target (conn)) {
       if (s->base.info) { char *location;
 	if (location = http_location (conn)) {
@@ -468,21 +1091,30 @@ int process_http (void *conn, DepFunc dep) {
       process_response (conn, status, dep); return status;
     case 300: case 301:
       process_redirect (conn, status); break;
+    case 304: process_not_modified (conn); return status;
     default:
       if (http_method (conn) == HTTP_GET
 	  && (s = find_target (conn))) {
 	s->status = status;
 	insert_event (s, RETRIEVE_FAIL, 0);
-      } free_se_body (conn);
+      } else if (http_method (conn) == HTTP_POST
+		 && (s = http_context (conn))) // failed subscription
+	subscription_lost (s);
+      free_se_body (conn);
     } break;
   } return 0;
 }
 
+void trace_close (void *conn);
+
 void cleanup_http (void *conn) {
   HttpRequest *r = http_queued (conn), *next;
+  if (retrieve_trace) trace_close (conn);
   while (r) { next = r->next;
     if (r->method == HTTP_GET)
       remove_stub (r->context);
-    free (r); r = next;
+    else if (r->method == HTTP_POST && r->context)
+      subscription_lost (r->context);
+    free_request (r); r = next;
   }
 }
@@ -16,6 +16,7 @@ extern int dut_strategy;
 */
 
 #define SCHEDULE_UPDATE (EVENT_NEW+10)
+#define RESPONSE_FLUSH (EVENT_NEW+17)
 
 enum EventStatus {Scheduled, Active, Canceled, CanceledRandom,
 		  Superseded, Aborted, Completed, ActiveWait,
@@ -28,6 +29,10 @@ enum EventStatus {Scheduled, Active, Canceled, CanceledRandom,
     randomization already applied, primacy is derived the context that the event
     occured.
 */
+typedef struct {
+  int64_t start, end;
+} Interval;
+
 typedef struct _EventBlock {
   struct _EventBlock *next; ///< is a pointer to the next EventBlock
   void *event; ///< is a pointer to the Event Stub
@@ -38,6 +43,11 @@ typedef struct _EventBlock {
   uint32_t der; ///< bitmask of active DER controls
   int64_t start; ///< the effective start time
   int64_t end; ///< the effective end time
+  Interval interval; ///< the event interval (without randomization)
+  struct _EventBlock *left, *right; ///< are the interval tree children
+  int64_t max; ///< is the maximum interval end within the subtree
+  uint32_t priority; ///< is the interval tree (treap) priority
+  uint32_t seq; ///< is the order of insertion into the `scheduled` queue
 } EventBlock;
 
 /** @brief A Schedule organizes the events of a particular function set for an
@@ -81,8 +91,37 @@ typedef struct {
   EventBlock *scheduled; ///< EventBlock queue sorted by effective start time
   EventBlock *active; ///< EventBlock queue sorted by effective end time
   EventBlock *superseded; ///< EventBlock queue sorted by effective start time
+  EventBlock *tree; ///< interval tree of the `scheduled` EventBlocks
+  uint32_t seq; ///< insertion count of the `scheduled` queue
+  List *deferred; ///< EventBlocks awaiting insertion (most recent first)
+  struct _SchedulePlan *plan; ///< records the insertion of EventBlocks
+  unsigned stale : 1; /**< marks a schedule to be rebuilt, a deleted
+			 EventBlock may have superseded other blocks */
+  unsigned defer : 1; /**< defer the insertion of EventBlocks into the
+			 `scheduled` queue to the `deferred` list */
 } Schedule;
 
+/** @brief A SchedulePlan is the outcome of inserting a sequence of
+    EventBlocks into an empty schedule.
+
+    Whether blocks overlap and which of them are superseded depends only on
+    the event intervals, primacies, creation times and DER controls, not on
+    the randomized effective times. So the outcome is the same for every
+    schedule that inserts the same events in the same order, and it can be
+    shared between them. The effective times of each schedule are applied
+    afterwards by replaying the adjustments made to adjoining blocks.
+*/
+typedef struct _SchedulePlan {
+  int count; ///< is the number of EventBlocks
+  Stub **events; ///< are the events in the order of insertion
+  uint32_t *der; ///< is the resulting DER control mask of each block
+  uint8_t *status; ///< is the resulting status of each block
+  uint32_t *superseded; ///< is the order blocks join the `superseded` queue
+  int n_superseded; ///< is the number of superseded blocks
+  struct _PlanMove *moves; ///< are the adjustments of adjoining blocks
+  int n_moves; ///< is the number of adjustments
+} SchedulePlan;
+
 /** @brief Send an event response to the server on the behalf of a device.
     @param device is a pointer to an EndDevice Stub
     @param event is a pointer to an Event Stub
@@ -90,6 +129,22 @@ typedef struct {
 */
 void device_response (Stub *device, Stub *event, int status);
 
+/** @brief The window in seconds over which event responses are batched.
+
+    When non-zero, responses are queued per connection and ResponseSet
+    (the replyTo URI of the event) and sent together at the end of the
+    window, pipelined over the connection. A queued response for the same
+    device and event is replaced by a later one (e.g. Received followed by
+    Started within the window sends only Started). The default of 0 sends
+    each response immediately.
+*/
+extern int response_window;
+
+/** @brief Send the queued responses of a batch (RESPONSE_FLUSH event).
+    @param batch is a pointer to a ResponseBatch
+*/
+void response_flush (void *batch);
+
 /** @brief Add an event to a schedule with an associated primacy.
     @param s is a pointer to a Schedule
     @param event is a pointer to an Event
@@ -113,6 +168,31 @@ void update_schedule (Schedule *s);
 */
 void schedule_init (Schedule *s);
 
+/** @brief Clear the EventBlock queues of a schedule before it is rebuilt.
+    @param s is a pointer to a Schedule
+*/
+void schedule_clear (Schedule *s);
+
+/** @brief Plan the insertion of EventBlocks into an empty schedule.
+    @param blocks is a list of EventBlocks in the order of insertion
+    @returns a pointer to a SchedulePlan
+*/
+SchedulePlan *schedule_plan (List *blocks);
+
+/** @brief Insert EventBlocks into an empty schedule using a plan.
+    @param s is a pointer to a Schedule
+    @param p is a pointer to a SchedulePlan
+    @param blocks is a list of EventBlocks in the order of insertion
+    @returns 1 if the blocks were inserted, 0 if the blocks are not the
+    events of the plan (the blocks are then left uninserted)
+*/
+int schedule_apply (Schedule *s, SchedulePlan *p, List *blocks);
+
+/** @brief Free a SchedulePlan.
+    @param p is a pointer to a SchedulePlan
+*/
+void plan_free (SchedulePlan *p);
+
 /** @} */
 
 #include <string.h>
@@ -141,6 +221,50 @@ int randomize_duration (void *event) {
   return rand_bound (ev->randomizeDuration);
 }
 
+typedef struct _ResponseBatch {
+  struct _ResponseBatch *next;
+  void *conn; char *reply_to;
+  List *responses; // queued responses, most recent first
+} ResponseBatch;
+
+THREAD_LOCAL ResponseBatch *response_batches = NULL;
+int response_window = 0;
+
+ResponseBatch *response_batch (void *conn, char *reply_to) {
+  ResponseBatch *b;
+  foreach (b, response_batches)
+    if (b->conn == conn && streq (b->reply_to, reply_to)) return b;
+  b = type_alloc (ResponseBatch);
+  b->conn = conn; b->reply_to = strdup (reply_to); b->responses = NULL;
+  link_insert (response_batches, b);
+  insert_event (b, RESPONSE_FLUSH, se_time () + response_window);
+  return b;
+}
+
+// queue a response, replacing a queued response for the same device and event
+void queue_response (void *conn, char *reply_to,
+		     SE_DERControlResponse_t *resp) {
+  ResponseBatch *b = response_batch (conn, reply_to);
+  SE_DERControlResponse_t *r; List *l;
+  foreach (l, b->responses) { r = l->data;
+    if (!memcmp (r->endDeviceLFDI, resp->endDeviceLFDI, 20)
+	&& !memcmp (r->subject, resp->subject, 16)) {
+      *r = *resp; return;
+    }
+  } r = type_alloc (SE_DERControlResponse_t); *r = *resp;
+  b->responses = list_insert (b->responses, r);
+}
+
+void response_flush (void *batch) {
+  ResponseBatch *b = batch; List *l;
+  response_batches = list_remove (response_batches, b);
+  b->responses = list_reverse (b->responses);
+  foreach (l, b->responses) {
+    se_post (b->conn, l->data, SE_DERControlResponse, b->reply_to);
+    free (l->data);
+  } free_list (b->responses); free (b->reply_to); free (b);
+}
+
 void device_response (Stub *device, Stub *event, int status) {
   // (TS) : DUT bad behavior
   enum DUTStrategy {
@@ -163,14 +287,12 @@ void device_response (Stub *device, Stub *event, int status) {
   SE_Event_t *ev = resource_data (event);
   SE_DERControlResponse_t resp;
 
-  printf("Stub Time: %ld\n", event->start);
-  printf("Event Time: %ld\n", ev->start);
-  printf("Response Time: %ld\n", resp.start);
-
   if ((status == EventReceived && ev->responseRequired & 1)
       || (ev->responseRequired & 2)) {
     se_response (&resp, ev, edev->lFDI, status);
-    se_post (event->conn, &resp, SE_DERControlResponse, ev->replyTo);
+    if (response_window && ev->replyTo)
+      queue_response (event->conn, ev->replyTo, &resp);
+    else se_post (event->conn, &resp, SE_DERControlResponse, ev->replyTo);
   }
 }
 
@@ -189,15 +311,20 @@ int block_supersede (EventBlock *a, EventBlock *b) {
   a->der &= ~b->der; return 0;
 }
 
+// block_alloc, block_free
+global_pool (block, EventBlock)
+
 EventBlock *new_block (Stub *event, int primacy) {
-  EventBlock *eb = type_alloc (EventBlock);
+  EventBlock *eb = block_alloc ();
   SE_Event_t *ev = resource_data (event);
   int rand = randomizable (resource_type (event));
-  eb->next = NULL;
+  eb->next = NULL; eb->priority = ((uintptr_t)eb >> 4) * 2654435761u;
   eb->start = ev->interval.start
     + (rand? randomize_start (event) : 0);
   eb->end = eb->start + ev->interval.duration
     + (rand? randomize_duration (event) : 0);
+  eb->interval.start = ev->interval.start;
+  eb->interval.end = ev->interval.start + ev->interval.duration;
   eb->primacy = primacy;
   eb->status = 0;
   eb->event = event;
@@ -209,9 +336,11 @@ int event_status (void *event) {
   return ev->EventStatus.currentStatus;
 }
 
+// blocks with the same start time are ordered from the last inserted
 int compare_start (void *a, void *b) {
   EventBlock *x = a, *y = b;
-  return x->start - y->start;
+  if (x->start != y->start) return x->start < y->start? -1 : 1;
+  return (int64_t)y->seq - x->seq;
 }
 
 int compare_end (void *a, void *b) {
@@ -219,41 +348,181 @@ int compare_end (void *a, void *b) {
   return x->end - y->end;
 }
 
-typedef struct {
-  uint64_t start, end;
-} Interval;
+/* The scheduled EventBlocks are also kept in an interval tree, a treap
+   ordered by the start of the event interval where each node holds the
+   maximum interval end of its subtree. The blocks that overlap an interval
+   are found in O(log n + k) rather than by a walk of the scheduled queue. */
 
-void event_interval (Interval *i, Stub *event) {
-  SE_Event_t *ev = resource_data (event);
-  i->start = ev->interval.start;
-  i->end = i->start + ev->interval.duration;
+#define tree_max(t) ((t)? (t)->max : INT64_MIN)
+
+void tree_update (EventBlock *t) {
+  t->max = max (t->interval.end, max (tree_max (t->left), tree_max (t->right)));
+}
+
+int tree_before (EventBlock *a, EventBlock *b) {
+  return a->interval.start < b->interval.start
+    || (a->interval.start == b->interval.start && a < b);
+}
+
+EventBlock *tree_insert (EventBlock *t, EventBlock *eb) { EventBlock *c;
+  if (!t) {
+    eb->left = eb->right = NULL; eb->max = eb->interval.end; return eb;
+  }
+  if (tree_before (eb, t)) {
+    c = t->left = tree_insert (t->left, eb);
+    if (c->priority > t->priority) {
+      t->left = c->right; c->right = t; tree_update (t); t = c;
+    }
+  } else {
+    c = t->right = tree_insert (t->right, eb);
+    if (c->priority > t->priority) {
+      t->right = c->left; c->left = t; tree_update (t); t = c;
+    }
+  } tree_update (t); return t;
+}
+
+// merge two trees, the blocks of a are before the blocks of b
+EventBlock *tree_merge (EventBlock *a, EventBlock *b) {
+  if (!a) return b; if (!b) return a;
+  if (a->priority > b->priority) {
+    a->right = tree_merge (a->right, b); tree_update (a); return a;
+  } b->left = tree_merge (a, b->left); tree_update (b); return b;
+}
+
+EventBlock *tree_remove (EventBlock *t, EventBlock *eb) {
+  if (!t) return NULL;
+  if (t == eb) return tree_merge (t->left, t->right);
+  if (tree_before (eb, t)) t->left = tree_remove (t->left, eb);
+  else t->right = tree_remove (t->right, eb);
+  tree_update (t); return t;
+}
+
+// the order of the event intervals, independent of the randomized times
+int compare_overlap (void *a, void *b) {
+  EventBlock *x = ((List *)a)->data, *y = ((List *)b)->data;
+  if (x->interval.start != y->interval.start)
+    return x->interval.start < y->interval.start? -1 : 1;
+  return (int64_t)y->seq - x->seq;
+}
+
+/* Collect the blocks that overlap or adjoin an interval (start <= x->end,
+   end >= x->start), sorted by the start of the event interval. */
+List *tree_overlap (List *l, EventBlock *t, Interval *x) {
+  if (!t || t->max < x->start) return l;
+  l = tree_overlap (l, t->left, x);
+  if (t->interval.start <= x->end) {
+    if (t->interval.end >= x->start)
+      l = insert_sorted (l, list_insert (NULL, t), compare_overlap);
+    l = tree_overlap (l, t->right, x);
+  } return l;
+}
+
+void unschedule_block (Schedule *s, EventBlock *eb) {
+  s->scheduled = list_remove (s->scheduled, eb);
+  s->tree = tree_remove (s->tree, eb);
+}
+
+/* The start (or end) of block `to` is set to the end of block `from`, the
+   blocks are identified by their order of insertion. */
+typedef struct _PlanMove {
+  uint32_t from, to, end;
+} PlanMove;
+
+void plan_move (SchedulePlan *p, EventBlock *from, EventBlock *to, int end) {
+  if (!p) return;
+  if (!(p->n_moves & (p->n_moves - 1)))
+    p->moves = realloc (p->moves, max (p->n_moves * 2, 4) * sizeof (PlanMove));
+  p->moves[p->n_moves++] = (PlanMove){from->seq - 1, to->seq - 1, end};
+}
+
+void supersede_block (Schedule *s, EventBlock *eb) {
+  eb->status = ScheduleSuperseded;
+  link_insert (s->superseded, eb);
+  if (s->plan) s->plan->superseded[s->plan->n_superseded++] = eb->seq - 1;
 }
 
 void insert_block (Schedule *s, EventBlock *eb) {
-  EventBlock *prev = (EventBlock *)&s->scheduled,
-    *e = s->scheduled, *next; Interval x, y;
-  eb->status = Scheduled;
+  Interval *x = &eb->interval, *y; List *overlap, *l, *moved = NULL;
+  eb->status = Scheduled; eb->seq = ++s->seq;
   if (resource_type (eb->event) == SE_DERControl)
     eb->der = der_base (eb->event);
-  event_interval (&x, eb->event);
-  while (e) { next = e->next;
-    event_interval (&y, e->event);
-    if (x.start < y.end && x.end > y.start) {
+  overlap = tree_overlap (NULL, s->tree, x);
+  foreach (l, overlap) { EventBlock *e = l->data; y = &e->interval;
+    if (x->start < y->end && x->end > y->start) {
       if (block_supersede (eb, e)) {
-	e->status = ScheduleSuperseded;
-	link_insert (s->superseded, e);
-	prev->next = e = next; continue;
+	unschedule_block (s, e); supersede_block (s, e);
       } else if (!eb->der) {
-	eb->status = ScheduleSuperseded;
-	link_insert (s->superseded, eb); return;
+	eb->status = ScheduleSuperseded; break;
       }
-    } else if (x.end == y.start)
-      e->start = eb->end;
-    else if (x.end == y.end)
-      e->end = eb->end;
-    prev = e; e = next;
+    } else if (x->end == y->start) {
+      e->start = eb->end; moved = list_insert (moved, e);
+      plan_move (s->plan, eb, e, 0);
+    } else if (x->end == y->end) {
+      e->end = eb->end; plan_move (s->plan, eb, e, 1);
+    }
+  } free_list (overlap);
+  // keep the queue sorted when the start of a block is moved
+  foreach (l, moved) { EventBlock *e = l->data;
+    if (e->status == Scheduled) {
+      s->scheduled = list_remove (s->scheduled, e);
+      s->scheduled = insert_sorted (s->scheduled, e, compare_start);
+    }
+  } free_list (moved);
+  if (eb->status == ScheduleSuperseded)
+    supersede_block (s, eb);
+  else {
+    s->scheduled = insert_sorted (s->scheduled, eb, compare_start);
+    s->tree = tree_insert (s->tree, eb);
+  }
+}
+
+/* The plan is made by inserting copies of the blocks, with the effective
+   times of the copies set to the event intervals, into a scratch schedule
+   that records the outcome. */
+SchedulePlan *schedule_plan (List *blocks) {
+  SchedulePlan *p = type_alloc (SchedulePlan); Schedule s = {0};
+  int i = 0, n = list_length (blocks); EventBlock **b; List *l;
+  p->count = n; p->events = malloc (n * sizeof (Stub *));
+  p->der = malloc (n * sizeof (uint32_t)); p->status = malloc (n);
+  p->superseded = malloc (n * sizeof (uint32_t));
+  b = malloc (n * sizeof (EventBlock *)); s.plan = p;
+  foreach (l, blocks) { EventBlock *eb = block_alloc ();
+    *eb = *(EventBlock *)l->data;
+    eb->start = eb->interval.start; eb->end = eb->interval.end;
+    p->events[i] = eb->event; b[i++] = eb; insert_block (&s, eb);
+  }
+  for (i = 0; i < n; i++) {
+    p->der[i] = b[i]->der; p->status[i] = b[i]->status; block_free (b[i]);
+  } free (b); return p;
+}
+
+int schedule_apply (Schedule *s, SchedulePlan *p, List *blocks) {
+  int i = 0; EventBlock **b; List *l;
+  if (list_length (blocks) != p->count) return 0;
+  foreach (l, blocks)
+    if (((EventBlock *)l->data)->event != p->events[i++]) return 0;
+  b = malloc (p->count * sizeof (EventBlock *)); i = 0;
+  foreach (l, blocks) { EventBlock *eb = b[i] = l->data;
+    eb->seq = ++s->seq; eb->der = p->der[i]; eb->status = p->status[i++];
+  }
+  // replay the adjustments with the effective times of this schedule
+  for (i = 0; i < p->n_moves; i++) { PlanMove *m = &p->moves[i];
+    if (m->end) b[m->to]->end = b[m->from]->end;
+    else b[m->to]->start = b[m->from]->end;
   }
-  s->scheduled = insert_sorted (s->scheduled, eb, compare_start);
+  for (i = 0; i < p->n_superseded; i++)
+    link_insert (s->superseded, b[p->superseded[i]]);
+  for (i = 0; i < p->count; i++)
+    if (b[i]->status == Scheduled) {
+      s->scheduled = insert_sorted (s->scheduled, b[i], compare_start);
+      s->tree = tree_insert (s->tree, b[i]);
+    }
+  free (b); return 1;
+}
+
+void plan_free (SchedulePlan *p) {
+  free (p->events); free (p->der); free (p->status);
+  free (p->superseded); free (p->moves); free (p);
 }
 
 int active_poll_rate = 300;
@@ -272,7 +541,7 @@ void activate_block (Schedule *s, EventBlock *eb) {
 
 void insert_active (Schedule *s, EventBlock *eb) {
   EventBlock *prev = (EventBlock *)&s->active, *a = s->active, *next;
-  printf ("insert_active\n");
+  log_debug ("insert_active\n");
   if (resource_type (eb->event) == SE_DERControl)
     eb->der = der_base (eb->event);
   while (a) { next = a->next;
@@ -304,7 +573,7 @@ EventBlock *get_block (Schedule *s, void *event) {
 }
 
 void activate_blocks (Stub *event) { List *l;
-  printf ("activate_blocks:\n");
+  log_debug ("activate_blocks:\n");
   foreach (l, event->schedules) {
     EventBlock *eb = get_block (l->data, event);
     if (eb->status == ActiveWait)
@@ -314,8 +583,7 @@ void activate_blocks (Stub *event) { List *l;
 
 void remove_block (Schedule *s, EventBlock *eb) {
   switch (eb->status) {
-  case Scheduled:
-    s->scheduled = list_remove (s->scheduled, eb); break;
+  case Scheduled: unschedule_block (s, eb); break;
   case Active: eb->end = se_time ();
     remove_event (eb);
     insert_event (eb, EVENT_END, 0);
@@ -338,24 +606,40 @@ void remove_blocks (Stub *event, int response) { List *l;
   }
 }
 
+/* Delete the EventBlocks of an event, the blocks are unlinked from the
+   queues and their pending events removed so that the schedules remain
+   valid without being rebuilt. */
 void delete_blocks (Stub *event) { List *l;
   SE_Event_t *ev = resource_data (event);
   foreach (l, event->schedules) {
-    Schedule *s = l->data;
-    free (hash_delete (s->blocks, ev->mRID));
+    Schedule *s = l->data; EventBlock *eb;
+    if (!(eb = hash_delete (s->blocks, ev->mRID))) continue;
+    switch (eb->status) {
+    case Scheduled: unschedule_block (s, eb); break;
+    case Active: case ActiveWait:
+      s->active = list_remove (s->active, eb); break;
+    case ScheduleSuperseded:
+      s->superseded = list_remove (s->superseded, eb);
+    }
+    if (in_range (eb->status, Scheduled, Active) || eb->status == ActiveWait)
+      s->stale |= s->superseded != NULL;
+    remove_event (eb); block_free (eb);
   } free_list (event->schedules);
   event->schedules = NULL;
 }
 
 void event_update (Stub *event) {
   int64_t now; static int64_t sync_time = 0;
-  printf ("event_update\n");
+  SE_Event_t *ev = resource_data (event);
+  log_debug ("event_update\n");
   switch (event_status (event)) {
   case Scheduled:
+    // an update (e.g. a notification) before the event is due to start
+    if (ev->interval.start > (now = se_time ())) break;
     /* The client's clock is ahead of the server's clock, attempt to
        synchronize by setting the clock (time offset) backward, also retry
        the event retrieval in another second. */
-    if (sync_time != (now = se_time ())) {
+    if (sync_time != now) {
       se_time_offset--; sync_time = --now;
     } insert_event (event, RESOURCE_UPDATE, now+1);
     break;
@@ -380,7 +664,8 @@ EventBlock *schedule_event (Schedule *s, Stub *event, int primacy) {
   if (eb = hash_get (s->blocks, ev->mRID)) {
     eb->primacy = primacy;
   } else {
-    event->schedules = insert_unique (event->schedules, s);
+    // the schedule has no block for the event so it is not yet in the list
+    event->schedules = list_insert (event->schedules, s);
     event->completion = event_update;
     eb = new_block (event, primacy);
     hash_put (s->blocks, eb);
@@ -397,7 +682,9 @@ EventBlock *schedule_event (Schedule *s, Stub *event, int primacy) {
   switch (status) {
   case Scheduled:
     if (eb->status != ActiveWait) {
-      insert_block (s, eb); break;
+      if (s->defer) s->deferred = list_insert (s->deferred, eb);
+      else insert_block (s, eb);
+      break;
     }
   case Active: insert_active (s, eb); break;
   case Canceled: case CanceledRandom:
@@ -419,6 +706,10 @@ void schedule_init (Schedule *s) {
   s->blocks = new_int128_hash (64, mrid_key);
 }
 
+void schedule_clear (Schedule *s) {
+  s->scheduled = s->active = s->superseded = s->tree = NULL; s->stale = 0;
+}
+
 void update_schedule (Schedule *s) {
   EventBlock *eb = s->active, *next;
   int64_t now = se_time (), last = 0;
@@ -434,6 +725,7 @@ void update_schedule (Schedule *s) {
   eb = s->scheduled;
   while (eb) { next = eb->next;
     if (eb->start <= now) {
+      s->tree = tree_remove (s->tree, eb);
       insert_active (s, eb);
       last = last? min (last, eb->end) : eb->end;
     } else { last = last? min (last, eb->start) : eb->start; break; }
@@ -447,7 +739,7 @@ void update_schedule (Schedule *s) {
     } else { last = last? min (last, eb->start) : eb->start; break; }
     eb = eb->next;
   } s->superseded = eb;
-  printf ("update_schedule %" PRId64 " %" PRId64 "\n", now, last);
+  log_debug ("update_schedule %" PRId64 " %" PRId64 "\n", now, last);
   if (last) {
     if (last != s->next) {
       remove_event (s);
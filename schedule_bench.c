@@ -0,0 +1,215 @@
+// Copyright (c) 2018 Electric Power Research Institute, Inc.
+// author: Mark Slicker <mark.slicker@gmail.com>
+
+/* A benchmark of the DER schedule under a virtual clock (see
+   se_virtual_time).
+
+   usage: schedule_bench [devices n] [derp n] [derc n] [primacy n]
+                         [duration s] [overlap %] [nest %] [random %]
+                         [spread s]
+
+   A synthetic set of DERPrograms (derp, default 4) each with a number of
+   DERControls (derc, default 16) is scheduled for every device (default
+   10000). The primacy of each program is one of n values (default 2), so
+   programs may share a primacy. The controls of a program follow one
+   another with durations of 1/2 to 3/2 of the given duration (default 900
+   seconds), a control may overlap (default 20%) or be nested within
+   (default 10%) the previous one and may be randomized (default 25%) by up
+   to the spread (default 60 seconds). Each control enables one to three
+   of four DER control modes, the DefaultDERControl of each program enables
+   two.
+
+   The controls are scheduled (schedule_event), then every schedule is
+   rebuilt (insert_block) and the schedules are run to completion with the
+   clock advanced to the time of each queued event. The server status of a
+   control changes to Active at the start of its interval. The throughput
+   of each stage is printed along with the worst case update_schedule
+   latency, the schedules themselves are not printed. */
+
+#include "der_client.c"
+
+#define BENCH_STATUS (EVENT_NEW+30)
+
+int dut_strategy = 0;
+int n_device = 10000, n_derp = 4, n_derc = 16, n_primacy = 2;
+int duration = 900, overlap = 20, nest = 10, randomized = 25, spread = 60;
+
+// DER control modes of the synthetic controls
+const uint32_t modes[] = {
+  SE_opModFixedW_exists, SE_opModFixedVar_exists, SE_opModMaxLimW_exists,
+  SE_opModTargetW_exists
+};
+
+typedef struct {
+  int64_t start;
+} Bench;
+
+void bench_start (Bench *b) { b->start = stat_now (); }
+
+void bench_end (Bench *b, const char *name, int n) {
+  int64_t ns = stat_now () - b->start; if (ns <= 0) ns = 1;
+  printf ("%-20s %8d %12.0f ops/s %8.1f ns/op\n", name, n,
+	  n * 1e9 / ns, (double)ns / n);
+}
+
+Stub *bench_stub (char *name, void *data, int type) {
+  return new_resource (sizeof (Stub), name, data, type);
+}
+
+uint32_t random_modes (int n) { uint32_t flags = 0;
+  while (n--) flags |= modes[rand () % 4];
+  return flags;
+}
+
+// the DERControls of a program, starting at time t
+List *program_controls (Stub *program, int64_t t) {
+  SE_DERControl_t *prev = NULL; List *controls = NULL;
+  int i, r; char name[64];
+  for (i = 0; i < n_derc; i++) {
+    SE_DERControl_t *c = type_alloc (SE_DERControl_t); Stub *s;
+    int d = duration / 2 + rand () % (duration + 1);
+    memset (c, 0, sizeof (SE_DERControl_t));
+    r = rand () % 100;
+    if (prev && r < nest) {
+      c->interval.start = prev->interval.start
+	+ rand () % (prev->interval.duration / 2 + 1);
+      d = max (1, rand () % (prev->interval.start + prev->interval.duration
+			     - c->interval.start));
+    } else if (prev && r < nest + overlap)
+      c->interval.start = prev->interval.start
+	+ rand () % prev->interval.duration;
+    else if (prev) // adjoining, or after a gap
+      c->interval.start = prev->interval.start + prev->interval.duration
+	+ (rand () & 1? 0 : rand () % duration);
+    else c->interval.start = t + rand () % duration;
+    c->interval.duration = d;
+    if (rand () % 100 < randomized) {
+      c->randomizeStart = rand () % (2 * spread + 1) - spread;
+      c->randomizeDuration = rand () % (spread + 1);
+    }
+    c->creationTime = t - rand () % 86400;
+    c->EventStatus.currentStatus = Scheduled;
+    se_flags (&c->DERControlBase) = random_modes (1 + rand () % 3);
+    sprintf (name, "%s/derc/%d", program->base.name, i);
+    s = bench_stub (name, c, SE_DERControl); s->subscribed = 1;
+    memcpy (c->mRID, &s, sizeof (Stub *)); // unique
+    insert_event (s, BENCH_STATUS, c->interval.start);
+    controls = list_insert (controls, s); prev = c;
+  } return list_reverse (controls);
+}
+
+int compare_primacy (void *a, void *b) {
+  SE_DERProgram_t *x = resource_data (((List *)a)->data),
+    *y = resource_data (((List *)b)->data);
+  return x->primacy - y->primacy;
+}
+
+// the DERPrograms sorted by primacy, the controls of each are its context
+List *new_programs (int64_t t) { List *derpl = NULL; int i; char name[64];
+  for (i = 0; i < n_derp; i++) {
+    SE_DERProgram_t *p = type_alloc (SE_DERProgram_t);
+    SE_DefaultDERControl_t *dd = type_alloc (SE_DefaultDERControl_t);
+    Stub *s;
+    memset (p, 0, sizeof (SE_DERProgram_t));
+    memset (dd, 0, sizeof (SE_DefaultDERControl_t));
+    p->primacy = rand () % n_primacy;
+    se_flags (&dd->DERControlBase) = random_modes (2);
+    sprintf (name, "/derp/%d", i); s = bench_stub (name, p, SE_DERProgram);
+    sprintf (name, "/derp/%d/dderc", i);
+    s->reqs = list_insert (NULL, bench_stub (name, dd, SE_DefaultDERControl));
+    s->context = program_controls (s, t);
+    derpl = insert_sorted (derpl, list_insert (NULL, s), compare_primacy);
+  } return derpl;
+}
+
+void schedule_programs (DerDevice *d) { List *l, *m;
+  foreach (l, d->derpl) { Stub *p = l->data;
+    SE_DERProgram_t *derp = resource_data (p);
+    foreach (m, p->context) {
+      EventBlock *eb = schedule_event (&d->schedule, m->data, derp->primacy);
+      eb->program = p; eb->context = d;
+    }
+  }
+}
+
+void usage () {
+  printf ("usage: schedule_bench [devices n] [derp n] [derc n] [primacy n]\n"
+	  "                      [duration s] [overlap %%] [nest %%] "
+	  "[random %%]\n                      [spread s]\n");
+  exit (0);
+}
+
+void options (int argc, char **argv) {
+  const char * const names[] = {
+    "devices", "derp", "derc", "primacy", "duration", "overlap", "nest",
+    "random", "spread"
+  };
+  int *values[] = {
+    &n_device, &n_derp, &n_derc, &n_primacy, &duration, &overlap, &nest,
+    &randomized, &spread
+  };
+  int i, index;
+  for (i = 1; i < argc; i++) {
+    if ((index = string_index (argv[i], names, 9)) < 0 || ++i == argc
+	|| !number (values[index], argv[i]) || *values[index] < 0) usage ();
+  }
+  if (n_device < 1 || n_derp < 1 || n_derc < 1 || n_primacy < 1
+      || duration < 2 || overlap + nest > 100 || randomized > 100
+      || spread > 3600) usage ();
+}
+
+int main (int argc, char **argv) {
+  List *derpl; DerDevice **devices; Stub *edev; Bench b; void *any;
+  int i, updates = 0, starts = 0, ends = 0, defaults = 0, status = 0;
+  int64_t t0 = 1500000000, t, worst = 0, total = 0;
+  SE_EndDevice_t *e = type_alloc (SE_EndDevice_t);
+  options (argc, argv);
+  platform_init (); der_init (); srand (1);
+  subscribe_all = 1; se_virtual_time = t0;
+  memset (e, 0, sizeof (SE_EndDevice_t));
+  edev = bench_stub ("/edev/1", e, SE_EndDevice);
+  derpl = new_programs (t0 + 60);
+  devices = malloc (n_device * sizeof (DerDevice *));
+  for (i = 0; i < n_device; i++) { DerDevice *d = get_device (i+1);
+    d->schedule.device = edev; d->derpl = derpl; devices[i] = d;
+  }
+  printf ("schedule_bench: %d devices, %d programs, %d controls\n",
+	  n_device, n_derp, n_derc);
+  bench_start (&b);
+  for (i = 0; i < n_device; i++) {
+    schedule_programs (devices[i]);
+    insert_event (&devices[i]->schedule, SCHEDULE_UPDATE, 0);
+  } bench_end (&b, "schedule_event", n_device * n_derp * n_derc);
+  bench_start (&b);
+  for (i = 0; i < n_device; i++) {
+    schedule_clear (&devices[i]->schedule);
+    schedule_programs (devices[i]);
+  } bench_end (&b, "rebuild", n_device * n_derp * n_derc);
+  bench_start (&b);
+  while (1) {
+    switch (next_event (&any)) {
+    case SCHEDULE_UPDATE:
+      t = stat_now (); update_schedule (any); t = stat_now () - t;
+      worst = max (worst, t); total += t; updates++;
+      update_defaults (any); break;
+    case BENCH_STATUS: { SE_Event_t *ev = resource_data (any);
+	ev->EventStatus.currentStatus = Active; status++;
+	event_update (any);
+      } break;
+    case EVENT_START: starts++; break;
+    case EVENT_END: ends++; break;
+    case DEFAULT_START: case DEFAULT_END: defaults++; break;
+    case EVENT_NONE:
+      if (!ev_count) goto done;
+      se_virtual_time = (ev_heap[0]->time + 999) / 1000;
+    }
+  }
+ done:
+  bench_end (&b, "run", updates + status);
+  printf ("%-20s %8d %12.0f ops/s %8.1f ns/op\n", "update_schedule",
+	  updates, updates * 1e9 / max (total, 1),
+	  (double)total / max (updates, 1));
+  printf ("update_schedule worst case %.1f us, %d starts, %d ends, "
+	  "%d default changes\n", worst / 1e3, starts, ends, defaults);
+  return 0;
+}
@@ -35,8 +35,33 @@ typedef struct {
   unsigned int st: 1;
   unsigned int attribute : 1;
   unsigned int unbounded : 1;
+  unsigned int width : 4; // bit_count (n), the bits of an EXI event code
 } SchemaEntry;
 
+/** A perfect hash of the local names of a Schema (hash and displace), the
+    slot of a name is determined by the seed of the name's bucket. */
+typedef struct {
+  int buckets, size; // the number of buckets and slots (powers of two)
+  const uint16_t *seeds; // the seed of each bucket
+  const int16_t *slots; // the index of a local name or -1 for an empty slot
+} NameHash;
+
+struct _Parser;
+struct _Output;
+
+/** Specialized XML parse and output functions for some of the types of a
+    Schema, generated by schema_gen. The functions handle the offsets,
+    presence bits, and counts of the types directly rather than interpreting
+    the SchemaEntry table, when they fail the table driven parser and output
+    are used instead. */
+typedef struct {
+  /* Match the root element at the start of a document, return the element
+     index or -1 if the element has no specialized parser. */
+  int (*xml_root) (char **data);
+  int (*parse_xml) (struct _Parser *p, char **data, void *obj, int type);
+  int (*output_xml) (struct _Output *o, void *obj, int type);
+} SchemaCodec;
+
 typedef struct _Schema {
   const char *namespace;
   const char *schemaId;
@@ -47,10 +72,19 @@ typedef struct _Schema {
   const SchemaEntry *entries;
   const char * const *elements;
   const uint16_t *ids;
+  const NameHash *hash;
+  const SchemaCodec *codec;
 } Schema;
 
 int se_is_a (const SchemaEntry *se, int base, const Schema *schema);
 
+/** @brief Find the index of a local name using the schema's NameHash.
+    @param schema is a pointer to a Schema with a NameHash
+    @param name is the name to look up
+    @returns the index of the name in schema->names or -1 if not found
+*/
+int name_index (const Schema *schema, const char *name);
+
 /** @brief Is a type derived from another type within a schema?
     @param type is the derived type
     @param base is a base type
@@ -87,16 +121,55 @@ void free_object_elements (void *obj, int type, const Schema *schema);
 */
 void free_object (void *obj, int type, const Schema *schema);
 
+/** @brief Make a deep copy of an object.
+
+    The copy and its elements are allocated with malloc, so that an object
+    allocated from an Arena can be kept after the Arena is reset.
+    @param obj is a pointer to a schema typed object
+    @param type is the type of the object
+    @param schema is a pointer to the Schema
+    @returns a pointer to the copy
+*/
+void *copy_object (void *obj, int type, const Schema *schema);
+
+/** @brief Compare two objects of the same type field by field.
+
+    Strings are compared by value and the elements of complex types are
+    compared recursively, so objects parsed from the same text compare equal.
+    @param a is a pointer to a schema typed object
+    @param b is a pointer to a schema typed object
+    @param type is the type of the objects
+    @param schema is a pointer to the Schema
+    @returns a mask of the fields that differ, 0 if the objects are equal.
+    Bit 0 is the flags word (presence, booleans, and counts), bit i+1 is the
+    ith element of the type (elements 62 and beyond share bit 63).
+*/
+uint64_t compare_object (void *a, void *b, int type, const Schema *schema);
+
+/** @brief Hash the value of an object.
+
+    Objects that compare equal (see @ref compare_object) have the same hash.
+    @param obj is a pointer to a schema typed object
+    @param type is the type of the object
+    @param schema is a pointer to the Schema
+    @returns a 64-bit hash of the object
+*/
+uint64_t hash_object (void *obj, int type, const Schema *schema);
+
 /** @brief Replace one object for another.
 
     Free the elements of the destination object and copy the source object to
-    the same location. Free the source object container.
+    the same location. Free the source object container. When the objects are
+    equal (see @ref compare_object) the destination is kept as it is and the
+    source object is freed instead.
     @param dest is the destination object
     @param src is the source object
     @param type is the schema type of the objects
     @param schema is a pointer to the Schema
+    @returns the mask of the fields that changed, 0 if none
  */
-void replace_object (void *dest, void *src, int type, const Schema *schema);
+uint64_t replace_object (void *dest, void *src, int type,
+			 const Schema *schema);
 
 
 #define element_name(index, schema) (schema)->elements[index]
@@ -123,6 +196,22 @@ int se_is_a (const SchemaEntry *se, int base, const Schema *schema) {
   } return 0;
 }
 
+uint32_t name_hash (const char *s) { uint32_t h = 2166136261u;
+  while (*s) { h ^= (uint8_t)*s++; h *= 16777619u; } return h;
+}
+
+uint32_t name_slot (uint32_t h, int seed) {
+  h ^= seed * 0x9e3779b9u; h ^= h >> 16; h *= 0x85ebca6bu; h ^= h >> 13;
+  return h;
+}
+
+int name_index (const Schema *schema, const char *name) {
+  const NameHash *nh = schema->hash; uint32_t h = name_hash (name);
+  int i = nh->slots[name_slot (h, nh->seeds[h & (nh->buckets-1)])
+		    & (nh->size-1)];
+  return i >= 0 && streq (name, schema->names[i])? i : -1;
+}
+
 int type_is_a (int type, int base, const Schema *schema) {
   return se_is_a (&schema->entries[type], base, schema);
 }
@@ -201,9 +290,149 @@ void free_object (void *obj, int type, const Schema *schema) {
   free_object_elements (obj, type, schema); free (obj);
 }
 
-void replace_object (void *dest, void *src, int type, const Schema *schema) {
+// replace the pointers within a (shallow) copy with copies of their targets
+void copy_elements (void *obj, const SchemaEntry *se,
+		    const Schema *schema) {
+  while (1) { int i; void *element = obj + se->offset;
+    if (se->type & ST_SIMPLE) {
+      if (is_pointer (se->type)) {
+	char **value = element; i = 0;
+	while (i < se->max && *value) {
+	  *value = strdup (*value); value++; i++;
+	}
+      }
+    } else if (se->st) {
+      SubstitutionType *st = element;
+      if (st->data) st->data = copy_object (st->data, st->type, schema);
+    } else if (se->n) {
+      const SchemaEntry *first = &schema->entries[se->index];
+      if (se->unbounded) { List *t, **l = element;
+	while (*l) {
+	  t = malloc (sizeof (List)); t->next = (*l)->next;
+	  t->data = malloc (first->size);
+	  memcpy (t->data, (*l)->data, first->size);
+	  copy_elements (t->data, first+1, schema);
+	  *l = t; l = &t->next;
+	}
+      } else {
+	for (i = 0; i < se->max; i++) {
+	  copy_elements (element, first+1, schema);
+	  element += first->size;
+	}
+      }
+    } else return; se++;
+  }
+}
+
+void *copy_object (void *obj, int type, const Schema *schema) {
+  const SchemaEntry *se; int size = object_size (type, schema);
+  void *copy = memcpy (malloc (size), obj, size);
+  if (type < schema->length) {
+    se = &schema->entries[type]; type = se->index;
+  }
+  copy_elements (copy, &schema->entries[type+1], schema);
+  return copy;
+}
+
+int compare_strings (char **a, char **b, int max) { int i;
+  for (i = 0; i < max && (*a || *b); i++, a++, b++)
+    if (!*a || !*b || strcmp (*a, *b)) return 1;
+  return 0;
+}
+
+/* Compare the elements of two objects (or two complex elements), a type
+   with flags has the flags word before its first element. */
+uint64_t compare_elements (void *a, void *b, const SchemaEntry *se,
+			   const Schema *schema) {
+  uint64_t mask = 0, bit = 2; int i, lead = sizeof (uint32_t);
+  while (1) { void *x = a + se->offset, *y = b + se->offset; int diff = 0;
+    if (se->type & ST_SIMPLE) {
+      if (is_pointer (se->type)) diff = compare_strings (x, y, se->max);
+      else diff = memcmp (x, y, object_size (se->type, schema) * se->max);
+    } else if (se->st) {
+      SubstitutionType *s = x, *t = y;
+      diff = s->type != t->type || !s->data != !t->data
+	|| (s->data && compare_object (s->data, t->data, s->type, schema));
+    } else if (se->n) {
+      const SchemaEntry *first = &schema->entries[se->index];
+      if (se->unbounded) { List *l = *(List **)x, *m = *(List **)y;
+	for (; l && m && !diff; l = l->next, m = m->next)
+	  diff = !l->data != !m->data || (l->data && compare_elements
+					  (l->data, m->data, first+1, schema));
+	diff |= l || m;
+      } else
+	for (i = 0; i < se->max && !diff; i++) {
+	  diff = compare_elements (x, y, first+1, schema) != 0;
+	  x += first->size; y += first->size;
+	}
+    } else break;
+    if (diff) mask |= bit;
+    if (!is_boolean (se->type)) lead = min (lead, se->offset);
+    if (bit != 1ull << 63) bit <<= 1; se++;
+  }
+  if (bit > 2 && lead && memcmp (a, b, lead)) mask |= 1;
+  return mask;
+}
+
+uint64_t compare_object (void *a, void *b, int type, const Schema *schema) {
+  const SchemaEntry *se;
+  if (type < schema->length) {
+    se = &schema->entries[type]; type = se->index;
+  }
+  return compare_elements (a, b, &schema->entries[type+1], schema);
+}
+
+// FNV-1a
+uint64_t hash_bytes (uint64_t h, const void *data, int n) {
+  const uint8_t *p = data;
+  while (n-- > 0) h = (h ^ *p++) * 1099511628211ull;
+  return h;
+}
+
+// hash the elements of an object in the same order as compare_elements
+uint64_t hash_elements (uint64_t h, void *obj, const SchemaEntry *se,
+			const Schema *schema) {
+  int i, n = 0, lead = sizeof (uint32_t);
+  while (1) { void *x = obj + se->offset;
+    if (se->type & ST_SIMPLE) {
+      if (is_pointer (se->type)) { char **value = x;
+	for (i = 0; i < se->max && value[i]; i++)
+	  h = hash_bytes (h, value[i], strlen (value[i]) + 1);
+      } else h = hash_bytes (h, x, object_size (se->type, schema) * se->max);
+    } else if (se->st) { SubstitutionType *st = x;
+      h = hash_bytes (h, &st->type, sizeof (int));
+      if (st->data) h ^= hash_object (st->data, st->type, schema);
+    } else if (se->n) {
+      const SchemaEntry *first = &schema->entries[se->index];
+      if (se->unbounded) { List *l;
+	foreach (l, *(List **)x)
+	  if (l->data) h = hash_elements (h, l->data, first+1, schema);
+      } else
+	for (i = 0; i < se->max; i++, x += first->size)
+	  h = hash_elements (h, x, first+1, schema);
+    } else break;
+    if (!is_boolean (se->type)) lead = min (lead, se->offset);
+    n++; se++;
+  }
+  return n && lead? hash_bytes (h, obj, lead) : h;
+}
+
+uint64_t hash_object (void *obj, int type, const Schema *schema) {
+  const SchemaEntry *se;
+  if (type < schema->length) {
+    se = &schema->entries[type]; type = se->index;
+  }
+  return hash_elements (14695981039346656037ull, obj,
+			&schema->entries[type+1], schema);
+}
+
+uint64_t replace_object (void *dest, void *src, int type,
+			 const Schema *schema) {
+  uint64_t changed = compare_object (dest, src, type, schema);
+  if (!changed) { free_object (src, type, schema); return 0; }
   free_object_elements (dest, type, schema);
   memcpy (dest, src, object_size (type, schema)); free (src);
+  return changed;
 }
 
 #endif
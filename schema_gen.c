@@ -368,6 +368,11 @@ void process_schema (SchemaDoc *doc, Element *root) {
   }
 }
 
+// root elements with specialized XML parse and output functions
+const char * const codec_roots[] =
+  {"DERControl", "DERControlList", "EndDevice", "Response",
+   "MirrorMeterReading"};
+
 int main () {
   Graph graph; List *sorted;
   SchemaDoc doc = {0}; SchemaType *t;
@@ -382,6 +387,8 @@ int main () {
   compute_flags (sorted, doc.types);
   file = fopen ("se_schema.c", "wb+");
   print_schema (sorted, &doc); fclose (file);
+  file = fopen ("se_codec.c", "wb+");
+  print_codec (&doc, codec_roots, 5); fclose (file);
   file = fopen ("se_types.h", "wb+");
   print_types (sorted, doc.types);
   print_symbols (&doc);
@@ -0,0 +1,1999 @@
+// auto-generated by schema_gen
+
+int xml_output_DERControl (Output *o, char *b);
+int xml_parse_DERControl (Parser *p, char **s, char *b,
+		const char *end, int length);
+int xml_output_EventStatus (Output *o, char *b);
+int xml_parse_EventStatus (Parser *p, char **s, char *b,
+		const char *end, int length);
+int xml_output_DateTimeInterval (Output *o, char *b);
+int xml_parse_DateTimeInterval (Parser *p, char **s, char *b,
+		const char *end, int length);
+int xml_output_DERControlBase (Output *o, char *b);
+int xml_parse_DERControlBase (Parser *p, char **s, char *b,
+		const char *end, int length);
+int xml_output_PowerFactorWithExcitation (Output *o, char *b);
+int xml_parse_PowerFactorWithExcitation (Parser *p, char **s, char *b,
+		const char *end, int length);
+int xml_output_FixedVar (Output *o, char *b);
+int xml_parse_FixedVar (Parser *p, char **s, char *b,
+		const char *end, int length);
+int xml_output_FreqDroopType (Output *o, char *b);
+int xml_parse_FreqDroopType (Parser *p, char **s, char *b,
+		const char *end, int length);
+int xml_output_DERCurveLink (Output *o, char *b);
+int xml_parse_DERCurveLink (Parser *p, char **s, char *b,
+		const char *end, int length);
+int xml_output_ReactivePower (Output *o, char *b);
+int xml_parse_ReactivePower (Parser *p, char **s, char *b,
+		const char *end, int length);
+int xml_output_ActivePower (Output *o, char *b);
+int xml_parse_ActivePower (Parser *p, char **s, char *b,
+		const char *end, int length);
+int xml_output_DERControlList (Output *o, char *b);
+int xml_parse_DERControlList (Parser *p, char **s, char *b,
+		const char *end, int length);
+int xml_output_EndDevice (Output *o, char *b);
+int xml_parse_EndDevice (Parser *p, char **s, char *b,
+		const char *end, int length);
+int xml_output_ConfigurationLink (Output *o, char *b);
+int xml_parse_ConfigurationLink (Parser *p, char **s, char *b,
+		const char *end, int length);
+int xml_output_DERListLink (Output *o, char *b);
+int xml_parse_DERListLink (Parser *p, char **s, char *b,
+		const char *end, int length);
+int xml_output_DeviceInformationLink (Output *o, char *b);
+int xml_parse_DeviceInformationLink (Parser *p, char **s, char *b,
+		const char *end, int length);
+int xml_output_DeviceStatusLink (Output *o, char *b);
+int xml_parse_DeviceStatusLink (Parser *p, char **s, char *b,
+		const char *end, int length);
+int xml_output_FileStatusLink (Output *o, char *b);
+int xml_parse_FileStatusLink (Parser *p, char **s, char *b,
+		const char *end, int length);
+int xml_output_IPInterfaceListLink (Output *o, char *b);
+int xml_parse_IPInterfaceListLink (Parser *p, char **s, char *b,
+		const char *end, int length);
+int xml_output_LoadShedAvailabilityListLink (Output *o, char *b);
+int xml_parse_LoadShedAvailabilityListLink (Parser *p, char **s, char *b,
+		const char *end, int length);
+int xml_output_LogEventListLink (Output *o, char *b);
+int xml_parse_LogEventListLink (Parser *p, char **s, char *b,
+		const char *end, int length);
+int xml_output_PowerStatusLink (Output *o, char *b);
+int xml_parse_PowerStatusLink (Parser *p, char **s, char *b,
+		const char *end, int length);
+int xml_output_FlowReservationRequestListLink (Output *o, char *b);
+int xml_parse_FlowReservationRequestListLink (Parser *p, char **s, char *b,
+		const char *end, int length);
+int xml_output_FlowReservationResponseListLink (Output *o, char *b);
+int xml_parse_FlowReservationResponseListLink (Parser *p, char **s, char *b,
+		const char *end, int length);
+int xml_output_FunctionSetAssignmentsListLink (Output *o, char *b);
+int xml_parse_FunctionSetAssignmentsListLink (Parser *p, char **s, char *b,
+		const char *end, int length);
+int xml_output_RegistrationLink (Output *o, char *b);
+int xml_parse_RegistrationLink (Parser *p, char **s, char *b,
+		const char *end, int length);
+int xml_output_SubscriptionListLink (Output *o, char *b);
+int xml_parse_SubscriptionListLink (Parser *p, char **s, char *b,
+		const char *end, int length);
+int xml_output_Response (Output *o, char *b);
+int xml_parse_Response (Parser *p, char **s, char *b,
+		const char *end, int length);
+int xml_output_MirrorMeterReading (Output *o, char *b);
+int xml_parse_MirrorMeterReading (Parser *p, char **s, char *b,
+		const char *end, int length);
+int xml_output_MirrorReadingSet (Output *o, char *b);
+int xml_parse_MirrorReadingSet (Parser *p, char **s, char *b,
+		const char *end, int length);
+int xml_output_Reading (Output *o, char *b);
+int xml_parse_Reading (Parser *p, char **s, char *b,
+		const char *end, int length);
+int xml_output_ReadingType (Output *o, char *b);
+int xml_parse_ReadingType (Parser *p, char **s, char *b,
+		const char *end, int length);
+int xml_output_UnitValueType (Output *o, char *b);
+int xml_parse_UnitValueType (Parser *p, char **s, char *b,
+		const char *end, int length);
+
+int xml_output_DERControl (Output *o, char *b) {
+  if (*(char **)(b + offsetof (SE_DERControl_t, href))) {
+    ok_v (xml_put (o, " href=\"", 7)
+	  && output_escaped (o, *(char **)(b + offsetof (SE_DERControl_t, href)))
+	  && xml_put (o, "\"", 1), 0);
+  }
+  if (*(char **)(b + offsetof (SE_DERControl_t, replyTo))) {
+    ok_v (xml_put (o, " replyTo=\"", 10)
+	  && output_escaped (o, *(char **)(b + offsetof (SE_DERControl_t, replyTo)))
+	  && xml_put (o, "\"", 1), 0);
+  }
+  if (*(uint32_t *)b >> 4 & 1) {
+    ok_v (xml_put (o, " responseRequired=\"", 19)
+	  && output_hex (o, (uint8_t *)(b + offsetof (SE_DERControl_t, responseRequired)), 1)
+	  && xml_put (o, "\"", 1), 0);
+  }
+  if (*(uint32_t *)b >> 1 & 1) {
+    ok_v (xml_put (o, " subscribable=\"", 15)
+	  && xml_put_uint (o, *(uint8_t *)(b + offsetof (SE_DERControl_t, subscribable)))
+	  && xml_put (o, "\"", 1), 0);
+  }
+  ok_v (xml_put_tag (o, "<mRID>", 6)
+    && output_hex (o, (uint8_t *)(b + offsetof (SE_DERControl_t, mRID)), 16)
+    && xml_put (o, "</mRID>", 7), 0);
+  if (*(uint32_t *)b >> 0 & 1) {
+    ok_v (xml_put_tag (o, "<description>", 13)
+      && output_escaped (o, b + offsetof (SE_DERControl_t, description))
+      && xml_put (o, "</description>", 14), 0);
+  }
+  if (*(uint32_t *)b >> 2 & 1) {
+    ok_v (xml_put_tag (o, "<version>", 9)
+      && xml_put_uint (o, *(uint16_t *)(b + offsetof (SE_DERControl_t, version)))
+      && xml_put (o, "</version>", 10), 0);
+  }
+  ok_v (xml_put_tag (o, "<creationTime>", 14)
+    && xml_put_int (o, *(int64_t *)(b + offsetof (SE_DERControl_t, creationTime)))
+    && xml_put (o, "</creationTime>", 15), 0);
+  ok_v (xml_put_start (o, "<EventStatus", 12)
+    && xml_output_EventStatus (o, b + offsetof (SE_DERControl_t, EventStatus))
+    && xml_put_end (o, "</EventStatus>", 14), 0);
+  ok_v (xml_put_start (o, "<interval", 9)
+    && xml_output_DateTimeInterval (o, b + offsetof (SE_DERControl_t, interval))
+    && xml_put_end (o, "</interval>", 11), 0);
+  if (*(uint32_t *)b >> 5 & 1) {
+    ok_v (xml_put_tag (o, "<randomizeDuration>", 19)
+      && xml_put_int (o, *(int16_t *)(b + offsetof (SE_DERControl_t, randomizeDuration)))
+      && xml_put (o, "</randomizeDuration>", 20), 0);
+  }
+  if (*(uint32_t *)b >> 6 & 1) {
+    ok_v (xml_put_tag (o, "<randomizeStart>", 16)
+      && xml_put_int (o, *(int16_t *)(b + offsetof (SE_DERControl_t, randomizeStart)))
+      && xml_put (o, "</randomizeStart>", 17), 0);
+  }
+  ok_v (xml_put_start (o, "<DERControlBase", 15)
+    && xml_output_DERControlBase (o, b + offsetof (SE_DERControl_t, DERControlBase))
+    && xml_put_end (o, "</DERControlBase>", 17), 0);
+  if (*(uint32_t *)b >> 3 & 1) {
+    ok_v (xml_put_tag (o, "<deviceCategory>", 16)
+      && output_hex (o, (uint8_t *)(b + offsetof (SE_DERControl_t, deviceCategory)), 4)
+      && xml_put (o, "</deviceCategory>", 17), 0);
+  }
+  return 1;
+}
+
+int xml_parse_DERControl (Parser *p, char **s, char *b,
+		const char *end, int length) {
+  ScanTag tag; char text[SCAN_TEXT], *v;
+  ok_v (xml_scan_tag (s, &tag), 0);
+  if ((v = xml_scan_attr (&tag, "href", 4))) {
+    ok_v (xml_uri (p, v, (char **)(b + offsetof (SE_DERControl_t, href))), 0);
+  }
+  if ((v = xml_scan_attr (&tag, "replyTo", 7))) {
+    ok_v (xml_uri (p, v, (char **)(b + offsetof (SE_DERControl_t, replyTo))), 0);
+  }
+  if ((v = xml_scan_attr (&tag, "responseRequired", 16))) {
+    *(uint32_t *)b |= 1 << 4;
+    ok_v (parse_hex ((uint8_t *)(b + offsetof (SE_DERControl_t, responseRequired)), 1, v), 0);
+  }
+  if ((v = xml_scan_attr (&tag, "subscribable", 12))) {
+    *(uint32_t *)b |= 1 << 1;
+    ok_v (xml_ubyte (v, (uint8_t *)(b + offsetof (SE_DERControl_t, subscribable))), 0);
+  }
+  if (tag.empty) return 0;
+  if (xml_scan_start (s, "<mRID", 5)) {
+    ok_v (xml_scan_text (s, text)
+      && parse_hex ((uint8_t *)(b + offsetof (SE_DERControl_t, mRID)), 16, text)
+      && xml_scan_end (s, "</mRID>", 7), 0);
+  }
+  if (xml_scan_start (s, "<description", 12)) {
+    *(uint32_t *)b |= 1 << 0;
+    ok_v (xml_scan_text (s, text)
+      && xml_string (text, b + offsetof (SE_DERControl_t, description), 32)
+      && xml_scan_end (s, "</description>", 14), 0);
+  }
+  if (xml_scan_start (s, "<version", 8)) {
+    *(uint32_t *)b |= 1 << 2;
+    ok_v (xml_scan_text (s, text)
+      && xml_ushort (text, (uint16_t *)(b + offsetof (SE_DERControl_t, version)))
+      && xml_scan_end (s, "</version>", 10), 0);
+  }
+  if (xml_scan_start (s, "<creationTime", 13)) {
+    ok_v (xml_scan_text (s, text)
+      && xml_long (text, (int64_t *)(b + offsetof (SE_DERControl_t, creationTime)))
+      && xml_scan_end (s, "</creationTime>", 15), 0);
+  }
+  if (xml_scan_start (s, "<EventStatus", 12)) {
+    ok_v (xml_parse_EventStatus (p, s, b + offsetof (SE_DERControl_t, EventStatus), "</EventStatus>", 14), 0);
+  }
+  if (xml_scan_start (s, "<interval", 9)) {
+    ok_v (xml_parse_DateTimeInterval (p, s, b + offsetof (SE_DERControl_t, interval), "</interval>", 11), 0);
+  }
+  if (xml_scan_start (s, "<randomizeDuration", 18)) {
+    *(uint32_t *)b |= 1 << 5;
+    ok_v (xml_scan_text (s, text)
+      && xml_short (text, (int16_t *)(b + offsetof (SE_DERControl_t, randomizeDuration)))
+      && xml_scan_end (s, "</randomizeDuration>", 20), 0);
+  }
+  if (xml_scan_start (s, "<randomizeStart", 15)) {
+    *(uint32_t *)b |= 1 << 6;
+    ok_v (xml_scan_text (s, text)
+      && xml_short (text, (int16_t *)(b + offsetof (SE_DERControl_t, randomizeStart)))
+      && xml_scan_end (s, "</randomizeStart>", 17), 0);
+  }
+  if (xml_scan_start (s, "<DERControlBase", 15)) {
+    ok_v (xml_parse_DERControlBase (p, s, b + offsetof (SE_DERControl_t, DERControlBase), "</DERControlBase>", 17), 0);
+  }
+  if (xml_scan_start (s, "<deviceCategory", 15)) {
+    *(uint32_t *)b |= 1 << 3;
+    ok_v (xml_scan_text (s, text)
+      && parse_hex ((uint8_t *)(b + offsetof (SE_DERControl_t, deviceCategory)), 4, text)
+      && xml_scan_end (s, "</deviceCategory>", 17), 0);
+  }
+  return xml_scan_end (s, end, length);
+}
+
+int xml_output_EventStatus (Output *o, char *b) {
+  ok_v (xml_put_tag (o, "<currentStatus>", 15)
+    && xml_put_uint (o, *(uint8_t *)(b + offsetof (SE_EventStatus_t, currentStatus)))
+    && xml_put (o, "</currentStatus>", 16), 0);
+  ok_v (xml_put_tag (o, "<dateTime>", 10)
+    && xml_put_int (o, *(int64_t *)(b + offsetof (SE_EventStatus_t, dateTime)))
+    && xml_put (o, "</dateTime>", 11), 0);
+  ok_v (xml_put_tag (o, "<potentiallySuperseded>", 23)
+    && xml_put_bool (o, *(uint32_t *)b >> (0) & 1)
+    && xml_put (o, "</potentiallySuperseded>", 24), 0);
+  if (*(uint32_t *)b >> 1 & 1) {
+    ok_v (xml_put_tag (o, "<potentiallySupersededTime>", 27)
+      && xml_put_int (o, *(int64_t *)(b + offsetof (SE_EventStatus_t, potentiallySupersededTime)))
+      && xml_put (o, "</potentiallySupersededTime>", 28), 0);
+  }
+  if (*(uint32_t *)b >> 2 & 1) {
+    ok_v (xml_put_tag (o, "<reason>", 8)
+      && output_escaped (o, b + offsetof (SE_EventStatus_t, reason))
+      && xml_put (o, "</reason>", 9), 0);
+  }
+  return 1;
+}
+
+int xml_parse_EventStatus (Parser *p, char **s, char *b,
+		const char *end, int length) {
+  ScanTag tag; char text[SCAN_TEXT];
+  ok_v (xml_scan_tag (s, &tag), 0);
+  if (tag.empty) return 0;
+  if (xml_scan_start (s, "<currentStatus", 14)) {
+    ok_v (xml_scan_text (s, text)
+      && xml_ubyte (text, (uint8_t *)(b + offsetof (SE_EventStatus_t, currentStatus)))
+      && xml_scan_end (s, "</currentStatus>", 16), 0);
+  }
+  if (xml_scan_start (s, "<dateTime", 9)) {
+    ok_v (xml_scan_text (s, text)
+      && xml_long (text, (int64_t *)(b + offsetof (SE_EventStatus_t, dateTime)))
+      && xml_scan_end (s, "</dateTime>", 11), 0);
+  }
+  if (xml_scan_start (s, "<potentiallySuperseded", 22)) {
+    ok_v (xml_scan_text (s, text)
+      && xml_bool (text, b, 0)
+      && xml_scan_end (s, "</potentiallySuperseded>", 24), 0);
+  }
+  if (xml_scan_start (s, "<potentiallySupersededTime", 26)) {
+    *(uint32_t *)b |= 1 << 1;
+    ok_v (xml_scan_text (s, text)
+      && xml_long (text, (int64_t *)(b + offsetof (SE_EventStatus_t, potentiallySupersededTime)))
+      && xml_scan_end (s, "</potentiallySupersededTime>", 28), 0);
+  }
+  if (xml_scan_start (s, "<reason", 7)) {
+    *(uint32_t *)b |= 1 << 2;
+    ok_v (xml_scan_text (s, text)
+      && xml_string (text, b + offsetof (SE_EventStatus_t, reason), 192)
+      && xml_scan_end (s, "</reason>", 9), 0);
+  }
+  return xml_scan_end (s, end, length);
+}
+
+int xml_output_DateTimeInterval (Output *o, char *b) {
+  ok_v (xml_put_tag (o, "<duration>", 10)
+    && xml_put_uint (o, *(uint32_t *)(b + offsetof (SE_DateTimeInterval_t, duration)))
+    && xml_put (o, "</duration>", 11), 0);
+  ok_v (xml_put_tag (o, "<start>", 7)
+    && xml_put_int (o, *(int64_t *)(b + offsetof (SE_DateTimeInterval_t, start)))
+    && xml_put (o, "</start>", 8), 0);
+  return 1;
+}
+
+int xml_parse_DateTimeInterval (Parser *p, char **s, char *b,
+		const char *end, int length) {
+  ScanTag tag; char text[SCAN_TEXT];
+  ok_v (xml_scan_tag (s, &tag), 0);
+  if (tag.empty) return 0;
+  if (xml_scan_start (s, "<duration", 9)) {
+    ok_v (xml_scan_text (s, text)
+      && xml_uint (text, (uint32_t *)(b + offsetof (SE_DateTimeInterval_t, duration)))
+      && xml_scan_end (s, "</duration>", 11), 0);
+  }
+  if (xml_scan_start (s, "<start", 6)) {
+    ok_v (xml_scan_text (s, text)
+      && xml_long (text, (int64_t *)(b + offsetof (SE_DateTimeInterval_t, start)))
+      && xml_scan_end (s, "</start>", 8), 0);
+  }
+  return xml_scan_end (s, end, length);
+}
+
+int xml_output_DERControlBase (Output *o, char *b) {
+  if (*(uint32_t *)b >> 0 & 1) {
+    ok_v (xml_put_tag (o, "<opModConnect>", 14)
+      && xml_put_bool (o, *(uint32_t *)b >> (0) & 1)
+      && xml_put (o, "</opModConnect>", 15), 0);
+  }
+  if (*(uint32_t *)b >> 2 & 1) {
+    ok_v (xml_put_tag (o, "<opModEnergize>", 15)
+      && xml_put_bool (o, *(uint32_t *)b >> (2) & 1)
+      && xml_put (o, "</opModEnergize>", 16), 0);
+  }
+  if (*(uint32_t *)b >> 4 & 1) {
+    ok_v (xml_put_start (o, "<opModFixedPFAbsorbW", 20)
+      && xml_output_PowerFactorWithExcitation (o, b + offsetof (SE_DERControlBase_t, opModFixedPFAbsorbW))
+      && xml_put_end (o, "</opModFixedPFAbsorbW>", 22), 0);
+  }
+  if (*(uint32_t *)b >> 5 & 1) {
+    ok_v (xml_put_start (o, "<opModFixedPFInjectW", 20)
+      && xml_output_PowerFactorWithExcitation (o, b + offsetof (SE_DERControlBase_t, opModFixedPFInjectW))
+      && xml_put_end (o, "</opModFixedPFInjectW>", 22), 0);
+  }
+  if (*(uint32_t *)b >> 6 & 1) {
+    ok_v (xml_put_start (o, "<opModFixedVar", 14)
+      && xml_output_FixedVar (o, b + offsetof (SE_DERControlBase_t, opModFixedVar))
+      && xml_put_end (o, "</opModFixedVar>", 16), 0);
+  }
+  if (*(uint32_t *)b >> 7 & 1) {
+    ok_v (xml_put_tag (o, "<opModFixedW>", 13)
+      && xml_put_int (o, *(int16_t *)(b + offsetof (SE_DERControlBase_t, opModFixedW)))
+      && xml_put (o, "</opModFixedW>", 14), 0);
+  }
+  if (*(uint32_t *)b >> 8 & 1) {
+    ok_v (xml_put_start (o, "<opModFreqDroop", 15)
+      && xml_output_FreqDroopType (o, b + offsetof (SE_DERControlBase_t, opModFreqDroop))
+      && xml_put_end (o, "</opModFreqDroop>", 17), 0);
+  }
+  if (*(uint32_t *)b >> 9 & 1) {
+    ok_v (xml_put_start (o, "<opModFreqWatt", 14)
+      && xml_output_DERCurveLink (o, b + offsetof (SE_DERControlBase_t, opModFreqWatt))
+      && xml_put_end (o, "</opModFreqWatt>", 16), 0);
+  }
+  if (*(uint32_t *)b >> 10 & 1) {
+    ok_v (xml_put_start (o, "<opModHFRTMayTrip", 17)
+      && xml_output_DERCurveLink (o, b + offsetof (SE_DERControlBase_t, opModHFRTMayTrip))
+      && xml_put_end (o, "</opModHFRTMayTrip>", 19), 0);
+  }
+  if (*(uint32_t *)b >> 11 & 1) {
+    ok_v (xml_put_start (o, "<opModHFRTMustTrip", 18)
+      && xml_output_DERCurveLink (o, b + offsetof (SE_DERControlBase_t, opModHFRTMustTrip))
+      && xml_put_end (o, "</opModHFRTMustTrip>", 20), 0);
+  }
+  if (*(uint32_t *)b >> 12 & 1) {
+    ok_v (xml_put_start (o, "<opModHVRTMayTrip", 17)
+      && xml_output_DERCurveLink (o, b + offsetof (SE_DERControlBase_t, opModHVRTMayTrip))
+      && xml_put_end (o, "</opModHVRTMayTrip>", 19), 0);
+  }
+  if (*(uint32_t *)b >> 13 & 1) {
+    ok_v (xml_put_start (o, "<opModHVRTMomentaryCessation", 28)
+      && xml_output_DERCurveLink (o, b + offsetof (SE_DERControlBase_t, opModHVRTMomentaryCessation))
+      && xml_put_end (o, "</opModHVRTMomentaryCessation>", 30), 0);
+  }
+  if (*(uint32_t *)b >> 14 & 1) {
+    ok_v (xml_put_start (o, "<opModHVRTMustTrip", 18)
+      && xml_output_DERCurveLink (o, b + offsetof (SE_DERControlBase_t, opModHVRTMustTrip))
+      && xml_put_end (o, "</opModHVRTMustTrip>", 20), 0);
+  }
+  if (*(uint32_t *)b >> 15 & 1) {
+    ok_v (xml_put_start (o, "<opModLFRTMayTrip", 17)
+      && xml_output_DERCurveLink (o, b + offsetof (SE_DERControlBase_t, opModLFRTMayTrip))
+      && xml_put_end (o, "</opModLFRTMayTrip>", 19), 0);
+  }
+  if (*(uint32_t *)b >> 16 & 1) {
+    ok_v (xml_put_start (o, "<opModLFRTMustTrip", 18)
+      && xml_output_DERCurveLink (o, b + offsetof (SE_DERControlBase_t, opModLFRTMustTrip))
+      && xml_put_end (o, "</opModLFRTMustTrip>", 20), 0);
+  }
+  if (*(uint32_t *)b >> 17 & 1) {
+    ok_v (xml_put_start (o, "<opModLVRTMayTrip", 17)
+      && xml_output_DERCurveLink (o, b + offsetof (SE_DERControlBase_t, opModLVRTMayTrip))
+      && xml_put_end (o, "</opModLVRTMayTrip>", 19), 0);
+  }
+  if (*(uint32_t *)b >> 18 & 1) {
+    ok_v (xml_put_start (o, "<opModLVRTMomentaryCessation", 28)
+      && xml_output_DERCurveLink (o, b + offsetof (SE_DERControlBase_t, opModLVRTMomentaryCessation))
+      && xml_put_end (o, "</opModLVRTMomentaryCessation>", 30), 0);
+  }
+  if (*(uint32_t *)b >> 19 & 1) {
+    ok_v (xml_put_start (o, "<opModLVRTMustTrip", 18)
+      && xml_output_DERCurveLink (o, b + offsetof (SE_DERControlBase_t, opModLVRTMustTrip))
+      && xml_put_end (o, "</opModLVRTMustTrip>", 20), 0);
+  }
+  if (*(uint32_t *)b >> 20 & 1) {
+    ok_v (xml_put_tag (o, "<opModMaxLimW>", 14)
+      && xml_put_uint (o, *(uint16_t *)(b + offsetof (SE_DERControlBase_t, opModMaxLimW)))
+      && xml_put (o, "</opModMaxLimW>", 15), 0);
+  }
+  if (*(uint32_t *)b >> 21 & 1) {
+    ok_v (xml_put_start (o, "<opModTargetVar", 15)
+      && xml_output_ReactivePower (o, b + offsetof (SE_DERControlBase_t, opModTargetVar))
+      && xml_put_end (o, "</opModTargetVar>", 17), 0);
+  }
+  if (*(uint32_t *)b >> 22 & 1) {
+    ok_v (xml_put_start (o, "<opModTargetW", 13)
+      && xml_output_ActivePower (o, b + offsetof (SE_DERControlBase_t, opModTargetW))
+      && xml_put_end (o, "</opModTargetW>", 15), 0);
+  }
+  if (*(uint32_t *)b >> 23 & 1) {
+    ok_v (xml_put_start (o, "<opModVoltVar", 13)
+      && xml_output_DERCurveLink (o, b + offsetof (SE_DERControlBase_t, opModVoltVar))
+      && xml_put_end (o, "</opModVoltVar>", 15), 0);
+  }
+  if (*(uint32_t *)b >> 24 & 1) {
+    ok_v (xml_put_start (o, "<opModVoltWatt", 14)
+      && xml_output_DERCurveLink (o, b + offsetof (SE_DERControlBase_t, opModVoltWatt))
+      && xml_put_end (o, "</opModVoltWatt>", 16), 0);
+  }
+  if (*(uint32_t *)b >> 25 & 1) {
+    ok_v (xml_put_start (o, "<opModWattPF", 12)
+      && xml_output_DERCurveLink (o, b + offsetof (SE_DERControlBase_t, opModWattPF))
+      && xml_put_end (o, "</opModWattPF>", 14), 0);
+  }
+  if (*(uint32_t *)b >> 26 & 1) {
+    ok_v (xml_put_start (o, "<opModWattVar", 13)
+      && xml_output_DERCurveLink (o, b + offsetof (SE_DERControlBase_t, opModWattVar))
+      && xml_put_end (o, "</opModWattVar>", 15), 0);
+  }
+  if (*(uint32_t *)b >> 27 & 1) {
+    ok_v (xml_put_tag (o, "<rampTms>", 9)
+      && xml_put_uint (o, *(uint16_t *)(b + offsetof (SE_DERControlBase_t, rampTms)))
+      && xml_put (o, "</rampTms>", 10), 0);
+  }
+  return 1;
+}
+
+int xml_parse_DERControlBase (Parser *p, char **s, char *b,
+		const char *end, int length) {
+  ScanTag tag; char text[SCAN_TEXT];
+  ok_v (xml_scan_tag (s, &tag), 0);
+  if (tag.empty) return 1;
+  if (xml_scan_start (s, "<opModConnect", 13)) {
+    *(uint32_t *)b |= 1 << 0;
+    ok_v (xml_scan_text (s, text)
+      && xml_bool (text, b, 1)
+      && xml_scan_end (s, "</opModConnect>", 15), 0);
+  }
+  if (xml_scan_start (s, "<opModEnergize", 14)) {
+    *(uint32_t *)b |= 1 << 2;
+    ok_v (xml_scan_text (s, text)
+      && xml_bool (text, b, 3)
+      && xml_scan_end (s, "</opModEnergize>", 16), 0);
+  }
+  if (xml_scan_start (s, "<opModFixedPFAbsorbW", 20)) {
+    *(uint32_t *)b |= 1 << 4;
+    ok_v (xml_parse_PowerFactorWithExcitation (p, s, b + offsetof (SE_DERControlBase_t, opModFixedPFAbsorbW), "</opModFixedPFAbsorbW>", 22), 0);
+  }
+  if (xml_scan_start (s, "<opModFixedPFInjectW", 20)) {
+    *(uint32_t *)b |= 1 << 5;
+    ok_v (xml_parse_PowerFactorWithExcitation (p, s, b + offsetof (SE_DERControlBase_t, opModFixedPFInjectW), "</opModFixedPFInjectW>", 22), 0);
+  }
+  if (xml_scan_start (s, "<opModFixedVar", 14)) {
+    *(uint32_t *)b |= 1 << 6;
+    ok_v (xml_parse_FixedVar (p, s, b + offsetof (SE_DERControlBase_t, opModFixedVar), "</opModFixedVar>", 16), 0);
+  }
+  if (xml_scan_start (s, "<opModFixedW", 12)) {
+    *(uint32_t *)b |= 1 << 7;
+    ok_v (xml_scan_text (s, text)
+      && xml_short (text, (int16_t *)(b + offsetof (SE_DERControlBase_t, opModFixedW)))
+      && xml_scan_end (s, "</opModFixedW>", 14), 0);
+  }
+  if (xml_scan_start (s, "<opModFreqDroop", 15)) {
+    *(uint32_t *)b |= 1 << 8;
+    ok_v (xml_parse_FreqDroopType (p, s, b + offsetof (SE_DERControlBase_t, opModFreqDroop), "</opModFreqDroop>", 17), 0);
+  }
+  if (xml_scan_start (s, "<opModFreqWatt", 14)) {
+    *(uint32_t *)b |= 1 << 9;
+    ok_v (xml_parse_DERCurveLink (p, s, b + offsetof (SE_DERControlBase_t, opModFreqWatt), "</opModFreqWatt>", 16), 0);
+  }
+  if (xml_scan_start (s, "<opModHFRTMayTrip", 17)) {
+    *(uint32_t *)b |= 1 << 10;
+    ok_v (xml_parse_DERCurveLink (p, s, b + offsetof (SE_DERControlBase_t, opModHFRTMayTrip), "</opModHFRTMayTrip>", 19), 0);
+  }
+  if (xml_scan_start (s, "<opModHFRTMustTrip", 18)) {
+    *(uint32_t *)b |= 1 << 11;
+    ok_v (xml_parse_DERCurveLink (p, s, b + offsetof (SE_DERControlBase_t, opModHFRTMustTrip), "</opModHFRTMustTrip>", 20), 0);
+  }
+  if (xml_scan_start (s, "<opModHVRTMayTrip", 17)) {
+    *(uint32_t *)b |= 1 << 12;
+    ok_v (xml_parse_DERCurveLink (p, s, b + offsetof (SE_DERControlBase_t, opModHVRTMayTrip), "</opModHVRTMayTrip>", 19), 0);
+  }
+  if (xml_scan_start (s, "<opModHVRTMomentaryCessation", 28)) {
+    *(uint32_t *)b |= 1 << 13;
+    ok_v (xml_parse_DERCurveLink (p, s, b + offsetof (SE_DERControlBase_t, opModHVRTMomentaryCessation), "</opModHVRTMomentaryCessation>", 30), 0);
+  }
+  if (xml_scan_start (s, "<opModHVRTMustTrip", 18)) {
+    *(uint32_t *)b |= 1 << 14;
+    ok_v (xml_parse_DERCurveLink (p, s, b + offsetof (SE_DERControlBase_t, opModHVRTMustTrip), "</opModHVRTMustTrip>", 20), 0);
+  }
+  if (xml_scan_start (s, "<opModLFRTMayTrip", 17)) {
+    *(uint32_t *)b |= 1 << 15;
+    ok_v (xml_parse_DERCurveLink (p, s, b + offsetof (SE_DERControlBase_t, opModLFRTMayTrip), "</opModLFRTMayTrip>", 19), 0);
+  }
+  if (xml_scan_start (s, "<opModLFRTMustTrip", 18)) {
+    *(uint32_t *)b |= 1 << 16;
+    ok_v (xml_parse_DERCurveLink (p, s, b + offsetof (SE_DERControlBase_t, opModLFRTMustTrip), "</opModLFRTMustTrip>", 20), 0);
+  }
+  if (xml_scan_start (s, "<opModLVRTMayTrip", 17)) {
+    *(uint32_t *)b |= 1 << 17;
+    ok_v (xml_parse_DERCurveLink (p, s, b + offsetof (SE_DERControlBase_t, opModLVRTMayTrip), "</opModLVRTMayTrip>", 19), 0);
+  }
+  if (xml_scan_start (s, "<opModLVRTMomentaryCessation", 28)) {
+    *(uint32_t *)b |= 1 << 18;
+    ok_v (xml_parse_DERCurveLink (p, s, b + offsetof (SE_DERControlBase_t, opModLVRTMomentaryCessation), "</opModLVRTMomentaryCessation>", 30), 0);
+  }
+  if (xml_scan_start (s, "<opModLVRTMustTrip", 18)) {
+    *(uint32_t *)b |= 1 << 19;
+    ok_v (xml_parse_DERCurveLink (p, s, b + offsetof (SE_DERControlBase_t, opModLVRTMustTrip), "</opModLVRTMustTrip>", 20), 0);
+  }
+  if (xml_scan_start (s, "<opModMaxLimW", 13)) {
+    *(uint32_t *)b |= 1 << 20;
+    ok_v (xml_scan_text (s, text)
+      && xml_ushort (text, (uint16_t *)(b + offsetof (SE_DERControlBase_t, opModMaxLimW)))
+      && xml_scan_end (s, "</opModMaxLimW>", 15), 0);
+  }
+  if (xml_scan_start (s, "<opModTargetVar", 15)) {
+    *(uint32_t *)b |= 1 << 21;
+    ok_v (xml_parse_ReactivePower (p, s, b + offsetof (SE_DERControlBase_t, opModTargetVar), "</opModTargetVar>", 17), 0);
+  }
+  if (xml_scan_start (s, "<opModTargetW", 13)) {
+    *(uint32_t *)b |= 1 << 22;
+    ok_v (xml_parse_ActivePower (p, s, b + offsetof (SE_DERControlBase_t, opModTargetW), "</opModTargetW>", 15), 0);
+  }
+  if (xml_scan_start (s, "<opModVoltVar", 13)) {
+    *(uint32_t *)b |= 1 << 23;
+    ok_v (xml_parse_DERCurveLink (p, s, b + offsetof (SE_DERControlBase_t, opModVoltVar), "</opModVoltVar>", 15), 0);
+  }
+  if (xml_scan_start (s, "<opModVoltWatt", 14)) {
+    *(uint32_t *)b |= 1 << 24;
+    ok_v (xml_parse_DERCurveLink (p, s, b + offsetof (SE_DERControlBase_t, opModVoltWatt), "</opModVoltWatt>", 16), 0);
+  }
+  if (xml_scan_start (s, "<opModWattPF", 12)) {
+    *(uint32_t *)b |= 1 << 25;
+    ok_v (xml_parse_DERCurveLink (p, s, b + offsetof (SE_DERControlBase_t, opModWattPF), "</opModWattPF>", 14), 0);
+  }
+  if (xml_scan_start (s, "<opModWattVar", 13)) {
+    *(uint32_t *)b |= 1 << 26;
+    ok_v (xml_parse_DERCurveLink (p, s, b + offsetof (SE_DERControlBase_t, opModWattVar), "</opModWattVar>", 15), 0);
+  }
+  if (xml_scan_start (s, "<rampTms", 8)) {
+    *(uint32_t *)b |= 1 << 27;
+    ok_v (xml_scan_text (s, text)
+      && xml_ushort (text, (uint16_t *)(b + offsetof (SE_DERControlBase_t, rampTms)))
+      && xml_scan_end (s, "</rampTms>", 10), 0);
+  }
+  return xml_scan_end (s, end, length);
+}
+
+int xml_output_PowerFactorWithExcitation (Output *o, char *b) {
+  ok_v (xml_put_tag (o, "<displacement>", 14)
+    && xml_put_uint (o, *(uint16_t *)(b + offsetof (SE_PowerFactorWithExcitation_t, displacement)))
+    && xml_put (o, "</displacement>", 15), 0);
+  ok_v (xml_put_tag (o, "<excitation>", 12)
+    && xml_put_bool (o, *(uint32_t *)b >> (0) & 1)
+    && xml_put (o, "</excitation>", 13), 0);
+  ok_v (xml_put_tag (o, "<multiplier>", 12)
+    && xml_put_int (o, *(int8_t *)(b + offsetof (SE_PowerFactorWithExcitation_t, multiplier)))
+    && xml_put (o, "</multiplier>", 13), 0);
+  return 1;
+}
+
+int xml_parse_PowerFactorWithExcitation (Parser *p, char **s, char *b,
+		const char *end, int length) {
+  ScanTag tag; char text[SCAN_TEXT];
+  ok_v (xml_scan_tag (s, &tag), 0);
+  if (tag.empty) return 0;
+  if (xml_scan_start (s, "<displacement", 13)) {
+    ok_v (xml_scan_text (s, text)
+      && xml_ushort (text, (uint16_t *)(b + offsetof (SE_PowerFactorWithExcitation_t, displacement)))
+      && xml_scan_end (s, "</displacement>", 15), 0);
+  }
+  if (xml_scan_start (s, "<excitation", 11)) {
+    ok_v (xml_scan_text (s, text)
+      && xml_bool (text, b, 0)
+      && xml_scan_end (s, "</excitation>", 13), 0);
+  }
+  if (xml_scan_start (s, "<multiplier", 11)) {
+    ok_v (xml_scan_text (s, text)
+      && xml_byte (text, (int8_t *)(b + offsetof (SE_PowerFactorWithExcitation_t, multiplier)))
+      && xml_scan_end (s, "</multiplier>", 13), 0);
+  }
+  return xml_scan_end (s, end, length);
+}
+
+int xml_output_FixedVar (Output *o, char *b) {
+  ok_v (xml_put_tag (o, "<refType>", 9)
+    && xml_put_uint (o, *(uint8_t *)(b + offsetof (SE_FixedVar_t, refType)))
+    && xml_put (o, "</refType>", 10), 0);
+  ok_v (xml_put_tag (o, "<value>", 7)
+    && xml_put_int (o, *(int16_t *)(b + offsetof (SE_FixedVar_t, value)))
+    && xml_put (o, "</value>", 8), 0);
+  return 1;
+}
+
+int xml_parse_FixedVar (Parser *p, char **s, char *b,
+		const char *end, int length) {
+  ScanTag tag; char text[SCAN_TEXT];
+  ok_v (xml_scan_tag (s, &tag), 0);
+  if (tag.empty) return 0;
+  if (xml_scan_start (s, "<refType", 8)) {
+    ok_v (xml_scan_text (s, text)
+      && xml_ubyte (text, (uint8_t *)(b + offsetof (SE_FixedVar_t, refType)))
+      && xml_scan_end (s, "</refType>", 10), 0);
+  }
+  if (xml_scan_start (s, "<value", 6)) {
+    ok_v (xml_scan_text (s, text)
+      && xml_short (text, (int16_t *)(b + offsetof (SE_FixedVar_t, value)))
+      && xml_scan_end (s, "</value>", 8), 0);
+  }
+  return xml_scan_end (s, end, length);
+}
+
+int xml_output_FreqDroopType (Output *o, char *b) {
+  ok_v (xml_put_tag (o, "<dBOF>", 6)
+    && xml_put_uint (o, *(uint32_t *)(b + offsetof (SE_FreqDroopType_t, dBOF)))
+    && xml_put (o, "</dBOF>", 7), 0);
+  ok_v (xml_put_tag (o, "<dBUF>", 6)
+    && xml_put_uint (o, *(uint32_t *)(b + offsetof (SE_FreqDroopType_t, dBUF)))
+    && xml_put (o, "</dBUF>", 7), 0);
+  ok_v (xml_put_tag (o, "<kOF>", 5)
+    && xml_put_uint (o, *(uint16_t *)(b + offsetof (SE_FreqDroopType_t, kOF)))
+    && xml_put (o, "</kOF>", 6), 0);
+  ok_v (xml_put_tag (o, "<kUF>", 5)
+    && xml_put_uint (o, *(uint16_t *)(b + offsetof (SE_FreqDroopType_t, kUF)))
+    && xml_put (o, "</kUF>", 6), 0);
+  ok_v (xml_put_tag (o, "<openLoopTms>", 13)
+    && xml_put_uint (o, *(uint16_t *)(b + offsetof (SE_FreqDroopType_t, openLoopTms)))
+    && xml_put (o, "</openLoopTms>", 14), 0);
+  return 1;
+}
+
+int xml_parse_FreqDroopType (Parser *p, char **s, char *b,
+		const char *end, int length) {
+  ScanTag tag; char text[SCAN_TEXT];
+  ok_v (xml_scan_tag (s, &tag), 0);
+  if (tag.empty) return 0;
+  if (xml_scan_start (s, "<dBOF", 5)) {
+    ok_v (xml_scan_text (s, text)
+      && xml_uint (text, (uint32_t *)(b + offsetof (SE_FreqDroopType_t, dBOF)))
+      && xml_scan_end (s, "</dBOF>", 7), 0);
+  }
+  if (xml_scan_start (s, "<dBUF", 5)) {
+    ok_v (xml_scan_text (s, text)
+      && xml_uint (text, (uint32_t *)(b + offsetof (SE_FreqDroopType_t, dBUF)))
+      && xml_scan_end (s, "</dBUF>", 7), 0);
+  }
+  if (xml_scan_start (s, "<kOF", 4)) {
+    ok_v (xml_scan_text (s, text)
+      && xml_ushort (text, (uint16_t *)(b + offsetof (SE_FreqDroopType_t, kOF)))
+      && xml_scan_end (s, "</kOF>", 6), 0);
+  }
+  if (xml_scan_start (s, "<kUF", 4)) {
+    ok_v (xml_scan_text (s, text)
+      && xml_ushort (text, (uint16_t *)(b + offsetof (SE_FreqDroopType_t, kUF)))
+      && xml_scan_end (s, "</kUF>", 6), 0);
+  }
+  if (xml_scan_start (s, "<openLoopTms", 12)) {
+    ok_v (xml_scan_text (s, text)
+      && xml_ushort (text, (uint16_t *)(b + offsetof (SE_FreqDroopType_t, openLoopTms)))
+      && xml_scan_end (s, "</openLoopTms>", 14), 0);
+  }
+  return xml_scan_end (s, end, length);
+}
+
+int xml_output_DERCurveLink (Output *o, char *b) {
+  if (*(char **)(b + offsetof (SE_DERCurveLink_t, href))) {
+    ok_v (xml_put (o, " href=\"", 7)
+	  && output_escaped (o, *(char **)(b + offsetof (SE_DERCurveLink_t, href)))
+	  && xml_put (o, "\"", 1), 0);
+  } else return 0;
+  return 1;
+}
+
+int xml_parse_DERCurveLink (Parser *p, char **s, char *b,
+		const char *end, int length) {
+  ScanTag tag; char *v;
+  ok_v (xml_scan_tag (s, &tag), 0);
+  if ((v = xml_scan_attr (&tag, "href", 4))) {
+    ok_v (xml_uri (p, v, (char **)(b + offsetof (SE_DERCurveLink_t, href))), 0);
+  }
+  if (tag.empty) return 1;
+  return xml_scan_end (s, end, length);
+}
+
+int xml_output_ReactivePower (Output *o, char *b) {
+  ok_v (xml_put_tag (o, "<multiplier>", 12)
+    && xml_put_int (o, *(int8_t *)(b + offsetof (SE_ReactivePower_t, multiplier)))
+    && xml_put (o, "</multiplier>", 13), 0);
+  ok_v (xml_put_tag (o, "<value>", 7)
+    && xml_put_int (o, *(int16_t *)(b + offsetof (SE_ReactivePower_t, value)))
+    && xml_put (o, "</value>", 8), 0);
+  return 1;
+}
+
+int xml_parse_ReactivePower (Parser *p, char **s, char *b,
+		const char *end, int length) {
+  ScanTag tag; char text[SCAN_TEXT];
+  ok_v (xml_scan_tag (s, &tag), 0);
+  if (tag.empty) return 0;
+  if (xml_scan_start (s, "<multiplier", 11)) {
+    ok_v (xml_scan_text (s, text)
+      && xml_byte (text, (int8_t *)(b + offsetof (SE_ReactivePower_t, multiplier)))
+      && xml_scan_end (s, "</multiplier>", 13), 0);
+  }
+  if (xml_scan_start (s, "<value", 6)) {
+    ok_v (xml_scan_text (s, text)
+      && xml_short (text, (int16_t *)(b + offsetof (SE_ReactivePower_t, value)))
+      && xml_scan_end (s, "</value>", 8), 0);
+  }
+  return xml_scan_end (s, end, length);
+}
+
+int xml_output_ActivePower (Output *o, char *b) {
+  ok_v (xml_put_tag (o, "<multiplier>", 12)
+    && xml_put_int (o, *(int8_t *)(b + offsetof (SE_ActivePower_t, multiplier)))
+    && xml_put (o, "</multiplier>", 13), 0);
+  ok_v (xml_put_tag (o, "<value>", 7)
+    && xml_put_int (o, *(int16_t *)(b + offsetof (SE_ActivePower_t, value)))
+    && xml_put (o, "</value>", 8), 0);
+  return 1;
+}
+
+int xml_parse_ActivePower (Parser *p, char **s, char *b,
+		const char *end, int length) {
+  ScanTag tag; char text[SCAN_TEXT];
+  ok_v (xml_scan_tag (s, &tag), 0);
+  if (tag.empty) return 0;
+  if (xml_scan_start (s, "<multiplier", 11)) {
+    ok_v (xml_scan_text (s, text)
+      && xml_byte (text, (int8_t *)(b + offsetof (SE_ActivePower_t, multiplier)))
+      && xml_scan_end (s, "</multiplier>", 13), 0);
+  }
+  if (xml_scan_start (s, "<value", 6)) {
+    ok_v (xml_scan_text (s, text)
+      && xml_short (text, (int16_t *)(b + offsetof (SE_ActivePower_t, value)))
+      && xml_scan_end (s, "</value>", 8), 0);
+  }
+  return xml_scan_end (s, end, length);
+}
+
+int xml_output_DERControlList (Output *o, char *b) {
+  List *l;
+  {
+    ok_v (xml_put (o, " all=\"", 6)
+	  && xml_put_uint (o, *(uint32_t *)(b + offsetof (SE_DERControlList_t, all)))
+	  && xml_put (o, "\"", 1), 0);
+  }
+  if (*(char **)(b + offsetof (SE_DERControlList_t, href))) {
+    ok_v (xml_put (o, " href=\"", 7)
+	  && output_escaped (o, *(char **)(b + offsetof (SE_DERControlList_t, href)))
+	  && xml_put (o, "\"", 1), 0);
+  }
+  {
+    ok_v (xml_put (o, " results=\"", 10)
+	  && xml_put_uint (o, *(uint32_t *)(b + offsetof (SE_DERControlList_t, results)))
+	  && xml_put (o, "\"", 1), 0);
+  }
+  if (*(uint32_t *)b >> 1 & 1) {
+    ok_v (xml_put (o, " subscribable=\"", 15)
+	  && xml_put_uint (o, *(uint8_t *)(b + offsetof (SE_DERControlList_t, subscribable)))
+	  && xml_put (o, "\"", 1), 0);
+  }
+  for (l = *(List **)(b + offsetof (SE_DERControlList_t, DERControl)); l; l = l->next)
+    ok_v (xml_put_start (o, "<DERControl", 11)
+      && xml_output_DERControl (o, l->data)
+      && xml_put_end (o, "</DERControl>", 13), 0);
+  return 1;
+}
+
+int xml_parse_DERControlList (Parser *p, char **s, char *b,
+		const char *end, int length) {
+  ScanTag tag; char *v; int n; List *l, **tail;
+  ok_v (xml_scan_tag (s, &tag), 0);
+  if ((v = xml_scan_attr (&tag, "all", 3))) {
+    ok_v (xml_uint (v, (uint32_t *)(b + offsetof (SE_DERControlList_t, all))), 0);
+  }
+  if ((v = xml_scan_attr (&tag, "href", 4))) {
+    ok_v (xml_uri (p, v, (char **)(b + offsetof (SE_DERControlList_t, href))), 0);
+  }
+  if ((v = xml_scan_attr (&tag, "results", 7))) {
+    ok_v (xml_uint (v, (uint32_t *)(b + offsetof (SE_DERControlList_t, results))), 0);
+  }
+  if ((v = xml_scan_attr (&tag, "subscribable", 12))) {
+    *(uint32_t *)b |= 1 << 1;
+    ok_v (xml_ubyte (v, (uint8_t *)(b + offsetof (SE_DERControlList_t, subscribable))), 0);
+  }
+  if (tag.empty) return 1;
+  tail = (List **)(b + offsetof (SE_DERControlList_t, DERControl));
+  for (n = 0; xml_scan_start (s, "<DERControl", 11); n++) {
+    l = *tail = parse_alloc (p, sizeof (List));
+    l->data = parse_alloc (p, sizeof (SE_DERControl_t)); tail = &l->next;
+    ok_v (xml_parse_DERControl (p, s, l->data, "</DERControl>", 13), 0);
+  }
+  return xml_scan_end (s, end, length);
+}
+
+int xml_output_EndDevice (Output *o, char *b) {
+  if (*(char **)(b + offsetof (SE_EndDevice_t, href))) {
+    ok_v (xml_put (o, " href=\"", 7)
+	  && output_escaped (o, *(char **)(b + offsetof (SE_EndDevice_t, href)))
+	  && xml_put (o, "\"", 1), 0);
+  }
+  if (*(uint32_t *)b >> 1 & 1) {
+    ok_v (xml_put (o, " subscribable=\"", 15)
+	  && xml_put_uint (o, *(uint8_t *)(b + offsetof (SE_EndDevice_t, subscribable)))
+	  && xml_put (o, "\"", 1), 0);
+  }
+  if (*(uint32_t *)b >> 5 & 1) {
+    ok_v (xml_put_start (o, "<ConfigurationLink", 18)
+      && xml_output_ConfigurationLink (o, b + offsetof (SE_EndDevice_t, ConfigurationLink))
+      && xml_put_end (o, "</ConfigurationLink>", 20), 0);
+  }
+  if (*(uint32_t *)b >> 6 & 1) {
+    ok_v (xml_put_start (o, "<DERListLink", 12)
+      && xml_output_DERListLink (o, b + offsetof (SE_EndDevice_t, DERListLink))
+      && xml_put_end (o, "</DERListLink>", 14), 0);
+  }
+  if (*(uint32_t *)b >> 3 & 1) {
+    ok_v (xml_put_tag (o, "<deviceCategory>", 16)
+      && output_hex (o, (uint8_t *)(b + offsetof (SE_EndDevice_t, deviceCategory)), 4)
+      && xml_put (o, "</deviceCategory>", 17), 0);
+  }
+  if (*(uint32_t *)b >> 7 & 1) {
+    ok_v (xml_put_start (o, "<DeviceInformationLink", 22)
+      && xml_output_DeviceInformationLink (o, b + offsetof (SE_EndDevice_t, DeviceInformationLink))
+      && xml_put_end (o, "</DeviceInformationLink>", 24), 0);
+  }
+  if (*(uint32_t *)b >> 8 & 1) {
+    ok_v (xml_put_start (o, "<DeviceStatusLink", 17)
+      && xml_output_DeviceStatusLink (o, b + offsetof (SE_EndDevice_t, DeviceStatusLink))
+      && xml_put_end (o, "</DeviceStatusLink>", 19), 0);
+  }
+  if (*(uint32_t *)b >> 9 & 1) {
+    ok_v (xml_put_start (o, "<FileStatusLink", 15)
+      && xml_output_FileStatusLink (o, b + offsetof (SE_EndDevice_t, FileStatusLink))
+      && xml_put_end (o, "</FileStatusLink>", 17), 0);
+  }
+  if (*(uint32_t *)b >> 10 & 1) {
+    ok_v (xml_put_start (o, "<IPInterfaceListLink", 20)
+      && xml_output_IPInterfaceListLink (o, b + offsetof (SE_EndDevice_t, IPInterfaceListLink))
+      && xml_put_end (o, "</IPInterfaceListLink>", 22), 0);
+  }
+  if (*(uint32_t *)b >> 4 & 1) {
+    ok_v (xml_put_tag (o, "<lFDI>", 6)
+      && output_hex (o, (uint8_t *)(b + offsetof (SE_EndDevice_t, lFDI)), 20)
+      && xml_put (o, "</lFDI>", 7), 0);
+  }
+  if (*(uint32_t *)b >> 11 & 1) {
+    ok_v (xml_put_start (o, "<LoadShedAvailabilityListLink", 29)
+      && xml_output_LoadShedAvailabilityListLink (o, b + offsetof (SE_EndDevice_t, LoadShedAvailabilityListLink))
+      && xml_put_end (o, "</LoadShedAvailabilityListLink>", 31), 0);
+  }
+  if (*(uint32_t *)b >> 12 & 1) {
+    ok_v (xml_put_start (o, "<LogEventListLink", 17)
+      && xml_output_LogEventListLink (o, b + offsetof (SE_EndDevice_t, LogEventListLink))
+      && xml_put_end (o, "</LogEventListLink>", 19), 0);
+  }
+  if (*(uint32_t *)b >> 13 & 1) {
+    ok_v (xml_put_start (o, "<PowerStatusLink", 16)
+      && xml_output_PowerStatusLink (o, b + offsetof (SE_EndDevice_t, PowerStatusLink))
+      && xml_put_end (o, "</PowerStatusLink>", 18), 0);
+  }
+  ok_v (xml_put_tag (o, "<sFDI>", 6)
+    && xml_put_uint (o, *(uint64_t *)(b + offsetof (SE_EndDevice_t, sFDI)))
+    && xml_put (o, "</sFDI>", 7), 0);
+  ok_v (xml_put_tag (o, "<changedTime>", 13)
+    && xml_put_int (o, *(int64_t *)(b + offsetof (SE_EndDevice_t, changedTime)))
+    && xml_put (o, "</changedTime>", 14), 0);
+  if (*(uint32_t *)b >> 14 & 1) {
+    ok_v (xml_put_tag (o, "<enabled>", 9)
+      && xml_put_bool (o, *(uint32_t *)b >> (14) & 1)
+      && xml_put (o, "</enabled>", 10), 0);
+  }
+  if (*(uint32_t *)b >> 16 & 1) {
+    ok_v (xml_put_start (o, "<FlowReservationRequestListLink", 31)
+      && xml_output_FlowReservationRequestListLink (o, b + offsetof (SE_EndDevice_t, FlowReservationRequestListLink))
+      && xml_put_end (o, "</FlowReservationRequestListLink>", 33), 0);
+  }
+  if (*(uint32_t *)b >> 17 & 1) {
+    ok_v (xml_put_start (o, "<FlowReservationResponseListLink", 32)
+      && xml_output_FlowReservationResponseListLink (o, b + offsetof (SE_EndDevice_t, FlowReservationResponseListLink))
+      && xml_put_end (o, "</FlowReservationResponseListLink>", 34), 0);
+  }
+  if (*(uint32_t *)b >> 18 & 1) {
+    ok_v (xml_put_start (o, "<FunctionSetAssignmentsListLink", 31)
+      && xml_output_FunctionSetAssignmentsListLink (o, b + offsetof (SE_EndDevice_t, FunctionSetAssignmentsListLink))
+      && xml_put_end (o, "</FunctionSetAssignmentsListLink>", 33), 0);
+  }
+  if (*(uint32_t *)b >> 21 & 1) {
+    ok_v (xml_put_tag (o, "<postRate>", 10)
+      && xml_put_uint (o, *(uint32_t *)(b + offsetof (SE_EndDevice_t, postRate)))
+      && xml_put (o, "</postRate>", 11), 0);
+  }
+  if (*(uint32_t *)b >> 19 & 1) {
+    ok_v (xml_put_start (o, "<RegistrationLink", 17)
+      && xml_output_RegistrationLink (o, b + offsetof (SE_EndDevice_t, RegistrationLink))
+      && xml_put_end (o, "</RegistrationLink>", 19), 0);
+  }
+  if (*(uint32_t *)b >> 20 & 1) {
+    ok_v (xml_put_start (o, "<SubscriptionListLink", 21)
+      && xml_output_SubscriptionListLink (o, b + offsetof (SE_EndDevice_t, SubscriptionListLink))
+      && xml_put_end (o, "</SubscriptionListLink>", 23), 0);
+  }
+  return 1;
+}
+
+int xml_parse_EndDevice (Parser *p, char **s, char *b,
+		const char *end, int length) {
+  ScanTag tag; char text[SCAN_TEXT], *v;
+  ok_v (xml_scan_tag (s, &tag), 0);
+  if ((v = xml_scan_attr (&tag, "href", 4))) {
+    ok_v (xml_uri (p, v, (char **)(b + offsetof (SE_EndDevice_t, href))), 0);
+  }
+  if ((v = xml_scan_attr (&tag, "subscribable", 12))) {
+    *(uint32_t *)b |= 1 << 1;
+    ok_v (xml_ubyte (v, (uint8_t *)(b + offsetof (SE_EndDevice_t, subscribable))), 0);
+  }
+  if (tag.empty) return 0;
+  if (xml_scan_start (s, "<ConfigurationLink", 18)) {
+    *(uint32_t *)b |= 1 << 5;
+    ok_v (xml_parse_ConfigurationLink (p, s, b + offsetof (SE_EndDevice_t, ConfigurationLink), "</ConfigurationLink>", 20), 0);
+  }
+  if (xml_scan_start (s, "<DERListLink", 12)) {
+    *(uint32_t *)b |= 1 << 6;
+    ok_v (xml_parse_DERListLink (p, s, b + offsetof (SE_EndDevice_t, DERListLink), "</DERListLink>", 14), 0);
+  }
+  if (xml_scan_start (s, "<deviceCategory", 15)) {
+    *(uint32_t *)b |= 1 << 3;
+    ok_v (xml_scan_text (s, text)
+      && parse_hex ((uint8_t *)(b + offsetof (SE_EndDevice_t, deviceCategory)), 4, text)
+      && xml_scan_end (s, "</deviceCategory>", 17), 0);
+  }
+  if (xml_scan_start (s, "<DeviceInformationLink", 22)) {
+    *(uint32_t *)b |= 1 << 7;
+    ok_v (xml_parse_DeviceInformationLink (p, s, b + offsetof (SE_EndDevice_t, DeviceInformationLink), "</DeviceInformationLink>", 24), 0);
+  }
+  if (xml_scan_start (s, "<DeviceStatusLink", 17)) {
+    *(uint32_t *)b |= 1 << 8;
+    ok_v (xml_parse_DeviceStatusLink (p, s, b + offsetof (SE_EndDevice_t, DeviceStatusLink), "</DeviceStatusLink>", 19), 0);
+  }
+  if (xml_scan_start (s, "<FileStatusLink", 15)) {
+    *(uint32_t *)b |= 1 << 9;
+    ok_v (xml_parse_FileStatusLink (p, s, b + offsetof (SE_EndDevice_t, FileStatusLink), "</FileStatusLink>", 17), 0);
+  }
+  if (xml_scan_start (s, "<IPInterfaceListLink", 20)) {
+    *(uint32_t *)b |= 1 << 10;
+    ok_v (xml_parse_IPInterfaceListLink (p, s, b + offsetof (SE_EndDevice_t, IPInterfaceListLink), "</IPInterfaceListLink>", 22), 0);
+  }
+  if (xml_scan_start (s, "<lFDI", 5)) {
+    *(uint32_t *)b |= 1 << 4;
+    ok_v (xml_scan_text (s, text)
+      && parse_hex ((uint8_t *)(b + offsetof (SE_EndDevice_t, lFDI)), 20, text)
+      && xml_scan_end (s, "</lFDI>", 7), 0);
+  }
+  if (xml_scan_start (s, "<LoadShedAvailabilityListLink", 29)) {
+    *(uint32_t *)b |= 1 << 11;
+    ok_v (xml_parse_LoadShedAvailabilityListLink (p, s, b + offsetof (SE_EndDevice_t, LoadShedAvailabilityListLink), "</LoadShedAvailabilityListLink>", 31), 0);
+  }
+  if (xml_scan_start (s, "<LogEventListLink", 17)) {
+    *(uint32_t *)b |= 1 << 12;
+    ok_v (xml_parse_LogEventListLink (p, s, b + offsetof (SE_EndDevice_t, LogEventListLink), "</LogEventListLink>", 19), 0);
+  }
+  if (xml_scan_start (s, "<PowerStatusLink", 16)) {
+    *(uint32_t *)b |= 1 << 13;
+    ok_v (xml_parse_PowerStatusLink (p, s, b + offsetof (SE_EndDevice_t, PowerStatusLink), "</PowerStatusLink>", 18), 0);
+  }
+  if (xml_scan_start (s, "<sFDI", 5)) {
+    ok_v (xml_scan_text (s, text)
+      && xml_ulong (text, (uint64_t *)(b + offsetof (SE_EndDevice_t, sFDI)))
+      && xml_scan_end (s, "</sFDI>", 7), 0);
+  }
+  if (xml_scan_start (s, "<changedTime", 12)) {
+    ok_v (xml_scan_text (s, text)
+      && xml_long (text, (int64_t *)(b + offsetof (SE_EndDevice_t, changedTime)))
+      && xml_scan_end (s, "</changedTime>", 14), 0);
+  }
+  if (xml_scan_start (s, "<enabled", 8)) {
+    *(uint32_t *)b |= 1 << 14;
+    ok_v (xml_scan_text (s, text)
+      && xml_bool (text, b, 15)
+      && xml_scan_end (s, "</enabled>", 10), 0);
+  }
+  if (xml_scan_start (s, "<FlowReservationRequestListLink", 31)) {
+    *(uint32_t *)b |= 1 << 16;
+    ok_v (xml_parse_FlowReservationRequestListLink (p, s, b + offsetof (SE_EndDevice_t, FlowReservationRequestListLink), "</FlowReservationRequestListLink>", 33), 0);
+  }
+  if (xml_scan_start (s, "<FlowReservationResponseListLink", 32)) {
+    *(uint32_t *)b |= 1 << 17;
+    ok_v (xml_parse_FlowReservationResponseListLink (p, s, b + offsetof (SE_EndDevice_t, FlowReservationResponseListLink), "</FlowReservationResponseListLink>", 34), 0);
+  }
+  if (xml_scan_start (s, "<FunctionSetAssignmentsListLink", 31)) {
+    *(uint32_t *)b |= 1 << 18;
+    ok_v (xml_parse_FunctionSetAssignmentsListLink (p, s, b + offsetof (SE_EndDevice_t, FunctionSetAssignmentsListLink), "</FunctionSetAssignmentsListLink>", 33), 0);
+  }
+  if (xml_scan_start (s, "<postRate", 9)) {
+    *(uint32_t *)b |= 1 << 21;
+    ok_v (xml_scan_text (s, text)
+      && xml_uint (text, (uint32_t *)(b + offsetof (SE_EndDevice_t, postRate)))
+      && xml_scan_end (s, "</postRate>", 11), 0);
+  }
+  if (xml_scan_start (s, "<RegistrationLink", 17)) {
+    *(uint32_t *)b |= 1 << 19;
+    ok_v (xml_parse_RegistrationLink (p, s, b + offsetof (SE_EndDevice_t, RegistrationLink), "</RegistrationLink>", 19), 0);
+  }
+  if (xml_scan_start (s, "<SubscriptionListLink", 21)) {
+    *(uint32_t *)b |= 1 << 20;
+    ok_v (xml_parse_SubscriptionListLink (p, s, b + offsetof (SE_EndDevice_t, SubscriptionListLink), "</SubscriptionListLink>", 23), 0);
+  }
+  return xml_scan_end (s, end, length);
+}
+
+int xml_output_ConfigurationLink (Output *o, char *b) {
+  if (*(char **)(b + offsetof (SE_ConfigurationLink_t, href))) {
+    ok_v (xml_put (o, " href=\"", 7)
+	  && output_escaped (o, *(char **)(b + offsetof (SE_ConfigurationLink_t, href)))
+	  && xml_put (o, "\"", 1), 0);
+  } else return 0;
+  return 1;
+}
+
+int xml_parse_ConfigurationLink (Parser *p, char **s, char *b,
+		const char *end, int length) {
+  ScanTag tag; char *v;
+  ok_v (xml_scan_tag (s, &tag), 0);
+  if ((v = xml_scan_attr (&tag, "href", 4))) {
+    ok_v (xml_uri (p, v, (char **)(b + offsetof (SE_ConfigurationLink_t, href))), 0);
+  }
+  if (tag.empty) return 1;
+  return xml_scan_end (s, end, length);
+}
+
+int xml_output_DERListLink (Output *o, char *b) {
+  if (*(uint32_t *)b >> 0 & 1) {
+    ok_v (xml_put (o, " all=\"", 6)
+	  && xml_put_uint (o, *(uint32_t *)(b + offsetof (SE_DERListLink_t, all)))
+	  && xml_put (o, "\"", 1), 0);
+  }
+  if (*(char **)(b + offsetof (SE_DERListLink_t, href))) {
+    ok_v (xml_put (o, " href=\"", 7)
+	  && output_escaped (o, *(char **)(b + offsetof (SE_DERListLink_t, href)))
+	  && xml_put (o, "\"", 1), 0);
+  } else return 0;
+  return 1;
+}
+
+int xml_parse_DERListLink (Parser *p, char **s, char *b,
+		const char *end, int length) {
+  ScanTag tag; char *v;
+  ok_v (xml_scan_tag (s, &tag), 0);
+  if ((v = xml_scan_attr (&tag, "all", 3))) {
+    *(uint32_t *)b |= 1 << 0;
+    ok_v (xml_uint (v, (uint32_t *)(b + offsetof (SE_DERListLink_t, all))), 0);
+  }
+  if ((v = xml_scan_attr (&tag, "href", 4))) {
+    ok_v (xml_uri (p, v, (char **)(b + offsetof (SE_DERListLink_t, href))), 0);
+  }
+  if (tag.empty) return 1;
+  return xml_scan_end (s, end, length);
+}
+
+int xml_output_DeviceInformationLink (Output *o, char *b) {
+  if (*(char **)(b + offsetof (SE_DeviceInformationLink_t, href))) {
+    ok_v (xml_put (o, " href=\"", 7)
+	  && output_escaped (o, *(char **)(b + offsetof (SE_DeviceInformationLink_t, href)))
+	  && xml_put (o, "\"", 1), 0);
+  } else return 0;
+  return 1;
+}
+
+int xml_parse_DeviceInformationLink (Parser *p, char **s, char *b,
+		const char *end, int length) {
+  ScanTag tag; char *v;
+  ok_v (xml_scan_tag (s, &tag), 0);
+  if ((v = xml_scan_attr (&tag, "href", 4))) {
+    ok_v (xml_uri (p, v, (char **)(b + offsetof (SE_DeviceInformationLink_t, href))), 0);
+  }
+  if (tag.empty) return 1;
+  return xml_scan_end (s, end, length);
+}
+
+int xml_output_DeviceStatusLink (Output *o, char *b) {
+  if (*(char **)(b + offsetof (SE_DeviceStatusLink_t, href))) {
+    ok_v (xml_put (o, " href=\"", 7)
+	  && output_escaped (o, *(char **)(b + offsetof (SE_DeviceStatusLink_t, href)))
+	  && xml_put (o, "\"", 1), 0);
+  } else return 0;
+  return 1;
+}
+
+int xml_parse_DeviceStatusLink (Parser *p, char **s, char *b,
+		const char *end, int length) {
+  ScanTag tag; char *v;
+  ok_v (xml_scan_tag (s, &tag), 0);
+  if ((v = xml_scan_attr (&tag, "href", 4))) {
+    ok_v (xml_uri (p, v, (char **)(b + offsetof (SE_DeviceStatusLink_t, href))), 0);
+  }
+  if (tag.empty) return 1;
+  return xml_scan_end (s, end, length);
+}
+
+int xml_output_FileStatusLink (Output *o, char *b) {
+  if (*(char **)(b + offsetof (SE_FileStatusLink_t, href))) {
+    ok_v (xml_put (o, " href=\"", 7)
+	  && output_escaped (o, *(char **)(b + offsetof (SE_FileStatusLink_t, href)))
+	  && xml_put (o, "\"", 1), 0);
+  } else return 0;
+  return 1;
+}
+
+int xml_parse_FileStatusLink (Parser *p, char **s, char *b,
+		const char *end, int length) {
+  ScanTag tag; char *v;
+  ok_v (xml_scan_tag (s, &tag), 0);
+  if ((v = xml_scan_attr (&tag, "href", 4))) {
+    ok_v (xml_uri (p, v, (char **)(b + offsetof (SE_FileStatusLink_t, href))), 0);
+  }
+  if (tag.empty) return 1;
+  return xml_scan_end (s, end, length);
+}
+
+int xml_output_IPInterfaceListLink (Output *o, char *b) {
+  if (*(uint32_t *)b >> 0 & 1) {
+    ok_v (xml_put (o, " all=\"", 6)
+	  && xml_put_uint (o, *(uint32_t *)(b + offsetof (SE_IPInterfaceListLink_t, all)))
+	  && xml_put (o, "\"", 1), 0);
+  }
+  if (*(char **)(b + offsetof (SE_IPInterfaceListLink_t, href))) {
+    ok_v (xml_put (o, " href=\"", 7)
+	  && output_escaped (o, *(char **)(b + offsetof (SE_IPInterfaceListLink_t, href)))
+	  && xml_put (o, "\"", 1), 0);
+  } else return 0;
+  return 1;
+}
+
+int xml_parse_IPInterfaceListLink (Parser *p, char **s, char *b,
+		const char *end, int length) {
+  ScanTag tag; char *v;
+  ok_v (xml_scan_tag (s, &tag), 0);
+  if ((v = xml_scan_attr (&tag, "all", 3))) {
+    *(uint32_t *)b |= 1 << 0;
+    ok_v (xml_uint (v, (uint32_t *)(b + offsetof (SE_IPInterfaceListLink_t, all))), 0);
+  }
+  if ((v = xml_scan_attr (&tag, "href", 4))) {
+    ok_v (xml_uri (p, v, (char **)(b + offsetof (SE_IPInterfaceListLink_t, href))), 0);
+  }
+  if (tag.empty) return 1;
+  return xml_scan_end (s, end, length);
+}
+
+int xml_output_LoadShedAvailabilityListLink (Output *o, char *b) {
+  if (*(uint32_t *)b >> 0 & 1) {
+    ok_v (xml_put (o, " all=\"", 6)
+	  && xml_put_uint (o, *(uint32_t *)(b + offsetof (SE_LoadShedAvailabilityListLink_t, all)))
+	  && xml_put (o, "\"", 1), 0);
+  }
+  if (*(char **)(b + offsetof (SE_LoadShedAvailabilityListLink_t, href))) {
+    ok_v (xml_put (o, " href=\"", 7)
+	  && output_escaped (o, *(char **)(b + offsetof (SE_LoadShedAvailabilityListLink_t, href)))
+	  && xml_put (o, "\"", 1), 0);
+  } else return 0;
+  return 1;
+}
+
+int xml_parse_LoadShedAvailabilityListLink (Parser *p, char **s, char *b,
+		const char *end, int length) {
+  ScanTag tag; char *v;
+  ok_v (xml_scan_tag (s, &tag), 0);
+  if ((v = xml_scan_attr (&tag, "all", 3))) {
+    *(uint32_t *)b |= 1 << 0;
+    ok_v (xml_uint (v, (uint32_t *)(b + offsetof (SE_LoadShedAvailabilityListLink_t, all))), 0);
+  }
+  if ((v = xml_scan_attr (&tag, "href", 4))) {
+    ok_v (xml_uri (p, v, (char **)(b + offsetof (SE_LoadShedAvailabilityListLink_t, href))), 0);
+  }
+  if (tag.empty) return 1;
+  return xml_scan_end (s, end, length);
+}
+
+int xml_output_LogEventListLink (Output *o, char *b) {
+  if (*(uint32_t *)b >> 0 & 1) {
+    ok_v (xml_put (o, " all=\"", 6)
+	  && xml_put_uint (o, *(uint32_t *)(b + offsetof (SE_LogEventListLink_t, all)))
+	  && xml_put (o, "\"", 1), 0);
+  }
+  if (*(char **)(b + offsetof (SE_LogEventListLink_t, href))) {
+    ok_v (xml_put (o, " href=\"", 7)
+	  && output_escaped (o, *(char **)(b + offsetof (SE_LogEventListLink_t, href)))
+	  && xml_put (o, "\"", 1), 0);
+  } else return 0;
+  return 1;
+}
+
+int xml_parse_LogEventListLink (Parser *p, char **s, char *b,
+		const char *end, int length) {
+  ScanTag tag; char *v;
+  ok_v (xml_scan_tag (s, &tag), 0);
+  if ((v = xml_scan_attr (&tag, "all", 3))) {
+    *(uint32_t *)b |= 1 << 0;
+    ok_v (xml_uint (v, (uint32_t *)(b + offsetof (SE_LogEventListLink_t, all))), 0);
+  }
+  if ((v = xml_scan_attr (&tag, "href", 4))) {
+    ok_v (xml_uri (p, v, (char **)(b + offsetof (SE_LogEventListLink_t, href))), 0);
+  }
+  if (tag.empty) return 1;
+  return xml_scan_end (s, end, length);
+}
+
+int xml_output_PowerStatusLink (Output *o, char *b) {
+  if (*(char **)(b + offsetof (SE_PowerStatusLink_t, href))) {
+    ok_v (xml_put (o, " href=\"", 7)
+	  && output_escaped (o, *(char **)(b + offsetof (SE_PowerStatusLink_t, href)))
+	  && xml_put (o, "\"", 1), 0);
+  } else return 0;
+  return 1;
+}
+
+int xml_parse_PowerStatusLink (Parser *p, char **s, char *b,
+		const char *end, int length) {
+  ScanTag tag; char *v;
+  ok_v (xml_scan_tag (s, &tag), 0);
+  if ((v = xml_scan_attr (&tag, "href", 4))) {
+    ok_v (xml_uri (p, v, (char **)(b + offsetof (SE_PowerStatusLink_t, href))), 0);
+  }
+  if (tag.empty) return 1;
+  return xml_scan_end (s, end, length);
+}
+
+int xml_output_FlowReservationRequestListLink (Output *o, char *b) {
+  if (*(uint32_t *)b >> 0 & 1) {
+    ok_v (xml_put (o, " all=\"", 6)
+	  && xml_put_uint (o, *(uint32_t *)(b + offsetof (SE_FlowReservationRequestListLink_t, all)))
+	  && xml_put (o, "\"", 1), 0);
+  }
+  if (*(char **)(b + offsetof (SE_FlowReservationRequestListLink_t, href))) {
+    ok_v (xml_put (o, " href=\"", 7)
+	  && output_escaped (o, *(char **)(b + offsetof (SE_FlowReservationRequestListLink_t, href)))
+	  && xml_put (o, "\"", 1), 0);
+  } else return 0;
+  return 1;
+}
+
+int xml_parse_FlowReservationRequestListLink (Parser *p, char **s, char *b,
+		const char *end, int length) {
+  ScanTag tag; char *v;
+  ok_v (xml_scan_tag (s, &tag), 0);
+  if ((v = xml_scan_attr (&tag, "all", 3))) {
+    *(uint32_t *)b |= 1 << 0;
+    ok_v (xml_uint (v, (uint32_t *)(b + offsetof (SE_FlowReservationRequestListLink_t, all))), 0);
+  }
+  if ((v = xml_scan_attr (&tag, "href", 4))) {
+    ok_v (xml_uri (p, v, (char **)(b + offsetof (SE_FlowReservationRequestListLink_t, href))), 0);
+  }
+  if (tag.empty) return 1;
+  return xml_scan_end (s, end, length);
+}
+
+int xml_output_FlowReservationResponseListLink (Output *o, char *b) {
+  if (*(uint32_t *)b >> 0 & 1) {
+    ok_v (xml_put (o, " all=\"", 6)
+	  && xml_put_uint (o, *(uint32_t *)(b + offsetof (SE_FlowReservationResponseListLink_t, all)))
+	  && xml_put (o, "\"", 1), 0);
+  }
+  if (*(char **)(b + offsetof (SE_FlowReservationResponseListLink_t, href))) {
+    ok_v (xml_put (o, " href=\"", 7)
+	  && output_escaped (o, *(char **)(b + offsetof (SE_FlowReservationResponseListLink_t, href)))
+	  && xml_put (o, "\"", 1), 0);
+  } else return 0;
+  return 1;
+}
+
+int xml_parse_FlowReservationResponseListLink (Parser *p, char **s, char *b,
+		const char *end, int length) {
+  ScanTag tag; char *v;
+  ok_v (xml_scan_tag (s, &tag), 0);
+  if ((v = xml_scan_attr (&tag, "all", 3))) {
+    *(uint32_t *)b |= 1 << 0;
+    ok_v (xml_uint (v, (uint32_t *)(b + offsetof (SE_FlowReservationResponseListLink_t, all))), 0);
+  }
+  if ((v = xml_scan_attr (&tag, "href", 4))) {
+    ok_v (xml_uri (p, v, (char **)(b + offsetof (SE_FlowReservationResponseListLink_t, href))), 0);
+  }
+  if (tag.empty) return 1;
+  return xml_scan_end (s, end, length);
+}
+
+int xml_output_FunctionSetAssignmentsListLink (Output *o, char *b) {
+  if (*(uint32_t *)b >> 0 & 1) {
+    ok_v (xml_put (o, " all=\"", 6)
+	  && xml_put_uint (o, *(uint32_t *)(b + offsetof (SE_FunctionSetAssignmentsListLink_t, all)))
+	  && xml_put (o, "\"", 1), 0);
+  }
+  if (*(char **)(b + offsetof (SE_FunctionSetAssignmentsListLink_t, href))) {
+    ok_v (xml_put (o, " href=\"", 7)
+	  && output_escaped (o, *(char **)(b + offsetof (SE_FunctionSetAssignmentsListLink_t, href)))
+	  && xml_put (o, "\"", 1), 0);
+  } else return 0;
+  return 1;
+}
+
+int xml_parse_FunctionSetAssignmentsListLink (Parser *p, char **s, char *b,
+		const char *end, int length) {
+  ScanTag tag; char *v;
+  ok_v (xml_scan_tag (s, &tag), 0);
+  if ((v = xml_scan_attr (&tag, "all", 3))) {
+    *(uint32_t *)b |= 1 << 0;
+    ok_v (xml_uint (v, (uint32_t *)(b + offsetof (SE_FunctionSetAssignmentsListLink_t, all))), 0);
+  }
+  if ((v = xml_scan_attr (&tag, "href", 4))) {
+    ok_v (xml_uri (p, v, (char **)(b + offsetof (SE_FunctionSetAssignmentsListLink_t, href))), 0);
+  }
+  if (tag.empty) return 1;
+  return xml_scan_end (s, end, length);
+}
+
+int xml_output_RegistrationLink (Output *o, char *b) {
+  if (*(char **)(b + offsetof (SE_RegistrationLink_t, href))) {
+    ok_v (xml_put (o, " href=\"", 7)
+	  && output_escaped (o, *(char **)(b + offsetof (SE_RegistrationLink_t, href)))
+	  && xml_put (o, "\"", 1), 0);
+  } else return 0;
+  return 1;
+}
+
+int xml_parse_RegistrationLink (Parser *p, char **s, char *b,
+		const char *end, int length) {
+  ScanTag tag; char *v;
+  ok_v (xml_scan_tag (s, &tag), 0);
+  if ((v = xml_scan_attr (&tag, "href", 4))) {
+    ok_v (xml_uri (p, v, (char **)(b + offsetof (SE_RegistrationLink_t, href))), 0);
+  }
+  if (tag.empty) return 1;
+  return xml_scan_end (s, end, length);
+}
+
+int xml_output_SubscriptionListLink (Output *o, char *b) {
+  if (*(uint32_t *)b >> 0 & 1) {
+    ok_v (xml_put (o, " all=\"", 6)
+	  && xml_put_uint (o, *(uint32_t *)(b + offsetof (SE_SubscriptionListLink_t, all)))
+	  && xml_put (o, "\"", 1), 0);
+  }
+  if (*(char **)(b + offsetof (SE_SubscriptionListLink_t, href))) {
+    ok_v (xml_put (o, " href=\"", 7)
+	  && output_escaped (o, *(char **)(b + offsetof (SE_SubscriptionListLink_t, href)))
+	  && xml_put (o, "\"", 1), 0);
+  } else return 0;
+  return 1;
+}
+
+int xml_parse_SubscriptionListLink (Parser *p, char **s, char *b,
+		const char *end, int length) {
+  ScanTag tag; char *v;
+  ok_v (xml_scan_tag (s, &tag), 0);
+  if ((v = xml_scan_attr (&tag, "all", 3))) {
+    *(uint32_t *)b |= 1 << 0;
+    ok_v (xml_uint (v, (uint32_t *)(b + offsetof (SE_SubscriptionListLink_t, all))), 0);
+  }
+  if ((v = xml_scan_attr (&tag, "href", 4))) {
+    ok_v (xml_uri (p, v, (char **)(b + offsetof (SE_SubscriptionListLink_t, href))), 0);
+  }
+  if (tag.empty) return 1;
+  return xml_scan_end (s, end, length);
+}
+
+int xml_output_Response (Output *o, char *b) {
+  if (*(char **)(b + offsetof (SE_Response_t, href))) {
+    ok_v (xml_put (o, " href=\"", 7)
+	  && output_escaped (o, *(char **)(b + offsetof (SE_Response_t, href)))
+	  && xml_put (o, "\"", 1), 0);
+  }
+  if (*(uint32_t *)b >> 0 & 1) {
+    ok_v (xml_put_tag (o, "<createdDateTime>", 17)
+      && xml_put_int (o, *(int64_t *)(b + offsetof (SE_Response_t, createdDateTime)))
+      && xml_put (o, "</createdDateTime>", 18), 0);
+  }
+  ok_v (xml_put_tag (o, "<endDeviceLFDI>", 15)
+    && output_hex (o, (uint8_t *)(b + offsetof (SE_Response_t, endDeviceLFDI)), 20)
+    && xml_put (o, "</endDeviceLFDI>", 16), 0);
+  if (*(uint32_t *)b >> 1 & 1) {
+    ok_v (xml_put_tag (o, "<status>", 8)
+      && xml_put_uint (o, *(uint8_t *)(b + offsetof (SE_Response_t, status)))
+      && xml_put (o, "</status>", 9), 0);
+  }
+  ok_v (xml_put_tag (o, "<subject>", 9)
+    && output_hex (o, (uint8_t *)(b + offsetof (SE_Response_t, subject)), 16)
+    && xml_put (o, "</subject>", 10), 0);
+  return 1;
+}
+
+int xml_parse_Response (Parser *p, char **s, char *b,
+		const char *end, int length) {
+  ScanTag tag; char text[SCAN_TEXT], *v;
+  ok_v (xml_scan_tag (s, &tag), 0);
+  if ((v = xml_scan_attr (&tag, "href", 4))) {
+    ok_v (xml_uri (p, v, (char **)(b + offsetof (SE_Response_t, href))), 0);
+  }
+  if (tag.empty) return 0;
+  if (xml_scan_start (s, "<createdDateTime", 16)) {
+    *(uint32_t *)b |= 1 << 0;
+    ok_v (xml_scan_text (s, text)
+      && xml_long (text, (int64_t *)(b + offsetof (SE_Response_t, createdDateTime)))
+      && xml_scan_end (s, "</createdDateTime>", 18), 0);
+  }
+  if (xml_scan_start (s, "<endDeviceLFDI", 14)) {
+    ok_v (xml_scan_text (s, text)
+      && parse_hex ((uint8_t *)(b + offsetof (SE_Response_t, endDeviceLFDI)), 20, text)
+      && xml_scan_end (s, "</endDeviceLFDI>", 16), 0);
+  }
+  if (xml_scan_start (s, "<status", 7)) {
+    *(uint32_t *)b |= 1 << 1;
+    ok_v (xml_scan_text (s, text)
+      && xml_ubyte (text, (uint8_t *)(b + offsetof (SE_Response_t, status)))
+      && xml_scan_end (s, "</status>", 9), 0);
+  }
+  if (xml_scan_start (s, "<subject", 8)) {
+    ok_v (xml_scan_text (s, text)
+      && parse_hex ((uint8_t *)(b + offsetof (SE_Response_t, subject)), 16, text)
+      && xml_scan_end (s, "</subject>", 10), 0);
+  }
+  return xml_scan_end (s, end, length);
+}
+
+int xml_output_MirrorMeterReading (Output *o, char *b) {
+  List *l;
+  if (*(char **)(b + offsetof (SE_MirrorMeterReading_t, href))) {
+    ok_v (xml_put (o, " href=\"", 7)
+	  && output_escaped (o, *(char **)(b + offsetof (SE_MirrorMeterReading_t, href)))
+	  && xml_put (o, "\"", 1), 0);
+  }
+  ok_v (xml_put_tag (o, "<mRID>", 6)
+    && output_hex (o, (uint8_t *)(b + offsetof (SE_MirrorMeterReading_t, mRID)), 16)
+    && xml_put (o, "</mRID>", 7), 0);
+  if (*(uint32_t *)b >> 0 & 1) {
+    ok_v (xml_put_tag (o, "<description>", 13)
+      && output_escaped (o, b + offsetof (SE_MirrorMeterReading_t, description))
+      && xml_put (o, "</description>", 14), 0);
+  }
+  if (*(uint32_t *)b >> 2 & 1) {
+    ok_v (xml_put_tag (o, "<version>", 9)
+      && xml_put_uint (o, *(uint16_t *)(b + offsetof (SE_MirrorMeterReading_t, version)))
+      && xml_put (o, "</version>", 10), 0);
+  }
+  if (*(uint32_t *)b >> 3 & 1) {
+    ok_v (xml_put_tag (o, "<lastUpdateTime>", 16)
+      && xml_put_int (o, *(int64_t *)(b + offsetof (SE_MirrorMeterReading_t, lastUpdateTime)))
+      && xml_put (o, "</lastUpdateTime>", 17), 0);
+  }
+  for (l = *(List **)(b + offsetof (SE_MirrorMeterReading_t, MirrorReadingSet)); l; l = l->next)
+    ok_v (xml_put_start (o, "<MirrorReadingSet", 17)
+      && xml_output_MirrorReadingSet (o, l->data)
+      && xml_put_end (o, "</MirrorReadingSet>", 19), 0);
+  if (*(uint32_t *)b >> 4 & 1) {
+    ok_v (xml_put_tag (o, "<nextUpdateTime>", 16)
+      && xml_put_int (o, *(int64_t *)(b + offsetof (SE_MirrorMeterReading_t, nextUpdateTime)))
+      && xml_put (o, "</nextUpdateTime>", 17), 0);
+  }
+  if (*(uint32_t *)b >> 5 & 1) {
+    ok_v (xml_put_start (o, "<Reading", 8)
+      && xml_output_Reading (o, b + offsetof (SE_MirrorMeterReading_t, Reading))
+      && xml_put_end (o, "</Reading>", 10), 0);
+  }
+  if (*(uint32_t *)b >> 6 & 1) {
+    ok_v (xml_put_start (o, "<ReadingType", 12)
+      && xml_output_ReadingType (o, b + offsetof (SE_MirrorMeterReading_t, ReadingType))
+      && xml_put_end (o, "</ReadingType>", 14), 0);
+  }
+  return 1;
+}
+
+int xml_parse_MirrorMeterReading (Parser *p, char **s, char *b,
+		const char *end, int length) {
+  ScanTag tag; char text[SCAN_TEXT], *v; int n; List *l, **tail;
+  ok_v (xml_scan_tag (s, &tag), 0);
+  if ((v = xml_scan_attr (&tag, "href", 4))) {
+    ok_v (xml_uri (p, v, (char **)(b + offsetof (SE_MirrorMeterReading_t, href))), 0);
+  }
+  if (tag.empty) return 0;
+  if (xml_scan_start (s, "<mRID", 5)) {
+    ok_v (xml_scan_text (s, text)
+      && parse_hex ((uint8_t *)(b + offsetof (SE_MirrorMeterReading_t, mRID)), 16, text)
+      && xml_scan_end (s, "</mRID>", 7), 0);
+  }
+  if (xml_scan_start (s, "<description", 12)) {
+    *(uint32_t *)b |= 1 << 0;
+    ok_v (xml_scan_text (s, text)
+      && xml_string (text, b + offsetof (SE_MirrorMeterReading_t, description), 32)
+      && xml_scan_end (s, "</description>", 14), 0);
+  }
+  if (xml_scan_start (s, "<version", 8)) {
+    *(uint32_t *)b |= 1 << 2;
+    ok_v (xml_scan_text (s, text)
+      && xml_ushort (text, (uint16_t *)(b + offsetof (SE_MirrorMeterReading_t, version)))
+      && xml_scan_end (s, "</version>", 10), 0);
+  }
+  if (xml_scan_start (s, "<lastUpdateTime", 15)) {
+    *(uint32_t *)b |= 1 << 3;
+    ok_v (xml_scan_text (s, text)
+      && xml_long (text, (int64_t *)(b + offsetof (SE_MirrorMeterReading_t, lastUpdateTime)))
+      && xml_scan_end (s, "</lastUpdateTime>", 17), 0);
+  }
+  tail = (List **)(b + offsetof (SE_MirrorMeterReading_t, MirrorReadingSet));
+  for (n = 0; xml_scan_start (s, "<MirrorReadingSet", 17); n++) {
+    l = *tail = parse_alloc (p, sizeof (List));
+    l->data = parse_alloc (p, sizeof (SE_MirrorReadingSet_t)); tail = &l->next;
+    ok_v (xml_parse_MirrorReadingSet (p, s, l->data, "</MirrorReadingSet>", 19), 0);
+  }
+  if (xml_scan_start (s, "<nextUpdateTime", 15)) {
+    *(uint32_t *)b |= 1 << 4;
+    ok_v (xml_scan_text (s, text)
+      && xml_long (text, (int64_t *)(b + offsetof (SE_MirrorMeterReading_t, nextUpdateTime)))
+      && xml_scan_end (s, "</nextUpdateTime>", 17), 0);
+  }
+  if (xml_scan_start (s, "<Reading", 8)) {
+    *(uint32_t *)b |= 1 << 5;
+    ok_v (xml_parse_Reading (p, s, b + offsetof (SE_MirrorMeterReading_t, Reading), "</Reading>", 10), 0);
+  }
+  if (xml_scan_start (s, "<ReadingType", 12)) {
+    *(uint32_t *)b |= 1 << 6;
+    ok_v (xml_parse_ReadingType (p, s, b + offsetof (SE_MirrorMeterReading_t, ReadingType), "</ReadingType>", 14), 0);
+  }
+  return xml_scan_end (s, end, length);
+}
+
+int xml_output_MirrorReadingSet (Output *o, char *b) {
+  List *l;
+  if (*(char **)(b + offsetof (SE_MirrorReadingSet_t, href))) {
+    ok_v (xml_put (o, " href=\"", 7)
+	  && output_escaped (o, *(char **)(b + offsetof (SE_MirrorReadingSet_t, href)))
+	  && xml_put (o, "\"", 1), 0);
+  }
+  ok_v (xml_put_tag (o, "<mRID>", 6)
+    && output_hex (o, (uint8_t *)(b + offsetof (SE_MirrorReadingSet_t, mRID)), 16)
+    && xml_put (o, "</mRID>", 7), 0);
+  if (*(uint32_t *)b >> 0 & 1) {
+    ok_v (xml_put_tag (o, "<description>", 13)
+      && output_escaped (o, b + offsetof (SE_MirrorReadingSet_t, description))
+      && xml_put (o, "</description>", 14), 0);
+  }
+  if (*(uint32_t *)b >> 2 & 1) {
+    ok_v (xml_put_tag (o, "<version>", 9)
+      && xml_put_uint (o, *(uint16_t *)(b + offsetof (SE_MirrorReadingSet_t, version)))
+      && xml_put (o, "</version>", 10), 0);
+  }
+  ok_v (xml_put_start (o, "<timePeriod", 11)
+    && xml_output_DateTimeInterval (o, b + offsetof (SE_MirrorReadingSet_t, timePeriod))
+    && xml_put_end (o, "</timePeriod>", 13), 0);
+  for (l = *(List **)(b + offsetof (SE_MirrorReadingSet_t, Reading)); l; l = l->next)
+    ok_v (xml_put_start (o, "<Reading", 8)
+      && xml_output_Reading (o, l->data)
+      && xml_put_end (o, "</Reading>", 10), 0);
+  return 1;
+}
+
+int xml_parse_MirrorReadingSet (Parser *p, char **s, char *b,
+		const char *end, int length) {
+  ScanTag tag; char text[SCAN_TEXT], *v; int n; List *l, **tail;
+  ok_v (xml_scan_tag (s, &tag), 0);
+  if ((v = xml_scan_attr (&tag, "href", 4))) {
+    ok_v (xml_uri (p, v, (char **)(b + offsetof (SE_MirrorReadingSet_t, href))), 0);
+  }
+  if (tag.empty) return 0;
+  if (xml_scan_start (s, "<mRID", 5)) {
+    ok_v (xml_scan_text (s, text)
+      && parse_hex ((uint8_t *)(b + offsetof (SE_MirrorReadingSet_t, mRID)), 16, text)
+      && xml_scan_end (s, "</mRID>", 7), 0);
+  }
+  if (xml_scan_start (s, "<description", 12)) {
+    *(uint32_t *)b |= 1 << 0;
+    ok_v (xml_scan_text (s, text)
+      && xml_string (text, b + offsetof (SE_MirrorReadingSet_t, description), 32)
+      && xml_scan_end (s, "</description>", 14), 0);
+  }
+  if (xml_scan_start (s, "<version", 8)) {
+    *(uint32_t *)b |= 1 << 2;
+    ok_v (xml_scan_text (s, text)
+      && xml_ushort (text, (uint16_t *)(b + offsetof (SE_MirrorReadingSet_t, version)))
+      && xml_scan_end (s, "</version>", 10), 0);
+  }
+  if (xml_scan_start (s, "<timePeriod", 11)) {
+    ok_v (xml_parse_DateTimeInterval (p, s, b + offsetof (SE_MirrorReadingSet_t, timePeriod), "</timePeriod>", 13), 0);
+  }
+  tail = (List **)(b + offsetof (SE_MirrorReadingSet_t, Reading));
+  for (n = 0; xml_scan_start (s, "<Reading", 8); n++) {
+    l = *tail = parse_alloc (p, sizeof (List));
+    l->data = parse_alloc (p, sizeof (SE_Reading_t)); tail = &l->next;
+    ok_v (xml_parse_Reading (p, s, l->data, "</Reading>", 10), 0);
+  }
+  return xml_scan_end (s, end, length);
+}
+
+int xml_output_Reading (Output *o, char *b) {
+  if (*(char **)(b + offsetof (SE_Reading_t, href))) {
+    ok_v (xml_put (o, " href=\"", 7)
+	  && output_escaped (o, *(char **)(b + offsetof (SE_Reading_t, href)))
+	  && xml_put (o, "\"", 1), 0);
+  }
+  if (*(uint32_t *)b >> 1 & 1) {
+    ok_v (xml_put (o, " subscribable=\"", 15)
+	  && xml_put_uint (o, *(uint8_t *)(b + offsetof (SE_Reading_t, subscribable)))
+	  && xml_put (o, "\"", 1), 0);
+  }
+  if (*(uint32_t *)b >> 2 & 1) {
+    ok_v (xml_put_tag (o, "<consumptionBlock>", 18)
+      && xml_put_uint (o, *(uint8_t *)(b + offsetof (SE_Reading_t, consumptionBlock)))
+      && xml_put (o, "</consumptionBlock>", 19), 0);
+  }
+  if (*(uint32_t *)b >> 3 & 1) {
+    ok_v (xml_put_tag (o, "<qualityFlags>", 14)
+      && output_hex (o, (uint8_t *)(b + offsetof (SE_Reading_t, qualityFlags)), 2)
+      && xml_put (o, "</qualityFlags>", 15), 0);
+  }
+  if (*(uint32_t *)b >> 4 & 1) {
+    ok_v (xml_put_start (o, "<timePeriod", 11)
+      && xml_output_DateTimeInterval (o, b + offsetof (SE_Reading_t, timePeriod))
+      && xml_put_end (o, "</timePeriod>", 13), 0);
+  }
+  if (*(uint32_t *)b >> 5 & 1) {
+    ok_v (xml_put_tag (o, "<touTier>", 9)
+      && xml_put_uint (o, *(uint8_t *)(b + offsetof (SE_Reading_t, touTier)))
+      && xml_put (o, "</touTier>", 10), 0);
+  }
+  if (*(uint32_t *)b >> 6 & 1) {
+    ok_v (xml_put_tag (o, "<value>", 7)
+      && xml_put_int (o, *(int64_t *)(b + offsetof (SE_Reading_t, value)))
+      && xml_put (o, "</value>", 8), 0);
+  }
+  if (*(uint32_t *)b >> 7 & 1) {
+    ok_v (xml_put_tag (o, "<localID>", 9)
+      && output_hex (o, (uint8_t *)(b + offsetof (SE_Reading_t, localID)), 2)
+      && xml_put (o, "</localID>", 10), 0);
+  }
+  return 1;
+}
+
+int xml_parse_Reading (Parser *p, char **s, char *b,
+		const char *end, int length) {
+  ScanTag tag; char text[SCAN_TEXT], *v;
+  ok_v (xml_scan_tag (s, &tag), 0);
+  if ((v = xml_scan_attr (&tag, "href", 4))) {
+    ok_v (xml_uri (p, v, (char **)(b + offsetof (SE_Reading_t, href))), 0);
+  }
+  if ((v = xml_scan_attr (&tag, "subscribable", 12))) {
+    *(uint32_t *)b |= 1 << 1;
+    ok_v (xml_ubyte (v, (uint8_t *)(b + offsetof (SE_Reading_t, subscribable))), 0);
+  }
+  if (tag.empty) return 1;
+  if (xml_scan_start (s, "<consumptionBlock", 17)) {
+    *(uint32_t *)b |= 1 << 2;
+    ok_v (xml_scan_text (s, text)
+      && xml_ubyte (text, (uint8_t *)(b + offsetof (SE_Reading_t, consumptionBlock)))
+      && xml_scan_end (s, "</consumptionBlock>", 19), 0);
+  }
+  if (xml_scan_start (s, "<qualityFlags", 13)) {
+    *(uint32_t *)b |= 1 << 3;
+    ok_v (xml_scan_text (s, text)
+      && parse_hex ((uint8_t *)(b + offsetof (SE_Reading_t, qualityFlags)), 2, text)
+      && xml_scan_end (s, "</qualityFlags>", 15), 0);
+  }
+  if (xml_scan_start (s, "<timePeriod", 11)) {
+    *(uint32_t *)b |= 1 << 4;
+    ok_v (xml_parse_DateTimeInterval (p, s, b + offsetof (SE_Reading_t, timePeriod), "</timePeriod>", 13), 0);
+  }
+  if (xml_scan_start (s, "<touTier", 8)) {
+    *(uint32_t *)b |= 1 << 5;
+    ok_v (xml_scan_text (s, text)
+      && xml_ubyte (text, (uint8_t *)(b + offsetof (SE_Reading_t, touTier)))
+      && xml_scan_end (s, "</touTier>", 10), 0);
+  }
+  if (xml_scan_start (s, "<value", 6)) {
+    *(uint32_t *)b |= 1 << 6;
+    ok_v (xml_scan_text (s, text)
+      && xml_long (text, (int64_t *)(b + offsetof (SE_Reading_t, value)))
+      && xml_scan_end (s, "</value>", 8), 0);
+  }
+  if (xml_scan_start (s, "<localID", 8)) {
+    *(uint32_t *)b |= 1 << 7;
+    ok_v (xml_scan_text (s, text)
+      && parse_hex ((uint8_t *)(b + offsetof (SE_Reading_t, localID)), 2, text)
+      && xml_scan_end (s, "</localID>", 10), 0);
+  }
+  return xml_scan_end (s, end, length);
+}
+
+int xml_output_ReadingType (Output *o, char *b) {
+  if (*(char **)(b + offsetof (SE_ReadingType_t, href))) {
+    ok_v (xml_put (o, " href=\"", 7)
+	  && output_escaped (o, *(char **)(b + offsetof (SE_ReadingType_t, href)))
+	  && xml_put (o, "\"", 1), 0);
+  }
+  if (*(uint32_t *)b >> 0 & 1) {
+    ok_v (xml_put_tag (o, "<accumulationBehaviour>", 23)
+      && xml_put_uint (o, *(uint8_t *)(b + offsetof (SE_ReadingType_t, accumulationBehaviour)))
+      && xml_put (o, "</accumulationBehaviour>", 24), 0);
+  }
+  if (*(uint32_t *)b >> 1 & 1) {
+    ok_v (xml_put_start (o, "<calorificValue", 15)
+      && xml_output_UnitValueType (o, b + offsetof (SE_ReadingType_t, calorificValue))
+      && xml_put_end (o, "</calorificValue>", 17), 0);
+  }
+  if (*(uint32_t *)b >> 2 & 1) {
+    ok_v (xml_put_tag (o, "<commodity>", 11)
+      && xml_put_uint (o, *(uint8_t *)(b + offsetof (SE_ReadingType_t, commodity)))
+      && xml_put (o, "</commodity>", 12), 0);
+  }
+  if (*(uint32_t *)b >> 3 & 1) {
+    ok_v (xml_put_start (o, "<conversionFactor", 17)
+      && xml_output_UnitValueType (o, b + offsetof (SE_ReadingType_t, conversionFactor))
+      && xml_put_end (o, "</conversionFactor>", 19), 0);
+  }
+  if (*(uint32_t *)b >> 4 & 1) {
+    ok_v (xml_put_tag (o, "<dataQualifier>", 15)
+      && xml_put_uint (o, *(uint8_t *)(b + offsetof (SE_ReadingType_t, dataQualifier)))
+      && xml_put (o, "</dataQualifier>", 16), 0);
+  }
+  if (*(uint32_t *)b >> 5 & 1) {
+    ok_v (xml_put_tag (o, "<flowDirection>", 15)
+      && xml_put_uint (o, *(uint8_t *)(b + offsetof (SE_ReadingType_t, flowDirection)))
+      && xml_put (o, "</flowDirection>", 16), 0);
+  }
+  if (*(uint32_t *)b >> 6 & 1) {
+    ok_v (xml_put_tag (o, "<intervalLength>", 16)
+      && xml_put_uint (o, *(uint32_t *)(b + offsetof (SE_ReadingType_t, intervalLength)))
+      && xml_put (o, "</intervalLength>", 17), 0);
+  }
+  if (*(uint32_t *)b >> 17 & 1) {
+    ok_v (xml_put_tag (o, "<kind>", 6)
+      && xml_put_uint (o, *(uint8_t *)(b + offsetof (SE_ReadingType_t, kind)))
+      && xml_put (o, "</kind>", 7), 0);
+  }
+  if (*(uint32_t *)b >> 7 & 1) {
+    ok_v (xml_put_tag (o, "<maxNumberOfIntervals>", 22)
+      && xml_put_uint (o, *(uint8_t *)(b + offsetof (SE_ReadingType_t, maxNumberOfIntervals)))
+      && xml_put (o, "</maxNumberOfIntervals>", 23), 0);
+  }
+  if (*(uint32_t *)b >> 8 & 1) {
+    ok_v (xml_put_tag (o, "<numberOfConsumptionBlocks>", 27)
+      && xml_put_uint (o, *(uint8_t *)(b + offsetof (SE_ReadingType_t, numberOfConsumptionBlocks)))
+      && xml_put (o, "</numberOfConsumptionBlocks>", 28), 0);
+  }
+  if (*(uint32_t *)b >> 9 & 1) {
+    ok_v (xml_put_tag (o, "<numberOfTouTiers>", 18)
+      && xml_put_uint (o, *(uint8_t *)(b + offsetof (SE_ReadingType_t, numberOfTouTiers)))
+      && xml_put (o, "</numberOfTouTiers>", 19), 0);
+  }
+  if (*(uint32_t *)b >> 10 & 1) {
+    ok_v (xml_put_tag (o, "<phase>", 7)
+      && xml_put_uint (o, *(uint8_t *)(b + offsetof (SE_ReadingType_t, phase)))
+      && xml_put (o, "</phase>", 8), 0);
+  }
+  if (*(uint32_t *)b >> 11 & 1) {
+    ok_v (xml_put_tag (o, "<powerOfTenMultiplier>", 22)
+      && xml_put_int (o, *(int8_t *)(b + offsetof (SE_ReadingType_t, powerOfTenMultiplier)))
+      && xml_put (o, "</powerOfTenMultiplier>", 23), 0);
+  }
+  if (*(uint32_t *)b >> 12 & 1) {
+    ok_v (xml_put_tag (o, "<subIntervalLength>", 19)
+      && xml_put_uint (o, *(uint32_t *)(b + offsetof (SE_ReadingType_t, subIntervalLength)))
+      && xml_put (o, "</subIntervalLength>", 20), 0);
+  }
+  if (*(uint32_t *)b >> 13 & 1) {
+    ok_v (xml_put_tag (o, "<supplyLimit>", 13)
+      && xml_put_uint (o, *(uint64_t *)(b + offsetof (SE_ReadingType_t, supplyLimit)))
+      && xml_put (o, "</supplyLimit>", 14), 0);
+  }
+  if (*(uint32_t *)b >> 14 & 1) {
+    ok_v (xml_put_tag (o, "<tieredConsumptionBlocks>", 25)
+      && xml_put_bool (o, *(uint32_t *)b >> (14) & 1)
+      && xml_put (o, "</tieredConsumptionBlocks>", 26), 0);
+  }
+  if (*(uint32_t *)b >> 16 & 1) {
+    ok_v (xml_put_tag (o, "<uom>", 5)
+      && xml_put_uint (o, *(uint8_t *)(b + offsetof (SE_ReadingType_t, uom)))
+      && xml_put (o, "</uom>", 6), 0);
+  }
+  return 1;
+}
+
+int xml_parse_ReadingType (Parser *p, char **s, char *b,
+		const char *end, int length) {
+  ScanTag tag; char text[SCAN_TEXT], *v;
+  ok_v (xml_scan_tag (s, &tag), 0);
+  if ((v = xml_scan_attr (&tag, "href", 4))) {
+    ok_v (xml_uri (p, v, (char **)(b + offsetof (SE_ReadingType_t, href))), 0);
+  }
+  if (tag.empty) return 1;
+  if (xml_scan_start (s, "<accumulationBehaviour", 22)) {
+    *(uint32_t *)b |= 1 << 0;
+    ok_v (xml_scan_text (s, text)
+      && xml_ubyte (text, (uint8_t *)(b + offsetof (SE_ReadingType_t, accumulationBehaviour)))
+      && xml_scan_end (s, "</accumulationBehaviour>", 24), 0);
+  }
+  if (xml_scan_start (s, "<calorificValue", 15)) {
+    *(uint32_t *)b |= 1 << 1;
+    ok_v (xml_parse_UnitValueType (p, s, b + offsetof (SE_ReadingType_t, calorificValue), "</calorificValue>", 17), 0);
+  }
+  if (xml_scan_start (s, "<commodity", 10)) {
+    *(uint32_t *)b |= 1 << 2;
+    ok_v (xml_scan_text (s, text)
+      && xml_ubyte (text, (uint8_t *)(b + offsetof (SE_ReadingType_t, commodity)))
+      && xml_scan_end (s, "</commodity>", 12), 0);
+  }
+  if (xml_scan_start (s, "<conversionFactor", 17)) {
+    *(uint32_t *)b |= 1 << 3;
+    ok_v (xml_parse_UnitValueType (p, s, b + offsetof (SE_ReadingType_t, conversionFactor), "</conversionFactor>", 19), 0);
+  }
+  if (xml_scan_start (s, "<dataQualifier", 14)) {
+    *(uint32_t *)b |= 1 << 4;
+    ok_v (xml_scan_text (s, text)
+      && xml_ubyte (text, (uint8_t *)(b + offsetof (SE_ReadingType_t, dataQualifier)))
+      && xml_scan_end (s, "</dataQualifier>", 16), 0);
+  }
+  if (xml_scan_start (s, "<flowDirection", 14)) {
+    *(uint32_t *)b |= 1 << 5;
+    ok_v (xml_scan_text (s, text)
+      && xml_ubyte (text, (uint8_t *)(b + offsetof (SE_ReadingType_t, flowDirection)))
+      && xml_scan_end (s, "</flowDirection>", 16), 0);
+  }
+  if (xml_scan_start (s, "<intervalLength", 15)) {
+    *(uint32_t *)b |= 1 << 6;
+    ok_v (xml_scan_text (s, text)
+      && xml_uint (text, (uint32_t *)(b + offsetof (SE_ReadingType_t, intervalLength)))
+      && xml_scan_end (s, "</intervalLength>", 17), 0);
+  }
+  if (xml_scan_start (s, "<kind", 5)) {
+    *(uint32_t *)b |= 1 << 17;
+    ok_v (xml_scan_text (s, text)
+      && xml_ubyte (text, (uint8_t *)(b + offsetof (SE_ReadingType_t, kind)))
+      && xml_scan_end (s, "</kind>", 7), 0);
+  }
+  if (xml_scan_start (s, "<maxNumberOfIntervals", 21)) {
+    *(uint32_t *)b |= 1 << 7;
+    ok_v (xml_scan_text (s, text)
+      && xml_ubyte (text, (uint8_t *)(b + offsetof (SE_ReadingType_t, maxNumberOfIntervals)))
+      && xml_scan_end (s, "</maxNumberOfIntervals>", 23), 0);
+  }
+  if (xml_scan_start (s, "<numberOfConsumptionBlocks", 26)) {
+    *(uint32_t *)b |= 1 << 8;
+    ok_v (xml_scan_text (s, text)
+      && xml_ubyte (text, (uint8_t *)(b + offsetof (SE_ReadingType_t, numberOfConsumptionBlocks)))
+      && xml_scan_end (s, "</numberOfConsumptionBlocks>", 28), 0);
+  }
+  if (xml_scan_start (s, "<numberOfTouTiers", 17)) {
+    *(uint32_t *)b |= 1 << 9;
+    ok_v (xml_scan_text (s, text)
+      && xml_ubyte (text, (uint8_t *)(b + offsetof (SE_ReadingType_t, numberOfTouTiers)))
+      && xml_scan_end (s, "</numberOfTouTiers>", 19), 0);
+  }
+  if (xml_scan_start (s, "<phase", 6)) {
+    *(uint32_t *)b |= 1 << 10;
+    ok_v (xml_scan_text (s, text)
+      && xml_ubyte (text, (uint8_t *)(b + offsetof (SE_ReadingType_t, phase)))
+      && xml_scan_end (s, "</phase>", 8), 0);
+  }
+  if (xml_scan_start (s, "<powerOfTenMultiplier", 21)) {
+    *(uint32_t *)b |= 1 << 11;
+    ok_v (xml_scan_text (s, text)
+      && xml_byte (text, (int8_t *)(b + offsetof (SE_ReadingType_t, powerOfTenMultiplier)))
+      && xml_scan_end (s, "</powerOfTenMultiplier>", 23), 0);
+  }
+  if (xml_scan_start (s, "<subIntervalLength", 18)) {
+    *(uint32_t *)b |= 1 << 12;
+    ok_v (xml_scan_text (s, text)
+      && xml_uint (text, (uint32_t *)(b + offsetof (SE_ReadingType_t, subIntervalLength)))
+      && xml_scan_end (s, "</subIntervalLength>", 20), 0);
+  }
+  if (xml_scan_start (s, "<supplyLimit", 12)) {
+    *(uint32_t *)b |= 1 << 13;
+    ok_v (xml_scan_text (s, text)
+      && xml_ulong (text, (uint64_t *)(b + offsetof (SE_ReadingType_t, supplyLimit)))
+      && xml_scan_end (s, "</supplyLimit>", 14), 0);
+  }
+  if (xml_scan_start (s, "<tieredConsumptionBlocks", 24)) {
+    *(uint32_t *)b |= 1 << 14;
+    ok_v (xml_scan_text (s, text)
+      && xml_bool (text, b, 15)
+      && xml_scan_end (s, "</tieredConsumptionBlocks>", 26), 0);
+  }
+  if (xml_scan_start (s, "<uom", 4)) {
+    *(uint32_t *)b |= 1 << 16;
+    ok_v (xml_scan_text (s, text)
+      && xml_ubyte (text, (uint8_t *)(b + offsetof (SE_ReadingType_t, uom)))
+      && xml_scan_end (s, "</uom>", 6), 0);
+  }
+  return xml_scan_end (s, end, length);
+}
+
+int xml_output_UnitValueType (Output *o, char *b) {
+  ok_v (xml_put_tag (o, "<multiplier>", 12)
+    && xml_put_int (o, *(int8_t *)(b + offsetof (SE_UnitValueType_t, multiplier)))
+    && xml_put (o, "</multiplier>", 13), 0);
+  ok_v (xml_put_tag (o, "<unit>", 6)
+    && xml_put_uint (o, *(uint8_t *)(b + offsetof (SE_UnitValueType_t, unit)))
+    && xml_put (o, "</unit>", 7), 0);
+  ok_v (xml_put_tag (o, "<value>", 7)
+    && xml_put_int (o, *(int32_t *)(b + offsetof (SE_UnitValueType_t, value)))
+    && xml_put (o, "</value>", 8), 0);
+  return 1;
+}
+
+int xml_parse_UnitValueType (Parser *p, char **s, char *b,
+		const char *end, int length) {
+  ScanTag tag; char text[SCAN_TEXT];
+  ok_v (xml_scan_tag (s, &tag), 0);
+  if (tag.empty) return 0;
+  if (xml_scan_start (s, "<multiplier", 11)) {
+    ok_v (xml_scan_text (s, text)
+      && xml_byte (text, (int8_t *)(b + offsetof (SE_UnitValueType_t, multiplier)))
+      && xml_scan_end (s, "</multiplier>", 13), 0);
+  }
+  if (xml_scan_start (s, "<unit", 5)) {
+    ok_v (xml_scan_text (s, text)
+      && xml_ubyte (text, (uint8_t *)(b + offsetof (SE_UnitValueType_t, unit)))
+      && xml_scan_end (s, "</unit>", 7), 0);
+  }
+  if (xml_scan_start (s, "<value", 6)) {
+    ok_v (xml_scan_text (s, text)
+      && xml_int (text, (int32_t *)(b + offsetof (SE_UnitValueType_t, value)))
+      && xml_scan_end (s, "</value>", 8), 0);
+  }
+  return xml_scan_end (s, end, length);
+}
+
+int se_xml_root (char **s) {
+  if (xml_scan_start (s, "<DERControl", 11)) return SE_DERControl;
+  if (xml_scan_start (s, "<DERControlList", 15)) return SE_DERControlList;
+  if (xml_scan_start (s, "<EndDevice", 10)) return SE_EndDevice;
+  if (xml_scan_start (s, "<Response", 9)) return SE_Response;
+  if (xml_scan_start (s, "<MirrorMeterReading", 19)) return SE_MirrorMeterReading;
+  return -1;
+}
+
+int se_parse_xml (Parser *p, char **s, void *obj, int type) {
+  switch (type) {
+  case SE_DERControl:
+    return xml_parse_DERControl (p, s, obj, "</DERControl>", 13);
+  case SE_DERControlList:
+    return xml_parse_DERControlList (p, s, obj, "</DERControlList>", 17);
+  case SE_EndDevice:
+    return xml_parse_EndDevice (p, s, obj, "</EndDevice>", 12);
+  case SE_Response:
+    return xml_parse_Response (p, s, obj, "</Response>", 11);
+  case SE_MirrorMeterReading:
+    return xml_parse_MirrorMeterReading (p, s, obj, "</MirrorMeterReading>", 21);
+  } return 0;
+}
+
+int se_output_xml (Output *o, void *obj, int type) {
+  switch (type) {
+  case SE_DERControl:
+    return xml_put_start (o, "<DERControl", 11)
+      && xml_output_DERControl (o, obj)
+      && xml_put_end (o, "</DERControl>", 13);
+  case SE_DERControlList:
+    return xml_put_start (o, "<DERControlList", 15)
+      && xml_output_DERControlList (o, obj)
+      && xml_put_end (o, "</DERControlList>", 17);
+  case SE_EndDevice:
+    return xml_put_start (o, "<EndDevice", 10)
+      && xml_output_EndDevice (o, obj)
+      && xml_put_end (o, "</EndDevice>", 12);
+  case SE_Response:
+    return xml_put_start (o, "<Response", 9)
+      && xml_output_Response (o, obj)
+      && xml_put_end (o, "</Response>", 11);
+  case SE_MirrorMeterReading:
+    return xml_put_start (o, "<MirrorMeterReading", 19)
+      && xml_output_MirrorMeterReading (o, obj)
+      && xml_put_end (o, "</MirrorMeterReading>", 21);
+  } return 0;
+}
+
+const SchemaCodec se_codec = {se_xml_root, se_parse_xml, se_output_xml};
@@ -40,7 +40,8 @@ enum SeMediaType {SE_EXI, SE_XML, APPLICATION_XML};
 
     Use the conn parameter to send the object if the host address matches the 
     server specified in the the href parameter, otherwise attempt a new
-    connection and send the object on that connection. 
+    connection and send the object on that connection. The object is output
+    in segments of 4096 bytes which are written without copying.
     @param conn is a pointer to an SeConnection
     @param obj is a pointer to an IEEE 2030.5 object
     @param type is the schema type of the object
@@ -49,6 +50,81 @@ enum SeMediaType {SE_EXI, SE_XML, APPLICATION_XML};
 */
 void *se_send (void *conn, void *obj, int type, const char *href, int method);
 
+/** @brief Respond to a request with an IEEE 2030.5 object.
+
+    The object is output in the media type negotiated with the client (see
+    @ref se_content_type), in segments written without copying as with
+    @ref se_send.
+    @param conn is a pointer to an SeConnection
+    @param obj is a pointer to an IEEE 2030.5 object
+    @param type is the schema type of the object
+*/
+void se_reply (void *conn, void *obj, int type);
+
+/** @brief A cache of the serialized representations of an object.
+
+    Holds the XML and EXI output of an object served by @ref se_serve, each
+    produced on first use, and the entity tags of the representations. Call
+    @ref se_cache_clear whenever the object changes.
+*/
+typedef struct _SeCache SeCache;
+
+/** @brief Create an SeCache.
+    @returns a pointer to an empty SeCache
+*/
+SeCache *se_cache_new ();
+
+/** @brief Discard the representations of a changed object.
+    @param c is a pointer to an SeCache
+*/
+void se_cache_clear (SeCache *c);
+
+/** @brief Free an SeCache.
+    @param c is a pointer to an SeCache
+*/
+void se_cache_free (SeCache *c);
+
+/** @brief Respond to a GET or HEAD request with a cached representation.
+
+    A request with an If-None-Match header that matches the current entity
+    tag is answered with 304 (Not Modified), otherwise the representation in
+    the media type negotiated with the client is copied into a 200 response,
+    so the object is output with @ref output_doc once per change rather than
+    once per request.
+    @param conn is a pointer to an SeConnection
+    @param c is a pointer to the SeCache of the object
+    @param obj is a pointer to an IEEE 2030.5 object
+    @param type is the schema type of the object
+*/
+void se_serve (void *conn, SeCache *c, void *obj, int type);
+
+/** @brief Respond to a GET or HEAD request with the contents of a file.
+
+    The entity tag is derived from the modification time and size of the
+    file, a matching conditional request is answered with 304 (Not Modified).
+    The body is written with @ref http_send_file (read into memory for a TLS
+    connection).
+    @param conn is a pointer to an SeConnection
+    @param name is the name of the file
+    @param media is the Content-Type of the file
+    @returns 1 if the file was served, 0 if it could not be opened
+*/
+int se_serve_file (void *conn, const char *name, const char *media);
+
+/** @brief Stream an IEEE 2030.5 object to a server.
+
+    Like @ref se_send, except the document is output in chunks as the
+    connection is ready for more data (chunked transfer coding) so an object
+    of any size, such as a large list, is sent in constant memory. The object
+    must remain valid and unchanged until it has been completely sent.
+    @param conn is a pointer to an SeConnection
+    @param obj is a pointer to an IEEE 2030.5 object
+    @param type is the schema type of the object
+    @param href is a URI string, the location to send the object to
+    @param method is the HTTP method to use, either HTTP_POST or HTTP_PUT
+*/
+void *se_stream (void *conn, void *obj, int type, const char *href, int method);
+
 /** @brief Initialize a Response to an Event.
 
     @param resp is a pointer to an SE_Response_t object or dervied type.
@@ -80,7 +156,10 @@ const char *se_content_type (void *conn, int *type);
     If @ref se_receive returns an HTTP method or an HTTP response, this
     function returns the HTTP message body as an IEEE 2030.5 object if any
     were present or NULL to indicate the message body was empty. Caller is
-    responsible for freeing the object with @ref free_se_object.
+    responsible for freeing the object with @ref free_se_object, unless the
+    connection uses an arena (@ref se_arena) in which case the object remains
+    owned by the connection until @ref free_se_body is called or the next
+    message is received.
     @param conn is a pointer to an SeConnection
     @param type is a pointer to the returned type of IEEE 2030.5 object
     @returns an IEEE 2030.5 object present in the HTTP message body (if any),
@@ -94,6 +173,86 @@ void *se_body (void *conn, int *type);
 */ 
 void free_se_body (void *conn);
 
+/** @brief Parse the message bodies received on a connection into an arena.
+
+    The objects parsed from a message are allocated from a per connection
+    Arena and are all released at once when the message is done with. This
+    suits messages that are applied and then discarded, such as
+    notifications; any part of the object that is kept should be copied with
+    @ref copy_se_object.
+    @param conn is a pointer to an SeConnection
+    @param size is the initial size of the arena
+*/
+void se_arena (void *conn, int size);
+
+/** @brief Index rather than parse the items of XML List pages.
+
+    When set (the default) a List page received as a complete XML response
+    body is parsed without its items, so @ref se_body returns the List with
+    an empty item list. Each item is indexed by its position in a copy of the
+    body, along with its href and a digest of its text, so that only the items
+    that are new or have changed need to be parsed (see @ref se_lazy_list).
+    Pages not in the plain form expected are parsed in full.
+*/
+extern int se_lazy;
+
+/** @brief The smallest message body handed to the parse pool.
+
+    When parse workers are running (see @ref parse_pool_start), a complete
+    message body of at least this size that would otherwise be parsed in full
+    by @ref se_receive is parsed by a worker instead. The connection is held
+    meanwhile (se_receive returns SE_INCOMPLETE), then returned again as a
+    TCP_PORT event by @ref se_poll with the parsed message. The default is
+    4096 bytes.
+*/
+extern int se_offload_size;
+
+#ifdef HTTP_ZLIB
+
+/** @brief The smallest request body that is compressed.
+
+    A PUT or POST body of at least this size is sent with the gzip content
+    coding (see @ref http_compress), the server must accept the coding. The
+    default of 0 sends every body uncompressed.
+*/
+extern int se_compress_size;
+
+#endif
+
+/** @brief An item of a List page that has not been parsed. */
+typedef struct {
+  char *href; ///< is the href attribute of the item, NULL if none
+  char *text; ///< is the text of the item element
+  int length; ///< is the length of the text
+  uint64_t digest; ///< is a digest of the text
+} LazyItem;
+
+/** @brief The indexed items of a List page. */
+typedef struct {
+  char *text; ///< is a copy of the message body, NULL if not indexed
+  LazyItem *items; ///< is the array of items
+  int count; ///< is the number of items
+  int size; ///< is the size of the array
+} LazyList;
+
+/** @brief Return the indexed items of the List page received.
+
+    The items remain valid until @ref free_se_body is called or the next
+    message is received.
+    @param conn is a pointer to an SeConnection
+    @returns a pointer to a LazyList, or NULL if the body was parsed in full
+*/
+LazyList *se_lazy_list (void *conn);
+
+/** @brief Parse an indexed List item.
+
+    The item is parsed in place, so it can only be parsed once.
+    @param item is a pointer to a LazyItem
+    @param type is the schema type of the item
+    @returns the item object, or NULL if the item is invalid
+*/
+void *se_lazy_parse (LazyItem *item, int type);
+
 /** @brief Receive an IEEE 2030.5 message.
     @param conn is a pointer to a SeConnection
     @returns the HTTP method on success (see @ref http_receive)
@@ -107,8 +266,9 @@ int se_receive (void *conn);
 /** @brief Connect to an IEEE 2030.5 server.
 
     Only one connection is maintained per server address/port, so this function
-    first searches a list of existing connection for a matching Address, before
-    creating a new connection.
+    first looks up the connection pool for a matching Address, before
+    creating a new connection. A pooled connection that was closed is
+    reconnected.
     @param addr is a pointer to Address of the server
     @param secure is 1 for a encrypted TLS connection, 0 for an unencrypted
     TCP connection
@@ -116,6 +276,19 @@ int se_receive (void *conn);
 */
 void *se_connect (Address *addr, int secure);
 
+/** @brief Connect to an IEEE 2030.5 server with an IPv6 and an IPv4 address.
+
+    The same as @ref se_connect, with the connection pooled by the first
+    Address. The two addresses are raced whenever the server is (re)connected
+    (see @ref net_connect_any).
+    @param addr is a pointer to the IPv6 Address of the server
+    @param alt is a pointer to the IPv4 Address of the server
+    @param secure is 1 for a encrypted TLS connection, 0 for an unencrypted
+    TCP connection
+    @returns a pointer to an SeConnection
+*/
+void *se_connect_dual (Address *addr, Address *alt, int secure);
+
 /** @brief Connect to an IEEE 2030.5 server using a Uri parameter.
 
     The same as @ref se_connect, but uses a Uri as a parameter. The URI scheme
@@ -126,6 +299,28 @@ void *se_connect (Address *addr, int secure);
 */
 void *se_connect_uri (Uri *uri);
 
+/** @brief Resolve an href relative to a connection.
+
+    The href is parsed once, the path and the connection to the host (for an
+    absolute href) are cached by href, so resolving an href again involves no
+    URI parsing or connection lookup. If the href has a host then conn is set
+    to the (re)opened connection to the host, as with @ref se_connect_uri.
+    @param conn is a pointer to the connection the href was received from,
+    updated with the connection to the host of an absolute href
+    @param href is the href to resolve
+    @returns the path of the href, valid until the next call, or NULL if the
+    href is invalid
+*/
+char *se_resolve (void **conn, const char *href);
+
+/** @brief Return the path of an href (cached as with @ref se_resolve).
+    @param conn is a pointer to the connection the href was received from
+    @param href is the href
+    @returns the path of the href, valid until the next call, or NULL if the
+    href is invalid
+*/
+char *se_path (void *conn, const char *href);
+
 /** @brief Accept a connection request from an IEEE 2030.5 client.
     @param a is a pointer to an Acceptor
     @param secure is 1 for an encrypted TLS connection, 0 for an unencypted
@@ -134,9 +329,58 @@ void *se_connect_uri (Uri *uri);
 */
 void *se_accept (Acceptor *a, int secure);
 
+/** @brief Write the origin (scheme, host and port) of a connection.
+    @param buffer is a container for the origin, at least 64 bytes
+    @param conn is a pointer to an SeConnection
+    @returns the length of the origin
+*/
+int se_origin (char *buffer, void *conn);
+
 //void *find_conn (Address *addr);
 void *find_conn (int (*match) (void *, void *), void *ctx);
-void *get_conn (Address *addr);
+void *get_conn (Address *addr, int secure);
+
+/** @brief Index a client connection by the LFDI of the server.
+
+    Called once the server certificate has been verified and the LFDI stored
+    (see @ref se_lfdi).
+    @param conn is a pointer to an SeConnection
+*/
+void index_lfdi (void *conn);
+
+/** @brief Find a client connection by the LFDI of the server.
+
+    Used to match a notification received from a server with the client
+    connection to that server.
+    @param lfdi is the 20 byte LFDI of the server
+    @returns a pointer to an SeConnection, NULL if there is no match
+*/
+void *find_notifier (uint8_t *lfdi);
+
+/** @brief Reconnect a client connection if it was closed.
+    @param conn is a pointer to an SeConnection
+    @returns the value of conn
+*/
+void *se_reopen (void *conn);
+
+/** @brief Keep a client connection open for a time.
+
+    A connection that will be used soon (e.g. to poll a resource) is evicted
+    from the pool of idle connections before then only when every idle
+    connection is kept and the pool is still beyond the maximum.
+    @param conn is a pointer to an SeConnection
+    @param secs is the time in seconds until the connection is next used
+*/
+void se_keep_alive (void *conn, int64_t secs);
+
+/** @brief The maximum number of idle client connections.
+
+    A client connection is idle when it has no requests awaiting a response.
+    Beyond the maximum, the least recently used idle connections are closed
+    (and reconnected by @ref se_reopen when next used). The default of 0
+    places no limit on the number of idle connections.
+*/
+extern int se_max_idle;
 
 /** @} */
 
@@ -144,12 +388,22 @@ void *get_conn (Address *addr);
 
 typedef struct _SeConnection {
   HttpConnection http;
-  Address host;
+  Address host, alt; // alt is the other address of a dual stack server
   Parser parser;
+  Arena *arena;
+  LazyList lazy;
   int state, media;
   uint8_t lfdi[20];
   uint64_t sfdi;
   struct _SeConnection *next;
+  struct _SeConnection *next_host, *next_lfdi; // pool hash chains
+  struct _SeConnection *older, *newer; // idle connections (LRU order)
+  unsigned secure : 1, indexed : 1, idle : 1;
+  unsigned started : 1; // data was given to the parser
+  unsigned dual : 1; // connect to either host or alt
+  ParseJob *job; // message body handed to the parse pool
+  int bucket; // LFDI hash bucket
+  int64_t keep; // keep alive until (system time)
 } SeConnection;
 
 const char * const se_ranges[] = {
@@ -193,7 +447,7 @@ int se_parse_init (void *conn) {
   case SE_XML: case APPLICATION_XML:
     parse_init (p, &se_schema, NULL); break;
   default: return 0;
-  } return 1;
+  } parser_arena (p, c->arena); return 1;
 }
 
 uint64_t *se_sfdi (void *conn) {
@@ -204,56 +458,212 @@ uint8_t *se_lfdi (void *conn) {
   SeConnection *s = conn; return s->lfdi;
 }
 
+void lazy_clear (LazyList *l);
+
 void free_se_body (void *conn) {
   SeConnection *s = conn;
-  if (s->parser.obj) {
+  if (s->arena) arena_reset (s->arena);
+  else if (s->parser.obj)
     free_se_object (s->parser.obj, s->parser.type);
-    s->parser.obj = NULL;
-  }
+  s->parser.obj = NULL; lazy_clear (&s->lazy);
 }
 
 void *se_body (void *conn, int *type) {
   SeConnection *s = conn; void *body;
   if (body = s->parser.obj) { 
     *type = s->parser.type;
-    s->parser.obj = NULL;
+    if (!s->arena) s->parser.obj = NULL;
   } return body; 
 }
 
+void se_arena (void *conn, int size) {
+  SeConnection *s = conn;
+  if (!s->arena) s->arena = arena_new (size);
+}
+
+int se_lazy = 1;
+
+void lazy_clear (LazyList *l) {
+  free (l->text); l->text = NULL; l->count = 0;
+}
+
+LazyList *se_lazy_list (void *conn) {
+  SeConnection *s = conn;
+  return s->lazy.text? &s->lazy : NULL;
+}
+
+uint64_t lazy_digest (const char *s, int n) {
+  uint64_t h = 14695981039346656037ull;
+  while (n--) h = (h ^ (uint8_t)*s++) * 1099511628211ull;
+  return h;
+}
+
+int lazy_tag (char *data, const char *tag, int n) {
+  return !strncmp (data, tag, n) && !scan_name_char (data[n]);
+}
+
+// index the item at data ("<name", n characters), return the end of the item
+char *lazy_item (LazyList *l, char *data, int n, char **hrefs) {
+  ScanTag tag; char *end = data+n, *href; LazyItem *item;
+  if (!xml_scan_tag (&end, &tag)) return NULL;
+  if (!tag.empty) ok (end = xml_skip_element (data));
+  if (l->count == l->size) {
+    l->size = l->size? l->size*2 : 16;
+    l->items = realloc (l->items, sizeof (LazyItem) * l->size);
+  } item = &l->items[l->count++];
+  if ((href = xml_scan_attr (&tag, "href", 4))) {
+    item->href = strcpy (*hrefs, href); *hrefs += strlen (href)+1;
+  } else item->href = NULL;
+  item->text = data; item->length = end - data;
+  item->digest = lazy_digest (data, item->length);
+  return end;
+}
+
+/* Parse a List page without its items, the items are indexed. Returns NULL
+   if the page is not in the plain form expected, a List element with its
+   items at the end. */
+void *se_lazy_body (SeConnection *s, char *data, int length, int *type) {
+  Parser *p = &s->parser; LazyList *l = &s->lazy; ListInfo *info;
+  char name[64], tag[66], *b, *d, *first, *last, *hrefs, *shell;
+  ScanTag root; void *obj; int t, n, decl;
+  // the copy of the body is followed by space for the hrefs and the List
+  b = l->text = malloc (length*3+3); hrefs = b+length+1; shell = hrefs+length+1;
+  memcpy (b, data, length); b[length] = '\0';
+  if (!(d = xml_scan_decl (p, b, &decl)) || *d++ != '<') goto fail;
+  for (n = 0; n < 63 && scan_name_char (d[n]); n++) name[n] = d[n];
+  name[n] = '\0'; d += n;
+  if ((t = element_index (&se_schema, name)) < 0
+      || !(info = find_list_info (t))
+      || !xml_scan_tag (&d, &root) || root.empty) goto fail;
+  n = sprintf (tag, "<%s", se_schema.elements[info->type]);
+  for (d = skip_ws (d); *d == '<' && d[1] != '/' && !lazy_tag (d, tag, n);
+       d = skip_ws (d))
+    if (!(d = xml_skip_element (d))) goto fail;
+  for (first = last = d; lazy_tag (d, tag, n); d = skip_ws (last))
+    if (!(last = lazy_item (l, d, n, &hrefs))) goto fail;
+  if (!l->count || d[0] != '<' || d[1] != '/') goto fail;
+  n = first - b; memcpy (shell, b, n); strcpy (shell+n, last);
+  parser_rebuffer (p, shell, n + length - (last - b));
+  if (obj = parse_doc (p, type)) return obj;
+  se_parse_init (s);
+ fail:
+  lazy_clear (l); return NULL;
+}
+
+void *se_lazy_parse (LazyItem *item, int type) {
+  Parser p; void *obj; int t;
+  p.xml = NULL; parse_init (&p, &se_schema, item->text);
+  if ((obj = parse_doc (&p, &t)) && t != type) {
+    free_se_object (obj, t); obj = NULL;
+  } free (p.xml); return obj;
+}
+
 #define SE_START 0
 #define SE_DATA 1
+#define SE_PARSING 2
+#define SE_PARSED 3
+
+void se_idle (SeConnection *c);
+
+int se_offload_size = 4096;
+#ifdef HTTP_ZLIB
+int se_compress_size = 0;
+#endif
+
+// hand a complete message body to the parse pool
+int se_offload (SeConnection *s, char *data, int length) {
+  Parser *p = &s->parser; ParseJob *job;
+  if (!parse_pool_size () || s->started || length < se_offload_size)
+    return 0;
+  job = type_alloc (ParseJob);
+  job->context = s; job->schema = p->schema; job->arena = s->arena;
+  job->exi = p->driver == &exi_parser;
+  job->data = malloc (length+1); job->length = length;
+  memcpy (job->data, data, length); job->data[length] = '\0';
+  parse_submit (job); s->job = job;
+  s->state = SE_PARSING; net_hold (s); return 1;
+}
+
+void free_parse_job (ParseJob *job) {
+  if (job->obj && !job->arena) free_se_object (job->obj, job->type);
+  free (job);
+}
+
+void se_parsed () { ParseJob *job; SeConnection *s;
+  while (job = parse_pool_done ()) {
+    if (s = job->context) {
+      s->state = SE_PARSED; net_resume (s);
+    } else if (job->arena) { // abandoned, the job owns the arena
+      arena_free (job->arena); free (job);
+    } else free_parse_job (job);
+  }
+}
+
+/* Discard a message body that is still in the parse pool. A worker may
+   still be parsing into the connection's arena, so the arena is handed to
+   the job (freed when the job is done) and the connection gets a new one. */
+void se_abandon (SeConnection *s) {
+  if (!s->job) return;
+  if (s->state == SE_PARSED) free_parse_job (s->job);
+  else {
+    s->job->context = NULL;
+    if (s->arena) s->arena = arena_new (s->arena->total);
+  } s->job = NULL; s->state = SE_START;
+}
 
 // return HTTP method, SE_ERROR, or SE_INCOMPLETE 
 int se_receive (void *conn) {
   SeConnection *s = conn;
   HttpConnection *h = conn;
   Parser *p = &s->parser;
-  char *data;
-  int length, type, code, method;
+  char *data; void *obj;
+  int length, type, code, method; int64_t t; ParseJob *job;
   http_flush (h);
-  switch (method = http_receive (h)) {
+  switch (s->state) {
+  case SE_PARSING: net_hold (s); return SE_INCOMPLETE;
+  case SE_PARSED: job = s->job; s->job = NULL; s->state = SE_START;
+    p->obj = job->obj; p->type = job->type; free (job);
+    if (!p->obj) { code = 400; goto error; }
+    se_idle (s); return h->method;
+  }
+  t = stat_begin (); method = http_receive (h);
+  stat_end (STAT_HTTP_RECEIVE, t);
+  switch (method) {
   case HTTP_NONE: break;
   case HTTP_ERROR: return SE_ERROR;
   default:
     switch (s->state) {
-    case SE_START: p->obj = NULL;
-      print_http_status (h);
+    case SE_START:
+      if (s->arena) arena_reset (s->arena);
+      p->obj = NULL; lazy_clear (&s->lazy); s->started = 0;
+      log_debug ("%s %s: %d\n", http_methods[h->request_method],
+		 h->uri.path, h->status);
       if (h->media_range)
 	s->media = select_media (h->media_range);
       if (h->body) {
 	if (se_parse_init (s)) s->state++;
 	else { code = 415; goto error; }
-      } else return method;
+      } else { se_idle (s); return method; }
     case SE_DATA:
       while (data = http_data (h, &length)) {
-	parser_rebuffer (p, data, length);
-	if (parse_doc (p, &type)) {
-	  s->state = SE_START; return method;
+	t = stat_begin ();
+	if (!se_lazy || h->method != HTTP_RESPONSE || p->driver != &xml_parser
+	    || !http_complete (h) || !p->need_token || p->xml->state
+	    || !(obj = se_lazy_body (s, data, length, &type))) {
+	  if (http_complete (h) && se_offload (s, data, length))
+	    return SE_INCOMPLETE;
+	  parser_rebuffer (p, data, length); obj = parse_doc (p, &type);
+	  s->started = 1;
+	}
+	stat_end (p->driver == &exi_parser? STAT_PARSE_EXI : STAT_PARSE_XML, t);
+	if (obj) {
+	  if (!http_complete (h)) http_skip (h); // such as the last chunk
+	  s->state = SE_START; se_idle (s); return method;
 	} else if (!http_complete (h)) {
 	  http_rebuffer (h, p->ptr);
 	} else {
-	  printf ("parse error in message body\n");
-	  print_parse_stack (p);
+	  log_warn ("parse error in message body\n");
+	  if (log_enabled (LOG_WARN)) print_parse_stack (p);
 	  code = 400; goto error;
 	}
       } set_timeout (s);
@@ -266,7 +676,7 @@ int se_receive (void *conn) {
   return SE_ERROR;
 }
 
-SeConnection *connections = NULL;
+THREAD_LOCAL SeConnection *connections = NULL;
 int se_media = SE_XML;
 
 void *new_conn (int client) {
@@ -287,18 +697,120 @@ void *find_conn (int (*match) (void *, void *), void *ctx)  {
   } return NULL;
 }
 
-void *get_conn (Address *addr) { SeConnection *c;
-  foreach (c, connections)
-    if (http_client (c) && address_eq (&c->host, addr)) return c;
-  return new_conn (1);
+/* Client connections are pooled, indexed by (Address, secure) and by the
+   LFDI of the server, the idle connections are kept in LRU order. */
+#define POOL_BUCKETS 64 // must be a power of two
+
+THREAD_LOCAL SeConnection *pool_hosts[POOL_BUCKETS],
+  *pool_lfdis[POOL_BUCKETS];
+THREAD_LOCAL SeConnection *idle_oldest = NULL, *idle_newest = NULL;
+THREAD_LOCAL int idle_count = 0;
+int se_max_idle = 0;
+
+#define KEEP_ALIVE 60 // connections used within a minute are not evicted
+
+unsigned pool_hash (const void *data, int n, unsigned h) {
+  const uint8_t *b = data;
+  while (n--) h = (h ^ *b++) * 16777619u;
+  return h & (POOL_BUCKETS-1);
+}
+
+#define host_hash(addr, secure) \
+  pool_hash (addr, sizeof (Address), 2166136261u ^ (secure))
+
+void *get_conn (Address *addr, int secure) {
+  SeConnection *c, **head = &pool_hosts[host_hash (addr, secure)];
+  for (c = *head; c; c = c->next_host)
+    if (c->secure == secure && address_eq (&c->host, addr)) return c;
+  c = new_conn (1); address_copy (&c->host, addr); c->secure = secure;
+  // the Host header field, known before the connection is established
+  address_copy (&c->http.host, addr);
+  c->next_host = *head; return *head = c;
+}
+
+void index_lfdi (void *conn) {
+  SeConnection *c = conn, **head;
+  if (!http_client (c)) return;
+  if (c->indexed) { // the LFDI may have changed
+    head = &pool_lfdis[c->bucket];
+    while (*head != c) head = &(*head)->next_lfdi;
+    *head = c->next_lfdi;
+  } head = &pool_lfdis[c->bucket = pool_hash (c->lfdi, 20, 2166136261u)];
+  c->next_lfdi = *head; *head = c; c->indexed = 1;
+}
+
+void *find_notifier (uint8_t *lfdi) { SeConnection *c;
+  for (c = pool_lfdis[pool_hash (lfdi, 20, 2166136261u)]; c;
+       c = c->next_lfdi)
+    if (!memcmp (c->lfdi, lfdi, 20)) return c;
+  return NULL;
+}
+
+void idle_remove (SeConnection *c) {
+  if (!c->idle) return;
+  if (c->older) c->older->newer = c->newer; else idle_oldest = c->newer;
+  if (c->newer) c->newer->older = c->older; else idle_newest = c->older;
+  c->idle = 0; idle_count--;
+}
+
+void idle_close (SeConnection *c) {
+  idle_remove (c);
+  if (net_status (c) != Closed) conn_close (c);
+}
+
+// close the least recently used idle connections beyond the maximum,
+// preferring those that are not kept alive
+void idle_evict () {
+  SeConnection *c = idle_oldest, *next; time_t now = time (NULL);
+  while (c && idle_count > se_max_idle) { next = c->newer;
+    if (c->keep < now || c->keep > now + KEEP_ALIVE) idle_close (c);
+    c = next;
+  }
+  while (idle_oldest && idle_count > se_max_idle) idle_close (idle_oldest);
+}
+
+// a client connection with no requests awaiting a response becomes idle
+void se_idle (SeConnection *c) {
+  if (!http_client (c) || http_busy (c)) return;
+  idle_remove (c); c->idle = 1; idle_count++;
+  c->older = idle_newest; c->newer = NULL;
+  if (idle_newest) idle_newest->newer = c; else idle_oldest = c;
+  idle_newest = c;
+  if (se_max_idle) idle_evict ();
+}
+
+void se_keep_alive (void *conn, int64_t secs) {
+  SeConnection *c = conn; c->keep = max (c->keep, time (NULL) + secs);
+}
+
+void *se_reopen (void *conn) { SeConnection *c = conn; Address hosts[2];
+  idle_remove (c);
+  if (http_client (c) && net_status (c) == Closed) {
+    se_abandon (c);
+    if (c->dual) {
+      address_copy (&hosts[0], &c->host); address_copy (&hosts[1], &c->alt);
+      conn_connect_any (c, hosts, 2, c->secure);
+    } else conn_connect (c, &c->host, c->secure);
+    http_reset (c);
+  } return c;
+}
+
+void *se_open (SeConnection *c) {
+  se_reopen (c); if (conn_session (c)) http_flush (c); return c;
 }
 
 void *se_connect (Address *addr, int secure) {
-  SeConnection *c = get_conn (addr);
-  address_copy (&c->host, addr); 
-  if (net_status (c) == Closed)
-    conn_connect (c, addr, secure);
-  if (conn_session (c)) http_flush (c); return c;
+  return se_open (get_conn (addr, secure));
+}
+
+void *se_connect_dual (Address *addr, Address *alt, int secure) {
+  SeConnection *c = get_conn (addr, secure);
+  address_copy (&c->alt, alt); c->dual = 1; return se_open (c);
+}
+
+int se_origin (char *buffer, void *conn) { SeConnection *c = conn;
+  int n = sprintf (buffer, "%s://", conn_secure (c)? "https" : "http");
+  return n + write_address_port (buffer+n, &c->host);
 }
 
 void *se_connect_uri (Uri *uri) {
@@ -306,24 +818,240 @@ void *se_connect_uri (Uri *uri) {
   return se_connect (uri->host, secure);
 }
 
+/* Parsed hrefs, an href resolves to the same host and path each time so is
+   parsed only once. A network-path reference ("//host/path") takes the
+   scheme of the connection so is cached separately for secure connections.
+   The cache is cleared when it exceeds HREF_MAX entries. */
+#define HREF_BUCKETS 1024 // must be a power of two
+#define HREF_MAX 65536
+
+typedef struct _Href {
+  struct _Href *next;
+  SeConnection *conn; // connection to the host, NULL for a relative href
+  char *path; // NULL for an invalid href
+  int secure; // 1 + secure for a network-path reference, 0 otherwise
+  char href[];
+} Href;
+
+THREAD_LOCAL Href *href_table[HREF_BUCKETS];
+THREAD_LOCAL int href_count = 0;
+
+void href_clear () { Href *h, *next; int i;
+  for (i = 0; i < HREF_BUCKETS; i++) {
+    for (h = href_table[i]; h; h = next) { next = h->next; free (h); }
+    href_table[i] = NULL;
+  } href_count = 0;
+}
+
+Href *href_parse (void *conn, const char *href, int secure) {
+  Uri128 buf; Uri *uri = &buf.uri; Href *h;
+  int n = strlen (href) + 1, valid = http_parse_uri (&buf, conn, href, 127);
+  h = malloc (sizeof (Href) + n + (valid? strlen (uri->path) + 1 : 0));
+  memcpy (h->href, href, n); h->secure = secure;
+  h->path = valid? strcpy (h->href + n, uri->path) : NULL;
+  h->conn = valid && uri->host?
+    get_conn (uri->host, streq (uri->scheme, "https")) : NULL;
+  return h;
+}
+
+Href *href_get (void *conn, const char *href) {
+  Href *h, **head; int secure = 0; unsigned x = 2166136261u; const char *c;
+  if (href[0] == '/' && href[1] == '/')
+    secure = 1 + (conn && conn_secure (conn));
+  for (c = href; *c; c++) x = (x ^ (uint8_t)*c) * 16777619u;
+  head = &href_table[(x ^ secure) & (HREF_BUCKETS-1)];
+  for (h = *head; h; h = h->next)
+    if (h->secure == secure && streq (h->href, href)) return h;
+  if (href_count == HREF_MAX) href_clear ();
+  h = href_parse (conn, href, secure);
+  h->next = *head; *head = h; href_count++; return h;
+}
+
+char *se_resolve (void **conn, const char *href) { Href *h;
+  if (!href || !(h = href_get (*conn, href))->path) return NULL;
+  if (h->conn) *conn = se_open (h->conn);
+  return h->path;
+}
+
+char *se_path (void *conn, const char *href) {
+  return href? href_get (conn, href)->path : NULL;
+}
+
 void *se_accept (Acceptor *a, int secure) {
   return conn_accept (new_conn (0), a, secure);
 }
 
+#define SEGMENT_SIZE 4096
+
+/* Write a message, the header (with a Content-Length to be set) followed by
+   the document output in segments, the last segment may be partial. A value
+   larger than a segment is output into a segment of twice the size. */
+void se_writev (SeConnection *c, char *header, int length,
+		void *data, int type) {
+  Output o; int64_t t; int n = 1, size = 8, m, segment = SEGMENT_SIZE;
+  DataSegment *seg = malloc (size * sizeof (DataSegment));
+  char *b = malloc (segment);
+  seg[0].data = header; seg[0].length = length; length = 0;
+  se_output_init (&o, b, segment, c->media);
+  while (1) {
+    t = stat_begin (); m = output_doc (&o, data, type);
+    stat_end (o.driver == &exi_output? STAT_OUTPUT_EXI : STAT_OUTPUT_XML, t);
+    if (m) {
+      if (n == size) seg = realloc (seg, (size <<= 1) * sizeof (DataSegment));
+      seg[n].data = b; seg[n++].length = m; length += m;
+      if (output_complete (&o)) break;
+    } else if (o.state == OUTPUT_ERROR) {
+      log_error ("se_writev: document output error\n"); free (b); break;
+    } else { free (b); segment <<= 1; }
+    b = malloc (segment); output_buffer (&o, b, segment);
+  }
+  set_content_length (header, length);
+#ifdef HTTP_ZLIB
+  if (se_compress_size && length >= se_compress_size && http_client (c))
+    n = http_compress (seg, n);
+#endif
+  http_writev (c, seg, n); free (seg);
+}
+
 void *se_send (void *conn, void *data, int type,
 	       const char *href, int method) {
-  Uri128 buf; Uri *uri = &buf.uri;
-  http_parse_uri (&buf, conn, href, 127);
-  if (uri->host) conn = se_connect_uri (uri);
-  if (conn) { Output o; char buffer[4096];
-    SeConnection *c = conn; int length, header;
-    header = http_send (conn, buffer, uri->path, method);
-    se_output_init (&o, buffer+header, 4096-header, c->media);
-    length = output_doc (&o, data, type);
-    set_content_length (buffer, length); length += header;
-    printf ("se_send:\n");
-    http_write (conn, buffer, length);
-    print_se_object (data, type); printf ("\n");
+  void *c = conn; char *path = se_resolve (&c, href);
+  if (c == conn && conn) se_reopen (conn);
+  if ((conn = c) && path) { char *header = malloc (512);
+    int n = http_send (conn, header, path, method);
+    log_debug ("se_send:\n");
+    if (log_enabled (LOG_DEBUG)) log_se_object (data, type);
+    se_writev (conn, header, n, data, type);
+  } return conn;
+}
+
+void se_reply (void *conn, void *data, int type) {
+  SeConnection *c = conn; char *header = malloc (512);
+  int n = http_status_line (header, 200, "OK");
+  n += http_content (header+n, se_ranges[c->media], 0);
+  se_writev (c, header, n, data, type);
+}
+
+typedef struct _SeCache {
+  char *data[2]; // EXI and XML representations, NULL until output
+  int length[2];
+  uint32_t id, version;
+} SeCache;
+
+uint32_t se_cache_id = 0;
+
+SeCache *se_cache_new () { SeCache *c = type_alloc (SeCache);
+  c->id = __atomic_add_fetch (&se_cache_id, 1, __ATOMIC_RELAXED);
+  return c;
+}
+
+void se_cache_clear (SeCache *c) {
+  free (c->data[0]); free (c->data[1]);
+  c->data[0] = c->data[1] = NULL; c->version++;
+}
+
+void se_cache_free (SeCache *c) {
+  if (c) { se_cache_clear (c); free (c); }
+}
+
+// output a document into a single buffer
+char *se_output_all (void *obj, int type, int media, int *length) {
+  Output o; int n, size = 0, segment = SEGMENT_SIZE;
+  char *data = NULL, *b = malloc (segment);
+  se_output_init (&o, b, segment, media); *length = 0;
+  do { if (!(n = output_doc (&o, obj, type))) {
+      if (o.state == OUTPUT_ERROR) break;
+      // a value larger than the buffer
+      b = realloc (b, segment <<= 1); output_buffer (&o, b, segment);
+      continue;
+    }
+    if (*length + n > size) data = realloc (data, size = (size+n)*2);
+    memcpy (data + *length, b, n); *length += n;
+    output_buffer (&o, b, segment);
+  } while (!output_complete (&o));
+  free (b); return data;
+}
+
+// response header with an entity tag, the ETag of a representation is
+// unique to the cache, the version of the object and the media type
+int se_validator (char *header, const char *etag, int status) {
+  int n = http_status_line (header, status, status == 200? "OK"
+			    : "Not Modified");
+  return n + sprintf (header+n, "ETag: %s\r\n", etag);
+}
+
+void se_serve (void *conn, SeCache *c, void *obj, int type) {
+  SeConnection *s = conn; DataSegment seg[2]; int n, exi = s->media == SE_EXI;
+  char etag[40], *header = malloc (512);
+  sprintf (etag, "\"%x-%x-%c\"", c->id, c->version, exi? 'e' : 'x');
+  if (http_match (s, etag)) {
+    n = se_validator (header, etag, 304);
+    n += sprintf (header+n, "\r\n");
+    http_write (s, header, n); free (header); return;
+  }
+  if (!c->data[exi])
+    c->data[exi] = se_output_all (obj, type, s->media, &c->length[exi]);
+  n = se_validator (header, etag, 200);
+  n += http_content (header+n, se_ranges[s->media], c->length[exi]);
+  seg[0].data = header; seg[0].length = n;
+  if (http_method (s) == HTTP_HEAD || !c->length[exi]) {
+    http_writev (s, seg, 1); return;
+  }
+  seg[1].data = memcpy (malloc (c->length[exi]), c->data[exi],
+			c->length[exi]);
+  seg[1].length = c->length[exi]; http_writev (s, seg, 2);
+}
+
+int se_serve_file (void *conn, const char *name, const char *media) {
+  char etag[40], header[512], *data; int64_t mtime, size;
+  int fd = file_open (name, &mtime, &size), n, length;
+  DataSegment seg[2];
+  if (fd < 0) return 0;
+  sprintf (etag, "\"%" PRIx64 "-%" PRIx64 "\"", mtime, size);
+  if (http_match (conn, etag)) {
+    n = se_validator (header, etag, 304);
+    n += sprintf (header+n, "\r\n");
+    http_write (conn, header, n); file_close (fd); return 1;
+  }
+  n = se_validator (header, etag, 200);
+  n += http_content (header+n, media, size);
+  if (http_method (conn) == HTTP_HEAD) {
+    http_write (conn, header, n); file_close (fd);
+  } else if (!conn_secure (conn)) http_send_file (conn, header, n, fd, size);
+  else { file_close (fd);
+    if (!(data = file_read (name, &length))) return 0;
+    n = se_validator (header, etag, 200);
+    n += http_content (header+n, media, length);
+    seg[0].data = memcpy (malloc (n), header, n); seg[0].length = n;
+    seg[1].data = data; seg[1].length = length; http_writev (conn, seg, 2);
+  } return 1;
+}
+
+typedef struct {
+  Output o; void *obj; int type, media, started;
+} SeStream;
+
+// produce the document in chunks for http_stream
+int se_produce (void *ctx, char *buffer, int size) {
+  SeStream *s = ctx; int64_t t; int n;
+  if (!buffer) { free (s); return 0; }
+  if (s->started) output_buffer (&s->o, buffer, size);
+  else { se_output_init (&s->o, buffer, size, s->media); s->started = 1; }
+  t = stat_begin (); n = output_doc (&s->o, s->obj, s->type);
+  stat_end (s->o.driver == &exi_output? STAT_OUTPUT_EXI : STAT_OUTPUT_XML, t);
+  return n;
+}
+
+void *se_stream (void *conn, void *obj, int type,
+		 const char *href, int method) {
+  void *h = conn; char *path = se_resolve (&h, href);
+  if (h == conn && conn) se_reopen (conn);
+  if ((conn = h) && path) { SeConnection *c = conn; char header[512]; int n;
+    SeStream *s = type_alloc (SeStream);
+    s->obj = obj; s->type = type; s->media = c->media;
+    n = http_send_chunked (conn, header, path, method);
+    log_debug ("se_stream:\n");
+    http_stream (conn, header, n, se_produce, s);
   } return conn;
 }
 
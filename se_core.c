@@ -5,13 +5,18 @@
 #include "util.c"
 #include "list.c"
 #include "queue.c"
+#include "stats.c"
+#include "log.c"
 #include "platform.c"
+#include "memory.c"
+#include "pool.c"
 #include "parse.c"
 #include "xml_parse.c"
 #include "exi_parse.c"
 #include "output.c"
 #include "xml_output.c"
 #include "exi_output.c"
+#include "parse_pool.c"
 #include "se_types.h"
 #include "se_object.c"
 #include "sha256.c"
@@ -25,5 +30,6 @@
 #include "named.c"
 #include "dnssd_client.c"
 #include "se_discover.c"
+#include "context.c"
 
 
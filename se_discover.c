@@ -91,10 +91,10 @@ int se_subquery (char *name) {
   return index < 14? 1 << index : 0;
 }
 
-UdpPort *mdns_port = NULL, *mdns_source = NULL, *dns_port = NULL;
+THREAD_LOCAL UdpPort *mdns_port = NULL, *mdns_source = NULL, *dns_port = NULL;
 
 void se_discover (int server, int qu) { int i = 0;
-  char query[1024], name[64], *packet;
+  char query[DNSSD_MAX], name[64], *packet;
   packet = dnssd_query (query);
   server &= ~(-1 << 14);
   while (server) {
@@ -107,22 +107,22 @@ void se_discover (int server, int qu) { int i = 0;
     }
     server >>= 1; i++;
   }
-  printf ("se_discover %d\n",
-	  net_send (mdns_source, query, packet - query, &multicast));
+  log_debug ("se_discover %d\n",
+	     net_send (mdns_source, query, packet - query, &multicast));
 }
 
 void discover_device () {
-  char query[256], name[64], *packet, *n = name;
+  char query[DNSSD_MAX], name[64], *packet, *n = name;
   packet = dnssd_query (query);
   n += sprintf (name, ".edev-%012" PRIu64 "._sub", device_sfdi);
   strcpy (n, "._smartenergy._tcp.site");
   write_counted (name);
   packet = dnssd_question (packet, name, PTR_RECORD, 1);
-  printf ("discover_device %d\n",
-	  net_send (mdns_source, query, packet - query, &multicast));
+  log_debug ("discover_device %d\n",
+	     net_send (mdns_source, query, packet - query, &multicast));
 }
 
-Address dns_server;
+THREAD_LOCAL Address dns_server;
 
 void se_discover_unicast (char *domain) {
   char query[512], *packet;
@@ -161,10 +161,13 @@ void *service_connect (Service *service, int secure) {
   if (secure) https = txt_value (buffer, service->txt, "https");
   int port = https? (*https == '\0'? 443 : atol (https)) : service->port,
     n_port = htons (port);
-  printf ("service_connect: connect on port %d, https = %s, port = %d\n",
-	  port, https, service->port); 
+  log_debug ("service_connect: connect on port %d, https = %s, port = %d\n",
+	     port, https, service->port);
   addr = &service->host->addr; addr->port = n_port;
-  return se_connect (addr, https != NULL);
+  if (service->host->dual) { // race the IPv6 and IPv4 addresses
+    service->host->ipv4.port = n_port;
+    return se_connect_dual (addr, &service->host->ipv4, https != NULL);
+  } return se_connect (addr, https != NULL);
 }
 
 Service *service_receive (UdpPort *port) {
@@ -73,11 +73,29 @@ typedef struct {
  */
 #define free_se_object(obj, type) free_object (obj, type, &se_schema)
 
+/** @brief Make a deep copy of an IEEE 2030.5 object.
+    @param obj is an IEEE 2030.5 object
+    @param type is the type of the object
+    @returns a copy of the object allocated with malloc
+*/
+#define copy_se_object(obj, type) copy_object (obj, type, &se_schema)
+
+/** @brief Compare two IEEE 2030.5 objects of the same type.
+    @returns a mask of the fields that differ, 0 if the objects are equal
+    (see @ref compare_object)
+*/
+#define compare_se_object(a, b, type) compare_object (a, b, type, &se_schema)
+
+/** @brief Hash the value of an IEEE 2030.5 object (see @ref hash_object). */
+#define hash_se_object(obj, type) hash_object (obj, type, &se_schema)
+
 /** @brief Replace an IEEE 2030.5 object with another of the same type.
 
     Frees the elements of the destination object and copies the source object
     to the same location, replacing one object with another. Also frees the
-    source object container.
+    source object container. An equal source object is freed and the
+    destination kept.
+    @returns a mask of the fields that changed, 0 if none
 */
 #define replace_se_object(dest, src, type)				\
   replace_object (dest, src, type, &se_schema)
@@ -91,6 +109,23 @@ typedef struct {
 */
 ListInfo *find_list_info (unsigned short type);
 
+/** @brief The maximum length of a normalized list key */
+#define LIST_KEY 64
+
+/** @brief Normalize the list keys of an IEEE 2030.5 object.
+
+    The keys are written as a fixed width byte string that orders with
+    memcmp: integers are big endian with the sign bit flipped, hexBinary keys
+    are reversed, strings are zero padded (strings of unbounded length are
+    truncated to 32 bytes), and the bytes of descending keys are inverted.
+    The length of the key depends only upon the ListInfo.
+    @param key is a pointer to a buffer of at least LIST_KEY bytes
+    @param obj is an IEEE 2030.5 object
+    @param info is a pointer to the ListInfo for the list type
+    @returns the length of the key
+*/
+int list_key (uint8_t *key, void *obj, ListInfo *info);
+
 /** @brief Compare the keys of two IEEE 2030.5 objects using the provided list
     ordering.
 
@@ -126,6 +161,28 @@ void se_output_init (Output *o, char *buffer, int size, int xml);
 */
 void print_se_object (void *obj, int type);
 
+/** @brief Write an SE object to the log as XML.
+    @param obj is a pointer to an SE object
+    @param type is the type of the SE object
+*/
+void log_se_object (void *obj, int type);
+
+/** @brief Encode an IEEE 2030.5 object as an EXI document.
+    @param obj is a pointer to the object
+    @param type is the object type
+    @param length is a pointer to the returned length of the document
+    @returns the document allocated with malloc
+*/
+char *se_exi_encode (void *obj, int type, int *length);
+
+/** @brief Decode an IEEE 2030.5 object from an EXI document.
+    @param data is a pointer to the document
+    @param length is the length of the document
+    @param type is a pointer to the returned object type
+    @returns the object or NULL if the document is invalid
+*/
+void *se_exi_decode (char *data, int length, int *type);
+
 /** @} */
 
 #ifdef HEADER_ONLY
@@ -135,6 +192,7 @@ extern Schema se_schema;
 
 #else
 
+#include "se_codec.c"
 #include "se_schema.c"
 #include "se_list.c"
 
@@ -160,46 +218,60 @@ ListInfo *find_list_info (unsigned short type) {
 		  sizeof (ListInfo), compare_ids);  
 }
 
-int compare_binary (uint8_t *a, uint8_t *b, int n) {
-  while (n--) {
-    if (a[n] < b[n]) return -1;
-    if (a[n] > b[n]) return 1;
-  } return 0;
+int key_size (int type) {
+  switch (type) {
+  case XS_LONG: case XS_ULONG: return 8;
+  case XS_INT: case XS_UINT: return 4;
+  case XS_SHORT: case XS_USHORT: return 2;
+  } return 1;
 }
 
-#define compare_uint(a, b, type) \
-  (*(type)a < *(type)b)? -1 : (*(type)a - *(type)b)
-
-int compare_key (void *a, void *b, Key *key) { int type, n;
-  if (key->type < 0) { void *t = a; a = b; b = t; type = -key->type; }
-  else type = key->type;
-  n = type >> 4; type &= 0xf;
-  a += key->offset; b += key->offset;
-  switch (type) {
-  case XS_STRING: case XS_ANY_URI: return strcmp (a, b);
-  case XS_HEX_BINARY: return compare_binary (a, b, n);
-  case XS_LONG: return *(int64_t *)a - *(int64_t *)b;
-  case XS_INT: return *(int32_t *)a - *(int32_t *)b;
-  case XS_SHORT: return *(int16_t *)a - *(int16_t *)b;
-  case XS_BYTE: return *(int8_t *)a - *(int8_t *)b;
-  case XS_ULONG: return compare_uint (a, b, uint64_t *);
-  case XS_UINT: return compare_uint (a, b, uint32_t *);
-  case XS_USHORT: return compare_uint (a, b, uint16_t *);
-  case XS_UBYTE: return compare_uint (a, b, uint8_t *);
-  } return -1;
+int list_key (uint8_t *key, void *obj, ListInfo *info) {
+  Key *k = info->key; int i, j, n, size, type, length = 0;
+  uint64_t x; void *v; char *t;
+  for (i = 0; i < 3 && k->type; i++, k++) {
+    type = k->type < 0? -k->type : k->type;
+    n = type >> 4; type &= 0xf; v = obj + k->offset;
+    switch (type) {
+    case XS_STRING: case XS_ANY_URI:
+      if (n) t = v; else { t = *(char **)v; n = 32; }
+      size = min (n, LIST_KEY - length);
+      for (j = 0; j < size && t && t[j]; j++) key[length+j] = t[j];
+      memset (key + length + j, 0, size - j); break;
+    case XS_HEX_BINARY: // compared from the last byte
+      size = min (n, LIST_KEY - length);
+      for (j = 0; j < size; j++) key[length+j] = ((uint8_t *)v)[n-1-j];
+      break;
+    default:
+      switch (type) {
+      case XS_LONG: x = *(int64_t *)v ^ INT64_MIN; break;
+      case XS_INT: x = (uint32_t)(*(int32_t *)v ^ INT32_MIN); break;
+      case XS_SHORT: x = (uint16_t)(*(int16_t *)v ^ INT16_MIN); break;
+      case XS_BYTE: x = (uint8_t)(*(int8_t *)v ^ INT8_MIN); break;
+      case XS_ULONG: x = *(uint64_t *)v; break;
+      case XS_UINT: x = *(uint32_t *)v; break;
+      case XS_USHORT: x = *(uint16_t *)v; break;
+      default: x = *(uint8_t *)v;
+      }
+      size = min (key_size (type), LIST_KEY - length);
+      for (j = 0; j < size; j++)
+	key[length+j] = x >> ((key_size (type) - 1 - j) << 3);
+    }
+    if (k->type < 0) // descending
+      for (j = 0; j < size; j++) key[length+j] = ~key[length+j];
+    length += size;
+  } return length;
 }
 
 int compare_keys (void *a, void *b, ListInfo *info) {
-  Key *key = info->key; int i = 0, ret;
-  while (i < 3 && key->type) {
-    if (ret = compare_key (a, b, key)) return ret;
-    i++; key++;
-  } return ret;
+  uint8_t x[LIST_KEY], y[LIST_KEY]; int n = list_key (x, a, info);
+  list_key (y, b, info); return memcmp (x, y, n);
 }
 
 void *insert_se_object (List *list, List *n, ListInfo *info) {
-  List *prev = NULL, *l = list;
-  while (l && (compare_keys (n->data, l->data, info) > 0))
+  List *prev = NULL, *l = list; uint8_t x[LIST_KEY], y[LIST_KEY];
+  int length = list_key (x, n->data, info);
+  while (l && (list_key (y, l->data, info), memcmp (x, y, length) > 0))
     prev = l, l = l->next;
   if (prev) prev->next = n; else list = n;
   n->next = l; return list;
@@ -216,4 +288,30 @@ void print_se_object (void *obj, int type) {
   while (output_doc (&o, obj, type)) printf ("%s", buffer);
 }
 
+void log_se_object (void *obj, int type) {
+  Output o; char buffer[1024]; int n;
+  output_init (&o, &se_schema, buffer, 1024);
+  while (n = output_doc (&o, obj, type)) log_write (buffer, n);
+  log_write ("\n", 1);
+}
+
+char *se_exi_encode (void *obj, int type, int *length) {
+  Output o; int size = 1024, n;
+  char *buffer = malloc (size);
+  exi_output_init (&o, &se_schema, buffer, size);
+  n = output_doc (&o, obj, type);
+  while (!output_complete (&o)) {
+    buffer = realloc (buffer, size <<= 1);
+    output_buffer (&o, buffer+n, size-n);
+    n += output_doc (&o, obj, type);
+  } *length = n; return buffer;
+}
+
+void *se_exi_decode (char *data, int length, int *type) {
+  Parser p; void *obj;
+  exi_parse_init (&p, &se_schema, data, length);
+  if (!(obj = parse_doc (&p, type))) exi_parse_done (&p);
+  return obj;
+}
+
 #endif
@@ -327,1942 +327,1942 @@ const SchemaEntry se_entries[] = {
   {.min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,16)}, // mRIDType
   // UnitValueType (324)
   {.size=sizeof(SE_UnitValueType_t), .index=0},
-  {.offset=offsetof(SE_UnitValueType_t,multiplier), .min=1, .max=1, .type=ST_SIMPLE|XS_BYTE, .n=1},
-  {.offset=offsetof(SE_UnitValueType_t,unit), .min=1, .max=1, .type=ST_SIMPLE|XS_UBYTE, .n=1},
-  {.offset=offsetof(SE_UnitValueType_t,value), .min=1, .max=1, .type=ST_SIMPLE|XS_INT, .n=1},
+  {.offset=offsetof(SE_UnitValueType_t,multiplier), .min=1, .max=1, .type=ST_SIMPLE|XS_BYTE, .n=1, .width=1},
+  {.offset=offsetof(SE_UnitValueType_t,unit), .min=1, .max=1, .type=ST_SIMPLE|XS_UBYTE, .n=1, .width=1},
+  {.offset=offsetof(SE_UnitValueType_t,value), .min=1, .max=1, .type=ST_SIMPLE|XS_INT, .n=1, .width=1},
   // Resource (328)
   {.size=sizeof(SE_Resource_t), .index=0},
-  {.offset=offsetof(SE_Resource_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2},
+  {.offset=offsetof(SE_Resource_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2, .width=2},
   // ReadingType (330)
   {.size=sizeof(SE_ReadingType_t), .index=328},
-  {.offset=offsetof(SE_ReadingType_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=19},
-  {.offset=offsetof(SE_ReadingType_t,accumulationBehaviour), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|XS_UBYTE, .n=18},
-  {.offset=offsetof(SE_ReadingType_t,calorificValue), .min=0, .max=1, .bit=1, .index=324, .n=17},
-  {.offset=offsetof(SE_ReadingType_t,commodity), .min=0, .max=1, .bit=2, .type=ST_SIMPLE|XS_UBYTE, .n=16},
-  {.offset=offsetof(SE_ReadingType_t,conversionFactor), .min=0, .max=1, .bit=3, .index=324, .n=15},
-  {.offset=offsetof(SE_ReadingType_t,dataQualifier), .min=0, .max=1, .bit=4, .type=ST_SIMPLE|XS_UBYTE, .n=14},
-  {.offset=offsetof(SE_ReadingType_t,flowDirection), .min=0, .max=1, .bit=5, .type=ST_SIMPLE|XS_UBYTE, .n=13},
-  {.offset=offsetof(SE_ReadingType_t,intervalLength), .min=0, .max=1, .bit=6, .type=ST_SIMPLE|XS_UINT, .n=12},
-  {.offset=offsetof(SE_ReadingType_t,kind), .min=0, .max=1, .bit=17, .type=ST_SIMPLE|XS_UBYTE, .n=11},
-  {.offset=offsetof(SE_ReadingType_t,maxNumberOfIntervals), .min=0, .max=1, .bit=7, .type=ST_SIMPLE|XS_UBYTE, .n=10},
-  {.offset=offsetof(SE_ReadingType_t,numberOfConsumptionBlocks), .min=0, .max=1, .bit=8, .type=ST_SIMPLE|XS_UBYTE, .n=9},
-  {.offset=offsetof(SE_ReadingType_t,numberOfTouTiers), .min=0, .max=1, .bit=9, .type=ST_SIMPLE|XS_UBYTE, .n=8},
-  {.offset=offsetof(SE_ReadingType_t,phase), .min=0, .max=1, .bit=10, .type=ST_SIMPLE|XS_UBYTE, .n=7},
-  {.offset=offsetof(SE_ReadingType_t,powerOfTenMultiplier), .min=0, .max=1, .bit=11, .type=ST_SIMPLE|XS_BYTE, .n=6},
-  {.offset=offsetof(SE_ReadingType_t,subIntervalLength), .min=0, .max=1, .bit=12, .type=ST_SIMPLE|XS_UINT, .n=5},
-  {.offset=offsetof(SE_ReadingType_t,supplyLimit), .min=0, .max=1, .bit=13, .type=ST_SIMPLE|XS_ULONG, .n=4},
-  {.min=0, .max=1, .bit=14, .type=ST_SIMPLE|XS_BOOLEAN, .n=3},
-  {.offset=offsetof(SE_ReadingType_t,uom), .min=0, .max=1, .bit=16, .type=ST_SIMPLE|XS_UBYTE, .n=2},
+  {.offset=offsetof(SE_ReadingType_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=19, .width=5},
+  {.offset=offsetof(SE_ReadingType_t,accumulationBehaviour), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|XS_UBYTE, .n=18, .width=5},
+  {.offset=offsetof(SE_ReadingType_t,calorificValue), .min=0, .max=1, .bit=1, .index=324, .n=17, .width=5},
+  {.offset=offsetof(SE_ReadingType_t,commodity), .min=0, .max=1, .bit=2, .type=ST_SIMPLE|XS_UBYTE, .n=16, .width=5},
+  {.offset=offsetof(SE_ReadingType_t,conversionFactor), .min=0, .max=1, .bit=3, .index=324, .n=15, .width=4},
+  {.offset=offsetof(SE_ReadingType_t,dataQualifier), .min=0, .max=1, .bit=4, .type=ST_SIMPLE|XS_UBYTE, .n=14, .width=4},
+  {.offset=offsetof(SE_ReadingType_t,flowDirection), .min=0, .max=1, .bit=5, .type=ST_SIMPLE|XS_UBYTE, .n=13, .width=4},
+  {.offset=offsetof(SE_ReadingType_t,intervalLength), .min=0, .max=1, .bit=6, .type=ST_SIMPLE|XS_UINT, .n=12, .width=4},
+  {.offset=offsetof(SE_ReadingType_t,kind), .min=0, .max=1, .bit=17, .type=ST_SIMPLE|XS_UBYTE, .n=11, .width=4},
+  {.offset=offsetof(SE_ReadingType_t,maxNumberOfIntervals), .min=0, .max=1, .bit=7, .type=ST_SIMPLE|XS_UBYTE, .n=10, .width=4},
+  {.offset=offsetof(SE_ReadingType_t,numberOfConsumptionBlocks), .min=0, .max=1, .bit=8, .type=ST_SIMPLE|XS_UBYTE, .n=9, .width=4},
+  {.offset=offsetof(SE_ReadingType_t,numberOfTouTiers), .min=0, .max=1, .bit=9, .type=ST_SIMPLE|XS_UBYTE, .n=8, .width=4},
+  {.offset=offsetof(SE_ReadingType_t,phase), .min=0, .max=1, .bit=10, .type=ST_SIMPLE|XS_UBYTE, .n=7, .width=3},
+  {.offset=offsetof(SE_ReadingType_t,powerOfTenMultiplier), .min=0, .max=1, .bit=11, .type=ST_SIMPLE|XS_BYTE, .n=6, .width=3},
+  {.offset=offsetof(SE_ReadingType_t,subIntervalLength), .min=0, .max=1, .bit=12, .type=ST_SIMPLE|XS_UINT, .n=5, .width=3},
+  {.offset=offsetof(SE_ReadingType_t,supplyLimit), .min=0, .max=1, .bit=13, .type=ST_SIMPLE|XS_ULONG, .n=4, .width=3},
+  {.min=0, .max=1, .bit=14, .type=ST_SIMPLE|XS_BOOLEAN, .n=3, .width=2},
+  {.offset=offsetof(SE_ReadingType_t,uom), .min=0, .max=1, .bit=16, .type=ST_SIMPLE|XS_UBYTE, .n=2, .width=2},
   // DateTimeInterval (349)
   {.size=sizeof(SE_DateTimeInterval_t), .index=0},
-  {.offset=offsetof(SE_DateTimeInterval_t,duration), .min=1, .max=1, .type=ST_SIMPLE|XS_UINT, .n=1},
-  {.offset=offsetof(SE_DateTimeInterval_t,start), .min=1, .max=1, .type=ST_SIMPLE|XS_LONG, .n=1},
+  {.offset=offsetof(SE_DateTimeInterval_t,duration), .min=1, .max=1, .type=ST_SIMPLE|XS_UINT, .n=1, .width=1},
+  {.offset=offsetof(SE_DateTimeInterval_t,start), .min=1, .max=1, .type=ST_SIMPLE|XS_LONG, .n=1, .width=1},
   // ReadingBase (352)
   {.size=sizeof(SE_ReadingBase_t), .index=328},
-  {.offset=offsetof(SE_ReadingBase_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=7},
-  {.offset=offsetof(SE_ReadingBase_t,consumptionBlock), .min=0, .max=1, .bit=2, .type=ST_SIMPLE|XS_UBYTE, .n=6},
-  {.offset=offsetof(SE_ReadingBase_t,qualityFlags), .min=0, .max=1, .bit=3, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,2), .n=5},
-  {.offset=offsetof(SE_ReadingBase_t,timePeriod), .min=0, .max=1, .bit=4, .index=349, .n=4},
-  {.offset=offsetof(SE_ReadingBase_t,touTier), .min=0, .max=1, .bit=5, .type=ST_SIMPLE|XS_UBYTE, .n=3},
-  {.offset=offsetof(SE_ReadingBase_t,value), .min=0, .max=1, .bit=6, .type=ST_SIMPLE|XS_LONG, .n=2},
+  {.offset=offsetof(SE_ReadingBase_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=7, .width=3},
+  {.offset=offsetof(SE_ReadingBase_t,consumptionBlock), .min=0, .max=1, .bit=2, .type=ST_SIMPLE|XS_UBYTE, .n=6, .width=3},
+  {.offset=offsetof(SE_ReadingBase_t,qualityFlags), .min=0, .max=1, .bit=3, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,2), .n=5, .width=3},
+  {.offset=offsetof(SE_ReadingBase_t,timePeriod), .min=0, .max=1, .bit=4, .index=349, .n=4, .width=3},
+  {.offset=offsetof(SE_ReadingBase_t,touTier), .min=0, .max=1, .bit=5, .type=ST_SIMPLE|XS_UBYTE, .n=3, .width=2},
+  {.offset=offsetof(SE_ReadingBase_t,value), .min=0, .max=1, .bit=6, .type=ST_SIMPLE|XS_LONG, .n=2, .width=2},
   // Reading (359)
   {.size=sizeof(SE_Reading_t), .index=352},
-  {.offset=offsetof(SE_Reading_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=9},
-  {.offset=offsetof(SE_Reading_t,subscribable), .min=0, .max=1, .attribute=1, .bit=1, .type=ST_SIMPLE|XS_UBYTE, .n=8},
-  {.offset=offsetof(SE_Reading_t,consumptionBlock), .min=0, .max=1, .bit=2, .type=ST_SIMPLE|XS_UBYTE, .n=7},
-  {.offset=offsetof(SE_Reading_t,qualityFlags), .min=0, .max=1, .bit=3, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,2), .n=6},
-  {.offset=offsetof(SE_Reading_t,timePeriod), .min=0, .max=1, .bit=4, .index=349, .n=5},
-  {.offset=offsetof(SE_Reading_t,touTier), .min=0, .max=1, .bit=5, .type=ST_SIMPLE|XS_UBYTE, .n=4},
-  {.offset=offsetof(SE_Reading_t,value), .min=0, .max=1, .bit=6, .type=ST_SIMPLE|XS_LONG, .n=3},
-  {.offset=offsetof(SE_Reading_t,localID), .min=0, .max=1, .bit=7, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,2), .n=2},
+  {.offset=offsetof(SE_Reading_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=9, .width=4},
+  {.offset=offsetof(SE_Reading_t,subscribable), .min=0, .max=1, .attribute=1, .bit=1, .type=ST_SIMPLE|XS_UBYTE, .n=8, .width=4},
+  {.offset=offsetof(SE_Reading_t,consumptionBlock), .min=0, .max=1, .bit=2, .type=ST_SIMPLE|XS_UBYTE, .n=7, .width=3},
+  {.offset=offsetof(SE_Reading_t,qualityFlags), .min=0, .max=1, .bit=3, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,2), .n=6, .width=3},
+  {.offset=offsetof(SE_Reading_t,timePeriod), .min=0, .max=1, .bit=4, .index=349, .n=5, .width=3},
+  {.offset=offsetof(SE_Reading_t,touTier), .min=0, .max=1, .bit=5, .type=ST_SIMPLE|XS_UBYTE, .n=4, .width=3},
+  {.offset=offsetof(SE_Reading_t,value), .min=0, .max=1, .bit=6, .type=ST_SIMPLE|XS_LONG, .n=3, .width=2},
+  {.offset=offsetof(SE_Reading_t,localID), .min=0, .max=1, .bit=7, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,2), .n=2, .width=2},
   // IdentifiedObject (368)
   {.size=sizeof(SE_IdentifiedObject_t), .index=328},
-  {.offset=offsetof(SE_IdentifiedObject_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2},
-  {.offset=offsetof(SE_IdentifiedObject_t,mRID), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,16), .n=1},
-  {.offset=offsetof(SE_IdentifiedObject_t,description), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|xs_type(XS_STRING,32), .n=3},
-  {.offset=offsetof(SE_IdentifiedObject_t,version), .min=0, .max=1, .bit=2, .type=ST_SIMPLE|XS_USHORT, .n=2},
+  {.offset=offsetof(SE_IdentifiedObject_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2, .width=2},
+  {.offset=offsetof(SE_IdentifiedObject_t,mRID), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,16), .n=1, .width=1},
+  {.offset=offsetof(SE_IdentifiedObject_t,description), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|xs_type(XS_STRING,32), .n=3, .width=2},
+  {.offset=offsetof(SE_IdentifiedObject_t,version), .min=0, .max=1, .bit=2, .type=ST_SIMPLE|XS_USHORT, .n=2, .width=2},
   // ReadingSetBase (373)
   {.size=sizeof(SE_ReadingSetBase_t), .index=368},
-  {.offset=offsetof(SE_ReadingSetBase_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2},
-  {.offset=offsetof(SE_ReadingSetBase_t,mRID), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,16), .n=1},
-  {.offset=offsetof(SE_ReadingSetBase_t,description), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|xs_type(XS_STRING,32), .n=3},
-  {.offset=offsetof(SE_ReadingSetBase_t,version), .min=0, .max=1, .bit=2, .type=ST_SIMPLE|XS_USHORT, .n=2},
-  {.offset=offsetof(SE_ReadingSetBase_t,timePeriod), .min=1, .max=1, .index=349, .n=1},
+  {.offset=offsetof(SE_ReadingSetBase_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2, .width=2},
+  {.offset=offsetof(SE_ReadingSetBase_t,mRID), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,16), .n=1, .width=1},
+  {.offset=offsetof(SE_ReadingSetBase_t,description), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|xs_type(XS_STRING,32), .n=3, .width=2},
+  {.offset=offsetof(SE_ReadingSetBase_t,version), .min=0, .max=1, .bit=2, .type=ST_SIMPLE|XS_USHORT, .n=2, .width=2},
+  {.offset=offsetof(SE_ReadingSetBase_t,timePeriod), .min=1, .max=1, .index=349, .n=1, .width=1},
   // MirrorReadingSet (379)
   {.size=sizeof(SE_MirrorReadingSet_t), .index=373},
-  {.offset=offsetof(SE_MirrorReadingSet_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2},
-  {.offset=offsetof(SE_MirrorReadingSet_t,mRID), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,16), .n=1},
-  {.offset=offsetof(SE_MirrorReadingSet_t,description), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|xs_type(XS_STRING,32), .n=3},
-  {.offset=offsetof(SE_MirrorReadingSet_t,version), .min=0, .max=1, .bit=2, .type=ST_SIMPLE|XS_USHORT, .n=2},
-  {.offset=offsetof(SE_MirrorReadingSet_t,timePeriod), .min=1, .max=1, .index=349, .n=1},
-  {.offset=offsetof(SE_MirrorReadingSet_t,Reading), .min=0, .unbounded=1, .index=359, .n=2},
+  {.offset=offsetof(SE_MirrorReadingSet_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2, .width=2},
+  {.offset=offsetof(SE_MirrorReadingSet_t,mRID), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,16), .n=1, .width=1},
+  {.offset=offsetof(SE_MirrorReadingSet_t,description), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|xs_type(XS_STRING,32), .n=3, .width=2},
+  {.offset=offsetof(SE_MirrorReadingSet_t,version), .min=0, .max=1, .bit=2, .type=ST_SIMPLE|XS_USHORT, .n=2, .width=2},
+  {.offset=offsetof(SE_MirrorReadingSet_t,timePeriod), .min=1, .max=1, .index=349, .n=1, .width=1},
+  {.offset=offsetof(SE_MirrorReadingSet_t,Reading), .min=0, .unbounded=1, .index=359, .n=2, .width=2},
   // MeterReadingBase (386)
   {.size=sizeof(SE_MeterReadingBase_t), .index=368},
-  {.offset=offsetof(SE_MeterReadingBase_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2},
-  {.offset=offsetof(SE_MeterReadingBase_t,mRID), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,16), .n=1},
-  {.offset=offsetof(SE_MeterReadingBase_t,description), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|xs_type(XS_STRING,32), .n=3},
-  {.offset=offsetof(SE_MeterReadingBase_t,version), .min=0, .max=1, .bit=2, .type=ST_SIMPLE|XS_USHORT, .n=2},
+  {.offset=offsetof(SE_MeterReadingBase_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2, .width=2},
+  {.offset=offsetof(SE_MeterReadingBase_t,mRID), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,16), .n=1, .width=1},
+  {.offset=offsetof(SE_MeterReadingBase_t,description), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|xs_type(XS_STRING,32), .n=3, .width=2},
+  {.offset=offsetof(SE_MeterReadingBase_t,version), .min=0, .max=1, .bit=2, .type=ST_SIMPLE|XS_USHORT, .n=2, .width=2},
   // MirrorMeterReading (391)
   {.size=sizeof(SE_MirrorMeterReading_t), .index=386},
-  {.offset=offsetof(SE_MirrorMeterReading_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2},
-  {.offset=offsetof(SE_MirrorMeterReading_t,mRID), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,16), .n=1},
-  {.offset=offsetof(SE_MirrorMeterReading_t,description), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|xs_type(XS_STRING,32), .n=8},
-  {.offset=offsetof(SE_MirrorMeterReading_t,version), .min=0, .max=1, .bit=2, .type=ST_SIMPLE|XS_USHORT, .n=7},
-  {.offset=offsetof(SE_MirrorMeterReading_t,lastUpdateTime), .min=0, .max=1, .bit=3, .type=ST_SIMPLE|XS_LONG, .n=6},
-  {.offset=offsetof(SE_MirrorMeterReading_t,MirrorReadingSet), .min=0, .unbounded=1, .index=379, .n=5},
-  {.offset=offsetof(SE_MirrorMeterReading_t,nextUpdateTime), .min=0, .max=1, .bit=4, .type=ST_SIMPLE|XS_LONG, .n=4},
-  {.offset=offsetof(SE_MirrorMeterReading_t,Reading), .min=0, .max=1, .bit=5, .index=359, .n=3},
-  {.offset=offsetof(SE_MirrorMeterReading_t,ReadingType), .min=0, .max=1, .bit=6, .index=330, .n=2},
+  {.offset=offsetof(SE_MirrorMeterReading_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2, .width=2},
+  {.offset=offsetof(SE_MirrorMeterReading_t,mRID), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,16), .n=1, .width=1},
+  {.offset=offsetof(SE_MirrorMeterReading_t,description), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|xs_type(XS_STRING,32), .n=8, .width=4},
+  {.offset=offsetof(SE_MirrorMeterReading_t,version), .min=0, .max=1, .bit=2, .type=ST_SIMPLE|XS_USHORT, .n=7, .width=3},
+  {.offset=offsetof(SE_MirrorMeterReading_t,lastUpdateTime), .min=0, .max=1, .bit=3, .type=ST_SIMPLE|XS_LONG, .n=6, .width=3},
+  {.offset=offsetof(SE_MirrorMeterReading_t,MirrorReadingSet), .min=0, .unbounded=1, .index=379, .n=5, .width=3},
+  {.offset=offsetof(SE_MirrorMeterReading_t,nextUpdateTime), .min=0, .max=1, .bit=4, .type=ST_SIMPLE|XS_LONG, .n=4, .width=3},
+  {.offset=offsetof(SE_MirrorMeterReading_t,Reading), .min=0, .max=1, .bit=5, .index=359, .n=3, .width=2},
+  {.offset=offsetof(SE_MirrorMeterReading_t,ReadingType), .min=0, .max=1, .bit=6, .index=330, .n=2, .width=2},
   // UsagePointBase (401)
   {.size=sizeof(SE_UsagePointBase_t), .index=368},
-  {.offset=offsetof(SE_UsagePointBase_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2},
-  {.offset=offsetof(SE_UsagePointBase_t,mRID), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,16), .n=1},
-  {.offset=offsetof(SE_UsagePointBase_t,description), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|xs_type(XS_STRING,32), .n=3},
-  {.offset=offsetof(SE_UsagePointBase_t,version), .min=0, .max=1, .bit=2, .type=ST_SIMPLE|XS_USHORT, .n=2},
-  {.offset=offsetof(SE_UsagePointBase_t,roleFlags), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,2), .n=1},
-  {.offset=offsetof(SE_UsagePointBase_t,serviceCategoryKind), .min=1, .max=1, .type=ST_SIMPLE|XS_UBYTE, .n=1},
-  {.offset=offsetof(SE_UsagePointBase_t,status), .min=1, .max=1, .type=ST_SIMPLE|XS_UBYTE, .n=1},
+  {.offset=offsetof(SE_UsagePointBase_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2, .width=2},
+  {.offset=offsetof(SE_UsagePointBase_t,mRID), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,16), .n=1, .width=1},
+  {.offset=offsetof(SE_UsagePointBase_t,description), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|xs_type(XS_STRING,32), .n=3, .width=2},
+  {.offset=offsetof(SE_UsagePointBase_t,version), .min=0, .max=1, .bit=2, .type=ST_SIMPLE|XS_USHORT, .n=2, .width=2},
+  {.offset=offsetof(SE_UsagePointBase_t,roleFlags), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,2), .n=1, .width=1},
+  {.offset=offsetof(SE_UsagePointBase_t,serviceCategoryKind), .min=1, .max=1, .type=ST_SIMPLE|XS_UBYTE, .n=1, .width=1},
+  {.offset=offsetof(SE_UsagePointBase_t,status), .min=1, .max=1, .type=ST_SIMPLE|XS_UBYTE, .n=1, .width=1},
   // MirrorUsagePoint (409)
   {.size=sizeof(SE_MirrorUsagePoint_t), .index=401},
-  {.offset=offsetof(SE_MirrorUsagePoint_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2},
-  {.offset=offsetof(SE_MirrorUsagePoint_t,mRID), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,16), .n=1},
-  {.offset=offsetof(SE_MirrorUsagePoint_t,description), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|xs_type(XS_STRING,32), .n=3},
-  {.offset=offsetof(SE_MirrorUsagePoint_t,version), .min=0, .max=1, .bit=2, .type=ST_SIMPLE|XS_USHORT, .n=2},
-  {.offset=offsetof(SE_MirrorUsagePoint_t,roleFlags), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,2), .n=1},
-  {.offset=offsetof(SE_MirrorUsagePoint_t,serviceCategoryKind), .min=1, .max=1, .type=ST_SIMPLE|XS_UBYTE, .n=1},
-  {.offset=offsetof(SE_MirrorUsagePoint_t,status), .min=1, .max=1, .type=ST_SIMPLE|XS_UBYTE, .n=1},
-  {.offset=offsetof(SE_MirrorUsagePoint_t,deviceLFDI), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,20), .n=1},
-  {.offset=offsetof(SE_MirrorUsagePoint_t,MirrorMeterReading), .min=0, .unbounded=1, .index=391, .n=3},
-  {.offset=offsetof(SE_MirrorUsagePoint_t,postRate), .min=0, .max=1, .bit=21, .type=ST_SIMPLE|XS_UINT, .n=2},
+  {.offset=offsetof(SE_MirrorUsagePoint_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2, .width=2},
+  {.offset=offsetof(SE_MirrorUsagePoint_t,mRID), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,16), .n=1, .width=1},
+  {.offset=offsetof(SE_MirrorUsagePoint_t,description), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|xs_type(XS_STRING,32), .n=3, .width=2},
+  {.offset=offsetof(SE_MirrorUsagePoint_t,version), .min=0, .max=1, .bit=2, .type=ST_SIMPLE|XS_USHORT, .n=2, .width=2},
+  {.offset=offsetof(SE_MirrorUsagePoint_t,roleFlags), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,2), .n=1, .width=1},
+  {.offset=offsetof(SE_MirrorUsagePoint_t,serviceCategoryKind), .min=1, .max=1, .type=ST_SIMPLE|XS_UBYTE, .n=1, .width=1},
+  {.offset=offsetof(SE_MirrorUsagePoint_t,status), .min=1, .max=1, .type=ST_SIMPLE|XS_UBYTE, .n=1, .width=1},
+  {.offset=offsetof(SE_MirrorUsagePoint_t,deviceLFDI), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,20), .n=1, .width=1},
+  {.offset=offsetof(SE_MirrorUsagePoint_t,MirrorMeterReading), .min=0, .unbounded=1, .index=391, .n=3, .width=2},
+  {.offset=offsetof(SE_MirrorUsagePoint_t,postRate), .min=0, .max=1, .bit=21, .type=ST_SIMPLE|XS_UINT, .n=2, .width=2},
   // List (420)
   {.size=sizeof(SE_List_t), .index=328},
-  {.offset=offsetof(SE_List_t,all), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1},
-  {.offset=offsetof(SE_List_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2},
-  {.offset=offsetof(SE_List_t,results), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1},
+  {.offset=offsetof(SE_List_t,all), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1, .width=1},
+  {.offset=offsetof(SE_List_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2, .width=2},
+  {.offset=offsetof(SE_List_t,results), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1, .width=1},
   // MirrorUsagePointList (424)
   {.size=sizeof(SE_MirrorUsagePointList_t), .index=420},
-  {.offset=offsetof(SE_MirrorUsagePointList_t,all), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1},
-  {.offset=offsetof(SE_MirrorUsagePointList_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=3},
-  {.offset=offsetof(SE_MirrorUsagePointList_t,pollRate), .min=0, .max=1, .attribute=1, .bit=18, .type=ST_SIMPLE|XS_UINT, .n=2},
-  {.offset=offsetof(SE_MirrorUsagePointList_t,results), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1},
-  {.offset=offsetof(SE_MirrorUsagePointList_t,MirrorUsagePoint), .min=0, .unbounded=1, .index=409, .n=2},
+  {.offset=offsetof(SE_MirrorUsagePointList_t,all), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1, .width=1},
+  {.offset=offsetof(SE_MirrorUsagePointList_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=3, .width=2},
+  {.offset=offsetof(SE_MirrorUsagePointList_t,pollRate), .min=0, .max=1, .attribute=1, .bit=18, .type=ST_SIMPLE|XS_UINT, .n=2, .width=2},
+  {.offset=offsetof(SE_MirrorUsagePointList_t,results), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1, .width=1},
+  {.offset=offsetof(SE_MirrorUsagePointList_t,MirrorUsagePoint), .min=0, .unbounded=1, .index=409, .n=2, .width=2},
   // MirrorMeterReadingList (430)
   {.size=sizeof(SE_MirrorMeterReadingList_t), .index=420},
-  {.offset=offsetof(SE_MirrorMeterReadingList_t,all), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1},
-  {.offset=offsetof(SE_MirrorMeterReadingList_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2},
-  {.offset=offsetof(SE_MirrorMeterReadingList_t,results), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1},
-  {.offset=offsetof(SE_MirrorMeterReadingList_t,MirrorMeterReading), .min=0, .unbounded=1, .index=391, .n=2},
+  {.offset=offsetof(SE_MirrorMeterReadingList_t,all), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1, .width=1},
+  {.offset=offsetof(SE_MirrorMeterReadingList_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2, .width=2},
+  {.offset=offsetof(SE_MirrorMeterReadingList_t,results), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1, .width=1},
+  {.offset=offsetof(SE_MirrorMeterReadingList_t,MirrorMeterReading), .min=0, .unbounded=1, .index=391, .n=2, .width=2},
   // Error (435)
   {.size=sizeof(SE_Error_t), .index=0},
-  {.offset=offsetof(SE_Error_t,maxRetryDuration), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|XS_USHORT, .n=2},
-  {.offset=offsetof(SE_Error_t,reasonCode), .min=1, .max=1, .type=ST_SIMPLE|XS_USHORT, .n=1},
+  {.offset=offsetof(SE_Error_t,maxRetryDuration), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|XS_USHORT, .n=2, .width=2},
+  {.offset=offsetof(SE_Error_t,reasonCode), .min=1, .max=1, .type=ST_SIMPLE|XS_USHORT, .n=1, .width=1},
   // RespondableResource (438)
   {.size=sizeof(SE_RespondableResource_t), .index=328},
-  {.offset=offsetof(SE_RespondableResource_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=4},
-  {.offset=offsetof(SE_RespondableResource_t,replyTo), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=3},
-  {.offset=offsetof(SE_RespondableResource_t,responseRequired), .min=0, .max=1, .attribute=1, .bit=4, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,1), .n=2},
+  {.offset=offsetof(SE_RespondableResource_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=4, .width=3},
+  {.offset=offsetof(SE_RespondableResource_t,replyTo), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=3, .width=2},
+  {.offset=offsetof(SE_RespondableResource_t,responseRequired), .min=0, .max=1, .attribute=1, .bit=4, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,1), .n=2, .width=2},
   // RespondableIdentifiedObject (442)
   {.size=sizeof(SE_RespondableIdentifiedObject_t), .index=438},
-  {.offset=offsetof(SE_RespondableIdentifiedObject_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=4},
-  {.offset=offsetof(SE_RespondableIdentifiedObject_t,replyTo), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=3},
-  {.offset=offsetof(SE_RespondableIdentifiedObject_t,responseRequired), .min=0, .max=1, .attribute=1, .bit=4, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,1), .n=2},
-  {.offset=offsetof(SE_RespondableIdentifiedObject_t,mRID), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,16), .n=1},
-  {.offset=offsetof(SE_RespondableIdentifiedObject_t,description), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|xs_type(XS_STRING,32), .n=3},
-  {.offset=offsetof(SE_RespondableIdentifiedObject_t,version), .min=0, .max=1, .bit=2, .type=ST_SIMPLE|XS_USHORT, .n=2},
+  {.offset=offsetof(SE_RespondableIdentifiedObject_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=4, .width=3},
+  {.offset=offsetof(SE_RespondableIdentifiedObject_t,replyTo), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=3, .width=2},
+  {.offset=offsetof(SE_RespondableIdentifiedObject_t,responseRequired), .min=0, .max=1, .attribute=1, .bit=4, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,1), .n=2, .width=2},
+  {.offset=offsetof(SE_RespondableIdentifiedObject_t,mRID), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,16), .n=1, .width=1},
+  {.offset=offsetof(SE_RespondableIdentifiedObject_t,description), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|xs_type(XS_STRING,32), .n=3, .width=2},
+  {.offset=offsetof(SE_RespondableIdentifiedObject_t,version), .min=0, .max=1, .bit=2, .type=ST_SIMPLE|XS_USHORT, .n=2, .width=2},
   // Link (449)
   {.size=sizeof(SE_Link_t), .index=0},
-  {.offset=offsetof(SE_Link_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1},
+  {.offset=offsetof(SE_Link_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1, .width=1},
   // ListLink (451)
   {.size=sizeof(SE_ListLink_t), .index=449},
-  {.offset=offsetof(SE_ListLink_t,all), .min=0, .max=1, .attribute=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=2},
-  {.offset=offsetof(SE_ListLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1},
+  {.offset=offsetof(SE_ListLink_t,all), .min=0, .max=1, .attribute=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=2, .width=2},
+  {.offset=offsetof(SE_ListLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1, .width=1},
   // NotificationListLink (454)
   {.size=sizeof(SE_NotificationListLink_t), .index=451},
-  {.offset=offsetof(SE_NotificationListLink_t,all), .min=0, .max=1, .attribute=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=2},
-  {.offset=offsetof(SE_NotificationListLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1},
+  {.offset=offsetof(SE_NotificationListLink_t,all), .min=0, .max=1, .attribute=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=2, .width=2},
+  {.offset=offsetof(SE_NotificationListLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1, .width=1},
   // MeterReadingLink (457)
   {.size=sizeof(SE_MeterReadingLink_t), .index=449},
-  {.offset=offsetof(SE_MeterReadingLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1},
+  {.offset=offsetof(SE_MeterReadingLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1, .width=1},
   // EndDeviceLink (459)
   {.size=sizeof(SE_EndDeviceLink_t), .index=449},
-  {.offset=offsetof(SE_EndDeviceLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1},
+  {.offset=offsetof(SE_EndDeviceLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1, .width=1},
   // DeviceCapabilityLink (461)
   {.size=sizeof(SE_DeviceCapabilityLink_t), .index=449},
-  {.offset=offsetof(SE_DeviceCapabilityLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1},
+  {.offset=offsetof(SE_DeviceCapabilityLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1, .width=1},
   // DERProgramLink (463)
   {.size=sizeof(SE_DERProgramLink_t), .index=449},
-  {.offset=offsetof(SE_DERProgramLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1},
+  {.offset=offsetof(SE_DERProgramLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1, .width=1},
   // DERLink (465)
   {.size=sizeof(SE_DERLink_t), .index=449},
-  {.offset=offsetof(SE_DERLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1},
+  {.offset=offsetof(SE_DERLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1, .width=1},
   // CustomerAccountLink (467)
   {.size=sizeof(SE_CustomerAccountLink_t), .index=449},
-  {.offset=offsetof(SE_CustomerAccountLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1},
+  {.offset=offsetof(SE_CustomerAccountLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1, .width=1},
   // ActiveFlowReservationListLink (469)
   {.size=sizeof(SE_ActiveFlowReservationListLink_t), .index=451},
-  {.offset=offsetof(SE_ActiveFlowReservationListLink_t,all), .min=0, .max=1, .attribute=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=2},
-  {.offset=offsetof(SE_ActiveFlowReservationListLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1},
+  {.offset=offsetof(SE_ActiveFlowReservationListLink_t,all), .min=0, .max=1, .attribute=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=2, .width=2},
+  {.offset=offsetof(SE_ActiveFlowReservationListLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1, .width=1},
   // UnsignedFixedPointType (472)
   {.size=sizeof(SE_UnsignedFixedPointType_t), .index=0},
-  {.offset=offsetof(SE_UnsignedFixedPointType_t,multiplier), .min=1, .max=1, .type=ST_SIMPLE|XS_BYTE, .n=1},
-  {.offset=offsetof(SE_UnsignedFixedPointType_t,value), .min=1, .max=1, .type=ST_SIMPLE|XS_USHORT, .n=1},
+  {.offset=offsetof(SE_UnsignedFixedPointType_t,multiplier), .min=1, .max=1, .type=ST_SIMPLE|XS_BYTE, .n=1, .width=1},
+  {.offset=offsetof(SE_UnsignedFixedPointType_t,value), .min=1, .max=1, .type=ST_SIMPLE|XS_USHORT, .n=1, .width=1},
   // FixedPointType (475)
   {.size=sizeof(SE_FixedPointType_t), .index=0},
-  {.offset=offsetof(SE_FixedPointType_t,multiplier), .min=1, .max=1, .type=ST_SIMPLE|XS_BYTE, .n=1},
-  {.offset=offsetof(SE_FixedPointType_t,value), .min=1, .max=1, .type=ST_SIMPLE|XS_SHORT, .n=1},
+  {.offset=offsetof(SE_FixedPointType_t,multiplier), .min=1, .max=1, .type=ST_SIMPLE|XS_BYTE, .n=1, .width=1},
+  {.offset=offsetof(SE_FixedPointType_t,value), .min=1, .max=1, .type=ST_SIMPLE|XS_SHORT, .n=1, .width=1},
   // StorageModeStatusType (478)
   {.size=sizeof(SE_StorageModeStatusType_t), .index=0},
-  {.offset=offsetof(SE_StorageModeStatusType_t,dateTime), .min=1, .max=1, .type=ST_SIMPLE|XS_LONG, .n=1},
-  {.offset=offsetof(SE_StorageModeStatusType_t,value), .min=1, .max=1, .type=ST_SIMPLE|XS_UBYTE, .n=1},
+  {.offset=offsetof(SE_StorageModeStatusType_t,dateTime), .min=1, .max=1, .type=ST_SIMPLE|XS_LONG, .n=1, .width=1},
+  {.offset=offsetof(SE_StorageModeStatusType_t,value), .min=1, .max=1, .type=ST_SIMPLE|XS_UBYTE, .n=1, .width=1},
   // StateOfChargeStatusType (481)
   {.size=sizeof(SE_StateOfChargeStatusType_t), .index=0},
-  {.offset=offsetof(SE_StateOfChargeStatusType_t,dateTime), .min=1, .max=1, .type=ST_SIMPLE|XS_LONG, .n=1},
-  {.offset=offsetof(SE_StateOfChargeStatusType_t,value), .min=1, .max=1, .type=ST_SIMPLE|XS_USHORT, .n=1},
+  {.offset=offsetof(SE_StateOfChargeStatusType_t,dateTime), .min=1, .max=1, .type=ST_SIMPLE|XS_LONG, .n=1, .width=1},
+  {.offset=offsetof(SE_StateOfChargeStatusType_t,value), .min=1, .max=1, .type=ST_SIMPLE|XS_USHORT, .n=1, .width=1},
   // OperationalModeStatusType (484)
   {.size=sizeof(SE_OperationalModeStatusType_t), .index=0},
-  {.offset=offsetof(SE_OperationalModeStatusType_t,dateTime), .min=1, .max=1, .type=ST_SIMPLE|XS_LONG, .n=1},
-  {.offset=offsetof(SE_OperationalModeStatusType_t,value), .min=1, .max=1, .type=ST_SIMPLE|XS_UBYTE, .n=1},
+  {.offset=offsetof(SE_OperationalModeStatusType_t,dateTime), .min=1, .max=1, .type=ST_SIMPLE|XS_LONG, .n=1, .width=1},
+  {.offset=offsetof(SE_OperationalModeStatusType_t,value), .min=1, .max=1, .type=ST_SIMPLE|XS_UBYTE, .n=1, .width=1},
   // ManufacturerStatusType (487)
   {.size=sizeof(SE_ManufacturerStatusType_t), .index=0},
-  {.offset=offsetof(SE_ManufacturerStatusType_t,dateTime), .min=1, .max=1, .type=ST_SIMPLE|XS_LONG, .n=1},
-  {.offset=offsetof(SE_ManufacturerStatusType_t,value), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_STRING,6), .n=1},
+  {.offset=offsetof(SE_ManufacturerStatusType_t,dateTime), .min=1, .max=1, .type=ST_SIMPLE|XS_LONG, .n=1, .width=1},
+  {.offset=offsetof(SE_ManufacturerStatusType_t,value), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_STRING,6), .n=1, .width=1},
   // LocalControlModeStatusType (490)
   {.size=sizeof(SE_LocalControlModeStatusType_t), .index=0},
-  {.offset=offsetof(SE_LocalControlModeStatusType_t,dateTime), .min=1, .max=1, .type=ST_SIMPLE|XS_LONG, .n=1},
-  {.offset=offsetof(SE_LocalControlModeStatusType_t,value), .min=1, .max=1, .type=ST_SIMPLE|XS_UBYTE, .n=1},
+  {.offset=offsetof(SE_LocalControlModeStatusType_t,dateTime), .min=1, .max=1, .type=ST_SIMPLE|XS_LONG, .n=1, .width=1},
+  {.offset=offsetof(SE_LocalControlModeStatusType_t,value), .min=1, .max=1, .type=ST_SIMPLE|XS_UBYTE, .n=1, .width=1},
   // InverterStatusType (493)
   {.size=sizeof(SE_InverterStatusType_t), .index=0},
-  {.offset=offsetof(SE_InverterStatusType_t,dateTime), .min=1, .max=1, .type=ST_SIMPLE|XS_LONG, .n=1},
-  {.offset=offsetof(SE_InverterStatusType_t,value), .min=1, .max=1, .type=ST_SIMPLE|XS_UBYTE, .n=1},
+  {.offset=offsetof(SE_InverterStatusType_t,dateTime), .min=1, .max=1, .type=ST_SIMPLE|XS_LONG, .n=1, .width=1},
+  {.offset=offsetof(SE_InverterStatusType_t,value), .min=1, .max=1, .type=ST_SIMPLE|XS_UBYTE, .n=1, .width=1},
   // ConnectStatusType (496)
   {.size=sizeof(SE_ConnectStatusType_t), .index=0},
-  {.offset=offsetof(SE_ConnectStatusType_t,dateTime), .min=1, .max=1, .type=ST_SIMPLE|XS_LONG, .n=1},
-  {.offset=offsetof(SE_ConnectStatusType_t,value), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,1), .n=1},
+  {.offset=offsetof(SE_ConnectStatusType_t,dateTime), .min=1, .max=1, .type=ST_SIMPLE|XS_LONG, .n=1, .width=1},
+  {.offset=offsetof(SE_ConnectStatusType_t,value), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,1), .n=1, .width=1},
   // SubscribableResource (499)
   {.size=sizeof(SE_SubscribableResource_t), .index=328},
-  {.offset=offsetof(SE_SubscribableResource_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=3},
-  {.offset=offsetof(SE_SubscribableResource_t,subscribable), .min=0, .max=1, .attribute=1, .bit=1, .type=ST_SIMPLE|XS_UBYTE, .n=2},
+  {.offset=offsetof(SE_SubscribableResource_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=3, .width=2},
+  {.offset=offsetof(SE_SubscribableResource_t,subscribable), .min=0, .max=1, .attribute=1, .bit=1, .type=ST_SIMPLE|XS_UBYTE, .n=2, .width=2},
   // DERStatus (502)
   {.size=sizeof(SE_DERStatus_t), .index=499},
-  {.offset=offsetof(SE_DERStatus_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=9},
-  {.offset=offsetof(SE_DERStatus_t,subscribable), .min=0, .max=1, .attribute=1, .bit=1, .type=ST_SIMPLE|XS_UBYTE, .n=8},
-  {.offset=offsetof(SE_DERStatus_t,alarmStatus), .min=0, .max=1, .bit=2, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,4), .n=7},
-  {.offset=offsetof(SE_DERStatus_t,genConnectStatus), .min=0, .max=1, .bit=3, .index=496, .n=6},
-  {.offset=offsetof(SE_DERStatus_t,inverterStatus), .min=0, .max=1, .bit=4, .index=493, .n=5},
-  {.offset=offsetof(SE_DERStatus_t,localControlModeStatus), .min=0, .max=1, .bit=5, .index=490, .n=4},
-  {.offset=offsetof(SE_DERStatus_t,manufacturerStatus), .min=0, .max=1, .bit=6, .index=487, .n=3},
-  {.offset=offsetof(SE_DERStatus_t,operationalModeStatus), .min=0, .max=1, .bit=7, .index=484, .n=2},
-  {.offset=offsetof(SE_DERStatus_t,readingTime), .min=1, .max=1, .type=ST_SIMPLE|XS_LONG, .n=1},
-  {.offset=offsetof(SE_DERStatus_t,stateOfChargeStatus), .min=0, .max=1, .bit=8, .index=481, .n=4},
-  {.offset=offsetof(SE_DERStatus_t,storageModeStatus), .min=0, .max=1, .bit=9, .index=478, .n=3},
-  {.offset=offsetof(SE_DERStatus_t,storConnectStatus), .min=0, .max=1, .bit=10, .index=496, .n=2},
+  {.offset=offsetof(SE_DERStatus_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=9, .width=4},
+  {.offset=offsetof(SE_DERStatus_t,subscribable), .min=0, .max=1, .attribute=1, .bit=1, .type=ST_SIMPLE|XS_UBYTE, .n=8, .width=4},
+  {.offset=offsetof(SE_DERStatus_t,alarmStatus), .min=0, .max=1, .bit=2, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,4), .n=7, .width=3},
+  {.offset=offsetof(SE_DERStatus_t,genConnectStatus), .min=0, .max=1, .bit=3, .index=496, .n=6, .width=3},
+  {.offset=offsetof(SE_DERStatus_t,inverterStatus), .min=0, .max=1, .bit=4, .index=493, .n=5, .width=3},
+  {.offset=offsetof(SE_DERStatus_t,localControlModeStatus), .min=0, .max=1, .bit=5, .index=490, .n=4, .width=3},
+  {.offset=offsetof(SE_DERStatus_t,manufacturerStatus), .min=0, .max=1, .bit=6, .index=487, .n=3, .width=2},
+  {.offset=offsetof(SE_DERStatus_t,operationalModeStatus), .min=0, .max=1, .bit=7, .index=484, .n=2, .width=2},
+  {.offset=offsetof(SE_DERStatus_t,readingTime), .min=1, .max=1, .type=ST_SIMPLE|XS_LONG, .n=1, .width=1},
+  {.offset=offsetof(SE_DERStatus_t,stateOfChargeStatus), .min=0, .max=1, .bit=8, .index=481, .n=4, .width=3},
+  {.offset=offsetof(SE_DERStatus_t,storageModeStatus), .min=0, .max=1, .bit=9, .index=478, .n=3, .width=2},
+  {.offset=offsetof(SE_DERStatus_t,storConnectStatus), .min=0, .max=1, .bit=10, .index=496, .n=2, .width=2},
   // DERCurveListLink (515)
   {.size=sizeof(SE_DERCurveListLink_t), .index=451},
-  {.offset=offsetof(SE_DERCurveListLink_t,all), .min=0, .max=1, .attribute=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=2},
-  {.offset=offsetof(SE_DERCurveListLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1},
+  {.offset=offsetof(SE_DERCurveListLink_t,all), .min=0, .max=1, .attribute=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=2, .width=2},
+  {.offset=offsetof(SE_DERCurveListLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1, .width=1},
   // DERControlListLink (518)
   {.size=sizeof(SE_DERControlListLink_t), .index=451},
-  {.offset=offsetof(SE_DERControlListLink_t,all), .min=0, .max=1, .attribute=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=2},
-  {.offset=offsetof(SE_DERControlListLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1},
+  {.offset=offsetof(SE_DERControlListLink_t,all), .min=0, .max=1, .attribute=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=2, .width=2},
+  {.offset=offsetof(SE_DERControlListLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1, .width=1},
   // DefaultDERControlLink (521)
   {.size=sizeof(SE_DefaultDERControlLink_t), .index=449},
-  {.offset=offsetof(SE_DefaultDERControlLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1},
+  {.offset=offsetof(SE_DefaultDERControlLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1, .width=1},
   // ActiveDERControlListLink (523)
   {.size=sizeof(SE_ActiveDERControlListLink_t), .index=451},
-  {.offset=offsetof(SE_ActiveDERControlListLink_t,all), .min=0, .max=1, .attribute=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=2},
-  {.offset=offsetof(SE_ActiveDERControlListLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1},
+  {.offset=offsetof(SE_ActiveDERControlListLink_t,all), .min=0, .max=1, .attribute=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=2, .width=2},
+  {.offset=offsetof(SE_ActiveDERControlListLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1, .width=1},
   // SubscribableIdentifiedObject (526)
   {.size=sizeof(SE_SubscribableIdentifiedObject_t), .index=499},
-  {.offset=offsetof(SE_SubscribableIdentifiedObject_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=3},
-  {.offset=offsetof(SE_SubscribableIdentifiedObject_t,subscribable), .min=0, .max=1, .attribute=1, .bit=1, .type=ST_SIMPLE|XS_UBYTE, .n=2},
-  {.offset=offsetof(SE_SubscribableIdentifiedObject_t,mRID), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,16), .n=1},
-  {.offset=offsetof(SE_SubscribableIdentifiedObject_t,description), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|xs_type(XS_STRING,32), .n=3},
-  {.offset=offsetof(SE_SubscribableIdentifiedObject_t,version), .min=0, .max=1, .bit=2, .type=ST_SIMPLE|XS_USHORT, .n=2},
+  {.offset=offsetof(SE_SubscribableIdentifiedObject_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=3, .width=2},
+  {.offset=offsetof(SE_SubscribableIdentifiedObject_t,subscribable), .min=0, .max=1, .attribute=1, .bit=1, .type=ST_SIMPLE|XS_UBYTE, .n=2, .width=2},
+  {.offset=offsetof(SE_SubscribableIdentifiedObject_t,mRID), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,16), .n=1, .width=1},
+  {.offset=offsetof(SE_SubscribableIdentifiedObject_t,description), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|xs_type(XS_STRING,32), .n=3, .width=2},
+  {.offset=offsetof(SE_SubscribableIdentifiedObject_t,version), .min=0, .max=1, .bit=2, .type=ST_SIMPLE|XS_USHORT, .n=2, .width=2},
   // DERProgram (532)
   {.size=sizeof(SE_DERProgram_t), .index=526},
-  {.offset=offsetof(SE_DERProgram_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=3},
-  {.offset=offsetof(SE_DERProgram_t,subscribable), .min=0, .max=1, .attribute=1, .bit=1, .type=ST_SIMPLE|XS_UBYTE, .n=2},
-  {.offset=offsetof(SE_DERProgram_t,mRID), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,16), .n=1},
-  {.offset=offsetof(SE_DERProgram_t,description), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|xs_type(XS_STRING,32), .n=7},
-  {.offset=offsetof(SE_DERProgram_t,version), .min=0, .max=1, .bit=2, .type=ST_SIMPLE|XS_USHORT, .n=6},
-  {.offset=offsetof(SE_DERProgram_t,ActiveDERControlListLink), .min=0, .max=1, .bit=3, .index=523, .n=5},
-  {.offset=offsetof(SE_DERProgram_t,DefaultDERControlLink), .min=0, .max=1, .bit=4, .index=521, .n=4},
-  {.offset=offsetof(SE_DERProgram_t,DERControlListLink), .min=0, .max=1, .bit=5, .index=518, .n=3},
-  {.offset=offsetof(SE_DERProgram_t,DERCurveListLink), .min=0, .max=1, .bit=6, .index=515, .n=2},
-  {.offset=offsetof(SE_DERProgram_t,primacy), .min=1, .max=1, .type=ST_SIMPLE|XS_UBYTE, .n=1},
+  {.offset=offsetof(SE_DERProgram_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=3, .width=2},
+  {.offset=offsetof(SE_DERProgram_t,subscribable), .min=0, .max=1, .attribute=1, .bit=1, .type=ST_SIMPLE|XS_UBYTE, .n=2, .width=2},
+  {.offset=offsetof(SE_DERProgram_t,mRID), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,16), .n=1, .width=1},
+  {.offset=offsetof(SE_DERProgram_t,description), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|xs_type(XS_STRING,32), .n=7, .width=3},
+  {.offset=offsetof(SE_DERProgram_t,version), .min=0, .max=1, .bit=2, .type=ST_SIMPLE|XS_USHORT, .n=6, .width=3},
+  {.offset=offsetof(SE_DERProgram_t,ActiveDERControlListLink), .min=0, .max=1, .bit=3, .index=523, .n=5, .width=3},
+  {.offset=offsetof(SE_DERProgram_t,DefaultDERControlLink), .min=0, .max=1, .bit=4, .index=521, .n=4, .width=3},
+  {.offset=offsetof(SE_DERProgram_t,DERControlListLink), .min=0, .max=1, .bit=5, .index=518, .n=3, .width=2},
+  {.offset=offsetof(SE_DERProgram_t,DERCurveListLink), .min=0, .max=1, .bit=6, .index=515, .n=2, .width=2},
+  {.offset=offsetof(SE_DERProgram_t,primacy), .min=1, .max=1, .type=ST_SIMPLE|XS_UBYTE, .n=1, .width=1},
   // SubscribableList (543)
   {.size=sizeof(SE_SubscribableList_t), .index=499},
-  {.offset=offsetof(SE_SubscribableList_t,all), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1},
-  {.offset=offsetof(SE_SubscribableList_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2},
-  {.offset=offsetof(SE_SubscribableList_t,results), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1},
-  {.offset=offsetof(SE_SubscribableList_t,subscribable), .min=0, .max=1, .attribute=1, .bit=1, .type=ST_SIMPLE|XS_UBYTE, .n=2},
+  {.offset=offsetof(SE_SubscribableList_t,all), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1, .width=1},
+  {.offset=offsetof(SE_SubscribableList_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2, .width=2},
+  {.offset=offsetof(SE_SubscribableList_t,results), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1, .width=1},
+  {.offset=offsetof(SE_SubscribableList_t,subscribable), .min=0, .max=1, .attribute=1, .bit=1, .type=ST_SIMPLE|XS_UBYTE, .n=2, .width=2},
   // DERProgramList (548)
   {.size=sizeof(SE_DERProgramList_t), .index=543},
-  {.offset=offsetof(SE_DERProgramList_t,all), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1},
-  {.offset=offsetof(SE_DERProgramList_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=3},
-  {.offset=offsetof(SE_DERProgramList_t,pollRate), .min=0, .max=1, .attribute=1, .bit=18, .type=ST_SIMPLE|XS_UINT, .n=2},
-  {.offset=offsetof(SE_DERProgramList_t,results), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1},
-  {.offset=offsetof(SE_DERProgramList_t,subscribable), .min=0, .max=1, .attribute=1, .bit=1, .type=ST_SIMPLE|XS_UBYTE, .n=3},
-  {.offset=offsetof(SE_DERProgramList_t,DERProgram), .min=0, .unbounded=1, .index=532, .n=2},
+  {.offset=offsetof(SE_DERProgramList_t,all), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1, .width=1},
+  {.offset=offsetof(SE_DERProgramList_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=3, .width=2},
+  {.offset=offsetof(SE_DERProgramList_t,pollRate), .min=0, .max=1, .attribute=1, .bit=18, .type=ST_SIMPLE|XS_UINT, .n=2, .width=2},
+  {.offset=offsetof(SE_DERProgramList_t,results), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1, .width=1},
+  {.offset=offsetof(SE_DERProgramList_t,subscribable), .min=0, .max=1, .attribute=1, .bit=1, .type=ST_SIMPLE|XS_UBYTE, .n=3, .width=2},
+  {.offset=offsetof(SE_DERProgramList_t,DERProgram), .min=0, .unbounded=1, .index=532, .n=2, .width=2},
   // CurveData (555)
   {.size=sizeof(SE_CurveData_t), .index=0},
-  {.min=0, .max=1, .bit=0, .type=ST_SIMPLE|XS_BOOLEAN, .n=2},
-  {.offset=offsetof(SE_CurveData_t,xvalue), .min=1, .max=1, .type=ST_SIMPLE|XS_INT, .n=1},
-  {.offset=offsetof(SE_CurveData_t,yvalue), .min=1, .max=1, .type=ST_SIMPLE|XS_INT, .n=1},
+  {.min=0, .max=1, .bit=0, .type=ST_SIMPLE|XS_BOOLEAN, .n=2, .width=2},
+  {.offset=offsetof(SE_CurveData_t,xvalue), .min=1, .max=1, .type=ST_SIMPLE|XS_INT, .n=1, .width=1},
+  {.offset=offsetof(SE_CurveData_t,yvalue), .min=1, .max=1, .type=ST_SIMPLE|XS_INT, .n=1, .width=1},
   // DERCurve (559)
   {.size=sizeof(SE_DERCurve_t), .index=368},
-  {.offset=offsetof(SE_DERCurve_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2},
-  {.offset=offsetof(SE_DERCurve_t,mRID), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,16), .n=1},
-  {.offset=offsetof(SE_DERCurve_t,description), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|xs_type(XS_STRING,32), .n=5},
-  {.offset=offsetof(SE_DERCurve_t,version), .min=0, .max=1, .bit=2, .type=ST_SIMPLE|XS_USHORT, .n=4},
-  {.min=0, .max=1, .bit=3, .type=ST_SIMPLE|XS_BOOLEAN, .n=3},
-  {.offset=offsetof(SE_DERCurve_t,autonomousVRefTimeConstant), .min=0, .max=1, .bit=5, .type=ST_SIMPLE|XS_UINT, .n=2},
-  {.offset=offsetof(SE_DERCurve_t,creationTime), .min=1, .max=1, .type=ST_SIMPLE|XS_LONG, .n=1},
-  {.offset=offsetof(SE_DERCurve_t,CurveData), .min=1, .max=10, .bit=6, .index=555, .n=2},
-  {.offset=offsetof(SE_DERCurve_t,curveType), .min=1, .max=1, .type=ST_SIMPLE|XS_UBYTE, .n=1},
-  {.offset=offsetof(SE_DERCurve_t,openLoopTms), .min=0, .max=1, .bit=10, .type=ST_SIMPLE|XS_USHORT, .n=6},
-  {.offset=offsetof(SE_DERCurve_t,rampDecTms), .min=0, .max=1, .bit=11, .type=ST_SIMPLE|XS_USHORT, .n=5},
-  {.offset=offsetof(SE_DERCurve_t,rampIncTms), .min=0, .max=1, .bit=12, .type=ST_SIMPLE|XS_USHORT, .n=4},
-  {.offset=offsetof(SE_DERCurve_t,rampPT1Tms), .min=0, .max=1, .bit=13, .type=ST_SIMPLE|XS_USHORT, .n=3},
-  {.offset=offsetof(SE_DERCurve_t,vRef), .min=0, .max=1, .bit=14, .type=ST_SIMPLE|XS_USHORT, .n=2},
-  {.offset=offsetof(SE_DERCurve_t,xMultiplier), .min=1, .max=1, .type=ST_SIMPLE|XS_BYTE, .n=1},
-  {.offset=offsetof(SE_DERCurve_t,yMultiplier), .min=1, .max=1, .type=ST_SIMPLE|XS_BYTE, .n=1},
-  {.offset=offsetof(SE_DERCurve_t,yRefType), .min=1, .max=1, .type=ST_SIMPLE|XS_UBYTE, .n=1},
+  {.offset=offsetof(SE_DERCurve_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2, .width=2},
+  {.offset=offsetof(SE_DERCurve_t,mRID), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,16), .n=1, .width=1},
+  {.offset=offsetof(SE_DERCurve_t,description), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|xs_type(XS_STRING,32), .n=5, .width=3},
+  {.offset=offsetof(SE_DERCurve_t,version), .min=0, .max=1, .bit=2, .type=ST_SIMPLE|XS_USHORT, .n=4, .width=3},
+  {.min=0, .max=1, .bit=3, .type=ST_SIMPLE|XS_BOOLEAN, .n=3, .width=2},
+  {.offset=offsetof(SE_DERCurve_t,autonomousVRefTimeConstant), .min=0, .max=1, .bit=5, .type=ST_SIMPLE|XS_UINT, .n=2, .width=2},
+  {.offset=offsetof(SE_DERCurve_t,creationTime), .min=1, .max=1, .type=ST_SIMPLE|XS_LONG, .n=1, .width=1},
+  {.offset=offsetof(SE_DERCurve_t,CurveData), .min=1, .max=10, .bit=6, .index=555, .n=2, .width=2},
+  {.offset=offsetof(SE_DERCurve_t,curveType), .min=1, .max=1, .type=ST_SIMPLE|XS_UBYTE, .n=1, .width=1},
+  {.offset=offsetof(SE_DERCurve_t,openLoopTms), .min=0, .max=1, .bit=10, .type=ST_SIMPLE|XS_USHORT, .n=6, .width=3},
+  {.offset=offsetof(SE_DERCurve_t,rampDecTms), .min=0, .max=1, .bit=11, .type=ST_SIMPLE|XS_USHORT, .n=5, .width=3},
+  {.offset=offsetof(SE_DERCurve_t,rampIncTms), .min=0, .max=1, .bit=12, .type=ST_SIMPLE|XS_USHORT, .n=4, .width=3},
+  {.offset=offsetof(SE_DERCurve_t,rampPT1Tms), .min=0, .max=1, .bit=13, .type=ST_SIMPLE|XS_USHORT, .n=3, .width=2},
+  {.offset=offsetof(SE_DERCurve_t,vRef), .min=0, .max=1, .bit=14, .type=ST_SIMPLE|XS_USHORT, .n=2, .width=2},
+  {.offset=offsetof(SE_DERCurve_t,xMultiplier), .min=1, .max=1, .type=ST_SIMPLE|XS_BYTE, .n=1, .width=1},
+  {.offset=offsetof(SE_DERCurve_t,yMultiplier), .min=1, .max=1, .type=ST_SIMPLE|XS_BYTE, .n=1, .width=1},
+  {.offset=offsetof(SE_DERCurve_t,yRefType), .min=1, .max=1, .type=ST_SIMPLE|XS_UBYTE, .n=1, .width=1},
   // DERCurveList (577)
   {.size=sizeof(SE_DERCurveList_t), .index=420},
-  {.offset=offsetof(SE_DERCurveList_t,all), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1},
-  {.offset=offsetof(SE_DERCurveList_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2},
-  {.offset=offsetof(SE_DERCurveList_t,results), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1},
-  {.offset=offsetof(SE_DERCurveList_t,DERCurve), .min=0, .unbounded=1, .index=559, .n=2},
+  {.offset=offsetof(SE_DERCurveList_t,all), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1, .width=1},
+  {.offset=offsetof(SE_DERCurveList_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2, .width=2},
+  {.offset=offsetof(SE_DERCurveList_t,results), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1, .width=1},
+  {.offset=offsetof(SE_DERCurveList_t,DERCurve), .min=0, .unbounded=1, .index=559, .n=2, .width=2},
   // ActivePower (582)
   {.size=sizeof(SE_ActivePower_t), .index=0},
-  {.offset=offsetof(SE_ActivePower_t,multiplier), .min=1, .max=1, .type=ST_SIMPLE|XS_BYTE, .n=1},
-  {.offset=offsetof(SE_ActivePower_t,value), .min=1, .max=1, .type=ST_SIMPLE|XS_SHORT, .n=1},
+  {.offset=offsetof(SE_ActivePower_t,multiplier), .min=1, .max=1, .type=ST_SIMPLE|XS_BYTE, .n=1, .width=1},
+  {.offset=offsetof(SE_ActivePower_t,value), .min=1, .max=1, .type=ST_SIMPLE|XS_SHORT, .n=1, .width=1},
   // ReactivePower (585)
   {.size=sizeof(SE_ReactivePower_t), .index=0},
-  {.offset=offsetof(SE_ReactivePower_t,multiplier), .min=1, .max=1, .type=ST_SIMPLE|XS_BYTE, .n=1},
-  {.offset=offsetof(SE_ReactivePower_t,value), .min=1, .max=1, .type=ST_SIMPLE|XS_SHORT, .n=1},
+  {.offset=offsetof(SE_ReactivePower_t,multiplier), .min=1, .max=1, .type=ST_SIMPLE|XS_BYTE, .n=1, .width=1},
+  {.offset=offsetof(SE_ReactivePower_t,value), .min=1, .max=1, .type=ST_SIMPLE|XS_SHORT, .n=1, .width=1},
   // DERCurveLink (588)
   {.size=sizeof(SE_DERCurveLink_t), .index=449},
-  {.offset=offsetof(SE_DERCurveLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1},
+  {.offset=offsetof(SE_DERCurveLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1, .width=1},
   // FreqDroopType (590)
   {.size=sizeof(SE_FreqDroopType_t), .index=0},
-  {.offset=offsetof(SE_FreqDroopType_t,dBOF), .min=1, .max=1, .type=ST_SIMPLE|XS_UINT, .n=1},
-  {.offset=offsetof(SE_FreqDroopType_t,dBUF), .min=1, .max=1, .type=ST_SIMPLE|XS_UINT, .n=1},
-  {.offset=offsetof(SE_FreqDroopType_t,kOF), .min=1, .max=1, .type=ST_SIMPLE|XS_USHORT, .n=1},
-  {.offset=offsetof(SE_FreqDroopType_t,kUF), .min=1, .max=1, .type=ST_SIMPLE|XS_USHORT, .n=1},
-  {.offset=offsetof(SE_FreqDroopType_t,openLoopTms), .min=1, .max=1, .type=ST_SIMPLE|XS_USHORT, .n=1},
+  {.offset=offsetof(SE_FreqDroopType_t,dBOF), .min=1, .max=1, .type=ST_SIMPLE|XS_UINT, .n=1, .width=1},
+  {.offset=offsetof(SE_FreqDroopType_t,dBUF), .min=1, .max=1, .type=ST_SIMPLE|XS_UINT, .n=1, .width=1},
+  {.offset=offsetof(SE_FreqDroopType_t,kOF), .min=1, .max=1, .type=ST_SIMPLE|XS_USHORT, .n=1, .width=1},
+  {.offset=offsetof(SE_FreqDroopType_t,kUF), .min=1, .max=1, .type=ST_SIMPLE|XS_USHORT, .n=1, .width=1},
+  {.offset=offsetof(SE_FreqDroopType_t,openLoopTms), .min=1, .max=1, .type=ST_SIMPLE|XS_USHORT, .n=1, .width=1},
   // FixedVar (596)
   {.size=sizeof(SE_FixedVar_t), .index=0},
-  {.offset=offsetof(SE_FixedVar_t,refType), .min=1, .max=1, .type=ST_SIMPLE|XS_UBYTE, .n=1},
-  {.offset=offsetof(SE_FixedVar_t,value), .min=1, .max=1, .type=ST_SIMPLE|XS_SHORT, .n=1},
+  {.offset=offsetof(SE_FixedVar_t,refType), .min=1, .max=1, .type=ST_SIMPLE|XS_UBYTE, .n=1, .width=1},
+  {.offset=offsetof(SE_FixedVar_t,value), .min=1, .max=1, .type=ST_SIMPLE|XS_SHORT, .n=1, .width=1},
   // PowerFactorWithExcitation (599)
   {.size=sizeof(SE_PowerFactorWithExcitation_t), .index=0},
-  {.offset=offsetof(SE_PowerFactorWithExcitation_t,displacement), .min=1, .max=1, .type=ST_SIMPLE|XS_USHORT, .n=1},
-  {.min=1, .max=1, .bit=0, .type=ST_SIMPLE|XS_BOOLEAN, .n=1},
-  {.offset=offsetof(SE_PowerFactorWithExcitation_t,multiplier), .min=1, .max=1, .type=ST_SIMPLE|XS_BYTE, .n=1},
+  {.offset=offsetof(SE_PowerFactorWithExcitation_t,displacement), .min=1, .max=1, .type=ST_SIMPLE|XS_USHORT, .n=1, .width=1},
+  {.min=1, .max=1, .bit=0, .type=ST_SIMPLE|XS_BOOLEAN, .n=1, .width=1},
+  {.offset=offsetof(SE_PowerFactorWithExcitation_t,multiplier), .min=1, .max=1, .type=ST_SIMPLE|XS_BYTE, .n=1, .width=1},
   // DERControlBase (603)
   {.size=sizeof(SE_DERControlBase_t), .index=0},
-  {.min=0, .max=1, .bit=0, .type=ST_SIMPLE|XS_BOOLEAN, .n=27},
-  {.min=0, .max=1, .bit=2, .type=ST_SIMPLE|XS_BOOLEAN, .n=26},
-  {.offset=offsetof(SE_DERControlBase_t,opModFixedPFAbsorbW), .min=0, .max=1, .bit=4, .index=599, .n=25},
-  {.offset=offsetof(SE_DERControlBase_t,opModFixedPFInjectW), .min=0, .max=1, .bit=5, .index=599, .n=24},
-  {.offset=offsetof(SE_DERControlBase_t,opModFixedVar), .min=0, .max=1, .bit=6, .index=596, .n=23},
-  {.offset=offsetof(SE_DERControlBase_t,opModFixedW), .min=0, .max=1, .bit=7, .type=ST_SIMPLE|XS_SHORT, .n=22},
-  {.offset=offsetof(SE_DERControlBase_t,opModFreqDroop), .min=0, .max=1, .bit=8, .index=590, .n=21},
-  {.offset=offsetof(SE_DERControlBase_t,opModFreqWatt), .min=0, .max=1, .bit=9, .index=588, .n=20},
-  {.offset=offsetof(SE_DERControlBase_t,opModHFRTMayTrip), .min=0, .max=1, .bit=10, .index=588, .n=19},
-  {.offset=offsetof(SE_DERControlBase_t,opModHFRTMustTrip), .min=0, .max=1, .bit=11, .index=588, .n=18},
-  {.offset=offsetof(SE_DERControlBase_t,opModHVRTMayTrip), .min=0, .max=1, .bit=12, .index=588, .n=17},
-  {.offset=offsetof(SE_DERControlBase_t,opModHVRTMomentaryCessation), .min=0, .max=1, .bit=13, .index=588, .n=16},
-  {.offset=offsetof(SE_DERControlBase_t,opModHVRTMustTrip), .min=0, .max=1, .bit=14, .index=588, .n=15},
-  {.offset=offsetof(SE_DERControlBase_t,opModLFRTMayTrip), .min=0, .max=1, .bit=15, .index=588, .n=14},
-  {.offset=offsetof(SE_DERControlBase_t,opModLFRTMustTrip), .min=0, .max=1, .bit=16, .index=588, .n=13},
-  {.offset=offsetof(SE_DERControlBase_t,opModLVRTMayTrip), .min=0, .max=1, .bit=17, .index=588, .n=12},
-  {.offset=offsetof(SE_DERControlBase_t,opModLVRTMomentaryCessation), .min=0, .max=1, .bit=18, .index=588, .n=11},
-  {.offset=offsetof(SE_DERControlBase_t,opModLVRTMustTrip), .min=0, .max=1, .bit=19, .index=588, .n=10},
-  {.offset=offsetof(SE_DERControlBase_t,opModMaxLimW), .min=0, .max=1, .bit=20, .type=ST_SIMPLE|XS_USHORT, .n=9},
-  {.offset=offsetof(SE_DERControlBase_t,opModTargetVar), .min=0, .max=1, .bit=21, .index=585, .n=8},
-  {.offset=offsetof(SE_DERControlBase_t,opModTargetW), .min=0, .max=1, .bit=22, .index=582, .n=7},
-  {.offset=offsetof(SE_DERControlBase_t,opModVoltVar), .min=0, .max=1, .bit=23, .index=588, .n=6},
-  {.offset=offsetof(SE_DERControlBase_t,opModVoltWatt), .min=0, .max=1, .bit=24, .index=588, .n=5},
-  {.offset=offsetof(SE_DERControlBase_t,opModWattPF), .min=0, .max=1, .bit=25, .index=588, .n=4},
-  {.offset=offsetof(SE_DERControlBase_t,opModWattVar), .min=0, .max=1, .bit=26, .index=588, .n=3},
-  {.offset=offsetof(SE_DERControlBase_t,rampTms), .min=0, .max=1, .bit=27, .type=ST_SIMPLE|XS_USHORT, .n=2},
+  {.min=0, .max=1, .bit=0, .type=ST_SIMPLE|XS_BOOLEAN, .n=27, .width=5},
+  {.min=0, .max=1, .bit=2, .type=ST_SIMPLE|XS_BOOLEAN, .n=26, .width=5},
+  {.offset=offsetof(SE_DERControlBase_t,opModFixedPFAbsorbW), .min=0, .max=1, .bit=4, .index=599, .n=25, .width=5},
+  {.offset=offsetof(SE_DERControlBase_t,opModFixedPFInjectW), .min=0, .max=1, .bit=5, .index=599, .n=24, .width=5},
+  {.offset=offsetof(SE_DERControlBase_t,opModFixedVar), .min=0, .max=1, .bit=6, .index=596, .n=23, .width=5},
+  {.offset=offsetof(SE_DERControlBase_t,opModFixedW), .min=0, .max=1, .bit=7, .type=ST_SIMPLE|XS_SHORT, .n=22, .width=5},
+  {.offset=offsetof(SE_DERControlBase_t,opModFreqDroop), .min=0, .max=1, .bit=8, .index=590, .n=21, .width=5},
+  {.offset=offsetof(SE_DERControlBase_t,opModFreqWatt), .min=0, .max=1, .bit=9, .index=588, .n=20, .width=5},
+  {.offset=offsetof(SE_DERControlBase_t,opModHFRTMayTrip), .min=0, .max=1, .bit=10, .index=588, .n=19, .width=5},
+  {.offset=offsetof(SE_DERControlBase_t,opModHFRTMustTrip), .min=0, .max=1, .bit=11, .index=588, .n=18, .width=5},
+  {.offset=offsetof(SE_DERControlBase_t,opModHVRTMayTrip), .min=0, .max=1, .bit=12, .index=588, .n=17, .width=5},
+  {.offset=offsetof(SE_DERControlBase_t,opModHVRTMomentaryCessation), .min=0, .max=1, .bit=13, .index=588, .n=16, .width=5},
+  {.offset=offsetof(SE_DERControlBase_t,opModHVRTMustTrip), .min=0, .max=1, .bit=14, .index=588, .n=15, .width=4},
+  {.offset=offsetof(SE_DERControlBase_t,opModLFRTMayTrip), .min=0, .max=1, .bit=15, .index=588, .n=14, .width=4},
+  {.offset=offsetof(SE_DERControlBase_t,opModLFRTMustTrip), .min=0, .max=1, .bit=16, .index=588, .n=13, .width=4},
+  {.offset=offsetof(SE_DERControlBase_t,opModLVRTMayTrip), .min=0, .max=1, .bit=17, .index=588, .n=12, .width=4},
+  {.offset=offsetof(SE_DERControlBase_t,opModLVRTMomentaryCessation), .min=0, .max=1, .bit=18, .index=588, .n=11, .width=4},
+  {.offset=offsetof(SE_DERControlBase_t,opModLVRTMustTrip), .min=0, .max=1, .bit=19, .index=588, .n=10, .width=4},
+  {.offset=offsetof(SE_DERControlBase_t,opModMaxLimW), .min=0, .max=1, .bit=20, .type=ST_SIMPLE|XS_USHORT, .n=9, .width=4},
+  {.offset=offsetof(SE_DERControlBase_t,opModTargetVar), .min=0, .max=1, .bit=21, .index=585, .n=8, .width=4},
+  {.offset=offsetof(SE_DERControlBase_t,opModTargetW), .min=0, .max=1, .bit=22, .index=582, .n=7, .width=3},
+  {.offset=offsetof(SE_DERControlBase_t,opModVoltVar), .min=0, .max=1, .bit=23, .index=588, .n=6, .width=3},
+  {.offset=offsetof(SE_DERControlBase_t,opModVoltWatt), .min=0, .max=1, .bit=24, .index=588, .n=5, .width=3},
+  {.offset=offsetof(SE_DERControlBase_t,opModWattPF), .min=0, .max=1, .bit=25, .index=588, .n=4, .width=3},
+  {.offset=offsetof(SE_DERControlBase_t,opModWattVar), .min=0, .max=1, .bit=26, .index=588, .n=3, .width=2},
+  {.offset=offsetof(SE_DERControlBase_t,rampTms), .min=0, .max=1, .bit=27, .type=ST_SIMPLE|XS_USHORT, .n=2, .width=2},
   // EventStatus (630)
   {.size=sizeof(SE_EventStatus_t), .index=0},
-  {.offset=offsetof(SE_EventStatus_t,currentStatus), .min=1, .max=1, .type=ST_SIMPLE|XS_UBYTE, .n=1},
-  {.offset=offsetof(SE_EventStatus_t,dateTime), .min=1, .max=1, .type=ST_SIMPLE|XS_LONG, .n=1},
-  {.min=1, .max=1, .bit=0, .type=ST_SIMPLE|XS_BOOLEAN, .n=1},
-  {.offset=offsetof(SE_EventStatus_t,potentiallySupersededTime), .min=0, .max=1, .bit=1, .type=ST_SIMPLE|XS_LONG, .n=3},
-  {.offset=offsetof(SE_EventStatus_t,reason), .min=0, .max=1, .bit=2, .type=ST_SIMPLE|xs_type(XS_STRING,192), .n=2},
+  {.offset=offsetof(SE_EventStatus_t,currentStatus), .min=1, .max=1, .type=ST_SIMPLE|XS_UBYTE, .n=1, .width=1},
+  {.offset=offsetof(SE_EventStatus_t,dateTime), .min=1, .max=1, .type=ST_SIMPLE|XS_LONG, .n=1, .width=1},
+  {.min=1, .max=1, .bit=0, .type=ST_SIMPLE|XS_BOOLEAN, .n=1, .width=1},
+  {.offset=offsetof(SE_EventStatus_t,potentiallySupersededTime), .min=0, .max=1, .bit=1, .type=ST_SIMPLE|XS_LONG, .n=3, .width=2},
+  {.offset=offsetof(SE_EventStatus_t,reason), .min=0, .max=1, .bit=2, .type=ST_SIMPLE|xs_type(XS_STRING,192), .n=2, .width=2},
   // RespondableSubscribableIdentifiedObject (636)
   {.size=sizeof(SE_RespondableSubscribableIdentifiedObject_t), .index=438},
-  {.offset=offsetof(SE_RespondableSubscribableIdentifiedObject_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=5},
-  {.offset=offsetof(SE_RespondableSubscribableIdentifiedObject_t,replyTo), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=4},
-  {.offset=offsetof(SE_RespondableSubscribableIdentifiedObject_t,responseRequired), .min=0, .max=1, .attribute=1, .bit=4, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,1), .n=3},
-  {.offset=offsetof(SE_RespondableSubscribableIdentifiedObject_t,subscribable), .min=0, .max=1, .attribute=1, .bit=1, .type=ST_SIMPLE|XS_UBYTE, .n=2},
-  {.offset=offsetof(SE_RespondableSubscribableIdentifiedObject_t,mRID), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,16), .n=1},
-  {.offset=offsetof(SE_RespondableSubscribableIdentifiedObject_t,description), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|xs_type(XS_STRING,32), .n=3},
-  {.offset=offsetof(SE_RespondableSubscribableIdentifiedObject_t,version), .min=0, .max=1, .bit=2, .type=ST_SIMPLE|XS_USHORT, .n=2},
+  {.offset=offsetof(SE_RespondableSubscribableIdentifiedObject_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=5, .width=3},
+  {.offset=offsetof(SE_RespondableSubscribableIdentifiedObject_t,replyTo), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=4, .width=3},
+  {.offset=offsetof(SE_RespondableSubscribableIdentifiedObject_t,responseRequired), .min=0, .max=1, .attribute=1, .bit=4, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,1), .n=3, .width=2},
+  {.offset=offsetof(SE_RespondableSubscribableIdentifiedObject_t,subscribable), .min=0, .max=1, .attribute=1, .bit=1, .type=ST_SIMPLE|XS_UBYTE, .n=2, .width=2},
+  {.offset=offsetof(SE_RespondableSubscribableIdentifiedObject_t,mRID), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,16), .n=1, .width=1},
+  {.offset=offsetof(SE_RespondableSubscribableIdentifiedObject_t,description), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|xs_type(XS_STRING,32), .n=3, .width=2},
+  {.offset=offsetof(SE_RespondableSubscribableIdentifiedObject_t,version), .min=0, .max=1, .bit=2, .type=ST_SIMPLE|XS_USHORT, .n=2, .width=2},
   // Event (644)
   {.size=sizeof(SE_Event_t), .index=636},
-  {.offset=offsetof(SE_Event_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=5},
-  {.offset=offsetof(SE_Event_t,replyTo), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=4},
-  {.offset=offsetof(SE_Event_t,responseRequired), .min=0, .max=1, .attribute=1, .bit=4, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,1), .n=3},
-  {.offset=offsetof(SE_Event_t,subscribable), .min=0, .max=1, .attribute=1, .bit=1, .type=ST_SIMPLE|XS_UBYTE, .n=2},
-  {.offset=offsetof(SE_Event_t,mRID), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,16), .n=1},
-  {.offset=offsetof(SE_Event_t,description), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|xs_type(XS_STRING,32), .n=3},
-  {.offset=offsetof(SE_Event_t,version), .min=0, .max=1, .bit=2, .type=ST_SIMPLE|XS_USHORT, .n=2},
-  {.offset=offsetof(SE_Event_t,creationTime), .min=1, .max=1, .type=ST_SIMPLE|XS_LONG, .n=1},
-  {.offset=offsetof(SE_Event_t,EventStatus), .min=1, .max=1, .index=630, .n=1},
-  {.offset=offsetof(SE_Event_t,interval), .min=1, .max=1, .index=349, .n=1},
+  {.offset=offsetof(SE_Event_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=5, .width=3},
+  {.offset=offsetof(SE_Event_t,replyTo), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=4, .width=3},
+  {.offset=offsetof(SE_Event_t,responseRequired), .min=0, .max=1, .attribute=1, .bit=4, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,1), .n=3, .width=2},
+  {.offset=offsetof(SE_Event_t,subscribable), .min=0, .max=1, .attribute=1, .bit=1, .type=ST_SIMPLE|XS_UBYTE, .n=2, .width=2},
+  {.offset=offsetof(SE_Event_t,mRID), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,16), .n=1, .width=1},
+  {.offset=offsetof(SE_Event_t,description), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|xs_type(XS_STRING,32), .n=3, .width=2},
+  {.offset=offsetof(SE_Event_t,version), .min=0, .max=1, .bit=2, .type=ST_SIMPLE|XS_USHORT, .n=2, .width=2},
+  {.offset=offsetof(SE_Event_t,creationTime), .min=1, .max=1, .type=ST_SIMPLE|XS_LONG, .n=1, .width=1},
+  {.offset=offsetof(SE_Event_t,EventStatus), .min=1, .max=1, .index=630, .n=1, .width=1},
+  {.offset=offsetof(SE_Event_t,interval), .min=1, .max=1, .index=349, .n=1, .width=1},
   // RandomizableEvent (655)
   {.size=sizeof(SE_RandomizableEvent_t), .index=644},
-  {.offset=offsetof(SE_RandomizableEvent_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=5},
-  {.offset=offsetof(SE_RandomizableEvent_t,replyTo), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=4},
-  {.offset=offsetof(SE_RandomizableEvent_t,responseRequired), .min=0, .max=1, .attribute=1, .bit=4, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,1), .n=3},
-  {.offset=offsetof(SE_RandomizableEvent_t,subscribable), .min=0, .max=1, .attribute=1, .bit=1, .type=ST_SIMPLE|XS_UBYTE, .n=2},
-  {.offset=offsetof(SE_RandomizableEvent_t,mRID), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,16), .n=1},
-  {.offset=offsetof(SE_RandomizableEvent_t,description), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|xs_type(XS_STRING,32), .n=3},
-  {.offset=offsetof(SE_RandomizableEvent_t,version), .min=0, .max=1, .bit=2, .type=ST_SIMPLE|XS_USHORT, .n=2},
-  {.offset=offsetof(SE_RandomizableEvent_t,creationTime), .min=1, .max=1, .type=ST_SIMPLE|XS_LONG, .n=1},
-  {.offset=offsetof(SE_RandomizableEvent_t,EventStatus), .min=1, .max=1, .index=630, .n=1},
-  {.offset=offsetof(SE_RandomizableEvent_t,interval), .min=1, .max=1, .index=349, .n=1},
-  {.offset=offsetof(SE_RandomizableEvent_t,randomizeDuration), .min=0, .max=1, .bit=5, .type=ST_SIMPLE|XS_SHORT, .n=3},
-  {.offset=offsetof(SE_RandomizableEvent_t,randomizeStart), .min=0, .max=1, .bit=6, .type=ST_SIMPLE|XS_SHORT, .n=2},
+  {.offset=offsetof(SE_RandomizableEvent_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=5, .width=3},
+  {.offset=offsetof(SE_RandomizableEvent_t,replyTo), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=4, .width=3},
+  {.offset=offsetof(SE_RandomizableEvent_t,responseRequired), .min=0, .max=1, .attribute=1, .bit=4, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,1), .n=3, .width=2},
+  {.offset=offsetof(SE_RandomizableEvent_t,subscribable), .min=0, .max=1, .attribute=1, .bit=1, .type=ST_SIMPLE|XS_UBYTE, .n=2, .width=2},
+  {.offset=offsetof(SE_RandomizableEvent_t,mRID), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,16), .n=1, .width=1},
+  {.offset=offsetof(SE_RandomizableEvent_t,description), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|xs_type(XS_STRING,32), .n=3, .width=2},
+  {.offset=offsetof(SE_RandomizableEvent_t,version), .min=0, .max=1, .bit=2, .type=ST_SIMPLE|XS_USHORT, .n=2, .width=2},
+  {.offset=offsetof(SE_RandomizableEvent_t,creationTime), .min=1, .max=1, .type=ST_SIMPLE|XS_LONG, .n=1, .width=1},
+  {.offset=offsetof(SE_RandomizableEvent_t,EventStatus), .min=1, .max=1, .index=630, .n=1, .width=1},
+  {.offset=offsetof(SE_RandomizableEvent_t,interval), .min=1, .max=1, .index=349, .n=1, .width=1},
+  {.offset=offsetof(SE_RandomizableEvent_t,randomizeDuration), .min=0, .max=1, .bit=5, .type=ST_SIMPLE|XS_SHORT, .n=3, .width=2},
+  {.offset=offsetof(SE_RandomizableEvent_t,randomizeStart), .min=0, .max=1, .bit=6, .type=ST_SIMPLE|XS_SHORT, .n=2, .width=2},
   // DERControl (668)
   {.size=sizeof(SE_DERControl_t), .index=655},
-  {.offset=offsetof(SE_DERControl_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=5},
-  {.offset=offsetof(SE_DERControl_t,replyTo), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=4},
-  {.offset=offsetof(SE_DERControl_t,responseRequired), .min=0, .max=1, .attribute=1, .bit=4, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,1), .n=3},
-  {.offset=offsetof(SE_DERControl_t,subscribable), .min=0, .max=1, .attribute=1, .bit=1, .type=ST_SIMPLE|XS_UBYTE, .n=2},
-  {.offset=offsetof(SE_DERControl_t,mRID), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,16), .n=1},
-  {.offset=offsetof(SE_DERControl_t,description), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|xs_type(XS_STRING,32), .n=3},
-  {.offset=offsetof(SE_DERControl_t,version), .min=0, .max=1, .bit=2, .type=ST_SIMPLE|XS_USHORT, .n=2},
-  {.offset=offsetof(SE_DERControl_t,creationTime), .min=1, .max=1, .type=ST_SIMPLE|XS_LONG, .n=1},
-  {.offset=offsetof(SE_DERControl_t,EventStatus), .min=1, .max=1, .index=630, .n=1},
-  {.offset=offsetof(SE_DERControl_t,interval), .min=1, .max=1, .index=349, .n=1},
-  {.offset=offsetof(SE_DERControl_t,randomizeDuration), .min=0, .max=1, .bit=5, .type=ST_SIMPLE|XS_SHORT, .n=3},
-  {.offset=offsetof(SE_DERControl_t,randomizeStart), .min=0, .max=1, .bit=6, .type=ST_SIMPLE|XS_SHORT, .n=2},
-  {.offset=offsetof(SE_DERControl_t,DERControlBase), .min=1, .max=1, .index=603, .n=1},
-  {.offset=offsetof(SE_DERControl_t,deviceCategory), .min=0, .max=1, .bit=3, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,4), .n=2},
+  {.offset=offsetof(SE_DERControl_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=5, .width=3},
+  {.offset=offsetof(SE_DERControl_t,replyTo), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=4, .width=3},
+  {.offset=offsetof(SE_DERControl_t,responseRequired), .min=0, .max=1, .attribute=1, .bit=4, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,1), .n=3, .width=2},
+  {.offset=offsetof(SE_DERControl_t,subscribable), .min=0, .max=1, .attribute=1, .bit=1, .type=ST_SIMPLE|XS_UBYTE, .n=2, .width=2},
+  {.offset=offsetof(SE_DERControl_t,mRID), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,16), .n=1, .width=1},
+  {.offset=offsetof(SE_DERControl_t,description), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|xs_type(XS_STRING,32), .n=3, .width=2},
+  {.offset=offsetof(SE_DERControl_t,version), .min=0, .max=1, .bit=2, .type=ST_SIMPLE|XS_USHORT, .n=2, .width=2},
+  {.offset=offsetof(SE_DERControl_t,creationTime), .min=1, .max=1, .type=ST_SIMPLE|XS_LONG, .n=1, .width=1},
+  {.offset=offsetof(SE_DERControl_t,EventStatus), .min=1, .max=1, .index=630, .n=1, .width=1},
+  {.offset=offsetof(SE_DERControl_t,interval), .min=1, .max=1, .index=349, .n=1, .width=1},
+  {.offset=offsetof(SE_DERControl_t,randomizeDuration), .min=0, .max=1, .bit=5, .type=ST_SIMPLE|XS_SHORT, .n=3, .width=2},
+  {.offset=offsetof(SE_DERControl_t,randomizeStart), .min=0, .max=1, .bit=6, .type=ST_SIMPLE|XS_SHORT, .n=2, .width=2},
+  {.offset=offsetof(SE_DERControl_t,DERControlBase), .min=1, .max=1, .index=603, .n=1, .width=1},
+  {.offset=offsetof(SE_DERControl_t,deviceCategory), .min=0, .max=1, .bit=3, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,4), .n=2, .width=2},
   // DERControlList (683)
   {.size=sizeof(SE_DERControlList_t), .index=543},
-  {.offset=offsetof(SE_DERControlList_t,all), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1},
-  {.offset=offsetof(SE_DERControlList_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2},
-  {.offset=offsetof(SE_DERControlList_t,results), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1},
-  {.offset=offsetof(SE_DERControlList_t,subscribable), .min=0, .max=1, .attribute=1, .bit=1, .type=ST_SIMPLE|XS_UBYTE, .n=3},
-  {.offset=offsetof(SE_DERControlList_t,DERControl), .min=0, .unbounded=1, .index=668, .n=2},
+  {.offset=offsetof(SE_DERControlList_t,all), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1, .width=1},
+  {.offset=offsetof(SE_DERControlList_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2, .width=2},
+  {.offset=offsetof(SE_DERControlList_t,results), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1, .width=1},
+  {.offset=offsetof(SE_DERControlList_t,subscribable), .min=0, .max=1, .attribute=1, .bit=1, .type=ST_SIMPLE|XS_UBYTE, .n=3, .width=2},
+  {.offset=offsetof(SE_DERControlList_t,DERControl), .min=0, .unbounded=1, .index=668, .n=2, .width=2},
   // ReactiveSusceptance (689)
   {.size=sizeof(SE_ReactiveSusceptance_t), .index=0},
-  {.offset=offsetof(SE_ReactiveSusceptance_t,multiplier), .min=1, .max=1, .type=ST_SIMPLE|XS_BYTE, .n=1},
-  {.offset=offsetof(SE_ReactiveSusceptance_t,value), .min=1, .max=1, .type=ST_SIMPLE|XS_USHORT, .n=1},
+  {.offset=offsetof(SE_ReactiveSusceptance_t,multiplier), .min=1, .max=1, .type=ST_SIMPLE|XS_BYTE, .n=1, .width=1},
+  {.offset=offsetof(SE_ReactiveSusceptance_t,value), .min=1, .max=1, .type=ST_SIMPLE|XS_USHORT, .n=1, .width=1},
   // PowerFactor (692)
   {.size=sizeof(SE_PowerFactor_t), .index=0},
-  {.offset=offsetof(SE_PowerFactor_t,displacement), .min=1, .max=1, .type=ST_SIMPLE|XS_USHORT, .n=1},
-  {.offset=offsetof(SE_PowerFactor_t,multiplier), .min=1, .max=1, .type=ST_SIMPLE|XS_BYTE, .n=1},
+  {.offset=offsetof(SE_PowerFactor_t,displacement), .min=1, .max=1, .type=ST_SIMPLE|XS_USHORT, .n=1, .width=1},
+  {.offset=offsetof(SE_PowerFactor_t,multiplier), .min=1, .max=1, .type=ST_SIMPLE|XS_BYTE, .n=1, .width=1},
   // WattHour (695)
   {.size=sizeof(SE_WattHour_t), .index=0},
-  {.offset=offsetof(SE_WattHour_t,multiplier), .min=1, .max=1, .type=ST_SIMPLE|XS_BYTE, .n=1},
-  {.offset=offsetof(SE_WattHour_t,value), .min=1, .max=1, .type=ST_SIMPLE|XS_USHORT, .n=1},
+  {.offset=offsetof(SE_WattHour_t,multiplier), .min=1, .max=1, .type=ST_SIMPLE|XS_BYTE, .n=1, .width=1},
+  {.offset=offsetof(SE_WattHour_t,value), .min=1, .max=1, .type=ST_SIMPLE|XS_USHORT, .n=1, .width=1},
   // VoltageRMS (698)
   {.size=sizeof(SE_VoltageRMS_t), .index=0},
-  {.offset=offsetof(SE_VoltageRMS_t,multiplier), .min=1, .max=1, .type=ST_SIMPLE|XS_BYTE, .n=1},
-  {.offset=offsetof(SE_VoltageRMS_t,value), .min=1, .max=1, .type=ST_SIMPLE|XS_USHORT, .n=1},
+  {.offset=offsetof(SE_VoltageRMS_t,multiplier), .min=1, .max=1, .type=ST_SIMPLE|XS_BYTE, .n=1, .width=1},
+  {.offset=offsetof(SE_VoltageRMS_t,value), .min=1, .max=1, .type=ST_SIMPLE|XS_USHORT, .n=1, .width=1},
   // ApparentPower (701)
   {.size=sizeof(SE_ApparentPower_t), .index=0},
-  {.offset=offsetof(SE_ApparentPower_t,multiplier), .min=1, .max=1, .type=ST_SIMPLE|XS_BYTE, .n=1},
-  {.offset=offsetof(SE_ApparentPower_t,value), .min=1, .max=1, .type=ST_SIMPLE|XS_USHORT, .n=1},
+  {.offset=offsetof(SE_ApparentPower_t,multiplier), .min=1, .max=1, .type=ST_SIMPLE|XS_BYTE, .n=1, .width=1},
+  {.offset=offsetof(SE_ApparentPower_t,value), .min=1, .max=1, .type=ST_SIMPLE|XS_USHORT, .n=1, .width=1},
   // AmpereHour (704)
   {.size=sizeof(SE_AmpereHour_t), .index=0},
-  {.offset=offsetof(SE_AmpereHour_t,multiplier), .min=1, .max=1, .type=ST_SIMPLE|XS_BYTE, .n=1},
-  {.offset=offsetof(SE_AmpereHour_t,value), .min=1, .max=1, .type=ST_SIMPLE|XS_USHORT, .n=1},
+  {.offset=offsetof(SE_AmpereHour_t,multiplier), .min=1, .max=1, .type=ST_SIMPLE|XS_BYTE, .n=1, .width=1},
+  {.offset=offsetof(SE_AmpereHour_t,value), .min=1, .max=1, .type=ST_SIMPLE|XS_USHORT, .n=1, .width=1},
   // CurrentRMS (707)
   {.size=sizeof(SE_CurrentRMS_t), .index=0},
-  {.offset=offsetof(SE_CurrentRMS_t,multiplier), .min=1, .max=1, .type=ST_SIMPLE|XS_BYTE, .n=1},
-  {.offset=offsetof(SE_CurrentRMS_t,value), .min=1, .max=1, .type=ST_SIMPLE|XS_USHORT, .n=1},
+  {.offset=offsetof(SE_CurrentRMS_t,multiplier), .min=1, .max=1, .type=ST_SIMPLE|XS_BYTE, .n=1, .width=1},
+  {.offset=offsetof(SE_CurrentRMS_t,value), .min=1, .max=1, .type=ST_SIMPLE|XS_USHORT, .n=1, .width=1},
   // DERCapability (710)
   {.size=sizeof(SE_DERCapability_t), .index=328},
-  {.offset=offsetof(SE_DERCapability_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2},
-  {.offset=offsetof(SE_DERCapability_t,modesSupported), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,4), .n=1},
-  {.offset=offsetof(SE_DERCapability_t,rtgAbnormalCategory), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|XS_UBYTE, .n=12},
-  {.offset=offsetof(SE_DERCapability_t,rtgMaxA), .min=0, .max=1, .bit=1, .index=707, .n=11},
-  {.offset=offsetof(SE_DERCapability_t,rtgMaxAh), .min=0, .max=1, .bit=2, .index=704, .n=10},
-  {.offset=offsetof(SE_DERCapability_t,rtgMaxChargeRateVA), .min=0, .max=1, .bit=3, .index=701, .n=9},
-  {.offset=offsetof(SE_DERCapability_t,rtgMaxChargeRateW), .min=0, .max=1, .bit=4, .index=582, .n=8},
-  {.offset=offsetof(SE_DERCapability_t,rtgMaxDischargeRateVA), .min=0, .max=1, .bit=5, .index=701, .n=7},
-  {.offset=offsetof(SE_DERCapability_t,rtgMaxDischargeRateW), .min=0, .max=1, .bit=6, .index=582, .n=6},
-  {.offset=offsetof(SE_DERCapability_t,rtgMaxV), .min=0, .max=1, .bit=7, .index=698, .n=5},
-  {.offset=offsetof(SE_DERCapability_t,rtgMaxVA), .min=0, .max=1, .bit=8, .index=701, .n=4},
-  {.offset=offsetof(SE_DERCapability_t,rtgMaxVar), .min=0, .max=1, .bit=9, .index=585, .n=3},
-  {.offset=offsetof(SE_DERCapability_t,rtgMaxVarNeg), .min=0, .max=1, .bit=10, .index=585, .n=2},
-  {.offset=offsetof(SE_DERCapability_t,rtgMaxW), .min=1, .max=1, .index=582, .n=1},
-  {.offset=offsetof(SE_DERCapability_t,rtgMaxWh), .min=0, .max=1, .bit=11, .index=695, .n=12},
-  {.offset=offsetof(SE_DERCapability_t,rtgMinPFOverExcited), .min=0, .max=1, .bit=12, .index=692, .n=11},
-  {.offset=offsetof(SE_DERCapability_t,rtgMinPFUnderExcited), .min=0, .max=1, .bit=13, .index=692, .n=10},
-  {.offset=offsetof(SE_DERCapability_t,rtgMinV), .min=0, .max=1, .bit=14, .index=698, .n=9},
-  {.offset=offsetof(SE_DERCapability_t,rtgNormalCategory), .min=0, .max=1, .bit=15, .type=ST_SIMPLE|XS_UBYTE, .n=8},
-  {.offset=offsetof(SE_DERCapability_t,rtgOverExcitedPF), .min=0, .max=1, .bit=16, .index=692, .n=7},
-  {.offset=offsetof(SE_DERCapability_t,rtgOverExcitedW), .min=0, .max=1, .bit=17, .index=582, .n=6},
-  {.offset=offsetof(SE_DERCapability_t,rtgReactiveSusceptance), .min=0, .max=1, .bit=18, .index=689, .n=5},
-  {.offset=offsetof(SE_DERCapability_t,rtgUnderExcitedPF), .min=0, .max=1, .bit=19, .index=692, .n=4},
-  {.offset=offsetof(SE_DERCapability_t,rtgUnderExcitedW), .min=0, .max=1, .bit=20, .index=582, .n=3},
-  {.offset=offsetof(SE_DERCapability_t,rtgVNom), .min=0, .max=1, .bit=21, .index=698, .n=2},
-  {.offset=offsetof(SE_DERCapability_t,type), .min=1, .max=1, .type=ST_SIMPLE|XS_UBYTE, .n=1},
+  {.offset=offsetof(SE_DERCapability_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2, .width=2},
+  {.offset=offsetof(SE_DERCapability_t,modesSupported), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,4), .n=1, .width=1},
+  {.offset=offsetof(SE_DERCapability_t,rtgAbnormalCategory), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|XS_UBYTE, .n=12, .width=4},
+  {.offset=offsetof(SE_DERCapability_t,rtgMaxA), .min=0, .max=1, .bit=1, .index=707, .n=11, .width=4},
+  {.offset=offsetof(SE_DERCapability_t,rtgMaxAh), .min=0, .max=1, .bit=2, .index=704, .n=10, .width=4},
+  {.offset=offsetof(SE_DERCapability_t,rtgMaxChargeRateVA), .min=0, .max=1, .bit=3, .index=701, .n=9, .width=4},
+  {.offset=offsetof(SE_DERCapability_t,rtgMaxChargeRateW), .min=0, .max=1, .bit=4, .index=582, .n=8, .width=4},
+  {.offset=offsetof(SE_DERCapability_t,rtgMaxDischargeRateVA), .min=0, .max=1, .bit=5, .index=701, .n=7, .width=3},
+  {.offset=offsetof(SE_DERCapability_t,rtgMaxDischargeRateW), .min=0, .max=1, .bit=6, .index=582, .n=6, .width=3},
+  {.offset=offsetof(SE_DERCapability_t,rtgMaxV), .min=0, .max=1, .bit=7, .index=698, .n=5, .width=3},
+  {.offset=offsetof(SE_DERCapability_t,rtgMaxVA), .min=0, .max=1, .bit=8, .index=701, .n=4, .width=3},
+  {.offset=offsetof(SE_DERCapability_t,rtgMaxVar), .min=0, .max=1, .bit=9, .index=585, .n=3, .width=2},
+  {.offset=offsetof(SE_DERCapability_t,rtgMaxVarNeg), .min=0, .max=1, .bit=10, .index=585, .n=2, .width=2},
+  {.offset=offsetof(SE_DERCapability_t,rtgMaxW), .min=1, .max=1, .index=582, .n=1, .width=1},
+  {.offset=offsetof(SE_DERCapability_t,rtgMaxWh), .min=0, .max=1, .bit=11, .index=695, .n=12, .width=4},
+  {.offset=offsetof(SE_DERCapability_t,rtgMinPFOverExcited), .min=0, .max=1, .bit=12, .index=692, .n=11, .width=4},
+  {.offset=offsetof(SE_DERCapability_t,rtgMinPFUnderExcited), .min=0, .max=1, .bit=13, .index=692, .n=10, .width=4},
+  {.offset=offsetof(SE_DERCapability_t,rtgMinV), .min=0, .max=1, .bit=14, .index=698, .n=9, .width=4},
+  {.offset=offsetof(SE_DERCapability_t,rtgNormalCategory), .min=0, .max=1, .bit=15, .type=ST_SIMPLE|XS_UBYTE, .n=8, .width=4},
+  {.offset=offsetof(SE_DERCapability_t,rtgOverExcitedPF), .min=0, .max=1, .bit=16, .index=692, .n=7, .width=3},
+  {.offset=offsetof(SE_DERCapability_t,rtgOverExcitedW), .min=0, .max=1, .bit=17, .index=582, .n=6, .width=3},
+  {.offset=offsetof(SE_DERCapability_t,rtgReactiveSusceptance), .min=0, .max=1, .bit=18, .index=689, .n=5, .width=3},
+  {.offset=offsetof(SE_DERCapability_t,rtgUnderExcitedPF), .min=0, .max=1, .bit=19, .index=692, .n=4, .width=3},
+  {.offset=offsetof(SE_DERCapability_t,rtgUnderExcitedW), .min=0, .max=1, .bit=20, .index=582, .n=3, .width=2},
+  {.offset=offsetof(SE_DERCapability_t,rtgVNom), .min=0, .max=1, .bit=21, .index=698, .n=2, .width=2},
+  {.offset=offsetof(SE_DERCapability_t,type), .min=1, .max=1, .type=ST_SIMPLE|XS_UBYTE, .n=1, .width=1},
   // DERAvailability (737)
   {.size=sizeof(SE_DERAvailability_t), .index=499},
-  {.offset=offsetof(SE_DERAvailability_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=5},
-  {.offset=offsetof(SE_DERAvailability_t,subscribable), .min=0, .max=1, .attribute=1, .bit=1, .type=ST_SIMPLE|XS_UBYTE, .n=4},
-  {.offset=offsetof(SE_DERAvailability_t,availabilityDuration), .min=0, .max=1, .bit=7, .type=ST_SIMPLE|XS_UINT, .n=3},
-  {.offset=offsetof(SE_DERAvailability_t,maxChargeDuration), .min=0, .max=1, .bit=2, .type=ST_SIMPLE|XS_UINT, .n=2},
-  {.offset=offsetof(SE_DERAvailability_t,readingTime), .min=1, .max=1, .type=ST_SIMPLE|XS_LONG, .n=1},
-  {.offset=offsetof(SE_DERAvailability_t,reserveChargePercent), .min=0, .max=1, .bit=3, .type=ST_SIMPLE|XS_USHORT, .n=5},
-  {.offset=offsetof(SE_DERAvailability_t,reservePercent), .min=0, .max=1, .bit=4, .type=ST_SIMPLE|XS_USHORT, .n=4},
-  {.offset=offsetof(SE_DERAvailability_t,statVarAvail), .min=0, .max=1, .bit=5, .index=585, .n=3},
-  {.offset=offsetof(SE_DERAvailability_t,statWAvail), .min=0, .max=1, .bit=6, .index=582, .n=2},
+  {.offset=offsetof(SE_DERAvailability_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=5, .width=3},
+  {.offset=offsetof(SE_DERAvailability_t,subscribable), .min=0, .max=1, .attribute=1, .bit=1, .type=ST_SIMPLE|XS_UBYTE, .n=4, .width=3},
+  {.offset=offsetof(SE_DERAvailability_t,availabilityDuration), .min=0, .max=1, .bit=7, .type=ST_SIMPLE|XS_UINT, .n=3, .width=2},
+  {.offset=offsetof(SE_DERAvailability_t,maxChargeDuration), .min=0, .max=1, .bit=2, .type=ST_SIMPLE|XS_UINT, .n=2, .width=2},
+  {.offset=offsetof(SE_DERAvailability_t,readingTime), .min=1, .max=1, .type=ST_SIMPLE|XS_LONG, .n=1, .width=1},
+  {.offset=offsetof(SE_DERAvailability_t,reserveChargePercent), .min=0, .max=1, .bit=3, .type=ST_SIMPLE|XS_USHORT, .n=5, .width=3},
+  {.offset=offsetof(SE_DERAvailability_t,reservePercent), .min=0, .max=1, .bit=4, .type=ST_SIMPLE|XS_USHORT, .n=4, .width=3},
+  {.offset=offsetof(SE_DERAvailability_t,statVarAvail), .min=0, .max=1, .bit=5, .index=585, .n=3, .width=2},
+  {.offset=offsetof(SE_DERAvailability_t,statWAvail), .min=0, .max=1, .bit=6, .index=582, .n=2, .width=2},
   // DERSettings (747)
   {.size=sizeof(SE_DERSettings_t), .index=499},
-  {.offset=offsetof(SE_DERSettings_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=11},
-  {.offset=offsetof(SE_DERSettings_t,subscribable), .min=0, .max=1, .attribute=1, .bit=1, .type=ST_SIMPLE|XS_UBYTE, .n=10},
-  {.offset=offsetof(SE_DERSettings_t,modesEnabled), .min=0, .max=1, .bit=2, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,4), .n=9},
-  {.offset=offsetof(SE_DERSettings_t,setESDelay), .min=0, .max=1, .bit=20, .type=ST_SIMPLE|XS_UINT, .n=8},
-  {.offset=offsetof(SE_DERSettings_t,setESHighFreq), .min=0, .max=1, .bit=21, .type=ST_SIMPLE|XS_USHORT, .n=7},
-  {.offset=offsetof(SE_DERSettings_t,setESHighVolt), .min=0, .max=1, .bit=22, .type=ST_SIMPLE|XS_SHORT, .n=6},
-  {.offset=offsetof(SE_DERSettings_t,setESLowFreq), .min=0, .max=1, .bit=23, .type=ST_SIMPLE|XS_USHORT, .n=5},
-  {.offset=offsetof(SE_DERSettings_t,setESLowVolt), .min=0, .max=1, .bit=24, .type=ST_SIMPLE|XS_SHORT, .n=4},
-  {.offset=offsetof(SE_DERSettings_t,setESRampTms), .min=0, .max=1, .bit=25, .type=ST_SIMPLE|XS_UINT, .n=3},
-  {.offset=offsetof(SE_DERSettings_t,setESRandomDelay), .min=0, .max=1, .bit=26, .type=ST_SIMPLE|XS_UINT, .n=2},
-  {.offset=offsetof(SE_DERSettings_t,setGradW), .min=1, .max=1, .type=ST_SIMPLE|XS_USHORT, .n=1},
-  {.offset=offsetof(SE_DERSettings_t,setMaxA), .min=0, .max=1, .bit=3, .index=707, .n=11},
-  {.offset=offsetof(SE_DERSettings_t,setMaxAh), .min=0, .max=1, .bit=4, .index=704, .n=10},
-  {.offset=offsetof(SE_DERSettings_t,setMaxChargeRateVA), .min=0, .max=1, .bit=5, .index=701, .n=9},
-  {.offset=offsetof(SE_DERSettings_t,setMaxChargeRateW), .min=0, .max=1, .bit=6, .index=582, .n=8},
-  {.offset=offsetof(SE_DERSettings_t,setMaxDischargeRateVA), .min=0, .max=1, .bit=7, .index=701, .n=7},
-  {.offset=offsetof(SE_DERSettings_t,setMaxDischargeRateW), .min=0, .max=1, .bit=8, .index=582, .n=6},
-  {.offset=offsetof(SE_DERSettings_t,setMaxV), .min=0, .max=1, .bit=9, .index=698, .n=5},
-  {.offset=offsetof(SE_DERSettings_t,setMaxVA), .min=0, .max=1, .bit=10, .index=701, .n=4},
-  {.offset=offsetof(SE_DERSettings_t,setMaxVar), .min=0, .max=1, .bit=11, .index=585, .n=3},
-  {.offset=offsetof(SE_DERSettings_t,setMaxVarNeg), .min=0, .max=1, .bit=12, .index=585, .n=2},
-  {.offset=offsetof(SE_DERSettings_t,setMaxW), .min=1, .max=1, .index=582, .n=1},
-  {.offset=offsetof(SE_DERSettings_t,setMaxWh), .min=0, .max=1, .bit=13, .index=695, .n=9},
-  {.offset=offsetof(SE_DERSettings_t,setMinPFOverExcited), .min=0, .max=1, .bit=14, .index=692, .n=8},
-  {.offset=offsetof(SE_DERSettings_t,setMinPFUnderExcited), .min=0, .max=1, .bit=15, .index=692, .n=7},
-  {.offset=offsetof(SE_DERSettings_t,setMinV), .min=0, .max=1, .bit=16, .index=698, .n=6},
-  {.offset=offsetof(SE_DERSettings_t,setSoftGradW), .min=0, .max=1, .bit=27, .type=ST_SIMPLE|XS_USHORT, .n=5},
-  {.offset=offsetof(SE_DERSettings_t,setVNom), .min=0, .max=1, .bit=17, .index=698, .n=4},
-  {.offset=offsetof(SE_DERSettings_t,setVRef), .min=0, .max=1, .bit=18, .index=698, .n=3},
-  {.offset=offsetof(SE_DERSettings_t,setVRefOfs), .min=0, .max=1, .bit=19, .index=698, .n=2},
-  {.offset=offsetof(SE_DERSettings_t,updatedTime), .min=1, .max=1, .type=ST_SIMPLE|XS_LONG, .n=1},
+  {.offset=offsetof(SE_DERSettings_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=11, .width=4},
+  {.offset=offsetof(SE_DERSettings_t,subscribable), .min=0, .max=1, .attribute=1, .bit=1, .type=ST_SIMPLE|XS_UBYTE, .n=10, .width=4},
+  {.offset=offsetof(SE_DERSettings_t,modesEnabled), .min=0, .max=1, .bit=2, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,4), .n=9, .width=4},
+  {.offset=offsetof(SE_DERSettings_t,setESDelay), .min=0, .max=1, .bit=20, .type=ST_SIMPLE|XS_UINT, .n=8, .width=4},
+  {.offset=offsetof(SE_DERSettings_t,setESHighFreq), .min=0, .max=1, .bit=21, .type=ST_SIMPLE|XS_USHORT, .n=7, .width=3},
+  {.offset=offsetof(SE_DERSettings_t,setESHighVolt), .min=0, .max=1, .bit=22, .type=ST_SIMPLE|XS_SHORT, .n=6, .width=3},
+  {.offset=offsetof(SE_DERSettings_t,setESLowFreq), .min=0, .max=1, .bit=23, .type=ST_SIMPLE|XS_USHORT, .n=5, .width=3},
+  {.offset=offsetof(SE_DERSettings_t,setESLowVolt), .min=0, .max=1, .bit=24, .type=ST_SIMPLE|XS_SHORT, .n=4, .width=3},
+  {.offset=offsetof(SE_DERSettings_t,setESRampTms), .min=0, .max=1, .bit=25, .type=ST_SIMPLE|XS_UINT, .n=3, .width=2},
+  {.offset=offsetof(SE_DERSettings_t,setESRandomDelay), .min=0, .max=1, .bit=26, .type=ST_SIMPLE|XS_UINT, .n=2, .width=2},
+  {.offset=offsetof(SE_DERSettings_t,setGradW), .min=1, .max=1, .type=ST_SIMPLE|XS_USHORT, .n=1, .width=1},
+  {.offset=offsetof(SE_DERSettings_t,setMaxA), .min=0, .max=1, .bit=3, .index=707, .n=11, .width=4},
+  {.offset=offsetof(SE_DERSettings_t,setMaxAh), .min=0, .max=1, .bit=4, .index=704, .n=10, .width=4},
+  {.offset=offsetof(SE_DERSettings_t,setMaxChargeRateVA), .min=0, .max=1, .bit=5, .index=701, .n=9, .width=4},
+  {.offset=offsetof(SE_DERSettings_t,setMaxChargeRateW), .min=0, .max=1, .bit=6, .index=582, .n=8, .width=4},
+  {.offset=offsetof(SE_DERSettings_t,setMaxDischargeRateVA), .min=0, .max=1, .bit=7, .index=701, .n=7, .width=3},
+  {.offset=offsetof(SE_DERSettings_t,setMaxDischargeRateW), .min=0, .max=1, .bit=8, .index=582, .n=6, .width=3},
+  {.offset=offsetof(SE_DERSettings_t,setMaxV), .min=0, .max=1, .bit=9, .index=698, .n=5, .width=3},
+  {.offset=offsetof(SE_DERSettings_t,setMaxVA), .min=0, .max=1, .bit=10, .index=701, .n=4, .width=3},
+  {.offset=offsetof(SE_DERSettings_t,setMaxVar), .min=0, .max=1, .bit=11, .index=585, .n=3, .width=2},
+  {.offset=offsetof(SE_DERSettings_t,setMaxVarNeg), .min=0, .max=1, .bit=12, .index=585, .n=2, .width=2},
+  {.offset=offsetof(SE_DERSettings_t,setMaxW), .min=1, .max=1, .index=582, .n=1, .width=1},
+  {.offset=offsetof(SE_DERSettings_t,setMaxWh), .min=0, .max=1, .bit=13, .index=695, .n=9, .width=4},
+  {.offset=offsetof(SE_DERSettings_t,setMinPFOverExcited), .min=0, .max=1, .bit=14, .index=692, .n=8, .width=4},
+  {.offset=offsetof(SE_DERSettings_t,setMinPFUnderExcited), .min=0, .max=1, .bit=15, .index=692, .n=7, .width=3},
+  {.offset=offsetof(SE_DERSettings_t,setMinV), .min=0, .max=1, .bit=16, .index=698, .n=6, .width=3},
+  {.offset=offsetof(SE_DERSettings_t,setSoftGradW), .min=0, .max=1, .bit=27, .type=ST_SIMPLE|XS_USHORT, .n=5, .width=3},
+  {.offset=offsetof(SE_DERSettings_t,setVNom), .min=0, .max=1, .bit=17, .index=698, .n=4, .width=3},
+  {.offset=offsetof(SE_DERSettings_t,setVRef), .min=0, .max=1, .bit=18, .index=698, .n=3, .width=2},
+  {.offset=offsetof(SE_DERSettings_t,setVRefOfs), .min=0, .max=1, .bit=19, .index=698, .n=2, .width=2},
+  {.offset=offsetof(SE_DERSettings_t,updatedTime), .min=1, .max=1, .type=ST_SIMPLE|XS_LONG, .n=1, .width=1},
   // DERStatusLink (779)
   {.size=sizeof(SE_DERStatusLink_t), .index=449},
-  {.offset=offsetof(SE_DERStatusLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1},
+  {.offset=offsetof(SE_DERStatusLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1, .width=1},
   // DERSettingsLink (781)
   {.size=sizeof(SE_DERSettingsLink_t), .index=449},
-  {.offset=offsetof(SE_DERSettingsLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1},
+  {.offset=offsetof(SE_DERSettingsLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1, .width=1},
   // DERCapabilityLink (783)
   {.size=sizeof(SE_DERCapabilityLink_t), .index=449},
-  {.offset=offsetof(SE_DERCapabilityLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1},
+  {.offset=offsetof(SE_DERCapabilityLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1, .width=1},
   // DERAvailabilityLink (785)
   {.size=sizeof(SE_DERAvailabilityLink_t), .index=449},
-  {.offset=offsetof(SE_DERAvailabilityLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1},
+  {.offset=offsetof(SE_DERAvailabilityLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1, .width=1},
   // CurrentDERProgramLink (787)
   {.size=sizeof(SE_CurrentDERProgramLink_t), .index=449},
-  {.offset=offsetof(SE_CurrentDERProgramLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1},
+  {.offset=offsetof(SE_CurrentDERProgramLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1, .width=1},
   // AssociatedUsagePointLink (789)
   {.size=sizeof(SE_AssociatedUsagePointLink_t), .index=449},
-  {.offset=offsetof(SE_AssociatedUsagePointLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1},
+  {.offset=offsetof(SE_AssociatedUsagePointLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1, .width=1},
   // AssociatedDERProgramListLink (791)
   {.size=sizeof(SE_AssociatedDERProgramListLink_t), .index=451},
-  {.offset=offsetof(SE_AssociatedDERProgramListLink_t,all), .min=0, .max=1, .attribute=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=2},
-  {.offset=offsetof(SE_AssociatedDERProgramListLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1},
+  {.offset=offsetof(SE_AssociatedDERProgramListLink_t,all), .min=0, .max=1, .attribute=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=2, .width=2},
+  {.offset=offsetof(SE_AssociatedDERProgramListLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1, .width=1},
   // DER (794)
   {.size=sizeof(SE_DER_t), .index=499},
-  {.offset=offsetof(SE_DER_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=10},
-  {.offset=offsetof(SE_DER_t,subscribable), .min=0, .max=1, .attribute=1, .bit=1, .type=ST_SIMPLE|XS_UBYTE, .n=9},
-  {.offset=offsetof(SE_DER_t,AssociatedDERProgramListLink), .min=0, .max=1, .bit=2, .index=791, .n=8},
-  {.offset=offsetof(SE_DER_t,AssociatedUsagePointLink), .min=0, .max=1, .bit=3, .index=789, .n=7},
-  {.offset=offsetof(SE_DER_t,CurrentDERProgramLink), .min=0, .max=1, .bit=4, .index=787, .n=6},
-  {.offset=offsetof(SE_DER_t,DERAvailabilityLink), .min=0, .max=1, .bit=5, .index=785, .n=5},
-  {.offset=offsetof(SE_DER_t,DERCapabilityLink), .min=0, .max=1, .bit=6, .index=783, .n=4},
-  {.offset=offsetof(SE_DER_t,DERSettingsLink), .min=0, .max=1, .bit=7, .index=781, .n=3},
-  {.offset=offsetof(SE_DER_t,DERStatusLink), .min=0, .max=1, .bit=8, .index=779, .n=2},
+  {.offset=offsetof(SE_DER_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=10, .width=4},
+  {.offset=offsetof(SE_DER_t,subscribable), .min=0, .max=1, .attribute=1, .bit=1, .type=ST_SIMPLE|XS_UBYTE, .n=9, .width=4},
+  {.offset=offsetof(SE_DER_t,AssociatedDERProgramListLink), .min=0, .max=1, .bit=2, .index=791, .n=8, .width=4},
+  {.offset=offsetof(SE_DER_t,AssociatedUsagePointLink), .min=0, .max=1, .bit=3, .index=789, .n=7, .width=3},
+  {.offset=offsetof(SE_DER_t,CurrentDERProgramLink), .min=0, .max=1, .bit=4, .index=787, .n=6, .width=3},
+  {.offset=offsetof(SE_DER_t,DERAvailabilityLink), .min=0, .max=1, .bit=5, .index=785, .n=5, .width=3},
+  {.offset=offsetof(SE_DER_t,DERCapabilityLink), .min=0, .max=1, .bit=6, .index=783, .n=4, .width=3},
+  {.offset=offsetof(SE_DER_t,DERSettingsLink), .min=0, .max=1, .bit=7, .index=781, .n=3, .width=2},
+  {.offset=offsetof(SE_DER_t,DERStatusLink), .min=0, .max=1, .bit=8, .index=779, .n=2, .width=2},
   // DERList (804)
   {.size=sizeof(SE_DERList_t), .index=420},
-  {.offset=offsetof(SE_DERList_t,all), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1},
-  {.offset=offsetof(SE_DERList_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=3},
-  {.offset=offsetof(SE_DERList_t,pollRate), .min=0, .max=1, .attribute=1, .bit=18, .type=ST_SIMPLE|XS_UINT, .n=2},
-  {.offset=offsetof(SE_DERList_t,results), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1},
-  {.offset=offsetof(SE_DERList_t,DER), .min=0, .unbounded=1, .index=794, .n=2},
+  {.offset=offsetof(SE_DERList_t,all), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1, .width=1},
+  {.offset=offsetof(SE_DERList_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=3, .width=2},
+  {.offset=offsetof(SE_DERList_t,pollRate), .min=0, .max=1, .attribute=1, .bit=18, .type=ST_SIMPLE|XS_UINT, .n=2, .width=2},
+  {.offset=offsetof(SE_DERList_t,results), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1, .width=1},
+  {.offset=offsetof(SE_DERList_t,DER), .min=0, .unbounded=1, .index=794, .n=2, .width=2},
   // DefaultDERControl (810)
   {.size=sizeof(SE_DefaultDERControl_t), .index=526},
-  {.offset=offsetof(SE_DefaultDERControl_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=3},
-  {.offset=offsetof(SE_DefaultDERControl_t,subscribable), .min=0, .max=1, .attribute=1, .bit=1, .type=ST_SIMPLE|XS_UBYTE, .n=2},
-  {.offset=offsetof(SE_DefaultDERControl_t,mRID), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,16), .n=1},
-  {.offset=offsetof(SE_DefaultDERControl_t,description), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|xs_type(XS_STRING,32), .n=3},
-  {.offset=offsetof(SE_DefaultDERControl_t,version), .min=0, .max=1, .bit=2, .type=ST_SIMPLE|XS_USHORT, .n=2},
-  {.offset=offsetof(SE_DefaultDERControl_t,DERControlBase), .min=1, .max=1, .index=603, .n=1},
-  {.offset=offsetof(SE_DefaultDERControl_t,setESDelay), .min=0, .max=1, .bit=20, .type=ST_SIMPLE|XS_UINT, .n=10},
-  {.offset=offsetof(SE_DefaultDERControl_t,setESHighFreq), .min=0, .max=1, .bit=21, .type=ST_SIMPLE|XS_USHORT, .n=9},
-  {.offset=offsetof(SE_DefaultDERControl_t,setESHighVolt), .min=0, .max=1, .bit=22, .type=ST_SIMPLE|XS_SHORT, .n=8},
-  {.offset=offsetof(SE_DefaultDERControl_t,setESLowFreq), .min=0, .max=1, .bit=23, .type=ST_SIMPLE|XS_USHORT, .n=7},
-  {.offset=offsetof(SE_DefaultDERControl_t,setESLowVolt), .min=0, .max=1, .bit=24, .type=ST_SIMPLE|XS_SHORT, .n=6},
-  {.offset=offsetof(SE_DefaultDERControl_t,setESRampTms), .min=0, .max=1, .bit=25, .type=ST_SIMPLE|XS_UINT, .n=5},
-  {.offset=offsetof(SE_DefaultDERControl_t,setESRandomDelay), .min=0, .max=1, .bit=26, .type=ST_SIMPLE|XS_UINT, .n=4},
-  {.offset=offsetof(SE_DefaultDERControl_t,setGradW), .min=0, .max=1, .bit=3, .type=ST_SIMPLE|XS_USHORT, .n=3},
-  {.offset=offsetof(SE_DefaultDERControl_t,setSoftGradW), .min=0, .max=1, .bit=27, .type=ST_SIMPLE|XS_USHORT, .n=2},
+  {.offset=offsetof(SE_DefaultDERControl_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=3, .width=2},
+  {.offset=offsetof(SE_DefaultDERControl_t,subscribable), .min=0, .max=1, .attribute=1, .bit=1, .type=ST_SIMPLE|XS_UBYTE, .n=2, .width=2},
+  {.offset=offsetof(SE_DefaultDERControl_t,mRID), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,16), .n=1, .width=1},
+  {.offset=offsetof(SE_DefaultDERControl_t,description), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|xs_type(XS_STRING,32), .n=3, .width=2},
+  {.offset=offsetof(SE_DefaultDERControl_t,version), .min=0, .max=1, .bit=2, .type=ST_SIMPLE|XS_USHORT, .n=2, .width=2},
+  {.offset=offsetof(SE_DefaultDERControl_t,DERControlBase), .min=1, .max=1, .index=603, .n=1, .width=1},
+  {.offset=offsetof(SE_DefaultDERControl_t,setESDelay), .min=0, .max=1, .bit=20, .type=ST_SIMPLE|XS_UINT, .n=10, .width=4},
+  {.offset=offsetof(SE_DefaultDERControl_t,setESHighFreq), .min=0, .max=1, .bit=21, .type=ST_SIMPLE|XS_USHORT, .n=9, .width=4},
+  {.offset=offsetof(SE_DefaultDERControl_t,setESHighVolt), .min=0, .max=1, .bit=22, .type=ST_SIMPLE|XS_SHORT, .n=8, .width=4},
+  {.offset=offsetof(SE_DefaultDERControl_t,setESLowFreq), .min=0, .max=1, .bit=23, .type=ST_SIMPLE|XS_USHORT, .n=7, .width=3},
+  {.offset=offsetof(SE_DefaultDERControl_t,setESLowVolt), .min=0, .max=1, .bit=24, .type=ST_SIMPLE|XS_SHORT, .n=6, .width=3},
+  {.offset=offsetof(SE_DefaultDERControl_t,setESRampTms), .min=0, .max=1, .bit=25, .type=ST_SIMPLE|XS_UINT, .n=5, .width=3},
+  {.offset=offsetof(SE_DefaultDERControl_t,setESRandomDelay), .min=0, .max=1, .bit=26, .type=ST_SIMPLE|XS_UINT, .n=4, .width=3},
+  {.offset=offsetof(SE_DefaultDERControl_t,setGradW), .min=0, .max=1, .bit=3, .type=ST_SIMPLE|XS_USHORT, .n=3, .width=2},
+  {.offset=offsetof(SE_DefaultDERControl_t,setSoftGradW), .min=0, .max=1, .bit=27, .type=ST_SIMPLE|XS_USHORT, .n=2, .width=2},
   // SignedRealEnergy (826)
   {.size=sizeof(SE_SignedRealEnergy_t), .index=0},
-  {.offset=offsetof(SE_SignedRealEnergy_t,multiplier), .min=1, .max=1, .type=ST_SIMPLE|XS_BYTE, .n=1},
-  {.offset=offsetof(SE_SignedRealEnergy_t,value), .min=1, .max=1, .type=ST_SIMPLE|XS_LONG, .n=1},
+  {.offset=offsetof(SE_SignedRealEnergy_t,multiplier), .min=1, .max=1, .type=ST_SIMPLE|XS_BYTE, .n=1, .width=1},
+  {.offset=offsetof(SE_SignedRealEnergy_t,value), .min=1, .max=1, .type=ST_SIMPLE|XS_LONG, .n=1, .width=1},
   // FlowReservationResponse (829)
   {.size=sizeof(SE_FlowReservationResponse_t), .index=644},
-  {.offset=offsetof(SE_FlowReservationResponse_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=5},
-  {.offset=offsetof(SE_FlowReservationResponse_t,replyTo), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=4},
-  {.offset=offsetof(SE_FlowReservationResponse_t,responseRequired), .min=0, .max=1, .attribute=1, .bit=4, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,1), .n=3},
-  {.offset=offsetof(SE_FlowReservationResponse_t,subscribable), .min=0, .max=1, .attribute=1, .bit=1, .type=ST_SIMPLE|XS_UBYTE, .n=2},
-  {.offset=offsetof(SE_FlowReservationResponse_t,mRID), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,16), .n=1},
-  {.offset=offsetof(SE_FlowReservationResponse_t,description), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|xs_type(XS_STRING,32), .n=3},
-  {.offset=offsetof(SE_FlowReservationResponse_t,version), .min=0, .max=1, .bit=2, .type=ST_SIMPLE|XS_USHORT, .n=2},
-  {.offset=offsetof(SE_FlowReservationResponse_t,creationTime), .min=1, .max=1, .type=ST_SIMPLE|XS_LONG, .n=1},
-  {.offset=offsetof(SE_FlowReservationResponse_t,EventStatus), .min=1, .max=1, .index=630, .n=1},
-  {.offset=offsetof(SE_FlowReservationResponse_t,interval), .min=1, .max=1, .index=349, .n=1},
-  {.offset=offsetof(SE_FlowReservationResponse_t,energyAvailable), .min=1, .max=1, .index=826, .n=1},
-  {.offset=offsetof(SE_FlowReservationResponse_t,powerAvailable), .min=1, .max=1, .index=582, .n=1},
-  {.offset=offsetof(SE_FlowReservationResponse_t,subject), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,16), .n=1},
+  {.offset=offsetof(SE_FlowReservationResponse_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=5, .width=3},
+  {.offset=offsetof(SE_FlowReservationResponse_t,replyTo), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=4, .width=3},
+  {.offset=offsetof(SE_FlowReservationResponse_t,responseRequired), .min=0, .max=1, .attribute=1, .bit=4, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,1), .n=3, .width=2},
+  {.offset=offsetof(SE_FlowReservationResponse_t,subscribable), .min=0, .max=1, .attribute=1, .bit=1, .type=ST_SIMPLE|XS_UBYTE, .n=2, .width=2},
+  {.offset=offsetof(SE_FlowReservationResponse_t,mRID), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,16), .n=1, .width=1},
+  {.offset=offsetof(SE_FlowReservationResponse_t,description), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|xs_type(XS_STRING,32), .n=3, .width=2},
+  {.offset=offsetof(SE_FlowReservationResponse_t,version), .min=0, .max=1, .bit=2, .type=ST_SIMPLE|XS_USHORT, .n=2, .width=2},
+  {.offset=offsetof(SE_FlowReservationResponse_t,creationTime), .min=1, .max=1, .type=ST_SIMPLE|XS_LONG, .n=1, .width=1},
+  {.offset=offsetof(SE_FlowReservationResponse_t,EventStatus), .min=1, .max=1, .index=630, .n=1, .width=1},
+  {.offset=offsetof(SE_FlowReservationResponse_t,interval), .min=1, .max=1, .index=349, .n=1, .width=1},
+  {.offset=offsetof(SE_FlowReservationResponse_t,energyAvailable), .min=1, .max=1, .index=826, .n=1, .width=1},
+  {.offset=offsetof(SE_FlowReservationResponse_t,powerAvailable), .min=1, .max=1, .index=582, .n=1, .width=1},
+  {.offset=offsetof(SE_FlowReservationResponse_t,subject), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,16), .n=1, .width=1},
   // FlowReservationResponseList (843)
   {.size=sizeof(SE_FlowReservationResponseList_t), .index=543},
-  {.offset=offsetof(SE_FlowReservationResponseList_t,all), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1},
-  {.offset=offsetof(SE_FlowReservationResponseList_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=3},
-  {.offset=offsetof(SE_FlowReservationResponseList_t,pollRate), .min=0, .max=1, .attribute=1, .bit=18, .type=ST_SIMPLE|XS_UINT, .n=2},
-  {.offset=offsetof(SE_FlowReservationResponseList_t,results), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1},
-  {.offset=offsetof(SE_FlowReservationResponseList_t,subscribable), .min=0, .max=1, .attribute=1, .bit=1, .type=ST_SIMPLE|XS_UBYTE, .n=3},
-  {.offset=offsetof(SE_FlowReservationResponseList_t,FlowReservationResponse), .min=0, .unbounded=1, .index=829, .n=2},
+  {.offset=offsetof(SE_FlowReservationResponseList_t,all), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1, .width=1},
+  {.offset=offsetof(SE_FlowReservationResponseList_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=3, .width=2},
+  {.offset=offsetof(SE_FlowReservationResponseList_t,pollRate), .min=0, .max=1, .attribute=1, .bit=18, .type=ST_SIMPLE|XS_UINT, .n=2, .width=2},
+  {.offset=offsetof(SE_FlowReservationResponseList_t,results), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1, .width=1},
+  {.offset=offsetof(SE_FlowReservationResponseList_t,subscribable), .min=0, .max=1, .attribute=1, .bit=1, .type=ST_SIMPLE|XS_UBYTE, .n=3, .width=2},
+  {.offset=offsetof(SE_FlowReservationResponseList_t,FlowReservationResponse), .min=0, .unbounded=1, .index=829, .n=2, .width=2},
   // RequestStatus (850)
   {.size=sizeof(SE_RequestStatus_t), .index=0},
-  {.offset=offsetof(SE_RequestStatus_t,dateTime), .min=1, .max=1, .type=ST_SIMPLE|XS_LONG, .n=1},
-  {.offset=offsetof(SE_RequestStatus_t,requestStatus), .min=1, .max=1, .type=ST_SIMPLE|XS_UBYTE, .n=1},
+  {.offset=offsetof(SE_RequestStatus_t,dateTime), .min=1, .max=1, .type=ST_SIMPLE|XS_LONG, .n=1, .width=1},
+  {.offset=offsetof(SE_RequestStatus_t,requestStatus), .min=1, .max=1, .type=ST_SIMPLE|XS_UBYTE, .n=1, .width=1},
   // FlowReservationRequest (853)
   {.size=sizeof(SE_FlowReservationRequest_t), .index=368},
-  {.offset=offsetof(SE_FlowReservationRequest_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2},
-  {.offset=offsetof(SE_FlowReservationRequest_t,mRID), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,16), .n=1},
-  {.offset=offsetof(SE_FlowReservationRequest_t,description), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|xs_type(XS_STRING,32), .n=3},
-  {.offset=offsetof(SE_FlowReservationRequest_t,version), .min=0, .max=1, .bit=2, .type=ST_SIMPLE|XS_USHORT, .n=2},
-  {.offset=offsetof(SE_FlowReservationRequest_t,creationTime), .min=1, .max=1, .type=ST_SIMPLE|XS_LONG, .n=1},
-  {.offset=offsetof(SE_FlowReservationRequest_t,durationRequested), .min=0, .max=1, .bit=3, .type=ST_SIMPLE|XS_USHORT, .n=2},
-  {.offset=offsetof(SE_FlowReservationRequest_t,energyRequested), .min=1, .max=1, .index=826, .n=1},
-  {.offset=offsetof(SE_FlowReservationRequest_t,intervalRequested), .min=1, .max=1, .index=349, .n=1},
-  {.offset=offsetof(SE_FlowReservationRequest_t,powerRequested), .min=1, .max=1, .index=582, .n=1},
-  {.offset=offsetof(SE_FlowReservationRequest_t,RequestStatus), .min=1, .max=1, .index=850, .n=1},
+  {.offset=offsetof(SE_FlowReservationRequest_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2, .width=2},
+  {.offset=offsetof(SE_FlowReservationRequest_t,mRID), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,16), .n=1, .width=1},
+  {.offset=offsetof(SE_FlowReservationRequest_t,description), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|xs_type(XS_STRING,32), .n=3, .width=2},
+  {.offset=offsetof(SE_FlowReservationRequest_t,version), .min=0, .max=1, .bit=2, .type=ST_SIMPLE|XS_USHORT, .n=2, .width=2},
+  {.offset=offsetof(SE_FlowReservationRequest_t,creationTime), .min=1, .max=1, .type=ST_SIMPLE|XS_LONG, .n=1, .width=1},
+  {.offset=offsetof(SE_FlowReservationRequest_t,durationRequested), .min=0, .max=1, .bit=3, .type=ST_SIMPLE|XS_USHORT, .n=2, .width=2},
+  {.offset=offsetof(SE_FlowReservationRequest_t,energyRequested), .min=1, .max=1, .index=826, .n=1, .width=1},
+  {.offset=offsetof(SE_FlowReservationRequest_t,intervalRequested), .min=1, .max=1, .index=349, .n=1, .width=1},
+  {.offset=offsetof(SE_FlowReservationRequest_t,powerRequested), .min=1, .max=1, .index=582, .n=1, .width=1},
+  {.offset=offsetof(SE_FlowReservationRequest_t,RequestStatus), .min=1, .max=1, .index=850, .n=1, .width=1},
   // FlowReservationRequestList (864)
   {.size=sizeof(SE_FlowReservationRequestList_t), .index=420},
-  {.offset=offsetof(SE_FlowReservationRequestList_t,all), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1},
-  {.offset=offsetof(SE_FlowReservationRequestList_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=3},
-  {.offset=offsetof(SE_FlowReservationRequestList_t,pollRate), .min=0, .max=1, .attribute=1, .bit=18, .type=ST_SIMPLE|XS_UINT, .n=2},
-  {.offset=offsetof(SE_FlowReservationRequestList_t,results), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1},
-  {.offset=offsetof(SE_FlowReservationRequestList_t,FlowReservationRequest), .min=0, .unbounded=1, .index=853, .n=2},
+  {.offset=offsetof(SE_FlowReservationRequestList_t,all), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1, .width=1},
+  {.offset=offsetof(SE_FlowReservationRequestList_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=3, .width=2},
+  {.offset=offsetof(SE_FlowReservationRequestList_t,pollRate), .min=0, .max=1, .attribute=1, .bit=18, .type=ST_SIMPLE|XS_UINT, .n=2, .width=2},
+  {.offset=offsetof(SE_FlowReservationRequestList_t,results), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1, .width=1},
+  {.offset=offsetof(SE_FlowReservationRequestList_t,FlowReservationRequest), .min=0, .unbounded=1, .index=853, .n=2, .width=2},
   // SupplyInterruptionOverride (870)
   {.size=sizeof(SE_SupplyInterruptionOverride_t), .index=328},
-  {.offset=offsetof(SE_SupplyInterruptionOverride_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=3},
-  {.offset=offsetof(SE_SupplyInterruptionOverride_t,description), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|xs_type(XS_STRING,32), .n=2},
-  {.offset=offsetof(SE_SupplyInterruptionOverride_t,interval), .min=1, .max=1, .index=349, .n=1},
+  {.offset=offsetof(SE_SupplyInterruptionOverride_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=3, .width=2},
+  {.offset=offsetof(SE_SupplyInterruptionOverride_t,description), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|xs_type(XS_STRING,32), .n=2, .width=2},
+  {.offset=offsetof(SE_SupplyInterruptionOverride_t,interval), .min=1, .max=1, .index=349, .n=1, .width=1},
   // SupplyInterruptionOverrideList (874)
   {.size=sizeof(SE_SupplyInterruptionOverrideList_t), .index=420},
-  {.offset=offsetof(SE_SupplyInterruptionOverrideList_t,all), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1},
-  {.offset=offsetof(SE_SupplyInterruptionOverrideList_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2},
-  {.offset=offsetof(SE_SupplyInterruptionOverrideList_t,results), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1},
-  {.offset=offsetof(SE_SupplyInterruptionOverrideList_t,SupplyInterruptionOverride), .min=0, .unbounded=1, .index=870, .n=2},
+  {.offset=offsetof(SE_SupplyInterruptionOverrideList_t,all), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1, .width=1},
+  {.offset=offsetof(SE_SupplyInterruptionOverrideList_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2, .width=2},
+  {.offset=offsetof(SE_SupplyInterruptionOverrideList_t,results), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1, .width=1},
+  {.offset=offsetof(SE_SupplyInterruptionOverrideList_t,SupplyInterruptionOverride), .min=0, .unbounded=1, .index=870, .n=2, .width=2},
   // ServiceChange (879)
   {.size=sizeof(SE_ServiceChange_t), .index=0},
-  {.offset=offsetof(SE_ServiceChange_t,newStatus), .min=1, .max=1, .type=ST_SIMPLE|XS_UBYTE, .n=1},
-  {.offset=offsetof(SE_ServiceChange_t,startTime), .min=1, .max=1, .type=ST_SIMPLE|XS_LONG, .n=1},
+  {.offset=offsetof(SE_ServiceChange_t,newStatus), .min=1, .max=1, .type=ST_SIMPLE|XS_UBYTE, .n=1, .width=1},
+  {.offset=offsetof(SE_ServiceChange_t,startTime), .min=1, .max=1, .type=ST_SIMPLE|XS_LONG, .n=1, .width=1},
   // CreditTypeChange (882)
   {.size=sizeof(SE_CreditTypeChange_t), .index=0},
-  {.offset=offsetof(SE_CreditTypeChange_t,newType), .min=1, .max=1, .type=ST_SIMPLE|XS_UBYTE, .n=1},
-  {.offset=offsetof(SE_CreditTypeChange_t,startTime), .min=1, .max=1, .type=ST_SIMPLE|XS_LONG, .n=1},
+  {.offset=offsetof(SE_CreditTypeChange_t,newType), .min=1, .max=1, .type=ST_SIMPLE|XS_UBYTE, .n=1, .width=1},
+  {.offset=offsetof(SE_CreditTypeChange_t,startTime), .min=1, .max=1, .type=ST_SIMPLE|XS_LONG, .n=1, .width=1},
   // PrepayOperationStatus (885)
   {.size=sizeof(SE_PrepayOperationStatus_t), .index=328},
-  {.offset=offsetof(SE_PrepayOperationStatus_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=5},
-  {.offset=offsetof(SE_PrepayOperationStatus_t,creditTypeChange), .min=0, .max=1, .bit=0, .index=882, .n=4},
-  {.offset=offsetof(SE_PrepayOperationStatus_t,creditTypeInUse), .min=0, .max=1, .bit=1, .type=ST_SIMPLE|XS_UBYTE, .n=3},
-  {.offset=offsetof(SE_PrepayOperationStatus_t,serviceChange), .min=0, .max=1, .bit=2, .index=879, .n=2},
-  {.offset=offsetof(SE_PrepayOperationStatus_t,serviceStatus), .min=1, .max=1, .type=ST_SIMPLE|XS_UBYTE, .n=1},
+  {.offset=offsetof(SE_PrepayOperationStatus_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=5, .width=3},
+  {.offset=offsetof(SE_PrepayOperationStatus_t,creditTypeChange), .min=0, .max=1, .bit=0, .index=882, .n=4, .width=3},
+  {.offset=offsetof(SE_PrepayOperationStatus_t,creditTypeInUse), .min=0, .max=1, .bit=1, .type=ST_SIMPLE|XS_UBYTE, .n=3, .width=2},
+  {.offset=offsetof(SE_PrepayOperationStatus_t,serviceChange), .min=0, .max=1, .bit=2, .index=879, .n=2, .width=2},
+  {.offset=offsetof(SE_PrepayOperationStatus_t,serviceStatus), .min=1, .max=1, .type=ST_SIMPLE|XS_UBYTE, .n=1, .width=1},
   // UsagePointLink (891)
   {.size=sizeof(SE_UsagePointLink_t), .index=449},
-  {.offset=offsetof(SE_UsagePointLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1},
+  {.offset=offsetof(SE_UsagePointLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1, .width=1},
   // MeterReadingListLink (893)
   {.size=sizeof(SE_MeterReadingListLink_t), .index=451},
-  {.offset=offsetof(SE_MeterReadingListLink_t,all), .min=0, .max=1, .attribute=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=2},
-  {.offset=offsetof(SE_MeterReadingListLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1},
+  {.offset=offsetof(SE_MeterReadingListLink_t,all), .min=0, .max=1, .attribute=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=2, .width=2},
+  {.offset=offsetof(SE_MeterReadingListLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1, .width=1},
   // UsagePoint (896)
   {.size=sizeof(SE_UsagePoint_t), .index=401},
-  {.offset=offsetof(SE_UsagePoint_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2},
-  {.offset=offsetof(SE_UsagePoint_t,mRID), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,16), .n=1},
-  {.offset=offsetof(SE_UsagePoint_t,description), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|xs_type(XS_STRING,32), .n=3},
-  {.offset=offsetof(SE_UsagePoint_t,version), .min=0, .max=1, .bit=2, .type=ST_SIMPLE|XS_USHORT, .n=2},
-  {.offset=offsetof(SE_UsagePoint_t,roleFlags), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,2), .n=1},
-  {.offset=offsetof(SE_UsagePoint_t,serviceCategoryKind), .min=1, .max=1, .type=ST_SIMPLE|XS_UBYTE, .n=1},
-  {.offset=offsetof(SE_UsagePoint_t,status), .min=1, .max=1, .type=ST_SIMPLE|XS_UBYTE, .n=1},
-  {.offset=offsetof(SE_UsagePoint_t,deviceLFDI), .min=0, .max=1, .bit=3, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,20), .n=3},
-  {.offset=offsetof(SE_UsagePoint_t,MeterReadingListLink), .min=0, .max=1, .bit=4, .index=893, .n=2},
+  {.offset=offsetof(SE_UsagePoint_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2, .width=2},
+  {.offset=offsetof(SE_UsagePoint_t,mRID), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,16), .n=1, .width=1},
+  {.offset=offsetof(SE_UsagePoint_t,description), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|xs_type(XS_STRING,32), .n=3, .width=2},
+  {.offset=offsetof(SE_UsagePoint_t,version), .min=0, .max=1, .bit=2, .type=ST_SIMPLE|XS_USHORT, .n=2, .width=2},
+  {.offset=offsetof(SE_UsagePoint_t,roleFlags), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,2), .n=1, .width=1},
+  {.offset=offsetof(SE_UsagePoint_t,serviceCategoryKind), .min=1, .max=1, .type=ST_SIMPLE|XS_UBYTE, .n=1, .width=1},
+  {.offset=offsetof(SE_UsagePoint_t,status), .min=1, .max=1, .type=ST_SIMPLE|XS_UBYTE, .n=1, .width=1},
+  {.offset=offsetof(SE_UsagePoint_t,deviceLFDI), .min=0, .max=1, .bit=3, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,20), .n=3, .width=2},
+  {.offset=offsetof(SE_UsagePoint_t,MeterReadingListLink), .min=0, .max=1, .bit=4, .index=893, .n=2, .width=2},
   // SupplyInterruptionOverrideListLink (906)
   {.size=sizeof(SE_SupplyInterruptionOverrideListLink_t), .index=451},
-  {.offset=offsetof(SE_SupplyInterruptionOverrideListLink_t,all), .min=0, .max=1, .attribute=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=2},
-  {.offset=offsetof(SE_SupplyInterruptionOverrideListLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1},
+  {.offset=offsetof(SE_SupplyInterruptionOverrideListLink_t,all), .min=0, .max=1, .attribute=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=2, .width=2},
+  {.offset=offsetof(SE_SupplyInterruptionOverrideListLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1, .width=1},
   // PrepayOperationStatusLink (909)
   {.size=sizeof(SE_PrepayOperationStatusLink_t), .index=449},
-  {.offset=offsetof(SE_PrepayOperationStatusLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1},
+  {.offset=offsetof(SE_PrepayOperationStatusLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1, .width=1},
   // CreditRegisterListLink (911)
   {.size=sizeof(SE_CreditRegisterListLink_t), .index=451},
-  {.offset=offsetof(SE_CreditRegisterListLink_t,all), .min=0, .max=1, .attribute=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=2},
-  {.offset=offsetof(SE_CreditRegisterListLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1},
+  {.offset=offsetof(SE_CreditRegisterListLink_t,all), .min=0, .max=1, .attribute=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=2, .width=2},
+  {.offset=offsetof(SE_CreditRegisterListLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1, .width=1},
   // RealEnergy (914)
   {.size=sizeof(SE_RealEnergy_t), .index=0},
-  {.offset=offsetof(SE_RealEnergy_t,multiplier), .min=1, .max=1, .type=ST_SIMPLE|XS_BYTE, .n=1},
-  {.offset=offsetof(SE_RealEnergy_t,value), .min=1, .max=1, .type=ST_SIMPLE|XS_ULONG, .n=1},
+  {.offset=offsetof(SE_RealEnergy_t,multiplier), .min=1, .max=1, .type=ST_SIMPLE|XS_BYTE, .n=1, .width=1},
+  {.offset=offsetof(SE_RealEnergy_t,value), .min=1, .max=1, .type=ST_SIMPLE|XS_ULONG, .n=1, .width=1},
   // AccountingUnit (917)
   {.size=sizeof(SE_AccountingUnit_t), .index=0},
-  {.offset=offsetof(SE_AccountingUnit_t,energyUnit), .min=0, .max=1, .bit=0, .index=914, .n=2},
-  {.offset=offsetof(SE_AccountingUnit_t,monetaryUnit), .min=1, .max=1, .type=ST_SIMPLE|XS_USHORT, .n=1},
-  {.offset=offsetof(SE_AccountingUnit_t,multiplier), .min=1, .max=1, .type=ST_SIMPLE|XS_BYTE, .n=1},
-  {.offset=offsetof(SE_AccountingUnit_t,value), .min=1, .max=1, .type=ST_SIMPLE|XS_INT, .n=1},
+  {.offset=offsetof(SE_AccountingUnit_t,energyUnit), .min=0, .max=1, .bit=0, .index=914, .n=2, .width=2},
+  {.offset=offsetof(SE_AccountingUnit_t,monetaryUnit), .min=1, .max=1, .type=ST_SIMPLE|XS_USHORT, .n=1, .width=1},
+  {.offset=offsetof(SE_AccountingUnit_t,multiplier), .min=1, .max=1, .type=ST_SIMPLE|XS_BYTE, .n=1, .width=1},
+  {.offset=offsetof(SE_AccountingUnit_t,value), .min=1, .max=1, .type=ST_SIMPLE|XS_INT, .n=1, .width=1},
   // ActiveSupplyInterruptionOverrideListLink (922)
   {.size=sizeof(SE_ActiveSupplyInterruptionOverrideListLink_t), .index=451},
-  {.offset=offsetof(SE_ActiveSupplyInterruptionOverrideListLink_t,all), .min=0, .max=1, .attribute=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=2},
-  {.offset=offsetof(SE_ActiveSupplyInterruptionOverrideListLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1},
+  {.offset=offsetof(SE_ActiveSupplyInterruptionOverrideListLink_t,all), .min=0, .max=1, .attribute=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=2, .width=2},
+  {.offset=offsetof(SE_ActiveSupplyInterruptionOverrideListLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1, .width=1},
   // ActiveCreditRegisterListLink (925)
   {.size=sizeof(SE_ActiveCreditRegisterListLink_t), .index=451},
-  {.offset=offsetof(SE_ActiveCreditRegisterListLink_t,all), .min=0, .max=1, .attribute=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=2},
-  {.offset=offsetof(SE_ActiveCreditRegisterListLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1},
+  {.offset=offsetof(SE_ActiveCreditRegisterListLink_t,all), .min=0, .max=1, .attribute=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=2, .width=2},
+  {.offset=offsetof(SE_ActiveCreditRegisterListLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1, .width=1},
   // AccountBalanceLink (928)
   {.size=sizeof(SE_AccountBalanceLink_t), .index=449},
-  {.offset=offsetof(SE_AccountBalanceLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1},
+  {.offset=offsetof(SE_AccountBalanceLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1, .width=1},
   // Prepayment (930)
   {.size=sizeof(SE_Prepayment_t), .index=368},
-  {.offset=offsetof(SE_Prepayment_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2},
-  {.offset=offsetof(SE_Prepayment_t,mRID), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,16), .n=1},
-  {.offset=offsetof(SE_Prepayment_t,description), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|xs_type(XS_STRING,32), .n=3},
-  {.offset=offsetof(SE_Prepayment_t,version), .min=0, .max=1, .bit=2, .type=ST_SIMPLE|XS_USHORT, .n=2},
-  {.offset=offsetof(SE_Prepayment_t,AccountBalanceLink), .min=1, .max=1, .index=928, .n=1},
-  {.offset=offsetof(SE_Prepayment_t,ActiveCreditRegisterListLink), .min=0, .max=1, .bit=3, .index=925, .n=4},
-  {.offset=offsetof(SE_Prepayment_t,ActiveSupplyInterruptionOverrideListLink), .min=0, .max=1, .bit=4, .index=922, .n=3},
-  {.offset=offsetof(SE_Prepayment_t,creditExpiryLevel), .min=0, .max=1, .bit=5, .index=917, .n=2},
-  {.offset=offsetof(SE_Prepayment_t,CreditRegisterListLink), .min=1, .max=1, .index=911, .n=1},
-  {.offset=offsetof(SE_Prepayment_t,lowCreditWarningLevel), .min=0, .max=1, .bit=6, .index=917, .n=3},
-  {.offset=offsetof(SE_Prepayment_t,lowEmergencyCreditWarningLevel), .min=0, .max=1, .bit=7, .index=917, .n=2},
-  {.offset=offsetof(SE_Prepayment_t,prepayMode), .min=1, .max=1, .type=ST_SIMPLE|XS_UBYTE, .n=1},
-  {.offset=offsetof(SE_Prepayment_t,PrepayOperationStatusLink), .min=1, .max=1, .index=909, .n=1},
-  {.offset=offsetof(SE_Prepayment_t,SupplyInterruptionOverrideListLink), .min=1, .max=1, .index=906, .n=1},
-  {.offset=offsetof(SE_Prepayment_t,UsagePoint), .min=0, .unbounded=1, .index=896, .n=3},
-  {.offset=offsetof(SE_Prepayment_t,UsagePointLink), .min=0, .max=1, .bit=14, .index=891, .n=2},
+  {.offset=offsetof(SE_Prepayment_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2, .width=2},
+  {.offset=offsetof(SE_Prepayment_t,mRID), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,16), .n=1, .width=1},
+  {.offset=offsetof(SE_Prepayment_t,description), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|xs_type(XS_STRING,32), .n=3, .width=2},
+  {.offset=offsetof(SE_Prepayment_t,version), .min=0, .max=1, .bit=2, .type=ST_SIMPLE|XS_USHORT, .n=2, .width=2},
+  {.offset=offsetof(SE_Prepayment_t,AccountBalanceLink), .min=1, .max=1, .index=928, .n=1, .width=1},
+  {.offset=offsetof(SE_Prepayment_t,ActiveCreditRegisterListLink), .min=0, .max=1, .bit=3, .index=925, .n=4, .width=3},
+  {.offset=offsetof(SE_Prepayment_t,ActiveSupplyInterruptionOverrideListLink), .min=0, .max=1, .bit=4, .index=922, .n=3, .width=2},
+  {.offset=offsetof(SE_Prepayment_t,creditExpiryLevel), .min=0, .max=1, .bit=5, .index=917, .n=2, .width=2},
+  {.offset=offsetof(SE_Prepayment_t,CreditRegisterListLink), .min=1, .max=1, .index=911, .n=1, .width=1},
+  {.offset=offsetof(SE_Prepayment_t,lowCreditWarningLevel), .min=0, .max=1, .bit=6, .index=917, .n=3, .width=2},
+  {.offset=offsetof(SE_Prepayment_t,lowEmergencyCreditWarningLevel), .min=0, .max=1, .bit=7, .index=917, .n=2, .width=2},
+  {.offset=offsetof(SE_Prepayment_t,prepayMode), .min=1, .max=1, .type=ST_SIMPLE|XS_UBYTE, .n=1, .width=1},
+  {.offset=offsetof(SE_Prepayment_t,PrepayOperationStatusLink), .min=1, .max=1, .index=909, .n=1, .width=1},
+  {.offset=offsetof(SE_Prepayment_t,SupplyInterruptionOverrideListLink), .min=1, .max=1, .index=906, .n=1, .width=1},
+  {.offset=offsetof(SE_Prepayment_t,UsagePoint), .min=0, .unbounded=1, .index=896, .n=3, .width=2},
+  {.offset=offsetof(SE_Prepayment_t,UsagePointLink), .min=0, .max=1, .bit=14, .index=891, .n=2, .width=2},
   // PrepaymentList (947)
   {.size=sizeof(SE_PrepaymentList_t), .index=543},
-  {.offset=offsetof(SE_PrepaymentList_t,all), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1},
-  {.offset=offsetof(SE_PrepaymentList_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=3},
-  {.offset=offsetof(SE_PrepaymentList_t,pollRate), .min=0, .max=1, .attribute=1, .bit=18, .type=ST_SIMPLE|XS_UINT, .n=2},
-  {.offset=offsetof(SE_PrepaymentList_t,results), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1},
-  {.offset=offsetof(SE_PrepaymentList_t,subscribable), .min=0, .max=1, .attribute=1, .bit=1, .type=ST_SIMPLE|XS_UBYTE, .n=3},
-  {.offset=offsetof(SE_PrepaymentList_t,Prepayment), .min=0, .unbounded=1, .index=930, .n=2},
+  {.offset=offsetof(SE_PrepaymentList_t,all), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1, .width=1},
+  {.offset=offsetof(SE_PrepaymentList_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=3, .width=2},
+  {.offset=offsetof(SE_PrepaymentList_t,pollRate), .min=0, .max=1, .attribute=1, .bit=18, .type=ST_SIMPLE|XS_UINT, .n=2, .width=2},
+  {.offset=offsetof(SE_PrepaymentList_t,results), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1, .width=1},
+  {.offset=offsetof(SE_PrepaymentList_t,subscribable), .min=0, .max=1, .attribute=1, .bit=1, .type=ST_SIMPLE|XS_UBYTE, .n=3, .width=2},
+  {.offset=offsetof(SE_PrepaymentList_t,Prepayment), .min=0, .unbounded=1, .index=930, .n=2, .width=2},
   // CreditRegister (954)
   {.size=sizeof(SE_CreditRegister_t), .index=368},
-  {.offset=offsetof(SE_CreditRegister_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2},
-  {.offset=offsetof(SE_CreditRegister_t,mRID), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,16), .n=1},
-  {.offset=offsetof(SE_CreditRegister_t,description), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|xs_type(XS_STRING,32), .n=3},
-  {.offset=offsetof(SE_CreditRegister_t,version), .min=0, .max=1, .bit=2, .type=ST_SIMPLE|XS_USHORT, .n=2},
-  {.offset=offsetof(SE_CreditRegister_t,creditAmount), .min=1, .max=1, .index=917, .n=1},
-  {.offset=offsetof(SE_CreditRegister_t,creditType), .min=0, .max=1, .bit=3, .type=ST_SIMPLE|XS_UBYTE, .n=2},
-  {.offset=offsetof(SE_CreditRegister_t,effectiveTime), .min=1, .max=1, .type=ST_SIMPLE|XS_LONG, .n=1},
-  {.offset=offsetof(SE_CreditRegister_t,token), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_STRING,32), .n=1},
+  {.offset=offsetof(SE_CreditRegister_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2, .width=2},
+  {.offset=offsetof(SE_CreditRegister_t,mRID), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,16), .n=1, .width=1},
+  {.offset=offsetof(SE_CreditRegister_t,description), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|xs_type(XS_STRING,32), .n=3, .width=2},
+  {.offset=offsetof(SE_CreditRegister_t,version), .min=0, .max=1, .bit=2, .type=ST_SIMPLE|XS_USHORT, .n=2, .width=2},
+  {.offset=offsetof(SE_CreditRegister_t,creditAmount), .min=1, .max=1, .index=917, .n=1, .width=1},
+  {.offset=offsetof(SE_CreditRegister_t,creditType), .min=0, .max=1, .bit=3, .type=ST_SIMPLE|XS_UBYTE, .n=2, .width=2},
+  {.offset=offsetof(SE_CreditRegister_t,effectiveTime), .min=1, .max=1, .type=ST_SIMPLE|XS_LONG, .n=1, .width=1},
+  {.offset=offsetof(SE_CreditRegister_t,token), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_STRING,32), .n=1, .width=1},
   // CreditRegisterList (963)
   {.size=sizeof(SE_CreditRegisterList_t), .index=420},
-  {.offset=offsetof(SE_CreditRegisterList_t,all), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1},
-  {.offset=offsetof(SE_CreditRegisterList_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2},
-  {.offset=offsetof(SE_CreditRegisterList_t,results), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1},
-  {.offset=offsetof(SE_CreditRegisterList_t,CreditRegister), .min=0, .unbounded=1, .index=954, .n=2},
+  {.offset=offsetof(SE_CreditRegisterList_t,all), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1, .width=1},
+  {.offset=offsetof(SE_CreditRegisterList_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2, .width=2},
+  {.offset=offsetof(SE_CreditRegisterList_t,results), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1, .width=1},
+  {.offset=offsetof(SE_CreditRegisterList_t,CreditRegister), .min=0, .unbounded=1, .index=954, .n=2, .width=2},
   // AccountBalance (968)
   {.size=sizeof(SE_AccountBalance_t), .index=328},
-  {.offset=offsetof(SE_AccountBalance_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2},
-  {.offset=offsetof(SE_AccountBalance_t,availableCredit), .min=1, .max=1, .index=917, .n=1},
-  {.offset=offsetof(SE_AccountBalance_t,creditStatus), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|XS_UBYTE, .n=4},
-  {.offset=offsetof(SE_AccountBalance_t,emergencyCredit), .min=0, .max=1, .bit=1, .index=917, .n=3},
-  {.offset=offsetof(SE_AccountBalance_t,emergencyCreditStatus), .min=0, .max=1, .bit=2, .type=ST_SIMPLE|XS_UBYTE, .n=2},
+  {.offset=offsetof(SE_AccountBalance_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2, .width=2},
+  {.offset=offsetof(SE_AccountBalance_t,availableCredit), .min=1, .max=1, .index=917, .n=1, .width=1},
+  {.offset=offsetof(SE_AccountBalance_t,creditStatus), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|XS_UBYTE, .n=4, .width=3},
+  {.offset=offsetof(SE_AccountBalance_t,emergencyCredit), .min=0, .max=1, .bit=1, .index=917, .n=3, .width=2},
+  {.offset=offsetof(SE_AccountBalance_t,emergencyCreditStatus), .min=0, .max=1, .bit=2, .type=ST_SIMPLE|XS_UBYTE, .n=2, .width=2},
   // ServiceSupplier (974)
   {.size=sizeof(SE_ServiceSupplier_t), .index=368},
-  {.offset=offsetof(SE_ServiceSupplier_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2},
-  {.offset=offsetof(SE_ServiceSupplier_t,mRID), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,16), .n=1},
-  {.offset=offsetof(SE_ServiceSupplier_t,description), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|xs_type(XS_STRING,32), .n=7},
-  {.offset=offsetof(SE_ServiceSupplier_t,version), .min=0, .max=1, .bit=2, .type=ST_SIMPLE|XS_USHORT, .n=6},
-  {.offset=offsetof(SE_ServiceSupplier_t,email), .min=0, .max=1, .bit=3, .type=ST_SIMPLE|xs_type(XS_STRING,32), .n=5},
-  {.offset=offsetof(SE_ServiceSupplier_t,phone), .min=0, .max=1, .bit=4, .type=ST_SIMPLE|xs_type(XS_STRING,20), .n=4},
-  {.offset=offsetof(SE_ServiceSupplier_t,providerID), .min=0, .max=1, .bit=5, .type=ST_SIMPLE|XS_UINT, .n=3},
-  {.offset=offsetof(SE_ServiceSupplier_t,web), .min=0, .max=1, .bit=6, .type=ST_SIMPLE|xs_type(XS_STRING,42), .n=2},
+  {.offset=offsetof(SE_ServiceSupplier_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2, .width=2},
+  {.offset=offsetof(SE_ServiceSupplier_t,mRID), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,16), .n=1, .width=1},
+  {.offset=offsetof(SE_ServiceSupplier_t,description), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|xs_type(XS_STRING,32), .n=7, .width=3},
+  {.offset=offsetof(SE_ServiceSupplier_t,version), .min=0, .max=1, .bit=2, .type=ST_SIMPLE|XS_USHORT, .n=6, .width=3},
+  {.offset=offsetof(SE_ServiceSupplier_t,email), .min=0, .max=1, .bit=3, .type=ST_SIMPLE|xs_type(XS_STRING,32), .n=5, .width=3},
+  {.offset=offsetof(SE_ServiceSupplier_t,phone), .min=0, .max=1, .bit=4, .type=ST_SIMPLE|xs_type(XS_STRING,20), .n=4, .width=3},
+  {.offset=offsetof(SE_ServiceSupplier_t,providerID), .min=0, .max=1, .bit=5, .type=ST_SIMPLE|XS_UINT, .n=3, .width=2},
+  {.offset=offsetof(SE_ServiceSupplier_t,web), .min=0, .max=1, .bit=6, .type=ST_SIMPLE|xs_type(XS_STRING,42), .n=2, .width=2},
   // ServiceSupplierList (983)
   {.size=sizeof(SE_ServiceSupplierList_t), .index=420},
-  {.offset=offsetof(SE_ServiceSupplierList_t,all), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1},
-  {.offset=offsetof(SE_ServiceSupplierList_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2},
-  {.offset=offsetof(SE_ServiceSupplierList_t,results), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1},
-  {.offset=offsetof(SE_ServiceSupplierList_t,ServiceSupplier), .min=0, .unbounded=1, .index=974, .n=2},
+  {.offset=offsetof(SE_ServiceSupplierList_t,all), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1, .width=1},
+  {.offset=offsetof(SE_ServiceSupplierList_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2, .width=2},
+  {.offset=offsetof(SE_ServiceSupplierList_t,results), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1, .width=1},
+  {.offset=offsetof(SE_ServiceSupplierList_t,ServiceSupplier), .min=0, .unbounded=1, .index=974, .n=2, .width=2},
   // ReadingTypeLink (988)
   {.size=sizeof(SE_ReadingTypeLink_t), .index=449},
-  {.offset=offsetof(SE_ReadingTypeLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1},
+  {.offset=offsetof(SE_ReadingTypeLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1, .width=1},
   // BillingReadingSetListLink (990)
   {.size=sizeof(SE_BillingReadingSetListLink_t), .index=451},
-  {.offset=offsetof(SE_BillingReadingSetListLink_t,all), .min=0, .max=1, .attribute=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=2},
-  {.offset=offsetof(SE_BillingReadingSetListLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1},
+  {.offset=offsetof(SE_BillingReadingSetListLink_t,all), .min=0, .max=1, .attribute=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=2, .width=2},
+  {.offset=offsetof(SE_BillingReadingSetListLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1, .width=1},
   // BillingMeterReadingBase (993)
   {.size=sizeof(SE_BillingMeterReadingBase_t), .index=386},
-  {.offset=offsetof(SE_BillingMeterReadingBase_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2},
-  {.offset=offsetof(SE_BillingMeterReadingBase_t,mRID), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,16), .n=1},
-  {.offset=offsetof(SE_BillingMeterReadingBase_t,description), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|xs_type(XS_STRING,32), .n=5},
-  {.offset=offsetof(SE_BillingMeterReadingBase_t,version), .min=0, .max=1, .bit=2, .type=ST_SIMPLE|XS_USHORT, .n=4},
-  {.offset=offsetof(SE_BillingMeterReadingBase_t,BillingReadingSetListLink), .min=0, .max=1, .bit=3, .index=990, .n=3},
-  {.offset=offsetof(SE_BillingMeterReadingBase_t,ReadingTypeLink), .min=0, .max=1, .bit=4, .index=988, .n=2},
+  {.offset=offsetof(SE_BillingMeterReadingBase_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2, .width=2},
+  {.offset=offsetof(SE_BillingMeterReadingBase_t,mRID), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,16), .n=1, .width=1},
+  {.offset=offsetof(SE_BillingMeterReadingBase_t,description), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|xs_type(XS_STRING,32), .n=5, .width=3},
+  {.offset=offsetof(SE_BillingMeterReadingBase_t,version), .min=0, .max=1, .bit=2, .type=ST_SIMPLE|XS_USHORT, .n=4, .width=3},
+  {.offset=offsetof(SE_BillingMeterReadingBase_t,BillingReadingSetListLink), .min=0, .max=1, .bit=3, .index=990, .n=3, .width=2},
+  {.offset=offsetof(SE_BillingMeterReadingBase_t,ReadingTypeLink), .min=0, .max=1, .bit=4, .index=988, .n=2, .width=2},
   // TargetReading (1000)
   {.size=sizeof(SE_TargetReading_t), .index=993},
-  {.offset=offsetof(SE_TargetReading_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2},
-  {.offset=offsetof(SE_TargetReading_t,mRID), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,16), .n=1},
-  {.offset=offsetof(SE_TargetReading_t,description), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|xs_type(XS_STRING,32), .n=5},
-  {.offset=offsetof(SE_TargetReading_t,version), .min=0, .max=1, .bit=2, .type=ST_SIMPLE|XS_USHORT, .n=4},
-  {.offset=offsetof(SE_TargetReading_t,BillingReadingSetListLink), .min=0, .max=1, .bit=3, .index=990, .n=3},
-  {.offset=offsetof(SE_TargetReading_t,ReadingTypeLink), .min=0, .max=1, .bit=4, .index=988, .n=2},
+  {.offset=offsetof(SE_TargetReading_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2, .width=2},
+  {.offset=offsetof(SE_TargetReading_t,mRID), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,16), .n=1, .width=1},
+  {.offset=offsetof(SE_TargetReading_t,description), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|xs_type(XS_STRING,32), .n=5, .width=3},
+  {.offset=offsetof(SE_TargetReading_t,version), .min=0, .max=1, .bit=2, .type=ST_SIMPLE|XS_USHORT, .n=4, .width=3},
+  {.offset=offsetof(SE_TargetReading_t,BillingReadingSetListLink), .min=0, .max=1, .bit=3, .index=990, .n=3, .width=2},
+  {.offset=offsetof(SE_TargetReading_t,ReadingTypeLink), .min=0, .max=1, .bit=4, .index=988, .n=2, .width=2},
   // TargetReadingList (1007)
   {.size=sizeof(SE_TargetReadingList_t), .index=420},
-  {.offset=offsetof(SE_TargetReadingList_t,all), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1},
-  {.offset=offsetof(SE_TargetReadingList_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2},
-  {.offset=offsetof(SE_TargetReadingList_t,results), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1},
-  {.offset=offsetof(SE_TargetReadingList_t,TargetReading), .min=0, .unbounded=1, .index=1000, .n=2},
+  {.offset=offsetof(SE_TargetReadingList_t,all), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1, .width=1},
+  {.offset=offsetof(SE_TargetReadingList_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2, .width=2},
+  {.offset=offsetof(SE_TargetReadingList_t,results), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1, .width=1},
+  {.offset=offsetof(SE_TargetReadingList_t,TargetReading), .min=0, .unbounded=1, .index=1000, .n=2, .width=2},
   // ProjectionReading (1012)
   {.size=sizeof(SE_ProjectionReading_t), .index=993},
-  {.offset=offsetof(SE_ProjectionReading_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2},
-  {.offset=offsetof(SE_ProjectionReading_t,mRID), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,16), .n=1},
-  {.offset=offsetof(SE_ProjectionReading_t,description), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|xs_type(XS_STRING,32), .n=5},
-  {.offset=offsetof(SE_ProjectionReading_t,version), .min=0, .max=1, .bit=2, .type=ST_SIMPLE|XS_USHORT, .n=4},
-  {.offset=offsetof(SE_ProjectionReading_t,BillingReadingSetListLink), .min=0, .max=1, .bit=3, .index=990, .n=3},
-  {.offset=offsetof(SE_ProjectionReading_t,ReadingTypeLink), .min=0, .max=1, .bit=4, .index=988, .n=2},
+  {.offset=offsetof(SE_ProjectionReading_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2, .width=2},
+  {.offset=offsetof(SE_ProjectionReading_t,mRID), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,16), .n=1, .width=1},
+  {.offset=offsetof(SE_ProjectionReading_t,description), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|xs_type(XS_STRING,32), .n=5, .width=3},
+  {.offset=offsetof(SE_ProjectionReading_t,version), .min=0, .max=1, .bit=2, .type=ST_SIMPLE|XS_USHORT, .n=4, .width=3},
+  {.offset=offsetof(SE_ProjectionReading_t,BillingReadingSetListLink), .min=0, .max=1, .bit=3, .index=990, .n=3, .width=2},
+  {.offset=offsetof(SE_ProjectionReading_t,ReadingTypeLink), .min=0, .max=1, .bit=4, .index=988, .n=2, .width=2},
   // ProjectionReadingList (1019)
   {.size=sizeof(SE_ProjectionReadingList_t), .index=420},
-  {.offset=offsetof(SE_ProjectionReadingList_t,all), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1},
-  {.offset=offsetof(SE_ProjectionReadingList_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2},
-  {.offset=offsetof(SE_ProjectionReadingList_t,results), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1},
-  {.offset=offsetof(SE_ProjectionReadingList_t,ProjectionReading), .min=0, .unbounded=1, .index=1012, .n=2},
+  {.offset=offsetof(SE_ProjectionReadingList_t,all), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1, .width=1},
+  {.offset=offsetof(SE_ProjectionReadingList_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2, .width=2},
+  {.offset=offsetof(SE_ProjectionReadingList_t,results), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1, .width=1},
+  {.offset=offsetof(SE_ProjectionReadingList_t,ProjectionReading), .min=0, .unbounded=1, .index=1012, .n=2, .width=2},
   // HistoricalReading (1024)
   {.size=sizeof(SE_HistoricalReading_t), .index=993},
-  {.offset=offsetof(SE_HistoricalReading_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2},
-  {.offset=offsetof(SE_HistoricalReading_t,mRID), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,16), .n=1},
-  {.offset=offsetof(SE_HistoricalReading_t,description), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|xs_type(XS_STRING,32), .n=5},
-  {.offset=offsetof(SE_HistoricalReading_t,version), .min=0, .max=1, .bit=2, .type=ST_SIMPLE|XS_USHORT, .n=4},
-  {.offset=offsetof(SE_HistoricalReading_t,BillingReadingSetListLink), .min=0, .max=1, .bit=3, .index=990, .n=3},
-  {.offset=offsetof(SE_HistoricalReading_t,ReadingTypeLink), .min=0, .max=1, .bit=4, .index=988, .n=2},
+  {.offset=offsetof(SE_HistoricalReading_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2, .width=2},
+  {.offset=offsetof(SE_HistoricalReading_t,mRID), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,16), .n=1, .width=1},
+  {.offset=offsetof(SE_HistoricalReading_t,description), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|xs_type(XS_STRING,32), .n=5, .width=3},
+  {.offset=offsetof(SE_HistoricalReading_t,version), .min=0, .max=1, .bit=2, .type=ST_SIMPLE|XS_USHORT, .n=4, .width=3},
+  {.offset=offsetof(SE_HistoricalReading_t,BillingReadingSetListLink), .min=0, .max=1, .bit=3, .index=990, .n=3, .width=2},
+  {.offset=offsetof(SE_HistoricalReading_t,ReadingTypeLink), .min=0, .max=1, .bit=4, .index=988, .n=2, .width=2},
   // HistoricalReadingList (1031)
   {.size=sizeof(SE_HistoricalReadingList_t), .index=420},
-  {.offset=offsetof(SE_HistoricalReadingList_t,all), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1},
-  {.offset=offsetof(SE_HistoricalReadingList_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2},
-  {.offset=offsetof(SE_HistoricalReadingList_t,results), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1},
-  {.offset=offsetof(SE_HistoricalReadingList_t,HistoricalReading), .min=0, .unbounded=1, .index=1024, .n=2},
+  {.offset=offsetof(SE_HistoricalReadingList_t,all), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1, .width=1},
+  {.offset=offsetof(SE_HistoricalReadingList_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2, .width=2},
+  {.offset=offsetof(SE_HistoricalReadingList_t,results), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1, .width=1},
+  {.offset=offsetof(SE_HistoricalReadingList_t,HistoricalReading), .min=0, .unbounded=1, .index=1024, .n=2, .width=2},
   // TariffProfileLink (1036)
   {.size=sizeof(SE_TariffProfileLink_t), .index=449},
-  {.offset=offsetof(SE_TariffProfileLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1},
+  {.offset=offsetof(SE_TariffProfileLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1, .width=1},
   // TargetReadingListLink (1038)
   {.size=sizeof(SE_TargetReadingListLink_t), .index=451},
-  {.offset=offsetof(SE_TargetReadingListLink_t,all), .min=0, .max=1, .attribute=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=2},
-  {.offset=offsetof(SE_TargetReadingListLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1},
+  {.offset=offsetof(SE_TargetReadingListLink_t,all), .min=0, .max=1, .attribute=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=2, .width=2},
+  {.offset=offsetof(SE_TargetReadingListLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1, .width=1},
   // ProjectionReadingListLink (1041)
   {.size=sizeof(SE_ProjectionReadingListLink_t), .index=451},
-  {.offset=offsetof(SE_ProjectionReadingListLink_t,all), .min=0, .max=1, .attribute=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=2},
-  {.offset=offsetof(SE_ProjectionReadingListLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1},
+  {.offset=offsetof(SE_ProjectionReadingListLink_t,all), .min=0, .max=1, .attribute=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=2, .width=2},
+  {.offset=offsetof(SE_ProjectionReadingListLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1, .width=1},
   // PrepaymentLink (1044)
   {.size=sizeof(SE_PrepaymentLink_t), .index=449},
-  {.offset=offsetof(SE_PrepaymentLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1},
+  {.offset=offsetof(SE_PrepaymentLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1, .width=1},
   // HistoricalReadingListLink (1046)
   {.size=sizeof(SE_HistoricalReadingListLink_t), .index=451},
-  {.offset=offsetof(SE_HistoricalReadingListLink_t,all), .min=0, .max=1, .attribute=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=2},
-  {.offset=offsetof(SE_HistoricalReadingListLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1},
+  {.offset=offsetof(SE_HistoricalReadingListLink_t,all), .min=0, .max=1, .attribute=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=2, .width=2},
+  {.offset=offsetof(SE_HistoricalReadingListLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1, .width=1},
   // BillingPeriodListLink (1049)
   {.size=sizeof(SE_BillingPeriodListLink_t), .index=451},
-  {.offset=offsetof(SE_BillingPeriodListLink_t,all), .min=0, .max=1, .attribute=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=2},
-  {.offset=offsetof(SE_BillingPeriodListLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1},
+  {.offset=offsetof(SE_BillingPeriodListLink_t,all), .min=0, .max=1, .attribute=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=2, .width=2},
+  {.offset=offsetof(SE_BillingPeriodListLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1, .width=1},
   // ActiveTargetReadingListLink (1052)
   {.size=sizeof(SE_ActiveTargetReadingListLink_t), .index=451},
-  {.offset=offsetof(SE_ActiveTargetReadingListLink_t,all), .min=0, .max=1, .attribute=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=2},
-  {.offset=offsetof(SE_ActiveTargetReadingListLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1},
+  {.offset=offsetof(SE_ActiveTargetReadingListLink_t,all), .min=0, .max=1, .attribute=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=2, .width=2},
+  {.offset=offsetof(SE_ActiveTargetReadingListLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1, .width=1},
   // ActiveProjectionReadingListLink (1055)
   {.size=sizeof(SE_ActiveProjectionReadingListLink_t), .index=451},
-  {.offset=offsetof(SE_ActiveProjectionReadingListLink_t,all), .min=0, .max=1, .attribute=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=2},
-  {.offset=offsetof(SE_ActiveProjectionReadingListLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1},
+  {.offset=offsetof(SE_ActiveProjectionReadingListLink_t,all), .min=0, .max=1, .attribute=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=2, .width=2},
+  {.offset=offsetof(SE_ActiveProjectionReadingListLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1, .width=1},
   // ActiveBillingPeriodListLink (1058)
   {.size=sizeof(SE_ActiveBillingPeriodListLink_t), .index=451},
-  {.offset=offsetof(SE_ActiveBillingPeriodListLink_t,all), .min=0, .max=1, .attribute=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=2},
-  {.offset=offsetof(SE_ActiveBillingPeriodListLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1},
+  {.offset=offsetof(SE_ActiveBillingPeriodListLink_t,all), .min=0, .max=1, .attribute=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=2, .width=2},
+  {.offset=offsetof(SE_ActiveBillingPeriodListLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1, .width=1},
   // CustomerAgreement (1061)
   {.size=sizeof(SE_CustomerAgreement_t), .index=368},
-  {.offset=offsetof(SE_CustomerAgreement_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2},
-  {.offset=offsetof(SE_CustomerAgreement_t,mRID), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,16), .n=1},
-  {.offset=offsetof(SE_CustomerAgreement_t,description), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|xs_type(XS_STRING,32), .n=15},
-  {.offset=offsetof(SE_CustomerAgreement_t,version), .min=0, .max=1, .bit=2, .type=ST_SIMPLE|XS_USHORT, .n=14},
-  {.offset=offsetof(SE_CustomerAgreement_t,ActiveBillingPeriodListLink), .min=0, .max=1, .bit=3, .index=1058, .n=13},
-  {.offset=offsetof(SE_CustomerAgreement_t,ActiveProjectionReadingListLink), .min=0, .max=1, .bit=4, .index=1055, .n=12},
-  {.offset=offsetof(SE_CustomerAgreement_t,ActiveTargetReadingListLink), .min=0, .max=1, .bit=5, .index=1052, .n=11},
-  {.offset=offsetof(SE_CustomerAgreement_t,BillingPeriodListLink), .min=0, .max=1, .bit=6, .index=1049, .n=10},
-  {.offset=offsetof(SE_CustomerAgreement_t,HistoricalReadingListLink), .min=0, .max=1, .bit=7, .index=1046, .n=9},
-  {.offset=offsetof(SE_CustomerAgreement_t,PrepaymentLink), .min=0, .max=1, .bit=8, .index=1044, .n=8},
-  {.offset=offsetof(SE_CustomerAgreement_t,ProjectionReadingListLink), .min=0, .max=1, .bit=9, .index=1041, .n=7},
-  {.offset=offsetof(SE_CustomerAgreement_t,serviceAccount), .min=0, .max=1, .bit=10, .type=ST_SIMPLE|xs_type(XS_STRING,42), .n=6},
-  {.offset=offsetof(SE_CustomerAgreement_t,serviceLocation), .min=0, .max=1, .bit=11, .type=ST_SIMPLE|xs_type(XS_STRING,42), .n=5},
-  {.offset=offsetof(SE_CustomerAgreement_t,TargetReadingListLink), .min=0, .max=1, .bit=12, .index=1038, .n=4},
-  {.offset=offsetof(SE_CustomerAgreement_t,TariffProfileLink), .min=0, .max=1, .bit=13, .index=1036, .n=3},
-  {.offset=offsetof(SE_CustomerAgreement_t,UsagePointLink), .min=0, .max=1, .bit=14, .index=891, .n=2},
+  {.offset=offsetof(SE_CustomerAgreement_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2, .width=2},
+  {.offset=offsetof(SE_CustomerAgreement_t,mRID), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,16), .n=1, .width=1},
+  {.offset=offsetof(SE_CustomerAgreement_t,description), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|xs_type(XS_STRING,32), .n=15, .width=4},
+  {.offset=offsetof(SE_CustomerAgreement_t,version), .min=0, .max=1, .bit=2, .type=ST_SIMPLE|XS_USHORT, .n=14, .width=4},
+  {.offset=offsetof(SE_CustomerAgreement_t,ActiveBillingPeriodListLink), .min=0, .max=1, .bit=3, .index=1058, .n=13, .width=4},
+  {.offset=offsetof(SE_CustomerAgreement_t,ActiveProjectionReadingListLink), .min=0, .max=1, .bit=4, .index=1055, .n=12, .width=4},
+  {.offset=offsetof(SE_CustomerAgreement_t,ActiveTargetReadingListLink), .min=0, .max=1, .bit=5, .index=1052, .n=11, .width=4},
+  {.offset=offsetof(SE_CustomerAgreement_t,BillingPeriodListLink), .min=0, .max=1, .bit=6, .index=1049, .n=10, .width=4},
+  {.offset=offsetof(SE_CustomerAgreement_t,HistoricalReadingListLink), .min=0, .max=1, .bit=7, .index=1046, .n=9, .width=4},
+  {.offset=offsetof(SE_CustomerAgreement_t,PrepaymentLink), .min=0, .max=1, .bit=8, .index=1044, .n=8, .width=4},
+  {.offset=offsetof(SE_CustomerAgreement_t,ProjectionReadingListLink), .min=0, .max=1, .bit=9, .index=1041, .n=7, .width=3},
+  {.offset=offsetof(SE_CustomerAgreement_t,serviceAccount), .min=0, .max=1, .bit=10, .type=ST_SIMPLE|xs_type(XS_STRING,42), .n=6, .width=3},
+  {.offset=offsetof(SE_CustomerAgreement_t,serviceLocation), .min=0, .max=1, .bit=11, .type=ST_SIMPLE|xs_type(XS_STRING,42), .n=5, .width=3},
+  {.offset=offsetof(SE_CustomerAgreement_t,TargetReadingListLink), .min=0, .max=1, .bit=12, .index=1038, .n=4, .width=3},
+  {.offset=offsetof(SE_CustomerAgreement_t,TariffProfileLink), .min=0, .max=1, .bit=13, .index=1036, .n=3, .width=2},
+  {.offset=offsetof(SE_CustomerAgreement_t,UsagePointLink), .min=0, .max=1, .bit=14, .index=891, .n=2, .width=2},
   // CustomerAgreementList (1078)
   {.size=sizeof(SE_CustomerAgreementList_t), .index=543},
-  {.offset=offsetof(SE_CustomerAgreementList_t,all), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1},
-  {.offset=offsetof(SE_CustomerAgreementList_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2},
-  {.offset=offsetof(SE_CustomerAgreementList_t,results), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1},
-  {.offset=offsetof(SE_CustomerAgreementList_t,subscribable), .min=0, .max=1, .attribute=1, .bit=1, .type=ST_SIMPLE|XS_UBYTE, .n=3},
-  {.offset=offsetof(SE_CustomerAgreementList_t,CustomerAgreement), .min=0, .unbounded=1, .index=1061, .n=2},
+  {.offset=offsetof(SE_CustomerAgreementList_t,all), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1, .width=1},
+  {.offset=offsetof(SE_CustomerAgreementList_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2, .width=2},
+  {.offset=offsetof(SE_CustomerAgreementList_t,results), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1, .width=1},
+  {.offset=offsetof(SE_CustomerAgreementList_t,subscribable), .min=0, .max=1, .attribute=1, .bit=1, .type=ST_SIMPLE|XS_UBYTE, .n=3, .width=2},
+  {.offset=offsetof(SE_CustomerAgreementList_t,CustomerAgreement), .min=0, .unbounded=1, .index=1061, .n=2, .width=2},
   // ServiceSupplierLink (1084)
   {.size=sizeof(SE_ServiceSupplierLink_t), .index=449},
-  {.offset=offsetof(SE_ServiceSupplierLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1},
+  {.offset=offsetof(SE_ServiceSupplierLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1, .width=1},
   // CustomerAgreementListLink (1086)
   {.size=sizeof(SE_CustomerAgreementListLink_t), .index=451},
-  {.offset=offsetof(SE_CustomerAgreementListLink_t,all), .min=0, .max=1, .attribute=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=2},
-  {.offset=offsetof(SE_CustomerAgreementListLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1},
+  {.offset=offsetof(SE_CustomerAgreementListLink_t,all), .min=0, .max=1, .attribute=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=2, .width=2},
+  {.offset=offsetof(SE_CustomerAgreementListLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1, .width=1},
   // CustomerAccount (1089)
   {.size=sizeof(SE_CustomerAccount_t), .index=368},
-  {.offset=offsetof(SE_CustomerAccount_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2},
-  {.offset=offsetof(SE_CustomerAccount_t,mRID), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,16), .n=1},
-  {.offset=offsetof(SE_CustomerAccount_t,description), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|xs_type(XS_STRING,32), .n=3},
-  {.offset=offsetof(SE_CustomerAccount_t,version), .min=0, .max=1, .bit=2, .type=ST_SIMPLE|XS_USHORT, .n=2},
-  {.offset=offsetof(SE_CustomerAccount_t,currency), .min=1, .max=1, .type=ST_SIMPLE|XS_USHORT, .n=1},
-  {.offset=offsetof(SE_CustomerAccount_t,customerAccount), .min=0, .max=1, .bit=3, .type=ST_SIMPLE|xs_type(XS_STRING,42), .n=4},
-  {.offset=offsetof(SE_CustomerAccount_t,CustomerAgreementListLink), .min=0, .max=1, .bit=4, .index=1086, .n=3},
-  {.offset=offsetof(SE_CustomerAccount_t,customerName), .min=0, .max=1, .bit=5, .type=ST_SIMPLE|xs_type(XS_STRING,42), .n=2},
-  {.offset=offsetof(SE_CustomerAccount_t,pricePowerOfTenMultiplier), .min=1, .max=1, .type=ST_SIMPLE|XS_BYTE, .n=1},
-  {.offset=offsetof(SE_CustomerAccount_t,ServiceSupplierLink), .min=0, .max=1, .bit=6, .index=1084, .n=2},
+  {.offset=offsetof(SE_CustomerAccount_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2, .width=2},
+  {.offset=offsetof(SE_CustomerAccount_t,mRID), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,16), .n=1, .width=1},
+  {.offset=offsetof(SE_CustomerAccount_t,description), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|xs_type(XS_STRING,32), .n=3, .width=2},
+  {.offset=offsetof(SE_CustomerAccount_t,version), .min=0, .max=1, .bit=2, .type=ST_SIMPLE|XS_USHORT, .n=2, .width=2},
+  {.offset=offsetof(SE_CustomerAccount_t,currency), .min=1, .max=1, .type=ST_SIMPLE|XS_USHORT, .n=1, .width=1},
+  {.offset=offsetof(SE_CustomerAccount_t,customerAccount), .min=0, .max=1, .bit=3, .type=ST_SIMPLE|xs_type(XS_STRING,42), .n=4, .width=3},
+  {.offset=offsetof(SE_CustomerAccount_t,CustomerAgreementListLink), .min=0, .max=1, .bit=4, .index=1086, .n=3, .width=2},
+  {.offset=offsetof(SE_CustomerAccount_t,customerName), .min=0, .max=1, .bit=5, .type=ST_SIMPLE|xs_type(XS_STRING,42), .n=2, .width=2},
+  {.offset=offsetof(SE_CustomerAccount_t,pricePowerOfTenMultiplier), .min=1, .max=1, .type=ST_SIMPLE|XS_BYTE, .n=1, .width=1},
+  {.offset=offsetof(SE_CustomerAccount_t,ServiceSupplierLink), .min=0, .max=1, .bit=6, .index=1084, .n=2, .width=2},
   // CustomerAccountList (1100)
   {.size=sizeof(SE_CustomerAccountList_t), .index=543},
-  {.offset=offsetof(SE_CustomerAccountList_t,all), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1},
-  {.offset=offsetof(SE_CustomerAccountList_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=3},
-  {.offset=offsetof(SE_CustomerAccountList_t,pollRate), .min=0, .max=1, .attribute=1, .bit=18, .type=ST_SIMPLE|XS_UINT, .n=2},
-  {.offset=offsetof(SE_CustomerAccountList_t,results), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1},
-  {.offset=offsetof(SE_CustomerAccountList_t,subscribable), .min=0, .max=1, .attribute=1, .bit=1, .type=ST_SIMPLE|XS_UBYTE, .n=3},
-  {.offset=offsetof(SE_CustomerAccountList_t,CustomerAccount), .min=0, .unbounded=1, .index=1089, .n=2},
+  {.offset=offsetof(SE_CustomerAccountList_t,all), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1, .width=1},
+  {.offset=offsetof(SE_CustomerAccountList_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=3, .width=2},
+  {.offset=offsetof(SE_CustomerAccountList_t,pollRate), .min=0, .max=1, .attribute=1, .bit=18, .type=ST_SIMPLE|XS_UINT, .n=2, .width=2},
+  {.offset=offsetof(SE_CustomerAccountList_t,results), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1, .width=1},
+  {.offset=offsetof(SE_CustomerAccountList_t,subscribable), .min=0, .max=1, .attribute=1, .bit=1, .type=ST_SIMPLE|XS_UBYTE, .n=3, .width=2},
+  {.offset=offsetof(SE_CustomerAccountList_t,CustomerAccount), .min=0, .unbounded=1, .index=1089, .n=2, .width=2},
   // BillingReadingListLink (1107)
   {.size=sizeof(SE_BillingReadingListLink_t), .index=451},
-  {.offset=offsetof(SE_BillingReadingListLink_t,all), .min=0, .max=1, .attribute=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=2},
-  {.offset=offsetof(SE_BillingReadingListLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1},
+  {.offset=offsetof(SE_BillingReadingListLink_t,all), .min=0, .max=1, .attribute=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=2, .width=2},
+  {.offset=offsetof(SE_BillingReadingListLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1, .width=1},
   // BillingReadingSet (1110)
   {.size=sizeof(SE_BillingReadingSet_t), .index=373},
-  {.offset=offsetof(SE_BillingReadingSet_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2},
-  {.offset=offsetof(SE_BillingReadingSet_t,mRID), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,16), .n=1},
-  {.offset=offsetof(SE_BillingReadingSet_t,description), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|xs_type(XS_STRING,32), .n=3},
-  {.offset=offsetof(SE_BillingReadingSet_t,version), .min=0, .max=1, .bit=2, .type=ST_SIMPLE|XS_USHORT, .n=2},
-  {.offset=offsetof(SE_BillingReadingSet_t,timePeriod), .min=1, .max=1, .index=349, .n=1},
-  {.offset=offsetof(SE_BillingReadingSet_t,BillingReadingListLink), .min=0, .max=1, .bit=3, .index=1107, .n=2},
+  {.offset=offsetof(SE_BillingReadingSet_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2, .width=2},
+  {.offset=offsetof(SE_BillingReadingSet_t,mRID), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,16), .n=1, .width=1},
+  {.offset=offsetof(SE_BillingReadingSet_t,description), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|xs_type(XS_STRING,32), .n=3, .width=2},
+  {.offset=offsetof(SE_BillingReadingSet_t,version), .min=0, .max=1, .bit=2, .type=ST_SIMPLE|XS_USHORT, .n=2, .width=2},
+  {.offset=offsetof(SE_BillingReadingSet_t,timePeriod), .min=1, .max=1, .index=349, .n=1, .width=1},
+  {.offset=offsetof(SE_BillingReadingSet_t,BillingReadingListLink), .min=0, .max=1, .bit=3, .index=1107, .n=2, .width=2},
   // BillingReadingSetList (1117)
   {.size=sizeof(SE_BillingReadingSetList_t), .index=543},
-  {.offset=offsetof(SE_BillingReadingSetList_t,all), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1},
-  {.offset=offsetof(SE_BillingReadingSetList_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2},
-  {.offset=offsetof(SE_BillingReadingSetList_t,results), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1},
-  {.offset=offsetof(SE_BillingReadingSetList_t,subscribable), .min=0, .max=1, .attribute=1, .bit=1, .type=ST_SIMPLE|XS_UBYTE, .n=3},
-  {.offset=offsetof(SE_BillingReadingSetList_t,BillingReadingSet), .min=0, .unbounded=1, .index=1110, .n=2},
+  {.offset=offsetof(SE_BillingReadingSetList_t,all), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1, .width=1},
+  {.offset=offsetof(SE_BillingReadingSetList_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2, .width=2},
+  {.offset=offsetof(SE_BillingReadingSetList_t,results), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1, .width=1},
+  {.offset=offsetof(SE_BillingReadingSetList_t,subscribable), .min=0, .max=1, .attribute=1, .bit=1, .type=ST_SIMPLE|XS_UBYTE, .n=3, .width=2},
+  {.offset=offsetof(SE_BillingReadingSetList_t,BillingReadingSet), .min=0, .unbounded=1, .index=1110, .n=2, .width=2},
   // Charge (1123)
   {.size=sizeof(SE_Charge_t), .index=0},
-  {.offset=offsetof(SE_Charge_t,description), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|xs_type(XS_STRING,20), .n=3},
-  {.offset=offsetof(SE_Charge_t,kind), .min=0, .max=1, .bit=17, .type=ST_SIMPLE|XS_UBYTE, .n=2},
-  {.offset=offsetof(SE_Charge_t,value), .min=1, .max=1, .type=ST_SIMPLE|XS_INT, .n=1},
+  {.offset=offsetof(SE_Charge_t,description), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|xs_type(XS_STRING,20), .n=3, .width=2},
+  {.offset=offsetof(SE_Charge_t,kind), .min=0, .max=1, .bit=17, .type=ST_SIMPLE|XS_UBYTE, .n=2, .width=2},
+  {.offset=offsetof(SE_Charge_t,value), .min=1, .max=1, .type=ST_SIMPLE|XS_INT, .n=1, .width=1},
   // BillingReading (1127)
   {.size=sizeof(SE_BillingReading_t), .index=352},
-  {.offset=offsetof(SE_BillingReading_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=8},
-  {.offset=offsetof(SE_BillingReading_t,consumptionBlock), .min=0, .max=1, .bit=2, .type=ST_SIMPLE|XS_UBYTE, .n=7},
-  {.offset=offsetof(SE_BillingReading_t,qualityFlags), .min=0, .max=1, .bit=3, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,2), .n=6},
-  {.offset=offsetof(SE_BillingReading_t,timePeriod), .min=0, .max=1, .bit=4, .index=349, .n=5},
-  {.offset=offsetof(SE_BillingReading_t,touTier), .min=0, .max=1, .bit=5, .type=ST_SIMPLE|XS_UBYTE, .n=4},
-  {.offset=offsetof(SE_BillingReading_t,value), .min=0, .max=1, .bit=6, .type=ST_SIMPLE|XS_LONG, .n=3},
-  {.offset=offsetof(SE_BillingReading_t,Charge), .min=0, .unbounded=1, .index=1123, .n=2},
+  {.offset=offsetof(SE_BillingReading_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=8, .width=4},
+  {.offset=offsetof(SE_BillingReading_t,consumptionBlock), .min=0, .max=1, .bit=2, .type=ST_SIMPLE|XS_UBYTE, .n=7, .width=3},
+  {.offset=offsetof(SE_BillingReading_t,qualityFlags), .min=0, .max=1, .bit=3, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,2), .n=6, .width=3},
+  {.offset=offsetof(SE_BillingReading_t,timePeriod), .min=0, .max=1, .bit=4, .index=349, .n=5, .width=3},
+  {.offset=offsetof(SE_BillingReading_t,touTier), .min=0, .max=1, .bit=5, .type=ST_SIMPLE|XS_UBYTE, .n=4, .width=3},
+  {.offset=offsetof(SE_BillingReading_t,value), .min=0, .max=1, .bit=6, .type=ST_SIMPLE|XS_LONG, .n=3, .width=2},
+  {.offset=offsetof(SE_BillingReading_t,Charge), .min=0, .unbounded=1, .index=1123, .n=2, .width=2},
   // BillingReadingList (1135)
   {.size=sizeof(SE_BillingReadingList_t), .index=420},
-  {.offset=offsetof(SE_BillingReadingList_t,all), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1},
-  {.offset=offsetof(SE_BillingReadingList_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2},
-  {.offset=offsetof(SE_BillingReadingList_t,results), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1},
-  {.offset=offsetof(SE_BillingReadingList_t,BillingReading), .min=0, .unbounded=1, .index=1127, .n=2},
+  {.offset=offsetof(SE_BillingReadingList_t,all), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1, .width=1},
+  {.offset=offsetof(SE_BillingReadingList_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2, .width=2},
+  {.offset=offsetof(SE_BillingReadingList_t,results), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1, .width=1},
+  {.offset=offsetof(SE_BillingReadingList_t,BillingReading), .min=0, .unbounded=1, .index=1127, .n=2, .width=2},
   // BillingPeriod (1140)
   {.size=sizeof(SE_BillingPeriod_t), .index=328},
-  {.offset=offsetof(SE_BillingPeriod_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=4},
-  {.offset=offsetof(SE_BillingPeriod_t,billLastPeriod), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|XS_LONG, .n=3},
-  {.offset=offsetof(SE_BillingPeriod_t,billToDate), .min=0, .max=1, .bit=1, .type=ST_SIMPLE|XS_LONG, .n=2},
-  {.offset=offsetof(SE_BillingPeriod_t,interval), .min=1, .max=1, .index=349, .n=1},
-  {.offset=offsetof(SE_BillingPeriod_t,statusTimeStamp), .min=0, .max=1, .bit=2, .type=ST_SIMPLE|XS_LONG, .n=2},
+  {.offset=offsetof(SE_BillingPeriod_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=4, .width=3},
+  {.offset=offsetof(SE_BillingPeriod_t,billLastPeriod), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|XS_LONG, .n=3, .width=2},
+  {.offset=offsetof(SE_BillingPeriod_t,billToDate), .min=0, .max=1, .bit=1, .type=ST_SIMPLE|XS_LONG, .n=2, .width=2},
+  {.offset=offsetof(SE_BillingPeriod_t,interval), .min=1, .max=1, .index=349, .n=1, .width=1},
+  {.offset=offsetof(SE_BillingPeriod_t,statusTimeStamp), .min=0, .max=1, .bit=2, .type=ST_SIMPLE|XS_LONG, .n=2, .width=2},
   // BillingPeriodList (1146)
   {.size=sizeof(SE_BillingPeriodList_t), .index=543},
-  {.offset=offsetof(SE_BillingPeriodList_t,all), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1},
-  {.offset=offsetof(SE_BillingPeriodList_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2},
-  {.offset=offsetof(SE_BillingPeriodList_t,results), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1},
-  {.offset=offsetof(SE_BillingPeriodList_t,subscribable), .min=0, .max=1, .attribute=1, .bit=1, .type=ST_SIMPLE|XS_UBYTE, .n=3},
-  {.offset=offsetof(SE_BillingPeriodList_t,BillingPeriod), .min=0, .unbounded=1, .index=1140, .n=2},
+  {.offset=offsetof(SE_BillingPeriodList_t,all), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1, .width=1},
+  {.offset=offsetof(SE_BillingPeriodList_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2, .width=2},
+  {.offset=offsetof(SE_BillingPeriodList_t,results), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1, .width=1},
+  {.offset=offsetof(SE_BillingPeriodList_t,subscribable), .min=0, .max=1, .attribute=1, .bit=1, .type=ST_SIMPLE|XS_UBYTE, .n=3, .width=2},
+  {.offset=offsetof(SE_BillingPeriodList_t,BillingPeriod), .min=0, .unbounded=1, .index=1140, .n=2, .width=2},
   // TextMessage (1152)
   {.size=sizeof(SE_TextMessage_t), .index=644},
-  {.offset=offsetof(SE_TextMessage_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=5},
-  {.offset=offsetof(SE_TextMessage_t,replyTo), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=4},
-  {.offset=offsetof(SE_TextMessage_t,responseRequired), .min=0, .max=1, .attribute=1, .bit=4, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,1), .n=3},
-  {.offset=offsetof(SE_TextMessage_t,subscribable), .min=0, .max=1, .attribute=1, .bit=1, .type=ST_SIMPLE|XS_UBYTE, .n=2},
-  {.offset=offsetof(SE_TextMessage_t,mRID), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,16), .n=1},
-  {.offset=offsetof(SE_TextMessage_t,description), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|xs_type(XS_STRING,32), .n=3},
-  {.offset=offsetof(SE_TextMessage_t,version), .min=0, .max=1, .bit=2, .type=ST_SIMPLE|XS_USHORT, .n=2},
-  {.offset=offsetof(SE_TextMessage_t,creationTime), .min=1, .max=1, .type=ST_SIMPLE|XS_LONG, .n=1},
-  {.offset=offsetof(SE_TextMessage_t,EventStatus), .min=1, .max=1, .index=630, .n=1},
-  {.offset=offsetof(SE_TextMessage_t,interval), .min=1, .max=1, .index=349, .n=1},
-  {.offset=offsetof(SE_TextMessage_t,originator), .min=0, .max=1, .bit=5, .type=ST_SIMPLE|xs_type(XS_STRING,20), .n=2},
-  {.offset=offsetof(SE_TextMessage_t,priority), .min=1, .max=1, .type=ST_SIMPLE|XS_UBYTE, .n=1},
-  {.offset=offsetof(SE_TextMessage_t,textMessage), .min=1, .max=1, .type=ST_SIMPLE|XS_STRING, .n=1},
+  {.offset=offsetof(SE_TextMessage_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=5, .width=3},
+  {.offset=offsetof(SE_TextMessage_t,replyTo), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=4, .width=3},
+  {.offset=offsetof(SE_TextMessage_t,responseRequired), .min=0, .max=1, .attribute=1, .bit=4, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,1), .n=3, .width=2},
+  {.offset=offsetof(SE_TextMessage_t,subscribable), .min=0, .max=1, .attribute=1, .bit=1, .type=ST_SIMPLE|XS_UBYTE, .n=2, .width=2},
+  {.offset=offsetof(SE_TextMessage_t,mRID), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,16), .n=1, .width=1},
+  {.offset=offsetof(SE_TextMessage_t,description), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|xs_type(XS_STRING,32), .n=3, .width=2},
+  {.offset=offsetof(SE_TextMessage_t,version), .min=0, .max=1, .bit=2, .type=ST_SIMPLE|XS_USHORT, .n=2, .width=2},
+  {.offset=offsetof(SE_TextMessage_t,creationTime), .min=1, .max=1, .type=ST_SIMPLE|XS_LONG, .n=1, .width=1},
+  {.offset=offsetof(SE_TextMessage_t,EventStatus), .min=1, .max=1, .index=630, .n=1, .width=1},
+  {.offset=offsetof(SE_TextMessage_t,interval), .min=1, .max=1, .index=349, .n=1, .width=1},
+  {.offset=offsetof(SE_TextMessage_t,originator), .min=0, .max=1, .bit=5, .type=ST_SIMPLE|xs_type(XS_STRING,20), .n=2, .width=2},
+  {.offset=offsetof(SE_TextMessage_t,priority), .min=1, .max=1, .type=ST_SIMPLE|XS_UBYTE, .n=1, .width=1},
+  {.offset=offsetof(SE_TextMessage_t,textMessage), .min=1, .max=1, .type=ST_SIMPLE|XS_STRING, .n=1, .width=1},
   // TextMessageList (1166)
   {.size=sizeof(SE_TextMessageList_t), .index=543},
-  {.offset=offsetof(SE_TextMessageList_t,all), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1},
-  {.offset=offsetof(SE_TextMessageList_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2},
-  {.offset=offsetof(SE_TextMessageList_t,results), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1},
-  {.offset=offsetof(SE_TextMessageList_t,subscribable), .min=0, .max=1, .attribute=1, .bit=1, .type=ST_SIMPLE|XS_UBYTE, .n=3},
-  {.offset=offsetof(SE_TextMessageList_t,TextMessage), .min=0, .unbounded=1, .index=1152, .n=2},
+  {.offset=offsetof(SE_TextMessageList_t,all), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1, .width=1},
+  {.offset=offsetof(SE_TextMessageList_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2, .width=2},
+  {.offset=offsetof(SE_TextMessageList_t,results), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1, .width=1},
+  {.offset=offsetof(SE_TextMessageList_t,subscribable), .min=0, .max=1, .attribute=1, .bit=1, .type=ST_SIMPLE|XS_UBYTE, .n=3, .width=2},
+  {.offset=offsetof(SE_TextMessageList_t,TextMessage), .min=0, .unbounded=1, .index=1152, .n=2, .width=2},
   // TextMessageListLink (1172)
   {.size=sizeof(SE_TextMessageListLink_t), .index=451},
-  {.offset=offsetof(SE_TextMessageListLink_t,all), .min=0, .max=1, .attribute=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=2},
-  {.offset=offsetof(SE_TextMessageListLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1},
+  {.offset=offsetof(SE_TextMessageListLink_t,all), .min=0, .max=1, .attribute=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=2, .width=2},
+  {.offset=offsetof(SE_TextMessageListLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1, .width=1},
   // ActiveTextMessageListLink (1175)
   {.size=sizeof(SE_ActiveTextMessageListLink_t), .index=451},
-  {.offset=offsetof(SE_ActiveTextMessageListLink_t,all), .min=0, .max=1, .attribute=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=2},
-  {.offset=offsetof(SE_ActiveTextMessageListLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1},
+  {.offset=offsetof(SE_ActiveTextMessageListLink_t,all), .min=0, .max=1, .attribute=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=2, .width=2},
+  {.offset=offsetof(SE_ActiveTextMessageListLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1, .width=1},
   // MessagingProgram (1178)
   {.size=sizeof(SE_MessagingProgram_t), .index=526},
-  {.offset=offsetof(SE_MessagingProgram_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=3},
-  {.offset=offsetof(SE_MessagingProgram_t,subscribable), .min=0, .max=1, .attribute=1, .bit=1, .type=ST_SIMPLE|XS_UBYTE, .n=2},
-  {.offset=offsetof(SE_MessagingProgram_t,mRID), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,16), .n=1},
-  {.offset=offsetof(SE_MessagingProgram_t,description), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|xs_type(XS_STRING,32), .n=4},
-  {.offset=offsetof(SE_MessagingProgram_t,version), .min=0, .max=1, .bit=2, .type=ST_SIMPLE|XS_USHORT, .n=3},
-  {.offset=offsetof(SE_MessagingProgram_t,ActiveTextMessageListLink), .min=0, .max=1, .bit=3, .index=1175, .n=2},
-  {.offset=offsetof(SE_MessagingProgram_t,locale), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_STRING,42), .n=1},
-  {.offset=offsetof(SE_MessagingProgram_t,primacy), .min=1, .max=1, .type=ST_SIMPLE|XS_UBYTE, .n=1},
-  {.offset=offsetof(SE_MessagingProgram_t,TextMessageListLink), .min=0, .max=1, .bit=4, .index=1172, .n=2},
+  {.offset=offsetof(SE_MessagingProgram_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=3, .width=2},
+  {.offset=offsetof(SE_MessagingProgram_t,subscribable), .min=0, .max=1, .attribute=1, .bit=1, .type=ST_SIMPLE|XS_UBYTE, .n=2, .width=2},
+  {.offset=offsetof(SE_MessagingProgram_t,mRID), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,16), .n=1, .width=1},
+  {.offset=offsetof(SE_MessagingProgram_t,description), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|xs_type(XS_STRING,32), .n=4, .width=3},
+  {.offset=offsetof(SE_MessagingProgram_t,version), .min=0, .max=1, .bit=2, .type=ST_SIMPLE|XS_USHORT, .n=3, .width=2},
+  {.offset=offsetof(SE_MessagingProgram_t,ActiveTextMessageListLink), .min=0, .max=1, .bit=3, .index=1175, .n=2, .width=2},
+  {.offset=offsetof(SE_MessagingProgram_t,locale), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_STRING,42), .n=1, .width=1},
+  {.offset=offsetof(SE_MessagingProgram_t,primacy), .min=1, .max=1, .type=ST_SIMPLE|XS_UBYTE, .n=1, .width=1},
+  {.offset=offsetof(SE_MessagingProgram_t,TextMessageListLink), .min=0, .max=1, .bit=4, .index=1172, .n=2, .width=2},
   // MessagingProgramList (1188)
   {.size=sizeof(SE_MessagingProgramList_t), .index=543},
-  {.offset=offsetof(SE_MessagingProgramList_t,all), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1},
-  {.offset=offsetof(SE_MessagingProgramList_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=3},
-  {.offset=offsetof(SE_MessagingProgramList_t,pollRate), .min=0, .max=1, .attribute=1, .bit=18, .type=ST_SIMPLE|XS_UINT, .n=2},
-  {.offset=offsetof(SE_MessagingProgramList_t,results), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1},
-  {.offset=offsetof(SE_MessagingProgramList_t,subscribable), .min=0, .max=1, .attribute=1, .bit=1, .type=ST_SIMPLE|XS_UBYTE, .n=3},
-  {.offset=offsetof(SE_MessagingProgramList_t,MessagingProgram), .min=0, .unbounded=1, .index=1178, .n=2},
+  {.offset=offsetof(SE_MessagingProgramList_t,all), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1, .width=1},
+  {.offset=offsetof(SE_MessagingProgramList_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=3, .width=2},
+  {.offset=offsetof(SE_MessagingProgramList_t,pollRate), .min=0, .max=1, .attribute=1, .bit=18, .type=ST_SIMPLE|XS_UINT, .n=2, .width=2},
+  {.offset=offsetof(SE_MessagingProgramList_t,results), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1, .width=1},
+  {.offset=offsetof(SE_MessagingProgramList_t,subscribable), .min=0, .max=1, .attribute=1, .bit=1, .type=ST_SIMPLE|XS_UBYTE, .n=3, .width=2},
+  {.offset=offsetof(SE_MessagingProgramList_t,MessagingProgram), .min=0, .unbounded=1, .index=1178, .n=2, .width=2},
   // ConsumptionTariffIntervalListLink (1195)
   {.size=sizeof(SE_ConsumptionTariffIntervalListLink_t), .index=451},
-  {.offset=offsetof(SE_ConsumptionTariffIntervalListLink_t,all), .min=0, .max=1, .attribute=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=2},
-  {.offset=offsetof(SE_ConsumptionTariffIntervalListLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1},
+  {.offset=offsetof(SE_ConsumptionTariffIntervalListLink_t,all), .min=0, .max=1, .attribute=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=2, .width=2},
+  {.offset=offsetof(SE_ConsumptionTariffIntervalListLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1, .width=1},
   // TimeTariffInterval (1198)
   {.size=sizeof(SE_TimeTariffInterval_t), .index=655},
-  {.offset=offsetof(SE_TimeTariffInterval_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=5},
-  {.offset=offsetof(SE_TimeTariffInterval_t,replyTo), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=4},
-  {.offset=offsetof(SE_TimeTariffInterval_t,responseRequired), .min=0, .max=1, .attribute=1, .bit=4, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,1), .n=3},
-  {.offset=offsetof(SE_TimeTariffInterval_t,subscribable), .min=0, .max=1, .attribute=1, .bit=1, .type=ST_SIMPLE|XS_UBYTE, .n=2},
-  {.offset=offsetof(SE_TimeTariffInterval_t,mRID), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,16), .n=1},
-  {.offset=offsetof(SE_TimeTariffInterval_t,description), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|xs_type(XS_STRING,32), .n=3},
-  {.offset=offsetof(SE_TimeTariffInterval_t,version), .min=0, .max=1, .bit=2, .type=ST_SIMPLE|XS_USHORT, .n=2},
-  {.offset=offsetof(SE_TimeTariffInterval_t,creationTime), .min=1, .max=1, .type=ST_SIMPLE|XS_LONG, .n=1},
-  {.offset=offsetof(SE_TimeTariffInterval_t,EventStatus), .min=1, .max=1, .index=630, .n=1},
-  {.offset=offsetof(SE_TimeTariffInterval_t,interval), .min=1, .max=1, .index=349, .n=1},
-  {.offset=offsetof(SE_TimeTariffInterval_t,randomizeDuration), .min=0, .max=1, .bit=5, .type=ST_SIMPLE|XS_SHORT, .n=4},
-  {.offset=offsetof(SE_TimeTariffInterval_t,randomizeStart), .min=0, .max=1, .bit=6, .type=ST_SIMPLE|XS_SHORT, .n=3},
-  {.offset=offsetof(SE_TimeTariffInterval_t,ConsumptionTariffIntervalListLink), .min=0, .max=1, .bit=7, .index=1195, .n=2},
-  {.offset=offsetof(SE_TimeTariffInterval_t,touTier), .min=1, .max=1, .type=ST_SIMPLE|XS_UBYTE, .n=1},
+  {.offset=offsetof(SE_TimeTariffInterval_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=5, .width=3},
+  {.offset=offsetof(SE_TimeTariffInterval_t,replyTo), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=4, .width=3},
+  {.offset=offsetof(SE_TimeTariffInterval_t,responseRequired), .min=0, .max=1, .attribute=1, .bit=4, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,1), .n=3, .width=2},
+  {.offset=offsetof(SE_TimeTariffInterval_t,subscribable), .min=0, .max=1, .attribute=1, .bit=1, .type=ST_SIMPLE|XS_UBYTE, .n=2, .width=2},
+  {.offset=offsetof(SE_TimeTariffInterval_t,mRID), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,16), .n=1, .width=1},
+  {.offset=offsetof(SE_TimeTariffInterval_t,description), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|xs_type(XS_STRING,32), .n=3, .width=2},
+  {.offset=offsetof(SE_TimeTariffInterval_t,version), .min=0, .max=1, .bit=2, .type=ST_SIMPLE|XS_USHORT, .n=2, .width=2},
+  {.offset=offsetof(SE_TimeTariffInterval_t,creationTime), .min=1, .max=1, .type=ST_SIMPLE|XS_LONG, .n=1, .width=1},
+  {.offset=offsetof(SE_TimeTariffInterval_t,EventStatus), .min=1, .max=1, .index=630, .n=1, .width=1},
+  {.offset=offsetof(SE_TimeTariffInterval_t,interval), .min=1, .max=1, .index=349, .n=1, .width=1},
+  {.offset=offsetof(SE_TimeTariffInterval_t,randomizeDuration), .min=0, .max=1, .bit=5, .type=ST_SIMPLE|XS_SHORT, .n=4, .width=3},
+  {.offset=offsetof(SE_TimeTariffInterval_t,randomizeStart), .min=0, .max=1, .bit=6, .type=ST_SIMPLE|XS_SHORT, .n=3, .width=2},
+  {.offset=offsetof(SE_TimeTariffInterval_t,ConsumptionTariffIntervalListLink), .min=0, .max=1, .bit=7, .index=1195, .n=2, .width=2},
+  {.offset=offsetof(SE_TimeTariffInterval_t,touTier), .min=1, .max=1, .type=ST_SIMPLE|XS_UBYTE, .n=1, .width=1},
   // TimeTariffIntervalList (1213)
   {.size=sizeof(SE_TimeTariffIntervalList_t), .index=543},
-  {.offset=offsetof(SE_TimeTariffIntervalList_t,all), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1},
-  {.offset=offsetof(SE_TimeTariffIntervalList_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2},
-  {.offset=offsetof(SE_TimeTariffIntervalList_t,results), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1},
-  {.offset=offsetof(SE_TimeTariffIntervalList_t,subscribable), .min=0, .max=1, .attribute=1, .bit=1, .type=ST_SIMPLE|XS_UBYTE, .n=3},
-  {.offset=offsetof(SE_TimeTariffIntervalList_t,TimeTariffInterval), .min=0, .unbounded=1, .index=1198, .n=2},
+  {.offset=offsetof(SE_TimeTariffIntervalList_t,all), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1, .width=1},
+  {.offset=offsetof(SE_TimeTariffIntervalList_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2, .width=2},
+  {.offset=offsetof(SE_TimeTariffIntervalList_t,results), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1, .width=1},
+  {.offset=offsetof(SE_TimeTariffIntervalList_t,subscribable), .min=0, .max=1, .attribute=1, .bit=1, .type=ST_SIMPLE|XS_UBYTE, .n=3, .width=2},
+  {.offset=offsetof(SE_TimeTariffIntervalList_t,TimeTariffInterval), .min=0, .unbounded=1, .index=1198, .n=2, .width=2},
   // RateComponentListLink (1219)
   {.size=sizeof(SE_RateComponentListLink_t), .index=451},
-  {.offset=offsetof(SE_RateComponentListLink_t,all), .min=0, .max=1, .attribute=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=2},
-  {.offset=offsetof(SE_RateComponentListLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1},
+  {.offset=offsetof(SE_RateComponentListLink_t,all), .min=0, .max=1, .attribute=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=2, .width=2},
+  {.offset=offsetof(SE_RateComponentListLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1, .width=1},
   // TariffProfile (1222)
   {.size=sizeof(SE_TariffProfile_t), .index=368},
-  {.offset=offsetof(SE_TariffProfile_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2},
-  {.offset=offsetof(SE_TariffProfile_t,mRID), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,16), .n=1},
-  {.offset=offsetof(SE_TariffProfile_t,description), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|xs_type(XS_STRING,32), .n=5},
-  {.offset=offsetof(SE_TariffProfile_t,version), .min=0, .max=1, .bit=2, .type=ST_SIMPLE|XS_USHORT, .n=4},
-  {.offset=offsetof(SE_TariffProfile_t,currency), .min=0, .max=1, .bit=3, .type=ST_SIMPLE|XS_USHORT, .n=3},
-  {.offset=offsetof(SE_TariffProfile_t,pricePowerOfTenMultiplier), .min=0, .max=1, .bit=4, .type=ST_SIMPLE|XS_BYTE, .n=2},
-  {.offset=offsetof(SE_TariffProfile_t,primacy), .min=1, .max=1, .type=ST_SIMPLE|XS_UBYTE, .n=1},
-  {.offset=offsetof(SE_TariffProfile_t,rateCode), .min=0, .max=1, .bit=5, .type=ST_SIMPLE|xs_type(XS_STRING,20), .n=3},
-  {.offset=offsetof(SE_TariffProfile_t,RateComponentListLink), .min=0, .max=1, .bit=6, .index=1219, .n=2},
-  {.offset=offsetof(SE_TariffProfile_t,serviceCategoryKind), .min=1, .max=1, .type=ST_SIMPLE|XS_UBYTE, .n=1},
+  {.offset=offsetof(SE_TariffProfile_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2, .width=2},
+  {.offset=offsetof(SE_TariffProfile_t,mRID), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,16), .n=1, .width=1},
+  {.offset=offsetof(SE_TariffProfile_t,description), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|xs_type(XS_STRING,32), .n=5, .width=3},
+  {.offset=offsetof(SE_TariffProfile_t,version), .min=0, .max=1, .bit=2, .type=ST_SIMPLE|XS_USHORT, .n=4, .width=3},
+  {.offset=offsetof(SE_TariffProfile_t,currency), .min=0, .max=1, .bit=3, .type=ST_SIMPLE|XS_USHORT, .n=3, .width=2},
+  {.offset=offsetof(SE_TariffProfile_t,pricePowerOfTenMultiplier), .min=0, .max=1, .bit=4, .type=ST_SIMPLE|XS_BYTE, .n=2, .width=2},
+  {.offset=offsetof(SE_TariffProfile_t,primacy), .min=1, .max=1, .type=ST_SIMPLE|XS_UBYTE, .n=1, .width=1},
+  {.offset=offsetof(SE_TariffProfile_t,rateCode), .min=0, .max=1, .bit=5, .type=ST_SIMPLE|xs_type(XS_STRING,20), .n=3, .width=2},
+  {.offset=offsetof(SE_TariffProfile_t,RateComponentListLink), .min=0, .max=1, .bit=6, .index=1219, .n=2, .width=2},
+  {.offset=offsetof(SE_TariffProfile_t,serviceCategoryKind), .min=1, .max=1, .type=ST_SIMPLE|XS_UBYTE, .n=1, .width=1},
   // TariffProfileList (1233)
   {.size=sizeof(SE_TariffProfileList_t), .index=543},
-  {.offset=offsetof(SE_TariffProfileList_t,all), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1},
-  {.offset=offsetof(SE_TariffProfileList_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=3},
-  {.offset=offsetof(SE_TariffProfileList_t,pollRate), .min=0, .max=1, .attribute=1, .bit=18, .type=ST_SIMPLE|XS_UINT, .n=2},
-  {.offset=offsetof(SE_TariffProfileList_t,results), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1},
-  {.offset=offsetof(SE_TariffProfileList_t,subscribable), .min=0, .max=1, .attribute=1, .bit=1, .type=ST_SIMPLE|XS_UBYTE, .n=3},
-  {.offset=offsetof(SE_TariffProfileList_t,TariffProfile), .min=0, .unbounded=1, .index=1222, .n=2},
+  {.offset=offsetof(SE_TariffProfileList_t,all), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1, .width=1},
+  {.offset=offsetof(SE_TariffProfileList_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=3, .width=2},
+  {.offset=offsetof(SE_TariffProfileList_t,pollRate), .min=0, .max=1, .attribute=1, .bit=18, .type=ST_SIMPLE|XS_UINT, .n=2, .width=2},
+  {.offset=offsetof(SE_TariffProfileList_t,results), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1, .width=1},
+  {.offset=offsetof(SE_TariffProfileList_t,subscribable), .min=0, .max=1, .attribute=1, .bit=1, .type=ST_SIMPLE|XS_UBYTE, .n=3, .width=2},
+  {.offset=offsetof(SE_TariffProfileList_t,TariffProfile), .min=0, .unbounded=1, .index=1222, .n=2, .width=2},
   // TimeTariffIntervalListLink (1240)
   {.size=sizeof(SE_TimeTariffIntervalListLink_t), .index=451},
-  {.offset=offsetof(SE_TimeTariffIntervalListLink_t,all), .min=0, .max=1, .attribute=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=2},
-  {.offset=offsetof(SE_TimeTariffIntervalListLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1},
+  {.offset=offsetof(SE_TimeTariffIntervalListLink_t,all), .min=0, .max=1, .attribute=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=2, .width=2},
+  {.offset=offsetof(SE_TimeTariffIntervalListLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1, .width=1},
   // ActiveTimeTariffIntervalListLink (1243)
   {.size=sizeof(SE_ActiveTimeTariffIntervalListLink_t), .index=451},
-  {.offset=offsetof(SE_ActiveTimeTariffIntervalListLink_t,all), .min=0, .max=1, .attribute=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=2},
-  {.offset=offsetof(SE_ActiveTimeTariffIntervalListLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1},
+  {.offset=offsetof(SE_ActiveTimeTariffIntervalListLink_t,all), .min=0, .max=1, .attribute=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=2, .width=2},
+  {.offset=offsetof(SE_ActiveTimeTariffIntervalListLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1, .width=1},
   // RateComponent (1246)
   {.size=sizeof(SE_RateComponent_t), .index=368},
-  {.offset=offsetof(SE_RateComponent_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2},
-  {.offset=offsetof(SE_RateComponent_t,mRID), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,16), .n=1},
-  {.offset=offsetof(SE_RateComponent_t,description), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|xs_type(XS_STRING,32), .n=6},
-  {.offset=offsetof(SE_RateComponent_t,version), .min=0, .max=1, .bit=2, .type=ST_SIMPLE|XS_USHORT, .n=5},
-  {.offset=offsetof(SE_RateComponent_t,ActiveTimeTariffIntervalListLink), .min=0, .max=1, .bit=3, .index=1243, .n=4},
-  {.offset=offsetof(SE_RateComponent_t,flowRateEndLimit), .min=0, .max=1, .bit=4, .index=324, .n=3},
-  {.offset=offsetof(SE_RateComponent_t,flowRateStartLimit), .min=0, .max=1, .bit=5, .index=324, .n=2},
-  {.offset=offsetof(SE_RateComponent_t,ReadingTypeLink), .min=1, .max=1, .index=988, .n=1},
-  {.offset=offsetof(SE_RateComponent_t,roleFlags), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,2), .n=1},
-  {.offset=offsetof(SE_RateComponent_t,TimeTariffIntervalListLink), .min=1, .max=1, .index=1240, .n=1},
+  {.offset=offsetof(SE_RateComponent_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2, .width=2},
+  {.offset=offsetof(SE_RateComponent_t,mRID), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,16), .n=1, .width=1},
+  {.offset=offsetof(SE_RateComponent_t,description), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|xs_type(XS_STRING,32), .n=6, .width=3},
+  {.offset=offsetof(SE_RateComponent_t,version), .min=0, .max=1, .bit=2, .type=ST_SIMPLE|XS_USHORT, .n=5, .width=3},
+  {.offset=offsetof(SE_RateComponent_t,ActiveTimeTariffIntervalListLink), .min=0, .max=1, .bit=3, .index=1243, .n=4, .width=3},
+  {.offset=offsetof(SE_RateComponent_t,flowRateEndLimit), .min=0, .max=1, .bit=4, .index=324, .n=3, .width=2},
+  {.offset=offsetof(SE_RateComponent_t,flowRateStartLimit), .min=0, .max=1, .bit=5, .index=324, .n=2, .width=2},
+  {.offset=offsetof(SE_RateComponent_t,ReadingTypeLink), .min=1, .max=1, .index=988, .n=1, .width=1},
+  {.offset=offsetof(SE_RateComponent_t,roleFlags), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,2), .n=1, .width=1},
+  {.offset=offsetof(SE_RateComponent_t,TimeTariffIntervalListLink), .min=1, .max=1, .index=1240, .n=1, .width=1},
   // RateComponentList (1257)
   {.size=sizeof(SE_RateComponentList_t), .index=420},
-  {.offset=offsetof(SE_RateComponentList_t,all), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1},
-  {.offset=offsetof(SE_RateComponentList_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2},
-  {.offset=offsetof(SE_RateComponentList_t,results), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1},
-  {.offset=offsetof(SE_RateComponentList_t,RateComponent), .min=0, .unbounded=1, .index=1246, .n=2},
+  {.offset=offsetof(SE_RateComponentList_t,all), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1, .width=1},
+  {.offset=offsetof(SE_RateComponentList_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2, .width=2},
+  {.offset=offsetof(SE_RateComponentList_t,results), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1, .width=1},
+  {.offset=offsetof(SE_RateComponentList_t,RateComponent), .min=0, .unbounded=1, .index=1246, .n=2, .width=2},
   // EnvironmentalCost (1262)
   {.size=sizeof(SE_EnvironmentalCost_t), .index=0},
-  {.offset=offsetof(SE_EnvironmentalCost_t,amount), .min=1, .max=1, .type=ST_SIMPLE|XS_UINT, .n=1},
-  {.offset=offsetof(SE_EnvironmentalCost_t,costKind), .min=1, .max=1, .type=ST_SIMPLE|XS_UBYTE, .n=1},
-  {.offset=offsetof(SE_EnvironmentalCost_t,costLevel), .min=1, .max=1, .type=ST_SIMPLE|XS_UBYTE, .n=1},
-  {.offset=offsetof(SE_EnvironmentalCost_t,numCostLevels), .min=1, .max=1, .type=ST_SIMPLE|XS_UBYTE, .n=1},
+  {.offset=offsetof(SE_EnvironmentalCost_t,amount), .min=1, .max=1, .type=ST_SIMPLE|XS_UINT, .n=1, .width=1},
+  {.offset=offsetof(SE_EnvironmentalCost_t,costKind), .min=1, .max=1, .type=ST_SIMPLE|XS_UBYTE, .n=1, .width=1},
+  {.offset=offsetof(SE_EnvironmentalCost_t,costLevel), .min=1, .max=1, .type=ST_SIMPLE|XS_UBYTE, .n=1, .width=1},
+  {.offset=offsetof(SE_EnvironmentalCost_t,numCostLevels), .min=1, .max=1, .type=ST_SIMPLE|XS_UBYTE, .n=1, .width=1},
   // ConsumptionTariffInterval (1267)
   {.size=sizeof(SE_ConsumptionTariffInterval_t), .index=328},
-  {.offset=offsetof(SE_ConsumptionTariffInterval_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2},
-  {.offset=offsetof(SE_ConsumptionTariffInterval_t,consumptionBlock), .min=1, .max=1, .type=ST_SIMPLE|XS_UBYTE, .n=1},
-  {.offset=offsetof(SE_ConsumptionTariffInterval_t,EnvironmentalCost), .min=0, .unbounded=1, .index=1262, .n=3},
-  {.offset=offsetof(SE_ConsumptionTariffInterval_t,price), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|XS_INT, .n=2},
-  {.offset=offsetof(SE_ConsumptionTariffInterval_t,startValue), .min=1, .max=1, .type=ST_SIMPLE|XS_ULONG, .n=1},
+  {.offset=offsetof(SE_ConsumptionTariffInterval_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2, .width=2},
+  {.offset=offsetof(SE_ConsumptionTariffInterval_t,consumptionBlock), .min=1, .max=1, .type=ST_SIMPLE|XS_UBYTE, .n=1, .width=1},
+  {.offset=offsetof(SE_ConsumptionTariffInterval_t,EnvironmentalCost), .min=0, .unbounded=1, .index=1262, .n=3, .width=2},
+  {.offset=offsetof(SE_ConsumptionTariffInterval_t,price), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|XS_INT, .n=2, .width=2},
+  {.offset=offsetof(SE_ConsumptionTariffInterval_t,startValue), .min=1, .max=1, .type=ST_SIMPLE|XS_ULONG, .n=1, .width=1},
   // ConsumptionTariffIntervalList (1273)
   {.size=sizeof(SE_ConsumptionTariffIntervalList_t), .index=420},
-  {.offset=offsetof(SE_ConsumptionTariffIntervalList_t,all), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1},
-  {.offset=offsetof(SE_ConsumptionTariffIntervalList_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2},
-  {.offset=offsetof(SE_ConsumptionTariffIntervalList_t,results), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1},
-  {.offset=offsetof(SE_ConsumptionTariffIntervalList_t,ConsumptionTariffInterval), .min=0, .unbounded=1, .index=1267, .n=2},
+  {.offset=offsetof(SE_ConsumptionTariffIntervalList_t,all), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1, .width=1},
+  {.offset=offsetof(SE_ConsumptionTariffIntervalList_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2, .width=2},
+  {.offset=offsetof(SE_ConsumptionTariffIntervalList_t,results), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1, .width=1},
+  {.offset=offsetof(SE_ConsumptionTariffIntervalList_t,ConsumptionTariffInterval), .min=0, .unbounded=1, .index=1267, .n=2, .width=2},
   // UsagePointList (1278)
   {.size=sizeof(SE_UsagePointList_t), .index=543},
-  {.offset=offsetof(SE_UsagePointList_t,all), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1},
-  {.offset=offsetof(SE_UsagePointList_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=3},
-  {.offset=offsetof(SE_UsagePointList_t,pollRate), .min=0, .max=1, .attribute=1, .bit=18, .type=ST_SIMPLE|XS_UINT, .n=2},
-  {.offset=offsetof(SE_UsagePointList_t,results), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1},
-  {.offset=offsetof(SE_UsagePointList_t,subscribable), .min=0, .max=1, .attribute=1, .bit=1, .type=ST_SIMPLE|XS_UBYTE, .n=3},
-  {.offset=offsetof(SE_UsagePointList_t,UsagePoint), .min=0, .unbounded=1, .index=896, .n=2},
+  {.offset=offsetof(SE_UsagePointList_t,all), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1, .width=1},
+  {.offset=offsetof(SE_UsagePointList_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=3, .width=2},
+  {.offset=offsetof(SE_UsagePointList_t,pollRate), .min=0, .max=1, .attribute=1, .bit=18, .type=ST_SIMPLE|XS_UINT, .n=2, .width=2},
+  {.offset=offsetof(SE_UsagePointList_t,results), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1, .width=1},
+  {.offset=offsetof(SE_UsagePointList_t,subscribable), .min=0, .max=1, .attribute=1, .bit=1, .type=ST_SIMPLE|XS_UBYTE, .n=3, .width=2},
+  {.offset=offsetof(SE_UsagePointList_t,UsagePoint), .min=0, .unbounded=1, .index=896, .n=2, .width=2},
   // ReadingListLink (1285)
   {.size=sizeof(SE_ReadingListLink_t), .index=451},
-  {.offset=offsetof(SE_ReadingListLink_t,all), .min=0, .max=1, .attribute=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=2},
-  {.offset=offsetof(SE_ReadingListLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1},
+  {.offset=offsetof(SE_ReadingListLink_t,all), .min=0, .max=1, .attribute=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=2, .width=2},
+  {.offset=offsetof(SE_ReadingListLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1, .width=1},
   // ReadingSet (1288)
   {.size=sizeof(SE_ReadingSet_t), .index=373},
-  {.offset=offsetof(SE_ReadingSet_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2},
-  {.offset=offsetof(SE_ReadingSet_t,mRID), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,16), .n=1},
-  {.offset=offsetof(SE_ReadingSet_t,description), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|xs_type(XS_STRING,32), .n=3},
-  {.offset=offsetof(SE_ReadingSet_t,version), .min=0, .max=1, .bit=2, .type=ST_SIMPLE|XS_USHORT, .n=2},
-  {.offset=offsetof(SE_ReadingSet_t,timePeriod), .min=1, .max=1, .index=349, .n=1},
-  {.offset=offsetof(SE_ReadingSet_t,ReadingListLink), .min=0, .max=1, .bit=3, .index=1285, .n=2},
+  {.offset=offsetof(SE_ReadingSet_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2, .width=2},
+  {.offset=offsetof(SE_ReadingSet_t,mRID), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,16), .n=1, .width=1},
+  {.offset=offsetof(SE_ReadingSet_t,description), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|xs_type(XS_STRING,32), .n=3, .width=2},
+  {.offset=offsetof(SE_ReadingSet_t,version), .min=0, .max=1, .bit=2, .type=ST_SIMPLE|XS_USHORT, .n=2, .width=2},
+  {.offset=offsetof(SE_ReadingSet_t,timePeriod), .min=1, .max=1, .index=349, .n=1, .width=1},
+  {.offset=offsetof(SE_ReadingSet_t,ReadingListLink), .min=0, .max=1, .bit=3, .index=1285, .n=2, .width=2},
   // ReadingSetList (1295)
   {.size=sizeof(SE_ReadingSetList_t), .index=543},
-  {.offset=offsetof(SE_ReadingSetList_t,all), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1},
-  {.offset=offsetof(SE_ReadingSetList_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2},
-  {.offset=offsetof(SE_ReadingSetList_t,results), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1},
-  {.offset=offsetof(SE_ReadingSetList_t,subscribable), .min=0, .max=1, .attribute=1, .bit=1, .type=ST_SIMPLE|XS_UBYTE, .n=3},
-  {.offset=offsetof(SE_ReadingSetList_t,ReadingSet), .min=0, .unbounded=1, .index=1288, .n=2},
+  {.offset=offsetof(SE_ReadingSetList_t,all), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1, .width=1},
+  {.offset=offsetof(SE_ReadingSetList_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2, .width=2},
+  {.offset=offsetof(SE_ReadingSetList_t,results), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1, .width=1},
+  {.offset=offsetof(SE_ReadingSetList_t,subscribable), .min=0, .max=1, .attribute=1, .bit=1, .type=ST_SIMPLE|XS_UBYTE, .n=3, .width=2},
+  {.offset=offsetof(SE_ReadingSetList_t,ReadingSet), .min=0, .unbounded=1, .index=1288, .n=2, .width=2},
   // ReadingList (1301)
   {.size=sizeof(SE_ReadingList_t), .index=543},
-  {.offset=offsetof(SE_ReadingList_t,all), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1},
-  {.offset=offsetof(SE_ReadingList_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2},
-  {.offset=offsetof(SE_ReadingList_t,results), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1},
-  {.offset=offsetof(SE_ReadingList_t,subscribable), .min=0, .max=1, .attribute=1, .bit=1, .type=ST_SIMPLE|XS_UBYTE, .n=3},
-  {.offset=offsetof(SE_ReadingList_t,Reading), .min=0, .unbounded=1, .index=359, .n=2},
+  {.offset=offsetof(SE_ReadingList_t,all), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1, .width=1},
+  {.offset=offsetof(SE_ReadingList_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2, .width=2},
+  {.offset=offsetof(SE_ReadingList_t,results), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1, .width=1},
+  {.offset=offsetof(SE_ReadingList_t,subscribable), .min=0, .max=1, .attribute=1, .bit=1, .type=ST_SIMPLE|XS_UBYTE, .n=3, .width=2},
+  {.offset=offsetof(SE_ReadingList_t,Reading), .min=0, .unbounded=1, .index=359, .n=2, .width=2},
   // ReadingSetListLink (1307)
   {.size=sizeof(SE_ReadingSetListLink_t), .index=451},
-  {.offset=offsetof(SE_ReadingSetListLink_t,all), .min=0, .max=1, .attribute=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=2},
-  {.offset=offsetof(SE_ReadingSetListLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1},
+  {.offset=offsetof(SE_ReadingSetListLink_t,all), .min=0, .max=1, .attribute=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=2, .width=2},
+  {.offset=offsetof(SE_ReadingSetListLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1, .width=1},
   // ReadingLink (1310)
   {.size=sizeof(SE_ReadingLink_t), .index=449},
-  {.offset=offsetof(SE_ReadingLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1},
+  {.offset=offsetof(SE_ReadingLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1, .width=1},
   // MeterReading (1312)
   {.size=sizeof(SE_MeterReading_t), .index=386},
-  {.offset=offsetof(SE_MeterReading_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2},
-  {.offset=offsetof(SE_MeterReading_t,mRID), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,16), .n=1},
-  {.offset=offsetof(SE_MeterReading_t,description), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|xs_type(XS_STRING,32), .n=6},
-  {.offset=offsetof(SE_MeterReading_t,version), .min=0, .max=1, .bit=2, .type=ST_SIMPLE|XS_USHORT, .n=5},
-  {.offset=offsetof(SE_MeterReading_t,RateComponentListLink), .min=0, .max=1, .bit=6, .index=1219, .n=4},
-  {.offset=offsetof(SE_MeterReading_t,ReadingLink), .min=0, .max=1, .bit=3, .index=1310, .n=3},
-  {.offset=offsetof(SE_MeterReading_t,ReadingSetListLink), .min=0, .max=1, .bit=4, .index=1307, .n=2},
-  {.offset=offsetof(SE_MeterReading_t,ReadingTypeLink), .min=1, .max=1, .index=988, .n=1},
+  {.offset=offsetof(SE_MeterReading_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2, .width=2},
+  {.offset=offsetof(SE_MeterReading_t,mRID), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,16), .n=1, .width=1},
+  {.offset=offsetof(SE_MeterReading_t,description), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|xs_type(XS_STRING,32), .n=6, .width=3},
+  {.offset=offsetof(SE_MeterReading_t,version), .min=0, .max=1, .bit=2, .type=ST_SIMPLE|XS_USHORT, .n=5, .width=3},
+  {.offset=offsetof(SE_MeterReading_t,RateComponentListLink), .min=0, .max=1, .bit=6, .index=1219, .n=4, .width=3},
+  {.offset=offsetof(SE_MeterReading_t,ReadingLink), .min=0, .max=1, .bit=3, .index=1310, .n=3, .width=2},
+  {.offset=offsetof(SE_MeterReading_t,ReadingSetListLink), .min=0, .max=1, .bit=4, .index=1307, .n=2, .width=2},
+  {.offset=offsetof(SE_MeterReading_t,ReadingTypeLink), .min=1, .max=1, .index=988, .n=1, .width=1},
   // MeterReadingList (1321)
   {.size=sizeof(SE_MeterReadingList_t), .index=543},
-  {.offset=offsetof(SE_MeterReadingList_t,all), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1},
-  {.offset=offsetof(SE_MeterReadingList_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2},
-  {.offset=offsetof(SE_MeterReadingList_t,results), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1},
-  {.offset=offsetof(SE_MeterReadingList_t,subscribable), .min=0, .max=1, .attribute=1, .bit=1, .type=ST_SIMPLE|XS_UBYTE, .n=3},
-  {.offset=offsetof(SE_MeterReadingList_t,MeterReading), .min=0, .unbounded=1, .index=1312, .n=2},
+  {.offset=offsetof(SE_MeterReadingList_t,all), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1, .width=1},
+  {.offset=offsetof(SE_MeterReadingList_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2, .width=2},
+  {.offset=offsetof(SE_MeterReadingList_t,results), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1, .width=1},
+  {.offset=offsetof(SE_MeterReadingList_t,subscribable), .min=0, .max=1, .attribute=1, .bit=1, .type=ST_SIMPLE|XS_UBYTE, .n=3, .width=2},
+  {.offset=offsetof(SE_MeterReadingList_t,MeterReading), .min=0, .unbounded=1, .index=1312, .n=2, .width=2},
   // TargetReduction (1327)
   {.size=sizeof(SE_TargetReduction_t), .index=0},
-  {.offset=offsetof(SE_TargetReduction_t,type), .min=1, .max=1, .type=ST_SIMPLE|XS_UBYTE, .n=1},
-  {.offset=offsetof(SE_TargetReduction_t,value), .min=1, .max=1, .type=ST_SIMPLE|XS_USHORT, .n=1},
+  {.offset=offsetof(SE_TargetReduction_t,type), .min=1, .max=1, .type=ST_SIMPLE|XS_UBYTE, .n=1, .width=1},
+  {.offset=offsetof(SE_TargetReduction_t,value), .min=1, .max=1, .type=ST_SIMPLE|XS_USHORT, .n=1, .width=1},
   // SetPoint (1330)
   {.size=sizeof(SE_SetPoint_t), .index=0},
-  {.offset=offsetof(SE_SetPoint_t,coolingSetpoint), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|XS_SHORT, .n=3},
-  {.offset=offsetof(SE_SetPoint_t,heatingSetpoint), .min=0, .max=1, .bit=1, .type=ST_SIMPLE|XS_SHORT, .n=2},
+  {.offset=offsetof(SE_SetPoint_t,coolingSetpoint), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|XS_SHORT, .n=3, .width=2},
+  {.offset=offsetof(SE_SetPoint_t,heatingSetpoint), .min=0, .max=1, .bit=1, .type=ST_SIMPLE|XS_SHORT, .n=2, .width=2},
   // Offset (1333)
   {.size=sizeof(SE_Offset_t), .index=0},
-  {.offset=offsetof(SE_Offset_t,coolingOffset), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|XS_UBYTE, .n=4},
-  {.offset=offsetof(SE_Offset_t,heatingOffset), .min=0, .max=1, .bit=1, .type=ST_SIMPLE|XS_UBYTE, .n=3},
-  {.offset=offsetof(SE_Offset_t,loadAdjustmentPercentageOffset), .min=0, .max=1, .bit=2, .type=ST_SIMPLE|XS_USHORT, .n=2},
+  {.offset=offsetof(SE_Offset_t,coolingOffset), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|XS_UBYTE, .n=4, .width=3},
+  {.offset=offsetof(SE_Offset_t,heatingOffset), .min=0, .max=1, .bit=1, .type=ST_SIMPLE|XS_UBYTE, .n=3, .width=2},
+  {.offset=offsetof(SE_Offset_t,loadAdjustmentPercentageOffset), .min=0, .max=1, .bit=2, .type=ST_SIMPLE|XS_USHORT, .n=2, .width=2},
   // DutyCycle (1337)
   {.size=sizeof(SE_DutyCycle_t), .index=0},
-  {.offset=offsetof(SE_DutyCycle_t,normalValue), .min=1, .max=1, .type=ST_SIMPLE|XS_UBYTE, .n=1},
+  {.offset=offsetof(SE_DutyCycle_t,normalValue), .min=1, .max=1, .type=ST_SIMPLE|XS_UBYTE, .n=1, .width=1},
   // ApplianceLoadReduction (1339)
   {.size=sizeof(SE_ApplianceLoadReduction_t), .index=0},
-  {.offset=offsetof(SE_ApplianceLoadReduction_t,type), .min=1, .max=1, .type=ST_SIMPLE|XS_UBYTE, .n=1},
+  {.offset=offsetof(SE_ApplianceLoadReduction_t,type), .min=1, .max=1, .type=ST_SIMPLE|XS_UBYTE, .n=1, .width=1},
   // EndDeviceControl (1341)
   {.size=sizeof(SE_EndDeviceControl_t), .index=655},
-  {.offset=offsetof(SE_EndDeviceControl_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=5},
-  {.offset=offsetof(SE_EndDeviceControl_t,replyTo), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=4},
-  {.offset=offsetof(SE_EndDeviceControl_t,responseRequired), .min=0, .max=1, .attribute=1, .bit=4, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,1), .n=3},
-  {.offset=offsetof(SE_EndDeviceControl_t,subscribable), .min=0, .max=1, .attribute=1, .bit=1, .type=ST_SIMPLE|XS_UBYTE, .n=2},
-  {.offset=offsetof(SE_EndDeviceControl_t,mRID), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,16), .n=1},
-  {.offset=offsetof(SE_EndDeviceControl_t,description), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|xs_type(XS_STRING,32), .n=3},
-  {.offset=offsetof(SE_EndDeviceControl_t,version), .min=0, .max=1, .bit=2, .type=ST_SIMPLE|XS_USHORT, .n=2},
-  {.offset=offsetof(SE_EndDeviceControl_t,creationTime), .min=1, .max=1, .type=ST_SIMPLE|XS_LONG, .n=1},
-  {.offset=offsetof(SE_EndDeviceControl_t,EventStatus), .min=1, .max=1, .index=630, .n=1},
-  {.offset=offsetof(SE_EndDeviceControl_t,interval), .min=1, .max=1, .index=349, .n=1},
-  {.offset=offsetof(SE_EndDeviceControl_t,randomizeDuration), .min=0, .max=1, .bit=5, .type=ST_SIMPLE|XS_SHORT, .n=4},
-  {.offset=offsetof(SE_EndDeviceControl_t,randomizeStart), .min=0, .max=1, .bit=6, .type=ST_SIMPLE|XS_SHORT, .n=3},
-  {.offset=offsetof(SE_EndDeviceControl_t,ApplianceLoadReduction), .min=0, .max=1, .bit=10, .index=1339, .n=2},
-  {.offset=offsetof(SE_EndDeviceControl_t,deviceCategory), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,4), .n=1},
-  {.min=1, .max=1, .bit=7, .type=ST_SIMPLE|XS_BOOLEAN, .n=1},
-  {.offset=offsetof(SE_EndDeviceControl_t,DutyCycle), .min=0, .max=1, .bit=11, .index=1337, .n=2},
-  {.min=1, .max=1, .bit=8, .type=ST_SIMPLE|XS_BOOLEAN, .n=1},
-  {.offset=offsetof(SE_EndDeviceControl_t,Offset), .min=0, .max=1, .bit=12, .index=1333, .n=5},
-  {.offset=offsetof(SE_EndDeviceControl_t,overrideDuration), .min=0, .max=1, .bit=13, .type=ST_SIMPLE|XS_USHORT, .n=4},
-  {.offset=offsetof(SE_EndDeviceControl_t,SetPoint), .min=0, .max=1, .bit=14, .index=1330, .n=3},
-  {.offset=offsetof(SE_EndDeviceControl_t,TargetReduction), .min=0, .max=1, .bit=9, .index=1327, .n=2},
+  {.offset=offsetof(SE_EndDeviceControl_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=5, .width=3},
+  {.offset=offsetof(SE_EndDeviceControl_t,replyTo), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=4, .width=3},
+  {.offset=offsetof(SE_EndDeviceControl_t,responseRequired), .min=0, .max=1, .attribute=1, .bit=4, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,1), .n=3, .width=2},
+  {.offset=offsetof(SE_EndDeviceControl_t,subscribable), .min=0, .max=1, .attribute=1, .bit=1, .type=ST_SIMPLE|XS_UBYTE, .n=2, .width=2},
+  {.offset=offsetof(SE_EndDeviceControl_t,mRID), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,16), .n=1, .width=1},
+  {.offset=offsetof(SE_EndDeviceControl_t,description), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|xs_type(XS_STRING,32), .n=3, .width=2},
+  {.offset=offsetof(SE_EndDeviceControl_t,version), .min=0, .max=1, .bit=2, .type=ST_SIMPLE|XS_USHORT, .n=2, .width=2},
+  {.offset=offsetof(SE_EndDeviceControl_t,creationTime), .min=1, .max=1, .type=ST_SIMPLE|XS_LONG, .n=1, .width=1},
+  {.offset=offsetof(SE_EndDeviceControl_t,EventStatus), .min=1, .max=1, .index=630, .n=1, .width=1},
+  {.offset=offsetof(SE_EndDeviceControl_t,interval), .min=1, .max=1, .index=349, .n=1, .width=1},
+  {.offset=offsetof(SE_EndDeviceControl_t,randomizeDuration), .min=0, .max=1, .bit=5, .type=ST_SIMPLE|XS_SHORT, .n=4, .width=3},
+  {.offset=offsetof(SE_EndDeviceControl_t,randomizeStart), .min=0, .max=1, .bit=6, .type=ST_SIMPLE|XS_SHORT, .n=3, .width=2},
+  {.offset=offsetof(SE_EndDeviceControl_t,ApplianceLoadReduction), .min=0, .max=1, .bit=10, .index=1339, .n=2, .width=2},
+  {.offset=offsetof(SE_EndDeviceControl_t,deviceCategory), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,4), .n=1, .width=1},
+  {.min=1, .max=1, .bit=7, .type=ST_SIMPLE|XS_BOOLEAN, .n=1, .width=1},
+  {.offset=offsetof(SE_EndDeviceControl_t,DutyCycle), .min=0, .max=1, .bit=11, .index=1337, .n=2, .width=2},
+  {.min=1, .max=1, .bit=8, .type=ST_SIMPLE|XS_BOOLEAN, .n=1, .width=1},
+  {.offset=offsetof(SE_EndDeviceControl_t,Offset), .min=0, .max=1, .bit=12, .index=1333, .n=5, .width=3},
+  {.offset=offsetof(SE_EndDeviceControl_t,overrideDuration), .min=0, .max=1, .bit=13, .type=ST_SIMPLE|XS_USHORT, .n=4, .width=3},
+  {.offset=offsetof(SE_EndDeviceControl_t,SetPoint), .min=0, .max=1, .bit=14, .index=1330, .n=3, .width=2},
+  {.offset=offsetof(SE_EndDeviceControl_t,TargetReduction), .min=0, .max=1, .bit=9, .index=1327, .n=2, .width=2},
   // EndDeviceControlList (1363)
   {.size=sizeof(SE_EndDeviceControlList_t), .index=543},
-  {.offset=offsetof(SE_EndDeviceControlList_t,all), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1},
-  {.offset=offsetof(SE_EndDeviceControlList_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2},
-  {.offset=offsetof(SE_EndDeviceControlList_t,results), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1},
-  {.offset=offsetof(SE_EndDeviceControlList_t,subscribable), .min=0, .max=1, .attribute=1, .bit=1, .type=ST_SIMPLE|XS_UBYTE, .n=3},
-  {.offset=offsetof(SE_EndDeviceControlList_t,EndDeviceControl), .min=0, .unbounded=1, .index=1341, .n=2},
+  {.offset=offsetof(SE_EndDeviceControlList_t,all), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1, .width=1},
+  {.offset=offsetof(SE_EndDeviceControlList_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2, .width=2},
+  {.offset=offsetof(SE_EndDeviceControlList_t,results), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1, .width=1},
+  {.offset=offsetof(SE_EndDeviceControlList_t,subscribable), .min=0, .max=1, .attribute=1, .bit=1, .type=ST_SIMPLE|XS_UBYTE, .n=3, .width=2},
+  {.offset=offsetof(SE_EndDeviceControlList_t,EndDeviceControl), .min=0, .unbounded=1, .index=1341, .n=2, .width=2},
   // EndDeviceControlListLink (1369)
   {.size=sizeof(SE_EndDeviceControlListLink_t), .index=451},
-  {.offset=offsetof(SE_EndDeviceControlListLink_t,all), .min=0, .max=1, .attribute=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=2},
-  {.offset=offsetof(SE_EndDeviceControlListLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1},
+  {.offset=offsetof(SE_EndDeviceControlListLink_t,all), .min=0, .max=1, .attribute=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=2, .width=2},
+  {.offset=offsetof(SE_EndDeviceControlListLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1, .width=1},
   // ActiveEndDeviceControlListLink (1372)
   {.size=sizeof(SE_ActiveEndDeviceControlListLink_t), .index=451},
-  {.offset=offsetof(SE_ActiveEndDeviceControlListLink_t,all), .min=0, .max=1, .attribute=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=2},
-  {.offset=offsetof(SE_ActiveEndDeviceControlListLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1},
+  {.offset=offsetof(SE_ActiveEndDeviceControlListLink_t,all), .min=0, .max=1, .attribute=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=2, .width=2},
+  {.offset=offsetof(SE_ActiveEndDeviceControlListLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1, .width=1},
   // DemandResponseProgram (1375)
   {.size=sizeof(SE_DemandResponseProgram_t), .index=368},
-  {.offset=offsetof(SE_DemandResponseProgram_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2},
-  {.offset=offsetof(SE_DemandResponseProgram_t,mRID), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,16), .n=1},
-  {.offset=offsetof(SE_DemandResponseProgram_t,description), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|xs_type(XS_STRING,32), .n=7},
-  {.offset=offsetof(SE_DemandResponseProgram_t,version), .min=0, .max=1, .bit=2, .type=ST_SIMPLE|XS_USHORT, .n=6},
-  {.offset=offsetof(SE_DemandResponseProgram_t,ActiveEndDeviceControlListLink), .min=0, .max=1, .bit=3, .index=1372, .n=5},
-  {.offset=offsetof(SE_DemandResponseProgram_t,availabilityUpdatePercentChangeThreshold), .min=0, .max=1, .bit=4, .type=ST_SIMPLE|XS_USHORT, .n=4},
-  {.offset=offsetof(SE_DemandResponseProgram_t,availabilityUpdatePowerChangeThreshold), .min=0, .max=1, .bit=5, .index=582, .n=3},
-  {.offset=offsetof(SE_DemandResponseProgram_t,EndDeviceControlListLink), .min=0, .max=1, .bit=6, .index=1369, .n=2},
-  {.offset=offsetof(SE_DemandResponseProgram_t,primacy), .min=1, .max=1, .type=ST_SIMPLE|XS_UBYTE, .n=1},
+  {.offset=offsetof(SE_DemandResponseProgram_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2, .width=2},
+  {.offset=offsetof(SE_DemandResponseProgram_t,mRID), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,16), .n=1, .width=1},
+  {.offset=offsetof(SE_DemandResponseProgram_t,description), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|xs_type(XS_STRING,32), .n=7, .width=3},
+  {.offset=offsetof(SE_DemandResponseProgram_t,version), .min=0, .max=1, .bit=2, .type=ST_SIMPLE|XS_USHORT, .n=6, .width=3},
+  {.offset=offsetof(SE_DemandResponseProgram_t,ActiveEndDeviceControlListLink), .min=0, .max=1, .bit=3, .index=1372, .n=5, .width=3},
+  {.offset=offsetof(SE_DemandResponseProgram_t,availabilityUpdatePercentChangeThreshold), .min=0, .max=1, .bit=4, .type=ST_SIMPLE|XS_USHORT, .n=4, .width=3},
+  {.offset=offsetof(SE_DemandResponseProgram_t,availabilityUpdatePowerChangeThreshold), .min=0, .max=1, .bit=5, .index=582, .n=3, .width=2},
+  {.offset=offsetof(SE_DemandResponseProgram_t,EndDeviceControlListLink), .min=0, .max=1, .bit=6, .index=1369, .n=2, .width=2},
+  {.offset=offsetof(SE_DemandResponseProgram_t,primacy), .min=1, .max=1, .type=ST_SIMPLE|XS_UBYTE, .n=1, .width=1},
   // DemandResponseProgramList (1385)
   {.size=sizeof(SE_DemandResponseProgramList_t), .index=543},
-  {.offset=offsetof(SE_DemandResponseProgramList_t,all), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1},
-  {.offset=offsetof(SE_DemandResponseProgramList_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=3},
-  {.offset=offsetof(SE_DemandResponseProgramList_t,pollRate), .min=0, .max=1, .attribute=1, .bit=18, .type=ST_SIMPLE|XS_UINT, .n=2},
-  {.offset=offsetof(SE_DemandResponseProgramList_t,results), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1},
-  {.offset=offsetof(SE_DemandResponseProgramList_t,subscribable), .min=0, .max=1, .attribute=1, .bit=1, .type=ST_SIMPLE|XS_UBYTE, .n=3},
-  {.offset=offsetof(SE_DemandResponseProgramList_t,DemandResponseProgram), .min=0, .unbounded=1, .index=1375, .n=2},
+  {.offset=offsetof(SE_DemandResponseProgramList_t,all), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1, .width=1},
+  {.offset=offsetof(SE_DemandResponseProgramList_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=3, .width=2},
+  {.offset=offsetof(SE_DemandResponseProgramList_t,pollRate), .min=0, .max=1, .attribute=1, .bit=18, .type=ST_SIMPLE|XS_UINT, .n=2, .width=2},
+  {.offset=offsetof(SE_DemandResponseProgramList_t,results), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1, .width=1},
+  {.offset=offsetof(SE_DemandResponseProgramList_t,subscribable), .min=0, .max=1, .attribute=1, .bit=1, .type=ST_SIMPLE|XS_UBYTE, .n=3, .width=2},
+  {.offset=offsetof(SE_DemandResponseProgramList_t,DemandResponseProgram), .min=0, .unbounded=1, .index=1375, .n=2, .width=2},
   // DemandResponseProgramLink (1392)
   {.size=sizeof(SE_DemandResponseProgramLink_t), .index=449},
-  {.offset=offsetof(SE_DemandResponseProgramLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1},
+  {.offset=offsetof(SE_DemandResponseProgramLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1, .width=1},
   // LoadShedAvailability (1394)
   {.size=sizeof(SE_LoadShedAvailability_t), .index=328},
-  {.offset=offsetof(SE_LoadShedAvailability_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=6},
-  {.offset=offsetof(SE_LoadShedAvailability_t,availabilityDuration), .min=0, .max=1, .bit=7, .type=ST_SIMPLE|XS_UINT, .n=5},
-  {.offset=offsetof(SE_LoadShedAvailability_t,DemandResponseProgramLink), .min=0, .max=1, .bit=0, .index=1392, .n=4},
-  {.offset=offsetof(SE_LoadShedAvailability_t,sheddablePercent), .min=0, .max=1, .bit=1, .type=ST_SIMPLE|XS_USHORT, .n=3},
-  {.offset=offsetof(SE_LoadShedAvailability_t,sheddablePower), .min=0, .max=1, .bit=2, .index=582, .n=2},
+  {.offset=offsetof(SE_LoadShedAvailability_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=6, .width=3},
+  {.offset=offsetof(SE_LoadShedAvailability_t,availabilityDuration), .min=0, .max=1, .bit=7, .type=ST_SIMPLE|XS_UINT, .n=5, .width=3},
+  {.offset=offsetof(SE_LoadShedAvailability_t,DemandResponseProgramLink), .min=0, .max=1, .bit=0, .index=1392, .n=4, .width=3},
+  {.offset=offsetof(SE_LoadShedAvailability_t,sheddablePercent), .min=0, .max=1, .bit=1, .type=ST_SIMPLE|XS_USHORT, .n=3, .width=2},
+  {.offset=offsetof(SE_LoadShedAvailability_t,sheddablePower), .min=0, .max=1, .bit=2, .index=582, .n=2, .width=2},
   // LoadShedAvailabilityList (1400)
   {.size=sizeof(SE_LoadShedAvailabilityList_t), .index=420},
-  {.offset=offsetof(SE_LoadShedAvailabilityList_t,all), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1},
-  {.offset=offsetof(SE_LoadShedAvailabilityList_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=3},
-  {.offset=offsetof(SE_LoadShedAvailabilityList_t,pollRate), .min=0, .max=1, .attribute=1, .bit=18, .type=ST_SIMPLE|XS_UINT, .n=2},
-  {.offset=offsetof(SE_LoadShedAvailabilityList_t,results), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1},
-  {.offset=offsetof(SE_LoadShedAvailabilityList_t,LoadShedAvailability), .min=0, .unbounded=1, .index=1394, .n=2},
+  {.offset=offsetof(SE_LoadShedAvailabilityList_t,all), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1, .width=1},
+  {.offset=offsetof(SE_LoadShedAvailabilityList_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=3, .width=2},
+  {.offset=offsetof(SE_LoadShedAvailabilityList_t,pollRate), .min=0, .max=1, .attribute=1, .bit=18, .type=ST_SIMPLE|XS_UINT, .n=2, .width=2},
+  {.offset=offsetof(SE_LoadShedAvailabilityList_t,results), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1, .width=1},
+  {.offset=offsetof(SE_LoadShedAvailabilityList_t,LoadShedAvailability), .min=0, .unbounded=1, .index=1394, .n=2, .width=2},
   // FileLink (1406)
   {.size=sizeof(SE_FileLink_t), .index=449},
-  {.offset=offsetof(SE_FileLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1},
+  {.offset=offsetof(SE_FileLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1, .width=1},
   // FileStatus (1408)
   {.size=sizeof(SE_FileStatus_t), .index=328},
-  {.offset=offsetof(SE_FileStatus_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=5},
-  {.offset=offsetof(SE_FileStatus_t,pollRate), .min=0, .max=1, .attribute=1, .bit=18, .type=ST_SIMPLE|XS_UINT, .n=4},
-  {.offset=offsetof(SE_FileStatus_t,activateTime), .min=0, .max=1, .bit=7, .type=ST_SIMPLE|XS_LONG, .n=3},
-  {.offset=offsetof(SE_FileStatus_t,FileLink), .min=0, .max=1, .bit=0, .index=1406, .n=2},
-  {.offset=offsetof(SE_FileStatus_t,loadPercent), .min=1, .max=1, .type=ST_SIMPLE|XS_UBYTE, .n=1},
-  {.offset=offsetof(SE_FileStatus_t,nextRequestAttempt), .min=1, .max=1, .type=ST_SIMPLE|XS_LONG, .n=1},
-  {.offset=offsetof(SE_FileStatus_t,request503Count), .min=1, .max=1, .type=ST_SIMPLE|XS_USHORT, .n=1},
-  {.offset=offsetof(SE_FileStatus_t,requestFailCount), .min=1, .max=1, .type=ST_SIMPLE|XS_USHORT, .n=1},
-  {.offset=offsetof(SE_FileStatus_t,status), .min=1, .max=1, .type=ST_SIMPLE|XS_UBYTE, .n=1},
-  {.offset=offsetof(SE_FileStatus_t,statusTime), .min=1, .max=1, .type=ST_SIMPLE|XS_LONG, .n=1},
+  {.offset=offsetof(SE_FileStatus_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=5, .width=3},
+  {.offset=offsetof(SE_FileStatus_t,pollRate), .min=0, .max=1, .attribute=1, .bit=18, .type=ST_SIMPLE|XS_UINT, .n=4, .width=3},
+  {.offset=offsetof(SE_FileStatus_t,activateTime), .min=0, .max=1, .bit=7, .type=ST_SIMPLE|XS_LONG, .n=3, .width=2},
+  {.offset=offsetof(SE_FileStatus_t,FileLink), .min=0, .max=1, .bit=0, .index=1406, .n=2, .width=2},
+  {.offset=offsetof(SE_FileStatus_t,loadPercent), .min=1, .max=1, .type=ST_SIMPLE|XS_UBYTE, .n=1, .width=1},
+  {.offset=offsetof(SE_FileStatus_t,nextRequestAttempt), .min=1, .max=1, .type=ST_SIMPLE|XS_LONG, .n=1, .width=1},
+  {.offset=offsetof(SE_FileStatus_t,request503Count), .min=1, .max=1, .type=ST_SIMPLE|XS_USHORT, .n=1, .width=1},
+  {.offset=offsetof(SE_FileStatus_t,requestFailCount), .min=1, .max=1, .type=ST_SIMPLE|XS_USHORT, .n=1, .width=1},
+  {.offset=offsetof(SE_FileStatus_t,status), .min=1, .max=1, .type=ST_SIMPLE|XS_UBYTE, .n=1, .width=1},
+  {.offset=offsetof(SE_FileStatus_t,statusTime), .min=1, .max=1, .type=ST_SIMPLE|XS_LONG, .n=1, .width=1},
   // File (1419)
   {.size=sizeof(SE_File_t), .index=328},
-  {.offset=offsetof(SE_File_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=3},
-  {.offset=offsetof(SE_File_t,activateTime), .min=0, .max=1, .bit=7, .type=ST_SIMPLE|XS_LONG, .n=2},
-  {.offset=offsetof(SE_File_t,fileURI), .min=1, .max=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1},
-  {.offset=offsetof(SE_File_t,lFDI), .min=0, .max=1, .bit=4, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,20), .n=3},
-  {.offset=offsetof(SE_File_t,mfHwVer), .min=0, .max=1, .bit=5, .type=ST_SIMPLE|xs_type(XS_STRING,32), .n=2},
-  {.offset=offsetof(SE_File_t,mfID), .min=1, .max=1, .type=ST_SIMPLE|XS_UINT, .n=1},
-  {.offset=offsetof(SE_File_t,mfModel), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_STRING,32), .n=1},
-  {.offset=offsetof(SE_File_t,mfSerNum), .min=0, .max=1, .bit=6, .type=ST_SIMPLE|xs_type(XS_STRING,32), .n=2},
-  {.offset=offsetof(SE_File_t,mfVer), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_STRING,16), .n=1},
-  {.offset=offsetof(SE_File_t,size), .min=1, .max=1, .type=ST_SIMPLE|XS_UINT, .n=1},
-  {.offset=offsetof(SE_File_t,type), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,2), .n=1},
+  {.offset=offsetof(SE_File_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=3, .width=2},
+  {.offset=offsetof(SE_File_t,activateTime), .min=0, .max=1, .bit=7, .type=ST_SIMPLE|XS_LONG, .n=2, .width=2},
+  {.offset=offsetof(SE_File_t,fileURI), .min=1, .max=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1, .width=1},
+  {.offset=offsetof(SE_File_t,lFDI), .min=0, .max=1, .bit=4, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,20), .n=3, .width=2},
+  {.offset=offsetof(SE_File_t,mfHwVer), .min=0, .max=1, .bit=5, .type=ST_SIMPLE|xs_type(XS_STRING,32), .n=2, .width=2},
+  {.offset=offsetof(SE_File_t,mfID), .min=1, .max=1, .type=ST_SIMPLE|XS_UINT, .n=1, .width=1},
+  {.offset=offsetof(SE_File_t,mfModel), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_STRING,32), .n=1, .width=1},
+  {.offset=offsetof(SE_File_t,mfSerNum), .min=0, .max=1, .bit=6, .type=ST_SIMPLE|xs_type(XS_STRING,32), .n=2, .width=2},
+  {.offset=offsetof(SE_File_t,mfVer), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_STRING,16), .n=1, .width=1},
+  {.offset=offsetof(SE_File_t,size), .min=1, .max=1, .type=ST_SIMPLE|XS_UINT, .n=1, .width=1},
+  {.offset=offsetof(SE_File_t,type), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,2), .n=1, .width=1},
   // FileList (1431)
   {.size=sizeof(SE_FileList_t), .index=420},
-  {.offset=offsetof(SE_FileList_t,all), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1},
-  {.offset=offsetof(SE_FileList_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=3},
-  {.offset=offsetof(SE_FileList_t,pollRate), .min=0, .max=1, .attribute=1, .bit=18, .type=ST_SIMPLE|XS_UINT, .n=2},
-  {.offset=offsetof(SE_FileList_t,results), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1},
-  {.offset=offsetof(SE_FileList_t,File), .min=0, .unbounded=1, .index=1419, .n=2},
+  {.offset=offsetof(SE_FileList_t,all), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1, .width=1},
+  {.offset=offsetof(SE_FileList_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=3, .width=2},
+  {.offset=offsetof(SE_FileList_t,pollRate), .min=0, .max=1, .attribute=1, .bit=18, .type=ST_SIMPLE|XS_UINT, .n=2, .width=2},
+  {.offset=offsetof(SE_FileList_t,results), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1, .width=1},
+  {.offset=offsetof(SE_FileList_t,File), .min=0, .unbounded=1, .index=1419, .n=2, .width=2},
   // RateComponentLink (1437)
   {.size=sizeof(SE_RateComponentLink_t), .index=449},
-  {.offset=offsetof(SE_RateComponentLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1},
+  {.offset=offsetof(SE_RateComponentLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1, .width=1},
   // PriceResponseCfg (1439)
   {.size=sizeof(SE_PriceResponseCfg_t), .index=328},
-  {.offset=offsetof(SE_PriceResponseCfg_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2},
-  {.offset=offsetof(SE_PriceResponseCfg_t,consumeThreshold), .min=1, .max=1, .type=ST_SIMPLE|XS_INT, .n=1},
-  {.offset=offsetof(SE_PriceResponseCfg_t,maxReductionThreshold), .min=1, .max=1, .type=ST_SIMPLE|XS_INT, .n=1},
-  {.offset=offsetof(SE_PriceResponseCfg_t,RateComponentLink), .min=1, .max=1, .index=1437, .n=1},
+  {.offset=offsetof(SE_PriceResponseCfg_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2, .width=2},
+  {.offset=offsetof(SE_PriceResponseCfg_t,consumeThreshold), .min=1, .max=1, .type=ST_SIMPLE|XS_INT, .n=1, .width=1},
+  {.offset=offsetof(SE_PriceResponseCfg_t,maxReductionThreshold), .min=1, .max=1, .type=ST_SIMPLE|XS_INT, .n=1, .width=1},
+  {.offset=offsetof(SE_PriceResponseCfg_t,RateComponentLink), .min=1, .max=1, .index=1437, .n=1, .width=1},
   // PriceResponseCfgList (1444)
   {.size=sizeof(SE_PriceResponseCfgList_t), .index=420},
-  {.offset=offsetof(SE_PriceResponseCfgList_t,all), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1},
-  {.offset=offsetof(SE_PriceResponseCfgList_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2},
-  {.offset=offsetof(SE_PriceResponseCfgList_t,results), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1},
-  {.offset=offsetof(SE_PriceResponseCfgList_t,PriceResponseCfg), .min=0, .unbounded=1, .index=1439, .n=2},
+  {.offset=offsetof(SE_PriceResponseCfgList_t,all), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1, .width=1},
+  {.offset=offsetof(SE_PriceResponseCfgList_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2, .width=2},
+  {.offset=offsetof(SE_PriceResponseCfgList_t,results), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1, .width=1},
+  {.offset=offsetof(SE_PriceResponseCfgList_t,PriceResponseCfg), .min=0, .unbounded=1, .index=1439, .n=2, .width=2},
   // TimeConfiguration (1449)
   {.size=sizeof(SE_TimeConfiguration_t), .index=0},
-  {.offset=offsetof(SE_TimeConfiguration_t,dstEndRule), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,4), .n=1},
-  {.offset=offsetof(SE_TimeConfiguration_t,dstOffset), .min=1, .max=1, .type=ST_SIMPLE|XS_INT, .n=1},
-  {.offset=offsetof(SE_TimeConfiguration_t,dstStartRule), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,4), .n=1},
-  {.offset=offsetof(SE_TimeConfiguration_t,tzOffset), .min=1, .max=1, .type=ST_SIMPLE|XS_INT, .n=1},
+  {.offset=offsetof(SE_TimeConfiguration_t,dstEndRule), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,4), .n=1, .width=1},
+  {.offset=offsetof(SE_TimeConfiguration_t,dstOffset), .min=1, .max=1, .type=ST_SIMPLE|XS_INT, .n=1, .width=1},
+  {.offset=offsetof(SE_TimeConfiguration_t,dstStartRule), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,4), .n=1, .width=1},
+  {.offset=offsetof(SE_TimeConfiguration_t,tzOffset), .min=1, .max=1, .type=ST_SIMPLE|XS_INT, .n=1, .width=1},
   // PriceResponseCfgListLink (1454)
   {.size=sizeof(SE_PriceResponseCfgListLink_t), .index=451},
-  {.offset=offsetof(SE_PriceResponseCfgListLink_t,all), .min=0, .max=1, .attribute=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=2},
-  {.offset=offsetof(SE_PriceResponseCfgListLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1},
+  {.offset=offsetof(SE_PriceResponseCfgListLink_t,all), .min=0, .max=1, .attribute=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=2, .width=2},
+  {.offset=offsetof(SE_PriceResponseCfgListLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1, .width=1},
   // PowerConfiguration (1457)
   {.size=sizeof(SE_PowerConfiguration_t), .index=0},
-  {.offset=offsetof(SE_PowerConfiguration_t,batteryInstallTime), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|XS_LONG, .n=3},
-  {.offset=offsetof(SE_PowerConfiguration_t,lowChargeThreshold), .min=0, .max=1, .bit=1, .type=ST_SIMPLE|XS_UINT, .n=2},
+  {.offset=offsetof(SE_PowerConfiguration_t,batteryInstallTime), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|XS_LONG, .n=3, .width=2},
+  {.offset=offsetof(SE_PowerConfiguration_t,lowChargeThreshold), .min=0, .max=1, .bit=1, .type=ST_SIMPLE|XS_UINT, .n=2, .width=2},
   // Configuration (1460)
   {.size=sizeof(SE_Configuration_t), .index=499},
-  {.offset=offsetof(SE_Configuration_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=4},
-  {.offset=offsetof(SE_Configuration_t,pollRate), .min=0, .max=1, .attribute=1, .bit=18, .type=ST_SIMPLE|XS_UINT, .n=3},
-  {.offset=offsetof(SE_Configuration_t,subscribable), .min=0, .max=1, .attribute=1, .bit=1, .type=ST_SIMPLE|XS_UBYTE, .n=2},
-  {.offset=offsetof(SE_Configuration_t,currentLocale), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_STRING,42), .n=1},
-  {.offset=offsetof(SE_Configuration_t,PowerConfiguration), .min=0, .max=1, .bit=2, .index=1457, .n=4},
-  {.offset=offsetof(SE_Configuration_t,PriceResponseCfgListLink), .min=0, .max=1, .bit=3, .index=1454, .n=3},
-  {.offset=offsetof(SE_Configuration_t,TimeConfiguration), .min=0, .max=1, .bit=4, .index=1449, .n=2},
-  {.offset=offsetof(SE_Configuration_t,userDeviceName), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_STRING,32), .n=1},
+  {.offset=offsetof(SE_Configuration_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=4, .width=3},
+  {.offset=offsetof(SE_Configuration_t,pollRate), .min=0, .max=1, .attribute=1, .bit=18, .type=ST_SIMPLE|XS_UINT, .n=3, .width=2},
+  {.offset=offsetof(SE_Configuration_t,subscribable), .min=0, .max=1, .attribute=1, .bit=1, .type=ST_SIMPLE|XS_UBYTE, .n=2, .width=2},
+  {.offset=offsetof(SE_Configuration_t,currentLocale), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_STRING,42), .n=1, .width=1},
+  {.offset=offsetof(SE_Configuration_t,PowerConfiguration), .min=0, .max=1, .bit=2, .index=1457, .n=4, .width=3},
+  {.offset=offsetof(SE_Configuration_t,PriceResponseCfgListLink), .min=0, .max=1, .bit=3, .index=1454, .n=3, .width=2},
+  {.offset=offsetof(SE_Configuration_t,TimeConfiguration), .min=0, .max=1, .bit=4, .index=1449, .n=2, .width=2},
+  {.offset=offsetof(SE_Configuration_t,userDeviceName), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_STRING,32), .n=1, .width=1},
   // LogEvent (1469)
   {.size=sizeof(SE_LogEvent_t), .index=328},
-  {.offset=offsetof(SE_LogEvent_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2},
-  {.offset=offsetof(SE_LogEvent_t,createdDateTime), .min=1, .max=1, .type=ST_SIMPLE|XS_LONG, .n=1},
-  {.offset=offsetof(SE_LogEvent_t,details), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|xs_type(XS_STRING,32), .n=3},
-  {.offset=offsetof(SE_LogEvent_t,extendedData), .min=0, .max=1, .bit=1, .type=ST_SIMPLE|XS_UINT, .n=2},
-  {.offset=offsetof(SE_LogEvent_t,functionSet), .min=1, .max=1, .type=ST_SIMPLE|XS_UBYTE, .n=1},
-  {.offset=offsetof(SE_LogEvent_t,logEventCode), .min=1, .max=1, .type=ST_SIMPLE|XS_UBYTE, .n=1},
-  {.offset=offsetof(SE_LogEvent_t,logEventID), .min=1, .max=1, .type=ST_SIMPLE|XS_USHORT, .n=1},
-  {.offset=offsetof(SE_LogEvent_t,logEventPEN), .min=1, .max=1, .type=ST_SIMPLE|XS_UINT, .n=1},
-  {.offset=offsetof(SE_LogEvent_t,profileID), .min=1, .max=1, .type=ST_SIMPLE|XS_UBYTE, .n=1},
+  {.offset=offsetof(SE_LogEvent_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2, .width=2},
+  {.offset=offsetof(SE_LogEvent_t,createdDateTime), .min=1, .max=1, .type=ST_SIMPLE|XS_LONG, .n=1, .width=1},
+  {.offset=offsetof(SE_LogEvent_t,details), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|xs_type(XS_STRING,32), .n=3, .width=2},
+  {.offset=offsetof(SE_LogEvent_t,extendedData), .min=0, .max=1, .bit=1, .type=ST_SIMPLE|XS_UINT, .n=2, .width=2},
+  {.offset=offsetof(SE_LogEvent_t,functionSet), .min=1, .max=1, .type=ST_SIMPLE|XS_UBYTE, .n=1, .width=1},
+  {.offset=offsetof(SE_LogEvent_t,logEventCode), .min=1, .max=1, .type=ST_SIMPLE|XS_UBYTE, .n=1, .width=1},
+  {.offset=offsetof(SE_LogEvent_t,logEventID), .min=1, .max=1, .type=ST_SIMPLE|XS_USHORT, .n=1, .width=1},
+  {.offset=offsetof(SE_LogEvent_t,logEventPEN), .min=1, .max=1, .type=ST_SIMPLE|XS_UINT, .n=1, .width=1},
+  {.offset=offsetof(SE_LogEvent_t,profileID), .min=1, .max=1, .type=ST_SIMPLE|XS_UBYTE, .n=1, .width=1},
   // LogEventList (1479)
   {.size=sizeof(SE_LogEventList_t), .index=543},
-  {.offset=offsetof(SE_LogEventList_t,all), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1},
-  {.offset=offsetof(SE_LogEventList_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=3},
-  {.offset=offsetof(SE_LogEventList_t,pollRate), .min=0, .max=1, .attribute=1, .bit=18, .type=ST_SIMPLE|XS_UINT, .n=2},
-  {.offset=offsetof(SE_LogEventList_t,results), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1},
-  {.offset=offsetof(SE_LogEventList_t,subscribable), .min=0, .max=1, .attribute=1, .bit=1, .type=ST_SIMPLE|XS_UBYTE, .n=3},
-  {.offset=offsetof(SE_LogEventList_t,LogEvent), .min=0, .unbounded=1, .index=1469, .n=2},
+  {.offset=offsetof(SE_LogEventList_t,all), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1, .width=1},
+  {.offset=offsetof(SE_LogEventList_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=3, .width=2},
+  {.offset=offsetof(SE_LogEventList_t,pollRate), .min=0, .max=1, .attribute=1, .bit=18, .type=ST_SIMPLE|XS_UINT, .n=2, .width=2},
+  {.offset=offsetof(SE_LogEventList_t,results), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1, .width=1},
+  {.offset=offsetof(SE_LogEventList_t,subscribable), .min=0, .max=1, .attribute=1, .bit=1, .type=ST_SIMPLE|XS_UBYTE, .n=3, .width=2},
+  {.offset=offsetof(SE_LogEventList_t,LogEvent), .min=0, .unbounded=1, .index=1469, .n=2, .width=2},
   // RPLSourceRoutes (1486)
   {.size=sizeof(SE_RPLSourceRoutes_t), .index=328},
-  {.offset=offsetof(SE_RPLSourceRoutes_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2},
-  {.offset=offsetof(SE_RPLSourceRoutes_t,DestAddress), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,16), .n=1},
-  {.offset=offsetof(SE_RPLSourceRoutes_t,SourceRoute), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,16), .n=1},
+  {.offset=offsetof(SE_RPLSourceRoutes_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2, .width=2},
+  {.offset=offsetof(SE_RPLSourceRoutes_t,DestAddress), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,16), .n=1, .width=1},
+  {.offset=offsetof(SE_RPLSourceRoutes_t,SourceRoute), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,16), .n=1, .width=1},
   // RPLSourceRoutesList (1490)
   {.size=sizeof(SE_RPLSourceRoutesList_t), .index=420},
-  {.offset=offsetof(SE_RPLSourceRoutesList_t,all), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1},
-  {.offset=offsetof(SE_RPLSourceRoutesList_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2},
-  {.offset=offsetof(SE_RPLSourceRoutesList_t,results), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1},
-  {.offset=offsetof(SE_RPLSourceRoutesList_t,RPLSourceRoutes), .min=0, .unbounded=1, .index=1486, .n=2},
+  {.offset=offsetof(SE_RPLSourceRoutesList_t,all), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1, .width=1},
+  {.offset=offsetof(SE_RPLSourceRoutesList_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2, .width=2},
+  {.offset=offsetof(SE_RPLSourceRoutesList_t,results), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1, .width=1},
+  {.offset=offsetof(SE_RPLSourceRoutesList_t,RPLSourceRoutes), .min=0, .unbounded=1, .index=1486, .n=2, .width=2},
   // RPLSourceRoutesListLink (1495)
   {.size=sizeof(SE_RPLSourceRoutesListLink_t), .index=451},
-  {.offset=offsetof(SE_RPLSourceRoutesListLink_t,all), .min=0, .max=1, .attribute=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=2},
-  {.offset=offsetof(SE_RPLSourceRoutesListLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1},
+  {.offset=offsetof(SE_RPLSourceRoutesListLink_t,all), .min=0, .max=1, .attribute=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=2, .width=2},
+  {.offset=offsetof(SE_RPLSourceRoutesListLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1, .width=1},
   // RPLInstance (1498)
   {.size=sizeof(SE_RPLInstance_t), .index=328},
-  {.offset=offsetof(SE_RPLInstance_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2},
-  {.offset=offsetof(SE_RPLInstance_t,DODAGid), .min=1, .max=1, .type=ST_SIMPLE|XS_UBYTE, .n=1},
-  {.min=1, .max=1, .bit=0, .type=ST_SIMPLE|XS_BOOLEAN, .n=1},
-  {.offset=offsetof(SE_RPLInstance_t,flags), .min=1, .max=1, .type=ST_SIMPLE|XS_UBYTE, .n=1},
-  {.min=1, .max=1, .bit=1, .type=ST_SIMPLE|XS_BOOLEAN, .n=1},
-  {.offset=offsetof(SE_RPLInstance_t,MOP), .min=1, .max=1, .type=ST_SIMPLE|XS_UBYTE, .n=1},
-  {.offset=offsetof(SE_RPLInstance_t,PRF), .min=1, .max=1, .type=ST_SIMPLE|XS_UBYTE, .n=1},
-  {.offset=offsetof(SE_RPLInstance_t,rank), .min=1, .max=1, .type=ST_SIMPLE|XS_USHORT, .n=1},
-  {.offset=offsetof(SE_RPLInstance_t,RPLInstanceID), .min=1, .max=1, .type=ST_SIMPLE|XS_UBYTE, .n=1},
-  {.offset=offsetof(SE_RPLInstance_t,RPLSourceRoutesListLink), .min=0, .max=1, .bit=2, .index=1495, .n=2},
-  {.offset=offsetof(SE_RPLInstance_t,versionNumber), .min=1, .max=1, .type=ST_SIMPLE|XS_UBYTE, .n=1},
+  {.offset=offsetof(SE_RPLInstance_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2, .width=2},
+  {.offset=offsetof(SE_RPLInstance_t,DODAGid), .min=1, .max=1, .type=ST_SIMPLE|XS_UBYTE, .n=1, .width=1},
+  {.min=1, .max=1, .bit=0, .type=ST_SIMPLE|XS_BOOLEAN, .n=1, .width=1},
+  {.offset=offsetof(SE_RPLInstance_t,flags), .min=1, .max=1, .type=ST_SIMPLE|XS_UBYTE, .n=1, .width=1},
+  {.min=1, .max=1, .bit=1, .type=ST_SIMPLE|XS_BOOLEAN, .n=1, .width=1},
+  {.offset=offsetof(SE_RPLInstance_t,MOP), .min=1, .max=1, .type=ST_SIMPLE|XS_UBYTE, .n=1, .width=1},
+  {.offset=offsetof(SE_RPLInstance_t,PRF), .min=1, .max=1, .type=ST_SIMPLE|XS_UBYTE, .n=1, .width=1},
+  {.offset=offsetof(SE_RPLInstance_t,rank), .min=1, .max=1, .type=ST_SIMPLE|XS_USHORT, .n=1, .width=1},
+  {.offset=offsetof(SE_RPLInstance_t,RPLInstanceID), .min=1, .max=1, .type=ST_SIMPLE|XS_UBYTE, .n=1, .width=1},
+  {.offset=offsetof(SE_RPLInstance_t,RPLSourceRoutesListLink), .min=0, .max=1, .bit=2, .index=1495, .n=2, .width=2},
+  {.offset=offsetof(SE_RPLInstance_t,versionNumber), .min=1, .max=1, .type=ST_SIMPLE|XS_UBYTE, .n=1, .width=1},
   // RPLInstanceList (1510)
   {.size=sizeof(SE_RPLInstanceList_t), .index=420},
-  {.offset=offsetof(SE_RPLInstanceList_t,all), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1},
-  {.offset=offsetof(SE_RPLInstanceList_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2},
-  {.offset=offsetof(SE_RPLInstanceList_t,results), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1},
-  {.offset=offsetof(SE_RPLInstanceList_t,RPLInstance), .min=0, .unbounded=1, .index=1498, .n=2},
+  {.offset=offsetof(SE_RPLInstanceList_t,all), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1, .width=1},
+  {.offset=offsetof(SE_RPLInstanceList_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2, .width=2},
+  {.offset=offsetof(SE_RPLInstanceList_t,results), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1, .width=1},
+  {.offset=offsetof(SE_RPLInstanceList_t,RPLInstance), .min=0, .unbounded=1, .index=1498, .n=2, .width=2},
   // Neighbor (1515)
   {.size=sizeof(SE_Neighbor_t), .index=328},
-  {.offset=offsetof(SE_Neighbor_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2},
-  {.min=1, .max=1, .bit=0, .type=ST_SIMPLE|XS_BOOLEAN, .n=1},
-  {.offset=offsetof(SE_Neighbor_t,linkQuality), .min=1, .max=1, .type=ST_SIMPLE|XS_UBYTE, .n=1},
-  {.offset=offsetof(SE_Neighbor_t,shortAddress), .min=1, .max=1, .type=ST_SIMPLE|XS_USHORT, .n=1},
+  {.offset=offsetof(SE_Neighbor_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2, .width=2},
+  {.min=1, .max=1, .bit=0, .type=ST_SIMPLE|XS_BOOLEAN, .n=1, .width=1},
+  {.offset=offsetof(SE_Neighbor_t,linkQuality), .min=1, .max=1, .type=ST_SIMPLE|XS_UBYTE, .n=1, .width=1},
+  {.offset=offsetof(SE_Neighbor_t,shortAddress), .min=1, .max=1, .type=ST_SIMPLE|XS_USHORT, .n=1, .width=1},
   // NeighborList (1520)
   {.size=sizeof(SE_NeighborList_t), .index=420},
-  {.offset=offsetof(SE_NeighborList_t,all), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1},
-  {.offset=offsetof(SE_NeighborList_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2},
-  {.offset=offsetof(SE_NeighborList_t,results), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1},
-  {.offset=offsetof(SE_NeighborList_t,Neighbor), .min=0, .unbounded=1, .index=1515, .n=2},
+  {.offset=offsetof(SE_NeighborList_t,all), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1, .width=1},
+  {.offset=offsetof(SE_NeighborList_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2, .width=2},
+  {.offset=offsetof(SE_NeighborList_t,results), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1, .width=1},
+  {.offset=offsetof(SE_NeighborList_t,Neighbor), .min=0, .unbounded=1, .index=1515, .n=2, .width=2},
   // loWPAN (1525)
   {.size=sizeof(SE_loWPAN_t), .index=0},
-  {.offset=offsetof(SE_loWPAN_t,octetsRx), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=3},
-  {.offset=offsetof(SE_loWPAN_t,octetsTx), .min=0, .max=1, .bit=1, .type=ST_SIMPLE|XS_UINT, .n=2},
-  {.offset=offsetof(SE_loWPAN_t,packetsRx), .min=1, .max=1, .type=ST_SIMPLE|XS_UINT, .n=1},
-  {.offset=offsetof(SE_loWPAN_t,packetsTx), .min=1, .max=1, .type=ST_SIMPLE|XS_UINT, .n=1},
-  {.offset=offsetof(SE_loWPAN_t,rxFragError), .min=1, .max=1, .type=ST_SIMPLE|XS_UINT, .n=1},
+  {.offset=offsetof(SE_loWPAN_t,octetsRx), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=3, .width=2},
+  {.offset=offsetof(SE_loWPAN_t,octetsTx), .min=0, .max=1, .bit=1, .type=ST_SIMPLE|XS_UINT, .n=2, .width=2},
+  {.offset=offsetof(SE_loWPAN_t,packetsRx), .min=1, .max=1, .type=ST_SIMPLE|XS_UINT, .n=1, .width=1},
+  {.offset=offsetof(SE_loWPAN_t,packetsTx), .min=1, .max=1, .type=ST_SIMPLE|XS_UINT, .n=1, .width=1},
+  {.offset=offsetof(SE_loWPAN_t,rxFragError), .min=1, .max=1, .type=ST_SIMPLE|XS_UINT, .n=1, .width=1},
   // NeighborListLink (1531)
   {.size=sizeof(SE_NeighborListLink_t), .index=451},
-  {.offset=offsetof(SE_NeighborListLink_t,all), .min=0, .max=1, .attribute=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=2},
-  {.offset=offsetof(SE_NeighborListLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1},
+  {.offset=offsetof(SE_NeighborListLink_t,all), .min=0, .max=1, .attribute=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=2, .width=2},
+  {.offset=offsetof(SE_NeighborListLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1, .width=1},
   // IEEE_802_15_4 (1534)
   {.size=sizeof(SE_IEEE_802_15_4_t), .index=0},
-  {.offset=offsetof(SE_IEEE_802_15_4_t,capabilityInfo), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,1), .n=1},
-  {.offset=offsetof(SE_IEEE_802_15_4_t,NeighborListLink), .min=0, .max=1, .bit=0, .index=1531, .n=2},
-  {.offset=offsetof(SE_IEEE_802_15_4_t,shortAddress), .min=1, .max=1, .type=ST_SIMPLE|XS_USHORT, .n=1},
+  {.offset=offsetof(SE_IEEE_802_15_4_t,capabilityInfo), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,1), .n=1, .width=1},
+  {.offset=offsetof(SE_IEEE_802_15_4_t,NeighborListLink), .min=0, .max=1, .bit=0, .index=1531, .n=2, .width=2},
+  {.offset=offsetof(SE_IEEE_802_15_4_t,shortAddress), .min=1, .max=1, .type=ST_SIMPLE|XS_USHORT, .n=1, .width=1},
   // LLInterface (1538)
   {.size=sizeof(SE_LLInterface_t), .index=328},
-  {.offset=offsetof(SE_LLInterface_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2},
-  {.offset=offsetof(SE_LLInterface_t,CRCerrors), .min=1, .max=1, .type=ST_SIMPLE|XS_UINT, .n=1},
-  {.offset=offsetof(SE_LLInterface_t,EUI64), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,8), .n=1},
-  {.offset=offsetof(SE_LLInterface_t,IEEE_802_15_4), .min=0, .max=1, .bit=0, .index=1534, .n=2},
-  {.offset=offsetof(SE_LLInterface_t,linkLayerType), .min=1, .max=1, .type=ST_SIMPLE|XS_UBYTE, .n=1},
-  {.offset=offsetof(SE_LLInterface_t,LLAckNotRx), .min=0, .max=1, .bit=1, .type=ST_SIMPLE|XS_UINT, .n=13},
-  {.offset=offsetof(SE_LLInterface_t,LLCSMAFail), .min=0, .max=1, .bit=2, .type=ST_SIMPLE|XS_UINT, .n=12},
-  {.offset=offsetof(SE_LLInterface_t,LLFramesDropRx), .min=0, .max=1, .bit=3, .type=ST_SIMPLE|XS_UINT, .n=11},
-  {.offset=offsetof(SE_LLInterface_t,LLFramesDropTx), .min=0, .max=1, .bit=4, .type=ST_SIMPLE|XS_UINT, .n=10},
-  {.offset=offsetof(SE_LLInterface_t,LLFramesRx), .min=0, .max=1, .bit=5, .type=ST_SIMPLE|XS_UINT, .n=9},
-  {.offset=offsetof(SE_LLInterface_t,LLFramesTx), .min=0, .max=1, .bit=6, .type=ST_SIMPLE|XS_UINT, .n=8},
-  {.offset=offsetof(SE_LLInterface_t,LLMediaAccessFail), .min=0, .max=1, .bit=7, .type=ST_SIMPLE|XS_UINT, .n=7},
-  {.offset=offsetof(SE_LLInterface_t,LLOctetsRx), .min=0, .max=1, .bit=8, .type=ST_SIMPLE|XS_UINT, .n=6},
-  {.offset=offsetof(SE_LLInterface_t,LLOctetsTx), .min=0, .max=1, .bit=9, .type=ST_SIMPLE|XS_UINT, .n=5},
-  {.offset=offsetof(SE_LLInterface_t,LLRetryCount), .min=0, .max=1, .bit=10, .type=ST_SIMPLE|XS_UINT, .n=4},
-  {.offset=offsetof(SE_LLInterface_t,LLSecurityErrorRx), .min=0, .max=1, .bit=11, .type=ST_SIMPLE|XS_UINT, .n=3},
-  {.offset=offsetof(SE_LLInterface_t,loWPAN), .min=0, .max=1, .bit=12, .index=1525, .n=2},
+  {.offset=offsetof(SE_LLInterface_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2, .width=2},
+  {.offset=offsetof(SE_LLInterface_t,CRCerrors), .min=1, .max=1, .type=ST_SIMPLE|XS_UINT, .n=1, .width=1},
+  {.offset=offsetof(SE_LLInterface_t,EUI64), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,8), .n=1, .width=1},
+  {.offset=offsetof(SE_LLInterface_t,IEEE_802_15_4), .min=0, .max=1, .bit=0, .index=1534, .n=2, .width=2},
+  {.offset=offsetof(SE_LLInterface_t,linkLayerType), .min=1, .max=1, .type=ST_SIMPLE|XS_UBYTE, .n=1, .width=1},
+  {.offset=offsetof(SE_LLInterface_t,LLAckNotRx), .min=0, .max=1, .bit=1, .type=ST_SIMPLE|XS_UINT, .n=13, .width=4},
+  {.offset=offsetof(SE_LLInterface_t,LLCSMAFail), .min=0, .max=1, .bit=2, .type=ST_SIMPLE|XS_UINT, .n=12, .width=4},
+  {.offset=offsetof(SE_LLInterface_t,LLFramesDropRx), .min=0, .max=1, .bit=3, .type=ST_SIMPLE|XS_UINT, .n=11, .width=4},
+  {.offset=offsetof(SE_LLInterface_t,LLFramesDropTx), .min=0, .max=1, .bit=4, .type=ST_SIMPLE|XS_UINT, .n=10, .width=4},
+  {.offset=offsetof(SE_LLInterface_t,LLFramesRx), .min=0, .max=1, .bit=5, .type=ST_SIMPLE|XS_UINT, .n=9, .width=4},
+  {.offset=offsetof(SE_LLInterface_t,LLFramesTx), .min=0, .max=1, .bit=6, .type=ST_SIMPLE|XS_UINT, .n=8, .width=4},
+  {.offset=offsetof(SE_LLInterface_t,LLMediaAccessFail), .min=0, .max=1, .bit=7, .type=ST_SIMPLE|XS_UINT, .n=7, .width=3},
+  {.offset=offsetof(SE_LLInterface_t,LLOctetsRx), .min=0, .max=1, .bit=8, .type=ST_SIMPLE|XS_UINT, .n=6, .width=3},
+  {.offset=offsetof(SE_LLInterface_t,LLOctetsTx), .min=0, .max=1, .bit=9, .type=ST_SIMPLE|XS_UINT, .n=5, .width=3},
+  {.offset=offsetof(SE_LLInterface_t,LLRetryCount), .min=0, .max=1, .bit=10, .type=ST_SIMPLE|XS_UINT, .n=4, .width=3},
+  {.offset=offsetof(SE_LLInterface_t,LLSecurityErrorRx), .min=0, .max=1, .bit=11, .type=ST_SIMPLE|XS_UINT, .n=3, .width=2},
+  {.offset=offsetof(SE_LLInterface_t,loWPAN), .min=0, .max=1, .bit=12, .index=1525, .n=2, .width=2},
   // LLInterfaceList (1556)
   {.size=sizeof(SE_LLInterfaceList_t), .index=420},
-  {.offset=offsetof(SE_LLInterfaceList_t,all), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1},
-  {.offset=offsetof(SE_LLInterfaceList_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2},
-  {.offset=offsetof(SE_LLInterfaceList_t,results), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1},
-  {.offset=offsetof(SE_LLInterfaceList_t,LLInterface), .min=0, .unbounded=1, .index=1538, .n=2},
+  {.offset=offsetof(SE_LLInterfaceList_t,all), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1, .width=1},
+  {.offset=offsetof(SE_LLInterfaceList_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2, .width=2},
+  {.offset=offsetof(SE_LLInterfaceList_t,results), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1, .width=1},
+  {.offset=offsetof(SE_LLInterfaceList_t,LLInterface), .min=0, .unbounded=1, .index=1538, .n=2, .width=2},
   // LLInterfaceListLink (1561)
   {.size=sizeof(SE_LLInterfaceListLink_t), .index=451},
-  {.offset=offsetof(SE_LLInterfaceListLink_t,all), .min=0, .max=1, .attribute=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=2},
-  {.offset=offsetof(SE_LLInterfaceListLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1},
+  {.offset=offsetof(SE_LLInterfaceListLink_t,all), .min=0, .max=1, .attribute=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=2, .width=2},
+  {.offset=offsetof(SE_LLInterfaceListLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1, .width=1},
   // IPAddrListLink (1564)
   {.size=sizeof(SE_IPAddrListLink_t), .index=451},
-  {.offset=offsetof(SE_IPAddrListLink_t,all), .min=0, .max=1, .attribute=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=2},
-  {.offset=offsetof(SE_IPAddrListLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1},
+  {.offset=offsetof(SE_IPAddrListLink_t,all), .min=0, .max=1, .attribute=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=2, .width=2},
+  {.offset=offsetof(SE_IPAddrListLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1, .width=1},
   // IPInterface (1567)
   {.size=sizeof(SE_IPInterface_t), .index=328},
-  {.offset=offsetof(SE_IPInterface_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=28},
-  {.offset=offsetof(SE_IPInterface_t,ifDescr), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|xs_type(XS_STRING,192), .n=27},
-  {.offset=offsetof(SE_IPInterface_t,ifHighSpeed), .min=0, .max=1, .bit=1, .type=ST_SIMPLE|XS_UINT, .n=26},
-  {.offset=offsetof(SE_IPInterface_t,ifInBroadcastPkts), .min=0, .max=1, .bit=2, .type=ST_SIMPLE|XS_UINT, .n=25},
-  {.offset=offsetof(SE_IPInterface_t,ifIndex), .min=0, .max=1, .bit=3, .type=ST_SIMPLE|XS_UINT, .n=24},
-  {.offset=offsetof(SE_IPInterface_t,ifInDiscards), .min=0, .max=1, .bit=4, .type=ST_SIMPLE|XS_UINT, .n=23},
-  {.offset=offsetof(SE_IPInterface_t,ifInErrors), .min=0, .max=1, .bit=5, .type=ST_SIMPLE|XS_UINT, .n=22},
-  {.offset=offsetof(SE_IPInterface_t,ifInMulticastPkts), .min=0, .max=1, .bit=6, .type=ST_SIMPLE|XS_UINT, .n=21},
-  {.offset=offsetof(SE_IPInterface_t,ifInOctets), .min=0, .max=1, .bit=7, .type=ST_SIMPLE|XS_UINT, .n=20},
-  {.offset=offsetof(SE_IPInterface_t,ifInUcastPkts), .min=0, .max=1, .bit=8, .type=ST_SIMPLE|XS_UINT, .n=19},
-  {.offset=offsetof(SE_IPInterface_t,ifInUnknownProtos), .min=0, .max=1, .bit=9, .type=ST_SIMPLE|XS_UINT, .n=18},
-  {.offset=offsetof(SE_IPInterface_t,ifMtu), .min=0, .max=1, .bit=10, .type=ST_SIMPLE|XS_UINT, .n=17},
-  {.offset=offsetof(SE_IPInterface_t,ifName), .min=0, .max=1, .bit=11, .type=ST_SIMPLE|xs_type(XS_STRING,16), .n=16},
-  {.offset=offsetof(SE_IPInterface_t,ifOperStatus), .min=0, .max=1, .bit=12, .type=ST_SIMPLE|XS_UBYTE, .n=15},
-  {.offset=offsetof(SE_IPInterface_t,ifOutBroadcastPkts), .min=0, .max=1, .bit=13, .type=ST_SIMPLE|XS_UINT, .n=14},
-  {.offset=offsetof(SE_IPInterface_t,ifOutDiscards), .min=0, .max=1, .bit=14, .type=ST_SIMPLE|XS_UINT, .n=13},
-  {.offset=offsetof(SE_IPInterface_t,ifOutErrors), .min=0, .max=1, .bit=15, .type=ST_SIMPLE|XS_UINT, .n=12},
-  {.offset=offsetof(SE_IPInterface_t,ifOutMulticastPkts), .min=0, .max=1, .bit=16, .type=ST_SIMPLE|XS_UINT, .n=11},
-  {.offset=offsetof(SE_IPInterface_t,ifOutOctets), .min=0, .max=1, .bit=17, .type=ST_SIMPLE|XS_UINT, .n=10},
-  {.offset=offsetof(SE_IPInterface_t,ifOutUcastPkts), .min=0, .max=1, .bit=18, .type=ST_SIMPLE|XS_UINT, .n=9},
-  {.min=0, .max=1, .bit=19, .type=ST_SIMPLE|XS_BOOLEAN, .n=8},
-  {.offset=offsetof(SE_IPInterface_t,ifSpeed), .min=0, .max=1, .bit=21, .type=ST_SIMPLE|XS_UINT, .n=7},
-  {.offset=offsetof(SE_IPInterface_t,ifType), .min=0, .max=1, .bit=22, .type=ST_SIMPLE|XS_USHORT, .n=6},
-  {.offset=offsetof(SE_IPInterface_t,IPAddrListLink), .min=0, .max=1, .bit=23, .index=1564, .n=5},
-  {.offset=offsetof(SE_IPInterface_t,lastResetTime), .min=0, .max=1, .bit=24, .type=ST_SIMPLE|XS_LONG, .n=4},
-  {.offset=offsetof(SE_IPInterface_t,lastUpdatedTime), .min=0, .max=1, .bit=25, .type=ST_SIMPLE|XS_LONG, .n=3},
-  {.offset=offsetof(SE_IPInterface_t,LLInterfaceListLink), .min=0, .max=1, .bit=26, .index=1561, .n=2},
+  {.offset=offsetof(SE_IPInterface_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=28, .width=5},
+  {.offset=offsetof(SE_IPInterface_t,ifDescr), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|xs_type(XS_STRING,192), .n=27, .width=5},
+  {.offset=offsetof(SE_IPInterface_t,ifHighSpeed), .min=0, .max=1, .bit=1, .type=ST_SIMPLE|XS_UINT, .n=26, .width=5},
+  {.offset=offsetof(SE_IPInterface_t,ifInBroadcastPkts), .min=0, .max=1, .bit=2, .type=ST_SIMPLE|XS_UINT, .n=25, .width=5},
+  {.offset=offsetof(SE_IPInterface_t,ifIndex), .min=0, .max=1, .bit=3, .type=ST_SIMPLE|XS_UINT, .n=24, .width=5},
+  {.offset=offsetof(SE_IPInterface_t,ifInDiscards), .min=0, .max=1, .bit=4, .type=ST_SIMPLE|XS_UINT, .n=23, .width=5},
+  {.offset=offsetof(SE_IPInterface_t,ifInErrors), .min=0, .max=1, .bit=5, .type=ST_SIMPLE|XS_UINT, .n=22, .width=5},
+  {.offset=offsetof(SE_IPInterface_t,ifInMulticastPkts), .min=0, .max=1, .bit=6, .type=ST_SIMPLE|XS_UINT, .n=21, .width=5},
+  {.offset=offsetof(SE_IPInterface_t,ifInOctets), .min=0, .max=1, .bit=7, .type=ST_SIMPLE|XS_UINT, .n=20, .width=5},
+  {.offset=offsetof(SE_IPInterface_t,ifInUcastPkts), .min=0, .max=1, .bit=8, .type=ST_SIMPLE|XS_UINT, .n=19, .width=5},
+  {.offset=offsetof(SE_IPInterface_t,ifInUnknownProtos), .min=0, .max=1, .bit=9, .type=ST_SIMPLE|XS_UINT, .n=18, .width=5},
+  {.offset=offsetof(SE_IPInterface_t,ifMtu), .min=0, .max=1, .bit=10, .type=ST_SIMPLE|XS_UINT, .n=17, .width=5},
+  {.offset=offsetof(SE_IPInterface_t,ifName), .min=0, .max=1, .bit=11, .type=ST_SIMPLE|xs_type(XS_STRING,16), .n=16, .width=5},
+  {.offset=offsetof(SE_IPInterface_t,ifOperStatus), .min=0, .max=1, .bit=12, .type=ST_SIMPLE|XS_UBYTE, .n=15, .width=4},
+  {.offset=offsetof(SE_IPInterface_t,ifOutBroadcastPkts), .min=0, .max=1, .bit=13, .type=ST_SIMPLE|XS_UINT, .n=14, .width=4},
+  {.offset=offsetof(SE_IPInterface_t,ifOutDiscards), .min=0, .max=1, .bit=14, .type=ST_SIMPLE|XS_UINT, .n=13, .width=4},
+  {.offset=offsetof(SE_IPInterface_t,ifOutErrors), .min=0, .max=1, .bit=15, .type=ST_SIMPLE|XS_UINT, .n=12, .width=4},
+  {.offset=offsetof(SE_IPInterface_t,ifOutMulticastPkts), .min=0, .max=1, .bit=16, .type=ST_SIMPLE|XS_UINT, .n=11, .width=4},
+  {.offset=offsetof(SE_IPInterface_t,ifOutOctets), .min=0, .max=1, .bit=17, .type=ST_SIMPLE|XS_UINT, .n=10, .width=4},
+  {.offset=offsetof(SE_IPInterface_t,ifOutUcastPkts), .min=0, .max=1, .bit=18, .type=ST_SIMPLE|XS_UINT, .n=9, .width=4},
+  {.min=0, .max=1, .bit=19, .type=ST_SIMPLE|XS_BOOLEAN, .n=8, .width=4},
+  {.offset=offsetof(SE_IPInterface_t,ifSpeed), .min=0, .max=1, .bit=21, .type=ST_SIMPLE|XS_UINT, .n=7, .width=3},
+  {.offset=offsetof(SE_IPInterface_t,ifType), .min=0, .max=1, .bit=22, .type=ST_SIMPLE|XS_USHORT, .n=6, .width=3},
+  {.offset=offsetof(SE_IPInterface_t,IPAddrListLink), .min=0, .max=1, .bit=23, .index=1564, .n=5, .width=3},
+  {.offset=offsetof(SE_IPInterface_t,lastResetTime), .min=0, .max=1, .bit=24, .type=ST_SIMPLE|XS_LONG, .n=4, .width=3},
+  {.offset=offsetof(SE_IPInterface_t,lastUpdatedTime), .min=0, .max=1, .bit=25, .type=ST_SIMPLE|XS_LONG, .n=3, .width=2},
+  {.offset=offsetof(SE_IPInterface_t,LLInterfaceListLink), .min=0, .max=1, .bit=26, .index=1561, .n=2, .width=2},
   // IPInterfaceList (1595)
   {.size=sizeof(SE_IPInterfaceList_t), .index=420},
-  {.offset=offsetof(SE_IPInterfaceList_t,all), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1},
-  {.offset=offsetof(SE_IPInterfaceList_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=3},
-  {.offset=offsetof(SE_IPInterfaceList_t,pollRate), .min=0, .max=1, .attribute=1, .bit=18, .type=ST_SIMPLE|XS_UINT, .n=2},
-  {.offset=offsetof(SE_IPInterfaceList_t,results), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1},
-  {.offset=offsetof(SE_IPInterfaceList_t,IPInterface), .min=0, .unbounded=1, .index=1567, .n=2},
+  {.offset=offsetof(SE_IPInterfaceList_t,all), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1, .width=1},
+  {.offset=offsetof(SE_IPInterfaceList_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=3, .width=2},
+  {.offset=offsetof(SE_IPInterfaceList_t,pollRate), .min=0, .max=1, .attribute=1, .bit=18, .type=ST_SIMPLE|XS_UINT, .n=2, .width=2},
+  {.offset=offsetof(SE_IPInterfaceList_t,results), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1, .width=1},
+  {.offset=offsetof(SE_IPInterfaceList_t,IPInterface), .min=0, .unbounded=1, .index=1567, .n=2, .width=2},
   // RPLInstanceListLink (1601)
   {.size=sizeof(SE_RPLInstanceListLink_t), .index=451},
-  {.offset=offsetof(SE_RPLInstanceListLink_t,all), .min=0, .max=1, .attribute=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=2},
-  {.offset=offsetof(SE_RPLInstanceListLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1},
+  {.offset=offsetof(SE_RPLInstanceListLink_t,all), .min=0, .max=1, .attribute=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=2, .width=2},
+  {.offset=offsetof(SE_RPLInstanceListLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1, .width=1},
   // IPAddr (1604)
   {.size=sizeof(SE_IPAddr_t), .index=328},
-  {.offset=offsetof(SE_IPAddr_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2},
-  {.offset=offsetof(SE_IPAddr_t,address), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,16), .n=1},
-  {.offset=offsetof(SE_IPAddr_t,RPLInstanceListLink), .min=0, .max=1, .bit=0, .index=1601, .n=2},
+  {.offset=offsetof(SE_IPAddr_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2, .width=2},
+  {.offset=offsetof(SE_IPAddr_t,address), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,16), .n=1, .width=1},
+  {.offset=offsetof(SE_IPAddr_t,RPLInstanceListLink), .min=0, .max=1, .bit=0, .index=1601, .n=2, .width=2},
   // IPAddrList (1608)
   {.size=sizeof(SE_IPAddrList_t), .index=420},
-  {.offset=offsetof(SE_IPAddrList_t,all), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1},
-  {.offset=offsetof(SE_IPAddrList_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2},
-  {.offset=offsetof(SE_IPAddrList_t,results), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1},
-  {.offset=offsetof(SE_IPAddrList_t,IPAddr), .min=0, .unbounded=1, .index=1604, .n=2},
+  {.offset=offsetof(SE_IPAddrList_t,all), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1, .width=1},
+  {.offset=offsetof(SE_IPAddrList_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2, .width=2},
+  {.offset=offsetof(SE_IPAddrList_t,results), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1, .width=1},
+  {.offset=offsetof(SE_IPAddrList_t,IPAddr), .min=0, .unbounded=1, .index=1604, .n=2, .width=2},
   // PEVInfo (1613)
   {.size=sizeof(SE_PEVInfo_t), .index=0},
-  {.offset=offsetof(SE_PEVInfo_t,chargingPowerNow), .min=1, .max=1, .index=582, .n=1},
-  {.offset=offsetof(SE_PEVInfo_t,energyRequestNow), .min=1, .max=1, .index=914, .n=1},
-  {.offset=offsetof(SE_PEVInfo_t,maxForwardPower), .min=1, .max=1, .index=582, .n=1},
-  {.offset=offsetof(SE_PEVInfo_t,minimumChargingDuration), .min=1, .max=1, .type=ST_SIMPLE|XS_UINT, .n=1},
-  {.offset=offsetof(SE_PEVInfo_t,targetStateOfCharge), .min=1, .max=1, .type=ST_SIMPLE|XS_USHORT, .n=1},
-  {.offset=offsetof(SE_PEVInfo_t,timeChargeIsNeeded), .min=1, .max=1, .type=ST_SIMPLE|XS_LONG, .n=1},
-  {.offset=offsetof(SE_PEVInfo_t,timeChargingStatusPEV), .min=1, .max=1, .type=ST_SIMPLE|XS_LONG, .n=1},
+  {.offset=offsetof(SE_PEVInfo_t,chargingPowerNow), .min=1, .max=1, .index=582, .n=1, .width=1},
+  {.offset=offsetof(SE_PEVInfo_t,energyRequestNow), .min=1, .max=1, .index=914, .n=1, .width=1},
+  {.offset=offsetof(SE_PEVInfo_t,maxForwardPower), .min=1, .max=1, .index=582, .n=1, .width=1},
+  {.offset=offsetof(SE_PEVInfo_t,minimumChargingDuration), .min=1, .max=1, .type=ST_SIMPLE|XS_UINT, .n=1, .width=1},
+  {.offset=offsetof(SE_PEVInfo_t,targetStateOfCharge), .min=1, .max=1, .type=ST_SIMPLE|XS_USHORT, .n=1, .width=1},
+  {.offset=offsetof(SE_PEVInfo_t,timeChargeIsNeeded), .min=1, .max=1, .type=ST_SIMPLE|XS_LONG, .n=1, .width=1},
+  {.offset=offsetof(SE_PEVInfo_t,timeChargingStatusPEV), .min=1, .max=1, .type=ST_SIMPLE|XS_LONG, .n=1, .width=1},
   // PowerStatus (1621)
   {.size=sizeof(SE_PowerStatus_t), .index=328},
-  {.offset=offsetof(SE_PowerStatus_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=3},
-  {.offset=offsetof(SE_PowerStatus_t,pollRate), .min=0, .max=1, .attribute=1, .bit=18, .type=ST_SIMPLE|XS_UINT, .n=2},
-  {.offset=offsetof(SE_PowerStatus_t,batteryStatus), .min=1, .max=1, .type=ST_SIMPLE|XS_UBYTE, .n=1},
-  {.offset=offsetof(SE_PowerStatus_t,changedTime), .min=1, .max=1, .type=ST_SIMPLE|XS_LONG, .n=1},
-  {.offset=offsetof(SE_PowerStatus_t,currentPowerSource), .min=1, .max=1, .type=ST_SIMPLE|XS_UBYTE, .n=1},
-  {.offset=offsetof(SE_PowerStatus_t,estimatedChargeRemaining), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|XS_USHORT, .n=6},
-  {.offset=offsetof(SE_PowerStatus_t,estimatedTimeRemaining), .min=0, .max=1, .bit=1, .type=ST_SIMPLE|XS_UINT, .n=5},
-  {.offset=offsetof(SE_PowerStatus_t,PEVInfo), .min=0, .max=1, .bit=2, .index=1613, .n=4},
-  {.offset=offsetof(SE_PowerStatus_t,sessionTimeOnBattery), .min=0, .max=1, .bit=3, .type=ST_SIMPLE|XS_UINT, .n=3},
-  {.offset=offsetof(SE_PowerStatus_t,totalTimeOnBattery), .min=0, .max=1, .bit=4, .type=ST_SIMPLE|XS_UINT, .n=2},
+  {.offset=offsetof(SE_PowerStatus_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=3, .width=2},
+  {.offset=offsetof(SE_PowerStatus_t,pollRate), .min=0, .max=1, .attribute=1, .bit=18, .type=ST_SIMPLE|XS_UINT, .n=2, .width=2},
+  {.offset=offsetof(SE_PowerStatus_t,batteryStatus), .min=1, .max=1, .type=ST_SIMPLE|XS_UBYTE, .n=1, .width=1},
+  {.offset=offsetof(SE_PowerStatus_t,changedTime), .min=1, .max=1, .type=ST_SIMPLE|XS_LONG, .n=1, .width=1},
+  {.offset=offsetof(SE_PowerStatus_t,currentPowerSource), .min=1, .max=1, .type=ST_SIMPLE|XS_UBYTE, .n=1, .width=1},
+  {.offset=offsetof(SE_PowerStatus_t,estimatedChargeRemaining), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|XS_USHORT, .n=6, .width=3},
+  {.offset=offsetof(SE_PowerStatus_t,estimatedTimeRemaining), .min=0, .max=1, .bit=1, .type=ST_SIMPLE|XS_UINT, .n=5, .width=3},
+  {.offset=offsetof(SE_PowerStatus_t,PEVInfo), .min=0, .max=1, .bit=2, .index=1613, .n=4, .width=3},
+  {.offset=offsetof(SE_PowerStatus_t,sessionTimeOnBattery), .min=0, .max=1, .bit=3, .type=ST_SIMPLE|XS_UINT, .n=3, .width=2},
+  {.offset=offsetof(SE_PowerStatus_t,totalTimeOnBattery), .min=0, .max=1, .bit=4, .type=ST_SIMPLE|XS_UINT, .n=2, .width=2},
   // SupportedLocale (1632)
   {.size=sizeof(SE_SupportedLocale_t), .index=328},
-  {.offset=offsetof(SE_SupportedLocale_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2},
-  {.offset=offsetof(SE_SupportedLocale_t,locale), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_STRING,42), .n=1},
+  {.offset=offsetof(SE_SupportedLocale_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2, .width=2},
+  {.offset=offsetof(SE_SupportedLocale_t,locale), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_STRING,42), .n=1, .width=1},
   // SupportedLocaleList (1635)
   {.size=sizeof(SE_SupportedLocaleList_t), .index=420},
-  {.offset=offsetof(SE_SupportedLocaleList_t,all), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1},
-  {.offset=offsetof(SE_SupportedLocaleList_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2},
-  {.offset=offsetof(SE_SupportedLocaleList_t,results), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1},
-  {.offset=offsetof(SE_SupportedLocaleList_t,SupportedLocale), .min=0, .unbounded=1, .index=1632, .n=2},
+  {.offset=offsetof(SE_SupportedLocaleList_t,all), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1, .width=1},
+  {.offset=offsetof(SE_SupportedLocaleList_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2, .width=2},
+  {.offset=offsetof(SE_SupportedLocaleList_t,results), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1, .width=1},
+  {.offset=offsetof(SE_SupportedLocaleList_t,SupportedLocale), .min=0, .unbounded=1, .index=1632, .n=2, .width=2},
   // SupportedLocaleListLink (1640)
   {.size=sizeof(SE_SupportedLocaleListLink_t), .index=451},
-  {.offset=offsetof(SE_SupportedLocaleListLink_t,all), .min=0, .max=1, .attribute=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=2},
-  {.offset=offsetof(SE_SupportedLocaleListLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1},
+  {.offset=offsetof(SE_SupportedLocaleListLink_t,all), .min=0, .max=1, .attribute=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=2, .width=2},
+  {.offset=offsetof(SE_SupportedLocaleListLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1, .width=1},
   // GPSLocationType (1643)
   {.size=sizeof(SE_GPSLocationType_t), .index=0},
-  {.offset=offsetof(SE_GPSLocationType_t,lat), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_STRING,32), .n=1},
-  {.offset=offsetof(SE_GPSLocationType_t,lon), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_STRING,32), .n=1},
+  {.offset=offsetof(SE_GPSLocationType_t,lat), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_STRING,32), .n=1, .width=1},
+  {.offset=offsetof(SE_GPSLocationType_t,lon), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_STRING,32), .n=1, .width=1},
   // DRLCCapabilities (1646)
   {.size=sizeof(SE_DRLCCapabilities_t), .index=0},
-  {.offset=offsetof(SE_DRLCCapabilities_t,averageEnergy), .min=1, .max=1, .index=914, .n=1},
-  {.offset=offsetof(SE_DRLCCapabilities_t,maxDemand), .min=1, .max=1, .index=582, .n=1},
-  {.offset=offsetof(SE_DRLCCapabilities_t,optionsImplemented), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,4), .n=1},
+  {.offset=offsetof(SE_DRLCCapabilities_t,averageEnergy), .min=1, .max=1, .index=914, .n=1, .width=1},
+  {.offset=offsetof(SE_DRLCCapabilities_t,maxDemand), .min=1, .max=1, .index=582, .n=1, .width=1},
+  {.offset=offsetof(SE_DRLCCapabilities_t,optionsImplemented), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,4), .n=1, .width=1},
   // DeviceInformation (1650)
   {.size=sizeof(SE_DeviceInformation_t), .index=328},
-  {.offset=offsetof(SE_DeviceInformation_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=6},
-  {.offset=offsetof(SE_DeviceInformation_t,pollRate), .min=0, .max=1, .attribute=1, .bit=18, .type=ST_SIMPLE|XS_UINT, .n=5},
-  {.offset=offsetof(SE_DeviceInformation_t,DRLCCapabilities), .min=0, .max=1, .bit=0, .index=1646, .n=4},
-  {.offset=offsetof(SE_DeviceInformation_t,functionsImplemented), .min=0, .max=1, .bit=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,8), .n=3},
-  {.offset=offsetof(SE_DeviceInformation_t,gpsLocation), .min=0, .max=1, .bit=2, .index=1643, .n=2},
-  {.offset=offsetof(SE_DeviceInformation_t,lFDI), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,20), .n=1},
-  {.offset=offsetof(SE_DeviceInformation_t,mfDate), .min=1, .max=1, .type=ST_SIMPLE|XS_LONG, .n=1},
-  {.offset=offsetof(SE_DeviceInformation_t,mfHwVer), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_STRING,32), .n=1},
-  {.offset=offsetof(SE_DeviceInformation_t,mfID), .min=1, .max=1, .type=ST_SIMPLE|XS_UINT, .n=1},
-  {.offset=offsetof(SE_DeviceInformation_t,mfInfo), .min=0, .max=1, .bit=3, .type=ST_SIMPLE|xs_type(XS_STRING,32), .n=2},
-  {.offset=offsetof(SE_DeviceInformation_t,mfModel), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_STRING,32), .n=1},
-  {.offset=offsetof(SE_DeviceInformation_t,mfSerNum), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_STRING,32), .n=1},
-  {.offset=offsetof(SE_DeviceInformation_t,primaryPower), .min=1, .max=1, .type=ST_SIMPLE|XS_UBYTE, .n=1},
-  {.offset=offsetof(SE_DeviceInformation_t,secondaryPower), .min=1, .max=1, .type=ST_SIMPLE|XS_UBYTE, .n=1},
-  {.offset=offsetof(SE_DeviceInformation_t,SupportedLocaleListLink), .min=0, .max=1, .bit=4, .index=1640, .n=2},
-  {.offset=offsetof(SE_DeviceInformation_t,swActTime), .min=1, .max=1, .type=ST_SIMPLE|XS_LONG, .n=1},
-  {.offset=offsetof(SE_DeviceInformation_t,swVer), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_STRING,32), .n=1},
+  {.offset=offsetof(SE_DeviceInformation_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=6, .width=3},
+  {.offset=offsetof(SE_DeviceInformation_t,pollRate), .min=0, .max=1, .attribute=1, .bit=18, .type=ST_SIMPLE|XS_UINT, .n=5, .width=3},
+  {.offset=offsetof(SE_DeviceInformation_t,DRLCCapabilities), .min=0, .max=1, .bit=0, .index=1646, .n=4, .width=3},
+  {.offset=offsetof(SE_DeviceInformation_t,functionsImplemented), .min=0, .max=1, .bit=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,8), .n=3, .width=2},
+  {.offset=offsetof(SE_DeviceInformation_t,gpsLocation), .min=0, .max=1, .bit=2, .index=1643, .n=2, .width=2},
+  {.offset=offsetof(SE_DeviceInformation_t,lFDI), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,20), .n=1, .width=1},
+  {.offset=offsetof(SE_DeviceInformation_t,mfDate), .min=1, .max=1, .type=ST_SIMPLE|XS_LONG, .n=1, .width=1},
+  {.offset=offsetof(SE_DeviceInformation_t,mfHwVer), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_STRING,32), .n=1, .width=1},
+  {.offset=offsetof(SE_DeviceInformation_t,mfID), .min=1, .max=1, .type=ST_SIMPLE|XS_UINT, .n=1, .width=1},
+  {.offset=offsetof(SE_DeviceInformation_t,mfInfo), .min=0, .max=1, .bit=3, .type=ST_SIMPLE|xs_type(XS_STRING,32), .n=2, .width=2},
+  {.offset=offsetof(SE_DeviceInformation_t,mfModel), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_STRING,32), .n=1, .width=1},
+  {.offset=offsetof(SE_DeviceInformation_t,mfSerNum), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_STRING,32), .n=1, .width=1},
+  {.offset=offsetof(SE_DeviceInformation_t,primaryPower), .min=1, .max=1, .type=ST_SIMPLE|XS_UBYTE, .n=1, .width=1},
+  {.offset=offsetof(SE_DeviceInformation_t,secondaryPower), .min=1, .max=1, .type=ST_SIMPLE|XS_UBYTE, .n=1, .width=1},
+  {.offset=offsetof(SE_DeviceInformation_t,SupportedLocaleListLink), .min=0, .max=1, .bit=4, .index=1640, .n=2, .width=2},
+  {.offset=offsetof(SE_DeviceInformation_t,swActTime), .min=1, .max=1, .type=ST_SIMPLE|XS_LONG, .n=1, .width=1},
+  {.offset=offsetof(SE_DeviceInformation_t,swVer), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_STRING,32), .n=1, .width=1},
   // Time (1668)
   {.size=sizeof(SE_Time_t), .index=328},
-  {.offset=offsetof(SE_Time_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=3},
-  {.offset=offsetof(SE_Time_t,pollRate), .min=0, .max=1, .attribute=1, .bit=18, .type=ST_SIMPLE|XS_UINT, .n=2},
-  {.offset=offsetof(SE_Time_t,currentTime), .min=1, .max=1, .type=ST_SIMPLE|XS_LONG, .n=1},
-  {.offset=offsetof(SE_Time_t,dstEndTime), .min=1, .max=1, .type=ST_SIMPLE|XS_LONG, .n=1},
-  {.offset=offsetof(SE_Time_t,dstOffset), .min=1, .max=1, .type=ST_SIMPLE|XS_INT, .n=1},
-  {.offset=offsetof(SE_Time_t,dstStartTime), .min=1, .max=1, .type=ST_SIMPLE|XS_LONG, .n=1},
-  {.offset=offsetof(SE_Time_t,localTime), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|XS_LONG, .n=2},
-  {.offset=offsetof(SE_Time_t,quality), .min=1, .max=1, .type=ST_SIMPLE|XS_UBYTE, .n=1},
-  {.offset=offsetof(SE_Time_t,tzOffset), .min=1, .max=1, .type=ST_SIMPLE|XS_INT, .n=1},
+  {.offset=offsetof(SE_Time_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=3, .width=2},
+  {.offset=offsetof(SE_Time_t,pollRate), .min=0, .max=1, .attribute=1, .bit=18, .type=ST_SIMPLE|XS_UINT, .n=2, .width=2},
+  {.offset=offsetof(SE_Time_t,currentTime), .min=1, .max=1, .type=ST_SIMPLE|XS_LONG, .n=1, .width=1},
+  {.offset=offsetof(SE_Time_t,dstEndTime), .min=1, .max=1, .type=ST_SIMPLE|XS_LONG, .n=1, .width=1},
+  {.offset=offsetof(SE_Time_t,dstOffset), .min=1, .max=1, .type=ST_SIMPLE|XS_INT, .n=1, .width=1},
+  {.offset=offsetof(SE_Time_t,dstStartTime), .min=1, .max=1, .type=ST_SIMPLE|XS_LONG, .n=1, .width=1},
+  {.offset=offsetof(SE_Time_t,localTime), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|XS_LONG, .n=2, .width=2},
+  {.offset=offsetof(SE_Time_t,quality), .min=1, .max=1, .type=ST_SIMPLE|XS_UBYTE, .n=1, .width=1},
+  {.offset=offsetof(SE_Time_t,tzOffset), .min=1, .max=1, .type=ST_SIMPLE|XS_INT, .n=1, .width=1},
   // Response (1678)
   {.size=sizeof(SE_Response_t), .index=328},
-  {.offset=offsetof(SE_Response_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=3},
-  {.offset=offsetof(SE_Response_t,createdDateTime), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|XS_LONG, .n=2},
-  {.offset=offsetof(SE_Response_t,endDeviceLFDI), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,20), .n=1},
-  {.offset=offsetof(SE_Response_t,status), .min=0, .max=1, .bit=1, .type=ST_SIMPLE|XS_UBYTE, .n=2},
-  {.offset=offsetof(SE_Response_t,subject), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,16), .n=1},
+  {.offset=offsetof(SE_Response_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=3, .width=2},
+  {.offset=offsetof(SE_Response_t,createdDateTime), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|XS_LONG, .n=2, .width=2},
+  {.offset=offsetof(SE_Response_t,endDeviceLFDI), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,20), .n=1, .width=1},
+  {.offset=offsetof(SE_Response_t,status), .min=0, .max=1, .bit=1, .type=ST_SIMPLE|XS_UBYTE, .n=2, .width=2},
+  {.offset=offsetof(SE_Response_t,subject), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,16), .n=1, .width=1},
   // TextResponse (1684)
   {.size=sizeof(SE_TextResponse_t), .index=1678},
-  {.offset=offsetof(SE_TextResponse_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=3},
-  {.offset=offsetof(SE_TextResponse_t,createdDateTime), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|XS_LONG, .n=2},
-  {.offset=offsetof(SE_TextResponse_t,endDeviceLFDI), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,20), .n=1},
-  {.offset=offsetof(SE_TextResponse_t,status), .min=0, .max=1, .bit=1, .type=ST_SIMPLE|XS_UBYTE, .n=2},
-  {.offset=offsetof(SE_TextResponse_t,subject), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,16), .n=1},
+  {.offset=offsetof(SE_TextResponse_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=3, .width=2},
+  {.offset=offsetof(SE_TextResponse_t,createdDateTime), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|XS_LONG, .n=2, .width=2},
+  {.offset=offsetof(SE_TextResponse_t,endDeviceLFDI), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,20), .n=1, .width=1},
+  {.offset=offsetof(SE_TextResponse_t,status), .min=0, .max=1, .bit=1, .type=ST_SIMPLE|XS_UBYTE, .n=2, .width=2},
+  {.offset=offsetof(SE_TextResponse_t,subject), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,16), .n=1, .width=1},
   // ResponseListLink (1690)
   {.size=sizeof(SE_ResponseListLink_t), .index=451},
-  {.offset=offsetof(SE_ResponseListLink_t,all), .min=0, .max=1, .attribute=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=2},
-  {.offset=offsetof(SE_ResponseListLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1},
+  {.offset=offsetof(SE_ResponseListLink_t,all), .min=0, .max=1, .attribute=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=2, .width=2},
+  {.offset=offsetof(SE_ResponseListLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1, .width=1},
   // ResponseSet (1693)
   {.size=sizeof(SE_ResponseSet_t), .index=368},
-  {.offset=offsetof(SE_ResponseSet_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2},
-  {.offset=offsetof(SE_ResponseSet_t,mRID), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,16), .n=1},
-  {.offset=offsetof(SE_ResponseSet_t,description), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|xs_type(XS_STRING,32), .n=4},
-  {.offset=offsetof(SE_ResponseSet_t,version), .min=0, .max=1, .bit=2, .type=ST_SIMPLE|XS_USHORT, .n=3},
-  {.offset=offsetof(SE_ResponseSet_t,ResponseListLink), .min=0, .max=1, .bit=3, .index=1690, .n=2},
+  {.offset=offsetof(SE_ResponseSet_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2, .width=2},
+  {.offset=offsetof(SE_ResponseSet_t,mRID), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,16), .n=1, .width=1},
+  {.offset=offsetof(SE_ResponseSet_t,description), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|xs_type(XS_STRING,32), .n=4, .width=3},
+  {.offset=offsetof(SE_ResponseSet_t,version), .min=0, .max=1, .bit=2, .type=ST_SIMPLE|XS_USHORT, .n=3, .width=2},
+  {.offset=offsetof(SE_ResponseSet_t,ResponseListLink), .min=0, .max=1, .bit=3, .index=1690, .n=2, .width=2},
   // ResponseSetList (1699)
   {.size=sizeof(SE_ResponseSetList_t), .index=420},
-  {.offset=offsetof(SE_ResponseSetList_t,all), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1},
-  {.offset=offsetof(SE_ResponseSetList_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=3},
-  {.offset=offsetof(SE_ResponseSetList_t,pollRate), .min=0, .max=1, .attribute=1, .bit=18, .type=ST_SIMPLE|XS_UINT, .n=2},
-  {.offset=offsetof(SE_ResponseSetList_t,results), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1},
-  {.offset=offsetof(SE_ResponseSetList_t,ResponseSet), .min=0, .unbounded=1, .index=1693, .n=2},
+  {.offset=offsetof(SE_ResponseSetList_t,all), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1, .width=1},
+  {.offset=offsetof(SE_ResponseSetList_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=3, .width=2},
+  {.offset=offsetof(SE_ResponseSetList_t,pollRate), .min=0, .max=1, .attribute=1, .bit=18, .type=ST_SIMPLE|XS_UINT, .n=2, .width=2},
+  {.offset=offsetof(SE_ResponseSetList_t,results), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1, .width=1},
+  {.offset=offsetof(SE_ResponseSetList_t,ResponseSet), .min=0, .unbounded=1, .index=1693, .n=2, .width=2},
   // ResponseList (1705)
   {.size=sizeof(SE_ResponseList_t), .index=420},
-  {.offset=offsetof(SE_ResponseList_t,all), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1},
-  {.offset=offsetof(SE_ResponseList_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2},
-  {.offset=offsetof(SE_ResponseList_t,results), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1},
-  {.offset=offsetof(SE_ResponseList_t,Response), .min=0, .unbounded=1, .index=1678, .n=2},
+  {.offset=offsetof(SE_ResponseList_t,all), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1, .width=1},
+  {.offset=offsetof(SE_ResponseList_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2, .width=2},
+  {.offset=offsetof(SE_ResponseList_t,results), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1, .width=1},
+  {.offset=offsetof(SE_ResponseList_t,Response), .min=0, .unbounded=1, .index=1678, .n=2, .width=2},
   // PriceResponse (1710)
   {.size=sizeof(SE_PriceResponse_t), .index=1678},
-  {.offset=offsetof(SE_PriceResponse_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=3},
-  {.offset=offsetof(SE_PriceResponse_t,createdDateTime), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|XS_LONG, .n=2},
-  {.offset=offsetof(SE_PriceResponse_t,endDeviceLFDI), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,20), .n=1},
-  {.offset=offsetof(SE_PriceResponse_t,status), .min=0, .max=1, .bit=1, .type=ST_SIMPLE|XS_UBYTE, .n=2},
-  {.offset=offsetof(SE_PriceResponse_t,subject), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,16), .n=1},
+  {.offset=offsetof(SE_PriceResponse_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=3, .width=2},
+  {.offset=offsetof(SE_PriceResponse_t,createdDateTime), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|XS_LONG, .n=2, .width=2},
+  {.offset=offsetof(SE_PriceResponse_t,endDeviceLFDI), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,20), .n=1, .width=1},
+  {.offset=offsetof(SE_PriceResponse_t,status), .min=0, .max=1, .bit=1, .type=ST_SIMPLE|XS_UBYTE, .n=2, .width=2},
+  {.offset=offsetof(SE_PriceResponse_t,subject), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,16), .n=1, .width=1},
   // AppliedTargetReduction (1716)
   {.size=sizeof(SE_AppliedTargetReduction_t), .index=0},
-  {.offset=offsetof(SE_AppliedTargetReduction_t,type), .min=1, .max=1, .type=ST_SIMPLE|XS_UBYTE, .n=1},
-  {.offset=offsetof(SE_AppliedTargetReduction_t,value), .min=1, .max=1, .type=ST_SIMPLE|XS_USHORT, .n=1},
+  {.offset=offsetof(SE_AppliedTargetReduction_t,type), .min=1, .max=1, .type=ST_SIMPLE|XS_UBYTE, .n=1, .width=1},
+  {.offset=offsetof(SE_AppliedTargetReduction_t,value), .min=1, .max=1, .type=ST_SIMPLE|XS_USHORT, .n=1, .width=1},
   // DrResponse (1719)
   {.size=sizeof(SE_DrResponse_t), .index=1678},
-  {.offset=offsetof(SE_DrResponse_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=3},
-  {.offset=offsetof(SE_DrResponse_t,createdDateTime), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|XS_LONG, .n=2},
-  {.offset=offsetof(SE_DrResponse_t,endDeviceLFDI), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,20), .n=1},
-  {.offset=offsetof(SE_DrResponse_t,status), .min=0, .max=1, .bit=1, .type=ST_SIMPLE|XS_UBYTE, .n=2},
-  {.offset=offsetof(SE_DrResponse_t,subject), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,16), .n=1},
-  {.offset=offsetof(SE_DrResponse_t,ApplianceLoadReduction), .min=0, .max=1, .bit=10, .index=1339, .n=7},
-  {.offset=offsetof(SE_DrResponse_t,AppliedTargetReduction), .min=0, .max=1, .bit=2, .index=1716, .n=6},
-  {.offset=offsetof(SE_DrResponse_t,DutyCycle), .min=0, .max=1, .bit=11, .index=1337, .n=5},
-  {.offset=offsetof(SE_DrResponse_t,Offset), .min=0, .max=1, .bit=12, .index=1333, .n=4},
-  {.offset=offsetof(SE_DrResponse_t,overrideDuration), .min=0, .max=1, .bit=13, .type=ST_SIMPLE|XS_USHORT, .n=3},
-  {.offset=offsetof(SE_DrResponse_t,SetPoint), .min=0, .max=1, .bit=14, .index=1330, .n=2},
+  {.offset=offsetof(SE_DrResponse_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=3, .width=2},
+  {.offset=offsetof(SE_DrResponse_t,createdDateTime), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|XS_LONG, .n=2, .width=2},
+  {.offset=offsetof(SE_DrResponse_t,endDeviceLFDI), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,20), .n=1, .width=1},
+  {.offset=offsetof(SE_DrResponse_t,status), .min=0, .max=1, .bit=1, .type=ST_SIMPLE|XS_UBYTE, .n=2, .width=2},
+  {.offset=offsetof(SE_DrResponse_t,subject), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,16), .n=1, .width=1},
+  {.offset=offsetof(SE_DrResponse_t,ApplianceLoadReduction), .min=0, .max=1, .bit=10, .index=1339, .n=7, .width=3},
+  {.offset=offsetof(SE_DrResponse_t,AppliedTargetReduction), .min=0, .max=1, .bit=2, .index=1716, .n=6, .width=3},
+  {.offset=offsetof(SE_DrResponse_t,DutyCycle), .min=0, .max=1, .bit=11, .index=1337, .n=5, .width=3},
+  {.offset=offsetof(SE_DrResponse_t,Offset), .min=0, .max=1, .bit=12, .index=1333, .n=4, .width=3},
+  {.offset=offsetof(SE_DrResponse_t,overrideDuration), .min=0, .max=1, .bit=13, .type=ST_SIMPLE|XS_USHORT, .n=3, .width=2},
+  {.offset=offsetof(SE_DrResponse_t,SetPoint), .min=0, .max=1, .bit=14, .index=1330, .n=2, .width=2},
   // FlowReservationResponseResponse (1731)
   {.size=sizeof(SE_FlowReservationResponseResponse_t), .index=1678},
-  {.offset=offsetof(SE_FlowReservationResponseResponse_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=3},
-  {.offset=offsetof(SE_FlowReservationResponseResponse_t,createdDateTime), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|XS_LONG, .n=2},
-  {.offset=offsetof(SE_FlowReservationResponseResponse_t,endDeviceLFDI), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,20), .n=1},
-  {.offset=offsetof(SE_FlowReservationResponseResponse_t,status), .min=0, .max=1, .bit=1, .type=ST_SIMPLE|XS_UBYTE, .n=2},
-  {.offset=offsetof(SE_FlowReservationResponseResponse_t,subject), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,16), .n=1},
+  {.offset=offsetof(SE_FlowReservationResponseResponse_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=3, .width=2},
+  {.offset=offsetof(SE_FlowReservationResponseResponse_t,createdDateTime), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|XS_LONG, .n=2, .width=2},
+  {.offset=offsetof(SE_FlowReservationResponseResponse_t,endDeviceLFDI), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,20), .n=1, .width=1},
+  {.offset=offsetof(SE_FlowReservationResponseResponse_t,status), .min=0, .max=1, .bit=1, .type=ST_SIMPLE|XS_UBYTE, .n=2, .width=2},
+  {.offset=offsetof(SE_FlowReservationResponseResponse_t,subject), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,16), .n=1, .width=1},
   // DERControlResponse (1737)
   {.size=sizeof(SE_DERControlResponse_t), .index=1678},
-  {.offset=offsetof(SE_DERControlResponse_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=3},
-  {.offset=offsetof(SE_DERControlResponse_t,createdDateTime), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|XS_LONG, .n=2},
-  {.offset=offsetof(SE_DERControlResponse_t,endDeviceLFDI), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,20), .n=1},
-  {.offset=offsetof(SE_DERControlResponse_t,status), .min=0, .max=1, .bit=1, .type=ST_SIMPLE|XS_UBYTE, .n=2},
-  {.offset=offsetof(SE_DERControlResponse_t,subject), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,16), .n=1},
+  {.offset=offsetof(SE_DERControlResponse_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=3, .width=2},
+  {.offset=offsetof(SE_DERControlResponse_t,createdDateTime), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|XS_LONG, .n=2, .width=2},
+  {.offset=offsetof(SE_DERControlResponse_t,endDeviceLFDI), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,20), .n=1, .width=1},
+  {.offset=offsetof(SE_DERControlResponse_t,status), .min=0, .max=1, .bit=1, .type=ST_SIMPLE|XS_UBYTE, .n=2, .width=2},
+  {.offset=offsetof(SE_DERControlResponse_t,subject), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,16), .n=1, .width=1},
   // SubscriptionBase (1743)
   {.size=sizeof(SE_SubscriptionBase_t), .index=328},
-  {.offset=offsetof(SE_SubscriptionBase_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2},
-  {.offset=offsetof(SE_SubscriptionBase_t,subscribedResource), .min=1, .max=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1},
+  {.offset=offsetof(SE_SubscriptionBase_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2, .width=2},
+  {.offset=offsetof(SE_SubscriptionBase_t,subscribedResource), .min=1, .max=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1, .width=1},
   // Notification (1746)
   {.size=sizeof(SE_Notification_t), .index=1743},
-  {.offset=offsetof(SE_Notification_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2},
-  {.offset=offsetof(SE_Notification_t,subscribedResource), .min=1, .max=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1},
-  {.offset=offsetof(SE_Notification_t,newResourceURI), .min=0, .max=1, .type=ST_SIMPLE|XS_ANY_URI, .n=3},
-  {.offset=offsetof(SE_Notification_t,Resource), .min=0, .max=1, .st=1, .bit=0, .index=328, .n=2},
-  {.offset=offsetof(SE_Notification_t,status), .min=1, .max=1, .type=ST_SIMPLE|XS_UBYTE, .n=1},
-  {.offset=offsetof(SE_Notification_t,subscriptionURI), .min=1, .max=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1},
+  {.offset=offsetof(SE_Notification_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2, .width=2},
+  {.offset=offsetof(SE_Notification_t,subscribedResource), .min=1, .max=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1, .width=1},
+  {.offset=offsetof(SE_Notification_t,newResourceURI), .min=0, .max=1, .type=ST_SIMPLE|XS_ANY_URI, .n=3, .width=2},
+  {.offset=offsetof(SE_Notification_t,Resource), .min=0, .max=1, .st=1, .bit=0, .index=328, .n=2, .width=2},
+  {.offset=offsetof(SE_Notification_t,status), .min=1, .max=1, .type=ST_SIMPLE|XS_UBYTE, .n=1, .width=1},
+  {.offset=offsetof(SE_Notification_t,subscriptionURI), .min=1, .max=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1, .width=1},
   // NotificationList (1753)
   {.size=sizeof(SE_NotificationList_t), .index=420},
-  {.offset=offsetof(SE_NotificationList_t,all), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1},
-  {.offset=offsetof(SE_NotificationList_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2},
-  {.offset=offsetof(SE_NotificationList_t,results), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1},
-  {.offset=offsetof(SE_NotificationList_t,Notification), .min=0, .unbounded=1, .index=1746, .n=2},
+  {.offset=offsetof(SE_NotificationList_t,all), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1, .width=1},
+  {.offset=offsetof(SE_NotificationList_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2, .width=2},
+  {.offset=offsetof(SE_NotificationList_t,results), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1, .width=1},
+  {.offset=offsetof(SE_NotificationList_t,Notification), .min=0, .unbounded=1, .index=1746, .n=2, .width=2},
   // Condition (1758)
   {.size=sizeof(SE_Condition_t), .index=0},
-  {.offset=offsetof(SE_Condition_t,attributeIdentifier), .min=1, .max=1, .type=ST_SIMPLE|XS_UBYTE, .n=1},
-  {.offset=offsetof(SE_Condition_t,lowerThreshold), .min=1, .max=1, .type=ST_SIMPLE|XS_LONG, .n=1},
-  {.offset=offsetof(SE_Condition_t,upperThreshold), .min=1, .max=1, .type=ST_SIMPLE|XS_LONG, .n=1},
+  {.offset=offsetof(SE_Condition_t,attributeIdentifier), .min=1, .max=1, .type=ST_SIMPLE|XS_UBYTE, .n=1, .width=1},
+  {.offset=offsetof(SE_Condition_t,lowerThreshold), .min=1, .max=1, .type=ST_SIMPLE|XS_LONG, .n=1, .width=1},
+  {.offset=offsetof(SE_Condition_t,upperThreshold), .min=1, .max=1, .type=ST_SIMPLE|XS_LONG, .n=1, .width=1},
   // Subscription (1762)
   {.size=sizeof(SE_Subscription_t), .index=1743},
-  {.offset=offsetof(SE_Subscription_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2},
-  {.offset=offsetof(SE_Subscription_t,subscribedResource), .min=1, .max=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1},
-  {.offset=offsetof(SE_Subscription_t,Condition), .min=0, .max=1, .bit=0, .index=1758, .n=2},
-  {.offset=offsetof(SE_Subscription_t,encoding), .min=1, .max=1, .type=ST_SIMPLE|XS_UBYTE, .n=1},
-  {.offset=offsetof(SE_Subscription_t,level), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_STRING,16), .n=1},
-  {.offset=offsetof(SE_Subscription_t,limit), .min=1, .max=1, .type=ST_SIMPLE|XS_UINT, .n=1},
-  {.offset=offsetof(SE_Subscription_t,notificationURI), .min=1, .max=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1},
+  {.offset=offsetof(SE_Subscription_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=2, .width=2},
+  {.offset=offsetof(SE_Subscription_t,subscribedResource), .min=1, .max=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1, .width=1},
+  {.offset=offsetof(SE_Subscription_t,Condition), .min=0, .max=1, .bit=0, .index=1758, .n=2, .width=2},
+  {.offset=offsetof(SE_Subscription_t,encoding), .min=1, .max=1, .type=ST_SIMPLE|XS_UBYTE, .n=1, .width=1},
+  {.offset=offsetof(SE_Subscription_t,level), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_STRING,16), .n=1, .width=1},
+  {.offset=offsetof(SE_Subscription_t,limit), .min=1, .max=1, .type=ST_SIMPLE|XS_UINT, .n=1, .width=1},
+  {.offset=offsetof(SE_Subscription_t,notificationURI), .min=1, .max=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1, .width=1},
   // SubscriptionList (1770)
   {.size=sizeof(SE_SubscriptionList_t), .index=420},
-  {.offset=offsetof(SE_SubscriptionList_t,all), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1},
-  {.offset=offsetof(SE_SubscriptionList_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=3},
-  {.offset=offsetof(SE_SubscriptionList_t,pollRate), .min=0, .max=1, .attribute=1, .bit=18, .type=ST_SIMPLE|XS_UINT, .n=2},
-  {.offset=offsetof(SE_SubscriptionList_t,results), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1},
-  {.offset=offsetof(SE_SubscriptionList_t,Subscription), .min=0, .unbounded=1, .index=1762, .n=2},
+  {.offset=offsetof(SE_SubscriptionList_t,all), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1, .width=1},
+  {.offset=offsetof(SE_SubscriptionList_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=3, .width=2},
+  {.offset=offsetof(SE_SubscriptionList_t,pollRate), .min=0, .max=1, .attribute=1, .bit=18, .type=ST_SIMPLE|XS_UINT, .n=2, .width=2},
+  {.offset=offsetof(SE_SubscriptionList_t,results), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1, .width=1},
+  {.offset=offsetof(SE_SubscriptionList_t,Subscription), .min=0, .unbounded=1, .index=1762, .n=2, .width=2},
   // UsagePointListLink (1776)
   {.size=sizeof(SE_UsagePointListLink_t), .index=451},
-  {.offset=offsetof(SE_UsagePointListLink_t,all), .min=0, .max=1, .attribute=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=2},
-  {.offset=offsetof(SE_UsagePointListLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1},
+  {.offset=offsetof(SE_UsagePointListLink_t,all), .min=0, .max=1, .attribute=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=2, .width=2},
+  {.offset=offsetof(SE_UsagePointListLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1, .width=1},
   // TimeLink (1779)
   {.size=sizeof(SE_TimeLink_t), .index=449},
-  {.offset=offsetof(SE_TimeLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1},
+  {.offset=offsetof(SE_TimeLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1, .width=1},
   // TariffProfileListLink (1781)
   {.size=sizeof(SE_TariffProfileListLink_t), .index=451},
-  {.offset=offsetof(SE_TariffProfileListLink_t,all), .min=0, .max=1, .attribute=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=2},
-  {.offset=offsetof(SE_TariffProfileListLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1},
+  {.offset=offsetof(SE_TariffProfileListLink_t,all), .min=0, .max=1, .attribute=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=2, .width=2},
+  {.offset=offsetof(SE_TariffProfileListLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1, .width=1},
   // ResponseSetListLink (1784)
   {.size=sizeof(SE_ResponseSetListLink_t), .index=451},
-  {.offset=offsetof(SE_ResponseSetListLink_t,all), .min=0, .max=1, .attribute=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=2},
-  {.offset=offsetof(SE_ResponseSetListLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1},
+  {.offset=offsetof(SE_ResponseSetListLink_t,all), .min=0, .max=1, .attribute=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=2, .width=2},
+  {.offset=offsetof(SE_ResponseSetListLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1, .width=1},
   // PrepaymentListLink (1787)
   {.size=sizeof(SE_PrepaymentListLink_t), .index=451},
-  {.offset=offsetof(SE_PrepaymentListLink_t,all), .min=0, .max=1, .attribute=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=2},
-  {.offset=offsetof(SE_PrepaymentListLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1},
+  {.offset=offsetof(SE_PrepaymentListLink_t,all), .min=0, .max=1, .attribute=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=2, .width=2},
+  {.offset=offsetof(SE_PrepaymentListLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1, .width=1},
   // MessagingProgramListLink (1790)
   {.size=sizeof(SE_MessagingProgramListLink_t), .index=451},
-  {.offset=offsetof(SE_MessagingProgramListLink_t,all), .min=0, .max=1, .attribute=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=2},
-  {.offset=offsetof(SE_MessagingProgramListLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1},
+  {.offset=offsetof(SE_MessagingProgramListLink_t,all), .min=0, .max=1, .attribute=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=2, .width=2},
+  {.offset=offsetof(SE_MessagingProgramListLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1, .width=1},
   // FileListLink (1793)
   {.size=sizeof(SE_FileListLink_t), .index=451},
-  {.offset=offsetof(SE_FileListLink_t,all), .min=0, .max=1, .attribute=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=2},
-  {.offset=offsetof(SE_FileListLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1},
+  {.offset=offsetof(SE_FileListLink_t,all), .min=0, .max=1, .attribute=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=2, .width=2},
+  {.offset=offsetof(SE_FileListLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1, .width=1},
   // DERProgramListLink (1796)
   {.size=sizeof(SE_DERProgramListLink_t), .index=451},
-  {.offset=offsetof(SE_DERProgramListLink_t,all), .min=0, .max=1, .attribute=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=2},
-  {.offset=offsetof(SE_DERProgramListLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1},
+  {.offset=offsetof(SE_DERProgramListLink_t,all), .min=0, .max=1, .attribute=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=2, .width=2},
+  {.offset=offsetof(SE_DERProgramListLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1, .width=1},
   // DemandResponseProgramListLink (1799)
   {.size=sizeof(SE_DemandResponseProgramListLink_t), .index=451},
-  {.offset=offsetof(SE_DemandResponseProgramListLink_t,all), .min=0, .max=1, .attribute=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=2},
-  {.offset=offsetof(SE_DemandResponseProgramListLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1},
+  {.offset=offsetof(SE_DemandResponseProgramListLink_t,all), .min=0, .max=1, .attribute=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=2, .width=2},
+  {.offset=offsetof(SE_DemandResponseProgramListLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1, .width=1},
   // CustomerAccountListLink (1802)
   {.size=sizeof(SE_CustomerAccountListLink_t), .index=451},
-  {.offset=offsetof(SE_CustomerAccountListLink_t,all), .min=0, .max=1, .attribute=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=2},
-  {.offset=offsetof(SE_CustomerAccountListLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1},
+  {.offset=offsetof(SE_CustomerAccountListLink_t,all), .min=0, .max=1, .attribute=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=2, .width=2},
+  {.offset=offsetof(SE_CustomerAccountListLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1, .width=1},
   // FunctionSetAssignmentsBase (1805)
   {.size=sizeof(SE_FunctionSetAssignmentsBase_t), .index=328},
-  {.offset=offsetof(SE_FunctionSetAssignmentsBase_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=12},
-  {.offset=offsetof(SE_FunctionSetAssignmentsBase_t,CustomerAccountListLink), .min=0, .max=1, .bit=6, .index=1802, .n=11},
-  {.offset=offsetof(SE_FunctionSetAssignmentsBase_t,DemandResponseProgramListLink), .min=0, .max=1, .bit=7, .index=1799, .n=10},
-  {.offset=offsetof(SE_FunctionSetAssignmentsBase_t,DERProgramListLink), .min=0, .max=1, .bit=8, .index=1796, .n=9},
-  {.offset=offsetof(SE_FunctionSetAssignmentsBase_t,FileListLink), .min=0, .max=1, .bit=9, .index=1793, .n=8},
-  {.offset=offsetof(SE_FunctionSetAssignmentsBase_t,MessagingProgramListLink), .min=0, .max=1, .bit=10, .index=1790, .n=7},
-  {.offset=offsetof(SE_FunctionSetAssignmentsBase_t,PrepaymentListLink), .min=0, .max=1, .bit=11, .index=1787, .n=6},
-  {.offset=offsetof(SE_FunctionSetAssignmentsBase_t,ResponseSetListLink), .min=0, .max=1, .bit=12, .index=1784, .n=5},
-  {.offset=offsetof(SE_FunctionSetAssignmentsBase_t,TariffProfileListLink), .min=0, .max=1, .bit=13, .index=1781, .n=4},
-  {.offset=offsetof(SE_FunctionSetAssignmentsBase_t,TimeLink), .min=0, .max=1, .bit=5, .index=1779, .n=3},
-  {.offset=offsetof(SE_FunctionSetAssignmentsBase_t,UsagePointListLink), .min=0, .max=1, .bit=14, .index=1776, .n=2},
+  {.offset=offsetof(SE_FunctionSetAssignmentsBase_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=12, .width=4},
+  {.offset=offsetof(SE_FunctionSetAssignmentsBase_t,CustomerAccountListLink), .min=0, .max=1, .bit=6, .index=1802, .n=11, .width=4},
+  {.offset=offsetof(SE_FunctionSetAssignmentsBase_t,DemandResponseProgramListLink), .min=0, .max=1, .bit=7, .index=1799, .n=10, .width=4},
+  {.offset=offsetof(SE_FunctionSetAssignmentsBase_t,DERProgramListLink), .min=0, .max=1, .bit=8, .index=1796, .n=9, .width=4},
+  {.offset=offsetof(SE_FunctionSetAssignmentsBase_t,FileListLink), .min=0, .max=1, .bit=9, .index=1793, .n=8, .width=4},
+  {.offset=offsetof(SE_FunctionSetAssignmentsBase_t,MessagingProgramListLink), .min=0, .max=1, .bit=10, .index=1790, .n=7, .width=3},
+  {.offset=offsetof(SE_FunctionSetAssignmentsBase_t,PrepaymentListLink), .min=0, .max=1, .bit=11, .index=1787, .n=6, .width=3},
+  {.offset=offsetof(SE_FunctionSetAssignmentsBase_t,ResponseSetListLink), .min=0, .max=1, .bit=12, .index=1784, .n=5, .width=3},
+  {.offset=offsetof(SE_FunctionSetAssignmentsBase_t,TariffProfileListLink), .min=0, .max=1, .bit=13, .index=1781, .n=4, .width=3},
+  {.offset=offsetof(SE_FunctionSetAssignmentsBase_t,TimeLink), .min=0, .max=1, .bit=5, .index=1779, .n=3, .width=2},
+  {.offset=offsetof(SE_FunctionSetAssignmentsBase_t,UsagePointListLink), .min=0, .max=1, .bit=14, .index=1776, .n=2, .width=2},
   // FunctionSetAssignments (1817)
   {.size=sizeof(SE_FunctionSetAssignments_t), .index=1805},
-  {.offset=offsetof(SE_FunctionSetAssignments_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=13},
-  {.offset=offsetof(SE_FunctionSetAssignments_t,subscribable), .min=0, .max=1, .attribute=1, .bit=1, .type=ST_SIMPLE|XS_UBYTE, .n=12},
-  {.offset=offsetof(SE_FunctionSetAssignments_t,CustomerAccountListLink), .min=0, .max=1, .bit=6, .index=1802, .n=11},
-  {.offset=offsetof(SE_FunctionSetAssignments_t,DemandResponseProgramListLink), .min=0, .max=1, .bit=7, .index=1799, .n=10},
-  {.offset=offsetof(SE_FunctionSetAssignments_t,DERProgramListLink), .min=0, .max=1, .bit=8, .index=1796, .n=9},
-  {.offset=offsetof(SE_FunctionSetAssignments_t,FileListLink), .min=0, .max=1, .bit=9, .index=1793, .n=8},
-  {.offset=offsetof(SE_FunctionSetAssignments_t,MessagingProgramListLink), .min=0, .max=1, .bit=10, .index=1790, .n=7},
-  {.offset=offsetof(SE_FunctionSetAssignments_t,PrepaymentListLink), .min=0, .max=1, .bit=11, .index=1787, .n=6},
-  {.offset=offsetof(SE_FunctionSetAssignments_t,ResponseSetListLink), .min=0, .max=1, .bit=12, .index=1784, .n=5},
-  {.offset=offsetof(SE_FunctionSetAssignments_t,TariffProfileListLink), .min=0, .max=1, .bit=13, .index=1781, .n=4},
-  {.offset=offsetof(SE_FunctionSetAssignments_t,TimeLink), .min=0, .max=1, .bit=5, .index=1779, .n=3},
-  {.offset=offsetof(SE_FunctionSetAssignments_t,UsagePointListLink), .min=0, .max=1, .bit=14, .index=1776, .n=2},
-  {.offset=offsetof(SE_FunctionSetAssignments_t,mRID), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,16), .n=1},
-  {.offset=offsetof(SE_FunctionSetAssignments_t,description), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|xs_type(XS_STRING,32), .n=3},
-  {.offset=offsetof(SE_FunctionSetAssignments_t,version), .min=0, .max=1, .bit=2, .type=ST_SIMPLE|XS_USHORT, .n=2},
+  {.offset=offsetof(SE_FunctionSetAssignments_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=13, .width=4},
+  {.offset=offsetof(SE_FunctionSetAssignments_t,subscribable), .min=0, .max=1, .attribute=1, .bit=1, .type=ST_SIMPLE|XS_UBYTE, .n=12, .width=4},
+  {.offset=offsetof(SE_FunctionSetAssignments_t,CustomerAccountListLink), .min=0, .max=1, .bit=6, .index=1802, .n=11, .width=4},
+  {.offset=offsetof(SE_FunctionSetAssignments_t,DemandResponseProgramListLink), .min=0, .max=1, .bit=7, .index=1799, .n=10, .width=4},
+  {.offset=offsetof(SE_FunctionSetAssignments_t,DERProgramListLink), .min=0, .max=1, .bit=8, .index=1796, .n=9, .width=4},
+  {.offset=offsetof(SE_FunctionSetAssignments_t,FileListLink), .min=0, .max=1, .bit=9, .index=1793, .n=8, .width=4},
+  {.offset=offsetof(SE_FunctionSetAssignments_t,MessagingProgramListLink), .min=0, .max=1, .bit=10, .index=1790, .n=7, .width=3},
+  {.offset=offsetof(SE_FunctionSetAssignments_t,PrepaymentListLink), .min=0, .max=1, .bit=11, .index=1787, .n=6, .width=3},
+  {.offset=offsetof(SE_FunctionSetAssignments_t,ResponseSetListLink), .min=0, .max=1, .bit=12, .index=1784, .n=5, .width=3},
+  {.offset=offsetof(SE_FunctionSetAssignments_t,TariffProfileListLink), .min=0, .max=1, .bit=13, .index=1781, .n=4, .width=3},
+  {.offset=offsetof(SE_FunctionSetAssignments_t,TimeLink), .min=0, .max=1, .bit=5, .index=1779, .n=3, .width=2},
+  {.offset=offsetof(SE_FunctionSetAssignments_t,UsagePointListLink), .min=0, .max=1, .bit=14, .index=1776, .n=2, .width=2},
+  {.offset=offsetof(SE_FunctionSetAssignments_t,mRID), .min=1, .max=1, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,16), .n=1, .width=1},
+  {.offset=offsetof(SE_FunctionSetAssignments_t,description), .min=0, .max=1, .bit=0, .type=ST_SIMPLE|xs_type(XS_STRING,32), .n=3, .width=2},
+  {.offset=offsetof(SE_FunctionSetAssignments_t,version), .min=0, .max=1, .bit=2, .type=ST_SIMPLE|XS_USHORT, .n=2, .width=2},
   // FunctionSetAssignmentsList (1833)
   {.size=sizeof(SE_FunctionSetAssignmentsList_t), .index=543},
-  {.offset=offsetof(SE_FunctionSetAssignmentsList_t,all), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1},
-  {.offset=offsetof(SE_FunctionSetAssignmentsList_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=3},
-  {.offset=offsetof(SE_FunctionSetAssignmentsList_t,pollRate), .min=0, .max=1, .attribute=1, .bit=18, .type=ST_SIMPLE|XS_UINT, .n=2},
-  {.offset=offsetof(SE_FunctionSetAssignmentsList_t,results), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1},
-  {.offset=offsetof(SE_FunctionSetAssignmentsList_t,subscribable), .min=0, .max=1, .attribute=1, .bit=1, .type=ST_SIMPLE|XS_UBYTE, .n=3},
-  {.offset=offsetof(SE_FunctionSetAssignmentsList_t,FunctionSetAssignments), .min=0, .unbounded=1, .index=1817, .n=2},
+  {.offset=offsetof(SE_FunctionSetAssignmentsList_t,all), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1, .width=1},
+  {.offset=offsetof(SE_FunctionSetAssignmentsList_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=3, .width=2},
+  {.offset=offsetof(SE_FunctionSetAssignmentsList_t,pollRate), .min=0, .max=1, .attribute=1, .bit=18, .type=ST_SIMPLE|XS_UINT, .n=2, .width=2},
+  {.offset=offsetof(SE_FunctionSetAssignmentsList_t,results), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1, .width=1},
+  {.offset=offsetof(SE_FunctionSetAssignmentsList_t,subscribable), .min=0, .max=1, .attribute=1, .bit=1, .type=ST_SIMPLE|XS_UBYTE, .n=3, .width=2},
+  {.offset=offsetof(SE_FunctionSetAssignmentsList_t,FunctionSetAssignments), .min=0, .unbounded=1, .index=1817, .n=2, .width=2},
   // PowerStatusLink (1840)
   {.size=sizeof(SE_PowerStatusLink_t), .index=449},
-  {.offset=offsetof(SE_PowerStatusLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1},
+  {.offset=offsetof(SE_PowerStatusLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1, .width=1},
   // LogEventListLink (1842)
   {.size=sizeof(SE_LogEventListLink_t), .index=451},
-  {.offset=offsetof(SE_LogEventListLink_t,all), .min=0, .max=1, .attribute=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=2},
-  {.offset=offsetof(SE_LogEventListLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1},
+  {.offset=offsetof(SE_LogEventListLink_t,all), .min=0, .max=1, .attribute=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=2, .width=2},
+  {.offset=offsetof(SE_LogEventListLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1, .width=1},
   // LoadShedAvailabilityListLink (1845)
   {.size=sizeof(SE_LoadShedAvailabilityListLink_t), .index=451},
-  {.offset=offsetof(SE_LoadShedAvailabilityListLink_t,all), .min=0, .max=1, .attribute=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=2},
-  {.offset=offsetof(SE_LoadShedAvailabilityListLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1},
+  {.offset=offsetof(SE_LoadShedAvailabilityListLink_t,all), .min=0, .max=1, .attribute=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=2, .width=2},
+  {.offset=offsetof(SE_LoadShedAvailabilityListLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1, .width=1},
   // IPInterfaceListLink (1848)
   {.size=sizeof(SE_IPInterfaceListLink_t), .index=451},
-  {.offset=offsetof(SE_IPInterfaceListLink_t,all), .min=0, .max=1, .attribute=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=2},
-  {.offset=offsetof(SE_IPInterfaceListLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1},
+  {.offset=offsetof(SE_IPInterfaceListLink_t,all), .min=0, .max=1, .attribute=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=2, .width=2},
+  {.offset=offsetof(SE_IPInterfaceListLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1, .width=1},
   // FileStatusLink (1851)
   {.size=sizeof(SE_FileStatusLink_t), .index=449},
-  {.offset=offsetof(SE_FileStatusLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1},
+  {.offset=offsetof(SE_FileStatusLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1, .width=1},
   // DeviceStatusLink (1853)
   {.size=sizeof(SE_DeviceStatusLink_t), .index=449},
-  {.offset=offsetof(SE_DeviceStatusLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1},
+  {.offset=offsetof(SE_DeviceStatusLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1, .width=1},
   // DeviceInformationLink (1855)
   {.size=sizeof(SE_DeviceInformationLink_t), .index=449},
-  {.offset=offsetof(SE_DeviceInformationLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1},
+  {.offset=offsetof(SE_DeviceInformationLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1, .width=1},
   // DERListLink (1857)
   {.size=sizeof(SE_DERListLink_t), .index=451},
-  {.offset=offsetof(SE_DERListLink_t,all), .min=0, .max=1, .attribute=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=2},
-  {.offset=offsetof(SE_DERListLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1},
+  {.offset=offsetof(SE_DERListLink_t,all), .min=0, .max=1, .attribute=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=2, .width=2},
+  {.offset=offsetof(SE_DERListLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1, .width=1},
   // ConfigurationLink (1860)
   {.size=sizeof(SE_ConfigurationLink_t), .index=449},
-  {.offset=offsetof(SE_ConfigurationLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1},
+  {.offset=offsetof(SE_ConfigurationLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1, .width=1},
   // AbstractDevice (1862)
   {.size=sizeof(SE_AbstractDevice_t), .index=499},
-  {.offset=offsetof(SE_AbstractDevice_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=14},
-  {.offset=offsetof(SE_AbstractDevice_t,subscribable), .min=0, .max=1, .attribute=1, .bit=1, .type=ST_SIMPLE|XS_UBYTE, .n=13},
-  {.offset=offsetof(SE_AbstractDevice_t,ConfigurationLink), .min=0, .max=1, .bit=5, .index=1860, .n=12},
-  {.offset=offsetof(SE_AbstractDevice_t,DERListLink), .min=0, .max=1, .bit=6, .index=1857, .n=11},
-  {.offset=offsetof(SE_AbstractDevice_t,deviceCategory), .min=0, .max=1, .bit=3, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,4), .n=10},
-  {.offset=offsetof(SE_AbstractDevice_t,DeviceInformationLink), .min=0, .max=1, .bit=7, .index=1855, .n=9},
-  {.offset=offsetof(SE_AbstractDevice_t,DeviceStatusLink), .min=0, .max=1, .bit=8, .index=1853, .n=8},
-  {.offset=offsetof(SE_AbstractDevice_t,FileStatusLink), .min=0, .max=1, .bit=9, .index=1851, .n=7},
-  {.offset=offsetof(SE_AbstractDevice_t,IPInterfaceListLink), .min=0, .max=1, .bit=10, .index=1848, .n=6},
-  {.offset=offsetof(SE_AbstractDevice_t,lFDI), .min=0, .max=1, .bit=4, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,20), .n=5},
-  {.offset=offsetof(SE_AbstractDevice_t,LoadShedAvailabilityListLink), .min=0, .max=1, .bit=11, .index=1845, .n=4},
-  {.offset=offsetof(SE_AbstractDevice_t,LogEventListLink), .min=0, .max=1, .bit=12, .index=1842, .n=3},
-  {.offset=offsetof(SE_AbstractDevice_t,PowerStatusLink), .min=0, .max=1, .bit=13, .index=1840, .n=2},
-  {.offset=offsetof(SE_AbstractDevice_t,sFDI), .min=1, .max=1, .type=ST_SIMPLE|XS_ULONG, .n=1},
+  {.offset=offsetof(SE_AbstractDevice_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=14, .width=4},
+  {.offset=offsetof(SE_AbstractDevice_t,subscribable), .min=0, .max=1, .attribute=1, .bit=1, .type=ST_SIMPLE|XS_UBYTE, .n=13, .width=4},
+  {.offset=offsetof(SE_AbstractDevice_t,ConfigurationLink), .min=0, .max=1, .bit=5, .index=1860, .n=12, .width=4},
+  {.offset=offsetof(SE_AbstractDevice_t,DERListLink), .min=0, .max=1, .bit=6, .index=1857, .n=11, .width=4},
+  {.offset=offsetof(SE_AbstractDevice_t,deviceCategory), .min=0, .max=1, .bit=3, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,4), .n=10, .width=4},
+  {.offset=offsetof(SE_AbstractDevice_t,DeviceInformationLink), .min=0, .max=1, .bit=7, .index=1855, .n=9, .width=4},
+  {.offset=offsetof(SE_AbstractDevice_t,DeviceStatusLink), .min=0, .max=1, .bit=8, .index=1853, .n=8, .width=4},
+  {.offset=offsetof(SE_AbstractDevice_t,FileStatusLink), .min=0, .max=1, .bit=9, .index=1851, .n=7, .width=3},
+  {.offset=offsetof(SE_AbstractDevice_t,IPInterfaceListLink), .min=0, .max=1, .bit=10, .index=1848, .n=6, .width=3},
+  {.offset=offsetof(SE_AbstractDevice_t,lFDI), .min=0, .max=1, .bit=4, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,20), .n=5, .width=3},
+  {.offset=offsetof(SE_AbstractDevice_t,LoadShedAvailabilityListLink), .min=0, .max=1, .bit=11, .index=1845, .n=4, .width=3},
+  {.offset=offsetof(SE_AbstractDevice_t,LogEventListLink), .min=0, .max=1, .bit=12, .index=1842, .n=3, .width=2},
+  {.offset=offsetof(SE_AbstractDevice_t,PowerStatusLink), .min=0, .max=1, .bit=13, .index=1840, .n=2, .width=2},
+  {.offset=offsetof(SE_AbstractDevice_t,sFDI), .min=1, .max=1, .type=ST_SIMPLE|XS_ULONG, .n=1, .width=1},
   // SelfDevice (1877)
   {.size=sizeof(SE_SelfDevice_t), .index=1862},
-  {.offset=offsetof(SE_SelfDevice_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=15},
-  {.offset=offsetof(SE_SelfDevice_t,pollRate), .min=0, .max=1, .attribute=1, .bit=18, .type=ST_SIMPLE|XS_UINT, .n=14},
-  {.offset=offsetof(SE_SelfDevice_t,subscribable), .min=0, .max=1, .attribute=1, .bit=1, .type=ST_SIMPLE|XS_UBYTE, .n=13},
-  {.offset=offsetof(SE_SelfDevice_t,ConfigurationLink), .min=0, .max=1, .bit=5, .index=1860, .n=12},
-  {.offset=offsetof(SE_SelfDevice_t,DERListLink), .min=0, .max=1, .bit=6, .index=1857, .n=11},
-  {.offset=offsetof(SE_SelfDevice_t,deviceCategory), .min=0, .max=1, .bit=3, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,4), .n=10},
-  {.offset=offsetof(SE_SelfDevice_t,DeviceInformationLink), .min=0, .max=1, .bit=7, .index=1855, .n=9},
-  {.offset=offsetof(SE_SelfDevice_t,DeviceStatusLink), .min=0, .max=1, .bit=8, .index=1853, .n=8},
-  {.offset=offsetof(SE_SelfDevice_t,FileStatusLink), .min=0, .max=1, .bit=9, .index=1851, .n=7},
-  {.offset=offsetof(SE_SelfDevice_t,IPInterfaceListLink), .min=0, .max=1, .bit=10, .index=1848, .n=6},
-  {.offset=offsetof(SE_SelfDevice_t,lFDI), .min=0, .max=1, .bit=4, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,20), .n=5},
-  {.offset=offsetof(SE_SelfDevice_t,LoadShedAvailabilityListLink), .min=0, .max=1, .bit=11, .index=1845, .n=4},
-  {.offset=offsetof(SE_SelfDevice_t,LogEventListLink), .min=0, .max=1, .bit=12, .index=1842, .n=3},
-  {.offset=offsetof(SE_SelfDevice_t,PowerStatusLink), .min=0, .max=1, .bit=13, .index=1840, .n=2},
-  {.offset=offsetof(SE_SelfDevice_t,sFDI), .min=1, .max=1, .type=ST_SIMPLE|XS_ULONG, .n=1},
+  {.offset=offsetof(SE_SelfDevice_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=15, .width=4},
+  {.offset=offsetof(SE_SelfDevice_t,pollRate), .min=0, .max=1, .attribute=1, .bit=18, .type=ST_SIMPLE|XS_UINT, .n=14, .width=4},
+  {.offset=offsetof(SE_SelfDevice_t,subscribable), .min=0, .max=1, .attribute=1, .bit=1, .type=ST_SIMPLE|XS_UBYTE, .n=13, .width=4},
+  {.offset=offsetof(SE_SelfDevice_t,ConfigurationLink), .min=0, .max=1, .bit=5, .index=1860, .n=12, .width=4},
+  {.offset=offsetof(SE_SelfDevice_t,DERListLink), .min=0, .max=1, .bit=6, .index=1857, .n=11, .width=4},
+  {.offset=offsetof(SE_SelfDevice_t,deviceCategory), .min=0, .max=1, .bit=3, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,4), .n=10, .width=4},
+  {.offset=offsetof(SE_SelfDevice_t,DeviceInformationLink), .min=0, .max=1, .bit=7, .index=1855, .n=9, .width=4},
+  {.offset=offsetof(SE_SelfDevice_t,DeviceStatusLink), .min=0, .max=1, .bit=8, .index=1853, .n=8, .width=4},
+  {.offset=offsetof(SE_SelfDevice_t,FileStatusLink), .min=0, .max=1, .bit=9, .index=1851, .n=7, .width=3},
+  {.offset=offsetof(SE_SelfDevice_t,IPInterfaceListLink), .min=0, .max=1, .bit=10, .index=1848, .n=6, .width=3},
+  {.offset=offsetof(SE_SelfDevice_t,lFDI), .min=0, .max=1, .bit=4, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,20), .n=5, .width=3},
+  {.offset=offsetof(SE_SelfDevice_t,LoadShedAvailabilityListLink), .min=0, .max=1, .bit=11, .index=1845, .n=4, .width=3},
+  {.offset=offsetof(SE_SelfDevice_t,LogEventListLink), .min=0, .max=1, .bit=12, .index=1842, .n=3, .width=2},
+  {.offset=offsetof(SE_SelfDevice_t,PowerStatusLink), .min=0, .max=1, .bit=13, .index=1840, .n=2, .width=2},
+  {.offset=offsetof(SE_SelfDevice_t,sFDI), .min=1, .max=1, .type=ST_SIMPLE|XS_ULONG, .n=1, .width=1},
   // Registration (1893)
   {.size=sizeof(SE_Registration_t), .index=328},
-  {.offset=offsetof(SE_Registration_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=3},
-  {.offset=offsetof(SE_Registration_t,pollRate), .min=0, .max=1, .attribute=1, .bit=18, .type=ST_SIMPLE|XS_UINT, .n=2},
-  {.offset=offsetof(SE_Registration_t,dateTimeRegistered), .min=1, .max=1, .type=ST_SIMPLE|XS_LONG, .n=1},
-  {.offset=offsetof(SE_Registration_t,pIN), .min=1, .max=1, .type=ST_SIMPLE|XS_UINT, .n=1},
+  {.offset=offsetof(SE_Registration_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=3, .width=2},
+  {.offset=offsetof(SE_Registration_t,pollRate), .min=0, .max=1, .attribute=1, .bit=18, .type=ST_SIMPLE|XS_UINT, .n=2, .width=2},
+  {.offset=offsetof(SE_Registration_t,dateTimeRegistered), .min=1, .max=1, .type=ST_SIMPLE|XS_LONG, .n=1, .width=1},
+  {.offset=offsetof(SE_Registration_t,pIN), .min=1, .max=1, .type=ST_SIMPLE|XS_UINT, .n=1, .width=1},
   // SubscriptionListLink (1898)
   {.size=sizeof(SE_SubscriptionListLink_t), .index=451},
-  {.offset=offsetof(SE_SubscriptionListLink_t,all), .min=0, .max=1, .attribute=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=2},
-  {.offset=offsetof(SE_SubscriptionListLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1},
+  {.offset=offsetof(SE_SubscriptionListLink_t,all), .min=0, .max=1, .attribute=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=2, .width=2},
+  {.offset=offsetof(SE_SubscriptionListLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1, .width=1},
   // RegistrationLink (1901)
   {.size=sizeof(SE_RegistrationLink_t), .index=449},
-  {.offset=offsetof(SE_RegistrationLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1},
+  {.offset=offsetof(SE_RegistrationLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1, .width=1},
   // FunctionSetAssignmentsListLink (1903)
   {.size=sizeof(SE_FunctionSetAssignmentsListLink_t), .index=451},
-  {.offset=offsetof(SE_FunctionSetAssignmentsListLink_t,all), .min=0, .max=1, .attribute=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=2},
-  {.offset=offsetof(SE_FunctionSetAssignmentsListLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1},
+  {.offset=offsetof(SE_FunctionSetAssignmentsListLink_t,all), .min=0, .max=1, .attribute=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=2, .width=2},
+  {.offset=offsetof(SE_FunctionSetAssignmentsListLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1, .width=1},
   // FlowReservationResponseListLink (1906)
   {.size=sizeof(SE_FlowReservationResponseListLink_t), .index=451},
-  {.offset=offsetof(SE_FlowReservationResponseListLink_t,all), .min=0, .max=1, .attribute=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=2},
-  {.offset=offsetof(SE_FlowReservationResponseListLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1},
+  {.offset=offsetof(SE_FlowReservationResponseListLink_t,all), .min=0, .max=1, .attribute=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=2, .width=2},
+  {.offset=offsetof(SE_FlowReservationResponseListLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1, .width=1},
   // FlowReservationRequestListLink (1909)
   {.size=sizeof(SE_FlowReservationRequestListLink_t), .index=451},
-  {.offset=offsetof(SE_FlowReservationRequestListLink_t,all), .min=0, .max=1, .attribute=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=2},
-  {.offset=offsetof(SE_FlowReservationRequestListLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1},
+  {.offset=offsetof(SE_FlowReservationRequestListLink_t,all), .min=0, .max=1, .attribute=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=2, .width=2},
+  {.offset=offsetof(SE_FlowReservationRequestListLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1, .width=1},
   // EndDevice (1912)
   {.size=sizeof(SE_EndDevice_t), .index=1862},
-  {.offset=offsetof(SE_EndDevice_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=14},
-  {.offset=offsetof(SE_EndDevice_t,subscribable), .min=0, .max=1, .attribute=1, .bit=1, .type=ST_SIMPLE|XS_UBYTE, .n=13},
-  {.offset=offsetof(SE_EndDevice_t,ConfigurationLink), .min=0, .max=1, .bit=5, .index=1860, .n=12},
-  {.offset=offsetof(SE_EndDevice_t,DERListLink), .min=0, .max=1, .bit=6, .index=1857, .n=11},
-  {.offset=offsetof(SE_EndDevice_t,deviceCategory), .min=0, .max=1, .bit=3, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,4), .n=10},
-  {.offset=offsetof(SE_EndDevice_t,DeviceInformationLink), .min=0, .max=1, .bit=7, .index=1855, .n=9},
-  {.offset=offsetof(SE_EndDevice_t,DeviceStatusLink), .min=0, .max=1, .bit=8, .index=1853, .n=8},
-  {.offset=offsetof(SE_EndDevice_t,FileStatusLink), .min=0, .max=1, .bit=9, .index=1851, .n=7},
-  {.offset=offsetof(SE_EndDevice_t,IPInterfaceListLink), .min=0, .max=1, .bit=10, .index=1848, .n=6},
-  {.offset=offsetof(SE_EndDevice_t,lFDI), .min=0, .max=1, .bit=4, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,20), .n=5},
-  {.offset=offsetof(SE_EndDevice_t,LoadShedAvailabilityListLink), .min=0, .max=1, .bit=11, .index=1845, .n=4},
-  {.offset=offsetof(SE_EndDevice_t,LogEventListLink), .min=0, .max=1, .bit=12, .index=1842, .n=3},
-  {.offset=offsetof(SE_EndDevice_t,PowerStatusLink), .min=0, .max=1, .bit=13, .index=1840, .n=2},
-  {.offset=offsetof(SE_EndDevice_t,sFDI), .min=1, .max=1, .type=ST_SIMPLE|XS_ULONG, .n=1},
-  {.offset=offsetof(SE_EndDevice_t,changedTime), .min=1, .max=1, .type=ST_SIMPLE|XS_LONG, .n=1},
-  {.min=0, .max=1, .bit=14, .type=ST_SIMPLE|XS_BOOLEAN, .n=8},
-  {.offset=offsetof(SE_EndDevice_t,FlowReservationRequestListLink), .min=0, .max=1, .bit=16, .index=1909, .n=7},
-  {.offset=offsetof(SE_EndDevice_t,FlowReservationResponseListLink), .min=0, .max=1, .bit=17, .index=1906, .n=6},
-  {.offset=offsetof(SE_EndDevice_t,FunctionSetAssignmentsListLink), .min=0, .max=1, .bit=18, .index=1903, .n=5},
-  {.offset=offsetof(SE_EndDevice_t,postRate), .min=0, .max=1, .bit=21, .type=ST_SIMPLE|XS_UINT, .n=4},
-  {.offset=offsetof(SE_EndDevice_t,RegistrationLink), .min=0, .max=1, .bit=19, .index=1901, .n=3},
-  {.offset=offsetof(SE_EndDevice_t,SubscriptionListLink), .min=0, .max=1, .bit=20, .index=1898, .n=2},
+  {.offset=offsetof(SE_EndDevice_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=14, .width=4},
+  {.offset=offsetof(SE_EndDevice_t,subscribable), .min=0, .max=1, .attribute=1, .bit=1, .type=ST_SIMPLE|XS_UBYTE, .n=13, .width=4},
+  {.offset=offsetof(SE_EndDevice_t,ConfigurationLink), .min=0, .max=1, .bit=5, .index=1860, .n=12, .width=4},
+  {.offset=offsetof(SE_EndDevice_t,DERListLink), .min=0, .max=1, .bit=6, .index=1857, .n=11, .width=4},
+  {.offset=offsetof(SE_EndDevice_t,deviceCategory), .min=0, .max=1, .bit=3, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,4), .n=10, .width=4},
+  {.offset=offsetof(SE_EndDevice_t,DeviceInformationLink), .min=0, .max=1, .bit=7, .index=1855, .n=9, .width=4},
+  {.offset=offsetof(SE_EndDevice_t,DeviceStatusLink), .min=0, .max=1, .bit=8, .index=1853, .n=8, .width=4},
+  {.offset=offsetof(SE_EndDevice_t,FileStatusLink), .min=0, .max=1, .bit=9, .index=1851, .n=7, .width=3},
+  {.offset=offsetof(SE_EndDevice_t,IPInterfaceListLink), .min=0, .max=1, .bit=10, .index=1848, .n=6, .width=3},
+  {.offset=offsetof(SE_EndDevice_t,lFDI), .min=0, .max=1, .bit=4, .type=ST_SIMPLE|xs_type(XS_HEX_BINARY,20), .n=5, .width=3},
+  {.offset=offsetof(SE_EndDevice_t,LoadShedAvailabilityListLink), .min=0, .max=1, .bit=11, .index=1845, .n=4, .width=3},
+  {.offset=offsetof(SE_EndDevice_t,LogEventListLink), .min=0, .max=1, .bit=12, .index=1842, .n=3, .width=2},
+  {.offset=offsetof(SE_EndDevice_t,PowerStatusLink), .min=0, .max=1, .bit=13, .index=1840, .n=2, .width=2},
+  {.offset=offsetof(SE_EndDevice_t,sFDI), .min=1, .max=1, .type=ST_SIMPLE|XS_ULONG, .n=1, .width=1},
+  {.offset=offsetof(SE_EndDevice_t,changedTime), .min=1, .max=1, .type=ST_SIMPLE|XS_LONG, .n=1, .width=1},
+  {.min=0, .max=1, .bit=14, .type=ST_SIMPLE|XS_BOOLEAN, .n=8, .width=4},
+  {.offset=offsetof(SE_EndDevice_t,FlowReservationRequestListLink), .min=0, .max=1, .bit=16, .index=1909, .n=7, .width=3},
+  {.offset=offsetof(SE_EndDevice_t,FlowReservationResponseListLink), .min=0, .max=1, .bit=17, .index=1906, .n=6, .width=3},
+  {.offset=offsetof(SE_EndDevice_t,FunctionSetAssignmentsListLink), .min=0, .max=1, .bit=18, .index=1903, .n=5, .width=3},
+  {.offset=offsetof(SE_EndDevice_t,postRate), .min=0, .max=1, .bit=21, .type=ST_SIMPLE|XS_UINT, .n=4, .width=3},
+  {.offset=offsetof(SE_EndDevice_t,RegistrationLink), .min=0, .max=1, .bit=19, .index=1901, .n=3, .width=2},
+  {.offset=offsetof(SE_EndDevice_t,SubscriptionListLink), .min=0, .max=1, .bit=20, .index=1898, .n=2, .width=2},
   // EndDeviceList (1935)
   {.size=sizeof(SE_EndDeviceList_t), .index=543},
-  {.offset=offsetof(SE_EndDeviceList_t,all), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1},
-  {.offset=offsetof(SE_EndDeviceList_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=3},
-  {.offset=offsetof(SE_EndDeviceList_t,pollRate), .min=0, .max=1, .attribute=1, .bit=18, .type=ST_SIMPLE|XS_UINT, .n=2},
-  {.offset=offsetof(SE_EndDeviceList_t,results), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1},
-  {.offset=offsetof(SE_EndDeviceList_t,subscribable), .min=0, .max=1, .attribute=1, .bit=1, .type=ST_SIMPLE|XS_UBYTE, .n=3},
-  {.offset=offsetof(SE_EndDeviceList_t,EndDevice), .min=0, .unbounded=1, .index=1912, .n=2},
+  {.offset=offsetof(SE_EndDeviceList_t,all), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1, .width=1},
+  {.offset=offsetof(SE_EndDeviceList_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=3, .width=2},
+  {.offset=offsetof(SE_EndDeviceList_t,pollRate), .min=0, .max=1, .attribute=1, .bit=18, .type=ST_SIMPLE|XS_UINT, .n=2, .width=2},
+  {.offset=offsetof(SE_EndDeviceList_t,results), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_UINT, .n=1, .width=1},
+  {.offset=offsetof(SE_EndDeviceList_t,subscribable), .min=0, .max=1, .attribute=1, .bit=1, .type=ST_SIMPLE|XS_UBYTE, .n=3, .width=2},
+  {.offset=offsetof(SE_EndDeviceList_t,EndDevice), .min=0, .unbounded=1, .index=1912, .n=2, .width=2},
   // Temperature (1942)
   {.size=sizeof(SE_Temperature_t), .index=0},
-  {.offset=offsetof(SE_Temperature_t,multiplier), .min=1, .max=1, .type=ST_SIMPLE|XS_BYTE, .n=1},
-  {.offset=offsetof(SE_Temperature_t,subject), .min=1, .max=1, .type=ST_SIMPLE|XS_UBYTE, .n=1},
-  {.offset=offsetof(SE_Temperature_t,value), .min=1, .max=1, .type=ST_SIMPLE|XS_SHORT, .n=1},
+  {.offset=offsetof(SE_Temperature_t,multiplier), .min=1, .max=1, .type=ST_SIMPLE|XS_BYTE, .n=1, .width=1},
+  {.offset=offsetof(SE_Temperature_t,subject), .min=1, .max=1, .type=ST_SIMPLE|XS_UBYTE, .n=1, .width=1},
+  {.offset=offsetof(SE_Temperature_t,value), .min=1, .max=1, .type=ST_SIMPLE|XS_SHORT, .n=1, .width=1},
   // DeviceStatus (1946)
   {.size=sizeof(SE_DeviceStatus_t), .index=328},
-  {.offset=offsetof(SE_DeviceStatus_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=3},
-  {.offset=offsetof(SE_DeviceStatus_t,pollRate), .min=0, .max=1, .attribute=1, .bit=18, .type=ST_SIMPLE|XS_UINT, .n=2},
-  {.offset=offsetof(SE_DeviceStatus_t,changedTime), .min=1, .max=1, .type=ST_SIMPLE|XS_LONG, .n=1},
-  {.offset=offsetof(SE_DeviceStatus_t,onCount), .min=0, .max=1, .bit=6, .type=ST_SIMPLE|XS_USHORT, .n=6},
-  {.offset=offsetof(SE_DeviceStatus_t,opState), .min=0, .max=1, .bit=7, .type=ST_SIMPLE|XS_UBYTE, .n=5},
-  {.offset=offsetof(SE_DeviceStatus_t,opTime), .min=0, .max=1, .bit=8, .type=ST_SIMPLE|XS_UINT, .n=4},
-  {.offset=offsetof(SE_DeviceStatus_t,Temperature), .min=0, .unbounded=1, .index=1942, .n=3},
-  {.offset=offsetof(SE_DeviceStatus_t,TimeLink), .min=0, .max=1, .bit=5, .index=1779, .n=2},
+  {.offset=offsetof(SE_DeviceStatus_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=3, .width=2},
+  {.offset=offsetof(SE_DeviceStatus_t,pollRate), .min=0, .max=1, .attribute=1, .bit=18, .type=ST_SIMPLE|XS_UINT, .n=2, .width=2},
+  {.offset=offsetof(SE_DeviceStatus_t,changedTime), .min=1, .max=1, .type=ST_SIMPLE|XS_LONG, .n=1, .width=1},
+  {.offset=offsetof(SE_DeviceStatus_t,onCount), .min=0, .max=1, .bit=6, .type=ST_SIMPLE|XS_USHORT, .n=6, .width=3},
+  {.offset=offsetof(SE_DeviceStatus_t,opState), .min=0, .max=1, .bit=7, .type=ST_SIMPLE|XS_UBYTE, .n=5, .width=3},
+  {.offset=offsetof(SE_DeviceStatus_t,opTime), .min=0, .max=1, .bit=8, .type=ST_SIMPLE|XS_UINT, .n=4, .width=3},
+  {.offset=offsetof(SE_DeviceStatus_t,Temperature), .min=0, .unbounded=1, .index=1942, .n=3, .width=2},
+  {.offset=offsetof(SE_DeviceStatus_t,TimeLink), .min=0, .max=1, .bit=5, .index=1779, .n=2, .width=2},
   // SelfDeviceLink (1955)
   {.size=sizeof(SE_SelfDeviceLink_t), .index=449},
-  {.offset=offsetof(SE_SelfDeviceLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1},
+  {.offset=offsetof(SE_SelfDeviceLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1, .width=1},
   // MirrorUsagePointListLink (1957)
   {.size=sizeof(SE_MirrorUsagePointListLink_t), .index=451},
-  {.offset=offsetof(SE_MirrorUsagePointListLink_t,all), .min=0, .max=1, .attribute=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=2},
-  {.offset=offsetof(SE_MirrorUsagePointListLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1},
+  {.offset=offsetof(SE_MirrorUsagePointListLink_t,all), .min=0, .max=1, .attribute=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=2, .width=2},
+  {.offset=offsetof(SE_MirrorUsagePointListLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1, .width=1},
   // EndDeviceListLink (1960)
   {.size=sizeof(SE_EndDeviceListLink_t), .index=451},
-  {.offset=offsetof(SE_EndDeviceListLink_t,all), .min=0, .max=1, .attribute=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=2},
-  {.offset=offsetof(SE_EndDeviceListLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1},
+  {.offset=offsetof(SE_EndDeviceListLink_t,all), .min=0, .max=1, .attribute=1, .bit=0, .type=ST_SIMPLE|XS_UINT, .n=2, .width=2},
+  {.offset=offsetof(SE_EndDeviceListLink_t,href), .min=1, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=1, .width=1},
   // DeviceCapability (1963)
   {.size=sizeof(SE_DeviceCapability_t), .index=1805},
-  {.offset=offsetof(SE_DeviceCapability_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=16},
-  {.offset=offsetof(SE_DeviceCapability_t,pollRate), .min=0, .max=1, .attribute=1, .bit=18, .type=ST_SIMPLE|XS_UINT, .n=15},
-  {.offset=offsetof(SE_DeviceCapability_t,CustomerAccountListLink), .min=0, .max=1, .bit=6, .index=1802, .n=14},
-  {.offset=offsetof(SE_DeviceCapability_t,DemandResponseProgramListLink), .min=0, .max=1, .bit=7, .index=1799, .n=13},
-  {.offset=offsetof(SE_DeviceCapability_t,DERProgramListLink), .min=0, .max=1, .bit=8, .index=1796, .n=12},
-  {.offset=offsetof(SE_DeviceCapability_t,FileListLink), .min=0, .max=1, .bit=9, .index=1793, .n=11},
-  {.offset=offsetof(SE_DeviceCapability_t,MessagingProgramListLink), .min=0, .max=1, .bit=10, .index=1790, .n=10},
-  {.offset=offsetof(SE_DeviceCapability_t,PrepaymentListLink), .min=0, .max=1, .bit=11, .index=1787, .n=9},
-  {.offset=offsetof(SE_DeviceCapability_t,ResponseSetListLink), .min=0, .max=1, .bit=12, .index=1784, .n=8},
-  {.offset=offsetof(SE_DeviceCapability_t,TariffProfileListLink), .min=0, .max=1, .bit=13, .index=1781, .n=7},
-  {.offset=offsetof(SE_DeviceCapability_t,TimeLink), .min=0, .max=1, .bit=5, .index=1779, .n=6},
-  {.offset=offsetof(SE_DeviceCapability_t,UsagePointListLink), .min=0, .max=1, .bit=14, .index=1776, .n=5},
-  {.offset=offsetof(SE_DeviceCapability_t,EndDeviceListLink), .min=0, .max=1, .bit=15, .index=1960, .n=4},
-  {.offset=offsetof(SE_DeviceCapability_t,MirrorUsagePointListLink), .min=0, .max=1, .bit=16, .index=1957, .n=3},
-  {.offset=offsetof(SE_DeviceCapability_t,SelfDeviceLink), .min=0, .max=1, .bit=17, .index=1955, .n=2},
+  {.offset=offsetof(SE_DeviceCapability_t,href), .min=0, .max=1, .attribute=1, .type=ST_SIMPLE|XS_ANY_URI, .n=16, .width=5},
+  {.offset=offsetof(SE_DeviceCapability_t,pollRate), .min=0, .max=1, .attribute=1, .bit=18, .type=ST_SIMPLE|XS_UINT, .n=15, .width=4},
+  {.offset=offsetof(SE_DeviceCapability_t,CustomerAccountListLink), .min=0, .max=1, .bit=6, .index=1802, .n=14, .width=4},
+  {.offset=offsetof(SE_DeviceCapability_t,DemandResponseProgramListLink), .min=0, .max=1, .bit=7, .index=1799, .n=13, .width=4},
+  {.offset=offsetof(SE_DeviceCapability_t,DERProgramListLink), .min=0, .max=1, .bit=8, .index=1796, .n=12, .width=4},
+  {.offset=offsetof(SE_DeviceCapability_t,FileListLink), .min=0, .max=1, .bit=9, .index=1793, .n=11, .width=4},
+  {.offset=offsetof(SE_DeviceCapability_t,MessagingProgramListLink), .min=0, .max=1, .bit=10, .index=1790, .n=10, .width=4},
+  {.offset=offsetof(SE_DeviceCapability_t,PrepaymentListLink), .min=0, .max=1, .bit=11, .index=1787, .n=9, .width=4},
+  {.offset=offsetof(SE_DeviceCapability_t,ResponseSetListLink), .min=0, .max=1, .bit=12, .index=1784, .n=8, .width=4},
+  {.offset=offsetof(SE_DeviceCapability_t,TariffProfileListLink), .min=0, .max=1, .bit=13, .index=1781, .n=7, .width=3},
+  {.offset=offsetof(SE_DeviceCapability_t,TimeLink), .min=0, .max=1, .bit=5, .index=1779, .n=6, .width=3},
+  {.offset=offsetof(SE_DeviceCapability_t,UsagePointListLink), .min=0, .max=1, .bit=14, .index=1776, .n=5, .width=3},
+  {.offset=offsetof(SE_DeviceCapability_t,EndDeviceListLink), .min=0, .max=1, .bit=15, .index=1960, .n=4, .width=3},
+  {.offset=offsetof(SE_DeviceCapability_t,MirrorUsagePointListLink), .min=0, .max=1, .bit=16, .index=1957, .n=3, .width=2},
+  {.offset=offsetof(SE_DeviceCapability_t,SelfDeviceLink), .min=0, .max=1, .bit=17, .index=1955, .n=2, .width=2},
   {0}
 };
 
@@ -2274,4 +2274,10 @@ const char * const se_names[] = {"AbstractDevice", "AccountBalance", "AccountBal
 
 const uint16_t se_types[] = {1862, 968, 928, 917, XS_UBYTE|ST_SIMPLE, 1058, 925, 523, 1372, 469, 582, 1055, 922, 1052, 1175, 1243, 704, 701, 1339, XS_UBYTE|ST_SIMPLE, 1716, 791, 789, 993, 1140, 1146, 1049, 1127, 1135, 1107, 1110, 1117, 990, 0, 1123, XS_UBYTE|ST_SIMPLE, XS_UBYTE|ST_SIMPLE, 1758, 1460, 1860, 496, XS_UBYTE|ST_SIMPLE, 1267, 1273, 1195, XS_UBYTE|ST_SIMPLE, 954, 963, 911, XS_UBYTE|ST_SIMPLE, 882, XS_UBYTE|ST_SIMPLE, XS_USHORT|ST_SIMPLE, 787, 707, 555, 1089, 467, 1100, 1802, 1061, 1078, 1086, 794, 737, 785, 710, 783, 668, 603, 683, 518, 1737, xs_type(XS_HEX_BINARY,4)|ST_SIMPLE, 559, 588, 577, 515, XS_UBYTE|ST_SIMPLE, 465, 804, 1857, 532, 463, 548, 1796, 747, 781, 502, 779, XS_UBYTE|ST_SIMPLE, XS_UBYTE|ST_SIMPLE, 0, 0, 1646, XS_UBYTE|ST_SIMPLE, 349, 810, 521, 1375, 1392, 1385, 1799, 0, 1963, 461, xs_type(XS_HEX_BINARY,4)|ST_SIMPLE, 1650, 1855, 1946, 1853, 1719, xs_type(XS_HEX_BINARY,4)|ST_SIMPLE, 1337, 0, 1912, 1341, 1363, 1369, 459, 1935, 1960, 1262, 435, 644, 630, 1419, 1406, 1431, 1793, 1408, 1851, 475, 596, XS_UBYTE|ST_SIMPLE, 853, 864, 1909, 829, 843, 1906, 1731, 590, 1817, 1805, 1833, 1903, 1643, xs_type(XS_HEX_BINARY,16)|ST_SIMPLE, xs_type(XS_HEX_BINARY,2)|ST_SIMPLE, xs_type(XS_HEX_BINARY,20)|ST_SIMPLE, xs_type(XS_HEX_BINARY,4)|ST_SIMPLE, xs_type(XS_HEX_BINARY,6)|ST_SIMPLE, xs_type(XS_HEX_BINARY,8)|ST_SIMPLE, xs_type(XS_HEX_BINARY,1)|ST_SIMPLE, 1024, 1031, 1046, 1534, 1604, 1608, 1564, 1567, 1595, 1848, 368, XS_SHORT|ST_SIMPLE, XS_INT|ST_SIMPLE, XS_LONG|ST_SIMPLE, XS_LONG|ST_SIMPLE, XS_BYTE|ST_SIMPLE, 493, XS_UBYTE|ST_SIMPLE, 0, 0, 0, 0, 0, 0, 1538, 1556, 1561, 0, 0, 0, 0, 0, 449, 420, 451, 1394, 1400, 1845, 490, xs_type(XS_STRING,42)|ST_SIMPLE, 1469, 1479, 1842, 0, 487, 1178, 1188, 1790, 1312, 386, 457, 1321, 893, 391, 430, 379, 409, 424, 1957, 1515, 1520, 1531, 1746, 1753, 454, 1333, XS_SHORT|ST_SIMPLE, 484, XS_UINT|ST_SIMPLE, 1613, XS_UINT|ST_SIMPLE, 0, XS_USHORT|ST_SIMPLE, XS_UBYTE|ST_SIMPLE, 1457, 692, 599, XS_BYTE|ST_SIMPLE, XS_UBYTE|ST_SIMPLE, 1621, 1840, XS_UBYTE|ST_SIMPLE, 885, 909, 930, 1044, 947, 1787, 1710, 1439, 1444, 1454, XS_UBYTE|ST_SIMPLE, XS_UBYTE|ST_SIMPLE, 1012, 1019, 1041, 1498, 0, 1510, 1601, 1486, 1490, 1495, 655, 1246, 1437, 1257, 1219, 585, 689, 359, 352, 1310, 1301, 1285, 1288, 373, 1295, 1307, 330, 988, 914, 1893, 1901, 850, 328, 442, 438, 636, 1678, 1705, 1690, 1693, 1699, 1784, xs_type(XS_HEX_BINARY,2)|ST_SIMPLE, XS_ULONG|ST_SIMPLE, 1877, 1955, 879, XS_UBYTE|ST_SIMPLE, XS_UBYTE|ST_SIMPLE, 974, 1084, 983, 1330, XS_SHORT|ST_SIMPLE, 826, 0, 481, 478, xs_type(XS_STRING,16)|ST_SIMPLE, xs_type(XS_STRING,192)|ST_SIMPLE, xs_type(XS_STRING,20)|ST_SIMPLE, xs_type(XS_STRING,32)|ST_SIMPLE, xs_type(XS_STRING,42)|ST_SIMPLE, xs_type(XS_STRING,6)|ST_SIMPLE, 526, 543, 499, XS_UBYTE|ST_SIMPLE, 1762, 1743, 1770, 1898, 870, 874, 906, 1632, 1635, 1640, XS_UBYTE|ST_SIMPLE, 1000, 1007, 1038, 1327, 1222, 1036, 1233, 1781, 1942, 1152, 1166, 1172, 1684, 1668, 1449, 1779, XS_INT|ST_SIMPLE, 1198, 1213, 1240, XS_LONG|ST_SIMPLE, XS_USHORT|ST_SIMPLE, XS_UINT|ST_SIMPLE, XS_ULONG|ST_SIMPLE, XS_ULONG|ST_SIMPLE, XS_ULONG|ST_SIMPLE, XS_UBYTE|ST_SIMPLE, XS_UBYTE|ST_SIMPLE, 324, 472, XS_UBYTE|ST_SIMPLE, 896, 401, 891, 1278, 1776, XS_USHORT|ST_SIMPLE, 698, 695, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1525, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, xs_type(XS_HEX_BINARY,16)|ST_SIMPLE, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, };
 
-Schema se_schema = {"urn:ieee:std:2030.5:ns", "S1", 324, 731, se_names, se_types, se_entries, se_elements, se_ids};
+const uint16_t se_seeds[] = {2, 0, 0, 0, 1, 1, 0, 0, 0, 1, 0, 0, 2, 0, 1, 0, 0, 0, 0, 0, 0, 1, 1, 0, 1, 0, 0, 0, 0, 0, 0, 2, 1, 0, 0, 3, 1, 1, 0, 0, 2, 2, 0, 0, 3, 2, 0, 0, 0, 0, 2, 1, 1, 0, 1, 0, 0, 2, 0, 0, 0, 2, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 4, 0, 0, 1, 1, 0, 0, 0, 0, 0, 3, 0, 0, 2, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 1, 0, 1, 1, 0, 0, 0, 0, 2, 0, 1, 0, 0, 0, 3, 0, 1, 1, 0, 0, 1, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 1, 2, 0, 0, 1, 0, 0, 1, 0, 2, 0, 1, 1, 1, 1, 0, 3, 2, 0, 2, 0, 0, 0, 0, 0, 2, 0, 4, 0, 0, 0, 3, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 3, 0, 0, 0, 5, 3, 0, 2, 0, 0, 2, 0, 4, 2, 1, 1, 1, 0, 1, 1, 3, 0, 1, 3, 0, 0, 0, 1, 2, 1, 3, 0, 2, 3, 0, 1, 0, 0, 0, 0, 1, 0, 4, 1, 0, 1, 0, 1, 1, 4, 0, 2, 0, 0, 0, 7, 0, 0, 1, 0, 0, 1, 0, 3, 0, 0, 0, 0, 1, 4, 1, 1, };
+
+const int16_t se_slots[] = {121, -1, -1, -1, 389, -1, 214, -1, -1, 76, -1, -1, 664, -1, -1, -1, 61, -1, -1, 169, 266, 533, 504, -1, -1, -1, -1, -1, -1, -1, 348, 12, -1, 467, -1, -1, 88, 725, -1, -1, 240, 84, -1, -1, -1, -1, -1, 630, -1, 516, 471, -1, -1, -1, 15, -1, 224, -1, -1, -1, 723, 563, 694, 404, -1, 226, 186, -1, -1, 201, -1, 488, -1, -1, 135, 585, -1, -1, -1, -1, 595, 199, -1, 705, 92, -1, -1, 149, -1, -1, 392, -1, -1, -1, 400, -1, -1, -1, -1, -1, 451, -1, -1, 482, 175, 247, -1, -1, -1, 310, 573, -1, -1, -1, 556, -1, -1, -1, 426, -1, -1, -1, 27, 479, 355, -1, 717, 365, 293, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 645, 91, -1, -1, 176, -1, 455, -1, -1, 468, -1, 174, -1, 204, 317, 441, -1, 94, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 396, -1, -1, -1, -1, -1, 386, -1, -1, -1, -1, 593, -1, 49, 701, -1, -1, -1, -1, 481, -1, -1, 190, -1, -1, 51, 268, 185, 370, -1, 498, -1, 711, -1, 618, -1, -1, -1, -1, 187, 347, -1, 250, 413, 54, -1, -1, -1, 188, 58, 34, -1, 493, -1, -1, -1, -1, -1, -1, -1, -1, -1, 287, -1, -1, -1, -1, 23, 641, 546, -1, -1, -1, -1, 521, 354, 644, -1, -1, 650, -1, -1, -1, -1, -1, -1, 111, -1, 708, -1, -1, -1, 315, -1, 98, -1, -1, -1, -1, -1, 407, 415, -1, -1, -1, -1, -1, 446, -1, -1, 377, -1, -1, 136, -1, 532, 232, 373, 144, -1, -1, -1, 89, -1, 538, -1, -1, -1, 366, -1, -1, -1, 38, 208, -1, -1, -1, 218, -1, -1, -1, -1, -1, -1, -1, -1, -1, 557, -1, 534, -1, 318, 42, -1, 291, -1, -1, -1, -1, -1, -1, -1, 244, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 277, 393, -1, -1, -1, 539, -1, 439, 728, -1, -1, 390, -1, -1, 677, 375, 447, 378, 193, -1, -1, -1, -1, -1, 457, -1, 157, 353, -1, -1, 408, -1, -1, 509, 500, 624, -1, -1, 233, -1, -1, -1, 709, 246, -1, -1, -1, -1, -1, -1, 139, -1, -1, 292, -1, 499, -1, -1, 227, -1, -1, 583, -1, -1, -1, -1, -1, -1, 454, -1, 18, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 37, -1, 661, -1, -1, -1, 622, 322, 48, 487, 276, -1, -1, -1, -1, -1, 332, 703, 320, -1, -1, 210, -1, 529, 213, -1, -1, -1, -1, -1, 718, 722, 610, 548, 50, 553, -1, -1, 326, 619, -1, -1, -1, -1, -1, 161, -1, 427, -1, -1, 163, -1, -1, -1, -1, 436, 492, -1, 536, -1, -1, 506, -1, -1, 207, -1, -1, -1, -1, -1, -1, -1, -1, 541, 706, -1, -1, 665, -1, -1, -1, -1, 308, -1, 254, -1, -1, -1, -1, 601, 523, -1, 360, -1, -1, 44, -1, -1, -1, -1, 605, -1, -1, -1, -1, -1, -1, -1, 40, -1, 8, -1, -1, -1, -1, 280, -1, -1, -1, -1, 367, -1, 679, -1, -1, 234, 16, -1, -1, -1, 329, 419, -1, -1, 667, -1, -1, 428, -1, 101, 57, -1, 586, -1, 338, 425, -1, -1, -1, -1, -1, -1, -1, 219, 576, -1, -1, 105, 642, 6, 283, -1, -1, -1, -1, -1, -1, -1, 109, 429, -1, 637, 285, 311, 625, -1, -1, -1, -1, 431, -1, -1, 255, -1, -1, -1, 86, 129, 394, -1, -1, 685, 126, -1, -1, -1, -1, -1, -1, 558, -1, -1, 177, -1, 613, -1, -1, -1, -1, -1, 178, 220, -1, 260, 141, -1, -1, -1, 252, -1, 196, -1, 724, -1, -1, 379, -1, -1, -1, 235, 628, -1, -1, -1, -1, 309, 514, 502, -1, -1, -1, 3, -1, -1, -1, -1, -1, -1, 93, -1, 281, 361, -1, -1, -1, -1, -1, -1, 334, 638, -1, -1, -1, 225, 107, -1, 719, 258, -1, 670, -1, -1, -1, 100, -1, 359, 351, 269, 458, -1, -1, -1, 433, 689, -1, -1, -1, 688, 465, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 702, 584, -1, -1, -1, 238, 579, -1, -1, -1, 230, -1, 349, -1, 102, -1, -1, -1, -1, 296, -1, -1, 358, -1, -1, 695, -1, 729, -1, -1, 544, 603, -1, 142, 617, 420, -1, -1, 672, -1, -1, -1, 153, -1, -1, 114, -1, -1, -1, -1, -1, -1, -1, -1, 56, -1, -1, -1, -1, 13, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 537, -1, -1, -1, -1, -1, 690, -1, -1, -1, -1, -1, 19, 459, 113, 87, -1, -1, -1, 216, 229, 591, -1, -1, 11, -1, 32, -1, -1, 39, 505, 712, -1, 627, 80, 409, -1, -1, -1, 491, -1, 402, 321, 623, 668, -1, 530, 461, -1, 562, 20, 422, -1, -1, 411, -1, 282, -1, -1, 410, -1, -1, -1, 687, -1, -1, 464, 720, -1, -1, -1, -1, -1, 344, -1, -1, 270, -1, -1, -1, -1, -1, -1, -1, 151, -1, 99, 470, -1, -1, -1, 480, -1, 264, -1, -1, -1, 483, -1, 363, 242, -1, -1, -1, -1, 295, -1, -1, -1, 342, -1, -1, -1, -1, -1, -1, -1, 212, -1, -1, 510, -1, 391, -1, -1, 692, -1, -1, -1, -1, 395, 495, -1, 587, -1, 531, 73, -1, -1, -1, -1, -1, -1, -1, -1, 387, 403, 66, -1, 305, 424, 474, 381, -1, 466, 209, -1, 59, 598, -1, -1, -1, -1, 686, -1, 55, -1, 714, 297, -1, -1, -1, -1, -1, -1, -1, -1, 730, -1, 253, -1, -1, -1, -1, 449, -1, -1, 577, 294, -1, -1, 336, 327, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 662, -1, -1, 383, -1, -1, 716, -1, 440, -1, -1, -1, 22, -1, -1, -1, -1, -1, -1, 472, -1, -1, -1, 636, -1, 721, 205, 469, -1, 4, -1, -1, 97, -1, 288, 561, 462, 106, -1, -1, -1, -1, -1, -1, -1, -1, 130, -1, -1, -1, -1, -1, 70, -1, -1, -1, 460, 450, -1, -1, -1, -1, -1, -1, -1, -1, -1, 331, 274, -1, 138, -1, 643, 104, 372, 90, 313, -1, -1, -1, -1, -1, -1, -1, 155, 137, -1, 272, -1, -1, 284, -1, 202, -1, -1, -1, 330, 239, -1, -1, -1, -1, -1, -1, 674, 696, -1, -1, -1, 547, -1, 489, -1, -1, 335, 635, 53, 182, -1, -1, -1, -1, -1, 526, -1, -1, 275, 46, -1, -1, -1, -1, -1, -1, -1, -1, 131, 198, -1, -1, -1, -1, 475, -1, -1, 116, -1, -1, 150, -1, -1, -1, -1, -1, -1, -1, -1, -1, 614, -1, -1, -1, -1, -1, -1, -1, -1, -1, 680, 119, -1, -1, -1, -1, -1, 671, 535, 134, -1, -1, -1, -1, 95, -1, -1, 36, 328, -1, 726, 549, -1, -1, -1, 485, 612, 445, -1, -1, -1, 77, -1, -1, -1, -1, -1, 81, -1, -1, -1, -1, -1, -1, -1, 307, -1, -1, 658, -1, -1, -1, -1, -1, 589, -1, -1, -1, -1, 300, 17, -1, -1, -1, 60, 398, 85, 314, -1, -1, -1, -1, -1, 569, 312, 421, -1, -1, 132, -1, -1, -1, -1, 117, -1, -1, -1, -1, 655, 412, -1, -1, -1, 676, -1, -1, 564, -1, 75, -1, -1, -1, 357, 443, -1, -1, -1, 594, -1, 273, 399, -1, 173, 371, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 715, -1, -1, -1, -1, 148, 600, -1, -1, -1, 640, -1, -1, -1, 184, -1, -1, 223, -1, 385, 693, 555, 543, -1, -1, -1, 616, -1, 384, 241, -1, -1, -1, -1, -1, -1, -1, -1, 103, 122, 143, -1, 346, -1, 571, -1, -1, 21, -1, -1, 444, -1, -1, -1, -1, 518, -1, 698, -1, -1, 416, 397, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 528, -1, -1, -1, -1, 430, -1, 145, -1, -1, -1, -1, -1, 417, 602, 316, 494, -1, 620, 356, -1, -1, 490, -1, -1, -1, 221, 456, -1, -1, 515, 609, 203, -1, -1, -1, 217, -1, 566, -1, 634, -1, 621, 710, 683, 7, -1, 522, 477, -1, -1, 568, -1, -1, 654, 673, 575, -1, -1, -1, -1, -1, 486, -1, -1, -1, -1, -1, 323, 154, 265, 78, 423, 606, 159, 168, -1, 152, 364, 1, -1, -1, 362, -1, -1, 83, -1, -1, 376, -1, 633, -1, -1, 158, 325, -1, 69, 707, -1, -1, -1, -1, -1, -1, 604, 112, 418, -1, 615, -1, 669, -1, -1, -1, 550, -1, -1, 659, -1, 162, -1, 2, -1, -1, -1, 574, -1, -1, -1, -1, 118, -1, -1, 525, 435, -1, -1, -1, 160, -1, -1, -1, 133, -1, -1, 108, -1, 681, -1, 388, -1, 653, 649, -1, 520, -1, -1, 156, -1, 243, -1, -1, 262, -1, -1, -1, -1, 28, -1, -1, -1, -1, 476, -1, -1, 120, -1, 82, -1, 434, -1, -1, -1, -1, -1, 303, -1, 65, -1, -1, -1, -1, 554, 607, 501, 559, -1, 35, -1, -1, -1, 166, -1, -1, -1, 611, 298, 43, 67, -1, -1, -1, -1, 24, -1, 646, -1, 128, -1, -1, -1, -1, 343, -1, -1, -1, 206, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 675, 352, 231, -1, -1, -1, -1, -1, -1, -1, 195, 237, 47, 341, -1, -1, -1, -1, -1, 582, -1, 406, -1, -1, 639, -1, -1, -1, 72, -1, 146, -1, -1, -1, -1, 279, 382, -1, -1, 200, 442, -1, 527, -1, -1, -1, -1, -1, -1, -1, -1, 497, -1, -1, -1, -1, 657, -1, 597, 340, 267, -1, -1, -1, -1, -1, -1, -1, 432, 215, -1, -1, 124, -1, -1, -1, -1, -1, 127, 519, -1, -1, 678, -1, -1, 115, -1, -1, -1, 380, -1, -1, -1, -1, 171, 401, 452, 249, 508, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 565, -1, 656, -1, 324, 704, 261, 52, 578, -1, -1, -1, -1, 369, 545, -1, -1, -1, -1, -1, -1, -1, 368, -1, -1, 9, -1, -1, -1, -1, -1, -1, -1, -1, -1, 337, -1, 414, -1, 438, -1, -1, -1, 345, -1, 596, -1, 191, -1, -1, -1, 30, 333, -1, -1, 257, -1, 629, -1, -1, -1, 71, -1, 513, -1, -1, 181, -1, -1, -1, -1, -1, 302, -1, -1, -1, 484, 512, -1, -1, 25, -1, -1, 503, -1, -1, 699, -1, 304, 581, -1, 211, -1, -1, 588, 164, -1, 648, -1, -1, 511, -1, -1, 631, 29, 167, -1, -1, -1, 236, -1, -1, -1, -1, 713, 0, 551, 147, -1, 179, 437, -1, 660, -1, 194, -1, 473, -1, 448, -1, -1, 306, 453, 592, 301, -1, 540, -1, 350, 608, -1, -1, -1, 64, 700, 251, 524, 222, -1, -1, -1, -1, 542, 26, 478, -1, 41, -1, -1, -1, 96, -1, 651, -1, 245, -1, -1, -1, 79, -1, -1, -1, -1, -1, 560, -1, -1, -1, 570, -1, -1, -1, -1, -1, -1, 31, -1, 507, -1, -1, -1, -1, 572, 626, -1, -1, 110, 632, -1, -1, 170, 259, 62, 68, -1, 189, 691, 248, -1, -1, -1, -1, -1, -1, -1, 5, 463, -1, -1, 663, 278, -1, -1, 63, 180, 339, -1, -1, 45, 647, 33, -1, -1, -1, 123, -1, -1, -1, 172, -1, -1, 10, -1, -1, -1, 652, -1, 228, 567, 599, 590, -1, 192, -1, -1, -1, -1, 290, 286, 682, 125, -1, -1, -1, -1, -1, 580, 374, -1, -1, -1, -1, -1, -1, 517, -1, -1, -1, -1, -1, -1, -1, -1, -1, 14, 74, -1, -1, -1, -1, 289, -1, 197, 552, -1, -1, 727, 405, 684, -1, -1, -1, -1, 496, -1, 271, -1, 666, 140, -1, -1, -1, 165, -1, -1, -1, -1, 299, 263, -1, -1, -1, 319, -1, -1, 256, -1, 183, -1, 697, -1, };
+
+const NameHash se_hash = {256, 2048, se_seeds, se_slots};
+
+Schema se_schema = {"urn:ieee:std:2030.5:ns", "S1", 324, 731, se_names, se_types, se_entries, se_elements, se_ids, &se_hash, &se_codec};
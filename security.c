@@ -38,6 +38,13 @@ uint64_t lfdi_gen (uint8_t *lfdi, const char *path);
 */
 uint64_t load_device_cert (uint8_t *lfdi, const char *path);
 
+/** @brief Print the SFDI and LFDI of a device certificate to the console.
+    @param path is the path of the device certificate
+    @param lfdi is the 20 byte LFDI
+    @param sfdi is the SFDI
+*/
+void print_device_cert (const char *path, uint8_t *lfdi, uint64_t sfdi);
+
 /** @brief Initialize the device SFDI and LDFI.
 
     Initialize the global variable device_lfdi and device_sfdi by computing the
@@ -50,8 +57,8 @@ void security_init (const char *path);
 
 #ifdef HEADER_ONLY
 
-extern uint8_t device_lfdi[20];
-extern uint64_t device_sfdi;
+extern THREAD_LOCAL uint8_t device_lfdi[20];
+extern THREAD_LOCAL uint64_t device_sfdi;
 
 #else
 
@@ -60,8 +67,8 @@ extern uint64_t device_sfdi;
 #include <stdio.h>
 #include <inttypes.h>
 
-uint8_t device_lfdi[20];
-uint64_t device_sfdi = 0;
+THREAD_LOCAL uint8_t device_lfdi[20];
+THREAD_LOCAL uint64_t device_sfdi = 0;
 
 void print_bytes (unsigned char *data, int n) { int i;
   for (i = 0; i < n; i++) printf ("%02x", data[i]);
@@ -97,11 +104,15 @@ uint64_t lfdi_gen (uint8_t *lfdi, const char *path) {
   free (buffer); return sfdi;
 }
 
-uint64_t load_device_cert (uint8_t *lfdi, const char *path) {
-  uint64_t sfdi = lfdi_gen (lfdi, path);
+void print_device_cert (const char *path, uint8_t *lfdi, uint64_t sfdi) {
   printf ("load device certificate: %s\n", path);
   printf ("  lfdi: "); print_bytes (lfdi, 20);
   printf ("\n  sfdi: %" PRIu64 "\n", sfdi);
+}
+
+uint64_t load_device_cert (uint8_t *lfdi, const char *path) {
+  uint64_t sfdi = lfdi_gen (lfdi, path);
+  print_device_cert (path, lfdi, sfdi);
   return sfdi;
 }
 
@@ -8,23 +8,134 @@ typedef struct {
   SE_DERStatus_t *ders;
 } Settings;
 
-void load_settings (const char *name, void *ctx) {
-  Settings *ds = ctx;
+#define SETTINGS_MAGIC 0x31545353 // "SST1"
+
+/* The settings cache is a header followed by records, each record has a
+   fixed part followed by the key (the device SFDI and the name of the
+   settings file) and the EXI document, each record is 8 byte aligned. */
+typedef struct {
+  uint32_t magic, count;
+} SettingsHeader;
+
+typedef struct {
+  uint32_t size; // the size of the record
+  int32_t type;
+  uint64_t sfdi;
+  int64_t mtime, length; // the modification time and size of the file
+  uint32_t name; // the length of the key
+  uint32_t doc; // the length of the EXI document
+} SettingsRecord;
+
+// a settings file loaded, saved to the cache
+typedef struct {
+  uint64_t sfdi; int type;
+  int64_t mtime, length;
+  void *obj; char key[]; // "sfdi:name"
+} SettingsFile;
+
+typedef struct {
+  uint64_t sfdi; Settings *settings;
+} SettingsContext;
+
+char *settings_path = NULL, *settings_data = NULL;
+int settings_length = 0, settings_parsed = 0;
+HashTable *settings_hash = NULL;
+List *settings_files = NULL;
+
+void *settings_key (void *data) {
+  return (char *)data + sizeof (SettingsRecord);
+}
+
+int settings_cache_load (const char *path) {
+  SettingsHeader *h; char *data, *end; int i;
+  settings_path = strdup (path);
+  if (!(data = file_map (path, &settings_length))) return 0;
+  h = (SettingsHeader *)data; end = data + settings_length;
+  if (settings_length < sizeof (SettingsHeader)
+      || h->magic != SETTINGS_MAGIC) {
+    file_unmap (data, settings_length); return 0;
+  }
+  settings_data = data;
+  settings_hash = new_string_hash (64, settings_key);
+  data += sizeof (SettingsHeader);
+  for (i = 0; i < h->count; i++) { SettingsRecord *r = (SettingsRecord *)data;
+    if (end - data < sizeof (SettingsRecord) || r->size > end - data
+	|| sizeof (SettingsRecord) + r->name + r->doc > r->size) break;
+    hash_put (settings_hash, r); data += r->size;
+  } return h->count = i;
+}
+
+// decode an unchanged settings file from the cache
+void *cached_settings (SettingsFile *f, int *type) {
+  SettingsRecord *r; void *obj;
+  if (settings_hash && (r = hash_get (settings_hash, f->key))
+      && r->sfdi == f->sfdi && r->mtime == f->mtime && r->length == f->length
+      && (obj = se_exi_decode (settings_key (r) + r->name, r->doc, type))) {
+    if (*type == r->type) return obj;
+    free_se_object (obj, *type);
+  } return NULL;
+}
+
+void *parse_settings (const char *name, int *type) {
   char *buffer = file_read (name, NULL),
     *data = utf8_start (buffer);
   Parser *p = parser_new ();
-  void *obj; int type;
+  void *obj;
   parse_init (p, &se_schema, data);
-  obj = parse_doc (p, &type);
+  obj = parse_doc (p, type);
   if (parse_error (p)) {
-    printf ("load_device_setting: error parsing XML file %s\n", name);
-    print_parse_stack (p); exit (0);
+    log_error ("load_device_setting: error parsing XML file %s\n", name);
+    print_parse_stack (p); log_flush (); exit (0);
+  }
+  free (buffer); parser_free (p); return obj;
+}
+
+void load_settings (const char *name, void *ctx) {
+  SettingsContext *c = ctx; Settings *ds = c->settings;
+  SettingsFile *f = malloc (sizeof (SettingsFile) + strlen (name) + 22);
+  void *obj = NULL; int type;
+  f->sfdi = c->sfdi; sprintf (f->key, "%" PRIu64 ":%s", c->sfdi, name);
+  if (!settings_path || !file_stat (name, &f->mtime, &f->length)
+      || !(obj = cached_settings (f, &type))) {
+    obj = parse_settings (name, &type); settings_parsed++;
   }
   switch (type) {
   case SE_DERAvailability: ds->dera = obj; break;
   case SE_DERCapability: ds->dercap = obj; break;
   case SE_DERSettings: ds->derg = obj; break;
   case SE_DERStatus: ds->ders = obj; break;
+  default: free (f); return;
   }
-  free (buffer); parser_free (p); return;
+  if (settings_path) {
+    f->type = type; f->obj = obj;
+    settings_files = list_insert (settings_files, f);
+  } else free (f);
+}
+
+int settings_record (FILE *f, SettingsFile *s) {
+  SettingsRecord r = {0}; char *doc; int n, pad; uint64_t zero = 0;
+  if (!(doc = se_exi_encode (s->obj, s->type, &n))) return 0;
+  r.type = s->type; r.sfdi = s->sfdi;
+  r.mtime = s->mtime; r.length = s->length;
+  r.name = strlen (s->key) + 1; r.doc = n;
+  r.size = sizeof (SettingsRecord) + r.name + r.doc;
+  pad = (8 - (r.size & 7)) & 7; r.size += pad;
+  fwrite (&r, sizeof (SettingsRecord), 1, f);
+  fwrite (s->key, 1, r.name, f);
+  fwrite (doc, 1, r.doc, f); fwrite (&zero, 1, pad, f);
+  free (doc); return 1;
+}
+
+int settings_cache_save () {
+  SettingsHeader h = {SETTINGS_MAGIC, 0}; char temp[256]; FILE *f;
+  List *l;
+  if (!settings_path || !settings_parsed) return 0;
+  if (snprintf (temp, 256, "%s.tmp", settings_path) >= 256
+      || !(f = fopen (temp, "wb"))) return -1;
+  fwrite (&h, sizeof (SettingsHeader), 1, f);
+  foreach (l, settings_files) h.count += settings_record (f, l->data);
+  fseek (f, 0, SEEK_SET); fwrite (&h, sizeof (SettingsHeader), 1, f);
+  if (fclose (f) || rename (temp, settings_path)) {
+    remove (temp); return -1;
+  } settings_parsed = 0; return h.count;
 }
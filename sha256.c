@@ -29,30 +29,25 @@ void sha256 (uint8_t *out, uint8_t *buffer, int length);
 // buffer must be a multiple 64 bytes (512 bits)
 #define sha256_size(x) (((x)+9+63)&(~0x3f))
 
-void sha256 (uint8_t *out, uint8_t *buffer, int length) {
-  int pad = 55 - (length % 64);
-  int i, n = (length+9+63) >> 6;
-  uint64_t l = length * 8;
-  uint32_t H[8] = {0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
-		   0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19};
-  const uint32_t K[64] = 
-    {0x428A2F98, 0x71374491, 0xB5C0FBCF, 0xE9B5DBA5, 0x3956C25B, 0x59F111F1,
-     0x923F82A4, 0xAB1C5ED5, 0xD807AA98, 0x12835B01, 0x243185BE, 0x550C7DC3,
-     0x72BE5D74, 0x80DEB1FE, 0x9BDC06A7, 0xC19BF174, 0xE49B69C1, 0xEFBE4786,
-     0x0FC19DC6, 0x240CA1CC, 0x2DE92C6F, 0x4A7484AA, 0x5CB0A9DC, 0x76F988DA, 
-     0x983E5152, 0xA831C66D, 0xB00327C8, 0xBF597FC7, 0xC6E00BF3, 0xD5A79147,
-     0x06CA6351, 0x14292967, 0x27B70A85, 0x2E1B2138, 0x4D2C6DFC, 0x53380D13,
-     0x650A7354, 0x766A0ABB, 0x81C2C92E, 0x92722C85, 0xA2BFE8A1, 0xA81A664B,
-     0xC24B8B70, 0xC76C51A3, 0xD192E819, 0xD6990624, 0xF40E3585, 0x106AA070,
-     0x19A4C116, 0x1E376C08, 0x2748774C, 0x34B0BCB5, 0x391C0CB3, 0x4ED8AA4A,
-     0x5B9CCA4F, 0x682E6FF3, 0x748F82EE, 0x78A5636F, 0x84C87814, 0x8CC70208,
-     0x90BEFFFA, 0xA4506CEB, 0xBEF9A3F7, 0xC67178F2};
-  uint32_t h[8], W[64], T0, T1; uint8_t *m = buffer;
-  buffer[length] = 0x80; buffer += length + 1;
-  memset (buffer, 0, pad); buffer += pad;
-  PACK64 (buffer, l);
+const uint32_t sha256_K[64] =
+  {0x428A2F98, 0x71374491, 0xB5C0FBCF, 0xE9B5DBA5, 0x3956C25B, 0x59F111F1,
+   0x923F82A4, 0xAB1C5ED5, 0xD807AA98, 0x12835B01, 0x243185BE, 0x550C7DC3,
+   0x72BE5D74, 0x80DEB1FE, 0x9BDC06A7, 0xC19BF174, 0xE49B69C1, 0xEFBE4786,
+   0x0FC19DC6, 0x240CA1CC, 0x2DE92C6F, 0x4A7484AA, 0x5CB0A9DC, 0x76F988DA, 
+   0x983E5152, 0xA831C66D, 0xB00327C8, 0xBF597FC7, 0xC6E00BF3, 0xD5A79147,
+   0x06CA6351, 0x14292967, 0x27B70A85, 0x2E1B2138, 0x4D2C6DFC, 0x53380D13,
+   0x650A7354, 0x766A0ABB, 0x81C2C92E, 0x92722C85, 0xA2BFE8A1, 0xA81A664B,
+   0xC24B8B70, 0xC76C51A3, 0xD192E819, 0xD6990624, 0xF40E3585, 0x106AA070,
+   0x19A4C116, 0x1E376C08, 0x2748774C, 0x34B0BCB5, 0x391C0CB3, 0x4ED8AA4A,
+   0x5B9CCA4F, 0x682E6FF3, 0x748F82EE, 0x78A5636F, 0x84C87814, 0x8CC70208,
+   0x90BEFFFA, 0xA4506CEB, 0xBEF9A3F7, 0xC67178F2};
+
+// process n 64 byte blocks of the message m, updating the hash state H
+void sha256_scalar (uint32_t *H, const uint8_t *m, int n) {
+  const uint32_t *K = sha256_K;
+  uint32_t h[8], W[64], T0, T1; int i;
   while (n--) {
-    memcpy (h, H, sizeof (H));
+    memcpy (h, H, sizeof (h));
     // compute W[0..63]
     for (i = 0; i < 16; i++) { W[i] = UNPACK32 (m); m += 4; }
     while (i < 64) {
@@ -71,6 +66,102 @@ void sha256 (uint8_t *out, uint8_t *buffer, int length) {
     }
     for (i = 0; i < 8; i++) H[i] += h[i];
   }
+}
+
+#if defined (__x86_64__) && defined (__GNUC__)
+
+/* The SHA extensions are detected at run time, the state is kept in the
+   ABEF/CDGH order used by sha256rnds2. */
+#define SHA256_NI
+#include <cpuid.h>
+#include <immintrin.h>
+
+int sha256_ni () {
+  unsigned a, b, c, d;
+  if (!__get_cpuid (1, &a, &b, &c, &d) || !(c & bit_SSE4_1)) return 0;
+  return __get_cpuid_count (7, 0, &a, &b, &c, &d) && (b & (1 << 29));
+}
+
+__attribute__ ((target ("sha,sse4.1")))
+void sha256_hw (uint32_t *H, const uint8_t *m, int n) {
+  const __m128i mask = _mm_set_epi64x (0x0c0d0e0f08090a0bULL,
+				       0x0405060700010203ULL);
+  __m128i s0, s1, t, k, abef, cdgh, W[4]; int i;
+  t = _mm_shuffle_epi32 (_mm_loadu_si128 ((__m128i *)H), 0xb1); // CDAB
+  s1 = _mm_shuffle_epi32 (_mm_loadu_si128 ((__m128i *)(H+4)), 0x1b); // EFGH
+  s0 = _mm_alignr_epi8 (t, s1, 8); // ABEF
+  s1 = _mm_blend_epi16 (s1, t, 0xf0); // CDGH
+  while (n--) {
+    abef = s0; cdgh = s1;
+    for (i = 0; i < 16; i++) {
+      if (i < 4)
+	W[i] = _mm_shuffle_epi8 (_mm_loadu_si128 ((__m128i *)(m+i*16)), mask);
+      else { // W[t] from W[t-16], W[t-15], W[t-7], W[t-2]
+	t = _mm_sha256msg1_epu32 (W[i&3], W[(i+1)&3]);
+	t = _mm_add_epi32 (t, _mm_alignr_epi8 (W[(i+3)&3], W[(i+2)&3], 4));
+	W[i&3] = _mm_sha256msg2_epu32 (t, W[(i+3)&3]);
+      }
+      k = _mm_add_epi32 (W[i&3], _mm_loadu_si128 ((__m128i *)(sha256_K+i*4)));
+      s1 = _mm_sha256rnds2_epu32 (s1, s0, k);
+      s0 = _mm_sha256rnds2_epu32 (s0, s1, _mm_shuffle_epi32 (k, 0x0e));
+    }
+    s0 = _mm_add_epi32 (s0, abef); s1 = _mm_add_epi32 (s1, cdgh); m += 64;
+  }
+  t = _mm_shuffle_epi32 (s0, 0x1b); // FEBA
+  s1 = _mm_shuffle_epi32 (s1, 0xb1); // DCHG
+  _mm_storeu_si128 ((__m128i *)H, _mm_blend_epi16 (t, s1, 0xf0)); // DCBA
+  _mm_storeu_si128 ((__m128i *)(H+4), _mm_alignr_epi8 (s1, t, 8)); // HGFE
+}
+
+#elif defined (__ARM_FEATURE_SHA2)
+
+// ARMv8 cryptography extensions, enabled at compile time (+crypto)
+#define SHA256_NI
+#include <arm_neon.h>
+
+int sha256_ni () { return 1; }
+
+void sha256_hw (uint32_t *H, const uint8_t *m, int n) {
+  uint32x4_t s0 = vld1q_u32 (H), s1 = vld1q_u32 (H+4), a, b, k, t, W[4];
+  int i;
+  while (n--) {
+    a = s0; b = s1;
+    for (i = 0; i < 4; i++)
+      W[i] = vreinterpretq_u32_u8 (vrev32q_u8 (vld1q_u8 (m+i*16)));
+    for (i = 0; i < 16; i++) {
+      k = vaddq_u32 (W[i&3], vld1q_u32 (sha256_K+i*4));
+      if (i < 12) // W[t+16] from W[t..t+15]
+	W[i&3] = vsha256su1q_u32 (vsha256su0q_u32 (W[i&3], W[(i+1)&3]),
+				  W[(i+2)&3], W[(i+3)&3]);
+      t = s0;
+      s0 = vsha256hq_u32 (s0, s1, k);
+      s1 = vsha256h2q_u32 (s1, t, k);
+    }
+    s0 = vaddq_u32 (s0, a); s1 = vaddq_u32 (s1, b); m += 64;
+  }
+  vst1q_u32 (H, s0); vst1q_u32 (H+4, s1);
+}
+
+#endif
+
+void sha256 (uint8_t *out, uint8_t *buffer, int length) {
+  int pad = (55 - length % 64) & 63;
+  int i, n = (length+9+63) >> 6;
+  uint64_t l = length * 8;
+  uint32_t H[8] = {0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+		   0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19};
+  uint8_t *m = buffer;
+#ifdef SHA256_NI
+  static int hw = -1;
+  if (hw < 0) hw = sha256_ni ();
+#endif
+  buffer[length] = 0x80; buffer += length + 1;
+  memset (buffer, 0, pad); buffer += pad;
+  PACK64 (buffer, l);
+#ifdef SHA256_NI
+  if (hw) sha256_hw (H, m, n); else
+#endif
+  sha256_scalar (H, m, n);
   for (i = 0; i < 8; i++) { PACK32 (out, H[i]); out += 4; }
 }
 
@@ -0,0 +1,100 @@
+// Copyright (c) 2018 Electric Power Research Institute, Inc.
+// author: Mark Slicker <mark.slicker@gmail.com>
+
+/** @defgroup share Share
+
+    Provides a content addressed store of IEEE 2030.5 objects. Resources
+    with the same content, such as the DERPrograms and DERControls an
+    aggregator retrieves on the connection of each device, share one
+    immutable object. Objects are found by the hash of their value (see
+    @ref hash_object), compared field by field, and reference counted. The
+    store is thread local like the resources that use it.
+    @{
+*/
+
+/** @brief Store the objects of non-List resources in the shared store
+    (off by default). */
+extern int share_objects;
+
+/** @brief Return the shared instance of an object.
+
+    If an equal object of the same type is stored, the object is freed and
+    the stored object is returned with another reference, otherwise the
+    object moves into the store.
+    @param obj is an IEEE 2030.5 object allocated with malloc
+    @param type is the type of the object
+    @returns a pointer to the shared object, which must not be modified
+*/
+void *share_object (void *obj, int type);
+
+/** @brief Release a reference to a shared object.
+
+    The object is freed with the last reference.
+    @param obj is a pointer to a shared object
+*/
+void release_object (void *obj);
+
+/** @brief Print the statistics of the store of the calling thread.
+    @param f is the output file
+*/
+void share_print (FILE *f);
+
+/** @} */
+
+#ifndef HEADER_ONLY
+
+typedef struct {
+  uint64_t hash; int type, refs;
+  char data[]; // the object
+} SharedObject;
+
+#define shared_object(obj) \
+  ((SharedObject *)((char *)(obj) - offsetof (SharedObject, data)))
+
+int share_objects = 0;
+THREAD_LOCAL HashTable *share_hash = NULL;
+THREAD_LOCAL int share_count = 0, share_refs = 0;
+THREAD_LOCAL int64_t share_bytes = 0;
+
+void *share_key (void *data) { return data; }
+
+int share_hash_value (void *data) { return ((SharedObject *)data)->hash; }
+
+int share_compare (void *a, void *b) { SharedObject *x = a, *y = b;
+  return x->hash != y->hash || x->type != y->type
+    || compare_se_object (x->data, y->data, x->type);
+}
+
+void *share_object (void *obj, int type) {
+  int size = se_object_size (type); SharedObject *so, *t;
+  if (!share_hash) {
+    share_hash = hash_flat (hash_new (256));
+    share_hash->hash = share_hash_value; share_hash->get_key = share_key;
+    share_hash->compare = share_compare;
+  }
+  // a shallow copy keeps the elements of the object
+  so = malloc (sizeof (SharedObject) + size);
+  memcpy (so->data, obj, size); free (obj);
+  so->hash = hash_se_object (so->data, type); so->type = type;
+  share_refs++;
+  if (t = hash_get (share_hash, so)) {
+    free_object_elements (so->data, type, &se_schema); free (so);
+    t->refs++; return t->data;
+  } so->refs = 1; hash_put (share_hash, so);
+  share_count++; share_bytes += size; return so->data;
+}
+
+void release_object (void *obj) { SharedObject *so = shared_object (obj);
+  share_refs--;
+  if (--so->refs) return;
+  hash_delete (share_hash, so);
+  share_count--; share_bytes -= se_object_size (so->type);
+  free_object_elements (so->data, so->type, &se_schema); free (so);
+}
+
+void share_print (FILE *f) {
+  fprintf (f, "share: %d objects (%" PRId64 " bytes), %d references\n",
+	   share_count, share_bytes, share_refs);
+}
+
+#endif
@@ -0,0 +1,264 @@
+// Copyright (c) 2018 Electric Power Research Institute, Inc.
+// author: Mark Slicker <mark.slicker@gmail.com>
+
+/** @defgroup snapshot Snapshot
+
+    Provides a warm start for the retrieval of resources. A snapshot file
+    stores the complete resources held by the client, EXI encoded along with
+    the Stub metadata (poll rate, next poll time, list size and validators).
+    When the client restarts the snapshot is memory mapped and resources are
+    restored from the snapshot rather than retrieved from the server,
+    restored resources are processed by the dependency function as if they
+    were retrieved so subordinate resources, schedules and completion routines
+    are restored in the same way. Each restored resource is then revalidated
+    with a conditional GET at its next poll time (spread over the poll period
+    if that time has passed) rather than all at once.
+    @ingroup retrieve
+    @{
+*/
+
+#define RESOURCE_RESTORE (EVENT_NEW+16)
+
+/** @brief Save the complete resources to a snapshot file.
+
+    The snapshot is written to a temporary file that then replaces the
+    snapshot file.
+    @param path is the name of the snapshot file
+    @returns the number of resources saved, -1 if the file could not be
+    written
+*/
+int snapshot_save (const char *path);
+
+/** @brief Load a snapshot file.
+    @param path is the name of the snapshot file
+    @param dep is the dependency function used to process restored resources
+    @returns the number of resources in the snapshot
+*/
+int snapshot_load (const char *path, DepFunc dep);
+
+/** @brief Retrieve the DeviceCapability resources of the snapshot.
+
+    Calls @ref get_resource for each DeviceCapability resource in the
+    snapshot, so retrieval can start without waiting for service discovery.
+*/
+void snapshot_roots ();
+
+/** @brief Schedule the restoration of a new Stub from the snapshot.
+
+    Called by @ref get_resource for a new Stub, if the resource is in the
+    snapshot a RESOURCE_RESTORE event is queued for the Stub.
+    @param s is a pointer to a Stub
+    @returns 1 if the resource is restored from the snapshot, 0 otherwise
+*/
+int snapshot_find (Stub *s);
+
+/** @brief Restore a Stub from the snapshot (RESOURCE_RESTORE event).
+
+    If the resource can't be restored it is retrieved instead.
+    @param s is a pointer to a Stub
+*/
+void snapshot_restore (Stub *s);
+
+/** @brief Unmap the snapshot file. */
+void snapshot_free ();
+
+/** @} */
+
+#ifndef HEADER_ONLY
+
+#define SNAPSHOT_MAGIC 0x32504e53 // "SNP2"
+
+/* A snapshot is a header followed by records, each record has a fixed part
+   followed by the strings (the absolute URI of the resource, ETag,
+   Last-Modified, and the URIs of the List items) and the EXI document, each
+   record is 8 byte aligned. */
+typedef struct {
+  uint32_t magic, count;
+} SnapHeader;
+
+typedef struct {
+  uint32_t size; // the size of the record
+  int32_t type;
+  uint32_t all; // the number of List items
+  int32_t poll_rate;
+  int64_t poll_next, time;
+  uint32_t strings; // the length of the strings
+  uint32_t items; // the number of List item URIs
+  uint32_t length; // the length of the EXI document
+  uint32_t reserved;
+} SnapRecord;
+
+typedef struct {
+  char *uri, *etag, *modified, *items;
+  SnapRecord *r; char *doc;
+} SnapEntry;
+
+THREAD_LOCAL char *snap_data = NULL;
+THREAD_LOCAL int snap_length = 0;
+THREAD_LOCAL SnapEntry *snap_entries = NULL;
+THREAD_LOCAL HashTable *snap_hash = NULL;
+THREAD_LOCAL DepFunc snap_dep = NULL;
+
+void *snap_key (void *data) { SnapEntry *e = data; return e->uri; }
+
+#define next_string(s) ((s) + strlen (s) + 1)
+
+int stub_uri (char *buffer, Stub *s) {
+  int n = se_origin (buffer, s->conn);
+  return n + sprintf (buffer+n, "%s", resource_name (s));
+}
+
+// can the Stub be saved? only complete resources are saved
+int snapshot_stub (Stub *s) {
+  return s->base.data && s->complete && !s->moved
+    && ((s->status >= 200 && s->status < 300) || s->status == 304);
+}
+
+int snapshot_record (FILE *f, Stub *s) {
+  SnapRecord r = {0}; char uri[192], *doc; List *l;
+  int n = stub_uri (uri, s) + 1, pad; uint64_t zero = 0;
+  r.type = resource_type (s); r.all = s->all; r.poll_rate = s->poll_rate;
+  r.poll_next = s->poll_next; r.time = s->base.time;
+  r.strings = n + (s->etag? strlen (s->etag) : 0) + 1
+    + (s->modified? strlen (s->modified) : 0) + 1;
+  if (s->base.info) foreach (l, s->reqs) { char item[192];
+      r.strings += stub_uri (item, l->data) + 1; r.items++;
+    }
+  doc = se_exi_encode (s->base.data, r.type, &n); r.length = n;
+  r.size = sizeof (SnapRecord) + r.strings + r.length;
+  pad = (8 - (r.size & 7)) & 7; r.size += pad;
+  fwrite (&r, sizeof (SnapRecord), 1, f);
+  fputs (uri, f); fputc (0, f);
+  fputs (s->etag? s->etag : "", f); fputc (0, f);
+  fputs (s->modified? s->modified : "", f); fputc (0, f);
+  if (s->base.info) foreach (l, s->reqs) {
+      stub_uri (uri, l->data); fputs (uri, f); fputc (0, f);
+    }
+  fwrite (doc, 1, r.length, f); fwrite (&zero, 1, pad, f);
+  free (doc); return 1;
+}
+
+int snapshot_save (const char *path) {
+  SnapHeader h = {SNAPSHOT_MAGIC, 0}; HashPointer p;
+  char temp[256]; Stub *s, *head; FILE *f;
+  if (snprintf (temp, 256, "%s.tmp", path) >= 256
+      || !(f = fopen (temp, "wb"))) return -1;
+  fwrite (&h, sizeof (SnapHeader), 1, f);
+  foreach_h (head, &p, resource_hash)
+    foreach (s, head) if (snapshot_stub (s)) h.count += snapshot_record (f, s);
+  fseek (f, 0, SEEK_SET); fwrite (&h, sizeof (SnapHeader), 1, f);
+  if (fclose (f) || rename (temp, path)) { remove (temp); return -1; }
+  return h.count;
+}
+
+void snapshot_free () {
+  if (snap_data) {
+    file_unmap (snap_data, snap_length); free (snap_entries);
+    hash_free (snap_hash); snap_data = NULL;
+  }
+}
+
+// are the strings of a record NUL terminated within the record?
+int snapshot_strings (char *s, SnapRecord *r) {
+  char *end = s + r->strings; uint32_t i;
+  if (r->items > r->strings) return 0;
+  for (i = 0; i < r->items + 3; i++)
+    if (!(s = memchr (s, 0, end - s))) return 0; else s++;
+  return 1;
+}
+
+int snapshot_load (const char *path, DepFunc dep) {
+  SnapHeader *h; char *data, *end; int i;
+  snapshot_free ();
+  if (!(data = file_map (path, &snap_length))) return 0;
+  h = (SnapHeader *)data; end = data + snap_length;
+  if (snap_length < sizeof (SnapHeader) || h->magic != SNAPSHOT_MAGIC) {
+    file_unmap (data, snap_length); return 0;
+  }
+  snap_data = data; snap_dep = dep;
+  h->count = min (h->count, (snap_length - sizeof (SnapHeader))
+		  / sizeof (SnapRecord));
+  snap_entries = calloc (h->count, sizeof (SnapEntry));
+  snap_hash = new_string_hash (16, snap_key);
+  hash_reserve (snap_hash, h->count); // the size is a power of two
+  data += sizeof (SnapHeader);
+  for (i = 0; i < h->count; i++) {
+    SnapEntry *e = snap_entries+i; SnapRecord *r = (SnapRecord *)data;
+    if (end - data < sizeof (SnapRecord) || r->size > end - data
+	|| r->size < sizeof (SnapRecord) || r->size & 7
+	|| (uint64_t)r->strings + r->length
+	> r->size - sizeof (SnapRecord)
+	|| !snapshot_strings (data + sizeof (SnapRecord), r)) break;
+    e->r = r; e->uri = data + sizeof (SnapRecord);
+    e->etag = next_string (e->uri); e->modified = next_string (e->etag);
+    e->items = next_string (e->modified);
+    e->doc = e->uri + r->strings;
+    hash_put (snap_hash, e); data += r->size;
+  } return h->count = i;
+}
+
+void snapshot_roots () { int i; SnapHeader *h = (SnapHeader *)snap_data;
+  if (!snap_data) return;
+  for (i = 0; i < h->count; i++) { SnapEntry *e = snap_entries+i;
+    if (e->r->type == SE_DeviceCapability)
+      get_resource (NULL, e->r->type, e->uri, e->r->all);
+  }
+}
+
+SnapEntry *snapshot_entry (Stub *s) { char uri[192];
+  if (!snap_data) return NULL;
+  stub_uri (uri, s); return hash_get (snap_hash, uri);
+}
+
+int snapshot_find (Stub *s) { SnapEntry *e = snapshot_entry (s);
+  if (e && e->r->type == resource_type (s)) {
+    s->status = -1; insert_event (s, RESOURCE_RESTORE, 0); return 1;
+  } return 0;
+}
+
+void *snapshot_object (SnapEntry *e) { int type; void *obj;
+  if (obj = se_exi_decode (e->doc, e->r->length, &type)) {
+    if (type == e->r->type) return obj;
+    free_se_object (obj, type);
+  } return NULL;
+}
+
+// rebuild a List object from the List item records
+int snapshot_list (Stub *s, SnapEntry *e, void *obj) {
+  List **list = se_list_field (obj, s->base.info), *items = NULL;
+  char *item = e->items; int i; void *x; List *l;
+  for (i = 0; i < e->r->items; i++, item = next_string (item)) {
+    SnapEntry *t = hash_get (snap_hash, item);
+    if (!t || !(x = snapshot_object (t))) {
+      foreach (l, items) free_se_object (l->data, s->base.info->type);
+      free_list (items); return 0;
+    } items = list_insert (items, x);
+  } *list = list_reverse (items);
+  if (se_type_is_a (s->base.type, SE_SubscribableList)) {
+    SE_SubscribableList_t *sl = obj; sl->all = sl->results = i;
+  } else { SE_List_t *sl = obj; sl->all = sl->results = i; }
+  return 1;
+}
+
+void snapshot_restore (Stub *s) {
+  SnapEntry *e = snapshot_entry (s); void *obj = NULL; time_t now = se_time ();
+  if (e && (obj = snapshot_object (e))
+      && (!s->base.info || snapshot_list (s, e, obj))) {
+    SnapRecord *r = e->r;
+    s->base.time = r->time; s->poll_rate = r->poll_rate; s->all = r->all;
+    s->etag = *e->etag? strdup (e->etag) : NULL;
+    s->modified = *e->modified? strdup (e->modified) : NULL;
+    s->status = 200;
+    if (s->base.info) list_object (s, obj, snap_dep, "", NULL);
+    else update_existing (s, obj, snap_dep);
+    // revalidate in the background
+    s->poll_next = r->poll_next > now? r->poll_next
+      : now + rand () % (max (s->poll_rate, 1));
+    insert_event (s, RESOURCE_POLL, s->poll_next);
+  } else {
+    if (obj) free_se_object (obj, resource_type (s));
+    s->status = 0; update_resource (s);
+  }
+}
+
+#endif
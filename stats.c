@@ -0,0 +1,187 @@
+// Copyright (c) 2018 Electric Power Research Institute, Inc.
+// author: Mark Slicker <mark.slicker@gmail.com>
+
+#include <stdio.h>
+#include <stdint.h>
+
+/** @defgroup stats Statistics
+
+    Provides low overhead latency histograms for the stages of the client
+    (event polling, HTTP, parsing and output, TLS, dependency completion, and
+    schedule updates). The histograms are log-linear (HDR style), each power
+    of two nanoseconds is divided into 8 buckets so a recorded latency is
+    within 12.5% of its true value. Statistics are kept per thread and are
+    only collected when @ref se_stats is set.
+    @{
+*/
+
+#ifndef THREAD_LOCAL
+#define THREAD_LOCAL __thread
+#endif
+
+enum StatStage {
+  STAT_EVENT_POLL,       /**< time blocked in event_poll before a wakeup */
+  STAT_HTTP_RECEIVE,     /**< http_receive (request/status line, headers) */
+  STAT_HTTP_RESPONSE,    /**< client request queued to status line received */
+  STAT_HTTP_SERVE,       /**< server request received to response written */
+  STAT_PARSE_XML,        /**< parse_doc for an XML document */
+  STAT_PARSE_EXI,        /**< parse_doc for an EXI document */
+  STAT_OUTPUT_XML,       /**< output_doc for an XML document */
+  STAT_OUTPUT_EXI,       /**< output_doc for an EXI document */
+  STAT_TLS_HANDSHAKE,    /**< ssl_handshake */
+  STAT_TLS_READ,         /**< ssl_read */
+  STAT_TLS_WRITE,        /**< ssl_write */
+  STAT_DEP_COMPLETE,     /**< dep_complete, including the fan out */
+  STAT_UPDATE_SCHEDULE,  /**< update_schedule */
+  STAT_STAGES
+};
+
+/** @brief Enable the collection of statistics. */
+extern int se_stats;
+
+/** @brief Start timing a stage.
+    @returns the start time, or 0 if statistics are not enabled
+*/
+#define stat_begin() (se_stats? stat_now () : 0)
+
+/** @brief Stop timing a stage, record the latency from the start time.
+    @param stage is a StatStage value
+    @param t is the start time returned by @ref stat_begin
+*/
+#define stat_end(stage, t) if (t) stat_record (stage, stat_now () - (t))
+
+/** @brief Return the monotonic time in nanoseconds. */
+int64_t stat_now ();
+
+/** @brief Record a latency for a stage.
+    @param stage is a StatStage value
+    @param ns is the latency in nanoseconds
+*/
+void stat_record (int stage, int64_t ns);
+
+/** @brief Return a percentile of the latencies recorded for a stage.
+    @param stage is a StatStage value
+    @param p is the percentile (0 - 100)
+    @returns the latency in nanoseconds
+*/
+int64_t stat_percentile (int stage, double p);
+
+/** @brief Return the number of latencies recorded for a stage.
+    @param stage is a StatStage value
+*/
+uint64_t stat_count (int stage);
+
+/** @brief Print a summary of the statistics (count, mean, percentiles).
+    @param f is the output file
+*/
+void stats_print (FILE *f);
+
+/** @brief Write the histograms to a binary file.
+
+    The file is a header (magic number, number of stages, number of buckets)
+    followed by a record for each stage, the stage name (16 bytes), count,
+    sum, and max (64 bit), and the bucket counts (32 bit). The file is written
+    to a temporary file that then replaces the file.
+    @param path is the name of the file
+    @returns 1 on success, 0 if the file could not be written
+*/
+int stats_dump (const char *path);
+
+/** @brief Clear the statistics of the calling thread. */
+void stats_reset ();
+
+/** @} */
+
+#ifndef HEADER_ONLY
+
+#include <time.h>
+#include <inttypes.h>
+
+#define STAT_SUB_BITS 3
+#define STAT_SUB (1 << STAT_SUB_BITS) // buckets per power of two
+#define STAT_RANGE 40 // latencies up to 2^40 ns (~18 minutes)
+#define STAT_BUCKETS ((STAT_RANGE - STAT_SUB_BITS + 1) * STAT_SUB)
+#define STATS_MAGIC 0x31535453 // "STS1"
+
+typedef struct {
+  uint64_t count, sum, max;
+  uint32_t buckets[STAT_BUCKETS];
+} Histogram;
+
+const char * const stat_names[] = {
+  "event_poll", "http_receive", "http_response", "http_serve", "parse_xml",
+  "parse_exi", "output_xml", "output_exi", "tls_handshake", "tls_read",
+  "tls_write", "dep_complete", "update_schedule"
+};
+
+int se_stats = 0;
+THREAD_LOCAL Histogram se_histograms[STAT_STAGES];
+
+int64_t stat_now () { struct timespec t;
+  clock_gettime (CLOCK_MONOTONIC, &t);
+  return t.tv_sec * 1000000000LL + t.tv_nsec;
+}
+
+int stat_bucket (uint64_t v) { int msb;
+  if (v < STAT_SUB) return v;
+  msb = 63 - __builtin_clzll (v);
+  if (msb >= STAT_RANGE) return STAT_BUCKETS-1;
+  return (msb - STAT_SUB_BITS + 1) * STAT_SUB
+    + ((v >> (msb - STAT_SUB_BITS)) & (STAT_SUB-1));
+}
+
+// the upper bound of the values in a bucket
+uint64_t stat_bound (int i) { int k = i / STAT_SUB;
+  if (k == 0) return i;
+  return ((uint64_t)(STAT_SUB + i % STAT_SUB + 1) << (k-1)) - 1;
+}
+
+void stat_record (int stage, int64_t ns) {
+  Histogram *h = &se_histograms[stage];
+  if (ns < 0) ns = 0;
+  h->count++; h->sum += ns; h->max = max (h->max, ns);
+  h->buckets[stat_bucket (ns)]++;
+}
+
+int64_t stat_percentile (int stage, double p) {
+  Histogram *h = &se_histograms[stage]; uint64_t n = 0, rank; int i;
+  if (!h->count) return 0;
+  rank = h->count * p / 100; rank = max (rank, 1);
+  for (i = 0; i < STAT_BUCKETS; i++)
+    if ((n += h->buckets[i]) >= rank) break;
+  return min (stat_bound (i), h->max);
+}
+
+uint64_t stat_count (int stage) { return se_histograms[stage].count; }
+
+void stats_print (FILE *f) { int i;
+  fprintf (f, "%-16s %10s %10s %10s %10s %10s %10s\n", "stage (us)", "count",
+	   "mean", "p50", "p90", "p99", "max");
+  for (i = 0; i < STAT_STAGES; i++) { Histogram *h = &se_histograms[i];
+    if (!h->count) continue;
+    fprintf (f, "%-16s %10" PRIu64 " %10.1f %10.1f %10.1f %10.1f %10.1f\n",
+	     stat_names[i], h->count, h->sum / 1000.0 / h->count,
+	     stat_percentile (i, 50) / 1000.0, stat_percentile (i, 90) / 1000.0,
+	     stat_percentile (i, 99) / 1000.0, h->max / 1000.0);
+  }
+}
+
+int stats_dump (const char *path) {
+  uint32_t header[3] = {STATS_MAGIC, STAT_STAGES, STAT_BUCKETS};
+  char temp[256]; FILE *f; int i;
+  if (snprintf (temp, 256, "%s.tmp", path) >= 256
+      || !(f = fopen (temp, "wb"))) return 0;
+  fwrite (header, sizeof (header), 1, f);
+  for (i = 0; i < STAT_STAGES; i++) { char name[16] = {0};
+    strncpy (name, stat_names[i], 15); fwrite (name, 16, 1, f);
+    fwrite (&se_histograms[i], sizeof (Histogram), 1, f);
+  }
+  if (fclose (f) || rename (temp, path)) { remove (temp); return 0; }
+  return 1;
+}
+
+void stats_reset () {
+  memset (se_histograms, 0, sizeof (se_histograms));
+}
+
+#endif
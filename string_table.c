@@ -3,48 +3,92 @@
 
 #include <stdlib.h>
 
+/* EXI string tables, the local tables (one per element name) are hashed by
+   the name pointer, the strings of a table are indexed by a hash of the
+   string built as needed by find_string. */
+
+#define LOCAL_TABLES 64 // must be a power of two
+
 typedef struct _StringTable {
-  struct _StringTable *next, *prev;
+  struct _StringTable *next; // next table in the hash bucket
   int length, index;
+  int hashed, size; // number of strings indexed, size of the index
   const void *name;
-  char *strings[];
+  int *hash; // string index + 1, 0 for an empty slot
+  char **strings;
 } StringTable;
 
-StringTable *find_table (StringTable *t, const void *name) {
+#define table_hash(name) \
+  ((((uintptr_t)(name) >> 3) * 2654435761u) & (LOCAL_TABLES-1))
+
+StringTable **new_local_tables () {
+  return calloc (LOCAL_TABLES, sizeof (StringTable *));
+}
+
+StringTable *find_table (StringTable **local, const void *name) {
+  StringTable *t = local[table_hash (name)];
   while (t) {
     if (t->name == name) return t;
     t = t->next;
   } return NULL;
 }
 
-int find_string (StringTable *t, char *s) { int i;
-  for (i = 0; i < t->index; i++)
-    if (streq (s, t->strings[i])) return i;
-  return -1;
+StringTable *new_string_table (const void *name, int length) {
+  StringTable *n = calloc (1, sizeof (StringTable));
+  n->name = name; n->length = length;
+  n->strings = malloc (sizeof (char *) * length);
+  return n;
 }
 
-StringTable *new_string_table (StringTable *t, const void *name, int length) {
-  StringTable *n = malloc (sizeof (StringTable) + sizeof (char *) * length);
-  n->name = name; n->length = length; n->index = 0;
-  n->prev = NULL; n->next = t;
-  if (t) t->prev = n;
-  return n;
+StringTable *new_local_table (StringTable **local, const void *name) {
+  StringTable *t = new_string_table (name, 8), **head;
+  head = &local[table_hash (name)]; t->next = *head;
+  return *head = t;
+}
+
+// index a string unless an equal string is already indexed
+void hash_string (StringTable *t, int i) {
+  unsigned h, mask = t->size - 1; int j;
+  for (h = name_hash (t->strings[i]) & mask; j = t->hash[h];
+       h = (h+1) & mask)
+    if (streq (t->strings[i], t->strings[j-1])) return;
+  t->hash[h] = i+1;
 }
 
-StringTable *add_string (StringTable *head, StringTable *t, char *s) {
-  if (t && t->index == t->length) {
+void index_strings (StringTable *t) {
+  if (t->index*2 > t->size) {
+    free (t->hash); t->hashed = 0;
+    while (t->index*2 > t->size) t->size = t->size? t->size << 1 : 16;
+    t->hash = calloc (t->size, sizeof (int));
+  }
+  while (t->hashed < t->index) hash_string (t, t->hashed++);
+}
+
+int find_string (StringTable *t, char *s) {
+  unsigned h, mask; int i;
+  if (t->hashed < t->index) index_strings (t);
+  if (!t->size) return -1; mask = t->size - 1;
+  for (h = name_hash (s) & mask; i = t->hash[h]; h = (h+1) & mask)
+    if (streq (s, t->strings[i-1])) return i-1;
+  return -1;
+}
+
+void add_string (StringTable *t, char *s) {
+  if (t->index == t->length) {
     t->length <<= 1;
-    t = realloc (t, sizeof (StringTable) + sizeof (char *) * t->length);
-    if (t->prev) t->prev->next = t; else head = t;
-    if (t->next) t->next->prev = t;
+    t->strings = realloc (t->strings, sizeof (char *) * t->length);
   }
   t->strings[t->index++] = s;
-  return head;
 }
 
-void free_tables (StringTable *t) {
-  while (t) {
-    StringTable *n = t->next;
-    free (t); t = n;
-  }
+void free_string_table (StringTable *t) {
+  if (t) { free (t->hash); free (t->strings); free (t); }
+}
+
+void free_local_tables (StringTable **local) { int i;
+  if (!local) return;
+  for (i = 0; i < LOCAL_TABLES; i++) {
+    StringTable *t = local[i], *n;
+    while (t) { n = t->next; free_string_table (t); t = n; }
+  } free (local);
 }
@@ -1,67 +1,224 @@
-char notification_uri[64];
-Acceptor *n_acceptor;
-int n_secure = 1;
+/* Each thread (reactor) listens for notifications on a port of its own,
+   the IDs of the notificationURIs are only known to the thread that
+   registered them. */
+THREAD_LOCAL char notification_uri[64];
+THREAD_LOCAL Acceptor *n_acceptor;
+char *n_interface = NULL; int n_ipv4 = 0, n_secure = 1;
 
-void subscribe_init (char *name, int ipv4, int secure) {
+#define NOTIFY_ARENA 8192
+
+/* Each subscribed Stub is registered under an ID, the notificationURI of
+   the subscription is "/notify/<id>" so that a notification is dispatched
+   to its Stub without looking up the subscribed resource. A free ID holds
+   the next free ID tagged with the low bit. ID 0 is not used. */
+THREAD_LOCAL Stub **notify_stubs = NULL;
+THREAD_LOCAL uint32_t notify_count = 1, notify_size = 0, notify_free = 0;
+
+uint32_t notify_register (Stub *s) { uint32_t id;
+  if (s->notify_id) return s->notify_id;
+  if (id = notify_free)
+    notify_free = (uintptr_t)notify_stubs[id] >> 1;
+  else {
+    if (notify_count >= notify_size) {
+      notify_size = notify_size? notify_size << 1 : 64;
+      notify_stubs = realloc (notify_stubs, notify_size * sizeof (Stub *));
+    } id = notify_count++;
+  } notify_stubs[id] = s; return s->notify_id = id;
+}
+
+void notify_release (Stub *s) { uint32_t id = s->notify_id;
+  if (!id) return;
+  notify_stubs[id] = (Stub *)((uintptr_t)notify_free << 1 | 1);
+  notify_free = id; s->notify_id = 0;
+}
+
+Stub *notify_stub (char *path) { int id; Stub *s;
+  if (strncmp (path, "/notify/", 8) || !number (&id, path+8)
+      || !id || id >= notify_count) return NULL;
+  s = notify_stubs[id];
+  return (uintptr_t)s & 1? NULL : s;
+}
+
+// notifications are parsed into an arena, the resources kept are copied
+void notifier_accept () {
+  se_arena (se_accept (n_acceptor, n_secure), NOTIFY_ARENA);
+}
+
+// listen for notifications on the calling thread
+void notify_listen () {
   Uri uri = {0}; Address host;
   char zero[16] = {0}; int port;
-  if (ipv4) ipv4_address (&host, 0, 0);
+  if (n_ipv4) ipv4_address (&host, 0, 0);
   else ipv6_address (&host, zero, 0);
   n_acceptor = net_listen (&host);
-  n_secure = secure;
   net_local (&host, n_acceptor);
   port = address_port (&host);
-  interface_address (&host, name, ipv4);
+  interface_address (&host, n_interface, n_ipv4);
   set_port (&host, port);
-  uri.scheme = secure? "https" : "http";
+  uri.scheme = n_secure? "https" : "http";
   uri.host = &host;
   uri.path = "/notify";
   write_uri (notification_uri, &uri);
-  printf ("subscribe_init: uri = %s\n", notification_uri);
-  se_accept (n_acceptor, secure);
+  log_info ("subscribe_init: uri = %s\n", notification_uri);
+  notifier_accept ();
+}
+
+void subscribe_init (char *name, int ipv4, int secure) {
+  n_interface = name; n_ipv4 = ipv4; n_secure = secure;
+  notify_listen ();
+}
+
+// a reactor thread listens if subscribe_init was called on the main thread
+void subscribe_thread () {
+  if (n_interface) notify_listen ();
 }
 
 void subscribe (Stub *s, char *uri) {
-  if (!s->subscribed) {
-    SE_Subscription_t sub = {0};
+  if (!s->subscribed) { char notify[80];
+    SE_Subscription_t sub = {0}; s->subscribing = 1;
+    sprintf (notify, "%s/%u", notification_uri, notify_register (s));
     sub.subscribedResource = resource_name (s);
     sub.encoding = 0; // XML
     sprintf (sub.level, "-%s", se_schema.schemaId);
     sub.limit = 10;
-    sub.notificationURI = notification_uri;
+    sub.notificationURI = notify;
     se_post (s->conn, &sub, SE_Subscription, uri);
     // use context for updating the subscribed field
     set_request_context (s->conn, s);
   }
 }
 
-int match_notifier (void *conn, void *lfdi) {
-  if (http_client (conn)) {
-    printf ("match_notifier: "); print_bytes (lfdi, 20);
-    printf (" "); print_bytes (se_lfdi (conn), 20); printf ("\n");
-    return memcmp (se_lfdi (conn), lfdi, 20) == 0;
-  } return 0;
+/* Subscription-first retrieval (see subscribe_all), the subscriptions to a
+   server are queued and sent together once the SubscriptionList of the
+   server is known and the current events have been processed. */
+#define SUBSCRIBE_FLUSH (EVENT_NEW+19)
+
+typedef struct _Subscriber {
+  struct _Subscriber *next;
+  void *conn; char *href; // SubscriptionList of the server
+  List *pending; // Stubs to subscribe to
+} Subscriber;
+
+THREAD_LOCAL Subscriber *subscribers = NULL;
+
+Subscriber *get_subscriber (void *conn) { Subscriber *v;
+  foreach (v, subscribers) if (v->conn == conn) return v;
+  v = type_alloc (Subscriber); v->conn = conn;
+  v->next = subscribers; return subscribers = v;
+}
+
+void subscribe_later (Subscriber *v) {
+  if (v->href && v->pending) insert_event (v, SUBSCRIBE_FLUSH, 0);
+}
+
+/** @brief Set the SubscriptionList used for the subscriptions to a server.
+    @param conn is a pointer to the SeConnection of the server
+    @param href is the SubscriptionListLink of the client EndDevice
+*/
+void subscription_list (void *conn, char *href) {
+  Subscriber *v = get_subscriber (conn);
+  if (!v->href) { v->href = strdup (href); subscribe_later (v); }
+}
+
+// send the queued subscriptions of a server together
+void subscribe_flush (Subscriber *v) { List *l;
+  se_reopen (v->conn); http_cork (v->conn, 1);
+  foreach (l, v->pending) subscribe (l->data, v->href);
+  http_cork (v->conn, 0); free_list (v->pending); v->pending = NULL;
+}
+
+#define subscribable_as(name)						\
+  if (se_type_is_a (type, SE_##name))					\
+    return ((SE_##name##_t *)obj)->subscribable;
+
+int resource_subscribable (Stub *s) {
+  void *obj = resource_data (s); int type = resource_type (s);
+  if (!obj) return 0;
+  subscribable_as (SubscribableList);
+  subscribable_as (SubscribableResource);
+  subscribable_as (RespondableSubscribableIdentifiedObject);
+  return 0;
+}
+
+#undef subscribable_as
+
+/** @brief Subscribe to a completed resource under the subscription-first
+    policy.
+
+    The resource is subscribed to if it is subscribable and not an item of
+    a subscribable List (the List notifications include its items).
+    @param s is a pointer to a Stub
+*/
+void auto_subscribe (Stub *s) { Subscriber *v; Stub *t; int i;
+  if (!subscribe_all || s->subscribed || s->subscribing || !notification_uri[0]
+      || !resource_subscribable (s)) return;
+  foreach_dep (t, i, &s->deps)
+    if (t->base.info && resource_subscribable (t)) return;
+  v = get_subscriber (s->conn); s->subscribing = 1;
+  if (!v->pending) { v->pending = list_insert (NULL, s); subscribe_later (v); }
+  else v->pending = list_insert (v->pending, s);
+}
+
+// remove a Stub that is to be freed from the subscriptions
+void subscribe_cancel (Stub *s) {
+  if (s->subscribing) { Subscriber *v = get_subscriber (s->conn);
+    v->pending = list_delete (v->pending, s);
+  } notify_release (s);
+}
+
+/* The Stub a notification is for. The notification URI identifies the
+   subscription (target), a notification for another resource or from a
+   notifier that is not the server of the resource is looked up by the
+   subscribed resource instead. */
+Stub *notify_target (void *conn, SE_Notification_t *n, Stub *target) {
+  Stub *s, *head; char *path; void *client = NULL;
+  if (target && streq (n->subscribedResource, resource_name (target))
+      && (!conn_secure (conn)
+	  || !memcmp (se_lfdi (conn), se_lfdi (target->conn), 20)))
+    return target;
+  if (!(path = se_path (conn, n->subscribedResource))) return NULL;
+  if (conn_secure (conn)) {
+    client = find_notifier (se_lfdi (conn));
+    s = find_stub (&head, path, client);
+  } else if (s = find_resource (path)) client = s->conn;
+  return client? s : NULL;
+}
+
+// a notification that carries a representation of the subscribed resource
+int representation (SE_Notification_t *n) {
+  return !n->status && se_exists (n, Resource) && n->subscribedResource;
+}
+
+void *subscribed_key (void *data) {
+  return ((SE_Notification_t *)data)->subscribedResource;
+}
+
+// the last notification with a representation of each subscribed resource
+HashTable *latest_notifications (List *l) {
+  HashTable *ht = new_string_hash (16, subscribed_key);
+  for (; l; l = l->next)
+    if (representation (l->data)) hash_put (ht, l->data);
+  return ht;
+}
+
+// a later notification in the list carries a newer representation
+int superseded (HashTable *latest, SE_Notification_t *n) {
+  return representation (n) && hash_get (latest, n->subscribedResource) != n;
 }
 
-void notification (void *conn, SE_Notification_t *n, DepFunc dep) {
-  Stub *s, *head; Uri128 buf; Uri *uri = &buf.uri; void *client;
-  if (http_parse_uri (&buf, conn, n->subscribedResource, 127)) {
-    if (conn_secure (conn)) {
-      client = find_conn (match_notifier, se_lfdi (conn));
-      s = find_stub (&head, uri->path, client);
-    } else if (s = find_resource (uri->path))
-      client = s->conn;
-    if (!(client && s)) goto close; 
+void notification (void *conn, SE_Notification_t *n, DepFunc dep,
+		   Stub *target) {
+  Stub *s;
+  if (s = notify_target (conn, n, target)) {
     switch (n->status) {
     case 0: // Default Status
       if (se_exists (n, Resource)) {
 	int rt = resource_type (s);
 	if (element_type (rt, &se_schema) == n->Resource.type) {
-	  void *obj = n->Resource.data;
+	  void *obj = copy_se_object (n->Resource.data, n->Resource.type);
 	  s->base.time = time (NULL);
-	  if (s->base.info) list_object (s, obj, dep);
+	  if (s->base.info) list_object (s, obj, dep, NULL, NULL);
 	  else update_existing (s, obj, dep);
-	  n->Resource.data = NULL;
 	}
       } break;
     case 2: // Subscription canceled, resource moved
@@ -71,37 +228,45 @@ void notification (void *conn, SE_Notification_t *n, DepFunc dep) {
     case 1: // Subscription canceled, no additional information
     case 3: // Subscription canceled, resource definition changed
       // (e.g., a new version of IEEE 2030.5)
-      s->subscribed = 0; break;
+      subscription_lost (s); break;
     case 4: // Subscription canceled, resource deleted
       insert_event (s, RESOURCE_REMOVE, 0);
     } return;
-  } close: conn_close (conn);
+  } conn_close (conn);
 }
 
 void process_notifications (void *conn, DepFunc dep) {
-  char *path; void *obj; int type; List *l;
+  char *path; void *obj; int type; List *l; Stub *s;
   SE_NotificationList_t *nl;
   switch (se_receive (conn)) {
   case HTTP_POST:
     path = http_path (conn);
-    printf ("process_notification %s\n", path);
+    log_info ("process_notification %s\n", path);
     if (obj = se_body (conn, &type)) {
-      print_se_object (obj, type); printf ("\n");
-      if (streq (path, "/notify")) {
+      if (log_enabled (LOG_INFO)) log_se_object (obj, type);
+      s = notify_stub (path);
+      if (s || streq (path, "/notify")) {
 	switch (type) {
 	case SE_NotificationList: nl = obj;
-	  foreach (l, nl->Notification)
-	    notification (conn, l->data, dep);
+	  // only the last representation of a resource is applied
+	  if (nl->Notification && nl->Notification->next) {
+	    HashTable *latest = latest_notifications (nl->Notification);
+	    foreach (l, nl->Notification)
+	      if (!superseded (latest, l->data))
+		notification (conn, l->data, dep, s);
+	    hash_free (latest);
+	  } else if (nl->Notification)
+	    notification (conn, nl->Notification->data, dep, s);
 	  break;
 	case SE_Notification:
-	  notification (conn, obj, dep); break;
+	  notification (conn, obj, dep, s); break;
 	} http_respond (conn, 204);
-      } free_se_object (obj, type);
+      } free_se_body (conn);
     }
   }
 }
 
 void accept_notifier (void *conn) {
-  printf ("accept_notifier\n");
-  se_accept (n_acceptor, n_secure);
+  log_info ("accept_notifier\n");
+  notifier_accept ();
 }
@@ -5,6 +5,8 @@
 # build targets, used by build.sh
 
 tls_lib="openssl" # choose tls library ( openssl wolfssl )
+event_backend="epoll" # choose event backend ( epoll io_uring )
+content_coding="none" # choose content coding support ( none zlib )
 
 openssl_libs=( -lssl -lcrypto -lpthread -ldl )
 #flags+=( -Wno-format -Wno-unused-result -Wunused-variable -Wreturn-type -Wunused-but-set-variable -Wformat -Wformat-security )
@@ -27,13 +29,65 @@ if [[ $tls_lib == "openssl" ]]; then
 else
     se_core_flags=( -DWOLFSSL_TLS )
 fi
-se_core_flags+=( -fPIC )
+se_core_flags+=( -fPIC -D_GNU_SOURCE )
+if [[ $event_backend == "io_uring" ]]; then
+    se_core_flags+=( -DIO_URING ) # requires Linux 6.0 or later
+    se_flags+=( -DIO_URING ) # applications linked with se_core.o
+fi
+if [[ $content_coding == "zlib" ]]; then
+    se_core_flags+=( -DHTTP_ZLIB )
+    tls_libs+=( -lz )
+fi
 
 clean_build () {
     rm -r build
 }
 
+# training workload for the pgo build (see build.sh), the parse/output
+# benchmark over the settings corpus and the data structure benchmarks
+pgo_train () {
+    if [ -x $build_dir/doc_bench ]; then
+	$build_dir/doc_bench 200 settings > /dev/null
+    fi
+    if [ -x $build_dir/bench ]; then
+	$build_dir/bench 100000 > /dev/null
+    fi
+}
+
+# run the benchmarks of each build profile that has been built and print the
+# results side by side (./build.sh compare)
+compare_profiles=( build build-perf build-perf-pgo )
+compare_build () {
+    local dirs=() d
+    for d in "${compare_profiles[@]}"; do
+	if [ -x $d/doc_bench ] && [ -x $d/bench ]; then
+	    dirs+=( $d )
+	fi
+    done
+    for d in "${dirs[@]}"; do
+	# name|value for each result
+	{ $d/doc_bench 200 settings | awk '$4 == "MB/s" {
+	      print $1 " " $2 " (MB/s)|" $3 }'
+	  $d/bench 100000 | awk 'NF > 7 && $(NF-4) == "ops/s" && $(NF-6) == 100000 {
+	      n = $1; for (i = 2; i < NF-6; i++) n = n " " $i
+	      print n " (ops/s)|" $(NF-5) }'
+	} > $d/compare.out
+    done
+    awk -F'|' -v profiles="${dirs[*]}" '
+	!($1 in value) { name[++n] = $1 }
+	{ value[$1] = value[$1] sprintf ("%16s", $2) }
+	END { printf "%-28s", "benchmark"; m = split (profiles, p, " ")
+	      for (i = 1; i <= m; i++) printf "%16s", p[i]; printf "\n"
+	      for (i = 1; i <= n; i++) printf "%-28s%s\n", name[i], value[name[i]] }
+    ' ${dirs[@]/%//compare.out}
+}
+
+se_core_libs=( ${tls_libs[@]} )
 se_objects=( se_core.o )
 se_libs=( ${tls_libs[@]} )
-se_targets=( client_test csip_test )
-targets=( schema_gen se )
+se_targets=( client_test csip_test bench schedule_bench )
+doc_bench_flags=( ${se_core_flags[@]} )
+doc_bench_libs=( ${tls_libs[@]} )
+load_server_flags=( ${se_core_flags[@]} )
+load_server_libs=( ${tls_libs[@]} )
+targets=( schema_gen se libse_core.so doc_bench load_server )
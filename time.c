@@ -20,11 +20,26 @@ void set_time (SE_Time_t *tm);
 */
 int64_t se_time ();
 
+/** @brief The virtual time, when non-zero @ref se_time returns this time
+    rather than the system time. A simulation (e.g. a benchmark of the
+    schedule) advances the clock itself.
+*/
+extern int64_t se_virtual_time;
+
+/** @brief Get the current (adjusted) time in milliseconds.
+
+    Under record/replay (see @ref replay) the time has the resolution of
+    @ref se_time so that a replay makes the same decisions.
+    @returns the time of @ref se_time in milliseconds
+*/
+int64_t se_time_ms ();
+
 /** @} */
 
 #include <time.h>
 
 int se_time_offset = 0;
+int64_t se_virtual_time = 0;
 
 void set_time (SE_Time_t *tm) {
   se_time_offset = tm->currentTime - time (NULL);
@@ -33,5 +48,13 @@ void set_time (SE_Time_t *tm) {
 }
 
 int64_t se_time () {
-  return time (NULL) + se_time_offset;
+  if (se_virtual_time) return se_virtual_time;
+  return replay_time (time (NULL) + se_time_offset);
+}
+
+int64_t se_time_ms () { struct timespec t;
+  if (se_virtual_time) return se_virtual_time * 1000;
+  if (replay_mode ()) return se_time () * 1000;
+  clock_gettime (CLOCK_REALTIME, &t);
+  return (t.tv_sec + se_time_offset) * 1000LL + t.tv_nsec / 1000000;
 }
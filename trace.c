@@ -0,0 +1,330 @@
+// Copyright (c) 2018 Electric Power Research Institute, Inc.
+// author: Mark Slicker <mark.slicker@gmail.com>
+
+/** @defgroup trace Trace
+
+    Traces the retrieval of resources, to find why a device is slow to reach
+    a valid schedule. Each response to a GET request adds a span with the
+    times the request was queued and sent, the status line of the response
+    was received, the response was parsed, and the Stub was completed (see
+    @ref dep_complete). The parent of a span is the span of the response
+    being processed when the resource was requested, or the latest span of
+    a dependent for a request made outside of a response (e.g. a poll), so
+    the spans follow the retrieval down from the DeviceCapability. The
+    spans are thread local, up to TRACE_MAX are kept.
+    @{
+*/
+
+#ifndef TRACE_MAX
+#define TRACE_MAX 65536
+#endif
+
+/** @brief Trace the retrieval of resources (off by default). */
+extern int retrieve_trace;
+
+/** @brief Record the request of a Stub.
+
+    Called with each request when @ref retrieve_trace is set.
+    @param s is a pointer to the Stub
+*/
+void trace_request (Stub *s);
+
+/** @brief Add a span for the response to a GET request of a Stub.
+
+    Called by @ref process_http when @ref retrieve_trace is set, the span is
+    the one being processed until @ref trace_end.
+    @param s is a pointer to the Stub
+    @param conn is a pointer to the SeConnection of the response
+*/
+void trace_response (Stub *s, void *conn);
+
+/** @brief End the processing of a response. */
+void trace_end ();
+
+/** @brief Record the completion of a Stub.
+
+    Called by @ref dep_complete when @ref retrieve_trace is set.
+    @param s is a pointer to the Stub
+*/
+void trace_complete (Stub *s);
+
+/** @brief Forget a Stub that is removed.
+
+    Called by @ref remove_stub when @ref retrieve_trace is set, so that a new
+    Stub at the same address starts without the state of the old one. The
+    spans of the Stub are kept.
+    @param s is a pointer to the Stub
+*/
+void trace_remove (Stub *s);
+
+/** @brief Forget a connection that is cleaned up.
+
+    Called by @ref cleanup_http when @ref retrieve_trace is set. The next
+    response on the connection looks up its server again by origin.
+    @param conn is a pointer to the SeConnection
+*/
+void trace_close (void *conn);
+
+/** @brief Find and print the critical path of a device schedule.
+
+    The path ends with the response that was parsed last among the
+    requirements of the EndDevice, and follows the parent spans back to the
+    DeviceCapability, or to the first span after the previous schedule of
+    the device. For each request of the path the time from the parent
+    response (gap), the time held back by the pipeline depth (wait), the
+    time to the status line (rtt), and the time to receive and parse the
+    response (recv) are printed in milliseconds, then the totals for each
+    server. The first request to a server includes the connection setup in
+    its rtt. The spans of the path are marked as critical in the saved
+    trace.
+    @param edev is a pointer to the EndDevice Stub of the schedule
+    @param f is the output file
+*/
+void trace_schedule (Stub *edev, FILE *f);
+
+/** @brief Save the trace in the Chrome trace event format.
+
+    Each span is a row of a waterfall grouped by server, with slices for the
+    queued, response, receive and complete phases. The schedules are
+    instant events. The file can be opened with chrome://tracing or
+    Perfetto.
+    @param name is the name of the JSON file
+    @returns 1 on success, 0 otherwise
+*/
+int trace_save (const char *name);
+
+/** @} */
+
+#ifndef HEADER_ONLY
+
+typedef struct {
+  Stub *stub; // compared only, the Stub may be freed
+  char *name; int type, server, parent, status;
+  int64_t queued, sent, first, parsed, complete;
+  unsigned critical : 1;
+} TraceSpan;
+
+typedef struct {
+  Stub *s; int span; // the latest span of the Stub
+  int cause; // the span processed when the Stub was last requested
+  int mark; // of the requirements of a schedule
+  int64_t scheduled; // the time of the last schedule of an EndDevice
+} TraceStub;
+
+typedef struct {
+  void *conn; char origin[64]; // conn is NULL once cleaned up
+} TraceServer;
+
+typedef struct {
+  int64_t time; char *name;
+} TraceMark;
+
+void *trace_key (void *data) { return &((TraceStub *)data)->s; }
+
+global_hash (trace, int64, 256)
+
+int retrieve_trace = 0;
+THREAD_LOCAL TraceSpan *trace_spans = NULL;
+THREAD_LOCAL TraceServer *trace_servers = NULL;
+THREAD_LOCAL TraceMark *trace_marks = NULL;
+THREAD_LOCAL int trace_count = 0, trace_size = 0, trace_nservers = 0,
+  trace_nmarks = 0, trace_current = -1, trace_stamp = 0;
+
+TraceStub *trace_stub (Stub *s) { TraceStub *ts;
+  if (!trace_hash) trace_init ();
+  if (!(ts = find_trace (&s))) {
+    ts = type_alloc (TraceStub); memset (ts, 0, sizeof (TraceStub));
+    ts->s = s; ts->span = ts->cause = -1; insert_trace (ts);
+  } return ts;
+}
+
+void trace_remove (Stub *s) { TraceStub *ts;
+  if (trace_hash && (ts = delete_trace (&s))) free (ts);
+}
+
+int trace_server (void *conn) { int i; char origin[64];
+  for (i = 0; i < trace_nservers; i++)
+    if (trace_servers[i].conn == conn) return i;
+  se_origin (origin, conn);
+  for (i = 0; i < trace_nservers; i++)
+    if (!trace_servers[i].conn && streq (trace_servers[i].origin, origin)) {
+      trace_servers[i].conn = conn; return i;
+    }
+  if (!(i & 7))
+    trace_servers = realloc (trace_servers, sizeof (TraceServer) * (i + 8));
+  trace_servers[i].conn = conn; strcpy (trace_servers[i].origin, origin);
+  return trace_nservers++;
+}
+
+void trace_close (void *conn) { int i;
+  for (i = 0; i < trace_nservers; i++)
+    if (trace_servers[i].conn == conn) trace_servers[i].conn = NULL;
+}
+
+/* The latest span of a dependent, a List item has no span of its own so the
+   span of its List is used. */
+int trace_parent (Stub *d) { TraceStub *ts; int i;
+  for (i = 0; d && i < 8; d = first_dep (d), i++)
+    if ((ts = find_trace (&d)) && ts->span >= 0) return ts->span;
+  return -1;
+}
+
+void trace_response (Stub *s, void *conn) {
+  TraceSpan *sp; TraceStub *ts; char *query = http_query (conn);
+  if (trace_count == TRACE_MAX) return;
+  if (!trace_hash) trace_init ();
+  if (trace_count == trace_size) {
+    trace_size = trace_size? trace_size << 1 : 256;
+    trace_spans = realloc (trace_spans, sizeof (TraceSpan) * trace_size);
+  }
+  sp = &trace_spans[trace_count]; memset (sp, 0, sizeof (TraceSpan));
+  sp->parsed = stat_now ();
+  http_times (conn, &sp->queued, &sp->sent);
+  sp->first = sp->queued + http_latency (conn);
+  sp->stub = s; sp->type = resource_type (s); sp->status = http_status (conn);
+  sp->server = trace_server (conn);
+  if (query) {
+    sp->name = malloc (strlen (resource_name (s)) + strlen (query) + 2);
+    sprintf (sp->name, "%s?%s", resource_name (s), query);
+  } else sp->name = strdup (resource_name (s));
+  ts = trace_stub (s);
+  sp->parent = ts->cause >= 0? ts->cause : trace_parent (first_dep (s));
+  ts->span = trace_current = trace_count++;
+}
+
+void trace_request (Stub *s) { trace_stub (s)->cause = trace_current; }
+
+void trace_end () { trace_current = -1; }
+
+void trace_complete (Stub *s) { TraceStub *ts;
+  if (trace_hash && (ts = find_trace (&s)) && ts->span >= 0
+      && !trace_spans[ts->span].complete)
+    trace_spans[ts->span].complete = stat_now ();
+}
+
+int64_t span_end (TraceSpan *sp) {
+  return sp->complete? sp->complete : sp->parsed;
+}
+
+// mark a Stub and its requirements
+void trace_mark (Stub *s) { TraceStub *ts = trace_stub (s); List *l;
+  if (ts->mark == trace_stamp) return;
+  ts->mark = trace_stamp;
+  foreach (l, s->reqs) trace_mark (l->data);
+}
+
+// the latest span of the requirements of s that was parsed last after a time
+int trace_last (Stub *s, int64_t since) { TraceStub *ts; int i, last = -1;
+  trace_stamp++; trace_mark (s);
+  for (i = 0; i < trace_count; i++) { TraceSpan *sp = &trace_spans[i];
+    if (sp->parsed > since && (ts = find_trace (&sp->stub))
+	&& ts->mark == trace_stamp && ts->span == i
+	&& (last < 0 || sp->parsed > trace_spans[last].parsed)) last = i;
+  } return last;
+}
+
+void trace_schedule (Stub *edev, FILE *f) {
+  TraceStub *ts = trace_stub (edev); TraceSpan *sp, *p;
+  int64_t now = stat_now (), since = ts->scheduled, gap, wait, rtt, recv;
+  int64_t total[4] = {0}, *server; int i, j, n = 0, last, *path;
+  if (!(trace_nmarks & 15))
+    trace_marks = realloc (trace_marks,
+			   sizeof (TraceMark) * (trace_nmarks + 16));
+  trace_marks[trace_nmarks].time = now;
+  trace_marks[trace_nmarks++].name = strdup (resource_name (edev));
+  ts->scheduled = now;
+  if ((last = trace_last (edev, since)) < 0) {
+    fprintf (f, "trace: no responses for the schedule of %s\n",
+	     resource_name (edev)); return;
+  }
+  for (i = last; i >= 0 && trace_spans[i].parsed > since;
+       i = trace_spans[i].parent) n++;
+  path = malloc (sizeof (int) * n); j = n;
+  for (i = last; j; i = trace_spans[i].parent) path[--j] = i;
+  server = calloc (trace_nservers * 2, sizeof (int64_t));
+  sp = &trace_spans[path[0]];
+  fprintf (f, "trace: critical path of %s, %d requests in %.1f ms\n",
+	   resource_name (edev), n, (now - sp->queued) / 1e6);
+  fprintf (f, "  %8s %8s %8s %8s %8s  resource (server)\n",
+	   "start", "gap", "wait", "rtt", "recv");
+  for (i = 0; i < n; i++) {
+    sp = &trace_spans[path[i]]; sp->critical = 1;
+    p = i? &trace_spans[path[i-1]] : NULL;
+    gap = p? max (sp->queued - p->parsed, 0) : 0;
+    wait = sp->sent - sp->queued; rtt = sp->first - sp->sent;
+    recv = sp->parsed - sp->first;
+    total[0] += gap; total[1] += wait; total[2] += rtt; total[3] += recv;
+    server[sp->server * 2]++; server[sp->server * 2 + 1] += rtt;
+    fprintf (f, "  %8.1f %8.1f %8.1f %8.1f %8.1f  %s (%s)\n",
+	     (sp->queued - trace_spans[path[0]].queued) / 1e6, gap / 1e6,
+	     wait / 1e6, rtt / 1e6, recv / 1e6, sp->name,
+	     trace_servers[sp->server].origin);
+  }
+  fprintf (f, "  total    %8.1f %8.1f %8.1f %8.1f, scheduled %.1f ms after"
+	   " the last response\n", total[0] / 1e6, total[1] / 1e6,
+	   total[2] / 1e6, total[3] / 1e6, (now - sp->parsed) / 1e6);
+  for (i = 0; i < trace_nservers; i++)
+    if (server[i * 2])
+      fprintf (f, "  %s: %" PRId64 " requests, %.1f ms rtt\n",
+	       trace_servers[i].origin, server[i * 2], server[i * 2 + 1] / 1e6);
+  free (server); free (path);
+}
+
+// write a string as a JSON string
+void trace_string (FILE *f, const char *s) {
+  putc ('"', f);
+  for (; *s; s++) {
+    if (*s == '"' || *s == '\\') fprintf (f, "\\%c", *s);
+    else if ((unsigned char)*s < 0x20) fprintf (f, "\\u%04x", *s);
+    else putc (*s, f);
+  } putc ('"', f);
+}
+
+void trace_slice (FILE *f, const char *name, int i, int64_t start,
+		  int64_t end, int64_t t0) {
+  fprintf (f, ",\n{\"name\":\"%s\",\"ph\":\"X\",\"pid\":%d,\"tid\":%d,"
+	   "\"ts\":%.3f,\"dur\":%.3f}", name, trace_spans[i].server + 1, i + 1,
+	   (start - t0) / 1e3, (end - start) / 1e3);
+}
+
+int trace_save (const char *name) {
+  FILE *f; int i; int64_t t0 = trace_count? trace_spans[0].queued : 0;
+  if (!(f = fopen (name, "w"))) return 0;
+  for (i = 1; i < trace_count; i++) t0 = min (t0, trace_spans[i].queued);
+  fprintf (f, "{\"traceEvents\":[\n{\"name\":\"process_name\",\"ph\":\"M\","
+	   "\"pid\":0,\"args\":{\"name\":\"schedules\"}}");
+  for (i = 0; i < trace_nservers; i++) {
+    fprintf (f, ",\n{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":%d,"
+	     "\"args\":{\"name\":", i + 1);
+    trace_string (f, trace_servers[i].origin); fprintf (f, "}}");
+  }
+  for (i = 0; i < trace_count; i++) { TraceSpan *sp = &trace_spans[i];
+    fprintf (f, ",\n{\"name\":"); trace_string (f, sp->name);
+    fprintf (f, ",\"cat\":\"%s\",\"ph\":\"X\",\"pid\":%d,\"tid\":%d,"
+	     "\"ts\":%.3f,\"dur\":%.3f,%s\"args\":{\"status\":%d",
+	     sp->type < 0? "unknown" : se_schema.elements[sp->type],
+	     sp->server + 1, i + 1, (sp->queued - t0) / 1e3,
+	     (span_end (sp) - sp->queued) / 1e3,
+	     sp->critical? "\"cname\":\"terrible\"," : "", sp->status);
+    if (sp->parent >= 0) {
+      fprintf (f, ",\"parent\":");
+      trace_string (f, trace_spans[sp->parent].name);
+    } fprintf (f, ",\"critical\":%d}}", sp->critical);
+    if (sp->sent > sp->queued)
+      trace_slice (f, "queued", i, sp->queued, sp->sent, t0);
+    trace_slice (f, "response", i, sp->sent, sp->first, t0);
+    trace_slice (f, "receive", i, sp->first, sp->parsed, t0);
+    if (sp->complete > sp->parsed)
+      trace_slice (f, "complete", i, sp->parsed, sp->complete, t0);
+  }
+  for (i = 0; i < trace_nmarks; i++) {
+    fprintf (f, ",\n{\"name\":\"DEVICE_SCHEDULE\",\"ph\":\"i\",\"s\":\"g\","
+	     "\"pid\":0,\"tid\":0,\"ts\":%.3f,\"args\":{\"device\":",
+	     (trace_marks[i].time - t0) / 1e3);
+    trace_string (f, trace_marks[i].name); fprintf (f, "}}");
+  }
+  fprintf (f, "\n],\"displayTimeUnit\":\"ms\"}\n");
+  fclose (f); return 1;
+}
+
+#endif
@@ -4,10 +4,19 @@
 char *utf8_char (int *code, char *data);
 char *utf8_encode (char *data, unsigned int code);
 char *utf8_start (char *data);
+char *utf8_ascii (char *data, char *end);
+int utf8_valid (char *data, int length);
+char *utf8_copy (char *dest, char *data, int length);
+int utf8_count (char *data, int length);
 
 #ifndef HEADER_ONLY
 
 #include <stdint.h>
+#include <string.h>
+
+#if defined (__SSE2__)
+#include <emmintrin.h>
+#endif
 
 #define UTF_REJECT 99
 
@@ -63,26 +72,86 @@ char *utf8_encode (char *data, unsigned int code) {
     *data++ = 0x80 | ((code >> 6) & 0x3f);
     goto byte_1;
   }
-  if (code <= 0x1ffff) {
-    *data++ = 0xe0 | (code >> 18);
+  if (code <= 0x10ffff) {
+    *data++ = 0xf0 | (code >> 18);
     *data++ = 0x80 | ((code >> 12) & 0x3f);
     goto byte_2;
   }
   return NULL;
 }
 
+/* Bulk operations on spans of UTF-8 text. Runs of ASCII are skipped 16
+   bytes at a time (SSE2) or 8 bytes at a time, only the multi-byte
+   characters are decoded. The spans are bounded by their length, so
+   truncated characters at the end of a span are rejected. */
+
+// return a pointer to the first non-ASCII byte of data, or end
+char *utf8_ascii (char *data, char *end) { uint64_t x;
+#if defined (__SSE2__)
+  while (end - data >= 16) {
+    int mask = _mm_movemask_epi8 (_mm_loadu_si128 ((__m128i *)data));
+    if (mask) return data + __builtin_ctz (mask);
+    data += 16;
+  }
+#endif
+  while (end - data >= 8) {
+    memcpy (&x, data, 8);
+    if (x & 0x8080808080808080ULL) break;
+    data += 8;
+  }
+  while (data < end && !(*data & 0x80)) data++;
+  return data;
+}
+
+// decode a multi-byte character that lies within end
+static inline char *utf8_next (int *code, char *data, char *end) {
+  uint8_t c = *data;
+  int n = c >= 0xf0? 4 : c >= 0xe0? 3 : 2;
+  return end - data < n? NULL : utf8_char (code, data);
+}
+
+// validate length bytes of UTF-8, returns 1 if valid, 0 otherwise
+int utf8_valid (char *data, int length) {
+  char *end = data + length; int c;
+  while ((data = utf8_ascii (data, end)) < end)
+    if (!(data = utf8_next (&c, data, end))) return 0;
+  return 1;
+}
+
+/* copy and validate length bytes of UTF-8 to dest, returns a pointer to the
+   end of the copy or NULL if invalid, dest may overlap data if it is not
+   after data (to compact text in place) */
+char *utf8_copy (char *dest, char *data, int length) {
+  char *end = data + length, *next; int c;
+  while (data < end) {
+    next = utf8_ascii (data, end);
+    if (next < end && !(next = utf8_next (&c, next, end))) return NULL;
+    if (dest != data) memmove (dest, data, next - data);
+    dest += next - data; data = next;
+  } return dest;
+}
+
+// count the code points in length bytes of (valid) UTF-8
+int utf8_count (char *data, int length) {
+  char *end = data + length; int count = length;
+  // every continuation byte (10xxxxxx) is one less code point
+#if defined (__SSE2__)
+  while (end - data >= 16) {
+    __m128i x = _mm_loadu_si128 ((__m128i *)data);
+    count -= __builtin_popcount
+      (_mm_movemask_epi8 (_mm_cmplt_epi8 (x, _mm_set1_epi8 (-64))));
+    data += 16;
+  }
+#endif
+  while (data < end) count -= (*data++ & 0xc0) == 0x80;
+  return count;
+}
+
 int utf8_length (const char *data) {
-  int c, length = 0;
-  while (c = *data++) {
-    if (c & 0x80) {
-      if (c & 0x20) {
-	if (c & 0x10) data++;
-	data++;
-      } data++;
-    } length++;
-  } return length;
+  return utf8_count ((char *)data, strlen (data));
 }
 
+
 char *utf8_start (char *data) { int c;
   utf8_char (&c, data);
   return c == 0xfeff? data+3 : data;
@@ -36,8 +36,12 @@ char *number64 (uint64_t *x, char *data);
 
 #ifndef HEADER_ONLY
 
-int bit_count (uint32_t x) { int n = 0;
-  while (x) x >>= 1, n++; return n;
+int bit_count (uint32_t x) {
+#ifdef __GNUC__
+  return x? 32 - __builtin_clz (x) : 0;
+#else
+  int n = 0; while (x) x >>= 1, n++; return n;
+#endif
 }
 
 int string_index (const char *s, const char * const *ss, int n) { int i;
@@ -23,25 +23,22 @@ int output_char (Output *o, int c) {
 }
 
 int output_escaped (Output *o, char *s) {
-  char *ptr = o->ptr; int c;
+  char *ptr = o->ptr;
   if (!s) {
-    printf ("output_quoted: NULL value\n");
-    print_stack (&o->stack, o->schema);
+    log_warn ("output_quoted: NULL value\n");
+    if (log_enabled (LOG_WARN)) print_stack (&o->stack, o->schema);
     return 0;
   }
-  while (*s) {
-    char *next = utf8_char (&c, s);
-    int size = o->end - ptr, n;
-    switch (c) {
-    case '<': n = 4; s = "&lt;"; break;
-    case '>': n = 4; s = "&gt;"; break;
-    case '&': n = 5; s = "&amp;"; break;
-    case '\"': n = 6; s = "&quot;"; break;
-    default: n = next-s;
+  while (*s) { // copy the run of text up to the next escaped character
+    int n = strcspn (s, "<>&\""), size = o->end - ptr; char *e = s;
+    switch (n? 0 : *s) {
+    case '<': n = 4; e = "&lt;"; break;
+    case '>': n = 4; e = "&gt;"; break;
+    case '&': n = 5; e = "&amp;"; break;
+    case '\"': n = 6; e = "&quot;";
     }
-    if (size > n) { memcpy (ptr, s, n); ptr += n; }
-    else { *o->ptr = '\0'; return 0; }
-    s = next;
+    if (size <= n) { *o->ptr = '\0'; return 0; }
+    memcpy (ptr, e, n); ptr += n; s += e == s? n : 1;
   } o->ptr = ptr; *ptr = '\0'; return 1;
 }
 
@@ -84,8 +81,8 @@ int output_value (Output *o, void *value) {
 int output_quoted (Output *o, void *value) {
   char *last = o->ptr;
   if (!value) {
-    printf ("output_quoted: NULL value\n");
-    print_stack (&o->stack, o->schema);
+    log_warn ("output_quoted: NULL value\n");
+    if (log_enabled (LOG_WARN)) print_stack (&o->stack, o->schema);
   } else if (output_char (o, '\"') && output_value (o, value)
       && output_char (o, '\"')) return 1;
   *last = '\0'; o->ptr = last; return 0;
@@ -148,12 +145,72 @@ int output_xsi_type (Output *o) {
 
 void output_done (Output *o) { output_char (o, '\n'); }
 
+/* Output used by the specialized functions of a SchemaCodec, equivalent to
+   the events of output_event. Each leaves room for the terminating NUL. */
+
+int xml_put (Output *o, const char *s, int n) {
+  if (n >= o->end - o->ptr) return 0;
+  memcpy (o->ptr, s, n); o->ptr += n; *o->ptr = '\0'; return 1;
+}
+
+// start tag of an element on a new line
+int xml_put_tag (Output *o, const char *tag, int n) {
+  if (o->open) { if (!output_char (o, '>')) return 0; o->open = 0; }
+  if (!o->first) { char *end = o->ptr + o->indent + 1;
+    if (end >= o->end) return 0;
+    *o->ptr++ = '\n'; while (o->ptr < end) *o->ptr++ = ' ';
+  } return xml_put (o, tag, n);
+}
+
+// start tag of a complex element (left open for the attributes)
+int xml_put_start (Output *o, const char *tag, int n) {
+  if (!xml_put_tag (o, tag, n)) return 0;
+  if (o->first) { const char *ns = o->schema->namespace;
+    if (ns && !output_string (o, " xmlns=\"%s\"", ns)) return 0;
+    o->first = 0;
+  } o->open = 1; o->indent += 2; return 1;
+}
+
+// end tag of a complex element
+int xml_put_end (Output *o, const char *tag, int n) {
+  o->indent -= 2;
+  if (o->open) { o->open = 0; return xml_put (o, "/>", 2); }
+  return xml_put_tag (o, tag, n);
+}
+
+int xml_put_uint (Output *o, uint64_t x) {
+  char digits[20], *d = digits+20;
+  do *--d = '0' + x % 10; while (x /= 10);
+  return xml_put (o, d, digits+20-d);
+}
+
+int xml_put_int (Output *o, int64_t x) {
+  if (x >= 0) return xml_put_uint (o, x);
+  return xml_put (o, "-", 1) && xml_put_uint (o, -(uint64_t)x);
+}
+
+int xml_put_bool (Output *o, int x) {
+  return x? xml_put (o, "true", 4) : xml_put (o, "false", 5);
+}
+
+// specialized output of a document, returns the length or 0 to fall back
+int xml_output_codec (Output *o, void *obj, int type) {
+  const SchemaCodec *c = o->schema->codec;
+  if (!c || o->limit != INT_MAX) return 0;
+  o->first = 1;
+  if (c->output_xml (o, obj, type) && output_char (o, '\n'))
+    return o->ptr - o->buffer;
+  o->ptr = o->buffer; *o->ptr = '\0';
+  o->indent = 0; o->open = 0; return 0;
+}
+
 const OutputDriver xml_output = {
   output_event,
   output_xsi_type,
   output_quoted,
   output_value,
-  output_done
+  output_done,
+  xml_output_codec
 };
 
 void output_init (Output *o, const Schema *schema, char *buffer, int size) {
@@ -32,7 +32,10 @@ int parse_token (Parser *p) {
   case XML_INVALID: p->state = PARSE_INVALID; return XML_INVALID;
   case XML_INCOMPLETE: p->ptr = (uint8_t *)p->xml->content;
     return XML_INCOMPLETE;
-  default: p->need_token = 0; return p->token;
+  default: p->need_token = 0;
+    if (p->token <= END_TAG && p->schema->hash)
+      p->tag = name_index (p->schema, p->xml->name);
+    return p->token;
   }
 }
 
@@ -78,7 +81,7 @@ int parse_value (Parser *p, void *value) {
     if (n) {
       if (strlen (data) > n-1) return 0;
       strcpy (value, data);
-    } else *(char **)(value) = strdup (data); return 1;
+    } else *(char **)(value) = parse_strdup (p, data); return 1;
   case XS_BOOLEAN:
     if (streq (data, "true") || streq (data, "1"))
       *(uint32_t *)value |= 1 << p->flag;
@@ -86,7 +89,7 @@ int parse_value (Parser *p, void *value) {
       p->state = PARSE_INVALID; break;
     } return 1;
   case XS_HEX_BINARY: return parse_hex (value, n, data);
-  case XS_ANY_URI: *(char **)(value) = strdup (data); return 1;
+  case XS_ANY_URI: *(char **)(value) = parse_strdup (p, data); return 1;
   case XS_LONG: return pack_signed ((int64_t *)value, sx, data);
   case XS_INT: return pack_signed ((int32_t *)value, sx, data);
   case XS_SHORT: return pack_signed ((int16_t *)value, sx, data);
@@ -105,12 +108,19 @@ int parse_text_value (Parser *p, void *value) {
   return parse_text (p) && parse_value (p, value);
 }
 
+// does the current tag match the name of a schema entry?
+int tag_match (Parser *p, const SchemaEntry *se) {
+  const Schema *s = p->schema; int index = se - s->entries;
+  if (s->hash && index >= s->length)
+    return p->tag == s->ids[index - s->length];
+  return streq (se_name (se, s), p->xml->name);
+}
+
 int start_tag (Parser *p, const SchemaEntry *se) {
-  const char *name = se_name (se, p->schema);
   switch (parse_token (p)) {
   case START_TAG: case EMPTY_TAG:
     if (p->empty) p->state = PARSE_INVALID;
-    else if (!streq (name, p->xml->name)) break;
+    else if (!tag_match (p, se)) break;
     else { p->empty = p->token; p->need_token = 1;
       if (p->empty && se->type & ST_SIMPLE) p->state = PARSE_INVALID;
       else return 1;
@@ -121,9 +131,8 @@ int start_tag (Parser *p, const SchemaEntry *se) {
 }
 
 int end_tag (Parser *p, const SchemaEntry *se) {
-  const char *name = se_name (se, p->schema);
   switch (parse_token (p)) {
-  case END_TAG: if (streq (name, p->xml->name)) {
+  case END_TAG: if (tag_match (p, se)) {
       p->need_token = 1; return 1; } 
   } return 0;
 }
@@ -135,7 +144,9 @@ int compare_names (const void *a, const void *b) {
 }
 
 int local_name_index (const Schema *schema, char *name) {
-  const char * const *loc =
+  const char * const *loc;
+  if (schema->hash) return name_index (schema, name);
+  loc =
     bsearch (&name, schema->names, schema->count,
 	     sizeof (char *), compare_names);
   return loc? loc - schema->names : -1;
@@ -219,9 +230,171 @@ void xml_rebuffer (Parser *p, char *data, int length) {
   } else xml->data = data;
 }
 
+/* Scanning used by the specialized functions of a SchemaCodec. The data is
+   not modified, so that the document can still be parsed by the driver when
+   a specialized function fails. Anything beyond the plain markup that the
+   IEEE 2030.5 servers produce (entity references, comments, CDATA sections,
+   non-ASCII text, or an incomplete document) fails. */
+
+#define SCAN_ATTRIBUTES 8
+#define SCAN_TEXT 1024
+
+typedef struct {
+  int n, empty;
+  const char *name[SCAN_ATTRIBUTES]; int length[SCAN_ATTRIBUTES];
+  char *value[SCAN_ATTRIBUTES];
+  char buffer[512];
+} ScanTag;
+
+int scan_name_char (int c) {
+  return alpha (c) || digit (c) || c == '_' || c == ':' || c == '-'
+    || c == '.';
+}
+
+// match the start of a tag "<name"
+int xml_scan_start (char **s, const char *tag, int n) {
+  char *data = skip_ws (*s);
+  if (strncmp (data, tag, n) || scan_name_char (data[n])) return 0;
+  *s = data+n; return 1;
+}
+
+// scan the attributes and the end of a start tag
+int xml_scan_tag (char **s, ScanTag *t) {
+  char *data = *s, *b = t->buffer, *end = b+512; int c, q;
+  t->n = 0;
+  while (ws (*data)) { data = trim (data);
+    if (!(alpha (*data) || *data == '_' || *data == ':')) break;
+    if (t->n == SCAN_ATTRIBUTES) return 0;
+    t->name[t->n] = data;
+    while (scan_name_char (*data)) data++;
+    t->length[t->n] = data - t->name[t->n];
+    data = trim (data); if (*data++ != '=') return 0;
+    data = trim (data); q = *data++;
+    if (q != '"' && q != '\'') return 0;
+    t->value[t->n++] = b;
+    while ((c = *data++) != q) {
+      if (c == '\0' || c == '<' || c == '&' || c & 0x80 || b+1 == end)
+	return 0;
+      *b++ = c;
+    } *b++ = '\0';
+  }
+  if ((t->empty = *data == '/')) data++;
+  if (*data != '>') return 0;
+  *s = data+1; return 1;
+}
+
+char *xml_scan_attr (ScanTag *t, const char *name, int n) { int i;
+  for (i = 0; i < t->n; i++)
+    if (t->length[i] == n && !strncmp (t->name[i], name, n))
+      return t->value[i];
+  return NULL;
+}
+
+// copy the text of a simple element (after "<name") to a buffer
+int xml_scan_text (char **s, char *text) {
+  char *data = *s, *end = text + SCAN_TEXT - 1; int c;
+  if (*data++ != '>') return 0;
+  data = skip_ws (data);
+  while ((c = *data) != '<') {
+    if (c == '&' || c & 0x80 || (c < 0x20 && !ws (c)) || text == end)
+      return 0;
+    *text++ = c; data++;
+  } *text = '\0'; *s = data; return 1;
+}
+
+// match an end tag "</name>"
+int xml_scan_end (char **s, const char *tag, int n) {
+  char *data = skip_ws (*s);
+  if (strncmp (data, tag, n)) return 0;
+  *s = data+n; return 1;
+}
+
+#define scan_signed(name, type) \
+  int name (char *text, type *v) { int64_t x; \
+    return signed_int (&x, text)? *v = x, 1 : 0; }
+#define scan_unsigned(name, type) \
+  int name (char *text, type *v) { uint64_t x; \
+    return unsigned_int (&x, text)? *v = x, 1 : 0; }
+
+scan_signed (xml_long, int64_t)
+scan_signed (xml_int, int32_t)
+scan_signed (xml_short, int16_t)
+scan_signed (xml_byte, int8_t)
+scan_unsigned (xml_ulong, uint64_t)
+scan_unsigned (xml_uint, uint32_t)
+scan_unsigned (xml_ushort, uint16_t)
+scan_unsigned (xml_ubyte, uint8_t)
+
+#undef scan_signed
+#undef scan_unsigned
+
+int xml_string (char *text, char *v, int n) {
+  if (strlen (text) > n-1) return 0;
+  strcpy (v, text); return 1;
+}
+
+int xml_uri (Parser *p, char *text, char **v) {
+  *v = parse_strdup (p, text); return 1;
+}
+
+int xml_bool (char *text, void *flags, int flag) {
+  if (streq (text, "true") || streq (text, "1"))
+    *(uint32_t *)flags |= 1 << flag;
+  else if (!(streq (text, "false") || streq (text, "0"))) return 0;
+  return 1;
+}
+
+// skip the whitespace and XML declaration before the root element
+char *xml_scan_decl (Parser *p, char *data, int *decl) {
+  char buffer[128], *attr[MAX_ATTRIBUTE*2], *end; int n;
+  data = skip_ws (data); *decl = 0;
+  if (strncmp (data, "<?xml", 5) || !ws (data[5])) return data;
+  if (p->xml_decl || !(end = strstr (data, "?>"))
+      || (n = end - (data+6)) >= 128) return NULL;
+  memcpy (buffer, data+6, n); buffer[n] = '\0';
+  if (!only (xml_attributes (attr, buffer))) return NULL;
+  *decl = 1; return skip_ws (end+2);
+}
+
+// skip the element at data ("<name"), return the end of the element or NULL
+// if the element has markup other than tags and text
+char *xml_skip_element (char *data) { int depth = 0, q;
+  while ((data = strchr (data, '<'))) {
+    switch (*++data) {
+    case '!': case '?': return NULL;
+    case '/': ok (data = strchr (data, '>'));
+      if (--depth == 0) return data+1; break;
+    default:
+      while (*data != '>') {
+	if (*data == '"' || *data == '\'') {
+	  q = *data; ok (data = strchr (data+1, q));
+	} else if (!*data) return NULL;
+	data++;
+      } if (data[-1] != '/') depth++;
+      else if (!depth) return data+1;
+    }
+  } return NULL;
+}
+
+// specialized parse of a complete document, NULL to use the driver
+void *xml_parse_codec (Parser *p, int *type) {
+  const SchemaCodec *c = p->schema->codec;
+  XmlParser *xml = p->xml; char *data; void *obj; int t, decl;
+  if (!c || !p->need_token || xml->state
+      || !(data = xml_scan_decl (p, xml->data, &decl))
+      || (t = c->xml_root (&data)) < 0) return NULL;
+  obj = parse_alloc (p, object_size (t, p->schema));
+  if (!c->parse_xml (p, &data, obj, t)) {
+    if (!p->arena) free_object (obj, t, p->schema);
+    return NULL;
+  }
+  p->xml_decl |= decl; xml->data = data; xml->token = END_TAG;
+  parse_done (p); *type = p->type = t; return obj;
+}
+
 const ParserDriver xml_parser = {
   xml_start, xml_next, xml_xsi_type, xml_end, xml_sequence,
-  parse_value, parse_text_value, parse_done, xml_rebuffer
+  parse_value, parse_text_value, parse_done, xml_rebuffer, xml_parse_codec
 };
 
 void parse_init (Parser *p, const Schema *schema, char *data) {
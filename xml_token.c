@@ -87,22 +87,115 @@ char *xml_reference (char **ptr, char *data) {
   return i < 5? *(*ptr)++ = entity[i], end : NULL;
 }
 
+/* Scan runs of ASCII text and whitespace 16 bytes at a time. The loads are
+   aligned so they never cross a page boundary, the NUL terminator always
+   ends a run. A run of text ends with '<', '&', '\0', a non-ASCII byte, or a
+   control character other than whitespace. */
+
+#if defined (__SSE2__)
+
+#include <emmintrin.h>
+
+typedef __m128i Block;
+#define block_load(p) _mm_load_si128 ((const __m128i *)(p))
+#define block_eq(x, c) _mm_cmpeq_epi8 (x, _mm_set1_epi8 (c))
+#define block_mask(x) ((uint64_t)_mm_movemask_epi8 (x))
+#define MASK_BITS 1 // bits of the mask per byte
+
+static inline uint64_t text_stop (Block x) {
+  Block ws = _mm_or_si128 (_mm_or_si128 (block_eq (x, '\t'),
+					 block_eq (x, '\n')),
+			   block_eq (x, '\r'));
+  // signed compare, true for bytes >= 0x80 and < 0x20
+  Block ctl = _mm_andnot_si128 (ws, _mm_cmplt_epi8 (x, _mm_set1_epi8 (0x20)));
+  return block_mask (_mm_or_si128 (ctl, _mm_or_si128 (block_eq (x, '<'),
+						  block_eq (x, '&'))));
+}
+
+static inline uint64_t ws_stop (Block x) {
+  Block ws = _mm_or_si128 (_mm_or_si128 (block_eq (x, '\t'),
+					 block_eq (x, '\n')),
+			   _mm_or_si128 (block_eq (x, '\r'),
+					 block_eq (x, ' ')));
+  return block_mask (ws) ^ 0xffff;
+}
+
+#elif defined (__ARM_NEON)
+
+#include <arm_neon.h>
+
+typedef uint8x16_t Block;
+#define block_load(p) vld1q_u8 ((const uint8_t *)(p))
+#define block_eq(x, c) vceqq_u8 (x, vdupq_n_u8 (c))
+#define block_mask(x) \
+  vget_lane_u64 (vreinterpret_u64_u8 \
+		 (vshrn_n_u16 (vreinterpretq_u16_u8 (x), 4)), 0)
+#define MASK_BITS 4
+
+static inline uint64_t text_stop (Block x) {
+  Block ws = vorrq_u8 (vorrq_u8 (block_eq (x, '\t'), block_eq (x, '\n')),
+		       block_eq (x, '\r'));
+  Block ctl = vbicq_u8 (vorrq_u8 (vcltq_u8 (x, vdupq_n_u8 (0x20)),
+				  vcgeq_u8 (x, vdupq_n_u8 (0x80))), ws);
+  return block_mask (vorrq_u8 (ctl, vorrq_u8 (block_eq (x, '<'),
+					      block_eq (x, '&'))));
+}
+
+static inline uint64_t ws_stop (Block x) {
+  Block ws = vorrq_u8 (vorrq_u8 (block_eq (x, '\t'), block_eq (x, '\n')),
+		       vorrq_u8 (block_eq (x, '\r'), block_eq (x, ' ')));
+  return ~block_mask (ws);
+}
+
+#endif
+
+#ifdef MASK_BITS
+
+#define block_scan(data, stop) {					\
+    uintptr_t off = (uintptr_t)(data) & 15;				\
+    char *p = (data) - off;						\
+    uint64_t mask = stop (block_load (p)) >> (off * MASK_BITS);		\
+    if (mask) return (data) + __builtin_ctzll (mask) / MASK_BITS;	\
+    do { p += 16; } while (!(mask = stop (block_load (p))));		\
+    return p + __builtin_ctzll (mask) / MASK_BITS;			\
+  }
+
+char *ascii_text (char *data) block_scan (data, text_stop)
+
+char *skip_ws (char *data) block_scan (data, ws_stop)
+
+#else
+
+char *ascii_text (char *data) { uint8_t c;
+  while ((c = *data) >= 0x20 ? c < 0x80 && c != '<' && c != '&' : ws (c))
+    data++;
+  return data;
+}
+
+#define skip_ws trim
+
+#endif
+
 char *token_end (char *data, char *end, int n) { char *next;
   if ((next = strstr (data, end))) {
     *next = '\0'; return next+n;
   } return NULL;
 }
 
+// parse an attribute value in place, the runs of text between references
+// are validated as UTF-8 in bulk
 char *att_value (char *value) {
-  int c, q = *value++; char *data = value;
+  int q = *value++; char *data = value;
   ok (q == '"' || q == '\''); 
-  while (c = *data++) {
-    switch (c) {
-    case '\0': case '<': return NULL;
+  while (1) {
+    int n = strcspn (data, q == '"'? "\"<&" : "'<&");
+    ok (value = utf8_copy (value, data, n)); data += n;
+    switch (*data++) {
     case '&': ok (data = xml_reference (&value, data)); break;
-    default: if (c == q) return *value = '\0', data;
-    } *value++ = c;
-  } return NULL;
+    case '<': case '\0': return NULL;
+    default: *value = '\0'; return data;
+    }
+  }
 }
 
 char *xml_eq (char *data) {
@@ -139,8 +232,8 @@ char *xml_tag (XmlParser *p, char *data) { char *end;
   p->token = *data == '/'? data++, END_TAG : START_TAG;
   p->name = data; ok (data = end = xml_name (data));
   if (p->token == START_TAG) {
-    if (ws (*data))
-      ok (data = xml_attributes (p->attr, data+1));
+    if (!ws (*data)) p->attr[0] = NULL; // no attributes
+    else ok (data = xml_attributes (p->attr, data+1));
     if (*data == '/') data++, p->token = EMPTY_TAG;
   } else data = trim (data);
   ok (*data == '>'); *end = '\0';
@@ -156,7 +249,7 @@ int xml_token (XmlParser *p) {
     switch (state) {
     case 0: // initial state
       if (c == '<') state = 2;
-      else if (ws (c)) next = trim (next);
+      else if (ws (c)) next = skip_ws (next);
       else {
 	p->content = text = data;
 	p->token = XML_TEXT; 
@@ -171,11 +264,13 @@ int xml_token (XmlParser *p) {
 	} else goto incomplete; break;
       case '<': state++; break;
       default:
-	if (next = utf8_char (&c, data)) {
-	  if (xml_char (c))
-	    text = utf8_encode (text, c);
-	  else return XML_INVALID;
-	} else goto incomplete;
+	if ((next = ascii_text (data)) == data) {
+	  // validate a UTF-8 character
+	  if (!(next = utf8_char (&c, data))) goto incomplete;
+	  if (!xml_char (c)) return XML_INVALID;
+	} // the text only moves after a reference or CDATA section
+	if (text != data) memmove (text, data, next - data);
+	text += next - data;
       } break;
     case 2: // "<" (tag)
       switch (c) {